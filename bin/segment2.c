@@ -2692,6 +2692,24 @@ const Gfx dl_shadow_end[] = {
     gsSPEndDisplayList(),
 };
 
+#ifdef SHADOW_BATCHING
+// Batched shadows share one dl_shadow_circle/square setup and one teardown per
+// frame, so each shadow in the batch draws only its quad.
+const Gfx dl_shadow_quad[] = {
+    gsSPVertex(vertex_shadow, 4, 0),
+    gsSP2Triangles( 0,  2,  1, 0x0,  1,  2,  3, 0x0),
+    gsSPEndDisplayList(),
+};
+
+const Gfx dl_shadow_batch_end[] = {
+    gsDPPipeSync(),
+    gsSPTexture(0xFFFF, 0xFFFF, 0, G_TX_RENDERTILE, G_OFF),
+    gsSPSetGeometryMode(G_LIGHTING | G_CULL_BACK),
+    gsDPSetCombineMode(G_CC_SHADE, G_CC_SHADE),
+    gsSPEndDisplayList(),
+};
+#endif
+
 // 0x02014660 - 0x02014698
 const Gfx dl_proj_mtx_fullscreen[] = {
     gsDPPipeSync(),
@@ -2,9 +2,9 @@
 $(BUILD_DIR)/%.gz: $(BUILD_DIR)/%.bin
 	$(call print,Compressing:,$<,$@)
 ifeq ($(GZIPVER),std)
-	$(V)$(GZIP) -c -9 -n $< > $@
+	$(V)$(CACHED_COMPRESS) -i $< -o $@ --stdout -- $(GZIP) -c -9 -n $<
 else
-	$(V)$(GZIP) -c -12 -n $< > $@
+	$(V)$(CACHED_COMPRESS) -i $< -o $@ --stdout -- $(GZIP) -c -12 -n $<
 endif
 
 # Strip gzip header
@@ -10,6 +10,132 @@
 // Increases the audio heap size to allow for more concurrent notes to be played and for more custom sequences/banks to be imported (not supported for SH).
 #define EXPAND_AUDIO_HEAP
 
+// Keeps instrument banks loaded into the persistent audio pool resident across
+// level transitions, so returning to music that shares banks with a previous
+// track costs no DMA. When the pool fills up, the least recently used unplayed
+// banks are evicted and the pool is compacted in place. Currently US/JP only.
+#define PERSISTENT_BANK_CACHE
+
+// Remembers each instrument bank's 16-byte ctl header (instrument and drum
+// counts) the first time it is fetched, so reloading a bank that was evicted
+// from the pools skips the blocking header DMA and goes straight to the bulk
+// data transfer. That synchronous 16-byte read can queue behind large level
+// DMAs, and the dynamic music system swaps banks mid-level constantly; the
+// headers live in ROM and never change, so once seen they stay valid.
+#define AUDIO_BANK_HEADER_CACHE
+
+// Defragments the persistent sequence pool when a new sequence doesn't fit:
+// the least recently played discardable sequences are evicted and the pool is
+// slid together, fixing up the script pointers of anything still playing.
+// Since the allocation happens right after the outgoing music has faded out,
+// the copy lands in the silence window of the transition. Together with
+// PERSISTENT_BANK_CACHE this frees up headroom for larger sequences and
+// soundfonts in the same heap footprint. Currently US/JP only.
+#define SEQ_POOL_COMPACTION
+
+// Runtime-selectable reverb quality tiers. set_reverb_tier(REVERB_TIER_OFF /
+// REVERB_TIER_SMALL / REVERB_TIER_FULL) from the game thread switches the
+// reverb window at the next audio frame boundary, with the wet signal faded
+// out and back in so there is no click. SMALL uses a quarter of the preset
+// window, cutting the ring buffer processing cost on crowded frames. With
+// AUDIO_VOICE_BUDGET enabled, the tier also drops automatically by one step
+// while voices are being shed, and recovers after a few calm seconds. US/JP
+// only, and inactive when BETTER_REVERB is running (it has its own knobs).
+#define REVERB_QUALITY_TIERS
+
+// Routes the game thread's audio state pokes (stop_sound, seq_player_fade_out,
+// volume lowering/fading, muting) through a lock-free single-producer ring that
+// the audio thread drains once per frame, the same scheme play_sound already
+// uses for triggers. Vanilla calls these directly from the game thread while
+// the audio thread is reading the same sound bank lists and player state, which
+// can corrupt a list node or fade mid-update when the timing is unlucky; the
+// ring makes every game->audio command take effect at a single well-defined
+// point. Currently US/JP only (EU/SH already have their own command queue).
+#define AUDIO_COMMAND_RING
+
+// Streams newly started sequences and their missing instrument bank from the
+// cartridge in the background instead of stalling the game thread (and losing
+// audio frames) on a synchronous DMA whenever the music changes. Playback
+// begins as soon as the data lands, usually within a frame or two. US/JP only;
+// EU and SH schedule their loads through a separate port layer.
+#define ASYNC_SEQUENCE_LOADING
+
+// Batches the audio frame's sample DMAs instead of firing one PI request per
+// chunk miss in dma_sample_data. Requests collect in a pending list during
+// synthesis and are flushed once per frame: sorted by ROM address, runs that
+// happen to be contiguous in both ROM and RAM merge into single transfers,
+// and everything is issued at PI high priority so a note's sample fetch jumps
+// ahead of queued level-load and prefetch DMAs instead of starving behind
+// them on warp frames. Note-dense frames pay one setup per run rather than
+// per chunk. US/JP only; EU and SH issue their sample DMAs elsewhere.
+#define AUDIO_DMA_BATCHING
+
+// Bounds the RSP synthesis workload by gracefully shedding voices: whenever
+// more notes than this are being rendered at once, the quietest stealable ones
+// are released through their normal ADSR fade (no click) until the count is
+// back under the budget. Overrunning the audio time slice produces crackle on
+// busy frames; dropping a note nobody can hear over the mix is the graceful
+// alternative. gAudioVoicesInUse / gAudioVoicesDropped / gAudioCmdsLastFrame
+// expose the per-frame accounting, and the profiler (USE_PROFILER) shows the
+// measured audio RSP time. Comment out to disable. Currently US/JP only.
+#define AUDIO_VOICE_BUDGET 28
+
+// Channel-group ducking for layered music, evaluated on the audio thread.
+// music_duck_group_config(group, player, channelMask) assigns a set of a
+// sequence player's channels to a duck group once; music_duck_group_set(group,
+// scale, fadeDuration) then ramps those channels toward scale (0..127) over
+// fadeDuration audio updates. The envelope runs inside process_sequences, so
+// intensity layering costs the game thread one command per *change* of target
+// instead of a volume message per frame, and the ramp stays smooth even when
+// the game thread hitches. The duck scale multiplies on top of the sequence's
+// own channel volumes, so it composes with music dynamics and fades. US/JP
+// only (EU/SH route channel volume through their own port layer).
+#define CHANNEL_GROUP_DUCKING
+// Number of independently ducked channel groups.
+#define CHANNEL_DUCK_GROUPS 4
+
+// Deduplicates object sound requests within a frame: when a crowd of identical
+// enemies fires the same sound ID from sources in the same
+// OBJ_SOUND_DEDUP_BUCKET sized region, only the closest source's request is
+// forwarded to the audio engine, cutting note churn and volume stacking. The
+// engine already merges repeat requests from the *same* source; this merges
+// requests across sources. Requests are collected during the object update
+// pass and flushed once at its end; sounds from different buckets, different
+// IDs, or non-object code paths are unaffected.
+#define OBJ_SOUND_DEDUP
+
+#ifdef OBJ_SOUND_DEDUP
+// Side length (in units, camera space) of the merge regions. Two same-ID
+// sources merge only when they fall in the same region.
+#define OBJ_SOUND_DEDUP_BUCKET 600.0f
+// Distinct (sound ID, region) pairs tracked per frame; overflow passes
+// requests straight through.
+#define OBJ_SOUND_DEDUP_SLOTS 24
+#endif
+
+// Level-authored ambient sound zones: AMBIENT_SOUND_ZONE boxes in level scripts
+// replace the invisible emitter objects vanilla scatters around for waterfalls,
+// birds and droning ambience. One manager checks Mario against the zone table
+// each frame and keeps the sounds of the zones he is inside alive, so the
+// emitters stop costing object slots and behavior updates. Existing emitter
+// objects keep working; zones are just the cheaper way to author new ambience.
+#define AMBIENT_SOUND_ZONES
+
+#ifdef AMBIENT_SOUND_ZONES
+// Zones loadable at once across all areas of a level. Commands past the cap are ignored.
+#define AMBIENT_SOUND_ZONE_MAX 16
+// How far (in units) Mario must leave a zone's box before its sound cuts out.
+// Keeps the sound from stuttering when he lingers on a zone edge.
+#define AMBIENT_SOUND_ZONE_HYSTERESIS 150
+#endif
+
+// Reads ahead on long non-looped samples (streamed ambience, voice clips): while
+// one window of ADPCM data plays, the next one is already being DMA'd from the
+// cartridge. Vanilla only fetches each window on the exact audio update that
+// needs it, which leaves the fetch barely a frame to complete and crackles when
+// the PI bus is busy with level loads. Costs nothing for looped instruments.
+#define AUDIO_SAMPLE_READAHEAD
+
 // Uses a much better implementation of reverb over vanilla's fake echo reverb. Great for caves or eerie levels, as well as just a better audio experience in general.
 // Reverb parameters can be configured in audio/synthesis.c to meet desired aesthetic/performance needs. Currently US/JP only. Hurts emulator and console performance.
 // #define BETTER_REVERB
@@ -15,3 +15,43 @@
     #define ENABLE_VANILLA_LEVEL_SPECIFIC_CHECKS
     #define TEST_LEVEL LEVEL_CASTLE_GROUNDS
 #endif
+
+/**
+ * Log one line per decompressed segment through osSyncPrintf: codec,
+ * compressed and unpacked size, decompression time and throughput. Build
+ * the same ROM with each COMPRESS= option and diff the logs to pick codecs
+ * empirically; with COMPRESS=mixed the line also shows which codec each
+ * individual segment shipped with.
+*/
+// #define DECOMP_BENCHMARK
+
+/**
+ * Deterministic replay benchmark. Shortens the idle wait on the title screen
+ * and loops the recorded demo playback across its levels, while the profiler
+ * collects per-subsystem frame statistics for every completed demo and dumps
+ * a machine-readable report over USB (requires UNF=1).
+ * Build with `make BENCHMARK=1 UNF=1`, or uncomment this to bake it in.
+*/
+// #define ENABLE_BENCHMARK_REPLAY
+
+#ifdef ENABLE_BENCHMARK_REPLAY
+    #define USE_PROFILER
+#endif
+
+/**
+ * Demo fast-forward for replay validation. While a recorded demo is playing
+ * back, game logic frames run back to back: the vblank waits are skipped and
+ * only every DEMO_FAST_FORWARD_RENDER_INTERVAL-th frame's display list is
+ * submitted to the RSP/RDP. Game logic - including the camera, which updates
+ * during graph processing - still runs every frame, so playback stays
+ * deterministic and a multi-minute replay validates in seconds on emulator.
+ * Pairs with ENABLE_BENCHMARK_REPLAY for sweeps over a whole replay library.
+ * Intended for emulator use; on console the SI read rate still bounds the
+ * speedup.
+*/
+// #define DEMO_FAST_FORWARD
+
+#ifdef DEMO_FAST_FORWARD
+    // Present one frame out of this many while fast-forwarding.
+    #define DEMO_FAST_FORWARD_RENDER_INTERVAL 30
+#endif
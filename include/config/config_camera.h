@@ -33,6 +33,75 @@
 // Enables Puppy Camera 2, a rewritten camera that can be freely configured and modified.
 // #define PUPPYCAM
 
+// Makes Puppy Camera's terrain collision incremental. The colliding surface each of
+// the two camera rays hit last frame is kept, and while it still intersects the ray
+// the full spatial-partition cast is skipped; a full cast runs on any miss and is
+// forced every 4th frame so a nearer surface can't stay hidden behind a cached hit.
+// Only static surfaces are held across frames - dynamic surface pointers go stale
+// when object collision rebuilds. Also smooths the collision distance's outward
+// recovery (inward clamping still snaps, so the camera never clips), removing the
+// pop when a corner slides out of the ray. Only does anything with PUPPYCAM.
+#define PUPPYCAM_COLLISION_CACHE
+
+// Bakes the current area's camera triggers (sCameraTriggers) into a coarse XZ grid
+// when the area loads, so the per-frame trigger check in camera_course_processing
+// reads one cell's bitmask and only tests the triggers whose bounds can reach
+// Mario's cell, instead of walking the level's whole table. Also adds
+// camera_register_trigger, which lets custom level code add triggers to the loaded
+// area at runtime without growing the static tables; registrations are dropped on
+// area change. Areas with more than 32 positional triggers fall back to the
+// original linear scan.
+#define CAMERA_TRIGGER_GRID
+
+// Caches the polynomial coefficients of the cutscene spline segment being followed, so
+// move_point_along_spline evaluates the curve with three multiply-adds per axis (Horner's
+// method) instead of rebuilding the four B-spline basis weights and re-converting the four
+// s16 control points every frame. Two segments are cached since cutscenes typically follow
+// a position spline and a focus spline in the same frame. The cached coefficients are
+// validated against the control points themselves, so splines rebuilt in place (the credits
+// cutscene rewrites its spline arrays per scene) never evaluate stale data.
+#define SPLINE_COEFF_CACHE
+
+// Bakes cutscene camera tracks into keyframe streams. Shots that follow a position
+// spline and a focus spline in lockstep (the intro, the ending flythroughs, the
+// credits) evaluate both splines up front on their first frame and then play the
+// shot back as a plain keyframe lookup, so the per-frame cost drops to two vector
+// copies and the shot's timing is fixed the moment it starts - useful when
+// validating replays (see ENABLE_BENCHMARK_REPLAY). The baked frames are the exact
+// values live evaluation would produce; shots that outlive the keyframe buffer fall
+// back to live evaluation for their remaining frames.
+#define CUTSCENE_SPLINE_BAKE
+
+#ifdef CUTSCENE_SPLINE_BAKE
+// Frames baked per shot (one pos and one focus keyframe each, 24 bytes per frame).
+// At 30fps the default covers about 8.5 seconds, which fits every stock shot.
+#define CUTSCENE_SPLINE_BAKE_FRAMES 256
+#endif
+
+// Budgets and reuses the camera's wall-avoidance raycasts. The feeler scan in
+// rotate_camera_around_walls marches 8 steps from Mario to the camera with up to two
+// find_wall_collisions probes each, every frame, per call site. With this enabled the
+// scan's result is reused outright while the camera and Mario have both moved less
+// than CAMERA_PROBE_REUSE_DIST since it ran (a fresh scan is forced every
+// CAMERA_PROBE_REUSE_FRAMES frames regardless, so moving platforms still get
+// noticed), the scan runs every other step on alternating frames while the previous
+// scan found nothing, and CAMERA_PROBE_BUDGET caps the wall probes spent per frame
+// as a backstop. Any scan that finds a wall drops back to the full-rate path until
+// the camera is clear again, so avoidance latency is unchanged where it matters.
+#define CAMERA_PROBE_BUDGET       20
+#define CAMERA_PROBE_REUSE_DIST   4.f
+#define CAMERA_PROBE_REUSE_FRAMES 4
+
+// Runs the camera mode machine (the big mode switch in update_camera, including
+// its floor/ceiling probes) every other frame, holding the last computed goal
+// position/focus on the in-between frames so update_lakitu's asymptotic approach
+// interpolates toward them. Cutscenes, mode transitions, the init frame and the
+// directly input-driven modes (C-Up, behind-Mario, cannon) always run at full
+// rate. Intended for 60fps-logic builds, where half rate still means 30Hz mode
+// decisions; at 30fps logic the added goal latency is noticeable, so this ships
+// disabled.
+// #define CAMERA_HALF_RATE_MODE_LOGIC
+
 // Note: Reonucam is available, but because we had no time to test it properly, it's included as a patch rather than being in the code by default.
 // Run this command to apply the patch if you want to use it:
 // tools/apply_patch.sh enhancements/reonucam.patch
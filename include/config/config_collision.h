@@ -17,6 +17,99 @@
 // Number of walls that can push Mario at once. Vanilla is 4.
 #define MAX_REFERENCED_WALLS 4
 
+// Defers the float divide in the find_floor/find_ceil hot loops. The triangle
+// bounds tests are already pure integer math, but every triangle that passed them
+// paid a ~29-cycle FPU divide for its height before the result could be rejected.
+// With this set, the height comparisons run against the plane equation scaled by
+// normal.y (two multiplies), and the divide only happens when a triangle actually
+// becomes the new best candidate.
+#define COLLISION_FAST_HEIGHT_CHECK
+
+// Tracks the vertical span of each collision cell's wall lists as walls are bucketed, so
+// find_wall_collisions can skip a cell's entire static or dynamic wall list when the
+// query point is above or below every wall in it. Helps most in tall levels where many
+// stacked floors share XZ cells. With DYNAMIC_SURFACE_RETENTION the dynamic spans only
+// widen until the partition is fully cleared, which just means fewer skips, never misses.
+#define COLLISION_CELL_WALL_BOUNDS
+
+// Resolves Mario's paired wall probes (his lower and upper body circles share an XZ
+// position and only differ in height and radius) through a single walk of the cell's
+// wall lists instead of two, halving the list chasing and surface loads in the ground
+// and air quarter-steps - Mario alone issues 8 wall queries per frame. Results are
+// identical to two sequential queries: in the rare case the first probe actually gets
+// displaced by a wall, the second probe is rerun from the displaced position just like
+// the sequential code would.
+#define COLLISION_PAIRED_WALL_QUERIES
+
+// Bakes the environmental regions (water, gas, JRB fog boxes) into a per-cell bitmask
+// grid when an area's terrain loads, so find_water_level and find_poison_gas_level only
+// test the regions overlapping the queried cell instead of scanning every region.
+// Region heights stay runtime-writable (WDW, water pillars, etc.), since the grid only
+// stores which region indices touch each cell, not their heights.
+#define ENVIRONMENT_REGION_GRID
+
+// Lets levels place water current volumes (directional flows and vortices) with the
+// WATER_CURRENT_VOLUME level command. When an area's terrain loads, every volume is
+// baked into one coarse 3D vector grid covering their union, and swimming samples the
+// summed current with a single trilinear fetch - constant cost no matter how many
+// volumes an area places, so level-wide rivers are as cheap as a single one. The two
+// vanilla whirlpool slots still use their exact per-frame math and are unaffected.
+// Costs WATER_CURRENT_GRID_X * Y * Z * 3 bytes of BSS (6 KiB at the default sizes).
+#define WATER_CURRENT_FIELD
+
+#ifdef WATER_CURRENT_FIELD
+// Grid sample counts per axis. The grid stretches over the union of the area's
+// volumes, so more samples only buy fidelity, not range.
+#define WATER_CURRENT_GRID_X 16
+#define WATER_CURRENT_GRID_Y 8
+#define WATER_CURRENT_GRID_Z 16
+#endif
+
+// Replaces the O(n^2) object-vs-object hitbox pass in detect_object_collisions with a
+// uniform spatial hash rebuilt each frame from the display list pool, so each object only
+// tests others in nearby buckets. The narrowphase (detect_object_hitbox_overlap) and the
+// list pairings are unchanged; only the order collisions get recorded in can differ.
+// Falls back to the plain list walks if the frame pool is too full to hold the hash.
+#define COLLISION_OBJECT_BROADPHASE
+
+// Caches each object's last find_floor query in struct Object so cur_obj_update_floor
+// can revalidate the previous triangle in O(1) when the object has barely moved and no
+// dynamic surface touched its collision cell since the query. Dynamic floors are never
+// cached, since the dynamic pool is rebuilt every frame.
+#define COLLISION_OBJECT_FLOOR_CACHE
+
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+// How far (in units, per axis) an object may drift before its cached floor is requeried.
+#define FLOOR_CACHE_THRESHOLD 2.0f
+#endif
+
+// Keeps dynamic (object) collision across frames instead of clearing and rebuilding
+// every object's surfaces each frame. load_object_collision_model only re-transforms
+// and re-buckets an object's surfaces when the transform they were built from changed;
+// elevators sitting still, doors, and other idle platforms keep their surfaces and
+// cell links. Freed surfaces and nodes are recycled through free lists, so the pools
+// no longer reset to the static counts each frame (the allocation counters become
+// high-water marks). Costs a Mat4 snapshot per object.
+// #define DYNAMIC_SURFACE_RETENTION
+
+// Builds an AABB bounding-volume hierarchy over each collision cell's static surface
+// lists when an area's terrain is loaded, and walks it in find_floor, find_ceil and
+// find_wall_collisions instead of the flat per-cell lists.
+// Worth enabling on levels with dense custom collision (thousands of triangles
+// clustered in a few cells); vanilla-density levels see little benefit. A level can
+// opt out by clearing gStaticBvhEnabled before its terrain loads (e.g. in a level
+// script jump or area init), in which case the plain lists are kept.
+// #define COLLISION_STATIC_BVH
+
+#ifdef COLLISION_STATIC_BVH
+// The maximum amount of BVH nodes, allocated alongside the surface pools.
+// Worst case is just under (2 * static surfaces / SURFACE_BVH_LEAF_SIZE) per axis-dense cell;
+// cells that would overflow this simply keep larger leaves.
+#define SURFACE_BVH_POOL_SIZE 2048
+// Cell lists at or below this length are kept as a single leaf (plain list walk).
+#define SURFACE_BVH_LEAF_SIZE 8
+#endif
+
 // Collision data is the type that the collision system uses. All data by default is stored as an s16, but you may change it to s32.
 // Naturally, that would double the size of all collision data, but would allow you to use 32 bit values instead of 16.
 // Rooms are s8 in vanilla, but if you somehow have more than 255 rooms, you may raise this number.
@@ -14,6 +14,68 @@
 // If not using PUPPYPRINT_DEBUG, press L to toggle the profiler.
 // #define USE_PROFILER
 
+// Caches the display lists the fasttext renderer builds for recently drawn
+// strings, so debug text that is unchanged from the previous frame is replayed
+// with a single command instead of being re-emitted glyph by glyph.
+// Costs about 27KB of BSS.
+#define FASTTEXT_STRING_CACHE
+
+// Keeps a 600-frame history of per-subsystem frame timings alongside the
+// profiler's 64-frame averaging window, and adds a "History" page to the
+// Puppyprint profiler with a scrolling graph, pause-and-scrub controls and a
+// worst-frame breakdown, so one-frame hitches stay diagnosable after the
+// fact. Only active together with USE_PROFILER. Costs about 7KB of BSS.
+#define PROFILER_HISTORY
+
+// Flight recorder for hitches that only reproduce on console without USB
+// attached: when a frame's CPU time blows past PROFILER_SRAM_SPIKE_US (and is
+// worse than anything already stored), the last 120 frames of profiler
+// history are checkpointed to the far end of battery-backed SRAM, where they
+// survive a power cycle. The capture is read back at next boot and shown on a
+// "Hitches" Puppyprint page (dpad down clears it); new spikes only overwrite
+// a stored capture when they are worse, so the worst field-reported hitch
+// wins. Requires USE_PROFILER, PROFILER_HISTORY and the sram save type;
+// silently inactive otherwise.
+#define PROFILER_SRAM_CAPTURE
+// A frame counts as a spike above this many microseconds of CPU time.
+#define PROFILER_SRAM_SPIKE_US 40000
+
+// Samples the RDP pipe-busy counter at every profiler scope boundary, so the
+// profiler HUD can show how much RDP work overlapped each CPU scope and
+// whether a frame is CPU, RSP or RDP bound instead of leaving that to
+// guesswork. One extra register read per profiled scope.
+#define PROFILER_RDP_ATTRIBUTION
+
+// Keeps a small registry of always-on per-frame counters (collision queries,
+// surfaces tested, main pool bytes allocated, master display list size) that
+// hot paths bump through cheap macros. The published values show up on a
+// "Counters" Puppyprint page and can be streamed over USB as CSV on UNF
+// builds. Each counter is a single add on the paths it instruments.
+#define FRAME_STATS_COUNTERS
+
+// Streams one small binary packet of tagged telemetry records per frame over
+// USB (profiler times, main pool free space, object count, frame stats)
+// instead of formatted text, cheap enough to leave running at 60fps. Decode
+// captures on the host with tools/telemetryDecoder.py. Only active on UNF
+// builds (make UNF=1); uncomment to enable.
+// #define USB_TELEMETRY
+
+// Lets the UNFLoader "segswap <segment> <file>" command upload replacement
+// data for a segment (behavior scripts, macro object tables, actor data)
+// into a reserved 64KB pool and repoint the segment at the next frame
+// boundary, so tuning passes skip the ROM rebuild and reflash. Uploads are
+// lost when a level transition reloads the segment from ROM, so resend them
+// afterwards. Development only; requires UNF=1. Uncomment to enable.
+// #define USB_HOT_RELOAD
+
+// Registers remote perf-investigation commands on the UNFLoader USB channel:
+// "profile <start|stop|dump>" for the profiler history ring, "capture
+// <startTimer> <frames>" for gGlobalTimer based capture windows, "stats
+// <on|off>" for the frame stats CSV stream and "memdump" for the memory
+// accounting tables. Lets the host drive captures without the controller
+// navigated debug menus. Requires UNF=1. Uncomment to enable.
+// #define USB_DEBUG_COMMANDS
+
 // TEST LEVEL
 // Uncomment this define and set a test level in order to boot straight into said level.
 // This allows you to quickly test the level you're working on.
@@ -40,6 +102,24 @@
 // If puppyprint is enabled, then this can be cycled only while the screen is active.
 // #define VISUAL_DEBUG
 
+// Batches the VISUAL_DEBUG box/cylinder renderer. Vanilla allocates four
+// matrices and rebuilds the full RSP matrix stack per box, which at a hundred
+// visualized hitboxes costs more than the scene being measured; with this
+// enabled the template vertices are transformed on the CPU into one shared
+// world-space vertex arena and every shape is drawn under a single matrix
+// with shared render state, so each box costs 8 (24 for cylinders)
+// pre-transformed vertices and two commands. No effect without VISUAL_DEBUG.
+#define DEBUG_BOX_BATCHING
+
+// Speeds up the crash screen's code view. The MIPS disassembler resolves each
+// instruction through two 64-entry lookup tables (opcode and SPECIAL function,
+// built on first use) instead of scanning the template list per instruction —
+// which also stops I-type immediates from mismatching R-type templates — and
+// the view keeps the 19 printed lines cached, so scrolling one line only
+// disassembles the line that came into view. During a crash every cycle of
+// responsiveness on console counts.
+#define CRASH_SCREEN_DISASM_LUT
+
 // Opens all courses and doors. Used for debugging purposes to unlock all content.
 #define UNLOCK_ALL
 
@@ -11,12 +11,303 @@
 */
 // #define ENABLE_VANILLA_LEVEL_SPECIFIC_CHECKS
 
+// Replaces the main pool's two-sided bump allocator with a segregated-fit heap with
+// boundary coalescing, behind the same main_pool_alloc/main_pool_free API. With the
+// vanilla allocator, anything freed out of stack order leaks until the next
+// main_pool_pop_state; with this backend, main_pool_free releases exactly that block
+// and merges it with free neighbors, so long-lived mid-level allocations don't
+// fragment the pool over long sessions. main_pool_push_state/pop_state still work
+// (blocks are tagged with their push depth and swept on pop). Costs 16 bytes per
+// allocation like vanilla. Experimental: vanilla relies on main_pool_free also
+// releasing every newer block on the same side, which this backend does not do.
+// #define MAIN_POOL_COALESCING
+
+// Serves the listed segments straight from cartridge ROM instead of DMAing them into
+// the main pool. An eligible segment's base address is set to the uncached cartridge
+// mirror of its ROM location, so segmented_to_virtual pointers read the cart directly
+// and the segment costs zero RDRAM. Only works for segments that are uncompressed in
+// ROM and never written to. Caveats: reads go over the PI bus uncached (far slower
+// than RDRAM, so keep per-frame hot data out of the list), and the CPU must not read
+// these pointers while a PI DMA is in flight -- the audio thread DMAs samples at
+// unpredictable times, which is why this ships disabled. Mostly useful for
+// emulator-targeted hacks that are desperate for RAM.
+// #define ROM_RESIDENT_SEGMENTS { 0x0E }
+
+// Adds a handle-based allocation API (mem_pool_alloc_handle) on top of the memory
+// pools, where blocks can be relocated to defragment the pool. When a handle
+// allocation fails, the pool is compacted (sliding relocatable blocks down over the
+// holes, with a callback so owners can fix up their pointers) and the allocation is
+// retried, so long sessions can't wedge the effects pool into a state where particle
+// buffers no longer fit. mem_pool_compact can also be called explicitly on quiet
+// frames. Plain mem_pool_alloc blocks never move.
+#define MEM_POOL_COMPACTION
+
+// Tracks object pool slots with a free-slot bitmap and per-slot generation counters.
+// Spawns take the lowest free slot instead of the most recently freed one, keeping
+// active objects packed at the start of the pool, and "is the pool full" checks become
+// a counter read. The generation counter increments whenever a slot is freed, letting
+// code that holds an object pointer across frames detect that the object unloaded and
+// the slot was reused (this fixes the long-standing bug where Mario could receive
+// displacement from an unrelated object that took his platform's slot).
+#define OBJECT_POOL_BITMAP
+
+// Size of each object's behavior script stack, in slots. A CALL frame costs one
+// slot and a BEGIN_REPEAT costs two; the deepest script shipped with the game
+// (bhvSmallWaterWave, a CALL whose callee runs a repeat) needs 3. Vanilla
+// reserved 8 slots, so the default of 4 gives 16 bytes back in each of the 240
+// pooled objects. Raise this if custom behaviors nest CALLs and REPEATs deeper;
+// debug builds assert on overflow.
+#define BHV_STACK_SIZE 4
+
+// Mirrors each object list into a compact array of pool slot numbers, so the
+// per-frame update and unload walks read a dense u8 array instead of chasing
+// next pointers across the 2400-byte-stride object pool. The arrays keep the
+// lists' insertion order exactly (objects spawned mid-update still update the
+// same frame), and the linked lists stay fully maintained for everything else
+// that walks them. Costs NUM_OBJ_LISTS * OBJECT_POOL_CAPACITY bytes of BSS.
+#define OBJ_LIST_COMPACT_ARRAYS
+
+// Skips the behavior script interpreter for objects sitting in the common
+// BEGIN_LOOP / CALL_NATIVE / END_LOOP steady state, calling the native update
+// function directly instead of fetching and decoding three bytecode commands
+// per object per frame. Behaviors doing anything else in their loop body
+// (delays, repeats, script jumps) automatically fall back to the interpreter,
+// so behavior script semantics are unchanged.
+#define BHV_NATIVE_LOOP_FAST_PATH
+
+// Lets behaviors opt in to reduced update rates when far from Mario via
+// OBJ_FLAG_UPDATE_THROTTLED: the behavior script runs every 2nd frame beyond
+// OBJ_THROTTLE_HALF_RATE_DIST and every 4th beyond OBJ_THROTTLE_QUARTER_RATE_DIST,
+// staggered across the object pool. Flag-driven movement and graphics processing
+// still run every frame, so objects moved via OBJ_FLAG_MOVE_XZ_USING_FVEL stay
+// smooth; behaviors that move inside their update function advance slower while
+// throttled, so only use the flag for ambient crowd objects (goombas use it).
+// Held objects are never throttled.
+#define OBJ_UPDATE_THROTTLING
+#define OBJ_THROTTLE_HALF_RATE_DIST    2000.0f
+#define OBJ_THROTTLE_QUARTER_RATE_DIST 4000.0f
+
+// Updates dependent objects after the object they follow. When an object's
+// parentObj or platform hasn't been updated yet this frame, its own update is
+// deferred and run after the rest of the lists (chains resolve over a few
+// passes), so a child reads its parent's *current*-frame position instead of
+// trailing it by a frame. Removes the one-frame wobble on parent-child object
+// chains that behaviors otherwise smooth over by hand. Objects whose
+// dependency already updated — platform riders behind the surface list, held
+// objects behind the player list — keep their normal update slot. Inactive
+// during time stop, and the queue falls back to in-place updates when full.
+#define OBJ_DEPENDENCY_ORDERED_UPDATE
+// Deferred updates trackable per frame; overflow updates in place.
+#define OBJ_DEPENDENCY_QUEUE_SIZE 64
+
+// Gives behaviors formal distance-tiered update functions. A behavior
+// registered in gBehaviorLodTiers (behavior_actions.c) runs its normal script
+// near Mario, a cheap replacement update in the far band, and nothing at all
+// in the dormant band, so ambient life (fish schools, birds) costs almost
+// nothing at range and areas can place several times more of it. Flag-driven
+// movement and graphics processing still run every frame, and oTimer keeps
+// ticking so the script doesn't see frozen time when it resumes. Behaviors
+// not in the registry are untouched. Unlike OBJ_UPDATE_THROTTLING (which runs
+// the full script at a reduced rate), a far tier runs every frame but does
+// strictly less work, so motion stays smooth.
+#define BHV_LOD_TIERS
+
+// Lets behaviors opt in to approximate collision when far from Mario via
+// OBJ_FLAG_COLLISION_LOD (alongside OBJ_FLAG_COMPUTE_DIST_TO_MARIO, which
+// supplies the distance). Beyond OBJ_COLLISION_LOD_DIST the object skips wall
+// and steep-slope resolution entirely and re-walks the floor triangles only
+// every OBJ_COLLISION_LOD_REFRESH frames (staggered across the pool),
+// extrapolating the height from the cached triangle's plane in between.
+// Dynamic floors (platforms) are never extrapolated, since their surfaces are
+// rebuilt per frame. Complements OBJ_UPDATE_THROTTLING: that cuts script rate,
+// this cuts the per-step collision cost of the frames that do run.
+#define OBJ_COLLISION_LOD
+#define OBJ_COLLISION_LOD_DIST 3000.0f
+#define OBJ_COLLISION_LOD_REFRESH 8
+
+// Spawns burst coins (enemy loot, coin spurts) as 32-byte records in a
+// dedicated pool instead of full objects, so a killed enemy or blue coin
+// switch moment doesn't eat a 'struct Object' slot and a behavior script tick
+// per coin. Micro coins are batch-updated in one loop (simple bounce physics
+// against the floor height sampled at spawn, shared lifetime/blink timing) and
+// batch-rendered by appending the coin model's animation-frame display list
+// per instance, so the master list material sort draws them back to back.
+// Pickups go through micro_coin_interact, which mirrors interact_coin.
+// Placed coins (level/macro data, hidden blue coins) keep full objects for
+// their collection tracking; if the pool is full, spawns fall back to objects.
+#define MICRO_COIN_POOL
+#define MICRO_COIN_CAPACITY 48
+#define MICRO_COIN_LIFETIME 300
+#define MICRO_COIN_BLINK_TIME 40
+
+// Spreads macro object spawn bursts over multiple frames instead of doing the
+// whole area's worth (allocation, geo init, first behavior tick) in one frame.
+// Queued spawns drain at DEFERRED_SPAWN_BUDGET per frame during the level-entry
+// transition; deferred_spawn_enqueue also takes an immediate flag for spawns
+// that must not wait. Placed objects from spawn_objects_from_info (Mario,
+// platforms) always spawn immediately.
+#define DEFERRED_SPAWN_QUEUE
+#define DEFERRED_SPAWN_BUDGET 32
+
+// Unlinks SpawnInfo entries from an area's spawn list once they are marked
+// RESPAWN_INFO_DONT_RESPAWN (collected stars, opened caps, killed one-time
+// objects), so re-entering the area only walks entries that can still spawn.
+// Nothing in the game revives a dead entry short of reloading the level, which
+// rebuilds the list anyway; disable this if a hack pokes respawn bits back to
+// zero to resurrect placed objects.
+#define SPAWN_INFO_PRUNING
+
+// Streams distant macro objects out of the object pool. Macro-spawned objects
+// that are already hidden by drawing distance (ACTIVE_FLAG_FAR_AWAY) and beyond
+// OBJ_DORMANCY_SLEEP_DIST of Mario are unloaded, and their macro list entry is
+// marked dormant; the entry is respawned through the deferred spawn queue once
+// Mario comes within OBJ_DORMANCY_WAKE_DIST of it. The macro list entry is the
+// dormant record, so waking restores the same state an area re-entry would
+// (objects respawn at their placed position; killed/collected objects with
+// RESPAWN_INFO_DONT_RESPAWN set stay gone). This lets an area place far more
+// macro objects than the pool could hold resident at once. Objects with
+// collision data, a room assignment or OBJ_FLAG_ACTIVE_FROM_AFAR never get
+// ACTIVE_FLAG_FAR_AWAY and are unaffected. Requires DEFERRED_SPAWN_QUEUE.
+#define OBJECT_DORMANCY
+#define OBJ_DORMANCY_SLEEP_DIST 5000.0f
+#define OBJ_DORMANCY_WAKE_DIST  4500.0f
+
+// Resolves each area's packed macro object list into a spawn-ready placement
+// table when the area loads. Preset lookup, yaw conversion and param merging
+// happen once per entry instead of during the spawn loop, and every spawn
+// (including OBJECT_DORMANCY wake-ups, which otherwise re-unpack their entry
+// on each wake) becomes a direct read of one 24 byte record. The table lives
+// in the level pool and is freed with the area; if the allocation fails, the
+// packed list is decoded entry by entry as before. The record has room for
+// future per-object fields without touching the packed on-cart format.
+#define MACRO_PLACEMENT_TABLE
+
+// Memoizes each object's distance and facing angle to Mario per frame. The
+// first query an object makes computes the position deltas once and derives
+// the distance, squared distance and angle together; every further query that
+// frame (the behavior flag computation, helpers, dynamic surface checks) reads
+// the table instead of redoing sqrtf and atan2s from scratch. Costs
+// OBJECT_POOL_CAPACITY * 16 bytes of BSS.
+#define MARIO_PROXIMITY_CACHE
+
+// Tracks persistent Mario<->object contact pairs across frames with
+// enter/stay semantics. Interaction types that only matter on first contact
+// (coins, stars, doors, warps, text) skip their handler during sustained
+// overlap, as long as Mario's action is unchanged and no new button was
+// pressed - so action- and input-gated handlers still re-evaluate exactly
+// when their answer could change.
+#define INTERACTION_CONTACT_CACHE
+
+// Replaces the div.s + sqrt.s reciprocal square root in vec3f_normalize (and
+// friends) with the integer-estimate rsqrt trick plus two Newton-Raphson
+// iterations. The VR4300 FPU stalls ~29 cycles for each of div.s and sqrt.s,
+// while the approximation is a few pipelined multiplies, accurate to ~5e-6.
+// Comment out to fall back to the exact divide-and-sqrt versions when
+// debugging precision-sensitive math.
+#define FAST_INVSQRT
+
+// Replaces the 2 KiB arctangent table behind atan2s with a 132 byte table that
+// interpolates between entries. atan2s runs on every homing enemy and camera
+// yaw update, and the big table's scattered indexing evicts three cache lines
+// of game data per call on a 8 KiB data cache; the small table stays resident.
+// The interpolated result is also closer to true atan than the vanilla table's
+// nearest-entry rounding: worst case error is 1.7 angle units (0.009 degrees)
+// versus 5.6 for vanilla. Frees the 2 KiB table from RAM entirely.
+#define ATAN2_SMALL_TABLE
+
+// Keeps the generic object movement path (cur_obj_move_standard, object_step)
+// entirely in single precision. The vanilla code carries several double
+// literals (0.0001L drag scale, / 100.0L underwater drag) that promote the
+// whole expression to double - a mul.d plus conversions per axis per walker -
+// and computes absf(velY) as sqrtf(velY * velY). Those become f32 multiplies,
+// and the per-frame forward speed sqrtf goes through fast_sqrtf. Physics
+// results differ from vanilla only in the last float bit or ~5e-6 relative
+// error. Requires FAST_INVSQRT.
+#define OBJ_FAST_PHYSICS
+
 // Disables lives and hides the lives counter.
 #define DISABLE_LIVES
 
 // Saves the number of lives to the save file (Does nothing if DISABLE_LIVES is enabled).
 #define SAVE_NUM_LIVES
 
+// Snapshots the level's respawn data (macro object lists and placed object
+// spawn args) right after the level script closes its pool, and restores it
+// when Mario dies inside the level. The death warp then rebuilds the area
+// from the restored data, so collected coins and killed enemies come back
+// and the coin counter resets - a fresh retry in a single area reload, with
+// no level script re-run and no cartridge traffic. Costs one copy of the
+// level's macro object lists in the level's main pool frame.
+#define LEVEL_SNAPSHOT_RESTART
+
+// Spreads save writes out over multiple frames instead of writing the whole
+// save structure to EEPROM/SRAM synchronously. Saving marks the changed 8 byte
+// blocks of the save buffer dirty, and a small budget of blocks is written out
+// each frame, removing the visible stall when saving after a star. Blocks are
+// flushed in ascending order, so a file's primary slot (ending in its
+// checksum) always completes before its backup slot is touched, and an
+// interrupted write is recovered from the other slot on the next boot just
+// like an interrupted synchronous save.
+#define DEFERRED_SAVE_WRITES
+
+// Trims the serialized work between power-on and the first rendered frame. At
+// boot only the main menu data (sound mode, camera options) is read from
+// EEPROM/SRAM before the game loop starts; the four save files trickle in one
+// per frame during the logo/intro, and any save access that arrives before its
+// file has loaded completes the remaining reads synchronously, so behavior is
+// identical in the worst case. Audio bank setup already runs concurrently on
+// the audio thread and the goddard pool is only allocated by the level script
+// when the Mario head screen loads, so the save reads are the boot path's
+// remaining serialized device traffic.
+#define FAST_BOOT
+
+/**
+ * Poll the controllers on a dedicated thread at INPUT_POLL_RATE_HZ instead of
+ * once per game frame. The game loop consumes the freshest sample each frame,
+ * so at 30fps a button press waits at most ~4ms (not up to 33ms) before the
+ * SI reads it. The newest samples are kept in a timestamped ring
+ * (gInputSamples), which input display and TAS tooling can read for sub-frame
+ * press timings. EEPROM saves and rumble commands share the SI through the
+ * same token scheme as before, so there is no bus contention.
+ */
+#define INPUT_POLLING_THREAD
+
+#ifdef INPUT_POLLING_THREAD
+    // Controller samples per second on the poll thread.
+    #define INPUT_POLL_RATE_HZ 240
+    // Timestamped samples retained for tooling; must be a power of two.
+    #define INPUT_POLL_LOG_SIZE 32
+
+// Lets objects spawn before their model is resident. A spawn whose model slot
+// in gLoadedGraphNodes is still empty proceeds immediately as an invisible
+// placeholder; async_model_load_request stages the actor's ROM range on the
+// background segment loader thread, and once the transfer lands the geo layout
+// is processed and every waiting object picks the model up, no gameplay hitch.
+// The ROM range must be uncompressed actor data (list it with no codec when
+// using COMPRESS=mixed); see async_model_load_request in src/engine/level_script.c.
+#define ASYNC_MODEL_LOADING
+
+#ifdef ASYNC_MODEL_LOADING
+// Transfers that can be in flight at once.
+#define ASYNC_MODEL_MAX_REQUESTS 4
+// Graph node pool carved per completed load (shrunk to actual use afterwards).
+#define ASYNC_MODEL_POOL_SIZE 0x4000
+#endif
+#endif
+
+// Stores save files on EEPROM/SRAM in a versioned, bit-packed format driven by
+// a per-field schema (sSaveFileSchema in save_file.c) instead of dumping
+// struct SaveFile raw. Each packed slot carries a format version and its own
+// checksum, and every field costs only its declared bit width, which frees
+// spare bits inside the same device footprint for hack-specific flags, timers
+// and collectibles: add a schema entry and bump SAVE_CODEC_VERSION to extend
+// the format. Old raw-format saves fail their packed checksum and are wiped on
+// first boot, so this is off by default. Note: without SAVE_NUM_LIVES the cap
+// position costs 48 bits and a packed slot grows to 64 bytes, which no longer
+// fits 4 kbit EEPROM - build with SAVETYPE=eep16k or SAVETYPE=sram (a
+// STATIC_ASSERT catches the unsupported combination).
+// #define SAVE_CODEC
+
 // This is the number of lives Mario starts with after a game over or starting the game for the first time (must be lower than 127).
 #define DEFAULT_NUM_LIVES 4
 
@@ -12,3 +12,10 @@
 
 // Disables the demo that plays when idle on the start screen (has no effect if KEEP_MARIO_HEAD is disabled).
 #define DISABLE_DEMO
+
+// Reuses the Mario head's display lists from previous frames once the scene has
+// fully settled (no controller activity, and the face springs, animations and
+// particles have come to rest), instead of rebuilding the whole dynamic display
+// list every frame. Rebuilding resumes on the first input or face movement.
+// (Has no effect if KEEP_MARIO_HEAD is disabled.)
+#define GODDARD_DL_CACHING
@@ -7,6 +7,63 @@
 // The size of the master display list (gDisplayListHead). 6400 is vanilla.
 #define GFX_POOL_SIZE 10000
 
+// Bytes kept free in the display list pool. Once a frame's headroom drops below this,
+// geo_append_display_list stops accepting transparent layer entries, shedding the least
+// important geometry instead of exhausting the pool and corrupting the frame (which
+// shows up as vanishing geometry). Set to 0 to disable the reserve.
+// With PUPPYPRINT_DEBUG, alloc_display_list usage is also tracked per subsystem and
+// shown on the Puppyprint standard page.
+#define GFX_POOL_RESERVE 0x800
+
+// Present at 60Hz while game logic keeps running at 30Hz. Each logic frame, the scene
+// is rendered a second time with object and camera transforms interpolated halfway
+// between the previous and current frame, and both images are shown on consecutive
+// vblanks. The 2D overlay (HUD, text, menus) is replayed verbatim from the main frame,
+// so menus and dialogs are not double-stepped; animation poses, FOV and the skybox
+// still update at logic rate. Objects that moved further than FRAME_INTERP_TELEPORT_DIST
+// in one frame (teleports, respawns) snap instead of sweeping across the screen.
+// Costs a third gfx pool (GFX_POOL_SIZE * 8 bytes), the CPU time of a second graph
+// traversal, and one vblank of added display latency. Incompatible with UNLOCK_FPS.
+#define FRAME_INTERPOLATION
+
+#ifdef FRAME_INTERPOLATION
+    // Per-axis object movement beyond this distance in a single logic frame is
+    // treated as a teleport and is not interpolated.
+    #define FRAME_INTERP_TELEPORT_DIST 300.0f
+#endif
+
+#ifdef UNLOCK_FPS
+    #undef FRAME_INTERPOLATION
+#endif
+
+// While the pause menu is up, the 3D scene is captured once and re-submitted
+// verbatim every frame instead of re-traversing the whole graph, dropping
+// paused-frame CPU time to the HUD and menu overlay alone. The captured frame's
+// gfx pool is parked untouched for the duration of the pause while the overlay
+// frames rotate through the remaining pools. Render-side animation that vanilla
+// keeps running while paused (falling snow, cycling textures) freezes with the
+// scene. Dialog time stop is not frozen: the camera zoom and Mario's head still
+// animate there, so those frames genuinely differ. Costs a third gfx pool
+// (GFX_POOL_SIZE * 8 bytes) unless FRAME_INTERPOLATION already pays for one.
+#define PAUSE_SCENE_FREEZE
+
+// Adaptive resolution scaling. Tracks RDP pipe-busy time through the DPC
+// counters and, when the RDP stays overloaded for a few frames in a row, steps
+// the vertical rendering resolution down 10% at a time (the VI stretches the
+// image back to full height, so the picture keeps its size and aspect). Once
+// headroom returns for long enough, resolution steps back up. Fillrate-bound
+// scenes trade a bit of vertical sharpness for never dropping frames.
+#define ADAPTIVE_RESOLUTION
+
+#ifdef ADAPTIVE_RESOLUTION
+    // Maximum number of 10% steps below full resolution (3 = down to 70%).
+    #define ADAPTIVE_RES_MAX_STEPS 3
+    // Consecutive overloaded frames before stepping down.
+    #define ADAPTIVE_RES_OVERLOAD_FRAMES 5
+    // Consecutive frames with headroom before stepping back up.
+    #define ADAPTIVE_RES_RECOVER_FRAMES 45
+#endif
+
 // Show a watermark on the title screen that reads "Made with HackerSM64", instead of the copyright message.
 #define INTRO_CREDIT
 
@@ -26,6 +83,28 @@
 // Regardless of whether this setting is enabled or not, you can use gIsConsole to wrap your own code in a console check.
 #define AUTO_LOD
 
+// Distance band (in world units) applied as hysteresis to level of detail nodes.
+// The LOD band an object drew last frame keeps rendering until the camera distance
+// moves this far past its boundary, so objects hovering right at a LOD (or draw
+// distance) threshold don't flicker between meshes every frame. Comment out to
+// select LODs by raw distance like vanilla.
+#define LOD_HYSTERESIS 50
+
+// Distance-selected display list variants, aimed at texture TMEM bandwidth:
+// gfx_register_lod_variant(fullDl, farDl, distance) maps a display list to a
+// variant authored with half resolution textures (n64graphics -d emits them
+// from the same PNGs), and any geo display list node drawing the full version
+// beyond that camera distance draws the variant instead. Selection happens per
+// draw, so a display list shared by many objects picks per instance and
+// nothing is patched in place; unregistered display lists cost one table scan
+// of a handful of entries. Follows AUTO_LOD's console check like LOD nodes do.
+#define GFX_LOD_VARIANTS
+
+#ifdef GFX_LOD_VARIANTS
+// Maximum number of registered variant pairs.
+#define GFX_LOD_VARIANT_MAX 16
+#endif
+
 // Enables Puppyprint, a display library for text and large images.
 // Automatically enabled when PUPPYPRINT_DEBUG is enabled.
 // #define PUPPYPRINT
@@ -33,6 +112,244 @@
 // Disables AA (Improves console performance but causes visible seams between unconnected geometry).
 // #define DISABLE_AA
 
+// Bounds full-screen effects to the region they actually change. Textured warp
+// transitions scissor their blended passes to the wipe's bounding box and cover
+// the solid-color remainder with fill-mode rectangles (4 pixels/cycle, no
+// blender read), and color fades skip their quad at alpha 0 and switch to a
+// fill rectangle at alpha 255. The screen_effect_fill_* helpers in
+// screen_transition.c are exposed for custom overlays (letterboxes, vignettes)
+// so they can draw their solid regions the same cheap way.
+#define SCREEN_EFFECT_REGIONS
+
+// Central registry for frame-cycled textures in retained display lists. A level
+// registers a material's display list together with its frame table once (e.g.
+// from a GEO_ASM hook at area load); the registry records where the G_SETTIMG
+// words live and texture_cycle_update then patches the image pointers in place
+// once per frame per material, instead of the geo tree swapping whole display
+// lists per animation state. Cost is constant in the number of surfaces sharing
+// the material. See texture_cycle_register in src/game/moving_texture.c.
+#define TEXTURE_CYCLE_REGISTRY
+
+#ifdef TEXTURE_CYCLE_REGISTRY
+// How many animated materials can be registered per area.
+#define TEXTURE_CYCLE_MAX_MATERIALS 8
+// How many G_SETTIMG commands one material's display list may contain.
+#define TEXTURE_CYCLE_MAX_IMAGES 16
+
+// Caches mirror Mario's rendered sub-scene. His graph subtree (switch nodes,
+// bone matrices, generated display lists) normally gets a second full
+// traversal per frame; with this, the appended entries (display list, layer,
+// fixed point matrix) are captured once and replayed as long as Mario's pose
+// key stays within the thresholds below, re-capturing at most every
+// MIRROR_RENDER_CACHE_MAX_AGE frames otherwise. Generated display lists that
+// live in the frame's gfx pool are copied into the cache so replays never
+// point at recycled pool memory. The reflection can lag the player by up to
+// the age cap (2 frames) while idling; movement past the position or angle
+// threshold re-captures immediately.
+#define MIRROR_RENDER_CACHE
+#define MIRROR_RENDER_CACHE_ENTRIES 48
+#define MIRROR_RENDER_CACHE_MAX_AGE 2
+#define MIRROR_RENDER_CACHE_POS_EPS 4.0f
+#define MIRROR_RENDER_CACHE_ANGLE_EPS 0x200
+#endif
+
+// Makes the room switch (geo_switch_area) render the current room plus the rooms its
+// doors connect to, using the adjacency table the door objects already register in
+// gDoorAdjacentRooms, instead of only the selected case. Combined with
+// cur_obj_enable_rendering_if_mario_in_room for objects, walls genuinely occlude the
+// rest of the level. Only enable this if each room case contains just its own room's
+// geometry: vanilla-style rooms bake neighboring geometry into every case and would be
+// drawn twice (wasting RDP time and z-fighting with themselves).
+// #define ROOM_NEIGHBOR_RENDERING
+
+// Draws static opaque level geometry without reading the z buffer while Mario is
+// inside a room, relying on the room system for ordering: room cases only contain
+// geometry that can never interpenetrate on screen, so the per-pixel z compare is
+// pure bandwidth waste in fillrate-bound interiors. The z write is kept, and the
+// geometry is emitted ahead of everything else on its layer, so objects and decals
+// still depth-test against walls normally. Only enable this on hacks whose room
+// cases are authored that way (the same constraint as ROOM_NEIGHBOR_RENDERING);
+// overlapping room geometry will show draw-order artifacts instead of z-fighting.
+// #define STATIC_GEO_NO_ZREAD
+
+// Caches computed bone matrices per object, keyed on the animation, animation frame and
+// the object's full model-view matrix. When nothing changed (idle NPC, static camera),
+// geo_process_animated_part/geo_process_bone reuse the previous fixed-point matrices
+// instead of allocating new ones from the display list pool and re-converting them.
+// The cache lives in its own double-buffered storage (the display list pools are reused
+// by the RCP a frame behind, so their allocations can't be kept across frames), which
+// costs about ANIM_MATRIX_CACHE_SLOTS * ANIM_MATRIX_CACHE_BONES * 128 bytes of BSS.
+// Off by default: objects whose geo switches on global timers (not on the animation or
+// transform) can show one stale frame when the switch flips, before the cache notices.
+// #define ANIM_MATRIX_CACHE
+
+#ifdef ANIM_MATRIX_CACHE
+// How many objects can hold a bone matrix cache at once (assigned on first render, freed on unload).
+#define ANIM_MATRIX_CACHE_SLOTS 16
+// Bones cached per object; parts beyond this fall back to the display list pool.
+#define ANIM_MATRIX_CACHE_BONES 24
+#endif
+
+// Cross-fades animation poses when an object switches animation, removing the
+// one-frame pop between animations. The renderer remembers each object's last
+// rendered bone rotations; after a switch, the new animation's rotations are
+// interpolated from that pose over ANIM_BLENDING_FRAMES frames. Each s16 angle
+// axis lerps along the shortest arc, which for skeletal bone rotations is the
+// practical equivalent of a per-bone quaternion nlerp at a fraction of the cost
+// (the animation channels stay in their ROM s16 tables; nothing is re-decoded).
+// Translation channels aren't blended, since fading root offsets makes feet
+// slide. Costs ANIM_BLENDING_SLOTS * ANIM_BLENDING_BONES * 12 bytes of BSS.
+#define ANIM_BLENDING
+
+#ifdef ANIM_BLENDING
+// How many frames a cross fade between two animations lasts.
+#define ANIM_BLENDING_FRAMES 4
+// How many objects can cross-fade at once (assigned on first render, freed on unload).
+#define ANIM_BLENDING_SLOTS 16
+// Bones blended per object; parts beyond this switch without fading.
+#define ANIM_BLENDING_BONES 24
+#endif
+
+// Stores Mario's animation data delta+RLE compressed in ROM and decodes it
+// during the animation DMA. Joint channels are smooth s16 curves, so most
+// deltas fit a byte and holds collapse to run markers; the encoder lives in
+// tools/mario_anims_converter.py (which reads this flag, so data and decoder
+// always agree) and stores any entry that doesn't compress raw. Cuts the
+// animation segment's ROM footprint by over half and shrinks each first-time
+// animation DMA by the same ratio, at the price of a short decode pass and a
+// second MARIO_ANIMS_POOL_SIZE staging buffer from the main pool.
+#define ANIM_COMPRESSION
+
+// Fast path for billboard matrix conversion. Every billboard's model-view matrix is a
+// pure scale (plus camera roll) in the rotation block, so all billboards with the same
+// scale share their entire fixed point matrix except the translation column. The
+// converted matrix is cached once and each further billboard (coins, sparkles, trees...)
+// only copies it and patches the three translation entries, instead of converting all
+// 16 floats. The per-instance RSP matrix load itself can't be shared, since each
+// instance sits at a different position. Pairs well with MASTER_LIST_MATERIAL_SORT,
+// which already draws same-model billboards back to back.
+#define BILLBOARD_MTX_CACHE
+
+// Converts matrices from the float stack to the RSP's fixed point format lazily.
+// Transform node pushes normally allocate and convert a fixed point matrix up front,
+// even when the subtree below them emits no display list (empty transform groups,
+// switch cases that draw nothing, pure animation joints). With this enabled, a push
+// only marks its stack level pending and the display list pool alloc plus the
+// conversion run on the first display list actually emitted at that level, so the
+// others cost nothing. Repeat emissions at the same level still share one matrix.
+#define LAZY_MTX_CONVERSION
+
+// Flattens pure grouping nodes out of geo node trees after process_geo_layout builds
+// them. GEO_BRANCH and sub-layout boilerplate leave start nodes that carry no
+// transform or render state - traversal just recurses into their children - yet each
+// one costs a type dispatch and a function call per tree walk, every frame, for every
+// object instance sharing the model. Their children are hoisted into the parent in
+// place (order preserved), so the per-frame scene graph walk touches only nodes that
+// do something. Switch cases, flag-toggled groups, view nodes and empty groups are
+// left intact, so selection and visibility semantics are unchanged.
+#define GEO_FLATTEN_START_NODES
+
+// Resolves Mario's switch-case part states (stand/run LOD, eye blink, hand pose,
+// cap effect and cap on/off) once per frame and lets repeat graph traversals read
+// the cached result. Mirror rooms and other setups that draw Mario twice re-ran the
+// full derivation per traversal; with this the second pass is a table read, and the
+// cap node's wing visibility flag walk also runs only once per frame.
+#define MARIO_PART_CACHE
+
+// Fast path for instances of shared static geometry. When an object's shared geo
+// subtree is just a culling radius (or start) node over plain display list nodes -
+// trees, posts, most repeated level props - each instance skips the recursive node
+// walk and submits the shared display lists directly under its own transform. Forty
+// trees then cost one subtree definition plus forty matrices and master list
+// entries, instead of forty traversals. Pairs with MASTER_LIST_MATERIAL_SORT, which
+// already draws the instances back to back with their materials loaded once.
+#define STATIC_PROP_INSTANCING
+
+// Retains the vertex buffers of moving texture (movtex) meshes across frames instead
+// of rebuilding them. Scrolling only ever changes texture coordinates - positions and
+// colors are static - yet movtex_gen_list re-runs make_vertex for every vertex of
+// every visible mesh, every frame, into the frame display list pool. With this
+// enabled each mesh builds two retained copies once per level (double buffered, since
+// the RCP may still be reading last frame's copy) and per frame only the two texcoord
+// shorts per vertex are patched in. Also enables movtex_register for adding custom
+// scrolling meshes (waterfalls, shifting sand) without editing the built-in tables.
+#define MOVTEX_RETAINED_VTX
+
+// Stores envfx particle state (snow, flowers, lava and water bubbles) as
+// struct-of-arrays instead of an array of 56 byte structs. The update loops only
+// touch positions and liveness, so packing each attribute contiguously cuts the
+// cache traffic per particle to a fraction, and particle vertices are written into
+// a single display list pool allocation per frame instead of one per group of five.
+// The savings fund a doubled snowflake budget (280 flakes in snow levels and
+// blizzards) at roughly the old CPU cost; note the bigger vertex batch also takes
+// more room in the frame display list pool while snow is falling.
+#define ENVFX_SOA_PARTICLES
+
+// Retains the snow particle vertex buffers and triangle command stream across
+// frames. The RSP transforms every snowflake vertex anyway, so the only CPU
+// work a frame genuinely needs is writing each flake's three positions; the
+// constant vertex attributes (texcoords, color) are filled in once and the
+// gSPVertex/gSP1Triangle stream is rebuilt only when the particle count
+// changes, instead of re-emitting ~340 commands and copying whole Vtx structs
+// into the frame pool every frame. Double buffered by frame parity since the
+// RCP may still be reading last frame's copy. Costs about 32 KiB of BSS for
+// the two 280-flake buffers and streams, and frees the per-frame display list
+// pool of the vertex batch ENVFX_SOA_PARTICLES noted.
+#define ENVFX_RETAINED_PARTICLE_DL
+
+// Retains the skybox's 3x3 tile grid display list instead of rebuilding it every
+// frame. The grid's vertices and texture loads depend only on which tile the camera
+// faces (45 degree steps of yaw plus the pitch band), the skybox image and the color
+// mask; sub-tile scrolling is carried entirely by the ortho matrix. The grid is
+// rebuilt into a static buffer only when one of those changes - a few times a second
+// while panning - and the per-frame display list shrinks from ~68 commands plus 36
+// vertices of pool pressure to 6 commands and the matrix.
+#define SKYBOX_RETAINED_GRID
+
+// Retains HUD display lists across frames instead of rebuilding them. The colorful
+// text labels (HUD counters, "PRESS START", ...) and the camera status element are
+// identical between most frames, yet their per-glyph texture loads and rectangles
+// are re-emitted every frame. With this enabled each is rebuilt into a static double
+// buffer only when its content actually changes (a counter ticking, the camera mode
+// switching) and replayed with a single command otherwise. Call
+// print_text_invalidate() if you modify the glyph textures in place, so the text
+// cache rebuilds. The power meter already renders from prebuilt display lists.
+#define HUD_RETAINED_DL
+
+// Retains dialog pages and the pause menu's course/act name strings as prebuilt
+// display lists. The dialog renderer re-parses the text and rebuilds a translation
+// matrix per character every frame; with this enabled the page is laid out once
+// when it is shown, its matrices are deduplicated (character advances repeat) and
+// copied into static storage, and further frames replay the page with one command
+// until the text, page or star count variable changes. The page scroll animation
+// still renders directly. Costs about 54KB of BSS. Has no effect on multilanguage
+// builds, which re-unpack glyph textures into the frame pool every character.
+#define MENU_RETAINED_TEXT
+
+// Resolves text glyphs through direct-index lookup tables instead of branch
+// chains. Puppyprint classifies every character through a cascade of range
+// checks and a punctuation switch — and runs it twice per character when a
+// string is centre or right aligned — and the credits renderer remaps its
+// ASCII strings through a similar if chain each frame. With this enabled both
+// resolve through 128-entry tables built on first use, so per-character cost
+// is one load regardless of which glyph it is. Dialog strings need nothing:
+// they are converted to charmap codes at build time (textconv already hashes)
+// and index the font table directly.
+#define TEXT_GLYPH_LUT
+
+// Groups each opaque master list layer by display list before emission, so objects that
+// share a model (coins, trees, enemies...) are drawn back to back instead of interleaved
+// with other models, cutting redundant RDP texture loads and pipe syncs. The shared
+// display list pointer is the material key, and the z buffer makes reordering opaque
+// geometry safe. Alpha and transparent layers keep their submission order.
+#define MASTER_LIST_MATERIAL_SORT
+
+// Completes the object view culling in obj_is_in_view with the missing top/bottom frustum
+// planes, so objects far above or below the screen stop being sent to the RSP. Uses the
+// same culling radius and the vertical fov from the camera's perspective node. The number
+// of objects culled per frame is counted for the Puppyprint object display.
+#define OBJECTS_CULL_VERTICALLY
+
 // Makes the coins ia8 64x64 instead of ia16 32x32. Uses new ia8 textures so that vanilla coins look better.
 #define IA8_COINS
 
@@ -44,6 +361,35 @@
 // using 64 vertex sizes, offered by Fast64 in the microcode menu.
 // #define OBJECTS_REJ
 
+/**
+ * With OBJECTS_REJ, skip the microcode reloads the render phases don't need:
+ * a .rej phase whose layers hold no objects is dropped outright, and a phase
+ * using the already-loaded microcode no longer reloads it. Every switch_ucode
+ * costs two RSP DMAs plus an init_rsp replay, so frames with few or no .rej
+ * objects get that RSP time back. The "UCODE LOADS" frame stats counter
+ * (FRAME_STATS_COUNTERS) shows the reloads left, and the ZEX/REJ DL NODES
+ * counters show how the master list splits across the microcodes, for tuning
+ * which layers are worth routing to .rej. No effect without OBJECTS_REJ.
+ */
+#define UCODE_SWITCH_PRUNING
+
+/**
+ * Collect decal shadows into one batch drawn contiguously at the start of the
+ * transparent decal layer. Every vanilla shadow pays the full pipeline setup
+ * and teardown (sync, combiner, texture load, geometry mode) around a single
+ * quad; the batch pays it once per shadow texture per frame and shares the
+ * layer's render mode, which adds up quickly on enemy-dense frames. Also
+ * enforces SHADOW_BATCH_QUOTA: past the quota, the shadow farthest from the
+ * camera is dropped. Shadows on water, ice and other transparent surfaces
+ * still draw individually, since they need the non-decal render mode.
+ */
+#define SHADOW_BATCHING
+
+/**
+ * Most shadows drawn on one frame; the farthest get dropped past this.
+ */
+#define SHADOW_BATCH_QUOTA 16
+
 /**
  * Mario's silhouette when behind solid objects/surfaces.
  * Also enables new render layers, such as LAYER_ALPHA_DECAL.
@@ -74,6 +420,20 @@
 // NOTE: Still breaks occasionally, and PUPPYLIGHT_NODE might not work in areas that aren't area 1.
 // #define PUPPYLIGHTS
 
+// Culls Puppylights spatially. Lights are slotted into a coarse XZ grid (in the same
+// fashion as collision cells), so each lit object only tests the lights whose volume
+// can reach its cell instead of every light in the area, and a light pass is skipped
+// outright when neither the object nor anything that can reach it has changed since
+// the previous frame. Only does something if PUPPYLIGHTS is enabled.
+#define PUPPYLIGHTS_GRID
+
+// Caches the blended result of the static (level script) lights per object, so a
+// frame where the object hasn't moved and no static light changed only evaluates
+// the dynamic lights on top of the cached base. Directional lights depend on the
+// camera and always force a full pass. Only does something if PUPPYLIGHTS_GRID is
+// enabled.
+#define PUPPYLIGHTS_STATIC_BAKE
+
 // Uses the correct "up" vector for the guLookAtReflect call in geo_process_master_list_sub.
 // It is sideways in vanilla, and since vanilla's environment map textures are sideways too, those will appear as sideways in-game if this is enabled.
 // Make sure your custom environment map textures are the correct orientation.
@@ -17,3 +17,19 @@
 #define EXIT_COURSE_LEVEL LEVEL_CASTLE
 #define EXIT_COURSE_AREA 0x01
 #define EXIT_COURSE_NODE 0x1F
+
+// -- MENU LOAD TIME SETTINGS --
+
+// Keeps the menu screens' segment data (compressed seg7, behavior data) in a
+// small resident cache after the first visit, so re-entering the file select
+// or act selector skips the cartridge DMA entirely and goes straight to
+// decompression -- the death-retry flow hits the act selector constantly.
+// Ranges are registered once at boot with segment_cache_retain; a range that
+// doesn't fit simply stays uncached and loads normally. The menu scripts also
+// PREFETCH their segments up front so the first visit overlaps each
+// segment's DMA with the previous one's copy/decompress. Costs
+// MENU_SEGMENT_CACHE_SIZE bytes of main pool for the lifetime of the game.
+#define MENU_SEGMENT_CACHE
+#define MENU_SEGMENT_CACHE_SIZE 0x30000
+// Maximum number of distinct retained ROM ranges.
+#define MENU_SEGMENT_CACHE_SLOTS 4
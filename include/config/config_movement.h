@@ -50,6 +50,15 @@
 // Enables Platform Displacement 2, also known as momentum patch. Makes Mario keep the momemtum from moving platforms.
 #define PLATFORM_DISPLACEMENT_2
 
+// Caches platform contact state instead of recomputing it every frame:
+// update_mario_platform reuses the floor Mario's movement code already found
+// this frame (skipping its own find_floor call), and a shared rider cache lets
+// any object behavior ride moving platforms via
+// apply_object_platform_displacement without declaring its own static
+// PlatformDisplacementInfo (objects reuse the floor from their own movement
+// code, so no extra find_floor per rider). Requires PLATFORM_DISPLACEMENT_2.
+#define PLATFORM_RIDER_CACHE
+
 // Uses Shindou's pole behavior.
 // #define SHINDOU_POLES
 
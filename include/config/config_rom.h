@@ -12,6 +12,16 @@
 // Currently not recommended, as it may cause random crashes.
 // #define ENABLE_RUMBLE (1 || VERSION_SH)
 
+/**
+ * Only send a rumble pak command over the SI when it changes the motor state.
+ * The rumble thread requests a motor state every VI, and vanilla issued the
+ * osMotorStart/osMotorStop transaction every time - including a stop per frame
+ * while idle - which could land in front of a controller poll and stall it.
+ * With this, repeats cost nothing and the SI only sees actual transitions.
+ * No effect without ENABLE_RUMBLE.
+ */
+#define RUMBLE_MOTOR_STATE_TRACKING
+
 // Screen Size Defines.
 #define SCREEN_WIDTH  320
 #define SCREEN_HEIGHT 240
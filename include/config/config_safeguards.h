@@ -28,6 +28,14 @@
     #define F3DLX2_REJ_GBI
 #endif // OBJECTS_REJ
 
+#ifndef PUPPYLIGHTS
+    #undef PUPPYLIGHTS_GRID
+#endif // !PUPPYLIGHTS
+
+#ifndef PUPPYLIGHTS_GRID
+    #undef PUPPYLIGHTS_STATIC_BAKE // The static base cache rides on the grid's change stamps.
+#endif // !PUPPYLIGHTS_GRID
+
 
 /*****************
  * config_debug.h
@@ -115,11 +123,42 @@
     #undef SAVE_NUM_LIVES
 #endif // DISABLE_LIVES
 
+#ifndef DEFERRED_SPAWN_QUEUE
+    #undef OBJECT_DORMANCY // Dormant entries wake through the deferred spawn queue.
+#endif // !DEFERRED_SPAWN_QUEUE
+
+#ifndef FAST_INVSQRT
+    #undef OBJ_FAST_PHYSICS // The fast physics path computes speeds via fast_sqrtf.
+#endif // !FAST_INVSQRT
+
 #ifndef START_LEVEL
     #define START_LEVEL LEVEL_CASTLE_GROUNDS
 #endif // !START_LEVEL
 
 
+/*****************
+ * config_movement.h
+ */
+
+#ifndef PLATFORM_DISPLACEMENT_2
+    #undef PLATFORM_RIDER_CACHE // The rider cache stores PlatformDisplacementInfo state.
+#endif // !PLATFORM_DISPLACEMENT_2
+
+
+/*****************
+ * config_benchmark.h
+ */
+
+// The replay benchmark is driven by recorded demo playback, which only runs
+// from the Mario head title screen.
+#ifdef ENABLE_BENCHMARK_REPLAY
+    #ifndef KEEP_MARIO_HEAD
+        #define KEEP_MARIO_HEAD
+    #endif
+    #undef DISABLE_DEMO
+#endif // ENABLE_BENCHMARK_REPLAY
+
+
 /*****************
  * config_goddard.h
  */
@@ -127,6 +166,8 @@
 #ifndef KEEP_MARIO_HEAD
     #undef GODDARD_EASTER_EGG
 
+    #undef GODDARD_DL_CACHING
+
     #undef DISABLE_DEMO
     #define DISABLE_DEMO
 #endif // !KEEP_MARIO_HEAD
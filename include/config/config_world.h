@@ -79,9 +79,82 @@ STATIC_ASSERT(((EXTENDED_BOUNDS_MODE >= 0) && (EXTENDED_BOUNDS_MODE <= 3)), "You
 // Multiply SURFACE_POOL_SIZE by the average amount of cells the surfaces intersect.
 #define SURFACE_NODE_POOL_SIZE      (SURFACE_POOL_SIZE * 4) // Vanilla: 7000
 
+// Sizes the surface pools per level from the areas' terrain data instead of always
+// reserving SURFACE_POOL_SIZE/SURFACE_NODE_POOL_SIZE. The static surface and node counts
+// are measured exactly by walking each area's collision data before the pools are
+// allocated, then DYNAMIC_SURFACE_POOL_RESERVE is added on top for object collision.
+// Small levels stop wasting main pool memory and huge ones stop overflowing.
+// SURFACE_POOL_SIZE/SURFACE_NODE_POOL_SIZE still apply to levels with no terrain data.
+#define PER_LEVEL_SURFACE_POOLS
+
+#ifdef PER_LEVEL_SURFACE_POOLS
+// Surfaces reserved on top of the measured static count for dynamic (object) collision.
+// Nodes get 4x this, matching the static surface-to-node ratio above. Individual levels
+// can override it with the SURFACE_POOL_RESERVE level script command.
+#define DYNAMIC_SURFACE_POOL_RESERVE 600
+#endif
+
+// Builds an area's static collision on a low priority worker thread. The game thread
+// still walks the terrain stream itself (vertex tables, special/macro object spawns
+// and environment boxes stay on it), but hands the surface sections -- triangle
+// construction, cell list insertion and the static BVH -- to the worker, which runs
+// whenever the game thread blocks: chiefly the warp's remaining DMA (skybox, object
+// models) and the vsync waits before the first frame. Collision queries join the
+// worker before touching the surface lists, so the handoff is invisible to gameplay
+// code. The surface pools are private to the worker during the build, so nothing
+// else may allocate from them between load and join (nothing does; dynamic surfaces
+// load per frame, after the join).
+#define ASYNC_TERRAIN_LOADING
+
+// Retains the static collision builds of the last few areas the player left, so
+// re-entering one (a door in the castle, a lakitu skip back outside) restores the
+// finished build with a handful of memcpys instead of re-parsing the terrain stream
+// and re-inserting every triangle. Builds are restored to the exact pool addresses
+// they were captured from, which keeps every internal pointer valid; entries are
+// keyed by the area's terrain data pointer and dropped when the level's pools are
+// reallocated. Objects are deliberately not snapshotted -- they respawn through the
+// normal path so re-entry behaves exactly like vanilla. Requires
+// PER_LEVEL_SURFACE_POOLS (for exact buffer sizing); inactive without it. Costs
+// roughly an extra copy of the level's static collision per retained entry.
+#define AREA_STATE_CACHE
+
+#ifdef AREA_STATE_CACHE
+// Retained areas. Two covers the common door in/out round trip.
+#define AREA_STATE_CACHE_ENTRIES 2
+#endif
+
 // Flags for error messages.
 #define NOT_ENOUGH_ROOM_FOR_SURFACES (1 << 0)
 #define NOT_ENOUGH_ROOM_FOR_NODES    (1 << 1)
 
+// Allows levels to override the collision cell granularity from their level script
+// with SET_COLLISION_CELLS(cellSize) (see include/level_commands.h). NUM_CELLS above
+// becomes the compile-time maximum grid dimension, so runtime cell sizes can only be
+// CELL_SIZE or coarser: size the build (via EXTENDED_BOUNDS_MODE) for the finest grid
+// any level needs, and have small vanilla stages pick a coarser grid. Levels that
+// don't issue the command use CELL_SIZE.
+// #define VARIABLE_CELL_GRID
+
+#if CELL_SIZE == 0x200
+    #define CELL_SIZE_SHIFT 9
+#elif CELL_SIZE == 0x400
+    #define CELL_SIZE_SHIFT 10
+#endif
+
+#ifdef VARIABLE_CELL_GRID
+
+#ifndef __ASSEMBLER__
+// Runtime collision grid granularity, see surface_set_cell_size() in surface_load.c.
+extern s16 gCellSizeShift;
+extern s16 gNumCellsUsed;
+#endif
+
+// Use this to convert game units to cell coordinates.
+#define GET_CELL_COORD(p)   ((((s32)(p) + LEVEL_BOUNDARY_MAX) >> gCellSizeShift) & (gNumCellsUsed - 1))
+
+#else
+
 // Use this to convert game units to cell coordinates.
 #define GET_CELL_COORD(p)   ((((s32)(p) + LEVEL_BOUNDARY_MAX) / CELL_SIZE) & (NUM_CELLS - 1))
+
+#endif // VARIABLE_CELL_GRID
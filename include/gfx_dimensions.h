@@ -35,6 +35,21 @@ Note that RECT commands must be enhanced to support negative coordinates with th
 
 #endif
 
+#ifdef ADAPTIVE_RESOLUTION
+extern f32 gResolutionScale;
+
+// Vertical squash for adaptive resolution. Framebuffer y coordinates (and the
+// viewport's vertical scale/translate) run through ADAPTIVE_RES_Y; a texture
+// rectangle's vertical step (dtdy) runs through ADAPTIVE_RES_STEP_T so the
+// texture is resampled to fit the squashed rectangle. The VI's y scale
+// stretches the result back to full height.
+#define ADAPTIVE_RES_Y(y)      ((s32)((y) * gResolutionScale))
+#define ADAPTIVE_RES_STEP_T(t) ((s32)((f32)(t) / gResolutionScale))
+#else
+#define ADAPTIVE_RES_Y(y)      (y)
+#define ADAPTIVE_RES_STEP_T(t) (t)
+#endif
+
 // If screen is taller than it is wide, radius should be equal to SCREEN_HEIGHT since we scale horizontally
 #define GFX_DIMENSIONS_FULL_RADIUS (SCREEN_HEIGHT * (GFX_DIMENSIONS_ASPECT_RATIO > 1 ? GFX_DIMENSIONS_ASPECT_RATIO : 1))
 
@@ -54,6 +54,8 @@ extern int	flush_window(void);
 //
 //
 u32   expand_gzip(u8 *src_addr, u8 *dst_addr, u32 size, u32 outbytes_limit);
+u32   expand_gzip_chunked(u8 *src_addr, u8 *dst_addr, u32 size, u32 outbytes_limit,
+                          u32 chunk_size, void (*wait_chunk)(u32 chunkEnd));
 
 
 #endif
@@ -73,6 +73,13 @@ enum LevelCommands {
     /*0x3E*/ LEVEL_CMD_CHANGE_AREA_SKYBOX,
     /*0x3F*/ LEVEL_CMD_PUPPYLIGHT_ENVIRONMENT,
     /*0x40*/ LEVEL_CMD_PUPPYLIGHT_NODE,
+    /*0x41*/ LEVEL_CMD_SET_COLLISION_CELLS,
+    /*0x42*/ LEVEL_CMD_PREFETCH,
+    /*0x43*/ LEVEL_CMD_CREATE_CURRENT_VOLUME,
+    /*0x44*/ LEVEL_CMD_AMBIENT_SOUND_ZONE,
+    /*0x45*/ LEVEL_CMD_MEM_GROUP,
+    /*0x46*/ LEVEL_CMD_MEM_GROUP_END,
+    /*0x47*/ LEVEL_CMD_SURFACE_POOL_RESERVE,
 };
 
 enum LevelActs {
@@ -121,6 +128,13 @@ enum LevelCommandCreateWhirlpoolCondition {
     WHIRLPOOL_COND_AT_LEAST_SECOND_STAR
 };
 
+enum WaterCurrentVolumeTypes {
+    // Uniform flow along yaw/pitch throughout the volume.
+    WATER_CURRENT_TYPE_FLOW,
+    // Whirlpool-style swirl around the volume's center, fading out toward its bounds.
+    WATER_CURRENT_TYPE_VORTEX
+};
+
 // Head defines
 enum GoddardScene {
     REGULAR_FACE = 0x2,
@@ -263,6 +277,11 @@ enum GoddardScene {
     CMD_BBH(LEVEL_CMD_LOAD_YAY0, 0x0C, 0x0000), \
     CMD_PTR(NULL), \
     CMD_PTR(NULL)
+
+#define PREFETCH(romStart, romEnd) \
+    CMD_BBH(LEVEL_CMD_PREFETCH, 0x0C, 0x0000), \
+    CMD_PTR(NULL), \
+    CMD_PTR(NULL)
 #else
 #define FIXED_LOAD(loadAddr, romStart, romEnd) \
     CMD_BBH(LEVEL_CMD_LOAD_TO_FIXED_ADDRESS, 0x10, 0x0000), \
@@ -288,6 +307,13 @@ enum GoddardScene {
     CMD_BBH(LEVEL_CMD_LOAD_YAY0, 0x0C, seg), \
     CMD_PTR(romStart), \
     CMD_PTR(romEnd)
+
+// Starts a background DMA of the ROM range into a staging buffer; a later
+// LOAD_RAW/LOAD_YAY0 of the same range consumes it instead of stalling on PI.
+#define PREFETCH(romStart, romEnd) \
+    CMD_BBH(LEVEL_CMD_PREFETCH, 0x0C, 0x0000), \
+    CMD_PTR(romStart), \
+    CMD_PTR(romEnd)
 #endif
 
 #ifdef KEEP_MARIO_HEAD
@@ -318,6 +344,11 @@ enum GoddardScene {
     CMD_PTR(segStart), \
     CMD_PTR(segEnd)
 
+// Sets the collision cell size for this level's areas (VARIABLE_CELL_GRID only).
+// Must be issued before the areas' terrain loads; resets to CELL_SIZE at INIT_LEVEL.
+#define SET_COLLISION_CELLS(cellSize) \
+    CMD_BBH(LEVEL_CMD_SET_COLLISION_CELLS, 0x04, cellSize)
+
 
 #define INIT_LEVEL() \
     CMD_BBH(LEVEL_CMD_INIT_LEVEL, 0x04, 0x0000)
@@ -451,9 +482,49 @@ enum GoddardScene {
     CMD_HH(posX, posY), \
     CMD_HH(posZ, strength)
 
+// Places a water current volume (requires WATER_CURRENT_FIELD). Flows push along
+// yaw/pitch at the given speed; vortices swirl around the volume center with the given
+// strength (negative values push outward and upward, like a negative whirlpool).
+#define WATER_CURRENT_VOLUME(type, minX, minY, minZ, maxX, maxY, maxZ, yaw, pitch, speed) \
+    CMD_BBBB(LEVEL_CMD_CREATE_CURRENT_VOLUME, 0x18, type, 0x00), \
+    CMD_HH(minX, minY), \
+    CMD_HH(minZ, maxX), \
+    CMD_HH(maxY, maxZ), \
+    CMD_HH(yaw, pitch), \
+    CMD_HH(speed, 0x0000)
+
+// Places an ambient sound zone (requires AMBIENT_SOUND_ZONES). The sound plays
+// while Mario is inside the box, spatialized from the nearest point of the box
+// to the camera; see AMBIENT_ZONE_FLAG_* for global/first-person variants.
+#define AMBIENT_SOUND_ZONE(soundBits, flags, minX, minY, minZ, maxX, maxY, maxZ) \
+    CMD_BBBB(LEVEL_CMD_AMBIENT_SOUND_ZONE, 0x14, flags, 0x00), \
+    CMD_W(soundBits), \
+    CMD_HH(minX, minY), \
+    CMD_HH(minZ, maxX), \
+    CMD_HH(maxY, maxZ)
+
 #define GET_OR_SET(op, var) \
     CMD_BBBB(LEVEL_CMD_GET_OR_SET_VAR, 0x04, op, var)
 
+// Brackets a group of commands that only run when at least 'megabytes' MB of
+// RDRAM is present (8 with an expansion pak, 4 without). On smaller consoles
+// the whole group is skipped, so one ROM can load hi-res texture segments or
+// extra ambient objects only where the memory exists. Any commands may appear
+// inside the group; groups do not nest.
+#define MEM_GROUP(megabytes) \
+    CMD_BBH(LEVEL_CMD_MEM_GROUP, 0x04, megabytes)
+
+#define MEM_GROUP_END() \
+    CMD_BBH(LEVEL_CMD_MEM_GROUP_END, 0x04, 0x0000)
+
+// Sets how many dynamic (object) surfaces the level's collision pools reserve
+// on top of the measured static count (requires PER_LEVEL_SURFACE_POOLS; node
+// headroom scales at 4x). Must appear before FREE_LEVEL_POOL to take effect,
+// and only applies to the level that sets it. Use it to shrink the default
+// reserve in sparse levels or to grow it in object-heavy ones.
+#define SURFACE_POOL_RESERVE(surfaces) \
+    CMD_BBH(LEVEL_CMD_SURFACE_POOL_RESERVE, 0x04, surfaces)
+
 // Presets
 
 #define LOAD_LEVEL_DATA(level) \
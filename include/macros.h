@@ -73,6 +73,16 @@
 #define ALWAYS_INLINE inline
 #endif
 
+// Marks a function as rarely executed. GCC moves it into .text.unlikely,
+// which sm64.ld groups at the end of its segment so cold code stops
+// interleaving with the per-frame paths in the icache, and deprioritizes
+// branches leading to it.
+#ifdef __GNUC__
+#define COLD __attribute__((cold))
+#else
+#define COLD
+#endif
+
 #ifndef NO_SEGMENTED_MEMORY
 // convert a virtual address to physical.
 #define VIRTUAL_TO_PHYSICAL(addr)   ((uintptr_t)(addr) & 0x1FFFFFFF)
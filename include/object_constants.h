@@ -55,6 +55,8 @@ enum ObjFlags {
     OBJ_FLAG_OCCLUDE_SILHOUETTE                = (1 << 20), // 0x00100000
     OBJ_FLAG_OPACITY_FROM_CAMERA_DIST          = (1 << 21), // 0x00200000
     OBJ_FLAG_EMIT_LIGHT                        = (1 << 22), // 0x00400000
+    OBJ_FLAG_UPDATE_THROTTLED                  = (1 << 23), // 0x00800000 - Behavior script runs at a reduced rate when far from Mario (needs OBJ_FLAG_COMPUTE_DIST_TO_MARIO and OBJ_UPDATE_THROTTLING).
+    OBJ_FLAG_COLLISION_LOD                     = (1 << 24), // 0x01000000 - Approximate collision when far from Mario (needs OBJ_FLAG_COMPUTE_DIST_TO_MARIO and OBJ_COLLISION_LOD).
     OBJ_FLAG_HITBOX_WAS_SET                    = (1 << 30), // 0x40000000
 };
 
@@ -1,6 +1,8 @@
 #ifndef OBJECT_FIELDS_H
 #define OBJECT_FIELDS_H
 
+#include "macros.h" // STATIC_ASSERT
+
 /**
  * The array [0x88, 0x1C8) in struct Object consists of fields that can vary by
  * object type. These macros provide access to these fields.
@@ -50,11 +52,18 @@
 
 // 0x088 (0x00), the first field, is object-specific and defined below the common fields.
 /* Common fields */
+// The action/timer cluster lives directly after oFlags so the per-frame kernel
+// that cur_obj_update touches for every object (flags, action, timer, position,
+// velocity) sits in the first data cache lines of rawData. The fields that used
+// to occupy these slots (dialog state, oUnk94) moved to the vacated indices
+// further down. See the static asserts at the bottom of this file.
 #define /*0x08C*/ oFlags                      OBJECT_FIELD_U32(0x01)
-#define /*0x090*/ oDialogResponse             OBJECT_FIELD_S16(0x02, 0)
-#define /*0x092*/ oDialogState                OBJECT_FIELD_S16(0x02, 1)
-#define /*0x094*/ oUnk94                      OBJECT_FIELD_U32(0x03)
-// 0x98 unused/removed.
+#define /*0x090*/ O_ACTION_INDEX              0x02
+#define /*0x090*/ oAction                     OBJECT_FIELD_S32(O_ACTION_INDEX)
+#define /*0x094*/ O_TIMER_INDEX               0x03
+#define /*0x094*/ oTimer                      OBJECT_FIELD_S32(O_TIMER_INDEX)
+#define /*0x098*/ O_PREV_ACTION_INDEX         0x04
+#define /*0x098*/ oPrevAction                 OBJECT_FIELD_S32(O_PREV_ACTION_INDEX)
 #define /*0x09C*/ oIntangibleTimer            OBJECT_FIELD_S32(0x05)
 /* Position vector */
 #define /*0x0A0*/ O_POS_INDEX                 0x06
@@ -131,9 +140,11 @@
 /* Common fields */
 #define /*0x144*/ oBehParams2ndByte                             OBJECT_FIELD_S32(0x2F)
 // 0x148 unused, possibly a third param byte.
-#define /*0x14C*/ oAction                                       OBJECT_FIELD_S32(0x31)
+// 0x14C and 0x154 hold the fields displaced by the hot action/timer cluster.
+#define /*0x14C*/ oDialogResponse                               OBJECT_FIELD_S16(0x31, 0)
+#define /*0x14E*/ oDialogState                                  OBJECT_FIELD_S16(0x31, 1)
 #define /*0x150*/ oSubAction                                    OBJECT_FIELD_S32(0x32)
-#define /*0x154*/ oTimer                                        OBJECT_FIELD_S32(0x33)
+#define /*0x154*/ oUnk94                                        OBJECT_FIELD_U32(0x33)
 #define /*0x158*/ oBounciness                                   OBJECT_FIELD_F32(0x34)
 #define /*0x15C*/ oDistanceToMario                              OBJECT_FIELD_F32(0x35)
 #define /*0x160*/ oAngleToMario                                 OBJECT_FIELD_S32(0x36)
@@ -154,7 +165,7 @@
 #define /*0x180*/ oDamageOrCoinValue                            OBJECT_FIELD_S32(0x3E)
 #define /*0x184*/ oHealth                                       OBJECT_FIELD_S32(0x3F)
 #define /*0x188*/ oBehParams                                    OBJECT_FIELD_S32(0x40)
-#define /*0x18C*/ oPrevAction                                   OBJECT_FIELD_S32(0x41)
+// 0x18C (0x41) unused; oPrevAction moved into the hot cluster at 0x098.
 #define /*0x190*/ oInteractionSubtype                           OBJECT_FIELD_U32(0x42)
 #define /*0x194*/ oCollisionDistance                            OBJECT_FIELD_F32(0x43)
 #define /*0x198*/ oNumLootCoins                                 OBJECT_FIELD_S32(0x44)
@@ -1335,5 +1346,12 @@ os16112*/
 #define /*0x110*/ os16110                                       OBJECT_FIELD_S16(0x22, 0)
 #define /*0x112*/ os16112                                       OBJECT_FIELD_S16(0x22, 1)
 
+// Layout guard for the hot kernel: every field cur_obj_update touches for every
+// object each frame (flags, action, timer, position, velocity) must stay in the
+// first 0x30 bytes of rawData, i.e. the struct's first few 16-byte R4300 data
+// cache lines, so idle objects don't drag cold lines through the cache.
+STATIC_ASSERT(O_ACTION_INDEX == 0x02 && O_TIMER_INDEX == 0x03 && O_PREV_ACTION_INDEX == 0x04
+           && O_POS_INDEX == 0x06 && O_VEL_INDEX == 0x09,
+              "Keep the per-frame object kernel packed at the front of rawData.");
 
 #endif // OBJECT_FIELDS_H
@@ -236,6 +236,19 @@ enum MarioActionGroups {
     ACT_GROUP_MASK       = 0x000001C0
 };
 
+#define ACT_GROUP_SHIFT             6
+#define ACT_NUM_GROUPS              8
+#define ACT_NUM_ACTIONS_PER_GROUP   0x40
+// Index of an action within its group's dispatch table.
+#define ACT_INDEX_IN_GROUP(action)  ((action) & (ACT_NUM_ACTIONS_PER_GROUP - 1))
+// Index of an action's group in the group dispatch table.
+#define ACT_GROUP_INDEX(action)     (((action) & ACT_GROUP_MASK) >> ACT_GROUP_SHIFT)
+
+// An action handler, called each frame the action is active until it requests
+// a re-dispatch by returning TRUE (after an action change). Dispatch is table
+// driven: each mario_actions_*.c file maps its group's action IDs to handlers.
+typedef s32 (*MarioActionFunc)(struct MarioState *);
+
 enum MarioActionFlags {
     ACT_FLAG_STATIONARY                 = /* 0x00000200 */ (1 <<  9),
     ACT_FLAG_MOVING                     = /* 0x00000400 */ (1 << 10),
@@ -1,6 +1,8 @@
 #ifndef SURFACE_TERRAINS_H
 #define SURFACE_TERRAINS_H
 
+#include <PR/ultratypes.h>
+
 #include "config.h"
 
 // Surface Types
@@ -253,8 +255,31 @@ enum SurfaceFlags {
     SURFACE_FLAGS_NONE            = (0 << 0), // 0x0000
     SURFACE_FLAG_DYNAMIC          = (1 << 0), // 0x0001
     SURFACE_FLAG_NO_CAM_COLLISION = (1 << 1), // 0x0002
+    SURFACE_FLAG_FREED            = (1 << 2), // 0x0004, recycled dynamic surface (DYNAMIC_SURFACE_RETENTION)
+};
+
+// Per-surface-type properties, packed into one byte per type so every
+// classification is a load and a mask instead of a switch. The table itself
+// (gSurfaceTypeProps, in surface_load.c) is the single place a type's
+// slipperiness class, footstep sound column, force field and camera collision
+// behavior are defined; unlisted types get the all-default zero entry.
+enum SurfaceTypeProps {
+    SURF_PROP_SOUND_MASK  = (0x7 << 0), // footstep sound column in sTerrainSounds
+    SURF_PROP_CLASS_MASK  = (0x3 << 3), // enum SurfaceClass
+    SURF_PROP_FORCE       = (1 << 5),   // tris of this type carry a force value
+    SURF_PROP_NO_CAM_COL  = (1 << 6),   // loads with SURFACE_FLAG_NO_CAM_COLLISION
 };
 
+#define SURF_PROP_SOUND(soundType)  (soundType)
+#define SURF_PROP_CLASS(class)      ((class) << 3)
+
+#define SURFACE_TYPE_SOUND(type)        (gSurfaceTypeProps[type] & SURF_PROP_SOUND_MASK)
+#define SURFACE_TYPE_CLASS(type)        ((gSurfaceTypeProps[type] & SURF_PROP_CLASS_MASK) >> 3)
+#define SURFACE_TYPE_HAS_FORCE(type)    (gSurfaceTypeProps[type] & SURF_PROP_FORCE)
+#define SURFACE_TYPE_NO_CAM_COL(type)   (gSurfaceTypeProps[type] & SURF_PROP_NO_CAM_COL)
+
+extern const u8 gSurfaceTypeProps[0x100];
+
 // These are effectively unique "surface" types like those defined higher
 // And they are used as collision commands to load certain functions
 enum TerrainLoadCmd {
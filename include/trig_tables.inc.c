@@ -1289,6 +1289,7 @@ f32 gSineTable[] = {
     0.999981165f, 0.999989390f, 0.999995291f, 0.999998808f,
 };
 
+#ifndef ATAN2_SMALL_TABLE // Replaced by the 66 entry lerp table in math_util.c.
 s16 gArctanTable[0x401] = {
     0x0000, 0x000A, 0x0014, 0x001F, 0x0029, 0x0033, 0x003D, 0x0047,
     0x0051, 0x005C, 0x0066, 0x0070, 0x007A, 0x0084, 0x008F, 0x0099,
@@ -1420,3 +1421,4 @@ s16 gArctanTable[0x401] = {
     0x1FD7, 0x1FDC, 0x1FE1, 0x1FE6, 0x1FEC, 0x1FF1, 0x1FF6, 0x1FFB,
     0x2000
 };
+#endif // !ATAN2_SMALL_TABLE
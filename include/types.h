@@ -255,6 +255,13 @@ struct GraphNodeObject {
 #ifdef OBJECTS_REJ
     u16 ucode;
 #endif
+#ifdef LOD_HYSTERESIS
+    s16 lodBandMin; // minDistance of the LOD band drawn last frame, or LOD_BAND_NONE
+#endif
+#ifdef ASYNC_MODEL_LOADING
+    // Model the object is waiting on while it renders as a placeholder.
+    ModelID16 pendingModelID;
+#endif
 };
 
 struct ObjectNode {
@@ -328,7 +335,7 @@ struct Object {
     /*0x1C8*/ u32 unused1;
     /*0x1CC*/ const BehaviorScript *curBhvCommand;
     /*0x1D0*/ u32 bhvStackIndex;
-    /*0x1D4*/ uintptr_t bhvStack[8];
+    /*0x1D4*/ uintptr_t bhvStack[BHV_STACK_SIZE];
     /*0x1F4*/ s16 bhvDelayTimer;
     /*0x1F6*/ s16 respawnInfoType;
     /*0x1F8*/ f32 hitboxRadius;
@@ -342,8 +349,66 @@ struct Object {
     /*0x218*/ void *collisionData;
     /*0x21C*/ Mat4 transform;
     /*0x25C*/ void *respawnInfo;
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+    // Last find_object_floor query and result (see surface_collision.c).
+    Vec3f floorCachePos;
+    struct Surface *floorCacheFloor;
+    u16 floorCacheRev;
+#endif
+#ifdef DYNAMIC_SURFACE_RETENTION
+    // The transform the object's dynamic surfaces were built from, and the
+    // cell range they were bucketed into (see surface_load.c).
+    Mat4 dynColMtx;
+    Vec3f dynColScale;
+    u8 dynColMinCellX, dynColMaxCellX;
+    u8 dynColMinCellZ, dynColMaxCellZ;
+    s8 dynColLoaded;
+    // World space bounds of the transformed collision mesh, refreshed by
+    // transform_object_vertices alongside the vertex pass.
+    Vec3t dynColAABBMin;
+    Vec3t dynColAABBMax;
+#endif
+#ifdef ANIM_MATRIX_CACHE
+    // Bone matrix cache slot owned by this object, or -1 (see rendering_graph_node.c).
+    s16 animMtxCacheIndex;
+#endif
+#ifdef ANIM_BLENDING
+    // Animation pose blend slot owned by this object, or -1 (see rendering_graph_node.c).
+    s16 animBlendIndex;
+#endif
+#ifdef OBJECT_POOL_BITMAP
+    // Incremented every time this pool slot is freed. Code holding an object
+    // pointer across frames can save this alongside it to detect slot reuse.
+    u32 generation;
+#endif
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    // This object's list and position in gObjectListSlots (see spawn_object.c).
+    u8 compactListIndex;
+    u8 compactListPos;
+#endif
+#ifdef BHV_LOD_TIERS
+    // This behavior's entry in gBehaviorLodTiers, or NULL if it has no
+    // registered LOD tiers (see behavior_script.c).
+    const struct BehaviorLodTier *behaviorLodTier;
+#endif
 #ifdef PUPPYLIGHTS
     struct PuppyLight puppylight;
+#ifdef PUPPYLIGHTS_GRID
+    // Inputs of this object's last puppylights_run call, used to skip the
+    // recompute when nothing relevant has changed (see puppylights.c).
+    Lights1 *puppylightGridSrc;
+    Vec3f puppylightGridPos;
+    s32 puppylightGridFlags;
+    u32 puppylightGridColour;
+    u32 puppylightGridStamp;
+#ifdef PUPPYLIGHTS_STATIC_BAKE
+    // Blended result of the static lights alone, re-applied as the base so an
+    // unmoved object only evaluates dynamic lights (see puppylights.c).
+    Lights1 puppylightStaticBase;
+    u32 puppylightStaticStamp;
+    u8 puppylightStaticOffsetPlaced;
+#endif
+#endif
 #endif
 };
 
@@ -20,6 +20,10 @@
 
 const LevelScript level_main_menu_entry_file_select[] = {
     INIT_LEVEL(),
+    // Stage the later segments up front so their DMAs run while the goddard
+    // copy and the seg7 decompression are crunching on the CPU.
+    PREFETCH(/*romStart*/ _menu_segment_7SegmentRomStart, /*romEnd*/ _menu_segment_7SegmentRomEnd),
+    PREFETCH(/*romStart*/ _behaviorSegmentRomStart,       /*romEnd*/ _behaviorSegmentRomEnd),
     LOAD_GODDARD(),
     LOAD_LEVEL_DATA(menu),
     LOAD_BEHAVIOR_DATA(),
@@ -59,38 +63,41 @@ const LevelScript level_main_menu_entry_file_select[] = {
 
 const LevelScript level_main_menu_entry_act_select[] = {
     /* 0*/ CALL(/*arg*/ 0, /*func*/ lvl_set_current_level),
-    /* 2*/ JUMP_IF(/*op*/ OP_EQ, /*arg*/ FALSE, (level_main_menu_entry_act_select + 42)), // goto L1 (exit)
+    /* 2*/ JUMP_IF(/*op*/ OP_EQ, /*arg*/ FALSE, (level_main_menu_entry_act_select + 45)), // goto L1 (exit)
     /* 5*/ INIT_LEVEL(),
-    /* 6*/ LOAD_GODDARD(),
-    /*10*/ LOAD_LEVEL_DATA(menu),
-    /*13*/ ALLOC_LEVEL_POOL(),
+    // Stage seg7 up front so its DMA runs while the goddard copy is crunching
+    // on the CPU (after the first visit it is cache-resident and this no-ops).
+    /* 6*/ PREFETCH(/*romStart*/ _menu_segment_7SegmentRomStart, /*romEnd*/ _menu_segment_7SegmentRomEnd),
+    /* 9*/ LOAD_GODDARD(),
+    /*13*/ LOAD_LEVEL_DATA(menu),
+    /*16*/ ALLOC_LEVEL_POOL(),
 
-    /*14*/ AREA(/*index*/ 2, geo_menu_act_selector_strings),
-        /*16*/ OBJECT(/*model*/ MODEL_NONE, /*pos*/ 0, -100, 0, /*angle*/ 0, 0, 0, /*behParam*/ BP(0x04, 0x00, 0x00, 0x00), /*beh*/ bhvActSelector),
-        /*22*/ TERRAIN(/*terrainData*/ main_menu_seg7_collision),
-    /*24*/ END_AREA(),
+    /*17*/ AREA(/*index*/ 2, geo_menu_act_selector_strings),
+        /*19*/ OBJECT(/*model*/ MODEL_NONE, /*pos*/ 0, -100, 0, /*angle*/ 0, 0, 0, /*behParam*/ BP(0x04, 0x00, 0x00, 0x00), /*beh*/ bhvActSelector),
+        /*25*/ TERRAIN(/*terrainData*/ main_menu_seg7_collision),
+    /*27*/ END_AREA(),
 
-    /*25*/ FREE_LEVEL_POOL(),
-    /*26*/ LOAD_AREA(/*area*/ 2),
+    /*28*/ FREE_LEVEL_POOL(),
+    /*29*/ LOAD_AREA(/*area*/ 2),
 #ifdef NO_SEGMENTED_MEMORY
         // sVisibleStars is set to 0 during FIXED_LOAD above on N64, but not when NO_SEGMENTED_MEMORY is used.
         // lvl_init_act_selector_values_and_stars must be called here otherwise the previous
         // value is retained and causes incorrect drawing during the 16 transition frames.
         CALL(/*arg*/ 0, /*func*/ lvl_init_act_selector_values_and_stars),
 #endif
-    /*27*/ TRANSITION(/*transType*/ WARP_TRANSITION_FADE_FROM_COLOR, /*time*/ 16, /*color*/ 0xFF, 0xFF, 0xFF),
-    /*29*/ SLEEP(/*frames*/ 16),
-    /*30*/ SET_MENU_MUSIC(/*seq*/ 0x000D),
+    /*30*/ TRANSITION(/*transType*/ WARP_TRANSITION_FADE_FROM_COLOR, /*time*/ 16, /*color*/ 0xFF, 0xFF, 0xFF),
+    /*32*/ SLEEP(/*frames*/ 16),
+    /*33*/ SET_MENU_MUSIC(/*seq*/ 0x000D),
 #ifndef NO_SEGMENTED_MEMORY
-    /*31*/ CALL(     /*arg*/ 0, /*func*/ lvl_init_act_selector_values_and_stars),
+    /*34*/ CALL(     /*arg*/ 0, /*func*/ lvl_init_act_selector_values_and_stars),
 #endif
-    /*33*/ CALL_LOOP(/*arg*/ 0, /*func*/ lvl_update_obj_and_load_act_button_actions),
-    /*35*/ GET_OR_SET(/*op*/ OP_SET, /*var*/ VAR_CURR_ACT_NUM),
-    /*36*/ STOP_MUSIC(/*fadeOutTime*/ 0x00BE),
-    /*37*/ TRANSITION(/*transType*/ WARP_TRANSITION_FADE_INTO_COLOR, /*time*/ 16, /*color*/ 0xFF, 0xFF, 0xFF),
-    /*39*/ SLEEP(/*frames*/ 16),
-    /*40*/ CLEAR_LEVEL(),
-    /*41*/ SLEEP_BEFORE_EXIT(/*frames*/ 1),
+    /*36*/ CALL_LOOP(/*arg*/ 0, /*func*/ lvl_update_obj_and_load_act_button_actions),
+    /*38*/ GET_OR_SET(/*op*/ OP_SET, /*var*/ VAR_CURR_ACT_NUM),
+    /*39*/ STOP_MUSIC(/*fadeOutTime*/ 0x00BE),
+    /*40*/ TRANSITION(/*transType*/ WARP_TRANSITION_FADE_INTO_COLOR, /*time*/ 16, /*color*/ 0xFF, 0xFF, 0xFF),
+    /*42*/ SLEEP(/*frames*/ 16),
+    /*43*/ CLEAR_LEVEL(),
+    /*44*/ SLEEP_BEFORE_EXIT(/*frames*/ 1),
     // L1:
-    /*42*/ EXIT(),
+    /*45*/ EXIT(),
 };
@@ -0,0 +1,28 @@
+# Per-segment codec selection. Every segment compresses with MIXED_DEFAULT
+# unless a CODEC_OVERRIDES entry matches a substring of its build path, e.g.
+#   make COMPRESS=mixed CODEC_OVERRIDES="bin/segment2=yay0 levels/castle_grounds=rnc2"
+# The boot code dispatches on the container magic at load time, so codecs mix
+# freely within one ROM. gzip strips its magic and cannot take part; use the
+# headered codecs (mio0/yay0/rnc1/rnc2) here. Pair with DECOMP_BENCHMARK to
+# pick the fastest-adequate codec per segment from measured numbers.
+MIXED_DEFAULT ?= rnc1
+
+# first override whose key is a substring of the segment path, else the default
+codec-for = $(or $(firstword $(foreach ov,$(CODEC_OVERRIDES),$(if $(findstring $(firstword $(subst =, ,$(ov))),$(1)),$(lastword $(subst =, ,$(ov)))))),$(MIXED_DEFAULT))
+
+mixed-compress = \
+  $(if $(filter mio0,$(1)),$(MIO0TOOL) $(MIO0FLAGS) $(2) $(3),\
+  $(if $(filter yay0,$(1)),$(YAY0TOOL) $(YAY0FLAGS) $(2) $(3),\
+  $(if $(filter rnc1,$(1)),$(RNCPACK) p $(2) $(3) -m1,\
+  $(if $(filter rnc2,$(1)),$(RNCPACK) p $(2) $(3) -m2,\
+  $(error unknown codec '$(1)' for segment $(2))))))
+
+# Compress binary file
+$(BUILD_DIR)/%.szp: $(BUILD_DIR)/%.bin
+	$(call print,Compressing ($(call codec-for,$*)):,$<,$@)
+	$(V)$(CACHED_COMPRESS) -i $< -o $@ -- $(call mixed-compress,$(call codec-for,$*),$<,$@)
+
+# convert binary szp to object file
+$(BUILD_DIR)/%.szp.o: $(BUILD_DIR)/%.szp
+	$(call print,Converting to ELF:,$<,$@)
+	$(V)$(LD) -r -b binary $< -o $@
@@ -180,8 +180,16 @@ u8 gDefaultShortNoteDurationTable[16] = {
 };
 
 #if defined(VERSION_JP) || defined(VERSION_US)
-// gVibratoCurve[k] = k*8
-s8 gVibratoCurve[16] = { 0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120 };
+// Full period of the triangle vibrato LFO. Vanilla stored only the first
+// quarter (gVibratoCurve[k] = k*8) and folded the index into it with a switch
+// on every lookup; unrolling the wave makes get_vibrato_pitch_change a single
+// table load per note per update, the same scheme EU adopted.
+s8 gVibratoCurve[64] = {
+       0,    8,   16,   24,   32,   40,   48,   56,   64,   72,   80,   88,   96,  104,  112,  120,
+     120,  112,  104,   96,   88,   80,   72,   64,   56,   48,   40,   32,   24,   16,    8,    0,
+       0,   -8,  -16,  -24,  -32,  -40,  -48,  -56,  -64,  -72,  -80,  -88,  -96, -104, -112, -120,
+    -120, -112, -104,  -96,  -88,  -80,  -72,  -64,  -56,  -48,  -40,  -32,  -24,  -16,   -8,    0,
+};
 #endif
 
 struct AdsrEnvelope gDefaultEnvelope[] = {
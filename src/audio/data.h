@@ -32,7 +32,7 @@ extern f32 gNoteFrequencies[128];
 
 extern u8 gDefaultShortNoteVelocityTable[16];
 extern u8 gDefaultShortNoteDurationTable[16];
-extern s8 gVibratoCurve[16];
+extern s8 gVibratoCurve[64];
 extern struct AdsrEnvelope gDefaultEnvelope[3];
 
 #if defined(VERSION_EU) || defined(VERSION_SH)
@@ -59,6 +59,9 @@ static void sequence_channel_process_sound(struct SequenceChannel *seqChannel) {
     if (seqChannel->seqPlayer->muted && (seqChannel->muteBehavior & MUTE_BEHAVIOR_SOFTEN) != 0) {
         channelVolume *= seqChannel->seqPlayer->muteVolumeScale;
     }
+#if defined(CHANNEL_GROUP_DUCKING) && (defined(VERSION_JP) || defined(VERSION_US))
+    channelVolume *= seqChannel->duckScale;
+#endif
 
     f32 panFromChannel = seqChannel->pan * seqChannel->panChannelWeight;
     f32 panLayerWeight = 1.0f - seqChannel->panChannelWeight;
@@ -165,26 +168,8 @@ s32 get_vibrato_pitch_change(struct VibratoState *vib) {
 #else
     vib->time += vib->rate;
 
-    s32 index = (vib->time >> 10) & 0x3F;
-
-    switch (index & 0x30) {
-        case 0x10:
-            index = 31 - index;
-            // fallthrough
-
-        case 0x00:
-            return vib->curve[index];
-
-        case 0x20:
-            index -= 0x20;
-            break;
-
-        case 0x30:
-            index = 63 - index;
-            break;
-    }
-
-    return -vib->curve[index];
+    // gVibratoCurve holds the unrolled full wave, so no quadrant folding.
+    return vib->curve[(vib->time >> 10) & 0x3F];
 }
 #endif
 
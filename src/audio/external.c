@@ -7,6 +7,7 @@
 #include "external.h"
 #include "playback.h"
 #include "synthesis.h"
+#include "pcm_stream.h"
 #include "game/main.h"
 #include "game/level_update.h"
 #include "game/object_list_processor.h"
@@ -382,6 +383,44 @@ extern OSMesgQueue *D_SH_80350FA8;
 
 typedef s32 FadeT;
 
+#if PUPPYPRINT_DEBUG && (defined(VERSION_JP) || defined(VERSION_US))
+/**
+ * Phase timers for the audio thread; see the enum in external.h. Blocking
+ * cartridge DMA waits always run nested inside one of the other phases, so
+ * when one completes its time is pushed out of whichever phase is currently
+ * open by shifting that phase's start stamp forward.
+ */
+u32 gAudioPhaseTimes[AUDIO_PHASE_COUNT][AUDIO_PROFILING_BUFFER_SIZE];
+u32 gAudioPhaseIndex = 0;
+static u32 sAudioPhaseAccum[AUDIO_PHASE_COUNT];
+static u32 sAudioPhaseStart[AUDIO_PHASE_COUNT];
+
+void audio_phase_start(s32 phase) {
+    sAudioPhaseStart[phase] = osGetCount();
+}
+
+void audio_phase_end(s32 phase) {
+    u32 diff = osGetCount() - sAudioPhaseStart[phase];
+
+    sAudioPhaseAccum[phase] += diff;
+    if (phase == AUDIO_PHASE_DMA_WAIT) {
+        sAudioPhaseStart[AUDIO_PHASE_GAME_SOUND] += diff;
+        sAudioPhaseStart[AUDIO_PHASE_SEQUENCES] += diff;
+        sAudioPhaseStart[AUDIO_PHASE_SYNTHESIS] += diff;
+    }
+}
+
+void audio_phase_frame_done(void) {
+    s32 i;
+
+    for (i = 0; i < AUDIO_PHASE_COUNT; i++) {
+        gAudioPhaseTimes[i][gAudioPhaseIndex] = sAudioPhaseAccum[i];
+        sAudioPhaseAccum[i] = 0;
+    }
+    gAudioPhaseIndex = (gAudioPhaseIndex + 1) % AUDIO_PROFILING_BUFFER_SIZE;
+}
+#endif
+
 // some sort of main thread -> sound thread dispatchers
 extern void func_802ad728(u32 bits, f32 arg);
 extern void func_802ad74c(u32 bits, u32 arg);
@@ -389,6 +428,9 @@ extern void func_802ad770(u32 bits, s8 arg);
 
 static void update_background_music_after_sound(u8 bank, u8 soundIndex);
 static void update_game_sound(void);
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+static void process_audio_thread_cmds(void);
+#endif
 static void fade_channel_volume_scale(u8 player, u8 channelId, u8 targetScale, u16 fadeTimer);
 void process_level_music_dynamics(void);
 static u8 begin_background_music_fade(u16 fadeDuration);
@@ -615,6 +657,8 @@ struct SPTask *create_next_audio_frame_task(void) {
     //   on to the AI
     // Here we thus send to the AI the sound that was generated two frames ago.
     if (gAiBufferLengths[index] != 0) {
+        // Mix any pending HVQM movie audio on top before the AI reads it.
+        pcm_stream_mix(gAiBuffers[index], gAiBufferLengths[index]);
         osAiSetNextBuffer(gAiBuffers[index], gAiBufferLengths[index] * 4);
     }
 
@@ -643,17 +687,30 @@ struct SPTask *create_next_audio_frame_task(void) {
     }
 
     if (sGameLoopTicked != 0) {
+        audio_phase_start(AUDIO_PHASE_GAME_SOUND);
         update_game_sound();
+        audio_phase_end(AUDIO_PHASE_GAME_SOUND);
         sGameLoopTicked = 0;
     }
 
+#ifdef REVERB_QUALITY_TIERS
+    reverb_tier_update();
+#endif
+
     // For the function to match we have to preserve some arbitrary variable
     // across this function call.
     flags = 0;
     if (gAudioEnabled)
     {
         gAudioCmd = synthesis_execute(gAudioCmd, &writtenCmds, gCurrAiBuffer, gAiBufferLengths[index]);
+#ifdef AUDIO_DMA_BATCHING
+        // Every sample fetch of this update is now known; merge and issue them.
+        flush_sample_dmas();
+#endif
         gAudioRandom = ((gAudioRandom + gAudioFrameCount) * gAudioFrameCount);
+#ifdef AUDIO_VOICE_BUDGET
+        gAudioCmdsLastFrame = writtenCmds;
+#endif
     }
 
     index = gAudioTaskIndex;
@@ -679,6 +736,7 @@ struct SPTask *create_next_audio_frame_task(void) {
     task->yield_data_size = 0;
 
     decrease_sample_dma_ttls();
+    audio_phase_frame_done();
     return gAudioTask;
 }
 #endif
@@ -788,6 +846,56 @@ static void process_all_sound_requests(void) {
     }
 }
 
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+/**
+ * Game thread -> audio thread command ring. Works exactly like the sound
+ * request ring above: the game thread writes an entry and then bumps the
+ * count, the audio thread consumes entries until the counts match, and the
+ * u8 indices wrap naturally around the 0x100 entry buffer. Neither side ever
+ * blocks, so a burst of commands can't stall the game thread against the
+ * audio thread.
+ */
+enum AudioThreadCmdOp {
+    AUDIO_THREAD_CMD_STOP_SOUND,
+    AUDIO_THREAD_CMD_STOP_SOURCE,
+    AUDIO_THREAD_CMD_SEQ_FADE_OUT,
+    AUDIO_THREAD_CMD_FADE_VOLUME_SCALE,
+    AUDIO_THREAD_CMD_LOWER_VOLUME,
+    AUDIO_THREAD_CMD_UNLOWER_VOLUME,
+    AUDIO_THREAD_CMD_MUTE,
+#ifdef CHANNEL_GROUP_DUCKING
+    AUDIO_THREAD_CMD_DUCK_CONFIG,
+    AUDIO_THREAD_CMD_DUCK_SET,
+#endif
+};
+
+struct AudioThreadCmd {
+    u8 op;
+    u8 arg1;
+    u16 arg2;
+    u32 bits;
+    f32 *pos;
+};
+
+static struct AudioThreadCmd sAudioThreadCmds[0x100];
+static u8 sAudioThreadCmdCount = 0;
+static u8 sNumProcessedAudioThreadCmds = 0;
+
+/**
+ * Called from threads: thread5_game_loop
+ */
+static void queue_audio_thread_cmd(u8 op, u8 arg1, u16 arg2, u32 bits, f32 *pos) {
+    struct AudioThreadCmd *cmd = &sAudioThreadCmds[sAudioThreadCmdCount];
+
+    cmd->op = op;
+    cmd->arg1 = arg1;
+    cmd->arg2 = arg2;
+    cmd->bits = bits;
+    cmd->pos = pos;
+    sAudioThreadCmdCount++;
+}
+#endif
+
 /**
  * Called from threads: thread4_sound, thread5_game_loop (EU only)
  */
@@ -1182,6 +1290,9 @@ static void update_game_sound(void) {
     f32 value;
 #endif
 
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    process_audio_thread_cmds();
+#endif
     process_all_sound_requests();
     process_level_music_dynamics();
 
@@ -1561,7 +1672,11 @@ static void seq_player_play_sequence(u8 player, u8 seqId, u16 arg2) {
 #else
 
     gSequencePlayers[player].seqVariation = seqId & SEQ_VARIATION;
+#ifdef ASYNC_SEQUENCE_LOADING
+    load_sequence(player, seqId & SEQ_BASE_ID, 1);
+#else
     load_sequence(player, seqId & SEQ_BASE_ID, 0);
+#endif
 
     if (player == SEQ_PLAYER_LEVEL) {
         targetVolume = begin_background_music_fade(0);
@@ -1575,10 +1690,7 @@ static void seq_player_play_sequence(u8 player, u8 seqId, u16 arg2) {
 #endif
 }
 
-/**
- * Called from threads: thread5_game_loop
- */
-void seq_player_fade_out(u8 player, u16 fadeDuration) {
+static void seq_player_fade_out_internal(u8 player, u16 fadeDuration) {
 #if defined(VERSION_EU) || defined(VERSION_SH)
 #ifdef VERSION_EU
     u32 fd = fadeDuration;
@@ -1600,13 +1712,63 @@ void seq_player_fade_out(u8 player, u16 fadeDuration) {
 /**
  * Called from threads: thread5_game_loop
  */
-void fade_volume_scale(u8 player, u8 targetScale, u16 fadeDuration) {
+void seq_player_fade_out(u8 player, u16 fadeDuration) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_SEQ_FADE_OUT, player, fadeDuration, 0, NULL);
+#else
+    seq_player_fade_out_internal(player, fadeDuration);
+#endif
+}
+
+static void fade_volume_scale_internal(u8 player, u8 targetScale, u16 fadeDuration) {
     u8 i;
     for (i = 0; i < CHANNELS_MAX; i++) {
         fade_channel_volume_scale(player, i, targetScale, fadeDuration);
     }
 }
 
+/**
+ * Called from threads: thread5_game_loop
+ */
+void fade_volume_scale(u8 player, u8 targetScale, u16 fadeDuration) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_FADE_VOLUME_SCALE, player, fadeDuration, targetScale, NULL);
+#else
+    fade_volume_scale_internal(player, targetScale, fadeDuration);
+#endif
+}
+
+#if defined(CHANNEL_GROUP_DUCKING) && (defined(VERSION_JP) || defined(VERSION_US))
+/**
+ * Assign a set of a sequence player's channels to a duck group. Done once at
+ * music setup; the envelope itself lives on the audio thread.
+ *
+ * Called from threads: thread5_game_loop
+ */
+void music_duck_group_config(u8 group, u8 player, u16 channelMask) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_DUCK_CONFIG, group, channelMask, player, NULL);
+#else
+    seq_channel_duck_config(group, player, channelMask);
+#endif
+}
+
+/**
+ * Ramp a duck group toward targetScale (0..127) over fadeDuration audio
+ * updates. One call per change of intensity target; the per-update ramp runs
+ * on the audio thread.
+ *
+ * Called from threads: thread5_game_loop
+ */
+void music_duck_group_set(u8 group, u8 targetScale, u16 fadeDuration) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_DUCK_SET, group, fadeDuration, targetScale, NULL);
+#else
+    seq_channel_duck_set(group, targetScale, fadeDuration);
+#endif
+}
+#endif
+
 /**
  * Called from threads: thread3_main, thread4_sound, thread5_game_loop
  */
@@ -1812,14 +1974,7 @@ UNUSED void unused_8031FED0(u8 player, u32 bits, s8 arg2) {
     }
 }
 
-/**
- * Lower a sequence player's volume over fadeDuration frames.
- * If player is SEQ_PLAYER_LEVEL (background music), the given percentage is ignored
- * and a max target volume of 40 is used.
- *
- * Called from threads: thread5_game_loop
- */
-void seq_player_lower_volume(u8 player, u16 fadeDuration, u8 percentage) {
+static void seq_player_lower_volume_internal(u8 player, u16 fadeDuration, u8 percentage) {
     if (player == SEQ_PLAYER_LEVEL) {
         sLowerBackgroundMusicVolume = TRUE;
         begin_background_music_fade(fadeDuration);
@@ -1829,14 +1984,21 @@ void seq_player_lower_volume(u8 player, u16 fadeDuration, u8 percentage) {
 }
 
 /**
- * Remove the lowered volume constraint set by seq_player_lower_volume.
- * If player is SEQ_PLAYER_LEVEL (background music), the music won't necessarily
- * raise back to normal volume if other constraints have been set, e.g.
- * sBackgroundMusicTargetVolume.
+ * Lower a sequence player's volume over fadeDuration frames.
+ * If player is SEQ_PLAYER_LEVEL (background music), the given percentage is ignored
+ * and a max target volume of 40 is used.
  *
  * Called from threads: thread5_game_loop
  */
-void seq_player_unlower_volume(u8 player, u16 fadeDuration) {
+void seq_player_lower_volume(u8 player, u16 fadeDuration, u8 percentage) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_LOWER_VOLUME, player, fadeDuration, percentage, NULL);
+#else
+    seq_player_lower_volume_internal(player, fadeDuration, percentage);
+#endif
+}
+
+static void seq_player_unlower_volume_internal(u8 player, u16 fadeDuration) {
     sLowerBackgroundMusicVolume = FALSE;
     if (player == SEQ_PLAYER_LEVEL) {
         if (gSequencePlayers[player].state != SEQUENCE_PLAYER_STATE_FADE_OUT) {
@@ -1849,6 +2011,22 @@ void seq_player_unlower_volume(u8 player, u16 fadeDuration) {
     }
 }
 
+/**
+ * Remove the lowered volume constraint set by seq_player_lower_volume.
+ * If player is SEQ_PLAYER_LEVEL (background music), the music won't necessarily
+ * raise back to normal volume if other constraints have been set, e.g.
+ * sBackgroundMusicTargetVolume.
+ *
+ * Called from threads: thread5_game_loop
+ */
+void seq_player_unlower_volume(u8 player, u16 fadeDuration) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_UNLOWER_VOLUME, player, fadeDuration, 0, NULL);
+#else
+    seq_player_unlower_volume_internal(player, fadeDuration);
+#endif
+}
+
 /**
  * Begin a volume fade to adjust the background music to the correct volume.
  * The target volume is determined by global variables like sBackgroundMusicTargetVolume
@@ -1904,10 +2082,7 @@ static u8 begin_background_music_fade(u16 fadeDuration) {
     return targetVolume;
 }
 
-/**
- * Called from threads: thread5_game_loop
- */
-void set_audio_muted(u8 muted) {
+static void set_audio_muted_internal(u8 muted) {
     u8 i;
 
     for (i = 0; i < SEQUENCE_PLAYERS; i++) {
@@ -1923,6 +2098,17 @@ void set_audio_muted(u8 muted) {
     }
 }
 
+/**
+ * Called from threads: thread5_game_loop
+ */
+void set_audio_muted(u8 muted) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_MUTE, muted, 0, 0, NULL);
+#else
+    set_audio_muted_internal(muted);
+#endif
+}
+
 /**
  * Called from threads: thread4_sound
  */
@@ -1982,6 +2168,10 @@ void sound_init(void) {
     D_80332124 = 0;
     sNumProcessedSoundRequests = 0;
     sSoundRequestCount = 0;
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    sNumProcessedAudioThreadCmds = 0;
+    sAudioThreadCmdCount = 0;
+#endif
 }
 
 // (unused)
@@ -2005,10 +2195,7 @@ void get_currently_playing_sound(u8 bank, u8 *numPlayingSounds, u8 *numSoundsInB
     }
 }
 
-/**
- * Called from threads: thread5_game_loop
- */
-void stop_sound(u32 soundBits, f32 *pos) {
+static void stop_sound_internal(u32 soundBits, f32 *pos) {
     u8 bank = (soundBits & SOUNDARGS_MASK_BANK) >> SOUNDARGS_SHIFT_BANK;
     u8 soundIndex = sSoundBanks[bank][0].next;
 
@@ -2031,7 +2218,15 @@ void stop_sound(u32 soundBits, f32 *pos) {
 /**
  * Called from threads: thread5_game_loop
  */
-void stop_sounds_from_source(f32 *pos) {
+void stop_sound(u32 soundBits, f32 *pos) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_STOP_SOUND, 0, 0, soundBits, pos);
+#else
+    stop_sound_internal(soundBits, pos);
+#endif
+}
+
+static void stop_sounds_from_source_internal(f32 *pos) {
     u8 bank;
     u8 soundIndex;
 
@@ -2047,6 +2242,66 @@ void stop_sounds_from_source(f32 *pos) {
     }
 }
 
+/**
+ * Called from threads: thread5_game_loop
+ */
+void stop_sounds_from_source(f32 *pos) {
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+    queue_audio_thread_cmd(AUDIO_THREAD_CMD_STOP_SOURCE, 0, 0, 0, pos);
+#else
+    stop_sounds_from_source_internal(pos);
+#endif
+}
+
+#if defined(AUDIO_COMMAND_RING) && (defined(VERSION_JP) || defined(VERSION_US))
+/**
+ * Drains the game thread command ring. Runs at the top of update_game_sound,
+ * before the queued sound requests are processed, which preserves the order
+ * the vanilla direct calls took effect in: state pokes issued during a game
+ * frame always land before that frame's play_sound requests.
+ *
+ * Called from threads: thread4_sound
+ */
+static void process_audio_thread_cmds(void) {
+    while (sNumProcessedAudioThreadCmds != sAudioThreadCmdCount) {
+        struct AudioThreadCmd *cmd = &sAudioThreadCmds[sNumProcessedAudioThreadCmds];
+
+        switch (cmd->op) {
+            case AUDIO_THREAD_CMD_STOP_SOUND:
+                stop_sound_internal(cmd->bits, cmd->pos);
+                break;
+            case AUDIO_THREAD_CMD_STOP_SOURCE:
+                stop_sounds_from_source_internal(cmd->pos);
+                break;
+            case AUDIO_THREAD_CMD_SEQ_FADE_OUT:
+                seq_player_fade_out_internal(cmd->arg1, cmd->arg2);
+                break;
+            case AUDIO_THREAD_CMD_FADE_VOLUME_SCALE:
+                fade_volume_scale_internal(cmd->arg1, cmd->bits, cmd->arg2);
+                break;
+            case AUDIO_THREAD_CMD_LOWER_VOLUME:
+                seq_player_lower_volume_internal(cmd->arg1, cmd->arg2, cmd->bits);
+                break;
+            case AUDIO_THREAD_CMD_UNLOWER_VOLUME:
+                seq_player_unlower_volume_internal(cmd->arg1, cmd->arg2);
+                break;
+            case AUDIO_THREAD_CMD_MUTE:
+                set_audio_muted_internal(cmd->arg1);
+                break;
+#ifdef CHANNEL_GROUP_DUCKING
+            case AUDIO_THREAD_CMD_DUCK_CONFIG:
+                seq_channel_duck_config(cmd->arg1, cmd->bits, cmd->arg2);
+                break;
+            case AUDIO_THREAD_CMD_DUCK_SET:
+                seq_channel_duck_set(cmd->arg1, cmd->bits, cmd->arg2);
+                break;
+#endif
+        }
+        sNumProcessedAudioThreadCmds++;
+    }
+}
+#endif
+
 /**
  * Called from threads: thread3_main, thread5_game_loop
  */
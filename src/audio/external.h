@@ -39,6 +39,10 @@ void play_sound(s32 soundBits, f32 *pos);
 void audio_signal_game_loop_tick(void);
 void seq_player_fade_out(u8 player, u16 fadeDuration);
 void fade_volume_scale(u8 player, u8 targetScale, u16 fadeDuration);
+#if defined(CHANNEL_GROUP_DUCKING) && (defined(VERSION_JP) || defined(VERSION_US))
+void music_duck_group_config(u8 group, u8 player, u16 channelMask);
+void music_duck_group_set(u8 group, u8 targetScale, u16 fadeDuration);
+#endif
 void seq_player_lower_volume(u8 player, u16 fadeDuration, u8 percentage);
 void seq_player_unlower_volume(u8 player, u16 fadeDuration);
 void set_audio_muted(u8 muted);
@@ -71,4 +75,28 @@ void audio_set_sound_mode(u8 soundMode);
 
 void audio_init(void); // in load.c
 
+#if PUPPYPRINT_DEBUG && (defined(VERSION_JP) || defined(VERSION_US))
+// Per-phase CPU timing inside the audio thread, for the puppyprint
+// "Audio Perf" page. Each phase accumulates osGetCount() deltas over one
+// audio frame; create_next_audio_frame_task closes the frame and advances
+// the history ring.
+#define AUDIO_PROFILING_BUFFER_SIZE 64
+enum AudioProfilePhase {
+    AUDIO_PHASE_GAME_SOUND, // sound requests, command ring, music dynamics
+    AUDIO_PHASE_SEQUENCES,  // sequence scripts and note bookkeeping
+    AUDIO_PHASE_SYNTHESIS,  // RSP command list build
+    AUDIO_PHASE_DMA_WAIT,   // blocking cartridge DMA waits
+    AUDIO_PHASE_COUNT
+};
+extern u32 gAudioPhaseTimes[AUDIO_PHASE_COUNT][AUDIO_PROFILING_BUFFER_SIZE];
+extern u32 gAudioPhaseIndex;
+void audio_phase_start(s32 phase);
+void audio_phase_end(s32 phase);
+void audio_phase_frame_done(void);
+#else
+#define audio_phase_start(phase)
+#define audio_phase_end(phase)
+#define audio_phase_frame_done()
+#endif
+
 #endif // AUDIO_EXTERNAL_H
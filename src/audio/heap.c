@@ -5,6 +5,7 @@
 #include "load.h"
 #include "synthesis.h"
 #include "seqplayer.h"
+#include "playback.h"
 #include "effects.h"
 #include "game/game_init.h"
 #include "game/puppyprint.h"
@@ -372,6 +373,233 @@ void temporary_pools_init(struct PoolSplit *a) {
 }
 #undef SOUND_ALLOC_FUNC
 
+#if defined(PERSISTENT_BANK_CACHE) && (defined(VERSION_JP) || defined(VERSION_US))
+// Last-use stamps for the resident bank cache, bumped on every bank lookup.
+static u32 sBankUseStamps[0x40];
+static u32 sBankUseCounter = 0;
+
+static void bank_cache_touch(s32 bankId) {
+    sBankUseStamps[bankId] = ++sBankUseCounter;
+}
+
+// Shift a live pointer when the bank data it targets has moved.
+#define BANK_CACHE_FIX(p) \
+    if ((u8 *) (p) >= start && (u8 *) (p) < start + size) { \
+        (p) = (void *) ((uintptr_t) (p) + delta); \
+    }
+
+static void bank_cache_fix_refs(u8 *start, u32 size, s32 delta) {
+    s32 i, j, k;
+
+    for (i = 0; i < gMaxSimultaneousNotes; i++) {
+        BANK_CACHE_FIX(gNotes[i].sound);
+        BANK_CACHE_FIX(gNotes[i].adsr.envelope);
+    }
+
+    for (i = 0; i < SEQUENCE_PLAYERS; i++) {
+        struct SequencePlayer *seqPlayer = &gSequencePlayers[i];
+        if (!seqPlayer->enabled) {
+            continue;
+        }
+        for (j = 0; j < CHANNELS_MAX; j++) {
+            struct SequenceChannel *channel = seqPlayer->channels[j];
+            if (!IS_SEQUENCE_CHANNEL_VALID(channel)) {
+                continue;
+            }
+            BANK_CACHE_FIX(channel->instrument);
+            for (k = 0; k < LAYERS_MAX; k++) {
+                struct SequenceChannelLayer *layer = channel->layers[k];
+                if (layer == NULL) {
+                    continue;
+                }
+                BANK_CACHE_FIX(layer->instrument);
+                BANK_CACHE_FIX(layer->sound);
+                BANK_CACHE_FIX(layer->adsr.envelope);
+            }
+        }
+    }
+}
+#undef BANK_CACHE_FIX
+
+/**
+ * Evicts least-recently-used discardable banks from the resident cache and
+ * compacts the pool until `needed` bytes fit. Banks that slide down get their
+ * internal pointers and any live note/channel references adjusted in place,
+ * so playing sequences are unaffected.
+ */
+static s32 bank_cache_evict(u32 needed) {
+    struct PersistentPool *persistent = &gBankLoadedPool.persistent;
+    struct SoundAllocPool *pool = &persistent->pool;
+    u32 i;
+
+    // Never compact while a bank is still streaming in asynchronously; the
+    // in-flight DMA writes to fixed addresses.
+    for (i = 0; i < SEQUENCE_PLAYERS; i++) {
+        if (gSequencePlayers[i].bankDmaInProgress) {
+            return FALSE;
+        }
+    }
+
+    while ((u32) (pool->start + pool->size - pool->cur) < needed) {
+        s32 lru = -1;
+        for (i = 0; i < persistent->numEntries; i++) {
+            if (gBankLoadStatus[persistent->entries[i].id] == SOUND_LOAD_STATUS_DISCARDABLE
+                && (lru < 0 || sBankUseStamps[persistent->entries[i].id]
+                             < sBankUseStamps[persistent->entries[lru].id])) {
+                lru = i;
+            }
+        }
+        if (lru < 0) {
+            return FALSE;
+        }
+
+        struct SeqOrBankEntry *entry = &persistent->entries[lru];
+        s32 delta = -(s32) entry->size;
+        u32 *dst = (u32 *) entry->ptr;
+        u32 *src = (u32 *) (entry->ptr + entry->size);
+        u32 tail = (u32) (pool->cur - (u8 *) src);
+
+        discard_bank(entry->id);
+        gBankLoadStatus[entry->id] = SOUND_LOAD_STATUS_NOT_LOADED;
+
+        // Slide the banks above the hole down. The regions may overlap, so
+        // copy forwards; everything in the pool is 16-byte aligned.
+        for (i = 0; i < tail / sizeof(u32); i++) {
+            dst[i] = src[i];
+        }
+        bank_cache_fix_refs((u8 *) src, tail, delta);
+        for (i = lru + 1; i < persistent->numEntries; i++) {
+            persistent->entries[i].ptr += delta;
+            relocate_audio_bank(persistent->entries[i].id,
+                                (struct AudioBank *) persistent->entries[i].ptr, delta);
+        }
+        for (i = lru; i + 1 < persistent->numEntries; i++) {
+            persistent->entries[i] = persistent->entries[i + 1];
+        }
+        persistent->numEntries--;
+        pool->cur += delta;
+    }
+    return TRUE;
+}
+#endif
+
+#if defined(SEQ_POOL_COMPACTION) && (defined(VERSION_JP) || defined(VERSION_US))
+// Last-use stamps for resident sequences, bumped on every lookup.
+static u32 sSeqUseStamps[0x100];
+static u32 sSeqUseCounter = 0;
+
+static void seq_cache_touch(s32 seqId) {
+    sSeqUseStamps[seqId] = ++sSeqUseCounter;
+}
+
+// Shift a live pointer when the sequence data it targets has moved.
+#define SEQ_CACHE_FIX(p) \
+    if ((u8 *) (p) >= start && (u8 *) (p) < start + size) { \
+        (p) = (void *) ((uintptr_t) (p) + delta); \
+    }
+
+static void seq_cache_fix_refs(u8 *start, u32 size, s32 delta) {
+    s32 i, j, k, d;
+
+    for (i = 0; i < SEQUENCE_PLAYERS; i++) {
+        struct SequencePlayer *seqPlayer = &gSequencePlayers[i];
+        if (!seqPlayer->enabled) {
+            continue;
+        }
+        SEQ_CACHE_FIX(seqPlayer->seqData);
+        SEQ_CACHE_FIX(seqPlayer->shortNoteVelocityTable);
+        SEQ_CACHE_FIX(seqPlayer->shortNoteDurationTable);
+        SEQ_CACHE_FIX(seqPlayer->scriptState.pc);
+        for (d = 0; d < 4; d++) {
+            SEQ_CACHE_FIX(seqPlayer->scriptState.stack[d]);
+        }
+        for (j = 0; j < CHANNELS_MAX; j++) {
+            struct SequenceChannel *channel = seqPlayer->channels[j];
+            if (!IS_SEQUENCE_CHANNEL_VALID(channel)) {
+                continue;
+            }
+            SEQ_CACHE_FIX(channel->dynTable);
+            SEQ_CACHE_FIX(channel->scriptState.pc);
+            for (d = 0; d < 4; d++) {
+                SEQ_CACHE_FIX(channel->scriptState.stack[d]);
+            }
+            for (k = 0; k < LAYERS_MAX; k++) {
+                struct SequenceChannelLayer *layer = channel->layers[k];
+                if (layer == NULL) {
+                    continue;
+                }
+                SEQ_CACHE_FIX(layer->scriptState.pc);
+                for (d = 0; d < 4; d++) {
+                    SEQ_CACHE_FIX(layer->scriptState.stack[d]);
+                }
+            }
+        }
+    }
+}
+#undef SEQ_CACHE_FIX
+
+/**
+ * Evicts least-recently-played discardable sequences from the persistent pool
+ * and compacts it until `needed` bytes fit. Sequence scripts only ever address
+ * their data relative to seqData, so sliding one down just means adjusting the
+ * script pointers of any player still running out of the moved region. This
+ * gets called while the outgoing music has already faded to silence, so the
+ * copy is inaudible.
+ */
+static s32 seq_cache_evict(u32 needed) {
+    struct PersistentPool *persistent = &gSeqLoadedPool.persistent;
+    struct SoundAllocPool *pool = &persistent->pool;
+    u32 i;
+
+    // Never compact while a sequence is still streaming in asynchronously; the
+    // in-flight DMA writes to fixed addresses.
+    for (i = 0; i < SEQUENCE_PLAYERS; i++) {
+        if (gSequencePlayers[i].seqDmaInProgress) {
+            return FALSE;
+        }
+    }
+
+    while ((u32) (pool->start + pool->size - pool->cur) < needed) {
+        s32 lru = -1;
+        for (i = 0; i < persistent->numEntries; i++) {
+            if (gSeqLoadStatus[persistent->entries[i].id] == SOUND_LOAD_STATUS_DISCARDABLE
+                && (lru < 0 || sSeqUseStamps[persistent->entries[i].id]
+                             < sSeqUseStamps[persistent->entries[lru].id])) {
+                lru = i;
+            }
+        }
+        if (lru < 0) {
+            return FALSE;
+        }
+
+        struct SeqOrBankEntry *entry = &persistent->entries[lru];
+        s32 delta = -(s32) entry->size;
+        u32 *dst = (u32 *) entry->ptr;
+        u32 *src = (u32 *) (entry->ptr + entry->size);
+        u32 tail = (u32) (pool->cur - (u8 *) src);
+
+        discard_sequence(entry->id);
+        gSeqLoadStatus[entry->id] = SOUND_LOAD_STATUS_NOT_LOADED;
+
+        // Slide the sequences above the hole down. The regions may overlap, so
+        // copy forwards; everything in the pool is 16-byte aligned.
+        for (i = 0; i < tail / sizeof(u32); i++) {
+            dst[i] = src[i];
+        }
+        seq_cache_fix_refs((u8 *) src, tail, delta);
+        for (i = lru + 1; i < persistent->numEntries; i++) {
+            persistent->entries[i].ptr += delta;
+        }
+        for (i = lru; i + 1 < persistent->numEntries; i++) {
+            persistent->entries[i] = persistent->entries[i + 1];
+        }
+        persistent->numEntries--;
+        pool->cur += delta;
+    }
+    return TRUE;
+}
+#endif
+
 #ifdef VERSION_SH
 void *alloc_bank_or_seq(s32 poolIdx, s32 size, s32 arg3, s32 id) {
 #else
@@ -707,6 +935,19 @@ size = ALIGN16(size);
 #else
     arg0->persistent.entries[arg0->persistent.numEntries].ptr = soundAlloc(&arg0->persistent.pool, (arg1 * size));
 
+#ifdef PERSISTENT_BANK_CACHE
+    if (arg0 == &gBankLoadedPool && arg0->persistent.entries[arg0->persistent.numEntries].ptr == NULL
+        && bank_cache_evict(arg1 * size)) {
+        arg0->persistent.entries[arg0->persistent.numEntries].ptr = soundAlloc(&arg0->persistent.pool, (arg1 * size));
+    }
+#endif
+#ifdef SEQ_POOL_COMPACTION
+    if (arg0 == &gSeqLoadedPool && arg0->persistent.entries[arg0->persistent.numEntries].ptr == NULL
+        && seq_cache_evict(arg1 * size)) {
+        arg0->persistent.entries[arg0->persistent.numEntries].ptr = soundAlloc(&arg0->persistent.pool, (arg1 * size));
+    }
+#endif
+
     if (arg0->persistent.entries[arg0->persistent.numEntries].ptr == NULL) {
 #endif
         switch (arg3) {
@@ -736,6 +977,16 @@ size = ALIGN16(size);
     // Because the buffer is small enough that more don't fit?
     arg0->persistent.entries[arg0->persistent.numEntries].id = id;
     arg0->persistent.entries[arg0->persistent.numEntries].size = size;
+#if defined(PERSISTENT_BANK_CACHE) && (defined(VERSION_JP) || defined(VERSION_US))
+    if (arg0 == &gBankLoadedPool) {
+        bank_cache_touch(id);
+    }
+#endif
+#if defined(SEQ_POOL_COMPACTION) && (defined(VERSION_JP) || defined(VERSION_US))
+    if (arg0 == &gSeqLoadedPool) {
+        seq_cache_touch(id);
+    }
+#endif
 #if defined(VERSION_EU) || defined(VERSION_SH)
     return arg0->persistent.entries[arg0->persistent.numEntries++].ptr;
 #else
@@ -823,6 +1074,16 @@ void *get_bank_or_seq(struct SoundMultiPool *arg0, s32 arg1, s32 id) {
         for (i = 0; i < persistent->numEntries; i++) {
             if (id == persistent->entries[i].id) {
                 //eu_stubbed_printf_2("Cache hit %d at stay %d\n", id, i);
+#if defined(PERSISTENT_BANK_CACHE) && (defined(VERSION_JP) || defined(VERSION_US))
+                if (arg0 == &gBankLoadedPool) {
+                    bank_cache_touch(id);
+                }
+#endif
+#if defined(SEQ_POOL_COMPACTION) && (defined(VERSION_JP) || defined(VERSION_US))
+                if (arg0 == &gSeqLoadedPool) {
+                    seq_cache_touch(id);
+                }
+#endif
                 return persistent->entries[i].ptr;
             }
         }
@@ -1040,6 +1301,116 @@ void init_reverb_eu(void) {
     }
 }
 #else
+#ifdef REVERB_QUALITY_TIERS
+static s8 sReverbTierRequest = REVERB_TIER_FULL; // written by the game thread
+static s8 sReverbTierCurrent = REVERB_TIER_FULL;
+static s8 sReverbTierAutoDrop = 0;
+static u16 sReverbCalmFrames = 0;
+static s32 sReverbPresetId = 0;
+#ifdef AUDIO_VOICE_BUDGET
+static u32 sReverbLastVoicesDropped = 0;
+#endif
+
+// Frames of calm before an automatic downgrade is undone (~5 seconds).
+#define REVERB_TIER_RECOVER_FRAMES 150
+
+void set_reverb_tier(s32 tier) {
+    if (tier < REVERB_TIER_OFF) {
+        tier = REVERB_TIER_OFF;
+    } else if (tier > REVERB_TIER_FULL) {
+        tier = REVERB_TIER_FULL;
+    }
+    sReverbTierRequest = tier;
+}
+
+/**
+ * Reconfigures the reverb for the given tier. Only called between audio
+ * frames with the wet signal faded out, so the ring buffer can be reshaped
+ * and cleared without an audible seam. The ring buffer is always allocated
+ * at REVERB_WINDOW_SIZE_MAX, so no reallocation is needed.
+ */
+static void reverb_tier_apply(s32 tier) {
+    s32 windowSize = gReverbSettings[sReverbPresetId].windowSize;
+
+    if (tier == REVERB_TIER_OFF) {
+        gSynthesisReverb.useReverb = 0;
+        return;
+    }
+    if (tier == REVERB_TIER_SMALL) {
+        windowSize /= 4;
+        if (windowSize < DEFAULT_LEN_2CH) {
+            windowSize = DEFAULT_LEN_2CH;
+        }
+    }
+    if (windowSize > REVERB_WINDOW_SIZE_MAX) {
+        windowSize = REVERB_WINDOW_SIZE_MAX;
+    }
+
+    bzero(gSynthesisReverb.ringBuffer.left, (REVERB_WINDOW_SIZE_MAX * 2 * sizeof(s16)));
+    gSynthesisReverb.useReverb = 8;
+    gSynthesisReverb.ringBuffer.right  = &gSynthesisReverb.ringBuffer.left[windowSize];
+    gSynthesisReverb.nextRingBufferPos = 0;
+    gSynthesisReverb.unkC              = 0;
+    gSynthesisReverb.curFrame          = 0;
+    gSynthesisReverb.bufSizePerChannel = windowSize;
+    gSynthesisReverb.framesLeftToIgnore = 2;
+    if (gReverbDownsampleRate != 1) {
+        gSynthesisReverb.resampleFlags = A_INIT;
+    }
+}
+
+void reverb_tier_update(void) {
+    s32 target;
+    u16 presetGain = gReverbSettings[sReverbPresetId].gain;
+
+    // The preset has no reverb at all, so nothing was allocated to reshape.
+    if (gReverbSettings[sReverbPresetId].windowSize == 0) {
+        return;
+    }
+#ifdef BETTER_REVERB
+    if (toggleBetterReverb) {
+        return;
+    }
+#endif
+
+#ifdef AUDIO_VOICE_BUDGET
+    // Automatic downgrade: while the voice budget is shedding notes the RSP
+    // is already past its slice, so give back the reverb cost too.
+    if (gAudioVoicesDropped != sReverbLastVoicesDropped) {
+        sReverbLastVoicesDropped = gAudioVoicesDropped;
+        sReverbCalmFrames = 0;
+        sReverbTierAutoDrop = 1;
+    } else if (sReverbTierAutoDrop != 0 && ++sReverbCalmFrames >= REVERB_TIER_RECOVER_FRAMES) {
+        sReverbTierAutoDrop = 0;
+    }
+#endif
+
+    target = sReverbTierRequest - sReverbTierAutoDrop;
+    if (target < REVERB_TIER_OFF) {
+        target = REVERB_TIER_OFF;
+    }
+
+    if (sReverbTierCurrent != target) {
+        if (gSynthesisReverb.useReverb == 0) {
+            // Nothing audible to fade; switch at once and ramp the gain in.
+            reverb_tier_apply(target);
+            sReverbTierCurrent = target;
+            gSynthesisReverb.reverbGain = 0x400;
+        } else if (gSynthesisReverb.reverbGain > 0x400) {
+            // Fade the wet signal out before touching the ring buffer.
+            gSynthesisReverb.reverbGain -= (gSynthesisReverb.reverbGain / 4);
+        } else {
+            reverb_tier_apply(target);
+            sReverbTierCurrent = target;
+        }
+    } else if (gSynthesisReverb.useReverb != 0 && gSynthesisReverb.reverbGain < presetGain) {
+        // Fade back in toward the preset gain.
+        u32 gain = gSynthesisReverb.reverbGain + (presetGain / 8);
+        gSynthesisReverb.reverbGain = (gain > presetGain) ? presetGain : gain;
+    }
+}
+#endif
+
 void init_reverb_us(s32 presetId) {
     s16 *mem;
     s32 i;
@@ -1050,6 +1421,10 @@ void init_reverb_us(s32 presetId) {
 
     s32 reverbWindowSize = gReverbSettings[presetId].windowSize;
     gReverbDownsampleRate = gReverbSettings[presetId].downsampleRate;
+#ifdef REVERB_QUALITY_TIERS
+    sReverbPresetId = presetId;
+    sReverbTierCurrent = (reverbWindowSize == 0) ? REVERB_TIER_OFF : REVERB_TIER_FULL;
+#endif
 #ifdef BETTER_REVERB
     if (gIsConsole) {
         reverbConsole = betterReverbDownsampleConsole; // Console!
@@ -1168,10 +1543,19 @@ void audio_reset_session(struct AudioSessionSettings *preset, s32 presetId) {
             }
 
             persistent_pool_clear(&gSeqLoadedPool.persistent);
+#ifndef PERSISTENT_BANK_CACHE
             persistent_pool_clear(&gBankLoadedPool.persistent);
+#endif
             temporary_pool_clear( &gSeqLoadedPool.temporary);
             temporary_pool_clear( &gBankLoadedPool.temporary);
             reset_bank_and_seq_load_status();
+#ifdef PERSISTENT_BANK_CACHE
+            // Banks in the resident cache survive the session reset; restore
+            // their load statuses so the next sequence reuses them DMA-free.
+            for (u32 i = 0; i < gBankLoadedPool.persistent.numEntries; i++) {
+                gBankLoadStatus[gBankLoadedPool.persistent.entries[i].id] = SOUND_LOAD_STATUS_DISCARDABLE;
+            }
+#endif
 
             init_reverb_us(presetId);
             bzero(&gAiBuffers[0][0], (AIBUFFER_LEN * NUMAIBUFFERS));
@@ -143,6 +143,19 @@ void audio_reset_session(struct AudioSessionSettings *preset, s32 presetId);
 #endif
 void discard_bank(s32 bankId);
 
+#if defined(REVERB_QUALITY_TIERS) && (defined(VERSION_JP) || defined(VERSION_US))
+enum ReverbTier {
+    REVERB_TIER_OFF,
+    REVERB_TIER_SMALL,
+    REVERB_TIER_FULL
+};
+// Requests a reverb quality tier; applied at the next audio frame boundary
+// with a gain crossfade. Safe to call from the game thread.
+void set_reverb_tier(s32 tier);
+// Runs on the audio thread once per frame; see REVERB_QUALITY_TIERS.
+void reverb_tier_update(void);
+#endif
+
 #ifdef VERSION_SH
 void fill_filter(s16 filter[8], s32 arg1, s32 arg2);
 u8 *func_sh_802f1d40(u32 size, s32 bank, u8 *arg2, s8 medium);
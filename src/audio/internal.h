@@ -485,6 +485,11 @@ struct SequenceChannel {
     /*            0xC8*/ u16 unkC8;
     /*            0xCC*/ s16 *filter;
 #endif
+#if defined(CHANNEL_GROUP_DUCKING) && (defined(VERSION_JP) || defined(VERSION_US))
+    // Multiplier applied on top of volume * volumeScale by the channel-group
+    // ducking envelopes (seq_channel_duck_set). Owned by the audio thread.
+    f32 duckScale;
+#endif
 }; // size = 0xC0, 0xC4 in EU, 0xD0 in SH
 
 // Also known as a Track, according to debug strings.
@@ -112,7 +112,9 @@ void audio_dma_copy_immediate(uintptr_t devAddr, void *vAddr, size_t nbytes) {
     osInvalDCache(vAddr, nbytes);
     osPiStartDma(&gAudioDmaIoMesg, OS_MESG_PRI_HIGH, OS_READ, devAddr, vAddr, nbytes,
                  &gAudioDmaMesgQueue);
+    audio_phase_start(AUDIO_PHASE_DMA_WAIT);
     osRecvMesg(&gAudioDmaMesgQueue, NULL, OS_MESG_BLOCK);
+    audio_phase_end(AUDIO_PHASE_DMA_WAIT);
     eu_stubbed_printf_0("Romcopyend\n");
 }
 
@@ -190,6 +192,164 @@ void decrease_sample_dma_ttls() {
     }
 }
 
+#ifdef AUDIO_DMA_BATCHING
+struct PendingSampleDma {
+    uintptr_t devAddr;
+    u8 *vAddr;
+    u32 size;
+};
+
+static struct PendingSampleDma sPendingSampleDmas[AUDIO_FRAME_DMA_QUEUE_SIZE];
+static u32 sPendingSampleDmaCount = 0;
+
+/**
+ * Issue the frame's collected sample DMAs. The list is sorted by ROM address
+ * and runs that are contiguous in both ROM and destination RAM (buffers from
+ * one init-time pool walk often are) merge into one PI request. Everything
+ * goes out at high priority: a sample that misses its audio frame is an
+ * audible drop, so these transfers cut ahead of any level-load or prefetch
+ * DMA sitting in the PI queue.
+ */
+void flush_sample_dmas(void) {
+    u32 i, j;
+
+    if (sPendingSampleDmaCount == 0) {
+        return;
+    }
+
+    for (i = 1; i < sPendingSampleDmaCount; i++) {
+        struct PendingSampleDma pending = sPendingSampleDmas[i];
+
+        for (j = i; j > 0 && sPendingSampleDmas[j - 1].devAddr > pending.devAddr; j--) {
+            sPendingSampleDmas[j] = sPendingSampleDmas[j - 1];
+        }
+        sPendingSampleDmas[j] = pending;
+    }
+
+    i = 0;
+    while (i < sPendingSampleDmaCount && gCurrAudioFrameDmaCount < AUDIO_FRAME_DMA_QUEUE_SIZE) {
+        uintptr_t devAddr = sPendingSampleDmas[i].devAddr;
+        u8 *vAddr = sPendingSampleDmas[i].vAddr;
+        u32 size = sPendingSampleDmas[i].size;
+
+        for (j = i + 1; j < sPendingSampleDmaCount
+             && sPendingSampleDmas[j].devAddr == devAddr + size
+             && sPendingSampleDmas[j].vAddr == vAddr + size; j++) {
+            size += sPendingSampleDmas[j].size;
+        }
+
+        osPiStartDma(&gCurrAudioFrameDmaIoMesgBufs[gCurrAudioFrameDmaCount++], OS_MESG_PRI_HIGH,
+                     OS_READ, devAddr, vAddr, size, &gCurrAudioFrameDmaQueue);
+        i = j;
+    }
+    sPendingSampleDmaCount = 0;
+}
+
+/**
+ * Collect a sample DMA for the end-of-frame flush. A full list flushes in
+ * place, so a pathological frame degrades to the old issue-as-you-go behavior
+ * rather than dropping a fetch.
+ */
+static void queue_sample_dma(uintptr_t devAddr, u8 *vAddr, u32 size) {
+    if (sPendingSampleDmaCount >= ARRAY_COUNT(sPendingSampleDmas)) {
+        flush_sample_dmas();
+    }
+    sPendingSampleDmas[sPendingSampleDmaCount].devAddr = devAddr;
+    sPendingSampleDmas[sPendingSampleDmaCount].vAddr = vAddr;
+    sPendingSampleDmas[sPendingSampleDmaCount].size = size;
+    sPendingSampleDmaCount++;
+}
+#endif
+
+#ifdef AUDIO_SAMPLE_READAHEAD
+/**
+ * Checks whether a small (reuse queue 1) buffer already covers devAddr, and
+ * claims it if so. Returns the address of the data within the buffer, or NULL.
+ * This is how a read ahead scheduled by prefetch_sample_data is found again
+ * once playback actually reaches it; the hit logic mirrors the own-slot path
+ * in dma_sample_data, except the whole pool is scanned since the buffer was
+ * not allocated against any particular note.
+ */
+static void *sample_dma_readahead_lookup(uintptr_t devAddr, u32 size, u8 *dmaIndexRef) {
+    struct SharedDma *dma;
+    ssize_t bufferPos;
+    u32 i;
+
+    for (i = 0; i < sSampleDmaListSize1; i++) {
+        dma = &sSampleDmas[i];
+        bufferPos = devAddr - dma->source;
+        if (dma->source != 0 && 0 <= bufferPos && (size_t) bufferPos <= dma->bufSize - size) {
+            if (dma->ttl == 0) {
+                if (dma->reuseIndex != sSampleDmaReuseQueueTail1) {
+                    sSampleDmaReuseQueue1[dma->reuseIndex] =
+                        sSampleDmaReuseQueue1[sSampleDmaReuseQueueTail1];
+                    sSampleDmas[sSampleDmaReuseQueue1[sSampleDmaReuseQueueTail1]].reuseIndex =
+                        dma->reuseIndex;
+                }
+                sSampleDmaReuseQueueTail1++;
+            }
+            dma->ttl = 2;
+            *dmaIndexRef = (u8) i;
+            return (devAddr - dma->source) + dma->buffer;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Schedules a DMA for the next chunk of a sample before any note actually
+ * needs it. Called from the synthesis driver right after it consumes a chunk
+ * of a non-looped sample; if no live buffer can also hold the following chunk,
+ * the window starting there is fetched now, a full audio update before
+ * playback crosses into it, instead of racing the RSP on the same update.
+ * devAddrEnd bounds the read to the sample, so nothing is fetched past the
+ * last chunk. Best-effort: if no buffer is free the demand path in
+ * dma_sample_data covers it as usual.
+ */
+void prefetch_sample_data(uintptr_t devAddr, u32 size, uintptr_t devAddrEnd) {
+    struct SharedDma *dma;
+    uintptr_t dmaDevAddr = devAddr & ~0xF;
+    ssize_t bufferPos;
+    u32 dmaIndex;
+    u32 i;
+
+    if (devAddr >= devAddrEnd) {
+        return;
+    }
+
+    // Already resident or in flight?
+    for (i = 0; i < gSampleDmaNumListItems; i++) {
+        dma = &sSampleDmas[i];
+        bufferPos = devAddr - dma->source;
+        if (dma->source != 0 && 0 <= bufferPos && (size_t) bufferPos <= dma->bufSize - size) {
+            return;
+        }
+    }
+
+    if (sSampleDmaReuseQueueTail1 == sSampleDmaReuseQueueHead1
+        || gCurrAudioFrameDmaCount >= AUDIO_FRAME_DMA_QUEUE_SIZE) {
+        return;
+    }
+
+    dmaIndex = sSampleDmaReuseQueue1[sSampleDmaReuseQueueTail1++];
+    dma = sSampleDmas + dmaIndex;
+    // TTL 3 outlives the one update of lead time; if the note dies first, the
+    // buffer recycles almost as fast as a demand-fetched one.
+    dma->ttl = 3;
+    dma->source = dmaDevAddr;
+    dma->sizeUnused = dma->bufSize;
+#ifdef VERSION_US
+    osInvalDCache(dma->buffer, dma->bufSize);
+#endif
+#ifdef AUDIO_DMA_BATCHING
+    queue_sample_dma(dmaDevAddr, dma->buffer, dma->bufSize);
+#else
+    osPiStartDma(&gCurrAudioFrameDmaIoMesgBufs[gCurrAudioFrameDmaCount++], OS_MESG_PRI_NORMAL,
+                     OS_READ, dmaDevAddr, dma->buffer, dma->bufSize, &gCurrAudioFrameDmaQueue);
+#endif
+}
+#endif
+
 void *dma_sample_data(uintptr_t devAddr, u32 size, s32 arg2, u8 *dmaIndexRef) {
     s32 hasDma = FALSE;
     struct SharedDma *dma;
@@ -222,6 +382,17 @@ void *dma_sample_data(uintptr_t devAddr, u32 size, s32 arg2, u8 *dmaIndexRef) {
             }
         }
 
+#ifdef AUDIO_SAMPLE_READAHEAD
+        {
+            // A note streaming through the large buffers may cross into a
+            // range that a read ahead already fetched into a small buffer.
+            void *prefetched = sample_dma_readahead_lookup(devAddr, size, dmaIndexRef);
+            if (prefetched != NULL) {
+                return prefetched;
+            }
+        }
+#endif
+
         if (sSampleDmaReuseQueueTail2 != sSampleDmaReuseQueueHead2 && arg2 != 0) {
             // Allocate a DMA from reuse queue 2. This queue can be empty, since
             // TTL 60 is pretty large.
@@ -249,6 +420,16 @@ void *dma_sample_data(uintptr_t devAddr, u32 size, s32 arg2, u8 *dmaIndexRef) {
             dma->ttl = 2;
             return dma->buffer + (devAddr - dma->source);
         }
+#ifdef AUDIO_SAMPLE_READAHEAD
+        else {
+            // The note ran past its window; a read ahead may already hold the
+            // next stretch in one of the large buffers.
+            void *prefetched = sample_dma_readahead_lookup(devAddr, size, dmaIndexRef);
+            if (prefetched != NULL) {
+                return prefetched;
+            }
+        }
+#endif
     }
 
     if (!hasDma) {
@@ -267,8 +448,12 @@ void *dma_sample_data(uintptr_t devAddr, u32 size, s32 arg2, u8 *dmaIndexRef) {
 #ifdef VERSION_US // TODO: Is there a reason this only exists in US?
     osInvalDCache(dma->buffer, transfer);
 #endif
+#ifdef AUDIO_DMA_BATCHING
+    queue_sample_dma(dmaDevAddr, dma->buffer, transfer);
+#else
     osPiStartDma(&gCurrAudioFrameDmaIoMesgBufs[gCurrAudioFrameDmaCount++], OS_MESG_PRI_NORMAL,
                      OS_READ, dmaDevAddr, dma->buffer, transfer, &gCurrAudioFrameDmaQueue);
+#endif
     *dmaIndexRef = dmaIndex;
     return (devAddr - dmaDevAddr) + dma->buffer;
 }
@@ -502,6 +687,118 @@ void patch_audio_bank(struct AudioBank *mem, u8 *offset, u32 numInstruments, u32
 #undef PATCH_SOUND
 }
 
+#if defined(PERSISTENT_BANK_CACHE) && (defined(VERSION_JP) || defined(VERSION_US))
+#define RELOC(x) (x = (void *) ((uintptr_t) (x) + delta))
+
+static void relocate_sound(struct AudioBankSound *sound, s32 delta) {
+    struct AudioBankSample *sample;
+
+    if (sound->sample != NULL) {
+        sample = RELOC(sound->sample);
+        if (sample->loaded == 1) {
+            // sampleAddr points at the ROM sample table and stays put.
+            RELOC(sample->loop);
+            RELOC(sample->book);
+            sample->loaded = 2;
+        }
+    }
+}
+
+/**
+ * Slides every pointer into a bank after the persistent bank cache moves its
+ * data by `delta` bytes during compaction. Mirrors the walk performed by
+ * patch_audio_bank, with the `loaded` fields doubling as visit markers so
+ * samples shared between sounds are only adjusted once.
+ */
+void relocate_audio_bank(s32 bankId, struct AudioBank *mem, s32 delta) {
+    u32 numInstruments = gCtlEntries[bankId].numInstruments;
+    u32 numDrums = gCtlEntries[bankId].numDrums;
+    struct Instrument *instrument;
+    struct Drum *drum;
+    u32 i;
+
+    if (mem->drums != NULL && numDrums > 0) {
+        RELOC(mem->drums);
+        for (i = 0; i < numDrums; i++) {
+            if (mem->drums[i] != NULL) {
+                drum = RELOC(mem->drums[i]);
+                if (drum->loaded == 1) {
+                    relocate_sound(&drum->sound, delta);
+                    RELOC(drum->envelope);
+                    drum->loaded = 2;
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < numInstruments; i++) {
+        if (mem->instruments[i] != NULL) {
+            instrument = RELOC(mem->instruments[i]);
+            if (instrument->loaded == 1) {
+                relocate_sound(&instrument->lowNotesSound, delta);
+                relocate_sound(&instrument->normalNotesSound, delta);
+                relocate_sound(&instrument->highNotesSound, delta);
+                RELOC(instrument->envelope);
+                instrument->loaded = 2;
+            }
+        }
+    }
+
+    // Reset the visit markers.
+    for (i = 0; i < numDrums; i++) {
+        drum = (mem->drums != NULL) ? mem->drums[i] : NULL;
+        if (drum != NULL && drum->loaded == 2) {
+            drum->loaded = 1;
+            if (drum->sound.sample != NULL) {
+                drum->sound.sample->loaded = 1;
+            }
+        }
+    }
+    for (i = 0; i < numInstruments; i++) {
+        instrument = mem->instruments[i];
+        if (instrument != NULL && instrument->loaded == 2) {
+            instrument->loaded = 1;
+            struct AudioBankSound *sounds[3] = {
+                &instrument->lowNotesSound, &instrument->normalNotesSound, &instrument->highNotesSound,
+            };
+            for (u32 j = 0; j < 3; j++) {
+                if (sounds[j]->sample != NULL && sounds[j]->sample->loaded == 2) {
+                    sounds[j]->sample->loaded = 1;
+                }
+            }
+        }
+    }
+
+    gCtlEntries[bankId].instruments = mem->instruments;
+    gCtlEntries[bankId].drums = mem->drums;
+}
+#undef RELOC
+#endif
+
+#ifdef AUDIO_BANK_HEADER_CACHE
+/**
+ * Instrument/drum counts from each bank's ctl header, kept after the first
+ * fetch. The headers sit in ROM and never change, so banks reloaded after
+ * eviction skip the blocking 16-byte DMA and start on the bulk copy at once.
+ */
+static struct {
+    u8 known;
+    u8 numInstruments;
+    u8 numDrums;
+} sBankHeaderCache[0x40];
+
+static void bank_header_fetch(s32 bankId, u32 *numInstruments, u32 *numDrums) {
+    if (!sBankHeaderCache[bankId].known) {
+        audio_dma_copy_immediate((uintptr_t) gAlCtlHeader->seqArray[bankId].offset, dmaTempBuffer, 0x10);
+        sBankHeaderCache[bankId].numInstruments = (u8) dmaTempBuffer[0];
+        sBankHeaderCache[bankId].numDrums = (u8) dmaTempBuffer[1];
+        sBankHeaderCache[bankId].known = TRUE;
+    }
+    *numInstruments = sBankHeaderCache[bankId].numInstruments;
+    *numDrums = sBankHeaderCache[bankId].numDrums;
+}
+#endif
+
 struct AudioBank *bank_load_immediate(s32 bankId, s32 arg1) {
     // (This is broken if the length is 1 (mod 16), but that never happens --
     // it's always divisible by 4.)
@@ -514,9 +811,14 @@ struct AudioBank *bank_load_immediate(s32 bankId, s32 arg1) {
         return NULL;
     }
 
+#ifdef AUDIO_BANK_HEADER_CACHE
+    u32 numInstruments, numDrums;
+    bank_header_fetch(bankId, &numInstruments, &numDrums);
+#else
     audio_dma_copy_immediate((uintptr_t) ctlData, dmaTempBuffer, 0x10);
     u32 numInstruments = dmaTempBuffer[0];
     u32 numDrums = dmaTempBuffer[1];
+#endif
     audio_dma_copy_immediate((uintptr_t)(ctlData + 0x10), ret, alloc);
     patch_audio_bank(ret, gAlTbl->seqArray[bankId].offset, numInstruments, numDrums);
     gCtlEntries[bankId].numInstruments = (u8) numInstruments;
@@ -537,9 +839,14 @@ struct AudioBank *bank_load_async(s32 bankId, s32 arg1, struct SequencePlayer *s
         return NULL;
     }
 
+#ifdef AUDIO_BANK_HEADER_CACHE
+    u32 numInstruments, numDrums;
+    bank_header_fetch(bankId, &numInstruments, &numDrums);
+#else
     audio_dma_copy_immediate((uintptr_t) ctlData, dmaTempBuffer, 0x10);
     u32 numInstruments = dmaTempBuffer[0];
     u32 numDrums = dmaTempBuffer[1];
+#endif
     seqPlayer->loadingBankId = (u8) bankId;
 #if defined(VERSION_EU)
     gCtlEntries[bankId].numInstruments = numInstruments;
@@ -729,6 +1036,16 @@ void preload_sequence(u32 seqId, u8 preloadMask) {
 void load_sequence_internal(u32 player, u32 seqId, s32 loadAsync);
 
 void load_sequence(u32 player, u32 seqId, s32 loadAsync) {
+#if defined(ASYNC_SEQUENCE_LOADING) && (defined(VERSION_JP) || defined(VERSION_US))
+    // Hold the lock across the allocation phase even for async loads: pool
+    // allocation can evict and slide banks (PERSISTENT_BANK_CACHE), which
+    // must not interleave with an audio frame. Only the bulk DMA runs
+    // unlocked, so the lock is held for microseconds instead of the whole
+    // transfer.
+    gAudioLoadLock = AUDIO_LOCK_LOADING;
+    load_sequence_internal(player, seqId, loadAsync);
+    gAudioLoadLock = AUDIO_LOCK_NOT_LOADING;
+#else
     if (!loadAsync) {
         gAudioLoadLock = AUDIO_LOCK_LOADING;
     }
@@ -736,8 +1053,45 @@ void load_sequence(u32 player, u32 seqId, s32 loadAsync) {
     if (!loadAsync) {
         gAudioLoadLock = AUDIO_LOCK_NOT_LOADING;
     }
+#endif
 }
 
+#if defined(ASYNC_SEQUENCE_LOADING) && (defined(VERSION_JP) || defined(VERSION_US))
+/**
+ * Blocks until the player's in-flight bank/sequence DMAs have landed and are
+ * patched in. Starting a new load reuses the DMA bookkeeping fields on the
+ * SequencePlayer, so a still-streaming previous load has to finish first.
+ * Only happens when the music changes twice within a couple of frames.
+ */
+static void wait_for_seq_player_dmas(struct SequencePlayer *seqPlayer) {
+    audio_phase_start(AUDIO_PHASE_DMA_WAIT);
+    if (seqPlayer->bankDmaInProgress) {
+        osRecvMesg(&seqPlayer->bankDmaMesgQueue, NULL, OS_MESG_BLOCK);
+        while (seqPlayer->bankDmaRemaining != 0) {
+            audio_dma_partial_copy_async(&seqPlayer->bankDmaCurrDevAddr, &seqPlayer->bankDmaCurrMemAddr,
+                                         &seqPlayer->bankDmaRemaining, &seqPlayer->bankDmaMesgQueue,
+                                         &seqPlayer->bankDmaIoMesg);
+            osRecvMesg(&seqPlayer->bankDmaMesgQueue, NULL, OS_MESG_BLOCK);
+        }
+        patch_audio_bank(seqPlayer->loadingBank, gAlTbl->seqArray[seqPlayer->loadingBankId].offset,
+                         seqPlayer->loadingBankNumInstruments, seqPlayer->loadingBankNumDrums);
+        gCtlEntries[seqPlayer->loadingBankId].numInstruments = seqPlayer->loadingBankNumInstruments;
+        gCtlEntries[seqPlayer->loadingBankId].numDrums = seqPlayer->loadingBankNumDrums;
+        gCtlEntries[seqPlayer->loadingBankId].instruments = seqPlayer->loadingBank->instruments;
+        gCtlEntries[seqPlayer->loadingBankId].drums = seqPlayer->loadingBank->drums;
+        gBankLoadStatus[seqPlayer->loadingBankId] = SOUND_LOAD_STATUS_COMPLETE;
+        seqPlayer->bankDmaInProgress = FALSE;
+    }
+    if (seqPlayer->seqDmaInProgress) {
+        osRecvMesg(&seqPlayer->seqDmaMesgQueue, NULL, OS_MESG_BLOCK);
+        seqPlayer->seqDmaInProgress = FALSE;
+        // Fully loaded, but nothing is playing it anymore.
+        gSeqLoadStatus[seqPlayer->seqId] = SOUND_LOAD_STATUS_DISCARDABLE;
+    }
+    audio_phase_end(AUDIO_PHASE_DMA_WAIT);
+}
+#endif
+
 void load_sequence_internal(u32 player, u32 seqId, s32 loadAsync) {
     void *sequenceData;
     struct SequencePlayer *seqPlayer = &gSequencePlayers[player];
@@ -747,6 +1101,9 @@ void load_sequence_internal(u32 player, u32 seqId, s32 loadAsync) {
     }
 
     sequence_player_disable(seqPlayer);
+#if defined(ASYNC_SEQUENCE_LOADING) && (defined(VERSION_JP) || defined(VERSION_US))
+    wait_for_seq_player_dmas(seqPlayer);
+#endif
     if (loadAsync) {
         s32 numMissingBanks = 0;
         s32 dummy = 0;
@@ -756,10 +1113,10 @@ void load_sequence_internal(u32 player, u32 seqId, s32 loadAsync) {
             if (bank_load_async(bankId, 2, seqPlayer) == NULL) {
                 return;
             }
-            // @bug This should set the last bank (i.e. the first in the JSON)
-            // as default, not the missing one. This code path never gets
-            // taken, though -- all sequence loading is synchronous.
-            seqPlayer->defaultBank[0] = bankId;
+            // The default bank is the last in the set (i.e. the first in the
+            // JSON), which is not necessarily the bank that was missing.
+            u16 bankSetOffset = ((u16 *) gAlBankSets)[seqId];
+            seqPlayer->defaultBank[0] = gAlBankSets[bankSetOffset + gAlBankSets[bankSetOffset]];
         } else {
             eu_stubbed_printf_1("Sorry,too many %d bank is none.fast load Start \n", numMissingBanks);
             if (load_banks_immediate(seqId, &seqPlayer->defaultBank[0]) == NULL) {
@@ -82,17 +82,26 @@ extern struct UnkStructSH8034EC88 D_SH_8034EC88[0x80];
 
 void audio_dma_partial_copy_async(uintptr_t *devAddr, u8 **vAddr, ssize_t *remaining, OSMesgQueue *queue, OSIoMesg *mesg);
 void decrease_sample_dma_ttls(void);
+#ifdef AUDIO_DMA_BATCHING
+void flush_sample_dmas(void);
+#endif
 #ifdef VERSION_SH
 void *dma_sample_data(uintptr_t devAddr, u32 size, s32 arg2, u8 *dmaIndexRef, s32 medium);
 #else
 void *dma_sample_data(uintptr_t devAddr, u32 size, s32 arg2, u8 *dmaIndexRef);
 #endif
 void init_sample_dma_buffers(s32 arg0);
+#if defined(AUDIO_SAMPLE_READAHEAD) && !defined(VERSION_SH)
+void prefetch_sample_data(uintptr_t devAddr, u32 size, uintptr_t devAddrEnd);
+#endif
 #if defined(VERSION_SH)
 void patch_audio_bank(s32 bankId, struct AudioBank *mem, struct PatchStruct *patchInfo);
 #else
 void patch_audio_bank(struct AudioBank *mem, u8 *offset, u32 numInstruments, u32 numDrums);
 #endif
+#if defined(PERSISTENT_BANK_CACHE) && (defined(VERSION_JP) || defined(VERSION_US))
+void relocate_audio_bank(s32 bankId, struct AudioBank *mem, s32 delta);
+#endif
 #ifdef VERSION_SH
 void preload_sequence(u32 seqId, s32 preloadMask);
 #else
@@ -0,0 +1,142 @@
+#include <ultra64.h>
+#include "pcm_stream.h"
+#include "load.h"
+
+#if defined(HVQM) && defined(HVQM_AUDIO_BRIDGE)
+
+/**
+ * See pcm_stream.h for an overview of the bridge.
+ *
+ * The ring stores interleaved stereo s16 frames at the movie's sampling
+ * rate. The read/write positions are free running u32 frame counters
+ * (same idiom as the profiler history index); each side only writes its
+ * own counter, which keeps the ring safe across the timekeeper and
+ * audio threads without disabling interrupts.
+ */
+
+static s16 sPcmRing[PCM_STREAM_RING_FRAMES][2];
+static vu32 sRingRead = 0;   // Frames consumed by the mixer
+static vu32 sRingWrite = 0;  // Frames pushed by the timekeeper
+static u32 sInputRate = 0;   // Movie sampling rate (Hz)
+static u32 sPhase = 0;       // 16.16 position within the current frame
+static vu32 sConsumed = 0;   // Total input frames consumed (movie clock)
+static vu8 sStreamActive = FALSE;
+
+/**
+ * Begin accepting movie PCM at the given sampling rate. Called from the
+ * timekeeper when playback starts; resets the ring and the movie clock.
+ */
+void pcm_stream_start(u32 sampleRate) {
+    sStreamActive = FALSE;
+    sRingRead = sRingWrite = 0;
+    sPhase = 0;
+    sConsumed = 0;
+    sInputRate = sampleRate;
+    sStreamActive = TRUE;
+}
+
+/**
+ * Stop mixing movie audio. Frames still in the ring are dropped, which
+ * is fine: the timekeeper only stops once the audio stream has drained.
+ */
+void pcm_stream_stop(void) {
+    sStreamActive = FALSE;
+}
+
+/**
+ * Number of stereo frames that can be pushed without overwriting
+ * unplayed data.
+ */
+u32 pcm_stream_space(void) {
+    return PCM_STREAM_RING_FRAMES - (sRingWrite - sRingRead);
+}
+
+/**
+ * Copy interleaved stereo frames into the ring. The caller is expected
+ * to check pcm_stream_space() first; anything that does not fit is
+ * dropped rather than overwriting unplayed audio.
+ */
+void pcm_stream_push(s16 *pcm, u32 frames) {
+    u32 i;
+
+    if (!sStreamActive) {
+        return;
+    }
+    for (i = 0; i < frames; i++) {
+        if (sRingWrite - sRingRead >= PCM_STREAM_RING_FRAMES) {
+            break;
+        }
+        sPcmRing[sRingWrite % PCM_STREAM_RING_FRAMES][0] = pcm[i * 2 + 0];
+        sPcmRing[sRingWrite % PCM_STREAM_RING_FRAMES][1] = pcm[i * 2 + 1];
+        sRingWrite++;
+    }
+}
+
+/**
+ * Total input-rate frames consumed by the mixer since pcm_stream_start.
+ * The timekeeper derives the movie clock from this, the same way the
+ * original player derived it from the AI DA counter.
+ */
+u64 pcm_stream_consumed(void) {
+    return sConsumed;
+}
+
+/**
+ * Resample and mix the ring into an AI buffer of `frames` stereo frames
+ * at the driver's output rate (gAiFrequency). Called on the audio
+ * thread just before the buffer is pushed to the AI, i.e. after the RSP
+ * has finished writing it, so the buffer is invalidated before the
+ * read-modify-write and written back after.
+ *
+ * Resampling is linear interpolation with a 16.16 fixed point step; the
+ * mix is a saturating add on top of the game audio already in place.
+ */
+void pcm_stream_mix(s16 *aiBuf, u32 frames) {
+    u32 step;
+    u32 i;
+
+    if (!sStreamActive || frames == 0 || gAiFrequency <= 0) {
+        return;
+    }
+    step = (sInputRate << 16) / (u32) gAiFrequency;
+
+    osInvalDCache(aiBuf, frames * 2 * sizeof(s16));
+    for (i = 0; i < frames; i++) {
+        u32 avail = sRingWrite - sRingRead;
+        u32 cur;
+        s32 left, right;
+
+        if (avail == 0) {
+            break; // Underrun: leave the rest of the game audio untouched.
+        }
+        cur = sRingRead % PCM_STREAM_RING_FRAMES;
+        if (avail > 1) {
+            u32 next = (sRingRead + 1) % PCM_STREAM_RING_FRAMES;
+            s32 frac = sPhase & 0xFFFF;
+            left  = sPcmRing[cur][0] + (((sPcmRing[next][0] - sPcmRing[cur][0]) * frac) >> 16);
+            right = sPcmRing[cur][1] + (((sPcmRing[next][1] - sPcmRing[cur][1]) * frac) >> 16);
+        } else {
+            left  = sPcmRing[cur][0];
+            right = sPcmRing[cur][1];
+        }
+
+        left  += aiBuf[i * 2 + 0];
+        right += aiBuf[i * 2 + 1];
+        if (left  >  0x7FFF) left  =  0x7FFF;
+        if (left  < -0x8000) left  = -0x8000;
+        if (right >  0x7FFF) right =  0x7FFF;
+        if (right < -0x8000) right = -0x8000;
+        aiBuf[i * 2 + 0] = left;
+        aiBuf[i * 2 + 1] = right;
+
+        sPhase += step;
+        while (sPhase >= 0x10000 && sRingWrite - sRingRead > 0) {
+            sPhase -= 0x10000;
+            sRingRead++;
+            sConsumed++;
+        }
+    }
+    osWritebackDCache(aiBuf, frames * 2 * sizeof(s16));
+}
+
+#endif // HVQM && HVQM_AUDIO_BRIDGE
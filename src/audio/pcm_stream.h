@@ -0,0 +1,49 @@
+#ifndef AUDIO_PCM_STREAM_H
+#define AUDIO_PCM_STREAM_H
+
+#include <PR/ultratypes.h>
+
+#include <HVQM2File.h>
+#include "hvqm/hvqm.h"
+
+/**
+ * Streaming PCM bridge between the HVQM movie player and the main audio
+ * driver (HVQM_AUDIO_BRIDGE, see src/hvqm/hvqm.h).
+ *
+ * Instead of reprogramming the AI and pushing its decoded PCM buffers
+ * directly, the movie timekeeper pushes them into a ring here, and the
+ * audio thread resamples and mixes the ring into each AI buffer right
+ * before it is handed to the AI. The game audio driver keeps ownership
+ * of the AI the whole time, so movie audio starts without an AI
+ * frequency switch and can play on top of game audio.
+ *
+ * The ring is single-producer/single-consumer: only the timekeeper
+ * thread writes PCM and only the audio thread consumes it, so no locks
+ * are needed.
+ */
+
+#if defined(HVQM) && defined(HVQM_AUDIO_BRIDGE)
+
+// Capacity of the bridge ring in stereo sample frames (32 KB, a quarter
+// second at 32 kHz). Must comfortably hold NUM_PCMBUFs decoded records.
+#define PCM_STREAM_RING_FRAMES 8192
+
+void pcm_stream_start(u32 sampleRate);
+void pcm_stream_stop(void);
+u32  pcm_stream_space(void);
+void pcm_stream_push(s16 *pcm, u32 frames);
+u64  pcm_stream_consumed(void);
+void pcm_stream_mix(s16 *aiBuf, u32 frames);
+
+#else
+
+#define pcm_stream_start(sampleRate)
+#define pcm_stream_stop()
+#define pcm_stream_space() 0
+#define pcm_stream_push(pcm, frames)
+#define pcm_stream_consumed() 0
+#define pcm_stream_mix(aiBuf, frames)
+
+#endif // HVQM && HVQM_AUDIO_BRIDGE
+
+#endif // AUDIO_PCM_STREAM_H
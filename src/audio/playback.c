@@ -344,7 +344,6 @@ void process_notes(void) {
     f32 velocity;
 #if defined(VERSION_JP) || defined(VERSION_US)
     f32 pan;
-    f32 cap;
 #endif
 #endif
     struct Note *note;
@@ -377,6 +376,12 @@ void process_notes(void) {
          ? it                                                                                          \
          : (it->prev->next = it->next, it->next->prev = it->prev, it->prev = NULL, it))
 
+#if defined(VERSION_JP) || defined(VERSION_US)
+    // Hoisted out of the per-note loop: the output rate correction is a float
+    // division and is identical for every note this update.
+    f32 aiCorrection = (gAiFrequency != 32006) ? (32000.0f / (f32) gAiFrequency) : 1.0f;
+#endif
+
     for (i = 0; i < gMaxSimultaneousNotes; i++) {
         note = &gNotes[i];
 #if defined(VERSION_EU) || defined(VERSION_SH)
@@ -580,26 +585,24 @@ void process_notes(void) {
 
             adsr_update(&note->adsr);
             note_vibrato_update(note);
-            attributes = &note->attributes;
             if (note->priority == NOTE_PRIORITY_STOPPING) {
+                attributes = &note->attributes;
                 frequency = attributes->freqScale;
                 velocity = attributes->velocity;
                 pan = attributes->pan;
                 reverbVol = attributes->reverbVol;
             } else {
-                frequency = note->parentLayer->noteFreqScale;
-                velocity = note->parentLayer->noteVelocity;
-                pan = note->parentLayer->notePan;
-                reverbVol = note->parentLayer->seqChannel->reverbVol;
+                // Chase the layer/channel chain once rather than per field.
+                struct SequenceChannelLayer *parentLayer = note->parentLayer;
+                frequency = parentLayer->noteFreqScale;
+                velocity = parentLayer->noteVelocity;
+                pan = parentLayer->notePan;
+                reverbVol = parentLayer->seqChannel->reverbVol;
             }
 
             scale = note->adsrVolScale;
-            frequency *= note->vibratoFreqScale * note->portamentoFreqScale;
-            cap = 3.99992f;
-            if (gAiFrequency != 32006) {
-                frequency *= (32000.0f / (f32) gAiFrequency);
-            }
-            frequency = (frequency < cap ? frequency : cap);
+            frequency *= note->vibratoFreqScale * note->portamentoFreqScale * aiCorrection;
+            frequency = (frequency < 3.99992f ? frequency : 3.99992f);
             scale *= 4.3498e-5f; // ~1 / 23000
             velocity = velocity * scale * scale;
             note_set_frequency(note, frequency);
@@ -1400,6 +1403,63 @@ void reclaim_notes(void) {
 }
 #endif
 
+#if defined(AUDIO_VOICE_BUDGET) && (defined(VERSION_JP) || defined(VERSION_US))
+u32 gAudioVoicesInUse = 0;
+u32 gAudioVoicesDropped = 0;
+u32 gAudioCmdsLastFrame = 0;
+
+/**
+ * Counts the notes that will be rendered this update and, while the count
+ * exceeds AUDIO_VOICE_BUDGET, releases the quietest stealable one. The RSP
+ * synthesis time grows with every rendered note, and overrunning the audio
+ * time slice produces crackle; a voice buried under the rest of the mix is
+ * the cheapest thing to give up. Volume (which already folds in distance
+ * attenuation from the sound engine) picks the victim, with note priority
+ * breaking ties. Released notes fade out through their normal ADSR release
+ * rather than cutting off, so they still render for a few more updates - the
+ * budget is a target, not a hard cap.
+ */
+void audio_voice_budget_update(void) {
+    struct Note *note;
+    struct Note *quietest;
+    u32 volume;
+    u32 quietestVolume = 0;
+    s32 inUse = 0;
+    s32 i;
+
+    for (i = 0; i < gMaxSimultaneousNotes; i++) {
+        if (gNotes[i].enabled) {
+            inUse++;
+        }
+    }
+    gAudioVoicesInUse = inUse;
+
+    while (inUse > AUDIO_VOICE_BUDGET) {
+        quietest = NULL;
+        for (i = 0; i < gMaxSimultaneousNotes; i++) {
+            note = &gNotes[i];
+            // Only consider notes still owned by a layer; ones already fading
+            // out will free themselves shortly anyway.
+            if (!note->enabled || note->parentLayer == NO_LAYER
+                || note->priority <= NOTE_PRIORITY_STOPPING) {
+                continue;
+            }
+            volume = ((u32) (note->targetVolLeft + note->targetVolRight) << 8) + note->priority;
+            if (quietest == NULL || volume < quietestVolume) {
+                quietest = note;
+                quietestVolume = volume;
+            }
+        }
+        if (quietest == NULL) {
+            break;
+        }
+        seq_channel_layer_note_release(quietest->parentLayer);
+        gAudioVoicesDropped++;
+        inUse--;
+    }
+}
+#endif
+
 void note_init_all(void) {
     struct Note *note;
     s32 i;
@@ -30,6 +30,13 @@ void audio_list_push_front(struct AudioListItem *list, struct AudioListItem *ite
 void audio_list_remove(struct AudioListItem *item);
 struct Note *alloc_note(struct SequenceChannelLayer *seqLayer);
 void reclaim_notes(void);
+#if defined(AUDIO_VOICE_BUDGET) && (defined(VERSION_JP) || defined(VERSION_US))
+// Per-frame synthesis workload accounting; see AUDIO_VOICE_BUDGET.
+extern u32 gAudioVoicesInUse;
+extern u32 gAudioVoicesDropped;
+extern u32 gAudioCmdsLastFrame;
+void audio_voice_budget_update(void);
+#endif
 void note_init_all(void);
 
 #if defined(VERSION_SH)
@@ -77,6 +77,9 @@ void sequence_channel_init(struct SequenceChannel *seqChannel) {
     seqChannel->volumeScale = 1.0f;
     seqChannel->freqScale = 1.0f;
 #endif
+#if defined(CHANNEL_GROUP_DUCKING) && (defined(VERSION_JP) || defined(VERSION_US))
+    seqChannel->duckScale = 1.0f;
+#endif
 
     for (i = 0; i < 8; i++) {
         seqChannel->soundScriptIO[i] = -1;
@@ -2670,9 +2673,106 @@ void sequence_player_process_sequence(struct SequencePlayer *seqPlayer) {
     }
 }
 
+#if defined(CHANNEL_GROUP_DUCKING) && (defined(VERSION_JP) || defined(VERSION_US))
+
+// A set of one sequence player's channels ducked together by an envelope the
+// audio thread evaluates itself; the game thread only changes the target.
+struct ChannelDuckGroup {
+    u16 channelMask;
+    u8 player;
+    u16 remainingUpdates;
+    f32 current;
+    f32 target;
+    f32 velocity; // per audio update
+};
+static struct ChannelDuckGroup sChannelDuckGroups[CHANNEL_DUCK_GROUPS];
+
+/**
+ * Assign a set of a sequence player's channels to a duck group. Runs on the
+ * audio thread; the game thread entry point is music_duck_group_config.
+ */
+void seq_channel_duck_config(u8 group, u8 player, u16 channelMask) {
+    struct ChannelDuckGroup *duckGroup;
+
+    if (group >= CHANNEL_DUCK_GROUPS || player >= SEQUENCE_PLAYERS) {
+        return;
+    }
+    duckGroup = &sChannelDuckGroups[group];
+    if (duckGroup->channelMask == 0) {
+        // Freshly configured groups start transparent.
+        duckGroup->current = 1.0f;
+        duckGroup->target = 1.0f;
+        duckGroup->remainingUpdates = 0;
+    }
+    duckGroup->player = player;
+    duckGroup->channelMask = channelMask;
+}
+
+/**
+ * Ramp a duck group toward targetScale (0..127 like the other volume scales)
+ * over rampUpdates audio updates; 0 snaps immediately. Runs on the audio
+ * thread; the game thread entry point is music_duck_group_set.
+ */
+void seq_channel_duck_set(u8 group, u8 targetScale, u16 rampUpdates) {
+    struct ChannelDuckGroup *duckGroup;
+
+    if (group >= CHANNEL_DUCK_GROUPS) {
+        return;
+    }
+    duckGroup = &sChannelDuckGroups[group];
+    duckGroup->target = FLOAT_CAST(targetScale) / 127.0f;
+    if (rampUpdates == 0) {
+        duckGroup->current = duckGroup->target;
+        duckGroup->remainingUpdates = 0;
+    } else {
+        duckGroup->velocity = (duckGroup->target - duckGroup->current) / rampUpdates;
+        duckGroup->remainingUpdates = rampUpdates;
+    }
+}
+
+/**
+ * Step each duck group's envelope and write the resulting scale to its
+ * channels. The scale is rewritten every update (not only while ramping) so
+ * channels that were reinitialized by a sequence change pick the duck state
+ * back up; unconfigured groups cost one compare each.
+ */
+static void sequence_player_update_duck_groups(void) {
+    s32 i;
+    s32 j;
+
+    for (i = 0; i < CHANNEL_DUCK_GROUPS; i++) {
+        struct ChannelDuckGroup *duckGroup = &sChannelDuckGroups[i];
+        struct SequencePlayer *seqPlayer;
+
+        if (duckGroup->channelMask == 0) {
+            continue;
+        }
+
+        if (duckGroup->remainingUpdates != 0) {
+            duckGroup->current += duckGroup->velocity;
+            if (--duckGroup->remainingUpdates == 0) {
+                duckGroup->current = duckGroup->target;
+            }
+        }
+
+        seqPlayer = &gSequencePlayers[duckGroup->player];
+        for (j = 0; j < CHANNELS_MAX; j++) {
+            if ((duckGroup->channelMask & (1 << j))
+             && seqPlayer->channels[j] != &gSequenceChannelNone) {
+                seqPlayer->channels[j]->duckScale = duckGroup->current;
+            }
+        }
+    }
+}
+
+#endif // CHANNEL_GROUP_DUCKING
+
 // This runs 240 times per second.
 void process_sequences(UNUSED s32 iterationsRemaining) {
     s32 i;
+#if defined(CHANNEL_GROUP_DUCKING) && (defined(VERSION_JP) || defined(VERSION_US))
+    sequence_player_update_duck_groups();
+#endif
     for (i = 0; i < SEQUENCE_PLAYERS; i++) {
         if (gSequencePlayers[i].enabled == TRUE) {
 #if defined(VERSION_EU) || defined(VERSION_SH)
@@ -2686,6 +2786,9 @@ void process_sequences(UNUSED s32 iterationsRemaining) {
     }
 #if defined(VERSION_JP) || defined(VERSION_US)
     reclaim_notes();
+#ifdef AUDIO_VOICE_BUDGET
+    audio_voice_budget_update();
+#endif
 #endif
     process_notes();
 }
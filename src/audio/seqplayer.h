@@ -22,6 +22,10 @@ void sequence_channel_disable(struct SequenceChannel *seqPlayer);
 void sequence_player_disable(struct SequencePlayer* seqPlayer);
 void audio_list_push_back(struct AudioListItem *list, struct AudioListItem *item);
 void *audio_list_pop_back(struct AudioListItem *list);
+#if defined(CHANNEL_GROUP_DUCKING) && (defined(VERSION_JP) || defined(VERSION_US))
+void seq_channel_duck_config(u8 group, u8 player, u16 channelMask);
+void seq_channel_duck_set(u8 group, u8 targetScale, u16 rampUpdates);
+#endif
 void process_sequences(s32 iterationsRemaining);
 void init_sequence_player(u32 player);
 void init_sequence_players(void);
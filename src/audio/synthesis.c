@@ -598,11 +598,15 @@ u64 *synthesis_execute(u64 *cmdBuf, s32 *writtenCmds, s16 *aiBuf, s32 bufLen) {
                 chunkLen += 8;
             }
         }
+        audio_phase_start(AUDIO_PHASE_SEQUENCES);
         process_sequences(i - 1);
+        audio_phase_end(AUDIO_PHASE_SEQUENCES);
+        audio_phase_start(AUDIO_PHASE_SYNTHESIS);
         if (gSynthesisReverb.useReverb != 0) {
             prepare_reverb_ring_buffer(chunkLen, gAudioUpdatesPerFrame - i);
         }
         cmd = synthesis_do_one_audio_update((s16 *) aiBufPtr, chunkLen, cmd, gAudioUpdatesPerFrame - i);
+        audio_phase_end(AUDIO_PHASE_SYNTHESIS);
         bufLen -= chunkLen;
         aiBufPtr += chunkLen;
     }
@@ -1091,6 +1095,15 @@ u64 *synthesis_process_notes(s16 *aiBuf, s32 bufLen, u64 *cmd) {
                             v0_2 = dma_sample_data(
                                 (uintptr_t) (sampleAddr + temp * 9),
                                 t0 * 9, flags, &note->sampleDmaIndex);
+#ifdef AUDIO_SAMPLE_READAHEAD
+                            if (loopInfo->count == 0) {
+                                // Non-looped samples play straight through, so the
+                                // stretch after this chunk is needed next; start
+                                // fetching it while this one plays.
+                                prefetch_sample_data((uintptr_t) (sampleAddr + (temp + t0) * 9), t0 * 9,
+                                                     (uintptr_t) (sampleAddr + ((endPos + 0xF) / 16) * 9));
+                            }
+#endif
 #endif
                             a3 = (u32)((uintptr_t) v0_2 & 0xf);
                             aSetBuffer(cmd++, 0, DMEM_ADDR_COMPRESSED_ADPCM_DATA, 0, t0 * 9 + a3);
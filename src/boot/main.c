@@ -11,6 +11,7 @@
 #include "buffers/buffers.h"
 #include "segments.h"
 #include "game/main.h"
+#include "engine/surface_load.h"
 #include "game/rumble_init.h"
 #include "game/version.h"
 #ifdef UNF
@@ -20,6 +21,8 @@
 #include "game/puppyprint.h"
 #include "game/puppylights.h"
 #include "game/profiling.h"
+#include "game/hot_reload.h"
+#include "game/debug_commands.h"
 
 // Message IDs
 enum MessageIDs {
@@ -310,6 +313,8 @@ void thread3_main(UNUSED void *arg) {
 
 #ifdef UNF
     debug_initialize();
+    hot_reload_init();
+    debug_commands_init();
 #endif
 
 #ifdef DEBUG
@@ -327,6 +332,11 @@ void thread3_main(UNUSED void *arg) {
     create_thread(&gGameLoopThread, THREAD_5_GAME_LOOP, thread5_game_loop, NULL, gThread5Stack + 0x2000, 10);
     osStartThread(&gGameLoopThread);
 
+    create_segment_loader_thread();
+#ifdef ASYNC_TERRAIN_LOADING
+    create_terrain_worker_thread();
+#endif
+
     while (TRUE) {
         OSMesg msg;
         osRecvMesg(&gIntrMesgQueue, &msg, OS_MESG_BLOCK);
@@ -12,7 +12,7 @@
 #ifdef GZIP
 #include <gzip.h>
 #endif
-#if defined(RNC1) || defined(RNC2)
+#if defined(RNC1) || defined(RNC2) || defined(MULTI_CODEC)
 #include <rnc.h>
 #endif
 #ifdef UNF
@@ -20,6 +20,7 @@
 #include "usb/debug.h"
 #endif
 #include "game/puppyprint.h"
+#include "game/frame_stats.h"
 
 
 // round up to the next multiple
@@ -37,6 +38,7 @@ struct MainPoolState {
 struct MainPoolBlock {
     struct MainPoolBlock *prev;
     struct MainPoolBlock *next;
+    u8 tag; // owning subsystem (enum MemTag); the header stride is 16 regardless
 };
 
 struct MemoryBlock {
@@ -46,6 +48,10 @@ struct MemoryBlock {
 
 struct MemoryPool {
     u32 totalSpace;
+#if PUPPYPRINT_DEBUG
+    u32 usedSpace;
+    u32 peakSpace;
+#endif
     struct MemoryBlock *firstBlock;
     struct MemoryBlock freeList;
 };
@@ -75,6 +81,33 @@ struct MainPoolBlock *sPoolListHeadR;
 
 static struct MainPoolState *gMainPoolState = NULL;
 
+static void segment_prefetch_reset(void);
+#ifdef MENU_SEGMENT_CACHE
+static u8 *segment_cache_lookup(u8 *srcStart, u8 *srcEnd);
+#endif
+
+#if PUPPYPRINT_DEBUG
+/**
+ * Per-subsystem main pool accounting. Each allocation is stamped with the
+ * current gMemTag (set via MEM_TAG around allocating code) and counted,
+ * header included, so pool sizes can be tuned from real watermarks.
+ */
+u8 gMemTag = MEM_TAG_OTHER;
+u32 gMemTagUsage[MEM_TAG_COUNT];
+u32 gMemTagPeak[MEM_TAG_COUNT];
+
+static void mem_tag_add(u8 tag, u32 size) {
+    gMemTagUsage[tag] += size;
+    if (gMemTagUsage[tag] > gMemTagPeak[tag]) {
+        gMemTagPeak[tag] = gMemTagUsage[tag];
+    }
+}
+
+static void mem_tag_sub(u8 tag, u32 size) {
+    gMemTagUsage[tag] -= size;
+}
+#endif
+
 uintptr_t set_segment_base_addr(s32 segment, void *addr) {
     sSegmentTable[segment] = ((uintptr_t) addr & 0x1FFFFFFF);
     return sSegmentTable[segment];
@@ -118,6 +151,397 @@ void move_segment_table_to_dmem(void) {
 }
 #endif
 
+#ifdef MAIN_POOL_COALESCING
+
+/**
+ * Alternate main pool backend: a segregated-fit free list heap with boundary
+ * coalescing behind the vanilla API. Blocks carry a 16 byte header like the
+ * bump allocator; free blocks keep their list links in the payload, so the
+ * minimum block is 32 bytes. main_pool_free releases exactly the given block
+ * and merges it with free physical neighbors, instead of discarding every
+ * newer block on its side. push/pop state is emulated by tagging each
+ * allocation with the current push depth and sweeping the heap on pop.
+ */
+struct HeapBlock {
+    u32 size;   // total block size in bytes, header included; multiple of 16
+    u8 isFree;
+    u8 epoch;   // main_pool_push_state depth this block was allocated at
+    u8 tag;     // owning subsystem (enum MemTag); only meaningful while in use
+    u8 filler;
+    struct HeapBlock *physPrev; // previous block in address order
+};
+
+// Free list links, stored in the payload of free blocks.
+struct HeapFreeLinks {
+    struct HeapBlock *next;
+    struct HeapBlock *prev;
+};
+
+#define HEAP_NUM_CLASSES 20
+#define HEAP_MIN_BLOCK 32
+#define HEAP_LINKS(block) ((struct HeapFreeLinks *) ((struct HeapBlock *) (block) + 1))
+#define HEAP_PHYS_NEXT(block) ((struct HeapBlock *) ((u8 *) (block) + (block)->size))
+#define HEAP_END() ((struct HeapBlock *) sPoolEnd)
+
+static struct HeapBlock *sHeapFreeLists[HEAP_NUM_CLASSES];
+static u8 sHeapEpoch = 0;
+
+// Size class of a block: log2 of (size / HEAP_MIN_BLOCK), capped to the last class.
+static s32 heap_size_class(u32 size) {
+    s32 sizeClass = 31 - __builtin_clz(size / HEAP_MIN_BLOCK);
+    return MIN(sizeClass, HEAP_NUM_CLASSES - 1);
+}
+
+static void heap_insert_free(struct HeapBlock *block) {
+    struct HeapFreeLinks *links = HEAP_LINKS(block);
+
+    block->isFree = TRUE;
+    links->next = sHeapFreeLists[heap_size_class(block->size)];
+    links->prev = NULL;
+    if (links->next != NULL) {
+        HEAP_LINKS(links->next)->prev = block;
+    }
+    sHeapFreeLists[heap_size_class(block->size)] = block;
+    sPoolFreeSpace += block->size;
+}
+
+static void heap_remove_free(struct HeapBlock *block) {
+    struct HeapFreeLinks *links = HEAP_LINKS(block);
+
+    if (links->prev != NULL) {
+        HEAP_LINKS(links->prev)->next = links->next;
+    } else {
+        sHeapFreeLists[heap_size_class(block->size)] = links->next;
+    }
+    if (links->next != NULL) {
+        HEAP_LINKS(links->next)->prev = links->prev;
+    }
+    block->isFree = FALSE;
+    sPoolFreeSpace -= block->size;
+}
+
+/**
+ * Find a free block of at least 'size' bytes. The matching class may hold
+ * smaller blocks and is scanned; any block in a higher class is guaranteed
+ * large enough, so its head is taken directly.
+ */
+static struct HeapBlock *heap_find_fit(u32 size) {
+    s32 sizeClass = heap_size_class(size);
+    struct HeapBlock *block = sHeapFreeLists[sizeClass];
+
+    while (block != NULL && block->size < size) {
+        block = HEAP_LINKS(block)->next;
+    }
+    while (block == NULL && ++sizeClass < HEAP_NUM_CLASSES) {
+        block = sHeapFreeLists[sizeClass];
+    }
+    return block;
+}
+
+/**
+ * Free a block, merging it with free physical neighbors. Returns the start of
+ * the merged block.
+ */
+static struct HeapBlock *heap_free_block(struct HeapBlock *block) {
+    struct HeapBlock *next = HEAP_PHYS_NEXT(block);
+    struct HeapBlock *prev = block->physPrev;
+
+    if (next < HEAP_END() && next->isFree) {
+        heap_remove_free(next);
+        block->size += next->size;
+        next = HEAP_PHYS_NEXT(block);
+    }
+    if (prev != NULL && prev->isFree) {
+        heap_remove_free(prev);
+        prev->size += block->size;
+        block = prev;
+    }
+    if (next < HEAP_END()) {
+        next->physPrev = block;
+    }
+    heap_insert_free(block);
+    return block;
+}
+
+/**
+ * Initialize the main memory pool as one free block spanning the whole region.
+ */
+void main_pool_init(void *start, void *end) {
+    struct HeapBlock *block;
+    s32 i;
+
+    sPoolStart = (u8 *) ALIGN16((uintptr_t) start) + 16;
+    sPoolEnd = (u8 *) ALIGN16((uintptr_t) end - 15) - 16;
+    sPoolFreeSpace = 0;
+    sHeapEpoch = 0;
+    for (i = 0; i < HEAP_NUM_CLASSES; i++) {
+        sHeapFreeLists[i] = NULL;
+    }
+
+    block = (struct HeapBlock *) (sPoolStart - 16);
+    block->size = sPoolEnd - (u8 *) block;
+    block->epoch = 0;
+    block->physPrev = NULL;
+    heap_insert_free(block);
+#if PUPPYPRINT_DEBUG
+    mempool = sPoolFreeSpace;
+#endif
+}
+
+/**
+ * Allocate a block of memory from the pool of given size. The side only
+ * selects which end of the chosen free block is carved off, mirroring the
+ * vanilla left/right placement. If there is not enough space, return NULL.
+ */
+void *main_pool_alloc(u32 size, u32 side) {
+    struct HeapBlock *block;
+    struct HeapBlock *next;
+    u32 blockSize;
+
+    if (size == 0) {
+        return NULL;
+    }
+    blockSize = ALIGN16(size) + 16;
+    block = heap_find_fit(blockSize);
+    if (block == NULL) {
+        return NULL;
+    }
+    heap_remove_free(block);
+
+    if (block->size - blockSize >= HEAP_MIN_BLOCK) {
+        if (side == MEMORY_POOL_LEFT) {
+            // Carve the used block from the low end; the remainder stays free.
+            struct HeapBlock *rest = (struct HeapBlock *) ((u8 *) block + blockSize);
+            rest->size = block->size - blockSize;
+            rest->physPrev = block;
+            block->size = blockSize;
+            next = HEAP_PHYS_NEXT(rest);
+            if (next < HEAP_END()) {
+                next->physPrev = rest;
+            }
+            heap_insert_free(rest);
+        } else {
+            // Carve from the high end.
+            u32 restSize = block->size - blockSize;
+            struct HeapBlock *used = (struct HeapBlock *) ((u8 *) block + restSize);
+            block->size = restSize;
+            used->size = blockSize;
+            used->physPrev = block;
+            next = HEAP_PHYS_NEXT(used);
+            if (next < HEAP_END()) {
+                next->physPrev = used;
+            }
+            heap_insert_free(block);
+            block = used;
+        }
+    }
+    block->isFree = FALSE;
+    block->epoch = sHeapEpoch;
+#if PUPPYPRINT_DEBUG
+    block->tag = gMemTag;
+    mem_tag_add(gMemTag, block->size);
+#endif
+    FRAME_STAT_ADD(FRAME_STAT_POOL_BYTES, block->size);
+    return (u8 *) block + 16;
+}
+
+/**
+ * Free the given block (and only it), coalescing with free neighbors.
+ * Return the amount of free space left in the pool.
+ */
+u32 main_pool_free(void *addr) {
+    struct HeapBlock *block = (struct HeapBlock *) ((u8 *) addr - 16);
+
+#if PUPPYPRINT_DEBUG
+    mem_tag_sub(block->tag, block->size);
+#endif
+    heap_free_block(block);
+    return sPoolFreeSpace;
+}
+
+/**
+ * Resize a block in place: shrinking returns the tail to the heap, growing
+ * absorbs a free physical neighbor when possible. The block does not move;
+ * if it can't grow in place, return NULL like the vanilla allocator.
+ */
+void *main_pool_realloc(void *addr, u32 size) {
+    struct HeapBlock *block = (struct HeapBlock *) ((u8 *) addr - 16);
+    struct HeapBlock *next = HEAP_PHYS_NEXT(block);
+    u32 blockSize = ALIGN16(size) + 16;
+#if PUPPYPRINT_DEBUG
+    u32 oldSize = block->size;
+#endif
+
+    if (blockSize > block->size) {
+        if (next >= HEAP_END() || !next->isFree || (block->size + next->size) < blockSize) {
+            return NULL;
+        }
+        heap_remove_free(next);
+        block->size += next->size;
+        next = HEAP_PHYS_NEXT(block);
+        if (next < HEAP_END()) {
+            next->physPrev = block;
+        }
+    }
+    if (block->size - blockSize >= HEAP_MIN_BLOCK) {
+        struct HeapBlock *rest = (struct HeapBlock *) ((u8 *) block + blockSize);
+        rest->size = block->size - blockSize;
+        rest->physPrev = block;
+        rest->isFree = FALSE;
+        block->size = blockSize;
+        next = HEAP_PHYS_NEXT(rest);
+        if (next < HEAP_END()) {
+            next->physPrev = rest;
+        }
+        heap_free_block(rest);
+    }
+#if PUPPYPRINT_DEBUG
+    if (block->size > oldSize) {
+        mem_tag_add(block->tag, block->size - oldSize);
+    } else {
+        mem_tag_sub(block->tag, oldSize - block->size);
+    }
+#endif
+    return addr;
+}
+
+/**
+ * Grow a block in place if possible, without ever freeing or moving it.
+ * A request the block already covers succeeds immediately; an actual grow
+ * absorbs a free physical neighbor like main_pool_realloc. Return addr on
+ * success, NULL if the block would have to move.
+ */
+void *main_pool_try_grow(void *addr, u32 size) {
+    struct HeapBlock *block = (struct HeapBlock *) ((u8 *) addr - 16);
+
+    if ((ALIGN16(size) + 16) <= block->size) {
+        return addr;
+    }
+    return main_pool_realloc(addr, size);
+}
+
+/**
+ * Return the size of the largest block that can currently be allocated from the
+ * pool.
+ */
+u32 main_pool_available(void) {
+    u32 largest = 0;
+    s32 sizeClass;
+    struct HeapBlock *block;
+
+    for (sizeClass = 0; sizeClass < HEAP_NUM_CLASSES; sizeClass++) {
+        for (block = sHeapFreeLists[sizeClass]; block != NULL; block = HEAP_LINKS(block)->next) {
+            if (block->size > largest) {
+                largest = block->size;
+            }
+        }
+    }
+    return (largest < HEAP_MIN_BLOCK) ? 0 : (largest - 16);
+}
+
+/**
+ * Push pool state: all blocks allocated from now on are tagged with the new
+ * depth and released together by the matching pop. Return the amount of free
+ * space left in the pool.
+ */
+u32 main_pool_push_state(void) {
+    struct MainPoolState *prevState = gMainPoolState;
+
+    gMainPoolState = main_pool_alloc(sizeof(*gMainPoolState), MEMORY_POOL_LEFT);
+    gMainPoolState->prev = prevState;
+    sHeapEpoch++;
+    return sPoolFreeSpace;
+}
+
+/**
+ * Restore pool state from a previous call to main_pool_push_state, sweeping
+ * every block allocated since then. Return the amount of free space left in
+ * the pool.
+ */
+u32 main_pool_pop_state(void) {
+    struct HeapBlock *block = (struct HeapBlock *) (sPoolStart - 16);
+    struct MainPoolState *state = gMainPoolState;
+
+    segment_prefetch_reset();
+    while (block < HEAP_END()) {
+        struct HeapBlock *next = HEAP_PHYS_NEXT(block);
+        if (!block->isFree && block->epoch == sHeapEpoch) {
+#if PUPPYPRINT_DEBUG
+            mem_tag_sub(block->tag, block->size);
+#endif
+            // Skip past the merged result; its start may lie before 'block'.
+            struct HeapBlock *merged = heap_free_block(block);
+            next = HEAP_PHYS_NEXT(merged);
+        }
+        block = next;
+    }
+    sHeapEpoch--;
+    // The state record itself was allocated just before the depth increase.
+    gMainPoolState = state->prev;
+    main_pool_free(state);
+    return sPoolFreeSpace;
+}
+
+/**
+ * Allocate with a payload alignment stricter than 16 (TLB mapped segments).
+ * The gap in front of the aligned block is returned to the heap.
+ */
+static void *main_pool_alloc_aligned(u32 size, u32 alignment, u32 side) {
+    struct HeapBlock *block;
+    struct HeapBlock *used;
+    struct HeapBlock *next;
+    u8 *blockEnd;
+    u8 *payload;
+    u32 blockSize;
+
+    if (alignment <= 16) {
+        return main_pool_alloc(size, side);
+    }
+    blockSize = ALIGN16(size) + 16;
+    // The front gap needs room for a free block of its own (>= 48 guarantees it).
+    block = heap_find_fit(blockSize + alignment + 48);
+    if (block == NULL) {
+        return NULL;
+    }
+    heap_remove_free(block);
+    blockEnd = (u8 *) block + block->size;
+
+    payload = (u8 *) ALIGN(((uintptr_t) block + 48), alignment);
+    used = (struct HeapBlock *) (payload - 16);
+    used->size = blockEnd - (u8 *) used;
+    used->physPrev = block;
+    block->size = (u8 *) used - (u8 *) block;
+    heap_insert_free(block);
+
+    // Return any tail surplus. The next physical block is in use (free blocks
+    // are always fully coalesced), so no merge is needed here.
+    if (used->size - blockSize >= HEAP_MIN_BLOCK) {
+        struct HeapBlock *rest = (struct HeapBlock *) ((u8 *) used + blockSize);
+        rest->size = used->size - blockSize;
+        rest->physPrev = used;
+        used->size = blockSize;
+        next = HEAP_PHYS_NEXT(rest);
+        if (next < HEAP_END()) {
+            next->physPrev = rest;
+        }
+        heap_insert_free(rest);
+    } else {
+        next = HEAP_PHYS_NEXT(used);
+        if (next < HEAP_END()) {
+            next->physPrev = used;
+        }
+    }
+    used->isFree = FALSE;
+    used->epoch = sHeapEpoch;
+#if PUPPYPRINT_DEBUG
+    used->tag = gMemTag;
+    mem_tag_add(gMemTag, used->size);
+#endif
+    return payload;
+}
+
+#else // !MAIN_POOL_COALESCING
+
 /**
  * Initialize the main memory pool. This pool is conceptually a pair of stacks
  * that grow inward from the left and right. It therefore only supports
@@ -166,6 +590,11 @@ void *main_pool_alloc(u32 size, u32 side) {
             sPoolListHeadR = newListHead;
             addr = (u8 *) sPoolListHeadR + 16;
         }
+#if PUPPYPRINT_DEBUG
+        ((struct MainPoolBlock *) ((u8 *) addr - 16))->tag = gMemTag;
+        mem_tag_add(gMemTag, size);
+#endif
+        FRAME_STAT_ADD(FRAME_STAT_POOL_BYTES, size);
     }
     return addr;
 }
@@ -179,8 +608,17 @@ void *main_pool_alloc(u32 size, u32 side) {
 u32 main_pool_free(void *addr) {
     struct MainPoolBlock *block = (struct MainPoolBlock *) ((u8 *) addr - 16);
     struct MainPoolBlock *oldListHead = (struct MainPoolBlock *) ((u8 *) addr - 16);
+#if PUPPYPRINT_DEBUG
+    struct MainPoolBlock *b;
+#endif
 
     if (oldListHead < sPoolListHeadL) {
+#if PUPPYPRINT_DEBUG
+        // Every block from this one to the list head is released.
+        for (b = block; b->next != NULL; b = b->next) {
+            mem_tag_sub(b->tag, (u8 *) b->next - (u8 *) b);
+        }
+#endif
         while (oldListHead->next != NULL) {
             oldListHead = oldListHead->next;
         }
@@ -191,89 +629,617 @@ u32 main_pool_free(void *addr) {
         while (oldListHead->prev != NULL) {
             oldListHead = oldListHead->prev;
         }
-        sPoolListHeadR = block->next;
-        sPoolListHeadR->prev = NULL;
-        sPoolFreeSpace += (uintptr_t) sPoolListHeadR - (uintptr_t) oldListHead;
+#if PUPPYPRINT_DEBUG
+        // Every block from the list head up to and including this one is released.
+        for (b = oldListHead; b != block->next; b = b->next) {
+            mem_tag_sub(b->tag, (u8 *) b->next - (u8 *) b);
+        }
+#endif
+        sPoolListHeadR = block->next;
+        sPoolListHeadR->prev = NULL;
+        sPoolFreeSpace += (uintptr_t) sPoolListHeadR - (uintptr_t) oldListHead;
+    }
+    return sPoolFreeSpace;
+}
+
+/**
+ * Resize a block of memory that was allocated from the left side of the pool,
+ * in place. The block must be the most recently allocated block from the left
+ * side: only then is the space above it free to grow into or hand the shrunk
+ * tail back to. The block does not move.
+ */
+void *main_pool_realloc(void *addr, u32 size) {
+    struct MainPoolBlock *block = (struct MainPoolBlock *) ((u8 *) addr - 16);
+    struct MainPoolBlock *newListHead;
+    u32 newSize = ALIGN16(size) + 16;
+    u32 oldSize;
+
+    if (block->next != sPoolListHeadL) {
+        return NULL;
+    }
+    oldSize = (u8 *) block->next - (u8 *) block;
+    if (newSize > oldSize) {
+        if (sPoolFreeSpace < (newSize - oldSize)) {
+            return NULL;
+        }
+        sPoolFreeSpace -= (newSize - oldSize);
+#if PUPPYPRINT_DEBUG
+        mem_tag_add(block->tag, newSize - oldSize);
+#endif
+    } else {
+        sPoolFreeSpace += (oldSize - newSize);
+#if PUPPYPRINT_DEBUG
+        mem_tag_sub(block->tag, oldSize - newSize);
+#endif
+    }
+    newListHead = (struct MainPoolBlock *) ((u8 *) block + newSize);
+    block->next = newListHead;
+    newListHead->prev = block;
+    newListHead->next = NULL;
+    sPoolListHeadL = newListHead;
+    return addr;
+}
+
+/**
+ * Grow a block in place if possible, without ever freeing or moving it.
+ * A request the block already covers succeeds for any block; an actual grow
+ * needs the free space above the newest left-side block. Return addr on
+ * success, NULL if the block would have to move.
+ */
+void *main_pool_try_grow(void *addr, u32 size) {
+    struct MainPoolBlock *block = (struct MainPoolBlock *) ((u8 *) addr - 16);
+    u32 newSize = ALIGN16(size) + 16;
+    u32 oldSize = (u8 *) block->next - (u8 *) block;
+
+    if (newSize <= oldSize) {
+        return addr;
+    }
+    if (block->next != sPoolListHeadL) {
+        return NULL;
+    }
+    return main_pool_realloc(addr, size);
+}
+
+/**
+ * Return the size of the largest block that can currently be allocated from the
+ * pool.
+ */
+u32 main_pool_available(void) {
+    return sPoolFreeSpace - 16;
+}
+
+/**
+ * Push pool state, to be restored later. Return the amount of free space left
+ * in the pool.
+ */
+u32 main_pool_push_state(void) {
+    struct MainPoolState *prevState = gMainPoolState;
+    u32 freeSpace = sPoolFreeSpace;
+    struct MainPoolBlock *lhead = sPoolListHeadL;
+    struct MainPoolBlock *rhead = sPoolListHeadR;
+
+    gMainPoolState = main_pool_alloc(sizeof(*gMainPoolState), MEMORY_POOL_LEFT);
+    gMainPoolState->freeSpace = freeSpace;
+    gMainPoolState->listHeadL = lhead;
+    gMainPoolState->listHeadR = rhead;
+    gMainPoolState->prev = prevState;
+    return sPoolFreeSpace;
+}
+
+/**
+ * Restore pool state from a previous call to main_pool_push_state. Return the
+ * amount of free space left in the pool.
+ */
+u32 main_pool_pop_state(void) {
+    segment_prefetch_reset();
+#if PUPPYPRINT_DEBUG
+    // Uncount everything allocated since the matching push; the block links of
+    // the abandoned regions are still intact.
+    struct MainPoolBlock *b;
+    for (b = gMainPoolState->listHeadL; b->next != NULL; b = b->next) {
+        mem_tag_sub(b->tag, (u8 *) b->next - (u8 *) b);
+    }
+    for (b = sPoolListHeadR; b != gMainPoolState->listHeadR; b = b->next) {
+        mem_tag_sub(b->tag, (u8 *) b->next - (u8 *) b);
+    }
+#endif
+    sPoolFreeSpace = gMainPoolState->freeSpace;
+    sPoolListHeadL = gMainPoolState->listHeadL;
+    sPoolListHeadR = gMainPoolState->listHeadR;
+    gMainPoolState = gMainPoolState->prev;
+    return sPoolFreeSpace;
+}
+
+#endif // !MAIN_POOL_COALESCING
+
+/**
+ * Asynchronous DMA request queue. Transfers are issued to the PI in 4KB chunks
+ * with one chunk outstanding at a time, so a higher priority request submitted
+ * mid-transfer preempts a bulk one at chunk granularity. Requests are pumped by
+ * dma_async_process whenever the owner waits (or polls between CPU work),
+ * leaving the CPU free while the PI runs. Main thread only: the audio thread
+ * keeps its own per-frame DMA FIFO in audio/load.c.
+ */
+#define DMA_CHUNK_SIZE 0x1000
+
+static struct DmaRequest sDmaRequests[DMA_QUEUE_SIZE];
+static struct DmaRequest *sDmaInFlight = NULL;
+static u32 sDmaChunkSize = 0;
+
+/**
+ * Issue the next chunk of the highest priority pending request, if the PI
+ * isn't already busy with one of ours.
+ */
+static void dma_async_start_chunk(void) {
+    struct DmaRequest *best = NULL;
+    s32 i;
+
+    if (sDmaInFlight != NULL) {
+        return;
+    }
+    for (i = 0; i < DMA_QUEUE_SIZE; i++) {
+        struct DmaRequest *req = &sDmaRequests[i];
+        if (req->active && (best == NULL || req->priority > best->priority)) {
+            best = req;
+        }
+    }
+    if (best == NULL) {
+        return;
+    }
+    sDmaChunkSize = MIN(best->remaining, DMA_CHUNK_SIZE);
+    osPiStartDma(&gDmaIoMesg,
+                 (best->priority == DMA_PRIORITY_HIGH) ? OS_MESG_PRI_HIGH : OS_MESG_PRI_NORMAL,
+                 OS_READ, (uintptr_t) best->srcStart, best->dest, sDmaChunkSize, &gDmaMesgQueue);
+    sDmaInFlight = best;
+}
+
+/**
+ * Receive one finished chunk and keep the queue moving. Pass OS_MESG_BLOCK to
+ * wait for the chunk, or OS_MESG_NOBLOCK to poll between CPU work. Returns -1
+ * when there was nothing to receive.
+ */
+s32 dma_async_process(s32 flag) {
+    struct DmaRequest *req = sDmaInFlight;
+
+    if (req == NULL) {
+        return -1;
+    }
+    if (osRecvMesg(&gDmaMesgQueue, &gMainReceivedMesg, flag) == -1) {
+        return -1;
+    }
+    req->dest      += sDmaChunkSize;
+    req->srcStart  += sDmaChunkSize;
+    req->remaining -= sDmaChunkSize;
+    sDmaInFlight = NULL;
+    if (req->remaining == 0) {
+        req->active = FALSE;
+        if (req->callback != NULL) {
+            req->callback(req);
+        }
+    }
+    dma_async_start_chunk();
+    return 0;
+}
+
+/**
+ * Queue an asynchronous DMA read from ROM. Returns a handle to pass to
+ * dma_async_wait, or NULL for an empty transfer. If every request slot is
+ * busy, blocks until one finishes.
+ */
+struct DmaRequest *dma_read_async(u8 *dest, u8 *srcStart, u8 *srcEnd, s32 priority,
+                                  void (*callback)(struct DmaRequest *)) {
+    u32 size = ALIGN16(srcEnd - srcStart);
+    struct DmaRequest *req = NULL;
+    s32 i;
+
+    if (size == 0) {
+        return NULL;
+    }
+    while (req == NULL) {
+        for (i = 0; i < DMA_QUEUE_SIZE; i++) {
+            if (!sDmaRequests[i].active) {
+                req = &sDmaRequests[i];
+                break;
+            }
+        }
+        if (req == NULL) {
+            dma_async_process(OS_MESG_BLOCK);
+        }
+    }
+    osInvalDCache(dest, size);
+    req->dest      = dest;
+    req->srcStart  = srcStart;
+    req->remaining = size;
+    req->priority  = priority;
+    req->callback  = callback;
+    req->active    = TRUE;
+    dma_async_start_chunk();
+    return req;
+}
+
+/**
+ * Block until the given request has fully transferred.
+ */
+void dma_async_wait(struct DmaRequest *req) {
+    if (req == NULL) {
+        return;
+    }
+    while (req->active) {
+        dma_async_process(OS_MESG_BLOCK);
+    }
+}
+
+/**
+ * Perform a DMA read from ROM. The transfer is split into 4KB blocks, and this
+ * function blocks until completion.
+ */
+void dma_read(u8 *dest, u8 *srcStart, u8 *srcEnd) {
+    dma_async_wait(dma_read_async(dest, srcStart, srcEnd, DMA_PRIORITY_NORMAL, NULL));
+}
+
+/**
+ * Background segment prefetcher. The PREFETCH level script command stages a
+ * ROM range into a right-side main pool buffer on a low priority loader
+ * thread, which only gets the CPU while the game thread is blocked -- chiefly
+ * the vsync wait -- so star select and painting entry cutscenes spend their
+ * idle PI time on the next level's segments. When a load command later asks
+ * for a staged range, the DMA is already done and only decompression (or a
+ * copy) remains.
+ */
+#define SEGMENT_PREFETCH_SLOTS 4
+
+// Idle priority sits below the game thread so gameplay-time prefetches only
+// use vsync-wait time; the busy priority sits above it (but below audio) so
+// pending transfers keep the PI saturated while a level load is crunching
+// collision and geo layouts on the CPU. The loader blocks on the PI for all
+// but a few cycles per chunk either way.
+#define SEGMENT_LOADER_PRI_IDLE 5
+#define SEGMENT_LOADER_PRI_BUSY 15
+
+enum PrefetchState {
+    PREFETCH_EMPTY,
+    PREFETCH_PENDING,  // queued for the loader thread
+    PREFETCH_DONE,     // transfer landed, buffer ready
+    PREFETCH_CONSUMED, // taken by a load, buffer awaiting release
+};
+
+struct PrefetchSlot {
+    u8 *srcStart;
+    u8 *srcEnd;
+    u8 *buffer;
+    volatile u8 state;
+};
+
+static struct PrefetchSlot sPrefetchSlots[SEGMENT_PREFETCH_SLOTS];
+static OSThread sSegmentLoaderThread;
+static u8 sSegmentLoaderActive = FALSE;
+static OSMesgQueue sPrefetchFeedQueue; // slots for the loader thread to fill
+static OSMesg sPrefetchFeedMesgBuf[SEGMENT_PREFETCH_SLOTS];
+static OSMesgQueue sPrefetchDoneQueue; // wakeups, one per finished transfer
+static OSMesg sPrefetchDoneMesgBuf[SEGMENT_PREFETCH_SLOTS];
+static OSMesgQueue sPrefetchDmaQueue;
+static OSMesg sPrefetchDmaMesg;
+static OSIoMesg sPrefetchIoMesg;
+
+/**
+ * Loader thread entry. Each 4KB chunk blocks on the PI, so the thread holds
+ * the CPU only for the few cycles between chunks and a pending synchronous
+ * dma_read never waits behind more than one chunk.
+ */
+static void thread10_segment_loader(UNUSED void *arg) {
+    OSMesg mesg;
+
+    while (TRUE) {
+        struct PrefetchSlot *slot;
+        u8 *dest;
+        u8 *src;
+        u32 remaining;
+
+        osRecvMesg(&sPrefetchFeedQueue, &mesg, OS_MESG_BLOCK);
+        slot = (struct PrefetchSlot *) mesg;
+        dest = slot->buffer;
+        src = slot->srcStart;
+        remaining = ALIGN16(slot->srcEnd - slot->srcStart);
+        while (remaining != 0) {
+            u32 chunk = MIN(remaining, DMA_CHUNK_SIZE);
+            osPiStartDma(&sPrefetchIoMesg, OS_MESG_PRI_NORMAL, OS_READ,
+                         (uintptr_t) src, dest, chunk, &sPrefetchDmaQueue);
+            osRecvMesg(&sPrefetchDmaQueue, &mesg, OS_MESG_BLOCK);
+            dest += chunk;
+            src += chunk;
+            remaining -= chunk;
+        }
+        slot->state = PREFETCH_DONE;
+        osSendMesg(&sPrefetchDoneQueue, NULL, OS_MESG_NOBLOCK);
+    }
+}
+
+void create_segment_loader_thread(void) {
+    osCreateMesgQueue(&sPrefetchFeedQueue, sPrefetchFeedMesgBuf, SEGMENT_PREFETCH_SLOTS);
+    osCreateMesgQueue(&sPrefetchDoneQueue, sPrefetchDoneMesgBuf, SEGMENT_PREFETCH_SLOTS);
+    osCreateMesgQueue(&sPrefetchDmaQueue, &sPrefetchDmaMesg, 1);
+    osCreateThread(&sSegmentLoaderThread, THREAD_10_SEGMENT_LOADER, thread10_segment_loader,
+                   NULL, gSegmentLoaderThreadStack + 0x800, SEGMENT_LOADER_PRI_IDLE);
+    osStartThread(&sSegmentLoaderThread);
+    sSegmentLoaderActive = TRUE;
+}
+
+/**
+ * Raise the loader thread above the game thread while a level script is
+ * executing load work, so staged transfers still in flight overlap with the
+ * CPU-side collision and geo processing instead of waiting for the next vsync
+ * block. A no-op unless a transfer is actually pending, so the per-frame
+ * script poll during gameplay doesn't touch thread priorities.
+ */
+static u8 sSegmentLoaderBoosted = FALSE;
+
+void segment_loader_set_busy(s32 busy) {
+    s32 i;
+
+    if (!sSegmentLoaderActive) {
+        return;
+    }
+    if (busy) {
+        for (i = 0; i < SEGMENT_PREFETCH_SLOTS; i++) {
+            if (sPrefetchSlots[i].state == PREFETCH_PENDING) {
+                osSetThreadPri(&sSegmentLoaderThread, SEGMENT_LOADER_PRI_BUSY);
+                sSegmentLoaderBoosted = TRUE;
+                return;
+            }
+        }
+    } else if (sSegmentLoaderBoosted) {
+        osSetThreadPri(&sSegmentLoaderThread, SEGMENT_LOADER_PRI_IDLE);
+        sSegmentLoaderBoosted = FALSE;
+    }
+}
+
+/**
+ * Stage a ROM range for background transfer. A no-op when the range is
+ * already staged, no slot is free, or the buffer doesn't fit; the matching
+ * load then simply falls back to a normal synchronous read.
+ */
+void segment_prefetch(u8 *srcStart, u8 *srcEnd) {
+    struct PrefetchSlot *slot = NULL;
+    u32 size = ALIGN16(srcEnd - srcStart);
+    s32 i;
+
+    if (!sSegmentLoaderActive || size == 0) {
+        return;
+    }
+#ifdef MENU_SEGMENT_CACHE
+    // Already resident; the load will hit the cache without any transfer.
+    if (segment_cache_lookup(srcStart, srcEnd) != NULL) {
+        return;
+    }
+#endif
+    for (i = 0; i < SEGMENT_PREFETCH_SLOTS; i++) {
+        if (sPrefetchSlots[i].state != PREFETCH_EMPTY && sPrefetchSlots[i].srcStart == srcStart) {
+            return;
+        }
+        if (sPrefetchSlots[i].state == PREFETCH_EMPTY && slot == NULL) {
+            slot = &sPrefetchSlots[i];
+        }
+    }
+    if (slot == NULL) {
+        return;
+    }
+    slot->buffer = main_pool_alloc(size, MEMORY_POOL_RIGHT);
+    if (slot->buffer == NULL) {
+        return;
+    }
+    osInvalDCache(slot->buffer, size);
+    slot->srcStart = srcStart;
+    slot->srcEnd = srcEnd;
+    slot->state = PREFETCH_PENDING;
+    osSendMesg(&sPrefetchFeedQueue, (OSMesg) slot, OS_MESG_NOBLOCK);
+}
+
+/**
+ * Non-blocking check whether a staged range has finished transferring.
+ */
+s32 segment_prefetch_poll(u8 *srcStart, u8 *srcEnd) {
+    s32 i;
+
+    for (i = 0; i < SEGMENT_PREFETCH_SLOTS; i++) {
+        if (sPrefetchSlots[i].state == PREFETCH_DONE
+            && sPrefetchSlots[i].srcStart == srcStart && sPrefetchSlots[i].srcEnd == srcEnd) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * Claim a staged range, blocking until its transfer has landed. Returns the
+ * staging buffer (hand it back with segment_prefetch_release), or NULL if the
+ * range was never staged.
+ */
+u8 *segment_prefetch_take(u8 *srcStart, u8 *srcEnd) {
+    struct PrefetchSlot *slot = NULL;
+    OSMesg mesg;
+    s32 i;
+
+    for (i = 0; i < SEGMENT_PREFETCH_SLOTS; i++) {
+        if ((sPrefetchSlots[i].state == PREFETCH_PENDING || sPrefetchSlots[i].state == PREFETCH_DONE)
+            && sPrefetchSlots[i].srcStart == srcStart && sPrefetchSlots[i].srcEnd == srcEnd) {
+            slot = &sPrefetchSlots[i];
+            break;
+        }
+    }
+    if (slot == NULL) {
+        return NULL;
+    }
+    while (slot->state == PREFETCH_PENDING) {
+        osRecvMesg(&sPrefetchDoneQueue, &mesg, OS_MESG_BLOCK);
+    }
+    // Stale wakeups from slots nobody waited on; safe to drop, only the game
+    // thread consumes this queue.
+    while (osRecvMesg(&sPrefetchDoneQueue, &mesg, OS_MESG_NOBLOCK) == 0) {
+    }
+    slot->state = PREFETCH_CONSUMED;
+    return slot->buffer;
+}
+
+/**
+ * Release a staging buffer returned by segment_prefetch_take. With the vanilla
+ * two-sided allocator, freeing a buffer would also release every younger
+ * right-side block -- including staging buffers still being written -- so the
+ * frees are deferred until every staged range is consumed, then done in one go
+ * by freeing the oldest buffer.
+ */
+void segment_prefetch_release(UNUSED u8 *buffer) {
+#ifdef MAIN_POOL_COALESCING
+    s32 i;
+
+    for (i = 0; i < SEGMENT_PREFETCH_SLOTS; i++) {
+        if (sPrefetchSlots[i].state == PREFETCH_CONSUMED && sPrefetchSlots[i].buffer == buffer) {
+            sPrefetchSlots[i].state = PREFETCH_EMPTY;
+            sPrefetchSlots[i].srcStart = NULL;
+            main_pool_free(buffer);
+            return;
+        }
+    }
+#else
+    u8 *oldest = NULL;
+    s32 i;
+
+    for (i = 0; i < SEGMENT_PREFETCH_SLOTS; i++) {
+        if (sPrefetchSlots[i].state == PREFETCH_PENDING || sPrefetchSlots[i].state == PREFETCH_DONE) {
+            return;
+        }
     }
-    return sPoolFreeSpace;
+    for (i = 0; i < SEGMENT_PREFETCH_SLOTS; i++) {
+        if (sPrefetchSlots[i].state == PREFETCH_CONSUMED) {
+            if (sPrefetchSlots[i].buffer > oldest) {
+                oldest = sPrefetchSlots[i].buffer;
+            }
+            sPrefetchSlots[i].state = PREFETCH_EMPTY;
+            sPrefetchSlots[i].srcStart = NULL;
+        }
+    }
+    if (oldest != NULL) {
+        main_pool_free(oldest);
+    }
+#endif
 }
 
 /**
- * Resize a block of memory that was allocated from the left side of the pool.
- * If the block is increasing in size, it must be the most recently allocated
- * block from the left side.
- * The block does not move.
+ * Drop every staged range without freeing the buffers; called when the main
+ * pool is popped, which reclaims them wholesale. Transfers still in flight are
+ * waited out first so the loader thread can't write into reclaimed memory.
  */
-void *main_pool_realloc(void *addr, u32 size) {
-    void *newAddr = NULL;
-    struct MainPoolBlock *block = (struct MainPoolBlock *) ((u8 *) addr - 16);
+static void segment_prefetch_reset(void) {
+    OSMesg mesg;
+    s32 i;
 
-    if (block->next == sPoolListHeadL) {
-        main_pool_free(addr);
-        newAddr = main_pool_alloc(size, MEMORY_POOL_LEFT);
+    if (!sSegmentLoaderActive) {
+        return;
+    }
+    for (i = 0; i < SEGMENT_PREFETCH_SLOTS; i++) {
+        while (sPrefetchSlots[i].state == PREFETCH_PENDING) {
+            osRecvMesg(&sPrefetchDoneQueue, &mesg, OS_MESG_BLOCK);
+        }
+        sPrefetchSlots[i].state = PREFETCH_EMPTY;
+        sPrefetchSlots[i].srcStart = NULL;
+    }
+    while (osRecvMesg(&sPrefetchDoneQueue, &mesg, OS_MESG_NOBLOCK) == 0) {
     }
-    return newAddr;
 }
 
+#ifdef MENU_SEGMENT_CACHE
+
 /**
- * Return the size of the largest block that can currently be allocated from the
- * pool.
+ * Resident cache for small, frequently revisited segment loads (the menu
+ * screens). A retained ROM range is filled from the first load that reads it;
+ * every later load of the same range copies from RDRAM instead of going out
+ * over the PI. For compressed segments the *compressed* bytes are cached, so
+ * the cache stays small and only the decompression is repeated.
  */
-u32 main_pool_available(void) {
-    return sPoolFreeSpace - 16;
-}
+struct SegmentCacheSlot {
+    u8 *srcStart;
+    u8 *srcEnd;
+    u8 *data;
+    u32 size;
+    u8 filled;
+};
+
+static struct SegmentCacheSlot sSegmentCacheSlots[MENU_SEGMENT_CACHE_SLOTS];
+static u8 *sSegmentCacheBuf = NULL;
+static u32 sSegmentCacheUsed = 0;
 
 /**
- * Push pool state, to be restored later. Return the amount of free space left
- * in the pool.
+ * Carve out the cache's backing memory. Called once at boot, before the first
+ * main pool push, so the buffer survives every level transition.
  */
-u32 main_pool_push_state(void) {
-    struct MainPoolState *prevState = gMainPoolState;
-    u32 freeSpace = sPoolFreeSpace;
-    struct MainPoolBlock *lhead = sPoolListHeadL;
-    struct MainPoolBlock *rhead = sPoolListHeadR;
-
-    gMainPoolState = main_pool_alloc(sizeof(*gMainPoolState), MEMORY_POOL_LEFT);
-    gMainPoolState->freeSpace = freeSpace;
-    gMainPoolState->listHeadL = lhead;
-    gMainPoolState->listHeadR = rhead;
-    gMainPoolState->prev = prevState;
-    return sPoolFreeSpace;
+void segment_cache_init(void) {
+    sSegmentCacheBuf = main_pool_alloc(MENU_SEGMENT_CACHE_SIZE, MEMORY_POOL_LEFT);
 }
 
 /**
- * Restore pool state from a previous call to main_pool_push_state. Return the
- * amount of free space left in the pool.
+ * Register a ROM range for retention. Space is reserved now; the first load
+ * that reads the range fills it. A no-op when the range doesn't fit or the
+ * slots are full, in which case loads of the range just stay uncached.
  */
-u32 main_pool_pop_state(void) {
-    sPoolFreeSpace = gMainPoolState->freeSpace;
-    sPoolListHeadL = gMainPoolState->listHeadL;
-    sPoolListHeadR = gMainPoolState->listHeadR;
-    gMainPoolState = gMainPoolState->prev;
-    return sPoolFreeSpace;
+void segment_cache_retain(u8 *srcStart, u8 *srcEnd) {
+    u32 size = ALIGN16(srcEnd - srcStart);
+    s32 i;
+
+    if (sSegmentCacheBuf == NULL || sSegmentCacheUsed + size > MENU_SEGMENT_CACHE_SIZE) {
+        return;
+    }
+    for (i = 0; i < MENU_SEGMENT_CACHE_SLOTS; i++) {
+        if (sSegmentCacheSlots[i].srcStart == srcStart) {
+            return;
+        }
+    }
+    for (i = 0; i < MENU_SEGMENT_CACHE_SLOTS; i++) {
+        if (sSegmentCacheSlots[i].srcStart == NULL) {
+            sSegmentCacheSlots[i].srcStart = srcStart;
+            sSegmentCacheSlots[i].srcEnd = srcEnd;
+            sSegmentCacheSlots[i].data = sSegmentCacheBuf + sSegmentCacheUsed;
+            sSegmentCacheSlots[i].size = size;
+            sSegmentCacheSlots[i].filled = FALSE;
+            sSegmentCacheUsed += size;
+            return;
+        }
+    }
 }
 
 /**
- * Perform a DMA read from ROM. The transfer is split into 4KB blocks, and this
- * function blocks until completion.
+ * Return the cached copy of a ROM range, or NULL if it isn't retained or
+ * hasn't been filled yet.
  */
-void dma_read(u8 *dest, u8 *srcStart, u8 *srcEnd) {
-    u32 size = ALIGN16(srcEnd - srcStart);
+static u8 *segment_cache_lookup(u8 *srcStart, u8 *srcEnd) {
+    s32 i;
 
-    osInvalDCache(dest, size);
-    while (size != 0) {
-        u32 copySize = (size >= 0x1000) ? 0x1000 : size;
+    for (i = 0; i < MENU_SEGMENT_CACHE_SLOTS; i++) {
+        if (sSegmentCacheSlots[i].filled
+         && sSegmentCacheSlots[i].srcStart == srcStart && sSegmentCacheSlots[i].srcEnd == srcEnd) {
+            return sSegmentCacheSlots[i].data;
+        }
+    }
+    return NULL;
+}
 
-        osPiStartDma(&gDmaIoMesg, OS_MESG_PRI_NORMAL, OS_READ, (uintptr_t) srcStart, dest, copySize,
-                     &gDmaMesgQueue);
-        osRecvMesg(&gDmaMesgQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
+/**
+ * Offer freshly read data for a ROM range to the cache; keeps it if the range
+ * is retained and still empty.
+ */
+static void segment_cache_fill(u8 *srcStart, u8 *srcEnd, u8 *data) {
+    s32 i;
 
-        dest += copySize;
-        srcStart += copySize;
-        size -= copySize;
+    for (i = 0; i < MENU_SEGMENT_CACHE_SLOTS; i++) {
+        if (!sSegmentCacheSlots[i].filled
+         && sSegmentCacheSlots[i].srcStart == srcStart && sSegmentCacheSlots[i].srcEnd == srcEnd) {
+            bcopy(data, sSegmentCacheSlots[i].data, sSegmentCacheSlots[i].size);
+            sSegmentCacheSlots[i].filled = TRUE;
+            return;
+        }
     }
 }
 
+#endif // MENU_SEGMENT_CACHE
+
 /**
  * Perform a DMA read from ROM, allocating space in the memory pool to write to.
  * Return the destination address.
@@ -282,13 +1248,38 @@ void *dynamic_dma_read(u8 *srcStart, u8 *srcEnd, u32 side, u32 alignment, u32 bs
     u32 size = ALIGN16(srcEnd - srcStart);
     u32 offset = 0;
 
+#ifdef MAIN_POOL_COALESCING
+    // The heap backend can't predict the block address up front, so it aligns
+    // the payload itself.
+    void *dest = main_pool_alloc_aligned((size + bssLength), alignment, side);
+#else
     if (alignment && side == MEMORY_POOL_LEFT) {
         offset = ALIGN(((uintptr_t)sPoolListHeadL + 16), alignment) - ((uintptr_t)sPoolListHeadL + 16);
     }
 
     void *dest = main_pool_alloc((offset + size + bssLength), side);
+#endif
     if (dest != NULL) {
-        dma_read(((u8 *)dest + offset), srcStart, srcEnd);
+#ifdef MENU_SEGMENT_CACHE
+        u8 *cached = segment_cache_lookup(srcStart, srcEnd);
+        if (cached != NULL) {
+            bcopy(cached, ((u8 *)dest + offset), size);
+        } else
+#endif
+        {
+            u8 *staged = segment_prefetch_take(srcStart, srcEnd);
+            if (staged != NULL) {
+                // Already transferred in the background; a RDRAM copy is far
+                // faster than going back out over the PI.
+                bcopy(staged, ((u8 *)dest + offset), size);
+                segment_prefetch_release(staged);
+            } else {
+                dma_read(((u8 *)dest + offset), srcStart, srcEnd);
+            }
+#ifdef MENU_SEGMENT_CACHE
+            segment_cache_fill(srcStart, srcEnd, ((u8 *)dest + offset));
+#endif
+        }
         if (bssLength) {
             bzero(((u8 *)dest + offset + size), bssLength);
         }
@@ -319,6 +1310,39 @@ void mapTLBPages(uintptr_t virtualAddress, uintptr_t physicalAddress, s32 length
 }
 
 #ifndef NO_SEGMENTED_MEMORY
+#ifdef ROM_RESIDENT_SEGMENTS
+static const u8 sRomResidentSegments[] = ROM_RESIDENT_SEGMENTS;
+
+// Cartridge domain 1 address 2 base, where the ROM image lives on the PI bus.
+#define ROM_BASE_PHYSICAL 0x10000000
+
+/**
+ * Return whether the given segment is configured to be read straight from
+ * cartridge ROM rather than loaded into the main pool.
+ */
+static s32 is_rom_resident_segment(s32 segment) {
+    s32 i;
+
+    for (i = 0; i < ARRAY_COUNT(sRomResidentSegments); i++) {
+        if (sRomResidentSegments[i] == segment) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * Point the segment base at the uncached cartridge mirror of its ROM data, so
+ * segmented addresses resolve to the cart itself and no RDRAM is used.
+ */
+static void *set_segment_rom_resident(s32 segment, u8 *srcStart) {
+    void *addr = (void *) PHYS_TO_K1(ROM_BASE_PHYSICAL + (uintptr_t) srcStart);
+
+    set_segment_base_addr(segment, addr);
+    return addr;
+}
+#endif
+
 /**
  * Load data from ROM into a newly allocated block, and set the segment base
  * address to this block.
@@ -326,6 +1350,12 @@ void mapTLBPages(uintptr_t virtualAddress, uintptr_t physicalAddress, s32 length
 void *load_segment(s32 segment, u8 *srcStart, u8 *srcEnd, u32 side, u8 *bssStart, u8 *bssEnd) {
     void *addr;
 
+#ifdef ROM_RESIDENT_SEGMENTS
+    if ((bssStart == NULL) && is_rom_resident_segment(segment)) {
+        return set_segment_rom_resident(segment, srcStart);
+    }
+#endif
+    MEM_TAG(MEM_TAG_SEGMENTS);
     if ((bssStart != NULL) && (side == MEMORY_POOL_LEFT)) {
         addr = dynamic_dma_read(srcStart, srcEnd, side, TLB_PAGE_SIZE, ((uintptr_t)bssEnd - (uintptr_t)bssStart));
         if (addr != NULL) {
@@ -339,6 +1369,7 @@ void *load_segment(s32 segment, u8 *srcStart, u8 *srcEnd, u32 side, u8 *bssStart
             set_segment_base_addr(segment, addr);
         }
     }
+    MEM_TAG(MEM_TAG_OTHER);
 #if PUPPYPRINT_DEBUG
     ramsizeSegment[(segment + nameTable) - 2] = ((s32)srcEnd - (s32)srcStart);
 #endif
@@ -357,7 +1388,9 @@ void *load_to_fixed_pool_addr(u8 *destAddr, u8 *srcStart, u8 *srcEnd) {
     u32 destSize = ALIGN16((u8 *) sPoolListHeadR - destAddr);
 
     if (srcSize <= destSize) {
+        MEM_TAG(MEM_TAG_SEGMENTS);
         dest = main_pool_alloc(destSize, MEMORY_POOL_RIGHT);
+        MEM_TAG(MEM_TAG_OTHER);
         if (dest != NULL) {
             bzero(dest, destSize);
             osWritebackDCacheAll();
@@ -369,6 +1402,102 @@ void *load_to_fixed_pool_addr(u8 *destAddr, u8 *srcStart, u8 *srcEnd) {
     return dest;
 }
 
+#if defined(GZIP) && !defined(UNCOMPRESSED)
+// State for the streaming decompression pipeline below.
+static u8 *sStreamBuf;    // compressed staging buffer in the main pool
+static u8 *sStreamRom;    // ROM address of the compressed segment
+static u32 sStreamTotal;  // total bytes to transfer
+static u32 sStreamQueued; // bytes covered by started transfers
+static u32 sStreamDone;   // bytes known to have landed
+static struct DmaRequest *sStreamReq;
+
+static void gzip_stream_start_next(void) {
+    u32 chunk = MIN(sStreamTotal - sStreamQueued, DMA_CHUNK_SIZE);
+
+    sStreamReq = dma_read_async((sStreamBuf + sStreamQueued), (sStreamRom + sStreamQueued),
+                                (sStreamRom + sStreamQueued + chunk), DMA_PRIORITY_NORMAL, NULL);
+    sStreamQueued += chunk;
+}
+
+/**
+ * expand_gzip_chunked callback: block until the chunk about to be inflated has
+ * landed, then start the transfer of the following one so the PI moves it
+ * while the current chunk is inflated.
+ */
+static void gzip_stream_wait_chunk(u32 chunkEnd) {
+    while (sStreamDone < chunkEnd) {
+        dma_async_wait(sStreamReq);
+        sStreamDone = sStreamQueued;
+        if (sStreamQueued < sStreamTotal) {
+            gzip_stream_start_next();
+        }
+    }
+}
+
+/**
+ * Decompress a gzip segment while its compressed data is still streaming in
+ * from ROM. The first 4KB block is started here; each later block transfers
+ * during the previous block's inflate, so the load takes roughly
+ * max(DMA time, inflate time) instead of their sum.
+ */
+static void stream_gzip_decompress(u8 *compressed, u8 *srcStart, u32 dmaSize, void *dest, u32 compSize, u32 outbufLength) {
+    sStreamBuf = compressed;
+    sStreamRom = srcStart;
+    sStreamTotal = dmaSize;
+    sStreamQueued = 0;
+    sStreamDone = 0;
+    gzip_stream_start_next();
+    expand_gzip_chunked(compressed, dest, compSize, outbufLength, DMA_CHUNK_SIZE, gzip_stream_wait_chunk);
+}
+#endif
+
+#ifdef MULTI_CODEC
+/**
+ * Dispatch on the container magic. Every headered codec keeps the unpacked
+ * size at offset 4, so the sizing logic above the decoders is shared, and
+ * all four decoders are part of the boot segment regardless of COMPRESS -
+ * a mixed ROM costs no extra code.
+ */
+static void decompress_any(u8 *compressed, void *dest) {
+    if (compressed[0] == 'M') { // "MIO0"
+        decompress(compressed, dest);
+    } else if (compressed[0] == 'Y') { // "Yay0"
+        slidstart(compressed, dest);
+    } else if (compressed[3] == 1) { // "RNC" 1
+        Propack_UnpackM1(compressed, dest);
+    } else { // "RNC" 2
+        Propack_UnpackM2(compressed, dest);
+    }
+}
+#endif
+
+#if defined(DECOMP_BENCHMARK) && !defined(UNCOMPRESSED)
+/**
+ * One line per decompressed segment: codec, sizes, time, throughput.
+ * Building the same ROM with each COMPRESS= option and diffing these lines
+ * is the codec bake-off; ratio falls out of the sizes, speed out of the
+ * microseconds. Routed through osSyncPrintf so UNF builds stream it.
+ */
+static void decomp_benchmark_log(s32 segment, u8 *compressed, u32 compSize, u32 rawSize, OSTime cycles) {
+    const char *codec;
+    u32 usec = OS_CYCLES_TO_USEC(cycles);
+#ifdef GZIP
+    codec = "gzip";
+    (void) compressed;
+#else
+    switch (compressed[0]) {
+        case 'M': codec = "mio0"; break;
+        case 'Y': codec = "yay0"; break;
+        case 'R': codec = (compressed[3] == 1) ? "rnc1" : "rnc2"; break;
+        default:  codec = "????"; break;
+    }
+#endif
+    osSyncPrintf("decomp: seg %02d %s %6d -> %6d bytes, %6d us, %d KB/s\n",
+                 segment, codec, compSize, rawSize, usec,
+                 (usec > 0) ? (u32) (((u64) rawSize * 1000000) / usec / 1024) : 0);
+}
+#endif
+
 /**
  * Decompress the block of ROM data from srcStart to srcEnd and return a
  * pointer to an allocated buffer holding the decompressed data. Set the
@@ -377,12 +1506,28 @@ void *load_to_fixed_pool_addr(u8 *destAddr, u8 *srcStart, u8 *srcEnd) {
 void *load_segment_decompress(s32 segment, u8 *srcStart, u8 *srcEnd) {
     void *dest = NULL;
 
+#if defined(ROM_RESIDENT_SEGMENTS) && defined(UNCOMPRESSED)
+    // With no compression there is nothing to unpack, so eligible segments can
+    // be read from the cart in place.
+    if (is_rom_resident_segment(segment)) {
+        return set_segment_rom_resident(segment, srcStart);
+    }
+#endif
 #ifdef GZIP
     u32 compSize = (srcEnd - 4 - srcStart);
 #else
     u32 compSize = ALIGN16(srcEnd - srcStart);
 #endif
-    u8 *compressed = main_pool_alloc(compSize, MEMORY_POOL_RIGHT);
+    MEM_TAG(MEM_TAG_SEGMENTS);
+#ifdef MENU_SEGMENT_CACHE
+    // A cache-resident range behaves like a completed prefetch, minus the
+    // staging buffer bookkeeping.
+    u8 *cached = segment_cache_lookup(srcStart, srcEnd);
+    u8 *staged = (cached != NULL) ? cached : segment_prefetch_take(srcStart, srcEnd);
+#else
+    u8 *staged = segment_prefetch_take(srcStart, srcEnd);
+#endif
+    u8 *compressed = (staged != NULL) ? staged : main_pool_alloc(compSize, MEMORY_POOL_RIGHT);
 #ifdef GZIP
     // Decompressed size from end of gzip
     u32 *size = (u32 *) (compressed + compSize);
@@ -391,17 +1536,41 @@ void *load_segment_decompress(s32 segment, u8 *srcStart, u8 *srcEnd) {
     u32 *size = (u32 *) (compressed + 4);
 #endif
     if (compressed != NULL) {
-#ifdef UNCOMPRESSED
+#if defined(UNCOMPRESSED)
         dest = main_pool_alloc(compSize, MEMORY_POOL_LEFT);
-        dma_read(dest, srcStart, srcEnd);
+        if (staged != NULL) {
+            bcopy(compressed, dest, compSize);
+        } else {
+            dma_read(dest, srcStart, srcEnd);
+        }
+#elif defined(GZIP)
+        // Only the tail is read up front: the decompressed size footer has to
+        // size the destination before the streamed transfer begins.
+        u32 dmaSize = ALIGN16(srcEnd - srcStart);
+        if (staged == NULL) {
+            dma_read((compressed + (dmaSize - 32)), (srcStart + (dmaSize - 32)), (srcStart + dmaSize));
+        }
+        dest = main_pool_alloc(*size, MEMORY_POOL_LEFT);
 #else
-        dma_read(compressed, srcStart, srcEnd);
+        if (staged == NULL) {
+            dma_read(compressed, srcStart, srcEnd);
+        }
         dest = main_pool_alloc(*size, MEMORY_POOL_LEFT);
 #endif
         if (dest != NULL) {
             osSyncPrintf("start decompress\n");
+#if defined(DECOMP_BENCHMARK) && !defined(UNCOMPRESSED)
+            OSTime decompStart = osGetTime();
+#endif
 #ifdef GZIP
-            expand_gzip(compressed, dest, compSize, (u32)size);
+            if (staged != NULL) {
+                // Fully resident already, no transfer to overlap with.
+                expand_gzip(compressed, dest, compSize, (u32)size);
+            } else {
+                stream_gzip_decompress(compressed, srcStart, dmaSize, dest, compSize, (u32)size);
+            }
+#elif MULTI_CODEC
+            decompress_any(compressed, dest);
 #elif RNC1
             Propack_UnpackM1(compressed, dest);
 #elif RNC2
@@ -410,12 +1579,42 @@ void *load_segment_decompress(s32 segment, u8 *srcStart, u8 *srcEnd) {
             slidstart(compressed, dest);
 #elif MIO0
             decompress(compressed, dest);
+#endif
+#if defined(DECOMP_BENCHMARK) && !defined(UNCOMPRESSED)
+            decomp_benchmark_log(segment, compressed, compSize, *size, osGetTime() - decompStart);
 #endif
             osSyncPrintf("end decompress\n");
             set_segment_base_addr(segment, dest);
-            main_pool_free(compressed);
+#ifdef MENU_SEGMENT_CACHE
+            if (cached == NULL) {
+#if defined(UNCOMPRESSED)
+                segment_cache_fill(srcStart, srcEnd, dest);
+#elif defined(GZIP)
+                // The streamed path never holds the whole compressed image.
+                if (staged != NULL) {
+                    segment_cache_fill(srcStart, srcEnd, compressed);
+                }
+#else
+                segment_cache_fill(srcStart, srcEnd, compressed);
+#endif
+            }
+            if (cached != NULL) {
+                // Cache-resident; nothing to hand back.
+            } else if (staged != NULL) {
+                segment_prefetch_release(compressed);
+            } else {
+                main_pool_free(compressed);
+            }
+#else
+            if (staged != NULL) {
+                segment_prefetch_release(compressed);
+            } else {
+                main_pool_free(compressed);
+            }
+#endif
         }
     }
+    MEM_TAG(MEM_TAG_OTHER);
 #if PUPPYPRINT_DEBUG
     ramsizeSegment[(segment + nameTable) - 2] = (s32)srcEnd - (s32)srcStart;
 #endif
@@ -430,19 +1629,42 @@ void *load_segment_decompress_heap(u32 segment, u8 *srcStart, u8 *srcEnd) {
 #else
     u32 compSize = ALIGN16(srcEnd - srcStart);
 #endif
-    u8 *compressed = main_pool_alloc(compSize, MEMORY_POOL_RIGHT);
+    MEM_TAG(MEM_TAG_SEGMENTS);
+#ifdef MENU_SEGMENT_CACHE
+    u8 *cached = segment_cache_lookup(srcStart, srcEnd);
+    u8 *staged = (cached != NULL) ? cached : segment_prefetch_take(srcStart, srcEnd);
+#else
+    u8 *staged = segment_prefetch_take(srcStart, srcEnd);
+#endif
+    u8 *compressed = (staged != NULL) ? staged : main_pool_alloc(compSize, MEMORY_POOL_RIGHT);
 #ifdef GZIP
     // Decompressed size from end of gzip
     u32 *size = (u32 *) (compressed + compSize);
 #endif
     if (compressed != NULL) {
-#ifdef UNCOMPRESSED
-        dma_read(gDecompressionHeap, srcStart, srcEnd);
-#else
-        dma_read(compressed, srcStart, srcEnd);
+#if defined(UNCOMPRESSED)
+        if (staged != NULL) {
+            bcopy(compressed, gDecompressionHeap, compSize);
+        } else {
+            dma_read(gDecompressionHeap, srcStart, srcEnd);
+        }
+#elif !defined(GZIP)
+        if (staged == NULL) {
+            dma_read(compressed, srcStart, srcEnd);
+        }
+#endif
+#if defined(DECOMP_BENCHMARK) && !defined(UNCOMPRESSED)
+        OSTime decompStart = osGetTime();
 #endif
 #ifdef GZIP
-        expand_gzip(compressed, gDecompressionHeap, compSize, (u32)size);
+        if (staged != NULL) {
+            expand_gzip(compressed, gDecompressionHeap, compSize, (u32)size);
+        } else {
+            // The destination is fixed, so no footer read is needed before streaming.
+            stream_gzip_decompress(compressed, srcStart, ALIGN16(srcEnd - srcStart), gDecompressionHeap, compSize, (u32)size);
+        }
+#elif MULTI_CODEC
+        decompress_any(compressed, gDecompressionHeap);
 #elif RNC1
         Propack_UnpackM1(compressed, gDecompressionHeap);
 #elif RNC2
@@ -451,10 +1673,44 @@ void *load_segment_decompress_heap(u32 segment, u8 *srcStart, u8 *srcEnd) {
         slidstart(compressed, gDecompressionHeap);
 #elif MIO0
         decompress(compressed, gDecompressionHeap);
+#endif
+#if defined(DECOMP_BENCHMARK) && !defined(UNCOMPRESSED)
+#ifdef GZIP
+        u32 rawSize = *size;
+#else
+        u32 rawSize = *(u32 *) (compressed + 4);
+#endif
+        decomp_benchmark_log(segment, compressed, compSize, rawSize, osGetTime() - decompStart);
 #endif
         set_segment_base_addr(segment, gDecompressionHeap);
-        main_pool_free(compressed);
+#ifdef MENU_SEGMENT_CACHE
+        if (cached == NULL) {
+#if defined(UNCOMPRESSED)
+            segment_cache_fill(srcStart, srcEnd, gDecompressionHeap);
+#elif defined(GZIP)
+            if (staged != NULL) {
+                segment_cache_fill(srcStart, srcEnd, compressed);
+            }
+#else
+            segment_cache_fill(srcStart, srcEnd, compressed);
+#endif
+        }
+        if (cached != NULL) {
+            // Cache-resident; nothing to hand back.
+        } else if (staged != NULL) {
+            segment_prefetch_release(compressed);
+        } else {
+            main_pool_free(compressed);
+        }
+#else
+        if (staged != NULL) {
+            segment_prefetch_release(compressed);
+        } else {
+            main_pool_free(compressed);
+        }
+#endif
     }
+    MEM_TAG(MEM_TAG_OTHER);
     return gDecompressionHeap;
 }
 
@@ -481,7 +1737,9 @@ struct AllocOnlyPool *alloc_only_pool_init(u32 size, u32 side) {
     struct AllocOnlyPool *subPool = NULL;
 
     size = ALIGN4(size);
+    MEM_TAG(MEM_TAG_POOLS);
     addr = main_pool_alloc(size + sizeof(struct AllocOnlyPool), side);
+    MEM_TAG(MEM_TAG_OTHER);
     if (addr != NULL) {
         subPool = (struct AllocOnlyPool *) addr;
         subPool->totalSpace = size;
@@ -510,15 +1768,19 @@ void *alloc_only_pool_alloc(struct AllocOnlyPool *pool, s32 size) {
 
 /**
  * Resize an allocation-only pool.
- * If the pool is increasing in size, the pool must be the last thing allocated
- * from the left end of the main pool.
- * The pool does not move.
+ * If the pool is actually growing, it must be the last thing allocated from
+ * the left end of the main pool; a size the pool's block already covers always
+ * succeeds. The pool does not move.
  */
 struct AllocOnlyPool *alloc_only_pool_resize(struct AllocOnlyPool *pool, u32 size) {
     struct AllocOnlyPool *newPool;
 
     size = ALIGN4(size);
-    newPool = main_pool_realloc(pool, size + sizeof(struct AllocOnlyPool));
+    if (size < (u32) pool->totalSpace) {
+        newPool = main_pool_realloc(pool, size + sizeof(struct AllocOnlyPool));
+    } else {
+        newPool = main_pool_try_grow(pool, size + sizeof(struct AllocOnlyPool));
+    }
     if (newPool != NULL) {
         pool->totalSpace = size;
     }
@@ -536,11 +1798,17 @@ struct MemoryPool *mem_pool_init(u32 size, u32 side) {
     struct MemoryPool *pool = NULL;
 
     size = ALIGN4(size);
+    MEM_TAG(MEM_TAG_POOLS);
     addr = main_pool_alloc(size + sizeof(struct MemoryPool), side);
+    MEM_TAG(MEM_TAG_OTHER);
     if (addr != NULL) {
         pool = (struct MemoryPool *) addr;
 
         pool->totalSpace = size;
+#if PUPPYPRINT_DEBUG
+        pool->usedSpace = 0;
+        pool->peakSpace = 0;
+#endif
         pool->firstBlock = (struct MemoryBlock *) ((u8 *) addr + sizeof(struct MemoryPool));
         pool->freeList.next = (struct MemoryBlock *) ((u8 *) addr + sizeof(struct MemoryPool));
 
@@ -575,6 +1843,22 @@ void *mem_pool_alloc(struct MemoryPool *pool, u32 size) {
         }
         freeBlock = freeBlock->next;
     }
+#ifdef MEM_POOL_COMPACTION
+    if (addr != NULL) {
+        // Used blocks repurpose the next field as the owning handle; a plain
+        // allocation has no handle and is pinned in place.
+        ((struct MemoryBlock *) ((u8 *) addr - sizeof(struct MemoryBlock)))->next = NULL;
+    }
+#endif
+#if PUPPYPRINT_DEBUG
+    if (addr != NULL) {
+        // Used blocks keep their size, so count the block actually carved off.
+        pool->usedSpace += ((struct MemoryBlock *) ((u8 *) addr - sizeof(struct MemoryBlock)))->size;
+        if (pool->usedSpace > pool->peakSpace) {
+            pool->peakSpace = pool->usedSpace;
+        }
+    }
+#endif
     return addr;
 }
 
@@ -585,6 +1869,10 @@ void mem_pool_free(struct MemoryPool *pool, void *addr) {
     struct MemoryBlock *block = (struct MemoryBlock *) ((u8 *) addr - sizeof(struct MemoryBlock));
     struct MemoryBlock *freeList = pool->freeList.next;
 
+#if PUPPYPRINT_DEBUG
+    // Before coalescing grows block->size below.
+    pool->usedSpace -= block->size;
+#endif
     if (pool->freeList.next == NULL) {
         pool->freeList.next = block;
         block->next = NULL;
@@ -620,6 +1908,125 @@ void mem_pool_free(struct MemoryPool *pool, void *addr) {
     }
 }
 
+#if PUPPYPRINT_DEBUG
+// Accessors for the memory tracking page; the pool struct is private to this file.
+u32 mem_pool_get_used(struct MemoryPool *pool) {
+    return pool->usedSpace;
+}
+
+u32 mem_pool_get_peak(struct MemoryPool *pool) {
+    return pool->peakSpace;
+}
+
+u32 mem_pool_get_total(struct MemoryPool *pool) {
+    return pool->totalSpace;
+}
+#endif
+
+#ifdef MEM_POOL_COMPACTION
+/**
+ * Slide relocatable blocks down over the free holes below them, so the pool's
+ * free space ends up in as few (ideally one) contiguous runs as possible.
+ * Blocks from plain mem_pool_alloc calls cannot move and act as barriers.
+ * Handle owners are notified of moves through their relocate callback.
+ */
+void mem_pool_compact(struct MemoryPool *pool) {
+    u8 *poolEnd = (u8 *) pool->firstBlock + pool->totalSpace;
+    struct MemoryBlock *cur = pool->firstBlock;
+    struct MemoryBlock *nextFree = pool->freeList.next;
+    struct MemoryBlock *lastGap = &pool->freeList;
+    u8 *dst = (u8 *) pool->firstBlock;
+
+    pool->freeList.next = NULL;
+    while ((u8 *) cur < poolEnd) {
+        u32 size = cur->size;
+        struct MemoryBlock *next = (struct MemoryBlock *) ((u8 *) cur + size);
+
+        if (cur == nextFree) {
+            // Free block: leave dst behind so later blocks slide down over it.
+            nextFree = nextFree->next;
+        } else if (cur->next != NULL) {
+            // Relocatable block: move it (header included) down to dst.
+            struct MemPoolHandle *handle = (struct MemPoolHandle *) cur->next;
+
+            if ((u8 *) cur != dst) {
+                u32 i;
+
+                for (i = 0; i < size; i++) {
+                    dst[i] = ((u8 *) cur)[i];
+                }
+                handle->addr = (dst + sizeof(struct MemoryBlock));
+                if (handle->relocate != NULL) {
+                    handle->relocate(handle);
+                }
+            }
+            dst += size;
+        } else {
+            // Pinned block: emit the hole before it as a free block and
+            // restart packing after it.
+            if (dst < (u8 *) cur) {
+                struct MemoryBlock *gap = (struct MemoryBlock *) dst;
+
+                gap->size = (u8 *) cur - dst;
+                gap->next = NULL;
+                lastGap->next = gap;
+                lastGap = gap;
+            }
+            dst = (u8 *) next;
+        }
+        cur = next;
+    }
+    // Whatever is left at the end of the pool is one contiguous free block.
+    if (dst < poolEnd) {
+        struct MemoryBlock *gap = (struct MemoryBlock *) dst;
+
+        gap->size = (poolEnd - dst);
+        gap->next = NULL;
+        lastGap->next = gap;
+    }
+}
+
+/**
+ * Allocate a relocatable block from a memory pool, recording its address in
+ * handle->addr. If the pool is too fragmented to satisfy the request, compact
+ * it and retry once. Return the address, or NULL if the pool is full.
+ */
+void *mem_pool_alloc_handle(struct MemoryPool *pool, u32 size, struct MemPoolHandle *handle) {
+    void *addr = mem_pool_alloc(pool, size);
+
+    if (addr == NULL) {
+        mem_pool_compact(pool);
+        addr = mem_pool_alloc(pool, size);
+    }
+    handle->addr = addr;
+    if (addr != NULL) {
+        ((struct MemoryBlock *) ((u8 *) addr - sizeof(struct MemoryBlock)))->next =
+            (struct MemoryBlock *) handle;
+    }
+    return addr;
+}
+
+/**
+ * Free a block that was allocated using mem_pool_alloc_handle.
+ */
+void mem_pool_free_handle(struct MemoryPool *pool, struct MemPoolHandle *handle) {
+    if (handle->addr != NULL) {
+        mem_pool_free(pool, handle->addr);
+        handle->addr = NULL;
+    }
+}
+#endif
+
+#if PUPPYPRINT_DEBUG
+/**
+ * Per-frame display list pool usage, bucketed by subsystem (see enum GfxPoolTag).
+ * The "Last" copy holds the previous frame's totals for the Puppyprint display.
+ */
+u8 gGfxPoolTag = GFX_POOL_TAG_OTHER;
+u32 gGfxPoolTagUsage[GFX_POOL_TAG_COUNT];
+u32 gGfxPoolTagUsageLast[GFX_POOL_TAG_COUNT];
+#endif
+
 void *alloc_display_list(u32 size) {
     void *ptr = NULL;
 
@@ -627,6 +2034,9 @@ void *alloc_display_list(u32 size) {
     if (gGfxPoolEnd - size >= (u8 *) gDisplayListHead) {
         gGfxPoolEnd -= size;
         ptr = gGfxPoolEnd;
+#if PUPPYPRINT_DEBUG
+        gGfxPoolTagUsage[gGfxPoolTag] += size;
+#endif
     }
     return ptr;
 }
@@ -649,7 +2059,58 @@ void setup_dma_table_list(struct DmaHandlerList *list, void *srcAddr, void *buff
     }
     list->currentAddr = NULL;
     list->bufTarget = buffer;
+#ifdef ANIM_COMPRESSION
+    list->decodeBuf = NULL;
+#endif
+}
+
+#ifdef ANIM_COMPRESSION
+
+// The converter emits numeric offsets assuming this layout.
+STATIC_ASSERT(sizeof(struct Animation) == 0x18, "The animation compression offsets assume a 0x18 byte struct Animation.");
+
+/**
+ * Metadata prefix of a compressed animation entry. Raw entries start with the
+ * Animation header instead, whose first u32 (flags << 16 | divisor) can never
+ * equal the magic, so the two are distinguishable after the DMA.
+ */
+struct AnimCompHeader {
+    u32 magic;
+    u32 rawSize;      // decoded entry size (header + indices + values)
+    u32 valuesOffset; // where the values begin in the decoded entry
+};
+
+#define ANIM_COMP_MAGIC 0x414E434Du // 'ANCM'
+
+/**
+ * Decode a delta+RLE compressed s16 value stream (the encoder lives in
+ * tools/mario_anims_converter.py). Each control byte is either an 8 bit delta
+ * from the previous value, 0x80 followed by a big-endian 16 bit delta, or
+ * 0x81 followed by a repeat count of the previous value.
+ */
+static void decode_anim_values(const u8 *src, s16 *dst, s32 count) {
+    s16 value = 0;
+    s32 i = 0;
+
+    while (i < count) {
+        u8 c = *src++;
+
+        if (c == 0x80) {
+            value += (s16)((src[0] << 8) | src[1]);
+            src += 2;
+            dst[i++] = value;
+        } else if (c == 0x81) {
+            s32 run = *src++;
+            while (run-- > 0) {
+                dst[i++] = value;
+            }
+        } else {
+            value += (s8) c;
+            dst[i++] = value;
+        }
+    }
 }
+#endif // ANIM_COMPRESSION
 
 s32 load_patchable_table(struct DmaHandlerList *list, s32 index) {
     struct DmaTable *table = list->dmaTable;
@@ -659,7 +2120,30 @@ s32 load_patchable_table(struct DmaHandlerList *list, s32 index) {
         s32 size = table->anim[index].size;
 
         if (list->currentAddr != addr) {
+#ifdef ANIM_COMPRESSION
+            if (list->decodeBuf != NULL) {
+                struct AnimCompHeader *comp = list->decodeBuf;
+
+                dma_read(list->decodeBuf, addr, addr + size);
+                if (comp->magic == ANIM_COMP_MAGIC) {
+                    u8 *raw = (u8 *) (comp + 1);
+
+                    // The header and index table are stored raw; only the
+                    // value stream is compressed.
+                    bcopy(raw, list->bufTarget, comp->valuesOffset);
+                    decode_anim_values(raw + comp->valuesOffset,
+                                       (s16 *)((u8 *) list->bufTarget + comp->valuesOffset),
+                                       (comp->rawSize - comp->valuesOffset) / 2);
+                } else {
+                    // This entry didn't compress; it was stored raw.
+                    bcopy(list->decodeBuf, list->bufTarget, size);
+                }
+            } else {
+                dma_read(list->bufTarget, addr, addr + size);
+            }
+#else
             dma_read(list->bufTarget, addr, addr + size);
+#endif
             list->currentAddr = addr;
             return TRUE;
         }
@@ -19,6 +19,11 @@ ALIGNED8 u8 gThread5Stack[0x2000];
 #if ENABLE_RUMBLE
 ALIGNED8 u8 gThread6Stack[0x2000];
 #endif
+ALIGNED8 u8 gSegmentLoaderThreadStack[0x800];
+ALIGNED8 u8 gInputPollThreadStack[0x800];
+#ifdef ASYNC_TERRAIN_LOADING
+ALIGNED8 u8 gTerrainWorkerThreadStack[0x800];
+#endif
 // 0x400 bytes
 #if UNF
 ALIGNED16 u8 gGfxSPTaskStack[SP_DRAM_STACK_SIZE8];
@@ -31,4 +36,11 @@ ALIGNED8 u8 gGfxSPTaskYieldBuffer[OS_YIELD_DATA_SIZE];
 // 0x200 bytes
 struct SaveBuffer __attribute__ ((aligned (8))) gSaveBuffer;
 // 0x190a0 bytes
+#if defined(FRAME_INTERPOLATION) || defined(PAUSE_SCENE_FREEZE)
+// Pools 0/1 double buffer the logic frames; pool 2 holds the interpolated
+// in-between frame rebuilt every frame by frame_interp_build, and stands in
+// as an overlay build target while a frozen pause scene parks another pool.
+struct GfxPool gGfxPools[3];
+#else
 struct GfxPool gGfxPools[2];
+#endif
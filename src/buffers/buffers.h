@@ -16,6 +16,11 @@ extern u8 gIdleThreadStack[];
 extern u8 gThread3Stack[];
 extern u8 gThread4Stack[];
 extern u8 gThread5Stack[];
+extern u8 gSegmentLoaderThreadStack[];
+extern u8 gInputPollThreadStack[];
+#ifdef ASYNC_TERRAIN_LOADING
+extern u8 gTerrainWorkerThreadStack[];
+#endif
 #if ENABLE_RUMBLE
 extern u8 gThread6Stack[];
 #endif
@@ -26,7 +31,11 @@ extern struct SaveBuffer gSaveBuffer;
 
 extern u8 gGfxSPTaskStack[];
 
+#if defined(FRAME_INTERPOLATION) || defined(PAUSE_SCENE_FREEZE)
+extern struct GfxPool gGfxPools[3];
+#else
 extern struct GfxPool gGfxPools[2];
+#endif
 
 extern u8 adpcmbuf[];		/* Buffer for audio records ADPCM) */
 
@@ -19,6 +19,6 @@
  * the HVQM2 data.
  * (Note) Please locate at a 16byte aligned address with the spec file.
  */
-ALIGNED16 u8 hvqbuf[HVQ_DATASIZE_MAX];
+ALIGNED16 u8 hvqbuf[NUM_HVQ_RECORD_BUFFERS * HVQ_DATASIZE_MAX];
 
 /* end */
@@ -60,21 +60,27 @@ void obj_set_opacity_from_cam_dist(struct Object *obj) {
 #undef OBJ_OPACITY_LENGTH
 #endif
 
+// Behavior command handlers receive the object being processed as a parameter
+// instead of rereading the gCurrentObject global. The global is loaded once per
+// dispatch in cur_obj_update; within a handler the object stays in a register
+// across stores and calls, which the compiler can't prove for a global.
+
 // Push the address of a behavior command to the object's behavior stack.
-static void cur_obj_bhv_stack_push(uintptr_t bhvAddr) {
-    o->bhvStack[o->bhvStackIndex] = bhvAddr;
-    o->bhvStackIndex++;
+static void cur_obj_bhv_stack_push(struct Object *obj, uintptr_t bhvAddr) {
+    DEBUG_ASSERT(obj->bhvStackIndex < BHV_STACK_SIZE);
+    obj->bhvStack[obj->bhvStackIndex] = bhvAddr;
+    obj->bhvStackIndex++;
 }
 
 // Retrieve the last behavior command address from the object's behavior stack.
-static uintptr_t cur_obj_bhv_stack_pop(void) {
-    o->bhvStackIndex--;
-    return o->bhvStack[o->bhvStackIndex];
+static uintptr_t cur_obj_bhv_stack_pop(struct Object *obj) {
+    obj->bhvStackIndex--;
+    return obj->bhvStack[obj->bhvStackIndex];
 }
 
 // Command 0x22: Hides the current object.
 // Usage: HIDE()
-static s32 bhv_cmd_hide(void) {
+static s32 bhv_cmd_hide(UNUSED struct Object *obj) {
     cur_obj_hide();
 
     gCurBhvCommand++;
@@ -83,8 +89,8 @@ static s32 bhv_cmd_hide(void) {
 
 // Command 0x35: Disables rendering for the object.
 // Usage: DISABLE_RENDERING()
-static s32 bhv_cmd_disable_rendering(void) {
-    gCurrentObject->header.gfx.node.flags &= ~GRAPH_RENDER_ACTIVE;
+static s32 bhv_cmd_disable_rendering(struct Object *obj) {
+    obj->header.gfx.node.flags &= ~GRAPH_RENDER_ACTIVE;
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -92,8 +98,8 @@ static s32 bhv_cmd_disable_rendering(void) {
 
 // Command 0x21: Billboards the current object, making it always face the camera.
 // Usage: BILLBOARD()
-static s32 bhv_cmd_billboard(void) {
-    gCurrentObject->header.gfx.node.flags |= GRAPH_RENDER_BILLBOARD;
+static s32 bhv_cmd_billboard(struct Object *obj) {
+    obj->header.gfx.node.flags |= GRAPH_RENDER_BILLBOARD;
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -101,10 +107,15 @@ static s32 bhv_cmd_billboard(void) {
 
 // Command 0x1B: Sets the current model ID of the object.
 // Usage: SET_MODEL(modelID)
-static s32 bhv_cmd_set_model(void) {
+static s32 bhv_cmd_set_model(struct Object *obj) {
     ModelID32 modelID = BHV_CMD_GET_2ND_S16(0);
 
-    gCurrentObject->header.gfx.sharedChild = gLoadedGraphNodes[modelID];
+    obj->header.gfx.sharedChild = gLoadedGraphNodes[modelID];
+#ifdef ASYNC_MODEL_LOADING
+    if (obj->header.gfx.sharedChild == NULL && modelID != MODEL_NONE) {
+        obj->header.gfx.pendingModelID = modelID;
+    }
+#endif
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -112,12 +123,12 @@ static s32 bhv_cmd_set_model(void) {
 
 // Command 0x1C: Spawns a child object with the specified model and behavior.
 // Usage: SPAWN_CHILD(modelID, behavior)
-static s32 bhv_cmd_spawn_child(void) {
+static s32 bhv_cmd_spawn_child(struct Object *obj) {
     ModelID32 model = BHV_CMD_GET_U32(1);
     const BehaviorScript *behavior = BHV_CMD_GET_VPTR(2);
 
-    struct Object *child = spawn_object_at_origin(gCurrentObject, 0, model, behavior);
-    obj_copy_pos_and_angle(child, gCurrentObject);
+    struct Object *child = spawn_object_at_origin(obj, 0, model, behavior);
+    obj_copy_pos_and_angle(child, obj);
 
     gCurBhvCommand += 3;
     return BHV_PROC_CONTINUE;
@@ -125,14 +136,14 @@ static s32 bhv_cmd_spawn_child(void) {
 
 // Command 0x2C: Spawns a new object with the specified model and behavior.
 // Usage: SPAWN_OBJ(modelID, behavior)
-static s32 bhv_cmd_spawn_obj(void) {
+static s32 bhv_cmd_spawn_obj(struct Object *obj) {
     ModelID32 model = BHV_CMD_GET_U32(1);
     const BehaviorScript *behavior = BHV_CMD_GET_VPTR(2);
 
-    struct Object *object = spawn_object_at_origin(gCurrentObject, 0, model, behavior);
-    obj_copy_pos_and_angle(object, gCurrentObject);
+    struct Object *object = spawn_object_at_origin(obj, 0, model, behavior);
+    obj_copy_pos_and_angle(object, obj);
     // TODO: Does this cmd need renaming? This line is the only difference between this and the above func.
-    gCurrentObject->prevObj = object;
+    obj->prevObj = object;
 
     gCurBhvCommand += 3;
     return BHV_PROC_CONTINUE;
@@ -140,13 +151,13 @@ static s32 bhv_cmd_spawn_obj(void) {
 
 // Command 0x29: Spawns a child object with the specified model and behavior, plus a behavior param.
 // Usage: SPAWN_CHILD_WITH_PARAM(bhvParam, modelID, behavior)
-static s32 bhv_cmd_spawn_child_with_param(void) {
+static s32 bhv_cmd_spawn_child_with_param(struct Object *obj) {
     u32 bhvParam = BHV_CMD_GET_2ND_S16(0);
     ModelID32 modelID = BHV_CMD_GET_U32(1);
     const BehaviorScript *behavior = BHV_CMD_GET_VPTR(2);
 
-    struct Object *child = spawn_object_at_origin(gCurrentObject, 0, modelID, behavior);
-    obj_copy_pos_and_angle(child, gCurrentObject);
+    struct Object *child = spawn_object_at_origin(obj, 0, modelID, behavior);
+    obj_copy_pos_and_angle(child, obj);
     child->oBehParams2ndByte = bhvParam;
 
     gCurBhvCommand += 3;
@@ -155,30 +166,30 @@ static s32 bhv_cmd_spawn_child_with_param(void) {
 
 // Command 0x1D: Exits the behavior script and despawns the object.
 // Usage: DEACTIVATE()
-static s32 bhv_cmd_deactivate(void) {
-    gCurrentObject->activeFlags = ACTIVE_FLAG_DEACTIVATED;
+static s32 bhv_cmd_deactivate(struct Object *obj) {
+    obj->activeFlags = ACTIVE_FLAG_DEACTIVATED;
     return BHV_PROC_BREAK;
 }
 
 // Command 0x0A: Exits the behavior script.
 // Usage: BREAK()
-static s32 bhv_cmd_break(void) {
+static s32 bhv_cmd_break(UNUSED struct Object *obj) {
     return BHV_PROC_BREAK;
 }
 
 // Command 0x0B: Exits the behavior script, unused.
 // Usage: BREAK_UNUSED()
-static s32 bhv_cmd_break_unused(void) {
+static s32 bhv_cmd_break_unused(UNUSED struct Object *obj) {
     return BHV_PROC_BREAK;
 }
 
 // Command 0x02: Jumps to a new behavior command and stores the return address in the object's behavior stack.
 // Usage: CALL(addr)
-static s32 bhv_cmd_call(void) {
+static s32 bhv_cmd_call(struct Object *obj) {
     const BehaviorScript *jumpAddress;
     gCurBhvCommand++;
 
-    cur_obj_bhv_stack_push(BHV_CMD_GET_ADDR_OF_CMD(1)); // Store address of the next bhv command in the stack.
+    cur_obj_bhv_stack_push(obj, BHV_CMD_GET_ADDR_OF_CMD(1)); // Store address of the next bhv command in the stack.
     jumpAddress = segmented_to_virtual(BHV_CMD_GET_VPTR(0));
     gCurBhvCommand = jumpAddress; // Jump to the new address.
 
@@ -187,20 +198,20 @@ static s32 bhv_cmd_call(void) {
 
 // Command 0x03: Jumps back to the behavior command stored in the object's behavior stack. Used after CALL.
 // Usage: RETURN()
-static s32 bhv_cmd_return(void) {
-    gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop(); // Retrieve command address and jump to it.
+static s32 bhv_cmd_return(struct Object *obj) {
+    gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop(obj); // Retrieve command address and jump to it.
     return BHV_PROC_CONTINUE;
 }
 
 // Command 0x01: Delays the behavior script for a certain number of frames.
 // Usage: DELAY(num)
-static s32 bhv_cmd_delay(void) {
+static s32 bhv_cmd_delay(struct Object *obj) {
     s16 num = BHV_CMD_GET_2ND_S16(0);
 
-    if (gCurrentObject->bhvDelayTimer < num - 1) {
-        gCurrentObject->bhvDelayTimer++; // Increment timer
+    if (obj->bhvDelayTimer < num - 1) {
+        obj->bhvDelayTimer++; // Increment timer
     } else {
-        gCurrentObject->bhvDelayTimer = 0;
+        obj->bhvDelayTimer = 0;
         gCurBhvCommand++; // Delay ended, move to next bhv command (note: following commands will not execute until next frame)
     }
 
@@ -209,14 +220,14 @@ static s32 bhv_cmd_delay(void) {
 
 // Command 0x25: Delays the behavior script for the number of frames given by the value of the specified field.
 // Usage: DELAY_VAR(field)
-static s32 bhv_cmd_delay_var(void) {
+static s32 bhv_cmd_delay_var(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
-    s32 num = cur_obj_get_int(field);
+    s32 num = obj_get_int(obj, field);
 
-    if (gCurrentObject->bhvDelayTimer < num - 1) {
-        gCurrentObject->bhvDelayTimer++; // Increment timer
+    if (obj->bhvDelayTimer < num - 1) {
+        obj->bhvDelayTimer++; // Increment timer
     } else {
-        gCurrentObject->bhvDelayTimer = 0;
+        obj->bhvDelayTimer = 0;
         gCurBhvCommand++; // Delay ended, move to next bhv command
     }
 
@@ -225,7 +236,7 @@ static s32 bhv_cmd_delay_var(void) {
 
 // Command 0x04: Jumps to a new behavior script without saving anything.
 // Usage: GOTO(addr)
-static s32 bhv_cmd_goto(void) {
+static s32 bhv_cmd_goto(UNUSED struct Object *obj) {
     gCurBhvCommand++; // Useless
     gCurBhvCommand = segmented_to_virtual(BHV_CMD_GET_VPTR(0)); // Jump directly to address
     return BHV_PROC_CONTINUE;
@@ -234,11 +245,11 @@ static s32 bhv_cmd_goto(void) {
 // Command 0x26: Unused. Marks the start of a loop that will repeat a certain number of times.
 // Uses a u8 as the argument, instead of a s16 like the other version does.
 // Usage: BEGIN_REPEAT_UNUSED(count)
-static s32 bhv_cmd_begin_repeat_unused(void) {
+static s32 bhv_cmd_begin_repeat_unused(struct Object *obj) {
     s32 count = BHV_CMD_GET_2ND_U8(0);
 
-    cur_obj_bhv_stack_push(BHV_CMD_GET_ADDR_OF_CMD(1)); // Store address of the first command of the loop in the stack
-    cur_obj_bhv_stack_push(count); // Store repeat count in the stack too
+    cur_obj_bhv_stack_push(obj, BHV_CMD_GET_ADDR_OF_CMD(1)); // Store address of the first command of the loop in the stack
+    cur_obj_bhv_stack_push(obj, count); // Store repeat count in the stack too
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -246,11 +257,11 @@ static s32 bhv_cmd_begin_repeat_unused(void) {
 
 // Command 0x05: Marks the start of a loop that will repeat a certain number of times.
 // Usage: BEGIN_REPEAT(count)
-static s32 bhv_cmd_begin_repeat(void) {
+static s32 bhv_cmd_begin_repeat(struct Object *obj) {
     s32 count = BHV_CMD_GET_2ND_S16(0);
 
-    cur_obj_bhv_stack_push(BHV_CMD_GET_ADDR_OF_CMD(1)); // Store address of the first command of the loop in the stack
-    cur_obj_bhv_stack_push(count); // Store repeat count in the stack too
+    cur_obj_bhv_stack_push(obj, BHV_CMD_GET_ADDR_OF_CMD(1)); // Store address of the first command of the loop in the stack
+    cur_obj_bhv_stack_push(obj, count); // Store repeat count in the stack too
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -258,16 +269,16 @@ static s32 bhv_cmd_begin_repeat(void) {
 
 // Command 0x06: Marks the end of a repeating loop.
 // Usage: END_REPEAT()
-static s32 bhv_cmd_end_repeat(void) {
-    u32 count = cur_obj_bhv_stack_pop() - 1; // Retrieve loop count from the stack.
+static s32 bhv_cmd_end_repeat(struct Object *obj) {
+    u32 count = cur_obj_bhv_stack_pop(obj) - 1; // Retrieve loop count from the stack.
 
     if (count != 0) {
-        gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop(); // Jump back to the first command in the loop
+        gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop(obj); // Jump back to the first command in the loop
         // Save address and count to the stack again
-        cur_obj_bhv_stack_push(BHV_CMD_GET_ADDR_OF_CMD(0));
-        cur_obj_bhv_stack_push(count);
+        cur_obj_bhv_stack_push(obj, BHV_CMD_GET_ADDR_OF_CMD(0));
+        cur_obj_bhv_stack_push(obj, count);
     } else { // Finished iterating over the loop
-        cur_obj_bhv_stack_pop(); // Necessary to remove address from the stack
+        cur_obj_bhv_stack_pop(obj); // Necessary to remove address from the stack
         gCurBhvCommand++;
     }
 
@@ -277,16 +288,16 @@ static s32 bhv_cmd_end_repeat(void) {
 
 // Command 0x07: Also marks the end of a repeating loop, but continues executing commands following the loop on the same frame.
 // Usage: END_REPEAT_CONTINUE()
-static s32 bhv_cmd_end_repeat_continue(void) {
-    u32 count = cur_obj_bhv_stack_pop() - 1;
+static s32 bhv_cmd_end_repeat_continue(struct Object *obj) {
+    u32 count = cur_obj_bhv_stack_pop(obj) - 1;
 
     if (count != 0) {
-        gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop(); // Jump back to the first command in the loop
+        gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop(obj); // Jump back to the first command in the loop
         // Save address and count to the stack again
-        cur_obj_bhv_stack_push(BHV_CMD_GET_ADDR_OF_CMD(0));
-        cur_obj_bhv_stack_push(count);
+        cur_obj_bhv_stack_push(obj, BHV_CMD_GET_ADDR_OF_CMD(0));
+        cur_obj_bhv_stack_push(obj, count);
     } else { // Finished iterating over the loop
-        cur_obj_bhv_stack_pop(); // Necessary to remove address from the stack
+        cur_obj_bhv_stack_pop(obj); // Necessary to remove address from the stack
         gCurBhvCommand++;
     }
 
@@ -296,8 +307,8 @@ static s32 bhv_cmd_end_repeat_continue(void) {
 
 // Command 0x08: Marks the beginning of an infinite loop.
 // Usage: BEGIN_LOOP()
-static s32 bhv_cmd_begin_loop(void) {
-    cur_obj_bhv_stack_push(BHV_CMD_GET_ADDR_OF_CMD(1)); // Store address of the first command of the loop in the stack
+static s32 bhv_cmd_begin_loop(struct Object *obj) {
+    cur_obj_bhv_stack_push(obj, BHV_CMD_GET_ADDR_OF_CMD(1)); // Store address of the first command of the loop in the stack
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -305,17 +316,16 @@ static s32 bhv_cmd_begin_loop(void) {
 
 // Command 0x09: Marks the end of an infinite loop.
 // Usage: END_LOOP()
-static s32 bhv_cmd_end_loop(void) {
-    gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop(); // Jump back to the first command in the loop
-    cur_obj_bhv_stack_push(BHV_CMD_GET_ADDR_OF_CMD(0)); // Save address to the stack again
+static s32 bhv_cmd_end_loop(struct Object *obj) {
+    gCurBhvCommand = (const BehaviorScript *) cur_obj_bhv_stack_pop(obj); // Jump back to the first command in the loop
+    cur_obj_bhv_stack_push(obj, BHV_CMD_GET_ADDR_OF_CMD(0)); // Save address to the stack again
 
     return BHV_PROC_BREAK;
 }
 
 // Command 0x0C: Executes a native game function. Function must not take or return any values.
 // Usage: CALL_NATIVE(func)
-typedef void (*NativeBhvFunc)(void);
-static s32 bhv_cmd_call_native(void) {
+static s32 bhv_cmd_call_native(UNUSED struct Object *obj) {
     NativeBhvFunc behaviorFunc = BHV_CMD_GET_VPTR(1);
 
     behaviorFunc();
@@ -326,11 +336,11 @@ static s32 bhv_cmd_call_native(void) {
 
 // Command 0x0E: Sets the specified field to a float.
 // Usage: SET_FLOAT(field, value)
-static s32 bhv_cmd_set_float(void) {
+static s32 bhv_cmd_set_float(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     f32 value = BHV_CMD_GET_2ND_S16(0);
 
-    cur_obj_set_float(field, value);
+    obj_set_float(obj, field, value);
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -338,22 +348,22 @@ static s32 bhv_cmd_set_float(void) {
 
 // Command 0x10: Sets the specified field to an integer.
 // Usage: SET_INT(field, value)
-static s32 bhv_cmd_set_int(void) {
+static s32 bhv_cmd_set_int(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s16 value = BHV_CMD_GET_2ND_S16(0);
 
-    cur_obj_set_int(field, value);
+    obj_set_int(obj, field, value);
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
 }
 
 // Command 0x36: Unused. Sets the specified field to an integer. Wastes 4 bytes of space for no reason at all.
-static s32 bhv_cmd_set_int_unused(void) {
+static s32 bhv_cmd_set_int_unused(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s32 value = BHV_CMD_GET_2ND_S16(1); // Taken from 2nd word instead of 1st
 
-    cur_obj_set_int(field, value);
+    obj_set_int(obj, field, value);
 
     gCurBhvCommand += 2; // Twice as long
     return BHV_PROC_CONTINUE;
@@ -361,12 +371,12 @@ static s32 bhv_cmd_set_int_unused(void) {
 
 // Command 0x14: Sets the specified field to a random float in the given range.
 // Usage: SET_RANDOM_FLOAT(field, min, range)
-static s32 bhv_cmd_set_random_float(void) {
+static s32 bhv_cmd_set_random_float(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     f32 min = BHV_CMD_GET_2ND_S16(0);
     f32 range = BHV_CMD_GET_1ST_S16(1);
 
-    cur_obj_set_float(field, (range * random_float()) + min);
+    obj_set_float(obj, field, (range * random_float()) + min);
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -374,12 +384,12 @@ static s32 bhv_cmd_set_random_float(void) {
 
 // Command 0x15: Sets the specified field to a random integer in the given range.
 // Usage: SET_RANDOM_INT(field, min, range)
-static s32 bhv_cmd_set_random_int(void) {
+static s32 bhv_cmd_set_random_int(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s32 min = BHV_CMD_GET_2ND_S16(0);
     s32 range = BHV_CMD_GET_1ST_S16(1);
 
-    cur_obj_set_int(field, (s32)(range * random_float()) + min);
+    obj_set_int(obj, field, (s32)(range * random_float()) + min);
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -387,12 +397,12 @@ static s32 bhv_cmd_set_random_int(void) {
 
 // Command 0x13: Gets a random short, right shifts it the specified amount and adds min to it, then sets the specified field to that value.
 // Usage: SET_INT_RAND_RSHIFT(field, min, rshift)
-static s32 bhv_cmd_set_int_rand_rshift(void) {
+static s32 bhv_cmd_set_int_rand_rshift(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s32 min = BHV_CMD_GET_2ND_S16(0);
     s32 rshift = BHV_CMD_GET_1ST_S16(1);
 
-    cur_obj_set_int(field, (random_u16() >> rshift) + min);
+    obj_set_int(obj, field, (random_u16() >> rshift) + min);
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -400,12 +410,12 @@ static s32 bhv_cmd_set_int_rand_rshift(void) {
 
 // Command 0x16: Adds a random float in the given range to the specified field.
 // Usage: ADD_RANDOM_FLOAT(field, min, range)
-static s32 bhv_cmd_add_random_float(void) {
+static s32 bhv_cmd_add_random_float(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     f32 min = BHV_CMD_GET_2ND_S16(0);
     f32 range = BHV_CMD_GET_1ST_S16(1);
 
-    cur_obj_set_float(field, cur_obj_get_float(field) + min + (range * random_float()));
+    obj_set_float(obj, field, obj_get_float(obj, field) + min + (range * random_float()));
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -413,13 +423,13 @@ static s32 bhv_cmd_add_random_float(void) {
 
 // Command 0x17: Gets a random short, right shifts it the specified amount and adds min to it, then adds the value to the specified field. Unused.
 // Usage: ADD_INT_RAND_RSHIFT(field, min, rshift)
-static s32 bhv_cmd_add_int_rand_rshift(void) {
+static s32 bhv_cmd_add_int_rand_rshift(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s32 min = BHV_CMD_GET_2ND_S16(0);
     s32 rshift = BHV_CMD_GET_1ST_S16(1);
     s32 rnd = random_u16();
 
-    cur_obj_set_int(field, (cur_obj_get_int(field) + min) + (rnd >> rshift));
+    obj_set_int(obj, field, (obj_get_int(obj, field) + min) + (rnd >> rshift));
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -427,11 +437,11 @@ static s32 bhv_cmd_add_int_rand_rshift(void) {
 
 // Command 0x0D: Adds a float to the specified field.
 // Usage: ADD_FLOAT(field, value)
-static s32 bhv_cmd_add_float(void) {
+static s32 bhv_cmd_add_float(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     f32 value = BHV_CMD_GET_2ND_S16(0);
 
-    cur_obj_add_float(field, value);
+    obj_add_float(obj, field, value);
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -439,11 +449,11 @@ static s32 bhv_cmd_add_float(void) {
 
 // Command 0x0F: Adds an integer to the specified field.
 // Usage: ADD_INT(field, value)
-static s32 bhv_cmd_add_int(void) {
+static s32 bhv_cmd_add_int(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s16 value = BHV_CMD_GET_2ND_S16(0);
 
-    cur_obj_add_int(field, value);
+    obj_add_int(obj, field, value);
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -452,12 +462,12 @@ static s32 bhv_cmd_add_int(void) {
 // Command 0x11: Performs a bitwise OR with the specified field and the given integer.
 // Usually used to set an object's flags.
 // Usage: OR_INT(field, value)
-static s32 bhv_cmd_or_int(void) {
+static s32 bhv_cmd_or_int(struct Object *obj) {
     u8 objectOffset = BHV_CMD_GET_2ND_U8(0);
     s32 value = BHV_CMD_GET_2ND_S16(0);
 
     value &= 0xFFFF;
-    cur_obj_or_int(objectOffset, value);
+    obj_or_int(obj, objectOffset, value);
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -465,12 +475,12 @@ static s32 bhv_cmd_or_int(void) {
 
 // Command 0x12: Performs a bit clear with the specified short. Unused.
 // Usage: BIT_CLEAR(field, value)
-static s32 bhv_cmd_bit_clear(void) {
+static s32 bhv_cmd_bit_clear(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s32 value = BHV_CMD_GET_2ND_S16(0);
 
     value = (value & 0xFFFF) ^ 0xFFFF;
-    cur_obj_and_int(field, value);
+    obj_and_int(obj, field, value);
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -478,10 +488,10 @@ static s32 bhv_cmd_bit_clear(void) {
 
 // Command 0x27: Loads the animations for the object. <field> is always set to oAnimations.
 // Usage: LOAD_ANIMATIONS(field, anims)
-static s32 bhv_cmd_load_animations(void) {
+static s32 bhv_cmd_load_animations(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
 
-    cur_obj_set_vptr(field, BHV_CMD_GET_VPTR(1));
+    obj_set_vptr(obj, field, BHV_CMD_GET_VPTR(1));
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -489,11 +499,11 @@ static s32 bhv_cmd_load_animations(void) {
 
 // Command 0x28: Begins animation and sets the object's current animation index to the specified value.
 // Usage: ANIMATE(animIndex)
-static s32 bhv_cmd_animate(void) {
+static s32 bhv_cmd_animate(struct Object *obj) {
     s32 animIndex = BHV_CMD_GET_2ND_U8(0);
-    struct Animation **animations = gCurrentObject->oAnimations;
+    struct Animation **animations = obj->oAnimations;
 
-    geo_obj_init_animation(&gCurrentObject->header.gfx, &animations[animIndex]);
+    geo_obj_init_animation(&obj->header.gfx, &animations[animIndex]);
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -501,10 +511,10 @@ static s32 bhv_cmd_animate(void) {
 
 // Command 0x1E: Finds the floor triangle directly under the object and moves the object down to it.
 // Usage: DROP_TO_FLOOR()
-static s32 bhv_cmd_drop_to_floor(void) {
-    f32 floor = find_floor_height(gCurrentObject->oPosX, gCurrentObject->oPosY + 200.0f, gCurrentObject->oPosZ);
-    gCurrentObject->oPosY = floor;
-    gCurrentObject->oMoveFlags |= OBJ_MOVE_ON_GROUND;
+static s32 bhv_cmd_drop_to_floor(struct Object *obj) {
+    f32 floor = find_floor_height(obj->oPosX, obj->oPosY + 200.0f, obj->oPosZ);
+    obj->oPosY = floor;
+    obj->oMoveFlags |= OBJ_MOVE_ON_GROUND;
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -512,7 +522,7 @@ static s32 bhv_cmd_drop_to_floor(void) {
 
 // Command 0x18: No operation. Unused.
 // Usage: CMD_NOP_1(field)
-static s32 bhv_cmd_nop_1(void) {
+static s32 bhv_cmd_nop_1(UNUSED struct Object *obj) {
     UNUSED u8 field = BHV_CMD_GET_2ND_U8(0);
 
     gCurBhvCommand++;
@@ -521,7 +531,7 @@ static s32 bhv_cmd_nop_1(void) {
 
 // Command 0x1A: No operation. Unused.
 // Usage: CMD_NOP_3(field)
-static s32 bhv_cmd_nop_3(void) {
+static s32 bhv_cmd_nop_3(UNUSED struct Object *obj) {
     UNUSED u8 field = BHV_CMD_GET_2ND_U8(0);
 
     gCurBhvCommand++;
@@ -530,7 +540,7 @@ static s32 bhv_cmd_nop_3(void) {
 
 // Command 0x19: No operation. Unused.
 // Usage: CMD_NOP_2(field)
-static s32 bhv_cmd_nop_2(void) {
+static s32 bhv_cmd_nop_2(UNUSED struct Object *obj) {
     UNUSED u8 field = BHV_CMD_GET_2ND_U8(0);
 
     gCurBhvCommand++;
@@ -539,12 +549,12 @@ static s32 bhv_cmd_nop_2(void) {
 
 // Command 0x1F: Sets the destination float field to the sum of the values of the given float fields.
 // Usage: SUM_FLOAT(fieldDst, fieldSrc1, fieldSrc2)
-static s32 bhv_cmd_sum_float(void) {
+static s32 bhv_cmd_sum_float(struct Object *obj) {
     u32 fieldDst = BHV_CMD_GET_2ND_U8(0);
     u32 fieldSrc1 = BHV_CMD_GET_3RD_U8(0);
     u32 fieldSrc2 = BHV_CMD_GET_4TH_U8(0);
 
-    cur_obj_set_float(fieldDst, cur_obj_get_float(fieldSrc1) + cur_obj_get_float(fieldSrc2));
+    obj_set_float(obj, fieldDst, obj_get_float(obj, fieldSrc1) + obj_get_float(obj, fieldSrc2));
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -552,12 +562,12 @@ static s32 bhv_cmd_sum_float(void) {
 
 // Command 0x20: Sets the destination integer field to the sum of the values of the given integer fields. Unused.
 // Usage: SUM_INT(fieldDst, fieldSrc1, fieldSrc2)
-static s32 bhv_cmd_sum_int(void) {
+static s32 bhv_cmd_sum_int(struct Object *obj) {
     u32 fieldDst = BHV_CMD_GET_2ND_U8(0);
     u32 fieldSrc1 = BHV_CMD_GET_3RD_U8(0);
     u32 fieldSrc2 = BHV_CMD_GET_4TH_U8(0);
 
-    cur_obj_set_int(fieldDst, cur_obj_get_int(fieldSrc1) + cur_obj_get_int(fieldSrc2));
+    obj_set_int(obj, fieldDst, obj_get_int(obj, fieldSrc1) + obj_get_int(obj, fieldSrc2));
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -565,12 +575,12 @@ static s32 bhv_cmd_sum_int(void) {
 
 // Command 0x23: Sets the size of the object's cylindrical hitbox.
 // Usage: SET_HITBOX(radius, height)
-static s32 bhv_cmd_set_hitbox(void) {
+static s32 bhv_cmd_set_hitbox(struct Object *obj) {
     s16 radius = BHV_CMD_GET_1ST_S16(1);
     s16 height = BHV_CMD_GET_2ND_S16(1);
 
-    gCurrentObject->hitboxRadius = radius;
-    gCurrentObject->hitboxHeight = height;
+    obj->hitboxRadius = radius;
+    obj->hitboxHeight = height;
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -578,12 +588,12 @@ static s32 bhv_cmd_set_hitbox(void) {
 
 // Command 0x2E: Sets the size of the object's cylindrical hurtbox.
 // Usage: SET_HURTBOX(radius, height)
-static s32 bhv_cmd_set_hurtbox(void) {
+static s32 bhv_cmd_set_hurtbox(struct Object *obj) {
     s16 radius = BHV_CMD_GET_1ST_S16(1);
     s16 height = BHV_CMD_GET_2ND_S16(1);
 
-    gCurrentObject->hurtboxRadius = radius;
-    gCurrentObject->hurtboxHeight = height;
+    obj->hurtboxRadius = radius;
+    obj->hurtboxHeight = height;
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -591,14 +601,14 @@ static s32 bhv_cmd_set_hurtbox(void) {
 
 // Command 0x2B: Sets the size of the object's cylindrical hitbox, and applies a downwards offset.
 // Usage: SET_HITBOX_WITH_OFFSET(radius, height, downOffset)
-static s32 bhv_cmd_set_hitbox_with_offset(void) {
+static s32 bhv_cmd_set_hitbox_with_offset(struct Object *obj) {
     s16 radius = BHV_CMD_GET_1ST_S16(1);
     s16 height = BHV_CMD_GET_2ND_S16(1);
     s16 downOffset = BHV_CMD_GET_1ST_S16(2);
 
-    gCurrentObject->hitboxRadius = radius;
-    gCurrentObject->hitboxHeight = height;
-    gCurrentObject->hitboxDownOffset = downOffset;
+    obj->hitboxRadius = radius;
+    obj->hitboxHeight = height;
+    obj->hitboxDownOffset = downOffset;
 
     gCurBhvCommand += 3;
     return BHV_PROC_CONTINUE;
@@ -606,7 +616,7 @@ static s32 bhv_cmd_set_hitbox_with_offset(void) {
 
 // Command 0x24: No operation. Unused.
 // Usage: CMD_NOP_4(field, value)
-static s32 bhv_cmd_nop_4(void) {
+static s32 bhv_cmd_nop_4(UNUSED struct Object *obj) {
     UNUSED s16 field = BHV_CMD_GET_2ND_U8(0);
     UNUSED s16 value = BHV_CMD_GET_2ND_S16(0);
 
@@ -617,7 +627,7 @@ static s32 bhv_cmd_nop_4(void) {
 // Command 0x00: Defines the start of the behavior script as well as the object list the object belongs to.
 // Has some special behavior for certain objects.
 // Usage: BEGIN(objList)
-static s32 bhv_cmd_begin(void) {
+static s32 bhv_cmd_begin(UNUSED struct Object *obj) {
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
 }
@@ -625,7 +635,7 @@ static s32 bhv_cmd_begin(void) {
 // Command 0x??: Sets the specified field to a random entry in the given table, up to size 16.
 // Bytes: ?? FF SS SS V1 V1 V2 V2 V3 V3 V4 V4... ...V15 V15 V16 V16 (no macro exists)
 // F -> field, S -> table size, V1, V2, etc. -> table entries (up to 16)
-UNUSED static s32 bhv_cmd_set_int_random_from_table(void) {
+UNUSED static s32 bhv_cmd_set_int_random_from_table(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     // Retrieve tableSize from the bhv command instead of as a parameter.
     s16 tableSize = BHV_CMD_GET_2ND_S16(0); // tableSize should not be greater than 16
@@ -639,7 +649,7 @@ UNUSED static s32 bhv_cmd_set_int_random_from_table(void) {
     }
 
     // Set the field to a random entry of the table.
-    cur_obj_set_int(field, table[(s32)(tableSize * random_float())]);
+    obj_set_int(obj, field, table[(s32)(tableSize * random_float())]);
 
     gCurBhvCommand += (tableSize / 2) + 1;
     return BHV_PROC_CONTINUE;
@@ -647,10 +657,10 @@ UNUSED static s32 bhv_cmd_set_int_random_from_table(void) {
 
 // Command 0x2A: Loads collision data for the object.
 // Usage: LOAD_COLLISION_DATA(collisionData)
-static s32 bhv_cmd_load_collision_data(void) {
+static s32 bhv_cmd_load_collision_data(struct Object *obj) {
     u32 *collisionData = segmented_to_virtual(BHV_CMD_GET_VPTR(1));
 
-    gCurrentObject->collisionData = collisionData;
+    obj->collisionData = collisionData;
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -658,8 +668,8 @@ static s32 bhv_cmd_load_collision_data(void) {
 
 // Command 0x2D: Sets the home position of the object to its current position.
 // Usage: SET_HOME()
-static s32 bhv_cmd_set_home(void) {
-    vec3f_copy(&o->oHomeVec, &o->oPosVec);
+static s32 bhv_cmd_set_home(struct Object *obj) {
+    vec3f_copy(&obj->oHomeVec, &obj->oPosVec);
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
@@ -667,8 +677,8 @@ static s32 bhv_cmd_set_home(void) {
 
 // Command 0x2F: Sets the object's interaction type.
 // Usage: SET_INTERACT_TYPE(type)
-static s32 bhv_cmd_set_interact_type(void) {
-    gCurrentObject->oInteractType = BHV_CMD_GET_U32(1);
+static s32 bhv_cmd_set_interact_type(struct Object *obj) {
+    obj->oInteractType = BHV_CMD_GET_U32(1);
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -676,8 +686,8 @@ static s32 bhv_cmd_set_interact_type(void) {
 
 // Command 0x31: Sets the object's interaction subtype. Unused.
 // Usage: SET_INTERACT_SUBTYPE(subtype)
-static s32 bhv_cmd_set_interact_subtype(void) {
-    gCurrentObject->oInteractionSubtype = BHV_CMD_GET_U32(1);
+static s32 bhv_cmd_set_interact_subtype(struct Object *obj) {
+    obj->oInteractionSubtype = BHV_CMD_GET_U32(1);
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -685,7 +695,7 @@ static s32 bhv_cmd_set_interact_subtype(void) {
 
 // Command 0x32: Sets the object's size to the specified percentage.
 // Usage: SCALE(unusedField, percent)
-static s32 bhv_cmd_scale(void) {
+static s32 bhv_cmd_scale(UNUSED struct Object *obj) {
     UNUSED u8 unusedField = BHV_CMD_GET_2ND_U8(0);
     s16 percent = BHV_CMD_GET_2ND_S16(0);
 
@@ -698,13 +708,13 @@ static s32 bhv_cmd_scale(void) {
 
 // Command 0x30: Sets various parameters that the object uses for calculating physics.
 // Usage: SET_OBJ_PHYSICS(wallHitboxRadius, gravity, bounciness, dragStrength, friction, buoyancy, unused1, unused2)
-static s32 bhv_cmd_set_obj_physics(void) {
-    gCurrentObject->oWallHitboxRadius = BHV_CMD_GET_1ST_S16(1);
-    gCurrentObject->oGravity = BHV_CMD_GET_2ND_S16(1) / 100.0f;
-    gCurrentObject->oBounciness = BHV_CMD_GET_1ST_S16(2) / 100.0f;
-    gCurrentObject->oDragStrength = BHV_CMD_GET_2ND_S16(2) / 100.0f;
-    gCurrentObject->oFriction = BHV_CMD_GET_1ST_S16(3) / 100.0f;
-    gCurrentObject->oBuoyancy = BHV_CMD_GET_2ND_S16(3) / 100.0f;
+static s32 bhv_cmd_set_obj_physics(struct Object *obj) {
+    obj->oWallHitboxRadius = BHV_CMD_GET_1ST_S16(1);
+    obj->oGravity = BHV_CMD_GET_2ND_S16(1) / 100.0f;
+    obj->oBounciness = BHV_CMD_GET_1ST_S16(2) / 100.0f;
+    obj->oDragStrength = BHV_CMD_GET_2ND_S16(2) / 100.0f;
+    obj->oFriction = BHV_CMD_GET_1ST_S16(3) / 100.0f;
+    obj->oBuoyancy = BHV_CMD_GET_2ND_S16(3) / 100.0f;
 
     UNUSED f32 unused1 = BHV_CMD_GET_1ST_S16(4) / 100.0f;
     UNUSED f32 unused2 = BHV_CMD_GET_2ND_S16(4) / 100.0f;
@@ -716,12 +726,12 @@ static s32 bhv_cmd_set_obj_physics(void) {
 // Command 0x33: Performs a bit clear on the object's parent's field with the specified value.
 // Used for clearing active particle flags fron Mario's object.
 // Usage: PARENT_BIT_CLEAR(field, value)
-static s32 bhv_cmd_parent_bit_clear(void) {
+static s32 bhv_cmd_parent_bit_clear(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s32 value = BHV_CMD_GET_U32(1);
 
     value ^= 0xFFFFFFFF;
-    obj_and_int(gCurrentObject->parentObj, field, value);
+    obj_and_int(obj->parentObj, field, value);
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -729,10 +739,10 @@ static s32 bhv_cmd_parent_bit_clear(void) {
 
 // Command 0x37: Spawns a water droplet with the given parameters.
 // Usage: SPAWN_WATER_DROPLET(dropletParams)
-static s32 bhv_cmd_spawn_water_droplet(void) {
+static s32 bhv_cmd_spawn_water_droplet(struct Object *obj) {
     struct WaterDropletParams *dropletParams = BHV_CMD_GET_VPTR(1);
 
-    spawn_water_droplet(gCurrentObject, dropletParams);
+    spawn_water_droplet(obj, dropletParams);
 
     gCurBhvCommand += 2;
     return BHV_PROC_CONTINUE;
@@ -740,20 +750,20 @@ static s32 bhv_cmd_spawn_water_droplet(void) {
 
 // Command 0x34: Animates an object using texture animation. <field> is always set to oAnimState.
 // Usage: ANIMATE_TEXTURE(field, rate)
-static s32 bhv_cmd_animate_texture(void) {
+static s32 bhv_cmd_animate_texture(struct Object *obj) {
     u8 field = BHV_CMD_GET_2ND_U8(0);
     s16 rate = BHV_CMD_GET_2ND_S16(0);
 
     // Increase the field (oAnimState) by 1 every <rate> frames.
     if ((gGlobalTimer % rate) == 0) {
-        cur_obj_add_int(field, 1);
+        obj_add_int(obj, field, 1);
     }
 
     gCurBhvCommand++;
     return BHV_PROC_CONTINUE;
 }
 
-typedef s32 (*BhvCommandProc)(void);
+typedef s32 (*BhvCommandProc)(struct Object *obj);
 static BhvCommandProc BehaviorCmdTable[] = {
     /*BHV_CMD_BEGIN                 */ bhv_cmd_begin,
     /*BHV_CMD_DELAY                 */ bhv_cmd_delay,
@@ -813,24 +823,169 @@ static BhvCommandProc BehaviorCmdTable[] = {
     /*BHV_CMD_SPAWN_WATER_DROPLET   */ bhv_cmd_spawn_water_droplet,
 };
 
+#if PUPPYPRINT_DEBUG
+// Per-behavior cycle accounting for the puppyprint "Behaviors" page. Each
+// frame, cur_obj_update adds its cost to the entry for the object's behavior
+// script; bhv_profiling_frame_done snapshots and resets the table.
+struct BhvProfileEntry sBhvProfile[BHV_PROFILE_MAX_BEHAVIORS];
+static s32 sBhvProfileLen = 0;
+struct BhvProfileEntry gBhvProfileSnapshot[BHV_PROFILE_MAX_BEHAVIORS];
+s32 gBhvProfileSnapshotLen = 0;
+
+static void bhv_profiling_add(const BehaviorScript *behavior, u32 cycles) {
+    s32 i;
+
+    for (i = 0; i < sBhvProfileLen; i++) {
+        if (sBhvProfile[i].behavior == behavior) {
+            sBhvProfile[i].cycles += cycles;
+            sBhvProfile[i].count++;
+            return;
+        }
+    }
+    if (sBhvProfileLen < BHV_PROFILE_MAX_BEHAVIORS) {
+        sBhvProfile[sBhvProfileLen].behavior = behavior;
+        sBhvProfile[sBhvProfileLen].cycles = cycles;
+        sBhvProfile[sBhvProfileLen].count = 1;
+        sBhvProfileLen++;
+    }
+}
+
+/**
+ * Publish this frame's per-behavior totals for the profiler display and start
+ * a fresh frame. Called once per frame after all object updates.
+ */
+void bhv_profiling_frame_done(void) {
+    s32 i;
+
+    for (i = 0; i < sBhvProfileLen; i++) {
+        gBhvProfileSnapshot[i] = sBhvProfile[i];
+    }
+    gBhvProfileSnapshotLen = sBhvProfileLen;
+    sBhvProfileLen = 0;
+}
+#endif
+
+#ifdef OBJ_UPDATE_THROTTLING
+/**
+ * Whether the current object's behavior script should be skipped this frame.
+ * Objects opt in with OBJ_FLAG_UPDATE_THROTTLED (alongside
+ * OBJ_FLAG_COMPUTE_DIST_TO_MARIO, which supplies the distance) and then run
+ * their script every 2nd frame beyond OBJ_THROTTLE_HALF_RATE_DIST and every
+ * 4th beyond OBJ_THROTTLE_QUARTER_RATE_DIST. The flag-driven movement and
+ * graphics processing after the script still runs on skipped frames.
+ */
+static s32 cur_obj_is_throttled_this_frame(u32 objFlags, f32 distanceFromMario) {
+    s32 rate;
+
+    if (!(objFlags & OBJ_FLAG_UPDATE_THROTTLED)
+     || (o->oHeldState != HELD_FREE)
+     || (distanceFromMario < OBJ_THROTTLE_HALF_RATE_DIST)) {
+        return FALSE;
+    }
+
+    rate = (distanceFromMario > OBJ_THROTTLE_QUARTER_RATE_DIST) ? 4 : 2;
+
+    // Stagger by pool slot so a crowd doesn't run its scripts in lockstep.
+    return (((gGlobalTimer + (u32)(o - gObjectPool)) % rate) != 0);
+}
+#endif
+
+#ifdef BHV_LOD_TIERS
+/**
+ * Look up a behavior's LOD registration. Called when a behavior is assigned
+ * (create_object, obj_set_behavior), not per frame; the result is cached in
+ * o->behaviorLodTier.
+ */
+const struct BehaviorLodTier *bhv_lod_find_tier(const BehaviorScript *behavior) {
+    const struct BehaviorLodTier *tier;
+
+    for (tier = gBehaviorLodTiers; tier->behavior != NULL; tier++) {
+        if (segmented_to_virtual(tier->behavior) == behavior) {
+            return tier;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Run the current object's far or dormant LOD tier if it is registered for one
+ * and Mario is beyond its farDist. Returns TRUE if a tier ran in place of the
+ * behavior script. oTimer and the action-change reset are maintained here just
+ * like the script path does, so the script resumes with consistent time when
+ * the object comes near again. Held objects always run their full script.
+ */
+static s32 cur_obj_lod_update(f32 distanceFromMario) {
+    const struct BehaviorLodTier *tier = o->behaviorLodTier;
+
+    if ((tier == NULL)
+     || (o->oHeldState != HELD_FREE)
+     || (distanceFromMario < tier->farDist)) {
+        return FALSE;
+    }
+
+    if ((tier->farUpdate != NULL)
+     && ((tier->dormantDist == 0.0f) || (distanceFromMario < tier->dormantDist))) {
+        tier->farUpdate();
+    }
+
+    if (o->oTimer < 0x3FFFFFFF) {
+        o->oTimer++;
+    }
+
+    if (o->oAction != o->oPrevAction) {
+        o->oTimer = 0;
+        o->oSubAction = 0;
+        o->oPrevAction = o->oAction;
+    }
+
+    return TRUE;
+}
+#endif
+
 // Execute the behavior script of the current object, process the object flags, and other miscellaneous code for updating objects.
 void cur_obj_update(void) {
+    struct Object *obj = o; // Passed into the behavior command handlers.
     u32 objFlags = o->oFlags;
     f32 distanceFromMario;
     BhvCommandProc bhvCmdProc;
     s32 bhvProcResult;
+#if PUPPYPRINT_DEBUG
+    u32 updateStartCycles = osGetCount();
+#endif
 
     // Calculate the distance from the object to Mario.
     if (objFlags & OBJ_FLAG_COMPUTE_DIST_TO_MARIO) {
+#ifdef MARIO_PROXIMITY_CACHE
+        o->oDistanceToMario = obj_dist_to_mario(o);
+#else
         o->oDistanceToMario = dist_between_objects(o, gMarioObject);
+#endif
         distanceFromMario = o->oDistanceToMario;
     } else {
+#ifdef BHV_LOD_TIERS
+        // Tiered behaviors need a distance even without
+        // OBJ_FLAG_COMPUTE_DIST_TO_MARIO (oDistanceToMario stays untouched).
+        if (o->behaviorLodTier != NULL) {
+#ifdef MARIO_PROXIMITY_CACHE
+            distanceFromMario = obj_dist_to_mario(o);
+#else
+            distanceFromMario = dist_between_objects(o, gMarioObject);
+#endif
+        } else {
+            distanceFromMario = 0.0f;
+        }
+#else
         distanceFromMario = 0.0f;
+#endif
     }
 
     // Calculate the angle from the object to Mario.
     if (objFlags & OBJ_FLAG_COMPUTE_ANGLE_TO_MARIO) {
+#ifdef MARIO_PROXIMITY_CACHE
+        o->oAngleToMario = obj_angle_to_mario(o);
+#else
         o->oAngleToMario = obj_angle_to_object(o, gMarioObject);
+#endif
     }
 
     // If the object's action has changed, reset the action timer.
@@ -840,15 +995,38 @@ void cur_obj_update(void) {
         o->oPrevAction = o->oAction;
     }
 
-    // Execute the behavior script.
-    gCurBhvCommand = o->curBhvCommand;
+    // Execute the behavior script (or this object's far LOD tier in its place).
+#ifdef BHV_LOD_TIERS
+    if (!cur_obj_lod_update(distanceFromMario)) {
+#endif
+#ifdef OBJ_UPDATE_THROTTLING
+    if (!cur_obj_is_throttled_this_frame(objFlags, distanceFromMario)) {
+#endif
+#ifdef BHV_NATIVE_LOOP_FAST_PATH
+    // Most behaviors settle into a BEGIN_LOOP / CALL_NATIVE / END_LOOP steady
+    // state. A full frame of script is then one native call plus interpreter
+    // bookkeeping that nets out to nothing: CALL_NATIVE (0x0C) advances past
+    // itself and END_LOOP (0x09) pops the loop start off the stack only to push
+    // it straight back, leaving curBhvCommand where it started. Recognize that
+    // shape at the resume point and call the function directly, skipping the
+    // fetch/decode loop. If the native switches the object's behavior it writes
+    // o->curBhvCommand itself, so not writing it back here is still correct.
+    // Anything else (delays, repeats, dynamic jumps) takes the interpreter.
+    if (((obj->curBhvCommand[0] >> 24) == 0x0C) && ((obj->curBhvCommand[2] >> 24) == 0x09)) {
+        ((NativeBhvFunc) obj->curBhvCommand[1])();
+    } else {
+#endif
+    gCurBhvCommand = obj->curBhvCommand;
 
     do {
         bhvCmdProc = BehaviorCmdTable[*gCurBhvCommand >> 24];
-        bhvProcResult = bhvCmdProc();
+        bhvProcResult = bhvCmdProc(obj);
     } while (bhvProcResult == BHV_PROC_CONTINUE);
 
-    o->curBhvCommand = gCurBhvCommand;
+    obj->curBhvCommand = gCurBhvCommand;
+#ifdef BHV_NATIVE_LOOP_FAST_PATH
+    }
+#endif
 
     // Increment the object's timer.
     if (o->oTimer < 0x3FFFFFFF) {
@@ -861,6 +1039,12 @@ void cur_obj_update(void) {
         o->oSubAction = 0;
         o->oPrevAction = o->oAction;
     }
+#ifdef OBJ_UPDATE_THROTTLING
+    }
+#endif
+#ifdef BHV_LOD_TIERS
+    }
+#endif
 
     // Execute various code based on object flags.
     objFlags = o->oFlags;
@@ -936,4 +1120,8 @@ void cur_obj_update(void) {
             o->activeFlags &= ~ACTIVE_FLAG_FAR_AWAY;
         }
     }
+
+#if PUPPYPRINT_DEBUG
+    bhv_profiling_add(o->behavior, osGetCount() - updateStartCycles);
+#endif
 }
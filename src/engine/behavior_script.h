@@ -3,24 +3,71 @@
 
 #include <PR/ultratypes.h>
 
+#include "types.h"
+
 enum BhvProc {
     BHV_PROC_CONTINUE,
     BHV_PROC_BREAK
 };
 
-#define cur_obj_get_int(offset) gCurrentObject->OBJECT_FIELD_S32(offset)
-#define cur_obj_get_float(offset) gCurrentObject->OBJECT_FIELD_F32(offset)
-
-#define cur_obj_add_float(offset, value) gCurrentObject->OBJECT_FIELD_F32(offset) += (f32)(value)
-#define cur_obj_set_float(offset, value) gCurrentObject->OBJECT_FIELD_F32(offset) = (f32)(value)
-#define cur_obj_add_int(offset, value) gCurrentObject->OBJECT_FIELD_S32(offset) += (s32)(value)
-#define cur_obj_set_int(offset, value) gCurrentObject->OBJECT_FIELD_S32(offset) = (s32)(value)
-#define cur_obj_or_int(offset, value)  gCurrentObject->OBJECT_FIELD_S32(offset) |= (s32)(value)
-#define cur_obj_and_int(offset, value) gCurrentObject->OBJECT_FIELD_S32(offset) &= (s32)(value)
-#define cur_obj_set_vptr(offset, value) gCurrentObject->OBJECT_FIELD_VPTR(offset) = (void *)(value)
+// Raw field accessors taking the object explicitly, so callers holding the
+// object in a local (like the behavior command handlers) don't go back through
+// the gCurrentObject global for every access.
+#define obj_get_int(object, offset) object->OBJECT_FIELD_S32(offset)
+#define obj_get_float(object, offset) object->OBJECT_FIELD_F32(offset)
 
+#define obj_add_float(object, offset, value) object->OBJECT_FIELD_F32(offset) += (f32)(value)
+#define obj_set_float(object, offset, value) object->OBJECT_FIELD_F32(offset) = (f32)(value)
+#define obj_add_int(object, offset, value) object->OBJECT_FIELD_S32(offset) += (s32)(value)
+#define obj_set_int(object, offset, value) object->OBJECT_FIELD_S32(offset) = (s32)(value)
+#define obj_or_int(object, offset, value)  object->OBJECT_FIELD_S32(offset) |= (s32)(value)
 #define obj_and_int(object, offset, value) object->OBJECT_FIELD_S32(offset) &= (s32)(value)
+#define obj_set_vptr(object, offset, value) object->OBJECT_FIELD_VPTR(offset) = (void *)(value)
+
+// A behavior function run by CALL_NATIVE. Must not take or return any values.
+typedef void (*NativeBhvFunc)(void);
 
 void cur_obj_update(void);
 
+#ifdef BHV_LOD_TIERS
+/**
+ * A behavior's LOD registration. The near tier is the behavior script itself
+ * and runs below farDist. In [farDist, dormantDist) the dispatcher calls
+ * farUpdate instead of the script (NULL means skip the script entirely).
+ * Beyond dormantDist nothing runs; a dormantDist of 0 means there is no
+ * dormant band, so farUpdate keeps running at any range - behaviors whose far
+ * tier performs its own despawn checks (birds) must use 0 so those checks
+ * never stop. Flag-driven movement/graphics processing and the oTimer tick
+ * are unaffected by the tier in effect.
+ */
+struct BehaviorLodTier {
+    /*0x00*/ const BehaviorScript *behavior;
+    /*0x04*/ NativeBhvFunc farUpdate;
+    /*0x08*/ f32 farDist;
+    /*0x0C*/ f32 dormantDist;
+};
+
+// Registry of tiered behaviors, terminated by a NULL behavior. Defined in
+// behavior_actions.c so the far update functions in the behavior .inc.c files
+// are in scope.
+extern const struct BehaviorLodTier gBehaviorLodTiers[];
+
+const struct BehaviorLodTier *bhv_lod_find_tier(const BehaviorScript *behavior);
+#endif
+
+#if PUPPYPRINT_DEBUG
+// Per-behavior cycle totals for the frame, shown on the puppyprint
+// "Behaviors" page. Keyed by the behavior script's virtual address, which the
+// map file resolves to a name.
+#define BHV_PROFILE_MAX_BEHAVIORS 64
+struct BhvProfileEntry {
+    const BehaviorScript *behavior;
+    u32 cycles;
+    u16 count;
+};
+extern struct BhvProfileEntry gBhvProfileSnapshot[BHV_PROFILE_MAX_BEHAVIORS];
+extern s32 gBhvProfileSnapshotLen;
+void bhv_profiling_frame_done(void);
+#endif
+
 #endif // BEHAVIOR_SCRIPT_H
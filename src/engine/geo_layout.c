@@ -775,6 +775,89 @@ void geo_layout_cmd_bone(void) {
     gGeoLayoutCommand = (u8 *) cmdPos;
 }
 
+#ifdef GEO_FLATTEN_START_NODES
+static s32 geo_node_is_view(struct GraphNode *node) {
+    u16 i;
+
+    if (gGeoViews != NULL) {
+        for (i = 0; i < gGeoNumViews; i++) {
+            if (gGeoViews[i] == node) {
+                return TRUE;
+            }
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * Splices pure grouping nodes out of a freshly built graph node tree. Start
+ * nodes carry no transform or render state of their own - traversal just
+ * recurses into their children - so every one a GEO_BRANCH or sub-layout left
+ * behind costs a dispatch and a function call per traversal for nothing.
+ * Hoisting their children into the parent (in place, preserving order) removes
+ * that cost for the lifetime of the tree.
+ *
+ * Skipped: children of switch nodes (cases are positional), start nodes whose
+ * flags were changed by GEO_UPDATE_NODE_FLAGS (the group itself is toggled),
+ * view nodes (referenced by index through gGeoViews), and empty groups (cheap,
+ * and a plausible target for runtime geo_add_child).
+ */
+static void geo_flatten_start_nodes(struct GraphNode *parent) {
+    struct GraphNode *child;
+    s32 spliced;
+
+    if (parent->children == NULL) {
+        return;
+    }
+    // Flatten subtrees first, so nested groups collapse from the bottom up.
+    child = parent->children;
+    do {
+        geo_flatten_start_nodes(child);
+        child = child->next;
+    } while (child != parent->children);
+
+    if (parent->type == GRAPH_NODE_TYPE_SWITCH_CASE) {
+        return;
+    }
+    // Splicing edits the circular sibling list under the iterator, so restart
+    // the walk after each one; splices are rare and the lists are short.
+    do {
+        spliced = FALSE;
+        child = parent->children;
+        do {
+            if (child->type == GRAPH_NODE_TYPE_START
+                && child->flags == GRAPH_RENDER_ACTIVE
+                && child->children != NULL
+                && !geo_node_is_view(child)) {
+                struct GraphNode *first = child->children;
+                struct GraphNode *last = first->prev;
+                struct GraphNode *grandchild = first;
+
+                do {
+                    grandchild->parent = parent;
+                    grandchild = grandchild->next;
+                } while (grandchild != first);
+
+                if (child->next == child) {
+                    parent->children = first;
+                } else {
+                    child->prev->next = first;
+                    first->prev = child->prev;
+                    last->next = child->next;
+                    child->next->prev = last;
+                    if (parent->children == child) {
+                        parent->children = first;
+                    }
+                }
+                spliced = TRUE;
+                break;
+            }
+            child = child->next;
+        } while (child != parent->children);
+    } while (spliced);
+}
+#endif
+
 struct GraphNode *process_geo_layout(struct AllocOnlyPool *pool, void *segptr) {
     // set by register_scene_graph_node when gCurGraphNodeIndex is 0
     // and gCurRootGraphNode is NULL
@@ -799,5 +882,11 @@ struct GraphNode *process_geo_layout(struct AllocOnlyPool *pool, void *segptr) {
         GeoLayoutJumpTable[gGeoLayoutCommand[0x00]]();
     }
 
+#ifdef GEO_FLATTEN_START_NODES
+    if (gCurRootGraphNode != NULL) {
+        geo_flatten_start_nodes(gCurRootGraphNode);
+    }
+#endif
+
     return gCurRootGraphNode;
 }
@@ -4,6 +4,7 @@
 #include "game/level_update.h"
 #include "math_util.h"
 #include "game/memory.h"
+#include "model_ids.h"
 #include "graph_node.h"
 #include "game/rendering_graph_node.h"
 #include "game/area.h"
@@ -311,6 +312,9 @@ struct GraphNodeObject *init_graph_node_object(struct AllocOnlyPool *pool,
         graphNode->animInfo.animFrameAccelAssist = 0;
         graphNode->animInfo.animAccel = 0x10000;
         graphNode->animInfo.animTimer = 0;
+#ifdef LOD_HYSTERESIS
+        graphNode->lodBandMin = LOD_BAND_NONE;
+#endif
         graphNode->node.flags |= GRAPH_RENDER_HAS_ANIMATION;
     }
 
@@ -715,9 +719,15 @@ void geo_obj_init(struct GraphNodeObject *graphNode, void *sharedChild, Vec3f po
     vec3s_copy(graphNode->angle, angle);
 
     graphNode->sharedChild = sharedChild;
+#ifdef ASYNC_MODEL_LOADING
+    graphNode->pendingModelID = MODEL_NONE;
+#endif
     graphNode->spawnInfo = 0;
     graphNode->throwMatrix = NULL;
     graphNode->animInfo.curAnim = NULL;
+#ifdef LOD_HYSTERESIS
+    graphNode->lodBandMin = LOD_BAND_NONE;
+#endif
 
     graphNode->node.flags |=  GRAPH_RENDER_ACTIVE;
     graphNode->node.flags &= ~GRAPH_RENDER_INVISIBLE;
@@ -740,6 +750,9 @@ void geo_obj_init_spawninfo(struct GraphNodeObject *graphNode, struct SpawnInfo
     graphNode->spawnInfo = spawn;
     graphNode->throwMatrix = NULL;
     graphNode->animInfo.curAnim = 0;
+#ifdef LOD_HYSTERESIS
+    graphNode->lodBandMin = LOD_BAND_NONE;
+#endif
 
     graphNode->node.flags |= GRAPH_RENDER_ACTIVE;
     graphNode->node.flags &= ~GRAPH_RENDER_INVISIBLE;
@@ -76,6 +76,7 @@ enum GraphNodeTypes {
     GRAPH_NODE_TYPE_CULLING_RADIUS,
     GRAPH_NODE_TYPE_ROOT,
     GRAPH_NODE_TYPE_START,
+    GRAPH_NODE_TYPES_COUNT,
 };
 #else
 // Whether the node type has a function pointer of type GraphNodeFunc
@@ -178,6 +179,10 @@ struct GraphNodePerspective {
 struct DisplayListNode {
     Mtx *transform;
     void *displayList;
+#ifdef STATIC_GEO_NO_ZREAD
+    // Room-sorted level geometry that skips the z read (see geo_append_display_list).
+    u8 noZRead;
+#endif
     struct DisplayListNode *next;
 };
 
@@ -21,6 +21,7 @@
 #include "level_script.h"
 #include "level_misc_macros.h"
 #include "level_commands.h"
+#include "model_ids.h"
 #include "math_util.h"
 #include "surface_collision.h"
 #include "surface_load.h"
@@ -28,6 +29,7 @@
 #include "game/puppycam2.h"
 #include "game/puppyprint.h"
 #include "game/puppylights.h"
+#include "game/ambient_sound_zones.h"
 
 #include "config.h"
 
@@ -55,6 +57,103 @@ static uintptr_t sStack[NUM_TLB_SEGMENTS];
 
 static struct AllocOnlyPool *sLevelPool = NULL;
 
+#ifdef ASYNC_MODEL_LOADING
+/**
+ * One in-flight background model load. The ROM range is staged on the segment
+ * loader thread; completion is polled from the game loop.
+ */
+struct AsyncModelRequest {
+    u8 pending;
+    ModelID16 model;
+    s16 segment;
+    u8 *romStart;
+    u8 *romEnd;
+    void *geoLayout; // segmented address within 'segment'
+};
+
+static struct AsyncModelRequest sAsyncModelRequests[ASYNC_MODEL_MAX_REQUESTS];
+
+/**
+ * Ask for a model to be loaded in the background. The ROM range must hold the
+ * actor's data uncompressed; 'geoLayout' is the model's geo layout as a
+ * segmented address into 'segment'. Objects may be spawned with the model
+ * immediately -- they render as invisible placeholders until the transfer
+ * lands and async_model_load_update swaps the graph node in. Returns FALSE
+ * when all request slots are taken (the caller can retry or load normally).
+ */
+s32 async_model_load_request(ModelID32 model, s32 segment, u8 *romStart, u8 *romEnd, void *geoLayout) {
+    struct AsyncModelRequest *req = NULL;
+    s32 i;
+
+    if (gLoadedGraphNodes[model] != NULL) {
+        return TRUE;
+    }
+    for (i = 0; i < ASYNC_MODEL_MAX_REQUESTS; i++) {
+        if (sAsyncModelRequests[i].pending && sAsyncModelRequests[i].model == (ModelID16) model) {
+            return TRUE;
+        }
+        if (!sAsyncModelRequests[i].pending && req == NULL) {
+            req = &sAsyncModelRequests[i];
+        }
+    }
+    if (req == NULL) {
+        return FALSE;
+    }
+    segment_prefetch(romStart, romEnd);
+    req->model = model;
+    req->segment = segment;
+    req->romStart = romStart;
+    req->romEnd = romEnd;
+    req->geoLayout = geoLayout;
+    req->pending = TRUE;
+    return TRUE;
+}
+
+/**
+ * Poll the in-flight model loads; called once per frame from update_objects.
+ * When a transfer has landed, the staging buffer becomes the actor segment for
+ * the rest of the level, the geo layout is processed into a small left-side
+ * pool, and every placeholder object waiting on the model picks it up.
+ */
+void async_model_load_update(void) {
+    s32 i, objIdx;
+
+    for (i = 0; i < ASYNC_MODEL_MAX_REQUESTS; i++) {
+        struct AsyncModelRequest *req = &sAsyncModelRequests[i];
+        struct AllocOnlyPool *pool;
+        struct GraphNode *node;
+        u8 *buffer;
+
+        if (!req->pending || !segment_prefetch_poll(req->romStart, req->romEnd)) {
+            continue;
+        }
+        req->pending = FALSE;
+        buffer = segment_prefetch_take(req->romStart, req->romEnd);
+        if (buffer == NULL) {
+            continue; // staging was dropped (pool popped under us)
+        }
+        // The staging buffer is kept as the segment memory until the level's
+        // pool state is popped; it is deliberately never released.
+        set_segment_base_addr(req->segment, buffer);
+        pool = alloc_only_pool_init(ASYNC_MODEL_POOL_SIZE, MEMORY_POOL_LEFT);
+        node = process_geo_layout(pool, segmented_to_virtual(req->geoLayout));
+        alloc_only_pool_resize(pool, pool->usedSpace);
+        gLoadedGraphNodes[req->model] = node;
+
+        for (objIdx = 0; objIdx < OBJECT_POOL_CAPACITY; objIdx++) {
+            struct Object *obj = &gObjectPool[objIdx];
+
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED
+                && obj->header.gfx.pendingModelID == req->model) {
+                obj->header.gfx.sharedChild = node;
+                obj->header.gfx.pendingModelID = MODEL_NONE;
+            }
+        }
+    }
+}
+#endif // ASYNC_MODEL_LOADING
+
+
 static u16 sDelayFrames = 0;
 static u16 sDelayFrames2 = 0;
 
@@ -276,19 +375,39 @@ static void level_cmd_pop_pool_state(void) {
     sCurrentCmd = CMD_NEXT;
 }
 
+#if PUPPYPRINT_DEBUG
+// Segment load budget from tools/pool_plan.py (0 disables the check).
+u32 gSegmentPoolPlan = 0;
+static u8 sSegmentPlanExceeded = FALSE;
+
+static void segment_plan_check(void) {
+    if (gSegmentPoolPlan != 0 && !sSegmentPlanExceeded
+        && gMemTagUsage[MEM_TAG_SEGMENTS] > gSegmentPoolPlan) {
+        sSegmentPlanExceeded = TRUE;
+        append_puppyprint_log("Segment loads exceed pool plan (%X > %X).",
+                              gMemTagUsage[MEM_TAG_SEGMENTS], gSegmentPoolPlan);
+    }
+}
+#else
+#define segment_plan_check()
+#endif
+
 static void level_cmd_load_to_fixed_address(void) {
     load_to_fixed_pool_addr(CMD_GET(void *, 4), CMD_GET(void *, 8), CMD_GET(void *, 12));
+    segment_plan_check();
     sCurrentCmd = CMD_NEXT;
 }
 
 static void level_cmd_load_raw(void) {
     load_segment(CMD_GET(s16, 2), CMD_GET(void *, 4), CMD_GET(void *, 8),
             MEMORY_POOL_LEFT, CMD_GET(void *, 12), CMD_GET(void *, 16));
+    segment_plan_check();
     sCurrentCmd = CMD_NEXT;
 }
 
 static void level_cmd_load_yay0(void) {
     load_segment_decompress(CMD_GET(s16, 2), CMD_GET(void *, 4), CMD_GET(void *, 8));
+    segment_plan_check();
     sCurrentCmd = CMD_NEXT;
 }
 
@@ -309,6 +428,7 @@ static void level_cmd_load_mario_head(void) {
 
 static void level_cmd_load_yay0_texture(void) {
     load_segment_decompress_heap(CMD_GET(s16, 2), CMD_GET(void *, 4), CMD_GET(void *, 8));
+    segment_plan_check();
     sCurrentCmd = CMD_NEXT;
 }
 
@@ -324,11 +444,19 @@ static void level_cmd_init_level(void) {
     clear_objects();
     clear_areas();
     main_pool_push_state();
+#if PUPPYPRINT_DEBUG
+    sSegmentPlanExceeded = FALSE;
+#endif
     for (u8 clearPointers = 0; clearPointers < AREA_COUNT; clearPointers++) {
         gAreaSkyboxStart[clearPointers] = 0;
         gAreaSkyboxEnd[clearPointers] = 0;
     }
 
+#ifdef VARIABLE_CELL_GRID
+    // Levels that want a coarser grid re-issue SET_COLLISION_CELLS after this.
+    surface_set_cell_size(CELL_SIZE);
+#endif
+
     sCurrentCmd = CMD_NEXT;
 }
 
@@ -380,12 +508,45 @@ static void level_cmd_free_level_pool(void) {
     alloc_only_pool_resize(sLevelPool, sLevelPool->usedSpace);
     sLevelPool = NULL;
 
+#ifdef PER_LEVEL_SURFACE_POOLS
+    // Measure the largest area's static collision so the pools are sized for this
+    // level instead of the compile-time worst case.
+    s32 maxSurfaces = 0;
+    s32 maxNodes = 0;
+    s32 hasTerrain = FALSE;
+
+    for (i = 0; i < AREA_COUNT; i++) {
+        if (gAreaData[i].terrainData != NULL) {
+            s32 surfaces = 0;
+            s32 nodes = 0;
+
+            count_area_surface_pool_usage(gAreaData[i].terrainData, &surfaces, &nodes);
+            if (surfaces > maxSurfaces) maxSurfaces = surfaces;
+            if (nodes > maxNodes) maxNodes = nodes;
+            hasTerrain = TRUE;
+        }
+    }
+
+    if (hasTerrain) {
+        sSurfacePoolSize = maxSurfaces + gDynamicSurfaceReserve;
+        sSurfaceNodePoolSize = maxNodes + (4 * gDynamicSurfaceReserve);
+        alloc_surface_pools();
+    }
+    // The reserve override only applies to the level that set it.
+    gDynamicSurfaceReserve = DYNAMIC_SURFACE_POOL_RESERVE;
+#else
     for (i = 0; i < AREA_COUNT; i++) {
         if (gAreaData[i].terrainData != NULL) {
             alloc_surface_pools();
             break;
         }
     }
+#endif
+
+#ifdef LEVEL_SNAPSHOT_RESTART
+    // The areas' spawn data is final at this point; snapshot it for instant retries.
+    level_snapshot_capture();
+#endif
 
     sCurrentCmd = CMD_NEXT;
 }
@@ -432,14 +593,18 @@ static void level_cmd_load_model_from_dl(void) {
 }
 
 static void level_cmd_load_model_from_geo(void) {
-    ModelID16 model = CMD_GET(ModelID16, 2);
-    void *geo = CMD_GET(void *, 4);
+    // Model loads are issued in runs (one per model in the group), so drain the
+    // run without going back through the dispatch loop between commands.
+    do {
+        ModelID16 model = CMD_GET(ModelID16, 2);
+        void *geo = CMD_GET(void *, 4);
 
-    if (model < MODEL_ID_COUNT) {
-        gLoadedGraphNodes[model] = process_geo_layout(sLevelPool, geo);
-    }
+        if (model < MODEL_ID_COUNT) {
+            gLoadedGraphNodes[model] = process_geo_layout(sLevelPool, geo);
+        }
 
-    sCurrentCmd = CMD_NEXT;
+        sCurrentCmd = CMD_NEXT;
+    } while (sCurrentCmd->type == LEVEL_CMD_LOAD_MODEL_FROM_GEO);
 }
 
 static void level_cmd_23(void) {
@@ -473,33 +638,38 @@ static void level_cmd_init_mario(void) {
 }
 
 static void level_cmd_place_object(void) {
-    if (
-        sCurrAreaIndex != -1
-        && ((CMD_GET(u8, 2) & (1 << (gCurrActNum - 1))) || (CMD_GET(u8, 2) == 0x1F))
-    ) {
-        ModelID16 model = CMD_GET(u32, 0x18);
-        struct SpawnInfo *spawnInfo = alloc_only_pool_alloc(sLevelPool, sizeof(struct SpawnInfo));
-
-        vec3s_set(spawnInfo->startPos, CMD_GET(s16, 4),
-                                       CMD_GET(s16, 6),
-                                       CMD_GET(s16, 8));
-
-        vec3s_set(spawnInfo->startAngle, DEGREES(CMD_GET(s16, 10)),
-                                         DEGREES(CMD_GET(s16, 12)),
-                                         DEGREES(CMD_GET(s16, 14)));
-
-        spawnInfo->areaIndex = sCurrAreaIndex;
-        spawnInfo->activeAreaIndex = sCurrAreaIndex;
-
-        spawnInfo->behaviorArg = CMD_GET(u32, 16);
-        spawnInfo->behaviorScript = CMD_GET(void *, 20);
-        spawnInfo->model = gLoadedGraphNodes[model];
-        spawnInfo->next = gAreas[sCurrAreaIndex].objectSpawnInfos;
-
-        gAreas[sCurrAreaIndex].objectSpawnInfos = spawnInfo;
-    }
+    // Object placements come in long back-to-back runs (one command per placed
+    // object), so consume the whole run here rather than bouncing each command
+    // through the dispatch loop.
+    do {
+        if (
+            sCurrAreaIndex != -1
+            && ((CMD_GET(u8, 2) & (1 << (gCurrActNum - 1))) || (CMD_GET(u8, 2) == 0x1F))
+        ) {
+            ModelID16 model = CMD_GET(u32, 0x18);
+            struct SpawnInfo *spawnInfo = alloc_only_pool_alloc(sLevelPool, sizeof(struct SpawnInfo));
+
+            vec3s_set(spawnInfo->startPos, CMD_GET(s16, 4),
+                                           CMD_GET(s16, 6),
+                                           CMD_GET(s16, 8));
+
+            vec3s_set(spawnInfo->startAngle, DEGREES(CMD_GET(s16, 10)),
+                                             DEGREES(CMD_GET(s16, 12)),
+                                             DEGREES(CMD_GET(s16, 14)));
+
+            spawnInfo->areaIndex = sCurrAreaIndex;
+            spawnInfo->activeAreaIndex = sCurrAreaIndex;
+
+            spawnInfo->behaviorArg = CMD_GET(u32, 16);
+            spawnInfo->behaviorScript = CMD_GET(void *, 20);
+            spawnInfo->model = gLoadedGraphNodes[model];
+            spawnInfo->next = gAreas[sCurrAreaIndex].objectSpawnInfos;
+
+            gAreas[sCurrAreaIndex].objectSpawnInfos = spawnInfo;
+        }
 
-    sCurrentCmd = CMD_NEXT;
+        sCurrentCmd = CMD_NEXT;
+    } while (sCurrentCmd->type == LEVEL_CMD_PLACE_OBJECT);
 }
 
 static void level_cmd_create_warp_node(void) {
@@ -624,6 +794,26 @@ static void level_cmd_create_whirlpool(void) {
     sCurrentCmd = CMD_NEXT;
 }
 
+static void level_cmd_create_current_volume(void) {
+#ifdef WATER_CURRENT_FIELD
+    struct WaterCurrentSource *source;
+
+    if (sCurrAreaIndex != -1) {
+        source = alloc_only_pool_alloc(sLevelPool, sizeof(struct WaterCurrentSource));
+        source->type = CMD_GET(u8, 2);
+        vec3s_set(source->min, CMD_GET(s16, 4), CMD_GET(s16, 6), CMD_GET(s16, 8));
+        vec3s_set(source->max, CMD_GET(s16, 10), CMD_GET(s16, 12), CMD_GET(s16, 14));
+        source->yaw = CMD_GET(s16, 16);
+        source->pitch = CMD_GET(s16, 18);
+        source->speed = CMD_GET(s16, 20);
+        source->next = gAreas[sCurrAreaIndex].currentSources;
+        gAreas[sCurrAreaIndex].currentSources = source;
+    }
+#endif
+
+    sCurrentCmd = CMD_NEXT;
+}
+
 static void level_cmd_set_blackout(void) {
     osViBlack(CMD_GET(u8, 2));
     sCurrentCmd = CMD_NEXT;
@@ -879,6 +1069,68 @@ static void level_cmd_puppylight_node(void) {
     sCurrentCmd = CMD_NEXT;
 }
 
+static void level_cmd_ambient_sound_zone(void) {
+#ifdef AMBIENT_SOUND_ZONES
+    if (gAmbientZoneCount < AMBIENT_SOUND_ZONE_MAX) {
+        struct AmbientSoundZone *zone = &gAmbientSoundZones[gAmbientZoneCount];
+
+        zone->flags = CMD_GET(u8, 2);
+        zone->soundBits = CMD_GET(s32, 4);
+        vec3s_set(zone->min, CMD_GET(s16,  8), CMD_GET(s16, 10), CMD_GET(s16, 12));
+        vec3s_set(zone->max, CMD_GET(s16, 14), CMD_GET(s16, 16), CMD_GET(s16, 18));
+        zone->area = sCurrAreaIndex;
+        zone->active = FALSE;
+
+        gAmbientZoneCount++;
+    }
+#if PUPPYPRINT_DEBUG
+    else {
+        append_puppyprint_log("Ambient sound zone cap reached.");
+    }
+#endif
+#endif
+    sCurrentCmd = CMD_NEXT;
+}
+
+static void level_cmd_set_collision_cells(void) {
+#ifdef VARIABLE_CELL_GRID
+    surface_set_cell_size(CMD_GET(u16, 2));
+#endif
+    sCurrentCmd = CMD_NEXT;
+}
+
+static void level_cmd_prefetch(void) {
+#ifndef NO_SEGMENTED_MEMORY
+    segment_prefetch(CMD_GET(void *, 4), CMD_GET(void *, 8));
+#endif
+    sCurrentCmd = CMD_NEXT;
+}
+
+static void level_cmd_mem_group(void) {
+    // Skip the whole group (up to and including its end marker) when less
+    // RDRAM is installed than the group asks for; otherwise fall through into
+    // it and let the commands run normally.
+    if ((s32) (osMemSize >> 20) < CMD_GET(s16, 2)) {
+        do {
+            sCurrentCmd = CMD_NEXT;
+        } while (sCurrentCmd->type != LEVEL_CMD_MEM_GROUP_END);
+    }
+
+    sCurrentCmd = CMD_NEXT;
+}
+
+static void level_cmd_mem_group_end(void) {
+    // Only reached when the group ran; the skip path consumes this marker.
+    sCurrentCmd = CMD_NEXT;
+}
+
+static void level_cmd_surface_pool_reserve(void) {
+#ifdef PER_LEVEL_SURFACE_POOLS
+    gDynamicSurfaceReserve = CMD_GET(s16, 2);
+#endif
+    sCurrentCmd = CMD_NEXT;
+}
+
 static void (*LevelScriptJumpTable[])(void) = {
     /*LEVEL_CMD_LOAD_AND_EXECUTE            */ level_cmd_load_and_execute,
     /*LEVEL_CMD_EXIT_AND_EXECUTE            */ level_cmd_exit_and_execute,
@@ -945,15 +1197,26 @@ static void (*LevelScriptJumpTable[])(void) = {
     /*LEVEL_CMD_CHANGE_AREA_SKYBOX          */ level_cmd_change_area_skybox,
     /*LEVEL_CMD_PUPPYLIGHT_ENVIRONMENT      */ level_cmd_puppylight_environment,
     /*LEVEL_CMD_PUPPYLIGHT_NODE             */ level_cmd_puppylight_node,
+    /*LEVEL_CMD_SET_COLLISION_CELLS         */ level_cmd_set_collision_cells,
+    /*LEVEL_CMD_PREFETCH                    */ level_cmd_prefetch,
+    /*LEVEL_CMD_CREATE_CURRENT_VOLUME       */ level_cmd_create_current_volume,
+    /*LEVEL_CMD_AMBIENT_SOUND_ZONE          */ level_cmd_ambient_sound_zone,
+    /*LEVEL_CMD_MEM_GROUP                   */ level_cmd_mem_group,
+    /*LEVEL_CMD_MEM_GROUP_END               */ level_cmd_mem_group_end,
+    /*LEVEL_CMD_SURFACE_POOL_RESERVE        */ level_cmd_surface_pool_reserve,
 };
 
 struct LevelCommand *level_script_execute(struct LevelCommand *cmd) {
     sScriptStatus = SCRIPT_RUNNING;
     sCurrentCmd = cmd;
 
+    // While the script is loading, let pending background transfers run above
+    // the game thread so the PI stays busy during collision and geo processing.
+    segment_loader_set_busy(TRUE);
     while (sScriptStatus == SCRIPT_RUNNING) {
         LevelScriptJumpTable[sCurrentCmd->type]();
     }
+    segment_loader_set_busy(FALSE);
 
     init_rcp(CLEAR_ZBUFFER);
     render_game();
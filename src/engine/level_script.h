@@ -3,10 +3,22 @@
 
 #include <PR/ultratypes.h>
 
+#include "types.h"
+
 struct LevelCommand;
 
 extern LevelScript level_script_entry[];
 
+#if PUPPYPRINT_DEBUG
+// Segment load budget from tools/pool_plan.py (0 disables the check).
+extern u32 gSegmentPoolPlan;
+#endif
+
 struct LevelCommand *level_script_execute(struct LevelCommand *cmd);
 
+#ifdef ASYNC_MODEL_LOADING
+s32 async_model_load_request(ModelID32 model, s32 segment, u8 *romStart, u8 *romEnd, void *geoLayout);
+void async_model_load_update(void);
+#endif
+
 #endif // LEVEL_SCRIPT_H
@@ -63,6 +63,47 @@ s32 random_sign(void) {
     return ((random_u16() >= 0x7FFF) ? 1 : -1);
 }
 
+// Seed an independent pseudorandom stream. A seed of 0 is remapped, since the
+// xorshift state must never be zero.
+void random_stream_seed(struct RandomStream *stream, u32 seed) {
+    stream->state = (seed != 0) ? seed : 0x12345678;
+}
+
+// Advance a stream and return the next 32 bit value (xorshift32).
+u32 random_stream_u32(struct RandomStream *stream) {
+    u32 x = stream->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    stream->state = x;
+    return x;
+}
+
+// Return the next 16 bit value from a stream (the upper state bits mix best).
+u16 random_stream_u16(struct RandomStream *stream) {
+    return (random_stream_u32(stream) >> 16);
+}
+
+// Return the next float in [0, 1) from a stream.
+f32 random_stream_float(struct RandomStream *stream) {
+    return ((f32) random_stream_u16(stream) / (f32) 0x10000);
+}
+
+// Fill 'dest' with 'count' 16 bit values from a stream. The state round-trips
+// through a register instead of memory between values, so bulk consumers
+// (particle buffers) don't pay the load/store chain of repeated single calls.
+void random_stream_fill_u16(struct RandomStream *stream, u16 *dest, s32 count) {
+    u32 x = stream->state;
+    s32 i;
+    for (i = 0; i < count; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        dest[i] = (x >> 16);
+    }
+    stream->state = x;
+}
+
 /// Returns the lowest of three values.
 #define min_3_func(a0, a1, a2) {\
     if (a1 < a0) a0 = a1;       \
@@ -296,11 +337,42 @@ void vec3f_cross(Vec3f dest, const Vec3f a, const Vec3f b) {
     vec3_cross(dest, a, b);
 }
 
+#ifdef FAST_INVSQRT
+/**
+ * Fast approximate 1/sqrt(x). The VR4300 has no rsqrt instruction, and its
+ * div.s and sqrt.s each stall the FPU for 29 cycles, so the exact form costs
+ * nearly 60 unpipelined cycles. This uses the integer estimate trick plus two
+ * Newton-Raphson iterations - a handful of pipelined single-precision ops -
+ * and is accurate to roughly 5e-6 relative error, plenty for normals and
+ * direction vectors. x must be positive.
+ */
+f32 rsqrtf(f32 x) {
+    f32 est = x;
+    u32 i = *(u32 *) &est;
+
+    i = 0x5F375A86 - (i >> 1);
+    est = *(f32 *) &i;
+
+    est *= (1.5f - (0.5f * x * est * est));
+    est *= (1.5f - (0.5f * x * est * est));
+    return est;
+}
+
+/// Approximate sqrtf(x) as x * rsqrtf(x), avoiding the sqrt.s stall.
+f32 fast_sqrtf(f32 x) {
+    return (x > NEAR_ZERO) ? x * rsqrtf(x) : 0.0f;
+}
+#endif
+
 /// Scale vector 'dest' so it has length 1
 void vec3f_normalize(Vec3f dest) {
     register f32 mag = (sqr(dest[0]) + sqr(dest[1]) + sqr(dest[2]));
     if (mag > NEAR_ZERO) {
+#ifdef FAST_INVSQRT
+        register f32 invsqrt = rsqrtf(mag);
+#else
         register f32 invsqrt = (1.0f / sqrtf(mag));
+#endif
         vec3_mul_val(dest, invsqrt);
     } else {
         // Default to up vector.
@@ -310,6 +382,24 @@ void vec3f_normalize(Vec3f dest) {
     }
 }
 
+/// Fused normalize-and-scale: scale vector 'v' so it has length 'mag'.
+void vec3f_set_mag(Vec3f v, f32 mag) {
+    register f32 sumsq = (sqr(v[0]) + sqr(v[1]) + sqr(v[2]));
+    if (sumsq > NEAR_ZERO) {
+#ifdef FAST_INVSQRT
+        register f32 scale = mag * rsqrtf(sumsq);
+#else
+        register f32 scale = mag / sqrtf(sumsq);
+#endif
+        vec3_mul_val(v, scale);
+    } else {
+        // Default to up vector.
+        v[0] = 0;
+        v[1] = mag;
+        v[2] = 0;
+    }
+}
+
 /// Struct the same data size as a Mat4
 struct CopyMat4 {
     f32 a[0x10];
@@ -372,6 +462,54 @@ void linear_mtxf_mul_vec3f_and_translate(Mat4 m, Vec3f dst, Vec3f v) {
     }
 }
 
+/**
+ * Transform 'count' consecutive TerrainData points by 'm'. The rotated
+ * components are truncated to TerrainData before the translation is added,
+ * matching what linear_mtxf_mul_vec3f_and_translate produces through an
+ * integer destination. One out-of-line loop, with the matrix held in locals so
+ * the body is pure converts, multiply-adds and stores, serves every
+ * array-shaped caller instead of each site expanding its own copy. The bounds
+ * of the transformed points are returned through aabbMin/aabbMax when both are
+ * given, so broadphase consumers get them from the same pass.
+ */
+void mtxf_transform_terrain_points(Mat4 m, TerrainData *dest, const TerrainData *src, s32 count,
+                                   TerrainData *aabbMin, TerrainData *aabbMax) {
+    f32 m00 = m[0][0], m01 = m[0][1], m02 = m[0][2];
+    f32 m10 = m[1][0], m11 = m[1][1], m12 = m[1][2];
+    f32 m20 = m[2][0], m21 = m[2][1], m22 = m[2][2];
+    f32 m30 = m[3][0], m31 = m[3][1], m32 = m[3][2];
+    s32 minX = 0x7FFFFFFF, minY = 0x7FFFFFFF, minZ = 0x7FFFFFFF;
+    s32 maxX = -0x7FFFFFFF, maxY = -0x7FFFFFFF, maxZ = -0x7FFFFFFF;
+
+    while (count--) {
+        f32 vx = src[0];
+        f32 vy = src[1];
+        f32 vz = src[2];
+        src += 3;
+
+        TerrainData x = (TerrainData)((TerrainData)((vx * m00) + (vy * m10) + (vz * m20)) + m30);
+        TerrainData y = (TerrainData)((TerrainData)((vx * m01) + (vy * m11) + (vz * m21)) + m31);
+        TerrainData z = (TerrainData)((TerrainData)((vx * m02) + (vy * m12) + (vz * m22)) + m32);
+
+        dest[0] = x;
+        dest[1] = y;
+        dest[2] = z;
+        dest += 3;
+
+        if (x < minX) minX = x;
+        if (x > maxX) maxX = x;
+        if (y < minY) minY = y;
+        if (y > maxY) maxY = y;
+        if (z < minZ) minZ = z;
+        if (z > maxZ) maxZ = z;
+    }
+
+    if (aabbMin != NULL && aabbMax != NULL) {
+        vec3_set(aabbMin, minX, minY, minZ);
+        vec3_set(aabbMax, maxX, maxY, maxZ);
+    }
+}
+
 /**
  * Multiply a vector by the transpose of a matrix of the form
  * | ? ? ? 0 |
@@ -467,6 +605,49 @@ void mtxf_rotate_zxy_and_translate_and_mul(Vec3s rot, Vec3f trans, Mat4 dest, Ma
     MTXF_END(dest);
 }
 
+/// Copy 'src' and translate it by 'trans' (in src's local space). Fused fast path
+/// for translation-only graph nodes: equivalent to mtxf_rotate_zxy_and_translate_and_mul
+/// with a zero rotation, minus the sine table lookups and three of the four
+/// matrix-vector products.
+void mtxf_translate_and_mul(Mat4 dest, Mat4 src, Vec3f trans) {
+    vec3f_copy(dest[0], src[0]);
+    vec3f_copy(dest[1], src[1]);
+    vec3f_copy(dest[2], src[2]);
+    linear_mtxf_mul_vec3f(src, dest[3], trans);
+    vec3f_add(dest[3], src[3]);
+    MTXF_END(dest);
+}
+
+/// Same as mtxf_rotate_zxy_and_translate_and_mul with a zero translation: the
+/// translation row is copied straight from 'src' instead of being transformed.
+void mtxf_rotate_zxy_and_mul(Vec3s rot, Mat4 dest, Mat4 src) {
+    register f32 sx = sins(rot[0]);
+    register f32 cx = coss(rot[0]);
+    register f32 sy = sins(rot[1]);
+    register f32 cy = coss(rot[1]);
+    register f32 sz = sins(rot[2]);
+    register f32 cz = coss(rot[2]);
+    Vec3f entry;
+    register f32 sysz = (sy * sz);
+    register f32 cycz = (cy * cz);
+    entry[0] = ((sysz * sx) + cycz);
+    entry[1] = (sz * cx);
+    register f32 cysz = (cy * sz);
+    register f32 sycz = (sy * cz);
+    entry[2] = ((cysz * sx) - sycz);
+    linear_mtxf_mul_vec3f(src, dest[0], entry);
+    entry[0] = ((sycz * sx) - cysz);
+    entry[1] = (cz * cx);
+    entry[2] = ((cycz * sx) + sysz);
+    linear_mtxf_mul_vec3f(src, dest[1], entry);
+    entry[0] = (cx * sy);
+    entry[1] = -sx;
+    entry[2] = (cx * cy);
+    linear_mtxf_mul_vec3f(src, dest[2], entry);
+    vec3f_copy(dest[3], src[3]);
+    MTXF_END(dest);
+}
+
 /// Build a matrix that rotates around the x axis, then the y axis, then the z axis, and then translates and multiplies.
 void mtxf_rotate_xyz_and_translate_and_mul(Vec3s rot, Vec3f trans, Mat4 dest, Mat4 src) {
     register f32 sx = sins(rot[0]);
@@ -507,8 +688,12 @@ void mtxf_lookat(Mat4 mtx, Vec3f from, Vec3f to, s16 roll) {
     Vec3f colX, colY, colZ;
     register f32 dx = (to[0] - from[0]);
     register f32 dz = (to[2] - from[2]);
+#ifdef FAST_INVSQRT
+    register f32 invLength = -rsqrtf(MAX(sqr(dx) + sqr(dz), NEAR_ZERO));
+#else
     register f32 invLength = sqrtf(sqr(dx) + sqr(dz));
     invLength = -(1.0f / MAX(invLength, NEAR_ZERO));
+#endif
     dx *= invLength;
     dz *= invLength;
     f32 sr  = sins(roll);
@@ -1097,6 +1282,39 @@ s16 approach_s16_asymptotic(s16 current, s16 target, s16 divisor) {
     return current;
 }
 
+/**
+ * Applies approach_f32_asymptotic_bool to the X, Y and Z components of the given
+ * vector in a single pass. The loads, multiplier clamps and stores are interleaved
+ * instead of going through the scalar function three times, which matters for the
+ * camera: update_camera runs this on positions and focus points dozens of times
+ * per frame.
+ */
+void approach_vec3f_asymptotic(Vec3f current, Vec3f target, f32 xMul, f32 yMul, f32 zMul) {
+    f32 x = current[0];
+    f32 y = current[1];
+    f32 z = current[2];
+    if (xMul > 1.0f) xMul = 1.0f;
+    if (yMul > 1.0f) yMul = 1.0f;
+    if (zMul > 1.0f) zMul = 1.0f;
+    current[0] = x + ((target[0] - x) * xMul);
+    current[1] = y + ((target[1] - y) * yMul);
+    current[2] = z + ((target[2] - z) * zMul);
+}
+
+/**
+ * Applies approach_s16_asymptotic_bool to the X, Y and Z components of the given
+ * vector in a single pass. Like the scalar version, the divisors are reciprocals
+ * of the f32 multipliers, and a divisor of 0 snaps that component to the target.
+ */
+void approach_vec3s_asymptotic(Vec3s current, Vec3s target, s16 xDiv, s16 yDiv, s16 zDiv) {
+    s16 x = current[0] - target[0];
+    s16 y = current[1] - target[1];
+    s16 z = current[2] - target[2];
+    current[0] = target[0] + ((xDiv == 0) ? 0 : (s16)(x - (x / xDiv)));
+    current[1] = target[1] + ((yDiv == 0) ? 0 : (s16)(y - (y / yDiv)));
+    current[2] = target[2] + ((zDiv == 0) ? 0 : (s16)(z - (z / zDiv)));
+}
+
 s16 abs_angle_diff(s16 a0, s16 a1) {
     register s16 diff = (a1 - a0);
     if (diff == -0x8000) return 0x7FFF;
@@ -1107,11 +1325,43 @@ s16 abs_angle_diff(s16 a0, s16 a1) {
  * Helper function for atan2s. Does a look up of the arctangent of y/x assuming
  * the resulting angle is in range [0, 0x2000] (1/8 of a circle).
  */
+#ifdef ATAN2_SMALL_TABLE
+/**
+ * atan(i / 64) in s16 angle units, for the octant-folded lookup below. The last
+ * entry is duplicated so an exact ratio of 1.0 stays in bounds. 132 bytes
+ * (three cache lines) against the 2 KiB of gArctanTable, and interpolating
+ * between entries is tighter than the big table's nearest-entry rounding:
+ * worst case 1.7 angle units (0.009 degrees) from true atan, where the vanilla
+ * table is off by up to 5.6 units near zero.
+ */
+static const s16 sAtanLerpTable[66] = {
+    0x0000, 0x00A3, 0x0146, 0x01E9, 0x028B, 0x032D, 0x03CF, 0x0470,
+    0x0511, 0x05B1, 0x0651, 0x06EF, 0x078D, 0x082A, 0x08C6, 0x0961,
+    0x09FB, 0x0A94, 0x0B2C, 0x0BC2, 0x0C57, 0x0CEB, 0x0D7D, 0x0E0F,
+    0x0E9E, 0x0F2C, 0x0FB9, 0x1044, 0x10CE, 0x1156, 0x11DC, 0x1261,
+    0x12E4, 0x1366, 0x13E6, 0x1464, 0x14E0, 0x155B, 0x15D5, 0x164C,
+    0x16C2, 0x1737, 0x17AA, 0x181B, 0x188A, 0x18F8, 0x1964, 0x19CF,
+    0x1A38, 0x1A9F, 0x1B05, 0x1B6A, 0x1BCD, 0x1C2E, 0x1C8E, 0x1CED,
+    0x1D4A, 0x1DA5, 0x1DFF, 0x1E58, 0x1EB0, 0x1F06, 0x1F5A, 0x1FAE,
+    0x2000, 0x2000,
+};
+
+static u16 atan2_lookup(f32 y, f32 x) {
+    if (x == 0) {
+        return 0x0;
+    }
+    f32 scaled = (y / x) * 64.0f;
+    s32 i = (s32) scaled;
+    f32 frac = scaled - i;
+    return sAtanLerpTable[i] + (s16)(frac * (sAtanLerpTable[i + 1] - sAtanLerpTable[i]));
+}
+#else
 static u16 atan2_lookup(f32 y, f32 x) {
     return x == 0
         ? 0x0
         : atans(y / x);
 }
+#endif // ATAN2_SMALL_TABLE
 
 /**
  * Compute the angle from (0, 0) to (x, y) as a s16. Given that terrain is in
@@ -1404,7 +1654,11 @@ void find_surface_on_ray_list(struct SurfaceNode *list, Vec3f orig, Vec3f dir, f
 
 void find_surface_on_ray_cell(s32 cellX, s32 cellZ, Vec3f orig, Vec3f normalized_dir, f32 dir_length, struct Surface **hit_surface, Vec3f hit_pos, f32 *max_length, s32 flags) {
     // Skip if OOB
+#ifdef VARIABLE_CELL_GRID
+    if ((cellX >= 0) && (cellX <= (gNumCellsUsed - 1)) && (cellZ >= 0) && (cellZ <= (gNumCellsUsed - 1))) {
+#else
     if ((cellX >= 0) && (cellX <= (NUM_CELLS - 1)) && (cellZ >= 0) && (cellZ <= (NUM_CELLS - 1))) {
+#endif
         // Iterate through each surface in this partition
         if ((normalized_dir[1] > -NEAR_ONE) && (flags & RAYCAST_FIND_CEIL)) {
             find_surface_on_ray_list( gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_CEILS ].next, orig, normalized_dir, dir_length, hit_surface, hit_pos, max_length);
@@ -1429,7 +1683,11 @@ void find_surface_on_ray(Vec3f orig, Vec3f dir, struct Surface **hit_surface, Ve
     Vec3f normalized_dir;
     f32 step;
     s32 i;
+#ifdef VARIABLE_CELL_GRID
+    const f32 invcell = 1.0f / (f32)(1 << gCellSizeShift);
+#else
     const f32 invcell = 1.0f / CELL_SIZE;
+#endif
 
     // Set that no surface has been hit
     *hit_surface = NULL;
@@ -479,6 +479,22 @@ u16 random_u16(void);
 f32 random_float(void);
 s32 random_sign(void);
 
+/**
+ * An independent pseudorandom stream (xorshift32). Unlike random_u16, whose
+ * single global seed is shared by every caller, each stream owns its state:
+ * visual-only consumers (envfx) can draw freely without perturbing the
+ * gameplay sequence, and reseeding a stream replays its values exactly.
+ */
+struct RandomStream {
+    u32 state;
+};
+
+void random_stream_seed(struct RandomStream *stream, u32 seed);
+u32 random_stream_u32(struct RandomStream *stream);
+u16 random_stream_u16(struct RandomStream *stream);
+f32 random_stream_float(struct RandomStream *stream);
+void random_stream_fill_u16(struct RandomStream *stream, u16 *dest, s32 count);
+
 f32  min_3f(   f32 a, f32 b, f32 c);
 s32  min_3i(   s32 a, s32 b, s32 c);
 s32  min_3s(   s16 a, s16 b, s16 c);
@@ -534,7 +550,12 @@ void vec3s_quot(Vec3s dest, const Vec3s a, const Vec3s b);
 
 f32  vec3f_dot(              const Vec3f a, const Vec3f b);
 void vec3f_cross(Vec3f dest, const Vec3f a, const Vec3f b);
+#ifdef FAST_INVSQRT
+f32  rsqrtf(f32 x);
+f32  fast_sqrtf(f32 x);
+#endif
 void vec3f_normalize(Vec3f dest);
+void vec3f_set_mag(Vec3f v, f32 mag);
 void mtxf_copy(Mat4 dest, Mat4 src);
 void mtxf_identity(Mat4 mtx);
 void mtxf_translate(Mat4 dest, Vec3f b);
@@ -543,6 +564,8 @@ void mtxf_rotate_zxy_and_translate(Mat4 dest, Vec3f trans, Vec3s rot);
 void mtxf_rotate_xyz_and_translate(Mat4 dest, Vec3f trans, Vec3s rot);
 void mtxf_rotate_zxy_and_translate_and_mul(Vec3s rot, Vec3f trans, Mat4 dest, Mat4 src);
 void mtxf_rotate_xyz_and_translate_and_mul(Vec3s rot, Vec3f trans, Mat4 dest, Mat4 src);
+void mtxf_translate_and_mul(Mat4 dest, Mat4 src, Vec3f trans);
+void mtxf_rotate_zxy_and_mul(Vec3s rot, Mat4 dest, Mat4 src);
 void mtxf_billboard(Mat4 dest, Mat4 mtx, Vec3f position, Vec3f scale, s16 angle);
 void mtxf_shadow(Mat4 dest, Mat4 src, Vec3f upDir, Vec3f pos, Vec3f scale, s16 yaw);
 void mtxf_align_terrain_normal(Mat4 dest, Vec3f upDir, Vec3f pos, s16 yaw);
@@ -560,6 +583,8 @@ ALWAYS_INLINE void mtxf_to_mtx(register void *dest, register void *src) {
 void mtxf_rotate_xy(Mtx *mtx, s16 angle);
 void linear_mtxf_mul_vec3f(Mat4 m, Vec3f dst, Vec3f v);
 void linear_mtxf_mul_vec3f_and_translate(Mat4 m, Vec3f dst, Vec3f v);
+void mtxf_transform_terrain_points(Mat4 m, TerrainData *dest, const TerrainData *src, s32 count,
+                                   TerrainData *aabbMin, TerrainData *aabbMax);
 void linear_mtxf_transpose_mul_vec3f(Mat4 m, Vec3f dst, Vec3f v);
 void get_pos_from_transform_mtx(Vec3f dest, Mat4 objMtx, Mat4 camMtx);
 
@@ -601,6 +626,8 @@ s32 approach_f32_asymptotic_bool(f32 *current, f32 target, f32 multiplier);
 f32 approach_f32_asymptotic(f32 current, f32 target, f32 multiplier);
 s16 approach_s16_asymptotic_bool(s16 *current, s16 target, s16 divisor);
 s16 approach_s16_asymptotic(s16 current, s16 target, s16 divisor);
+void approach_vec3f_asymptotic(Vec3f current, Vec3f target, f32 xMul, f32 yMul, f32 zMul);
+void approach_vec3s_asymptotic(Vec3s current, Vec3s target, s16 xDiv, s16 yDiv, s16 zDiv);
 s16 abs_angle_diff(s16 a0, s16 a1);
 s16 atan2s(f32 y, f32 x);
 f32 atan2f(f32 a, f32 b);
@@ -608,5 +635,6 @@ void spline_get_weights(Vec4f result, f32 t, UNUSED s32 c);
 void anim_spline_init(Vec4s *keyFrames);
 s32  anim_spline_poll(Vec3f result);
 void find_surface_on_ray(Vec3f orig, Vec3f dir, struct Surface **hit_surface, Vec3f hit_pos, s32 flags);
+s32 ray_surface_intersect(Vec3f orig, Vec3f dir, f32 dir_length, struct Surface *surface, Vec3f hit_pos, f32 *length);
 
 #endif // MATH_UTIL_H
@@ -9,6 +9,7 @@
 #include "surface_collision.h"
 #include "surface_load.h"
 #include "game/puppyprint.h"
+#include "game/frame_stats.h"
 
 /**************************************************
  *                      WALLS                     *
@@ -28,21 +29,106 @@
     next_step;                                  \
 }
 
+/**
+ * Test a single wall against a collision circle and apply its push to pos.
+ * marginRadius accumulates slight growth after each edge push, matching the
+ * behavior of the loop this was factored out of.
+ */
+ALWAYS_INLINE static s32 check_wall_collision_surface(struct Surface *surf, Vec3f pos, f32 radius, f32 *marginRadius) {
+    const f32 corner_threshold = -0.9f;
+    register f32 offset;
+    Vec3f v0, v1, v2;
+    register f32 d00, d01, d11, d20, d21;
+    register f32 invDenom;
+    register f32 v, w;
+    f32 margin_radius = *marginRadius;
+
+    // Dot of normal and pos, + origin offset
+    offset = (surf->normal.x * pos[0]) + (surf->normal.y * pos[1]) + (surf->normal.z * pos[2]) + surf->originOffset;
+
+    // Exclude surfaces outside of the radius.
+    if (offset < -radius || offset > radius) return FALSE;
+
+    vec3_diff(v0, surf->vertex2, surf->vertex1);
+    vec3_diff(v1, surf->vertex3, surf->vertex1);
+    vec3_diff(v2, pos,           surf->vertex1);
+
+    // Face
+    d00 = vec3_dot(v0, v0);
+    d01 = vec3_dot(v0, v1);
+    d11 = vec3_dot(v1, v1);
+    d20 = vec3_dot(v2, v0);
+    d21 = vec3_dot(v2, v1);
+
+    invDenom = (d00 * d11) - (d01 * d01);
+    if (FLT_IS_NONZERO(invDenom)) invDenom = 1.0f / invDenom;
+
+    v = ((d11 * d20) - (d01 * d21)) * invDenom;
+    if (v < 0.0f || v > 1.0f) goto edge_1_2;
+
+    w = ((d00 * d21) - (d01 * d20)) * invDenom;
+    if (w < 0.0f || w > 1.0f || v + w > 1.0f) goto edge_1_2;
+
+    pos[0] += surf->normal.x * (radius - offset);
+    pos[2] += surf->normal.z * (radius - offset);
+    return TRUE;
+
+edge_1_2:
+    if (offset < 0) return FALSE;
+    CALC_OFFSET(v0, goto edge_1_3);
+
+edge_1_3:
+    CALC_OFFSET(v1, goto edge_2_3);
+
+edge_2_3:
+    vec3_diff(v1, surf->vertex3, surf->vertex2);
+    vec3_diff(v2, pos, surf->vertex2);
+    CALC_OFFSET(v1, return FALSE);
+
+check_collision:
+    if (FLT_IS_NONZERO(invDenom)) invDenom = (offset / invDenom);
+    pos[0] += (d00 *= invDenom);
+    pos[2] += (d01 *= invDenom);
+    *marginRadius = margin_radius + 0.01f;
+    if ((d00 * surf->normal.x) + (d01 * surf->normal.z) < (corner_threshold * offset)) return FALSE;
+
+    return TRUE;
+}
+#undef CALC_OFFSET
+
+/**
+ * Exclude walls the query can never touch (wrong vertical span, camera-only
+ * surfaces, vanish cap walls the object passes through) before doing any math.
+ */
+ALWAYS_INLINE static s32 wall_is_candidate(struct Surface *surf, TerrainData type) {
+    // Determine if checking for the camera or not.
+    if (gCollisionFlags & COLLISION_FLAG_CAMERA) {
+        if (surf->flags & SURFACE_FLAG_NO_CAM_COLLISION) return FALSE;
+    } else {
+        // Ignore camera only surfaces.
+        if (type == SURFACE_CAMERA_BOUNDARY) return FALSE;
+
+        // If an object can pass through a vanish cap wall, pass through.
+        if (type == SURFACE_VANISH_CAP_WALLS && o != NULL) {
+            // If an object can pass through a vanish cap wall, pass through.
+            if (o->activeFlags & ACTIVE_FLAG_MOVE_THROUGH_GRATE) return FALSE;
+            // If Mario has a vanish cap, pass through the vanish cap wall.
+            if (o == gMarioObject && gMarioState->flags & MARIO_VANISH_CAP) return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
 /**
  * Iterate through the list of walls until all walls are checked and
  * have given their wall push.
  */
 static s32 find_wall_collisions_from_list(struct SurfaceNode *surfaceNode, struct WallCollisionData *data) {
-    const f32 corner_threshold = -0.9f;
     register struct Surface *surf;
-    register f32 offset;
     register f32 radius = data->radius;
 
     Vec3f pos = { data->x, data->y + data->offsetY, data->z };
-    Vec3f v0, v1, v2;
-    register f32 d00, d01, d11, d20, d21;
-    register f32 invDenom;
-    register f32 v, w;
     register TerrainData type = SURFACE_DEFAULT;
     s32 numCols = 0;
 
@@ -53,95 +139,163 @@ static s32 find_wall_collisions_from_list(struct SurfaceNode *surfaceNode, struc
 
     f32 margin_radius = radius - 1.0f;
 
+    FRAME_STAT_INC(FRAME_STAT_CELLS_VISITED);
+
     // Stay in this loop until out of walls.
     while (surfaceNode != NULL) {
         surf        = surfaceNode->surface;
         surfaceNode = surfaceNode->next;
         type        = surf->type;
+        FRAME_STAT_INC(FRAME_STAT_SURFACES_TESTED);
 
         // Exclude a large number of walls immediately to optimize.
         if (pos[1] < surf->lowerY || pos[1] > surf->upperY) continue;
 
-        // Determine if checking for the camera or not.
-        if (gCollisionFlags & COLLISION_FLAG_CAMERA) {
-            if (surf->flags & SURFACE_FLAG_NO_CAM_COLLISION) continue;
-        } else {
-            // Ignore camera only surfaces.
-            if (type == SURFACE_CAMERA_BOUNDARY) continue;
+        if (!wall_is_candidate(surf, type)) continue;
 
-            // If an object can pass through a vanish cap wall, pass through.
-            if (type == SURFACE_VANISH_CAP_WALLS && o != NULL) {
-                // If an object can pass through a vanish cap wall, pass through.
-                if (o->activeFlags & ACTIVE_FLAG_MOVE_THROUGH_GRATE) continue;
-                // If Mario has a vanish cap, pass through the vanish cap wall.
-                if (o == gMarioObject && gMarioState->flags & MARIO_VANISH_CAP) continue;
-            }
+        if (!check_wall_collision_surface(surf, pos, radius, &margin_radius)) continue;
+
+        if (data->numWalls < MAX_REFERENCED_WALLS) {
+            data->walls[data->numWalls++] = surf;
         }
+        numCols++;
 
-        // Dot of normal and pos, + origin offset
-        offset = (surf->normal.x * pos[0]) + (surf->normal.y * pos[1]) + (surf->normal.z * pos[2]) + surf->originOffset;
+        if (gCollisionFlags & COLLISION_FLAG_RETURN_FIRST) {
+            break;
+        }
+    }
+    data->x = pos[0];
+    data->z = pos[2];
+    return numCols;
+}
 
-        // Exclude surfaces outside of the radius.
-        if (offset < -radius || offset > radius) continue;
-    
-        vec3_diff(v0, surf->vertex2, surf->vertex1);
-        vec3_diff(v1, surf->vertex3, surf->vertex1);
-        vec3_diff(v2, pos,           surf->vertex1);
+#ifdef COLLISION_PAIRED_WALL_QUERIES
+/**
+ * Run the wall push for two collision circles that share an XZ position but
+ * differ in height and radius with a single pass over the wall list, so
+ * paired queries (Mario's lower and upper body) chase the node chain and load
+ * each surface only once. Either data pointer may be NULL when that band was
+ * rejected by the cell bounds. COLLISION_FLAG_RETURN_FIRST is not honored
+ * here; the Mario step path never sets it.
+ */
+static void find_wall_collisions_from_list_paired(struct SurfaceNode *surfaceNode, struct WallCollisionData *dataA,
+                                                  struct WallCollisionData *dataB) {
+    register struct Surface *surf;
+    register TerrainData type = SURFACE_DEFAULT;
+    Vec3f posA, posB;
+    f32 radiusA = 0.0f, radiusB = 0.0f;
+    f32 marginA = 0.0f, marginB = 0.0f;
+
+    if (dataA != NULL) {
+        vec3f_set(posA, dataA->x, dataA->y + dataA->offsetY, dataA->z);
+        radiusA = (dataA->radius > 200) ? 200 : dataA->radius;
+        marginA = radiusA - 1.0f;
+    }
+    if (dataB != NULL) {
+        vec3f_set(posB, dataB->x, dataB->y + dataB->offsetY, dataB->z);
+        radiusB = (dataB->radius > 200) ? 200 : dataB->radius;
+        marginB = radiusB - 1.0f;
+    }
 
-        // Face
-        d00 = vec3_dot(v0, v0);
-        d01 = vec3_dot(v0, v1);
-        d11 = vec3_dot(v1, v1);
-        d20 = vec3_dot(v2, v0);
-        d21 = vec3_dot(v2, v1);
+    FRAME_STAT_INC(FRAME_STAT_CELLS_VISITED);
 
-        invDenom = (d00 * d11) - (d01 * d01);
-        if (FLT_IS_NONZERO(invDenom)) invDenom = 1.0f / invDenom;
+    while (surfaceNode != NULL) {
+        surf        = surfaceNode->surface;
+        surfaceNode = surfaceNode->next;
+        type        = surf->type;
+        FRAME_STAT_INC(FRAME_STAT_SURFACES_TESTED);
 
-        v = ((d11 * d20) - (d01 * d21)) * invDenom;
-        if (v < 0.0f || v > 1.0f) goto edge_1_2;
+        if (dataA != NULL && posA[1] >= surf->lowerY && posA[1] <= surf->upperY
+            && wall_is_candidate(surf, type)
+            && check_wall_collision_surface(surf, posA, radiusA, &marginA)) {
+            if (dataA->numWalls < MAX_REFERENCED_WALLS) {
+                dataA->walls[dataA->numWalls++] = surf;
+            }
+        }
 
-        w = ((d00 * d21) - (d01 * d20)) * invDenom;
-        if (w < 0.0f || w > 1.0f || v + w > 1.0f) goto edge_1_2;
+        if (dataB != NULL && posB[1] >= surf->lowerY && posB[1] <= surf->upperY
+            && wall_is_candidate(surf, type)
+            && check_wall_collision_surface(surf, posB, radiusB, &marginB)) {
+            if (dataB->numWalls < MAX_REFERENCED_WALLS) {
+                dataB->walls[dataB->numWalls++] = surf;
+            }
+        }
+    }
 
-        pos[0] += surf->normal.x * (radius - offset);
-        pos[2] += surf->normal.z * (radius - offset);
-        goto hasCollision;
+    if (dataA != NULL) {
+        dataA->x = posA[0];
+        dataA->z = posA[2];
+    }
+    if (dataB != NULL) {
+        dataB->x = posB[0];
+        dataB->z = posB[2];
+    }
+}
+#endif
 
-    edge_1_2:
-        if (offset < 0) continue;
-        CALC_OFFSET(v0, goto edge_1_3);
+#ifdef COLLISION_STATIC_BVH
+/**
+ * Walk a static surface BVH, running the wall push on every leaf list whose
+ * bounds overlap the collision circle.
+ */
+static s32 find_wall_collisions_from_bvh(s16 nodeIndex, struct WallCollisionData *data) {
+    struct SurfaceBvhNode *node = &sSurfaceBvhPool[nodeIndex];
+    f32 y = data->y + data->offsetY;
+
+    if ((data->x < (node->minX - data->radius)) || (data->x > (node->maxX + data->radius))
+     || (data->z < (node->minZ - data->radius)) || (data->z > (node->maxZ + data->radius))
+     || (y < node->minY) || (y > node->maxY)) {
+        return 0;
+    }
 
-    edge_1_3:
-        CALC_OFFSET(v1, goto edge_2_3);
+    if (node->list != NULL) {
+        return find_wall_collisions_from_list(node->list, data);
+    }
 
-    edge_2_3:
-        vec3_diff(v1, surf->vertex3, surf->vertex2);
-        vec3_diff(v2, pos, surf->vertex2);
-        CALC_OFFSET(v1, continue);
+    return find_wall_collisions_from_bvh(node->left,  data)
+         + find_wall_collisions_from_bvh(node->right, data);
+}
 
-    check_collision:
-        if (FLT_IS_NONZERO(invDenom)) invDenom = (offset / invDenom);
-        pos[0] += (d00 *= invDenom);
-        pos[2] += (d01 *= invDenom);
-        margin_radius += 0.01f;
-        if ((d00 * surf->normal.x) + (d01 * surf->normal.z) < (corner_threshold * offset)) continue;
+#ifdef COLLISION_PAIRED_WALL_QUERIES
+/**
+ * Whether a query circle overlaps a BVH node's bounds.
+ */
+ALWAYS_INLINE static s32 wall_query_overlaps_bvh_node(struct SurfaceBvhNode *node, struct WallCollisionData *data) {
+    f32 y = data->y + data->offsetY;
 
-    hasCollision:
-        if (data->numWalls < MAX_REFERENCED_WALLS) {
-            data->walls[data->numWalls++] = surf;
-        }
-        numCols++;
+    return (data->x >= (node->minX - data->radius)) && (data->x <= (node->maxX + data->radius))
+        && (data->z >= (node->minZ - data->radius)) && (data->z <= (node->maxZ + data->radius))
+        && (y >= node->minY) && (y <= node->maxY);
+}
 
-        if (gCollisionFlags & COLLISION_FLAG_RETURN_FIRST) {
-            break;
-        }
+/**
+ * Walk a static surface BVH once for a pair of wall queries, dropping each
+ * band from the descent as soon as its circle leaves the node bounds.
+ */
+static void find_wall_collisions_from_bvh_paired(s16 nodeIndex, struct WallCollisionData *dataA,
+                                                 struct WallCollisionData *dataB) {
+    struct SurfaceBvhNode *node = &sSurfaceBvhPool[nodeIndex];
+
+    if (dataA != NULL && !wall_query_overlaps_bvh_node(node, dataA)) {
+        dataA = NULL;
     }
-    data->x = pos[0];
-    data->z = pos[2];
-    return numCols;
+    if (dataB != NULL && !wall_query_overlaps_bvh_node(node, dataB)) {
+        dataB = NULL;
+    }
+    if (dataA == NULL && dataB == NULL) {
+        return;
+    }
+
+    if (node->list != NULL) {
+        find_wall_collisions_from_list_paired(node->list, dataA, dataB);
+        return;
+    }
+
+    find_wall_collisions_from_bvh_paired(node->left,  dataA, dataB);
+    find_wall_collisions_from_bvh_paired(node->right, dataA, dataB);
 }
-#undef CALC_OFFSET
+#endif
+#endif
 
 /**
  * Formats the position and wall search for find_wall_collisions.
@@ -172,6 +326,8 @@ s32 f32_find_wall_collision(f32 *xPtr, f32 *yPtr, f32 *zPtr, f32 offsetY, f32 ra
  */
 s32 find_wall_collisions(struct WallCollisionData *colData) {
     struct SurfaceNode *node;
+
+    TERRAIN_LOAD_JOIN();
     s32 numCollisions = 0;
     s32 x = colData->x;
     s32 z = colData->z;
@@ -186,21 +342,44 @@ s32 find_wall_collisions(struct WallCollisionData *colData) {
     s32 cellX = GET_CELL_COORD(x);
     s32 cellZ = GET_CELL_COORD(z);
 
-    if (!(gCollisionFlags & COLLISION_FLAG_EXCLUDE_DYNAMIC)) {
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    s32 y = colData->y + colData->offsetY;
+#endif
+
+    if (!(gCollisionFlags & COLLISION_FLAG_EXCLUDE_DYNAMIC)
+#ifdef COLLISION_CELL_WALL_BOUNDS
+        // Skip the cell's dynamic walls if the query is outside their shared vertical span.
+        && y >= gDynamicWallCellBounds[cellZ][cellX][0]
+        && y <= gDynamicWallCellBounds[cellZ][cellX][1]
+#endif
+    ) {
         // Check for surfaces belonging to objects.
         node = gDynamicSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_WALLS].next;
         numCollisions += find_wall_collisions_from_list(node, colData);
     }
 
     // Check for surfaces that are a part of level geometry.
-    node = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_WALLS].next;
-    numCollisions += find_wall_collisions_from_list(node, colData);
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    if (y < gStaticWallCellBounds[cellZ][cellX][0] || y > gStaticWallCellBounds[cellZ][cellX][1]) {
+        // The query is above or below every static wall in the cell.
+    } else
+#endif
+#ifdef COLLISION_STATIC_BVH
+    if (gStaticSurfaceBvhRoots[cellZ][cellX][SPATIAL_PARTITION_WALLS] != -1) {
+        numCollisions += find_wall_collisions_from_bvh(gStaticSurfaceBvhRoots[cellZ][cellX][SPATIAL_PARTITION_WALLS], colData);
+    } else
+#endif
+    {
+        node = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_WALLS].next;
+        numCollisions += find_wall_collisions_from_list(node, colData);
+    }
 
     gCollisionFlags &= ~(COLLISION_FLAG_RETURN_FIRST | COLLISION_FLAG_EXCLUDE_DYNAMIC | COLLISION_FLAG_INCLUDE_INTANGIBLE);
 #ifdef VANILLA_DEBUG
     // Increment the debug tracker.
     gNumCalls.wall++;
 #endif
+    FRAME_STAT_INC(FRAME_STAT_FIND_WALL);
 
     return numCollisions;
 }
@@ -222,6 +401,112 @@ void resolve_and_return_wall_collisions(Vec3f pos, f32 offset, f32 radius, struc
     pos[2] = collisionData->z;
 }
 
+#ifdef COLLISION_PAIRED_WALL_QUERIES
+/**
+ * Cell-level half of the paired wall query: one cell lookup and one walk of
+ * the dynamic and static wall lists for both bands. Per-band cell bounds
+ * rejections are preserved by dropping that band's data pointer for the list.
+ */
+static void find_wall_collisions_paired(struct WallCollisionData *dataA, struct WallCollisionData *dataB) {
+    s32 x = dataA->x;
+    s32 z = dataA->z;
+
+    dataA->numWalls = 0;
+    dataB->numWalls = 0;
+
+    if (is_outside_level_bounds(x, z)) {
+        return;
+    }
+
+    s32 cellX = GET_CELL_COORD(x);
+    s32 cellZ = GET_CELL_COORD(z);
+
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    s32 yA = dataA->y + dataA->offsetY;
+    s32 yB = dataB->y + dataB->offsetY;
+#endif
+
+    if (!(gCollisionFlags & COLLISION_FLAG_EXCLUDE_DYNAMIC)) {
+        struct WallCollisionData *dynA = dataA;
+        struct WallCollisionData *dynB = dataB;
+#ifdef COLLISION_CELL_WALL_BOUNDS
+        // Skip a band if the query is outside the cell's shared dynamic wall span.
+        if (yA < gDynamicWallCellBounds[cellZ][cellX][0] || yA > gDynamicWallCellBounds[cellZ][cellX][1]) {
+            dynA = NULL;
+        }
+        if (yB < gDynamicWallCellBounds[cellZ][cellX][0] || yB > gDynamicWallCellBounds[cellZ][cellX][1]) {
+            dynB = NULL;
+        }
+#endif
+        if (dynA != NULL || dynB != NULL) {
+            find_wall_collisions_from_list_paired(
+                gDynamicSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_WALLS].next, dynA, dynB);
+        }
+    }
+
+    struct WallCollisionData *statA = dataA;
+    struct WallCollisionData *statB = dataB;
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    if (yA < gStaticWallCellBounds[cellZ][cellX][0] || yA > gStaticWallCellBounds[cellZ][cellX][1]) {
+        statA = NULL;
+    }
+    if (yB < gStaticWallCellBounds[cellZ][cellX][0] || yB > gStaticWallCellBounds[cellZ][cellX][1]) {
+        statB = NULL;
+    }
+#endif
+    if (statA != NULL || statB != NULL) {
+#ifdef COLLISION_STATIC_BVH
+        if (gStaticSurfaceBvhRoots[cellZ][cellX][SPATIAL_PARTITION_WALLS] != -1) {
+            find_wall_collisions_from_bvh_paired(
+                gStaticSurfaceBvhRoots[cellZ][cellX][SPATIAL_PARTITION_WALLS], statA, statB);
+        } else
+#endif
+        {
+            find_wall_collisions_from_list_paired(
+                gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_WALLS].next, statA, statB);
+        }
+    }
+
+    gCollisionFlags &= ~(COLLISION_FLAG_RETURN_FIRST | COLLISION_FLAG_EXCLUDE_DYNAMIC | COLLISION_FLAG_INCLUDE_INTANGIBLE);
+#ifdef VANILLA_DEBUG
+    gNumCalls.wall++;
+#endif
+    FRAME_STAT_INC(FRAME_STAT_FIND_WALL);
+}
+
+/**
+ * Collide a pair of wall queries sharing a position with one list walk.
+ * Equivalent to resolve_and_return_wall_collisions on the first band followed
+ * by the second: both bands are resolved from the same pass, and only if the
+ * first band actually displaced the position (it hit a wall) is the second
+ * band redone from the displaced position like the sequential calls would.
+ */
+void resolve_and_return_wall_collisions_paired(Vec3f pos, f32 offsetFirst, f32 radiusFirst,
+                                               struct WallCollisionData *first, f32 offsetSecond,
+                                               f32 radiusSecond, struct WallCollisionData *second) {
+    first->x = second->x = pos[0];
+    first->y = second->y = pos[1];
+    first->z = second->z = pos[2];
+    first->offsetY = offsetFirst;
+    first->radius = radiusFirst;
+    second->offsetY = offsetSecond;
+    second->radius = radiusSecond;
+
+    find_wall_collisions_paired(first, second);
+
+    pos[0] = first->x;
+    pos[1] = first->y;
+    pos[2] = first->z;
+
+    if (first->numWalls != 0) {
+        resolve_and_return_wall_collisions(pos, offsetSecond, radiusSecond, second);
+    } else {
+        pos[0] = second->x;
+        pos[2] = second->z;
+    }
+}
+#endif
+
 /**************************************************
  *                     CEILINGS                   *
  **************************************************/
@@ -262,17 +547,22 @@ static s32 check_within_ceil_triangle_bounds(s32 x, s32 z, struct Surface *surf,
 
 /**
  * Iterate through the list of ceilings and find the first ceiling over a given point.
+ * Only ceilings below the incoming *pheight are considered, so callers must
+ * initialize it (to CELL_HEIGHT_LIMIT for a fresh search).
  */
 static struct Surface *find_ceil_from_list(struct SurfaceNode *surfaceNode, s32 x, s32 y, s32 z, f32 *pheight) {
     register struct Surface *surf, *ceil = NULL;
     register f32 height;
     SurfaceType type = SURFACE_DEFAULT;
-    *pheight = CELL_HEIGHT_LIMIT;
+
+    FRAME_STAT_INC(FRAME_STAT_CELLS_VISITED);
+
     // Stay in this loop until out of ceilings.
     while (surfaceNode != NULL) {
         surf = surfaceNode->surface;
         surfaceNode = surfaceNode->next;
         type = surf->type;
+        FRAME_STAT_INC(FRAME_STAT_SURFACES_TESTED);
 
         // Exclude all ceilings below the point
         if (y > surf->upperY) continue;
@@ -290,6 +580,20 @@ static struct Surface *find_ceil_from_list(struct SurfaceNode *surfaceNode, s32
         // Check that the point is within the triangle bounds
         if (!check_within_ceil_triangle_bounds(x, z, surf, 1.5f)) continue;
 
+#ifdef COLLISION_FAST_HEIGHT_CHECK
+        // Compare against the plane equation scaled by normal.y (negative for
+        // ceilings, so the comparisons flip), deferring the divide.
+        f32 ny = surf->normal.y;
+        f32 plane = -((x * surf->normal.x) + (z * surf->normal.z) + surf->originOffset);
+
+        // Exclude ceilings above the previous lowest ceiling
+        if (plane < (*pheight * ny)) continue;
+
+        // Checks for ceiling interaction
+        if (plane > ((f32) y * ny)) continue;
+
+        height = (plane / ny);
+#else
         // Find the height of the ceil at the given location
         height = get_surface_height_at_location(x, z, surf);
 
@@ -298,6 +602,7 @@ static struct Surface *find_ceil_from_list(struct SurfaceNode *surfaceNode, s32
 
         // Checks for ceiling interaction
         if (y > height) continue;
+#endif
 
 
         // Use the current ceiling
@@ -311,10 +616,38 @@ static struct Surface *find_ceil_from_list(struct SurfaceNode *surfaceNode, s32
     return ceil;
 }
 
+#ifdef COLLISION_STATIC_BVH
+/**
+ * Walk a static surface BVH and find the lowest ceiling above the given point,
+ * pruning subtrees that are entirely below the point or above the current best.
+ */
+static struct Surface *find_ceil_from_bvh(s16 nodeIndex, s32 x, s32 y, s32 z, f32 *pheight) {
+    struct SurfaceBvhNode *node = &sSurfaceBvhPool[nodeIndex];
+
+    if ((x < node->minX) || (x > node->maxX)
+     || (z < node->minZ) || (z > node->maxZ)
+     || (y > node->maxY) || (node->minY > *pheight)) {
+        return NULL;
+    }
+
+    if (node->list != NULL) {
+        return find_ceil_from_list(node->list, x, y, z, pheight);
+    }
+
+    struct Surface *ceil  = find_ceil_from_bvh(node->left,  x, y, z, pheight);
+    struct Surface *lower = find_ceil_from_bvh(node->right, x, y, z, pheight);
+
+    // The right walk starts from the left walk's height, so it only returns a
+    // surface when it found a lower ceiling.
+    return (lower != NULL) ? lower : ceil;
+}
+#endif
+
 /**
  * Find the lowest ceiling above a given position and return the height.
  */
 f32 find_ceil(f32 posX, f32 posY, f32 posZ, struct Surface **pceil) {
+    TERRAIN_LOAD_JOIN();
     f32 height        = CELL_HEIGHT_LIMIT;
     f32 dynamicHeight = CELL_HEIGHT_LIMIT;
     s32 x = posX;
@@ -346,8 +679,16 @@ f32 find_ceil(f32 posX, f32 posY, f32 posZ, struct Surface **pceil) {
     }
 
     // Check for surfaces that are a part of level geometry.
-    surfaceList = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_CEILS].next;
-    ceil = find_ceil_from_list(surfaceList, x, y, z, &height);
+#ifdef COLLISION_STATIC_BVH
+    s16 bvhRoot = gStaticSurfaceBvhRoots[cellZ][cellX][SPATIAL_PARTITION_CEILS];
+    if (bvhRoot != -1) {
+        ceil = find_ceil_from_bvh(bvhRoot, x, y, z, &height);
+    } else
+#endif
+    {
+        surfaceList = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_CEILS].next;
+        ceil = find_ceil_from_list(surfaceList, x, y, z, &height);
+    }
 
     // Use the lower ceiling.
     if (includeDynamic && height >= dynamicHeight) {
@@ -364,6 +705,7 @@ f32 find_ceil(f32 posX, f32 posY, f32 posZ, struct Surface **pceil) {
     // Increment the debug tracker.
     gNumCalls.ceil++;
 #endif
+    FRAME_STAT_INC(FRAME_STAT_FIND_CEIL);
 
     return height;
 }
@@ -398,11 +740,14 @@ static struct Surface *find_floor_from_list(struct SurfaceNode *surfaceNode, s32
     register f32 height;
     register s32 bufferY = y + FIND_FLOOR_BUFFER;
 
+    FRAME_STAT_INC(FRAME_STAT_CELLS_VISITED);
+
     // Iterate through the list of floors until there are no more floors.
     while (surfaceNode != NULL) {
         surf = surfaceNode->surface;
         surfaceNode = surfaceNode->next;
         type        = surf->type;
+        FRAME_STAT_INC(FRAME_STAT_SURFACES_TESTED);
 
         // To prevent the Merry-Go-Round room from loading when Mario passes above the hole that leads
         // there, SURFACE_INTANGIBLE is used. This prevent the wrong room from loading, but can also allow
@@ -425,6 +770,20 @@ static struct Surface *find_floor_from_list(struct SurfaceNode *surfaceNode, s32
         // Check that the point is within the triangle bounds.
         if (!check_within_floor_triangle_bounds(x, z, surf)) continue;
 
+#ifdef COLLISION_FAST_HEIGHT_CHECK
+        // Compare against the plane equation scaled by normal.y (positive for
+        // floors), deferring the divide until the floor is the new best.
+        f32 ny = surf->normal.y;
+        f32 plane = -((x * surf->normal.x) + (z * surf->normal.z) + surf->originOffset);
+
+        // Exclude floors lower than the previous highest floor.
+        if (plane <= (*pheight * ny)) continue;
+
+        // Checks for floor interaction with a FIND_FLOOR_BUFFER unit buffer.
+        if (((f32) bufferY * ny) < plane) continue;
+
+        height = (plane / ny);
+#else
         // Get the height of the floor under the current location.
         height = get_surface_height_at_location(x, z, surf);
 
@@ -433,6 +792,7 @@ static struct Surface *find_floor_from_list(struct SurfaceNode *surfaceNode, s32
 
         // Checks for floor interaction with a FIND_FLOOR_BUFFER unit buffer.
         if (bufferY < height) continue;
+#endif
 
         // Use the current floor
         *pheight = height;
@@ -445,6 +805,33 @@ static struct Surface *find_floor_from_list(struct SurfaceNode *surfaceNode, s32
     return floor;
 }
 
+#ifdef COLLISION_STATIC_BVH
+/**
+ * Walk a static surface BVH and find the highest floor below the given point,
+ * pruning subtrees that are entirely above the point or below the current best.
+ */
+static struct Surface *find_floor_from_bvh(s16 nodeIndex, s32 x, s32 y, s32 z, f32 *pheight) {
+    struct SurfaceBvhNode *node = &sSurfaceBvhPool[nodeIndex];
+
+    if ((x < node->minX) || (x > node->maxX)
+     || (z < node->minZ) || (z > node->maxZ)
+     || ((y + FIND_FLOOR_BUFFER) < node->minY) || (node->maxY <= *pheight)) {
+        return NULL;
+    }
+
+    if (node->list != NULL) {
+        return find_floor_from_list(node->list, x, y, z, pheight);
+    }
+
+    struct Surface *floor  = find_floor_from_bvh(node->left,  x, y, z, pheight);
+    struct Surface *higher = find_floor_from_bvh(node->right, x, y, z, pheight);
+
+    // The right walk starts from the left walk's height, so it only returns a
+    // surface when it found a higher floor.
+    return (higher != NULL) ? higher : floor;
+}
+#endif
+
 // Generic triangle bounds func
 ALWAYS_INLINE static s32 check_within_bounds_y_norm(s32 x, s32 z, struct Surface *surf) {
     if (surf->normal.y >= NORMAL_FLOOR_THRESHOLD) return check_within_floor_triangle_bounds(x, z, surf);
@@ -545,6 +932,7 @@ f32 unused_find_dynamic_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfl
  * Find the highest floor under a given position and return the height.
  */
 f32 find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
+    TERRAIN_LOAD_JOIN();
     f32 height        = FLOOR_LOWER_LIMIT;
     f32 dynamicHeight = FLOOR_LOWER_LIMIT;
 
@@ -580,8 +968,16 @@ f32 find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
     }
 
     // Check for surfaces that are a part of level geometry.
-    surfaceList = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_FLOORS].next;
-    floor = find_floor_from_list(surfaceList, x, y, z, &height);
+#ifdef COLLISION_STATIC_BVH
+    s16 bvhRoot = gStaticSurfaceBvhRoots[cellZ][cellX][SPATIAL_PARTITION_FLOORS];
+    if (bvhRoot != -1) {
+        floor = find_floor_from_bvh(bvhRoot, x, y, z, &height);
+    } else
+#endif
+    {
+        surfaceList = gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_FLOORS].next;
+        floor = find_floor_from_list(surfaceList, x, y, z, &height);
+    }
 
     // Use the higher floor.
     if (includeDynamic && height <= dynamicHeight) {
@@ -602,9 +998,197 @@ f32 find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
     // Increment the debug tracker.
     gNumCalls.floor++;
 #endif
+    FRAME_STAT_INC(FRAME_STAT_FIND_FLOOR);
     return height;
 }
 
+/**
+ * Run the floor bounds/height tests for a group of queries sharing a cell, so
+ * the cell's surface list is only walked once. Per-surface type filtering
+ * matches find_floor_from_list.
+ */
+static void find_floor_from_list_batch(struct SurfaceNode *surfaceNode, struct FloorQuery **group, s32 groupCount) {
+    register struct Surface *surf;
+    register SurfaceType type = SURFACE_DEFAULT;
+    register f32 height;
+    s32 i;
+
+    FRAME_STAT_INC(FRAME_STAT_CELLS_VISITED);
+
+    while (surfaceNode != NULL) {
+        surf = surfaceNode->surface;
+        surfaceNode = surfaceNode->next;
+        type        = surf->type;
+        FRAME_STAT_INC(FRAME_STAT_SURFACES_TESTED);
+
+        if (!(gCollisionFlags & COLLISION_FLAG_INCLUDE_INTANGIBLE) && (type == SURFACE_INTANGIBLE)) {
+            continue;
+        }
+
+        if (gCollisionFlags & COLLISION_FLAG_CAMERA) {
+            if (surf->flags & SURFACE_FLAG_NO_CAM_COLLISION) {
+                continue;
+            }
+        } else if (type == SURFACE_CAMERA_BOUNDARY) {
+            continue;
+        }
+
+        for (i = 0; i < groupCount; i++) {
+            struct FloorQuery *query = group[i];
+            s32 x = query->pos[0];
+            s32 z = query->pos[2];
+            s32 bufferY = (s32) query->pos[1] + FIND_FLOOR_BUFFER;
+
+            // Exclude all floors above the point.
+            if (bufferY < surf->lowerY) continue;
+            // Check that the point is within the triangle bounds.
+            if (!check_within_floor_triangle_bounds(x, z, surf)) continue;
+
+#ifdef COLLISION_FAST_HEIGHT_CHECK
+            f32 ny = surf->normal.y;
+            f32 plane = -((x * surf->normal.x) + (z * surf->normal.z) + surf->originOffset);
+
+            // Exclude floors lower than the previous highest floor.
+            if (plane <= (query->height * ny)) continue;
+            if (((f32) bufferY * ny) < plane) continue;
+
+            height = (plane / ny);
+#else
+            height = get_surface_height_at_location(x, z, surf);
+
+            // Exclude floors lower than the previous highest floor.
+            if (height <= query->height) continue;
+            if (bufferY < height) continue;
+#endif
+
+            query->height = height;
+            query->floor = surf;
+        }
+    }
+}
+
+/**
+ * Resolve a batch of find_floor queries in place, grouping them by collision
+ * cell so each distinct cell's surface lists are walked once instead of once
+ * per query. gCollisionFlags apply to (and are cleared after) the whole batch.
+ */
+void find_floor_batch(struct FloorQuery *queries, s32 count) {
+    struct FloorQuery *group[FIND_FLOOR_BATCH_MAX];
+    u8 grouped[FIND_FLOOR_BATCH_MAX];
+    s32 i, j;
+
+    if (count > FIND_FLOOR_BATCH_MAX) {
+        count = FIND_FLOOR_BATCH_MAX;
+    }
+
+    s32 includeDynamic = !(gCollisionFlags & COLLISION_FLAG_EXCLUDE_DYNAMIC);
+
+    for (i = 0; i < count; i++) {
+        queries[i].floor = NULL;
+        queries[i].height = FLOOR_LOWER_LIMIT;
+        grouped[i] = FALSE;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (grouped[i]) continue;
+
+        s32 x = queries[i].pos[0];
+        s32 z = queries[i].pos[2];
+
+        if (is_outside_level_bounds(x, z)) {
+            grouped[i] = TRUE;
+            continue;
+        }
+
+        s32 cellX = GET_CELL_COORD(x);
+        s32 cellZ = GET_CELL_COORD(z);
+        s32 groupCount = 0;
+
+        // Collect every remaining query that falls in the same cell.
+        for (j = i; j < count; j++) {
+            if (grouped[j]) continue;
+
+            s32 qx = queries[j].pos[0];
+            s32 qz = queries[j].pos[2];
+
+            if (is_outside_level_bounds(qx, qz)) {
+                grouped[j] = TRUE;
+                continue;
+            }
+
+            if ((GET_CELL_COORD(qx) == cellX) && (GET_CELL_COORD(qz) == cellZ)) {
+                group[groupCount++] = &queries[j];
+                grouped[j] = TRUE;
+            }
+        }
+
+        if (includeDynamic) {
+            find_floor_from_list_batch(gDynamicSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_FLOORS].next, group, groupCount);
+        }
+
+#ifdef COLLISION_STATIC_BVH
+        s16 bvhRoot = gStaticSurfaceBvhRoots[cellZ][cellX][SPATIAL_PARTITION_FLOORS];
+        if (bvhRoot != -1) {
+            // The tree already prunes per query, so walk it individually.
+            for (j = 0; j < groupCount; j++) {
+                struct Surface *floor = find_floor_from_bvh(bvhRoot, group[j]->pos[0], group[j]->pos[1], group[j]->pos[2], &group[j]->height);
+                if (floor != NULL) {
+                    group[j]->floor = floor;
+                }
+            }
+        } else
+#endif
+        {
+            find_floor_from_list_batch(gStaticSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_FLOORS].next, group, groupCount);
+        }
+    }
+
+    gCollisionFlags &= ~(COLLISION_FLAG_RETURN_FIRST | COLLISION_FLAG_EXCLUDE_DYNAMIC | COLLISION_FLAG_INCLUDE_INTANGIBLE);
+}
+
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+/**
+ * find_floor for an object's own position, reusing the object's last result when
+ * it has moved less than FLOOR_CACHE_THRESHOLD per axis and no dynamic floor
+ * touched its collision cell since the cached query. Only static floors are
+ * cached, since the dynamic surface pool is rebuilt every frame.
+ */
+f32 find_object_floor(struct Object *obj, f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
+    s32 x = xPos;
+    s32 y = yPos;
+    s32 z = zPos;
+    struct Surface *cached = obj->floorCacheFloor;
+
+    if ((cached != NULL)
+     && (gCollisionFlags == COLLISION_FLAGS_NONE)
+     && (absf(xPos - obj->floorCachePos[0]) < FLOOR_CACHE_THRESHOLD)
+     && (absf(yPos - obj->floorCachePos[1]) < FLOOR_CACHE_THRESHOLD)
+     && (absf(zPos - obj->floorCachePos[2]) < FLOOR_CACHE_THRESHOLD)
+     && (obj->floorCacheRev == gDynamicCellRevision[GET_CELL_COORD(z)][GET_CELL_COORD(x)])
+     && check_within_floor_triangle_bounds(x, z, cached)) {
+        f32 height = get_surface_height_at_location(x, z, cached);
+
+        // The same buffered interaction check as find_floor_from_list.
+        if (height <= (y + FIND_FLOOR_BUFFER)) {
+            *pfloor = cached;
+            return height;
+        }
+    }
+
+    f32 height = find_floor(xPos, yPos, zPos, pfloor);
+
+    vec3f_set(obj->floorCachePos, xPos, yPos, zPos);
+    obj->floorCacheRev = gDynamicCellRevision[GET_CELL_COORD(z)][GET_CELL_COORD(x)];
+    if ((*pfloor != NULL) && !((*pfloor)->flags & SURFACE_FLAG_DYNAMIC)) {
+        obj->floorCacheFloor = *pfloor;
+    } else {
+        obj->floorCacheFloor = NULL;
+    }
+
+    return height;
+}
+#endif
+
 f32 find_room_floor(f32 x, f32 y, f32 z, struct Surface **pfloor) {
     gCollisionFlags |= (COLLISION_FLAG_RETURN_FIRST | COLLISION_FLAG_EXCLUDE_DYNAMIC | COLLISION_FLAG_INCLUDE_INTANGIBLE);
     return find_floor(x, y, z, pfloor);
@@ -614,6 +1198,7 @@ f32 find_room_floor(f32 x, f32 y, f32 z, struct Surface **pfloor) {
  * Find the highest water floor under a given position and return the height.
  */
 f32 find_water_floor(s32 xPos, s32 yPos, s32 zPos, struct Surface **pfloor) {
+    TERRAIN_LOAD_JOIN();
     f32 height = FLOOR_LOWER_LIMIT;
 
     s32 x = xPos;
@@ -639,6 +1224,7 @@ f32 find_water_floor(s32 xPos, s32 yPos, s32 zPos, struct Surface **pfloor) {
     // Increment the debug tracker.
     gNumCalls.floor++;
 #endif
+    FRAME_STAT_INC(FRAME_STAT_FIND_FLOOR);
     return height;
 }
 
@@ -658,8 +1244,19 @@ s32 find_water_level_and_floor(s32 x, s32 y, s32 z, struct Surface **pfloor) {
 
     if (p != NULL && waterLevel == FLOOR_LOWER_LIMIT) {
         s32 numRegions = *p++;
+#ifdef ENVIRONMENT_REGION_GRID
+        u32 regionMask = is_outside_level_bounds(x, z) ? 0xFFFFFFFF
+                       : gEnvironmentRegionMask[GET_CELL_COORD(z)][GET_CELL_COORD(x)];
+#endif
 
         for (s32 i = 0; i < numRegions; i++) {
+#ifdef ENVIRONMENT_REGION_GRID
+            // Skip regions that don't overlap this cell.
+            if (!(regionMask & (1 << i))) {
+                p += 6;
+                continue;
+            }
+#endif
             val = *p++;
             loX = *p++;
             loZ = *p++;
@@ -694,8 +1291,19 @@ s32 find_water_level(s32 x, s32 z) { // TODO: Allow y pos
 
     if ((p != NULL) && (waterLevel == FLOOR_LOWER_LIMIT)) {
         s32 numRegions = *p++;
+#ifdef ENVIRONMENT_REGION_GRID
+        u32 regionMask = is_outside_level_bounds(x, z) ? 0xFFFFFFFF
+                       : gEnvironmentRegionMask[GET_CELL_COORD(z)][GET_CELL_COORD(x)];
+#endif
 
         for (s32 i = 0; i < numRegions; i++) {
+#ifdef ENVIRONMENT_REGION_GRID
+            // Skip regions that don't overlap this cell.
+            if (!(regionMask & (1 << i))) {
+                p += 6;
+                continue;
+            }
+#endif
             val = *p++;
             loX = *p++;
             loZ = *p++;
@@ -727,8 +1335,19 @@ s32 find_poison_gas_level(s32 x, s32 z) {
 
     if (p != NULL) {
         s32 numRegions = *p++;
+#ifdef ENVIRONMENT_REGION_GRID
+        u32 regionMask = is_outside_level_bounds(x, z) ? 0xFFFFFFFF
+                       : gEnvironmentRegionMask[GET_CELL_COORD(z)][GET_CELL_COORD(x)];
+#endif
 
         for (s32 i = 0; i < numRegions; i++) {
+#ifdef ENVIRONMENT_REGION_GRID
+            // Skip regions that don't overlap this cell.
+            if (!(regionMask & (1 << i))) {
+                p += 6;
+                continue;
+            }
+#endif
             val = *p;
 
             if (val >= 50) {
@@ -33,6 +33,19 @@ enum RaycastFlags {
     RAYCAST_FIND_ALL   = (0xFFFFFFFF)
 };
 
+// The maximum amount of queries accepted by find_floor_batch.
+#define FIND_FLOOR_BATCH_MAX 16
+
+/**
+ * A single query in a find_floor_batch call. pos is read; height and floor are
+ * written back in place.
+ */
+struct FloorQuery {
+    /*0x00*/ Vec3f pos;
+    /*0x0C*/ f32 height;
+    /*0x10*/ struct Surface *floor;
+};
+
 struct WallCollisionData {
     /*0x00*/ f32 x, y, z;
     /*0x0C*/ f32 offsetY;
@@ -45,6 +58,11 @@ struct WallCollisionData {
 s32 f32_find_wall_collision(f32 *xPtr, f32 *yPtr, f32 *zPtr, f32 offsetY, f32 radius);
 s32 find_wall_collisions(struct WallCollisionData *colData);
 void resolve_and_return_wall_collisions(Vec3f pos, f32 offset, f32 radius, struct WallCollisionData *collisionData);
+#ifdef COLLISION_PAIRED_WALL_QUERIES
+void resolve_and_return_wall_collisions_paired(Vec3f pos, f32 offsetFirst, f32 radiusFirst,
+                                               struct WallCollisionData *first, f32 offsetSecond,
+                                               f32 radiusSecond, struct WallCollisionData *second);
+#endif
 f32 find_ceil(f32 posX, f32 posY, f32 posZ, struct Surface **pceil);
 
 // Finds the ceiling from a vec3f and a minimum height (with 3 unit vertical buffer).
@@ -54,6 +72,10 @@ ALWAYS_INLINE f32 find_mario_ceil(Vec3f pos, f32 height, struct Surface **ceil)
 
 f32 find_floor_height(f32 x, f32 y, f32 z);
 f32 find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor);
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+f32 find_object_floor(struct Object *obj, f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor);
+#endif
+void find_floor_batch(struct FloorQuery *queries, s32 count);
 f32 find_room_floor(f32 x, f32 y, f32 z, struct Surface **pfloor);
 s32 find_water_level_and_floor(s32 x, s32 y, s32 z, struct Surface **pfloor);
 s32 find_water_level(s32 x, s32 z);
@@ -1,4 +1,5 @@
 #include <PR/ultratypes.h>
+#include <string.h>
 
 #include "sm64.h"
 #include "game/ingame_menu.h"
@@ -13,7 +14,10 @@
 #include "game/mario.h"
 #include "game/object_list_processor.h"
 #include "surface_load.h"
+#include "buffers/buffers.h"
+#include "game/main.h"
 #include "game/puppyprint.h"
+#include "level_commands.h"
 
 #include "config.h"
 
@@ -24,6 +28,34 @@
 SpatialPartitionCell gStaticSurfacePartition[NUM_CELLS][NUM_CELLS];
 SpatialPartitionCell gDynamicSurfacePartition[NUM_CELLS][NUM_CELLS];
 
+#ifdef VARIABLE_CELL_GRID
+/**
+ * Runtime collision grid granularity. Defaults match CELL_SIZE/NUM_CELLS; levels
+ * override them with SET_COLLISION_CELLS before their terrain loads.
+ */
+s16 gCellSizeShift = CELL_SIZE_SHIFT;
+s16 gNumCellsUsed = NUM_CELLS;
+
+/**
+ * Set the cell size used for newly loaded terrain. Rounded up to a power of two
+ * and clamped so the grid fits within the compile-time NUM_CELLS maximum.
+ */
+void surface_set_cell_size(u32 cellSize) {
+    u32 shift = 0;
+    const u32 minSize = (2 * LEVEL_BOUNDARY_MAX) / NUM_CELLS;
+
+    if (cellSize < minSize) cellSize = minSize;
+    if (cellSize > (2 * LEVEL_BOUNDARY_MAX)) cellSize = (2 * LEVEL_BOUNDARY_MAX);
+
+    while ((1u << shift) < cellSize) {
+        shift++;
+    }
+
+    gCellSizeShift = shift;
+    gNumCellsUsed = ((2 * LEVEL_BOUNDARY_MAX) >> shift);
+}
+#endif
+
 /**
  * Pools of data to contain either surface nodes or surfaces.
  */
@@ -40,16 +72,119 @@ s32 sSurfaceNodePoolSize = SURFACE_NODE_POOL_SIZE;
  */
 s32 sSurfacePoolSize = SURFACE_POOL_SIZE;
 
+#ifdef PER_LEVEL_SURFACE_POOLS
+/**
+ * Dynamic (object) surface headroom added on top of the measured static count
+ * when the level's pools are sized. Object-heavy levels can raise it with the
+ * SURFACE_POOL_RESERVE level script command; it reverts to the default once
+ * the pools are allocated.
+ */
+s32 gDynamicSurfaceReserve = DYNAMIC_SURFACE_POOL_RESERVE;
+#endif
+
+/**
+ * High-water marks for the pools, reset when the pools are allocated.
+ * Shows the real per-stage usage in the puppyprint collision page.
+ */
+s32 gMaxSurfaceNodesAllocated = 0;
+s32 gMaxSurfacesAllocated = 0;
+
 u8 gSurfacePoolError = 0x0;
 
+#ifdef COLLISION_STATIC_BVH
+/**
+ * Pool of BVH nodes, and the per-cell tree roots (-1 = no tree, walk the list).
+ */
+struct SurfaceBvhNode *sSurfaceBvhPool;
+s16 gStaticSurfaceBvhRoots[NUM_CELLS][NUM_CELLS][NUM_SPATIAL_PARTITIONS];
+s32 gSurfaceBvhNodesAllocated = 0;
+
+/**
+ * Pool of SurfaceNode copies the trees are built over. The build relinks nodes
+ * freely while splitting, and the cell partition lists are still walked
+ * directly by raycasts and the debug surface views, so the trees get their own
+ * nodes instead of rethreading the cell lists.
+ */
+static struct SurfaceNode *sSurfaceBvhListPool;
+static s32 sSurfaceBvhListPoolSize = 0;
+static s32 sSurfaceBvhListNodesUsed = 0;
+
+/**
+ * Whether trees are built for newly loaded areas. Levels with sparse collision
+ * can clear this before their terrain loads to keep the plain cell lists.
+ */
+s8 gStaticBvhEnabled = TRUE;
+#endif
+
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+/**
+ * Per-cell revision counters, bumped whenever a dynamic floor is linked into a
+ * cell. An object's cached floor is only reused while its cell's revision is
+ * unchanged, so cells without moving surfaces keep caches alive indefinitely.
+ */
+u16 gDynamicCellRevision[NUM_CELLS][NUM_CELLS];
+#endif
+
+#ifdef COLLISION_CELL_WALL_BOUNDS
+/**
+ * Vertical span ([0] = lowest lowerY, [1] = highest upperY) of each cell's wall
+ * list, widened as walls are bucketed. Lets wall queries skip whole cell lists.
+ */
+s16 gStaticWallCellBounds[NUM_CELLS][NUM_CELLS][2];
+s16 gDynamicWallCellBounds[NUM_CELLS][NUM_CELLS][2];
+
+/**
+ * Reset a wall span grid to empty (min > max, so every query skips it).
+ */
+static void clear_wall_cell_bounds(s16 (*bounds)[NUM_CELLS][2]) {
+    for (s32 cellZ = 0; cellZ < NUM_CELLS; cellZ++) {
+        for (s32 cellX = 0; cellX < NUM_CELLS; cellX++) {
+            bounds[cellZ][cellX][0] =  32767;
+            bounds[cellZ][cellX][1] = -32768;
+        }
+    }
+}
+#endif
+
+#ifdef DYNAMIC_SURFACE_RETENTION
+/**
+ * Recycled dynamic pool entries. Since retained surfaces keep the pools from
+ * resetting to the static counts every frame, unloaded objects return their
+ * surfaces and nodes here instead. Free surfaces are chained through their
+ * (unused while freed) object pointer.
+ */
+static struct SurfaceNode *sFreeSurfaceNodes = NULL;
+static struct Surface *sFreeSurfaces = NULL;
+
+/**
+ * Cell range the current object's surfaces were bucketed into, widened by
+ * add_surface during a rebuild.
+ */
+static s32 sDynMinCellX, sDynMaxCellX, sDynMinCellZ, sDynMaxCellZ;
+#endif
+
 /**
  * Allocate the part of the surface node pool to contain a surface node.
  */
 static struct SurfaceNode *alloc_surface_node(void) {
-    struct SurfaceNode *node = &sSurfaceNodePool[gSurfaceNodesAllocated++];
+    struct SurfaceNode *node;
+
+#ifdef DYNAMIC_SURFACE_RETENTION
+    if (sFreeSurfaceNodes != NULL) {
+        node = sFreeSurfaceNodes;
+        sFreeSurfaceNodes = node->next;
+        node->next = NULL;
+        return node;
+    }
+#endif
+
+    node = &sSurfaceNodePool[gSurfaceNodesAllocated++];
 
     node->next = NULL;
 
+    if (gSurfaceNodesAllocated > gMaxSurfaceNodesAllocated) {
+        gMaxSurfaceNodesAllocated = gSurfaceNodesAllocated;
+    }
     if (gSurfaceNodesAllocated >= sSurfaceNodePoolSize) {
         gSurfacePoolError |= NOT_ENOUGH_ROOM_FOR_NODES;
     }
@@ -62,11 +197,23 @@ static struct SurfaceNode *alloc_surface_node(void) {
  * initialize the surface.
  */
 static struct Surface *alloc_surface(void) {
+    struct Surface *surface;
 
-    struct Surface *surface = &sSurfacePool[gSurfacesAllocated++];
+#ifdef DYNAMIC_SURFACE_RETENTION
+    if (sFreeSurfaces != NULL) {
+        surface = sFreeSurfaces;
+        sFreeSurfaces = (struct Surface *) surface->object;
+    } else
+#endif
+    {
+        surface = &sSurfacePool[gSurfacesAllocated++];
 
-    if (gSurfacesAllocated >= sSurfacePoolSize) {
-        gSurfacePoolError |= NOT_ENOUGH_ROOM_FOR_SURFACES;
+        if (gSurfacesAllocated > gMaxSurfacesAllocated) {
+            gMaxSurfacesAllocated = gSurfacesAllocated;
+        }
+        if (gSurfacesAllocated >= sSurfacePoolSize) {
+            gSurfacePoolError |= NOT_ENOUGH_ROOM_FOR_SURFACES;
+        }
     }
 
     surface->type = SURFACE_DEFAULT;
@@ -94,11 +241,188 @@ static void clear_spatial_partition(SpatialPartitionCell *cells) {
     }
 }
 
+#ifdef COLLISION_STATIC_BVH
+/**
+ * Reset the BVH pool and invalidate every cell's tree root.
+ */
+static void clear_static_surface_bvh(void) {
+    s16 *roots = &gStaticSurfaceBvhRoots[0][0][0];
+    register s32 i = sqr(NUM_CELLS) * NUM_SPATIAL_PARTITIONS;
+
+    while (i--) {
+        *roots++ = -1;
+    }
+
+    gSurfaceBvhNodesAllocated = 0;
+    sSurfaceBvhListNodesUsed = 0;
+}
+
+static s16 alloc_surface_bvh_node(void) {
+    struct SurfaceBvhNode *node = &sSurfaceBvhPool[gSurfaceBvhNodesAllocated];
+
+    node->left  = -1;
+    node->right = -1;
+    node->list  = NULL;
+
+    return gSurfaceBvhNodesAllocated++;
+}
+
+/**
+ * Compute the bounds of every surface in a list, and return the list length.
+ */
+static s32 surface_list_bounds(struct SurfaceNode *list, struct SurfaceBvhNode *node) {
+    s32 count = 0;
+    s32 minX, maxX, minZ, maxZ;
+
+    // Sentinels within TerrainData range; boxes only ever grow outward from these.
+    node->minX = node->minZ = node->minY =  32767;
+    node->maxX = node->maxZ = node->maxY = -32768;
+
+    while (list != NULL) {
+        struct Surface *surf = list->surface;
+
+        min_max_3i(surf->vertex1[0], surf->vertex2[0], surf->vertex3[0], &minX, &maxX);
+        min_max_3i(surf->vertex1[2], surf->vertex2[2], surf->vertex3[2], &minZ, &maxZ);
+
+        if (minX < node->minX) node->minX = minX;
+        if (maxX > node->maxX) node->maxX = maxX;
+        if (minZ < node->minZ) node->minZ = minZ;
+        if (maxZ > node->maxZ) node->maxZ = maxZ;
+        if (surf->lowerY < node->minY) node->minY = surf->lowerY;
+        if (surf->upperY > node->maxY) node->maxY = surf->upperY;
+
+        count++;
+        list = list->next;
+    }
+
+    return count;
+}
+
+/**
+ * Copy a cell's surface list into the BVH list pool, preserving its order.
+ * Returns NULL (and releases any partial copy) when the pool can't fit it.
+ */
+static struct SurfaceNode *copy_surface_list_for_bvh(struct SurfaceNode *list) {
+    s32 start = sSurfaceBvhListNodesUsed;
+    struct SurfaceNode *node;
+
+    while (list != NULL) {
+        if (sSurfaceBvhListNodesUsed >= sSurfaceBvhListPoolSize) {
+            sSurfaceBvhListNodesUsed = start;
+            return NULL;
+        }
+
+        node = &sSurfaceBvhListPool[sSurfaceBvhListNodesUsed++];
+        node->surface = list->surface;
+        node->next = (list->next != NULL) ? (node + 1) : NULL;
+
+        list = list->next;
+    }
+
+    return (sSurfaceBvhListNodesUsed > start) ? &sSurfaceBvhListPool[start] : NULL;
+}
+
+/**
+ * Recursively build an AABB tree over a copy of a cell's surface list (see
+ * copy_surface_list_for_bvh). Interior nodes split their list in place along
+ * the longer lateral axis, which is why the build only ever relinks copies.
+ */
+static s16 build_surface_bvh(struct SurfaceNode *list) {
+    s16 nodeIndex = alloc_surface_bvh_node();
+    struct SurfaceBvhNode *node = &sSurfaceBvhPool[nodeIndex];
+
+    s32 count = surface_list_bounds(list, node);
+
+    // Keep short lists as plain leaves. Also stop splitting when the pool can't
+    // fit the worst-case subtree (2 * count nodes), so child allocations below
+    // never overflow; oversized cells just degrade to larger leaves.
+    if ((count <= SURFACE_BVH_LEAF_SIZE)
+     || ((gSurfaceBvhNodesAllocated + 2 * count) > SURFACE_BVH_POOL_SIZE)) {
+        node->list = list;
+        return nodeIndex;
+    }
+
+    s32 axis = ((node->maxX - node->minX) >= (node->maxZ - node->minZ)) ? 0 : 2;
+    // Compare unscaled vertex sums against 3x the split plane to avoid divides.
+    s32 mid3 = ((s32) node->minX + (s32) node->maxX) * 3 / 2;
+    if (axis == 2) {
+        mid3 = ((s32) node->minZ + (s32) node->maxZ) * 3 / 2;
+    }
+
+    struct SurfaceNode *lower = NULL;
+    struct SurfaceNode *upper = NULL;
+
+    while (list != NULL) {
+        struct SurfaceNode *next = list->next;
+        struct Surface *surf = list->surface;
+        s32 center3 = (s32) surf->vertex1[axis] + (s32) surf->vertex2[axis] + (s32) surf->vertex3[axis];
+
+        if (center3 < mid3) {
+            list->next = lower;
+            lower = list;
+        } else {
+            list->next = upper;
+            upper = list;
+        }
+
+        list = next;
+    }
+
+    // Degenerate split (all centroids on one side): keep the node as a leaf.
+    if (lower == NULL || upper == NULL) {
+        node->list = (lower != NULL) ? lower : upper;
+        return nodeIndex;
+    }
+
+    node->left  = build_surface_bvh(lower);
+    node->right = build_surface_bvh(upper);
+
+    return nodeIndex;
+}
+
+/**
+ * Build the per-cell AABB trees over the static floor, ceiling and wall lists.
+ * Water lists are skipped since find_water_floor needs the full list anyway.
+ */
+static void load_static_surface_bvh(void) {
+    s32 cellZ, cellX, listIndex;
+
+    clear_static_surface_bvh();
+
+    if (!gStaticBvhEnabled) {
+        return;
+    }
+
+    for (cellZ = 0; cellZ < NUM_CELLS; cellZ++) {
+        for (cellX = 0; cellX < NUM_CELLS; cellX++) {
+            for (listIndex = SPATIAL_PARTITION_FLOORS; listIndex <= SPATIAL_PARTITION_WALLS; listIndex++) {
+                struct SurfaceNode *list = gStaticSurfacePartition[cellZ][cellX][listIndex].next;
+
+                if (list != NULL && gSurfaceBvhNodesAllocated < SURFACE_BVH_POOL_SIZE) {
+                    list = copy_surface_list_for_bvh(list);
+
+                    // Cells whose copy didn't fit just keep walking the plain list.
+                    if (list != NULL) {
+                        gStaticSurfaceBvhRoots[cellZ][cellX][listIndex] = build_surface_bvh(list);
+                    }
+                }
+            }
+        }
+    }
+}
+#endif
+
 /**
  * Clears the static (level) surface partitions for new use.
  */
 static void clear_static_surfaces(void) {
     clear_spatial_partition(&gStaticSurfacePartition[0][0]);
+#ifdef COLLISION_STATIC_BVH
+    clear_static_surface_bvh();
+#endif
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    clear_wall_cell_bounds(gStaticWallCellBounds);
+#endif
 }
 
 /**
@@ -128,11 +452,24 @@ static void add_surface_to_cell(s32 dynamic, s32 cellX, s32 cellZ, struct Surfac
 
     s32 surfacePriority = surface->upperY * sortDir;
 
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    if (listIndex == SPATIAL_PARTITION_WALLS) {
+        s16 *bounds = (dynamic ? gDynamicWallCellBounds : gStaticWallCellBounds)[cellZ][cellX];
+        if (surface->lowerY < bounds[0]) bounds[0] = surface->lowerY;
+        if (surface->upperY > bounds[1]) bounds[1] = surface->upperY;
+    }
+#endif
+
     struct SurfaceNode *newNode = alloc_surface_node();
     newNode->surface = surface;
 
     if (dynamic) {
         list = &gDynamicSurfacePartition[cellZ][cellX][listIndex];
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+        if (listIndex == SPATIAL_PARTITION_FLOORS) {
+            gDynamicCellRevision[cellZ][cellX]++;
+        }
+#endif
     } else {
         list = &gStaticSurfacePartition[cellZ][cellX][listIndex];
     }
@@ -165,6 +502,16 @@ static s32 lower_cell_index(s32 coord) {
     }
 
     // [0, NUM_CELLS)
+#ifdef VARIABLE_CELL_GRID
+    s32 index = coord >> gCellSizeShift;
+
+    // Include extra cell if close to boundary
+    //! Some wall checks are larger than the buffer, meaning wall checks can
+    //  miss walls that are near a cell border.
+    if ((coord & ((1 << gCellSizeShift) - 1)) < 50) {
+        index--;
+    }
+#else
     s32 index = coord / CELL_SIZE;
 
     // Include extra cell if close to boundary
@@ -173,6 +520,7 @@ static s32 lower_cell_index(s32 coord) {
     if (coord % CELL_SIZE < 50) {
         index--;
     }
+#endif
 
     // Potentially > NUM_CELLS - 1, but since the upper index is <= NUM_CELLS - 1, not exploitable
     return MAX(0, index);
@@ -191,6 +539,19 @@ static s32 upper_cell_index(s32 coord) {
     }
 
     // [0, NUM_CELLS)
+#ifdef VARIABLE_CELL_GRID
+    s32 index = coord >> gCellSizeShift;
+
+    // Include extra cell if close to boundary
+    //! Some wall checks are larger than the buffer, meaning wall checks can
+    //  miss walls that are near a cell border.
+    if ((coord & ((1 << gCellSizeShift) - 1)) > ((1 << gCellSizeShift) - 50)) {
+        index++;
+    }
+
+    // Potentially < 0, but since lower index is >= 0, not exploitable
+    return MIN((gNumCellsUsed - 1), index);
+#else
     s32 index = coord / CELL_SIZE;
 
     // Include extra cell if close to boundary
@@ -202,6 +563,7 @@ static s32 upper_cell_index(s32 coord) {
 
     // Potentially < 0, but since lower index is >= 0, not exploitable
     return MIN((NUM_CELLS - 1), index);
+#endif
 }
 
 /**
@@ -223,6 +585,15 @@ static void add_surface(struct Surface *surface, s32 dynamic) {
     s32 minCellZ = lower_cell_index(minZ);
     s32 maxCellZ = upper_cell_index(maxZ);
 
+#ifdef DYNAMIC_SURFACE_RETENTION
+    if (dynamic) {
+        if (minCellX < sDynMinCellX) sDynMinCellX = minCellX;
+        if (maxCellX > sDynMaxCellX) sDynMaxCellX = maxCellX;
+        if (minCellZ < sDynMinCellZ) sDynMinCellZ = minCellZ;
+        if (maxCellZ > sDynMaxCellZ) sDynMaxCellZ = maxCellZ;
+    }
+#endif
+
     for (cellZ = minCellZ; cellZ <= maxCellZ; cellZ++) {
         for (cellX = minCellX; cellX <= maxCellX; cellX++) {
             add_surface_to_cell(dynamic, cellX, cellZ, surface);
@@ -270,29 +641,53 @@ static struct Surface *read_surface_data(TerrainData *vertexData, TerrainData **
     return surface;
 }
 
+/**
+ * The single definition of every surface type's classification properties:
+ * slipperiness class, footstep sound column, whether its tris carry a force
+ * value, and whether it loads without camera collision. Unlisted types get
+ * the zero entry (default class, default sound, no force, camera collides).
+ * Queried through the SURFACE_TYPE_* macros in surface_terrains.h.
+ */
+const u8 gSurfaceTypeProps[0x100] = {
+    [SURFACE_0004]                     = SURF_PROP_FORCE, // Unused
+    [SURFACE_FLOWING_WATER]            = SURF_PROP_FORCE,
+    [SURFACE_DEEP_MOVING_QUICKSAND]    = SURF_PROP_FORCE,
+    [SURFACE_SHALLOW_MOVING_QUICKSAND] = SURF_PROP_FORCE,
+    [SURFACE_MOVING_QUICKSAND]         = SURF_PROP_FORCE,
+    [SURFACE_HORIZONTAL_WIND]          = SURF_PROP_FORCE,
+    [SURFACE_INSTANT_MOVING_QUICKSAND] = SURF_PROP_FORCE,
+
+    [SURFACE_HARD]                     = SURF_PROP_SOUND(1),
+    [SURFACE_NOT_SLIPPERY]             = SURF_PROP_CLASS(SURFACE_CLASS_NOT_SLIPPERY)  | SURF_PROP_SOUND(1),
+    [SURFACE_HARD_NOT_SLIPPERY]        = SURF_PROP_CLASS(SURFACE_CLASS_NOT_SLIPPERY)  | SURF_PROP_SOUND(1),
+    [SURFACE_SWITCH]                   = SURF_PROP_CLASS(SURFACE_CLASS_NOT_SLIPPERY)  | SURF_PROP_SOUND(1) | SURF_PROP_NO_CAM_COL,
+
+    [SURFACE_SLIPPERY]                 = SURF_PROP_CLASS(SURFACE_CLASS_SLIPPERY)      | SURF_PROP_SOUND(2),
+    [SURFACE_HARD_SLIPPERY]            = SURF_PROP_CLASS(SURFACE_CLASS_SLIPPERY)      | SURF_PROP_SOUND(2),
+    [SURFACE_NO_CAM_COL_SLIPPERY]      = SURF_PROP_CLASS(SURFACE_CLASS_SLIPPERY)      | SURF_PROP_SOUND(2),
+    [SURFACE_NOISE_SLIPPERY]           = SURF_PROP_CLASS(SURFACE_CLASS_SLIPPERY)      | SURF_PROP_SOUND(5),
+
+    [SURFACE_VERY_SLIPPERY]            = SURF_PROP_CLASS(SURFACE_CLASS_VERY_SLIPPERY) | SURF_PROP_SOUND(3),
+    [SURFACE_ICE]                      = SURF_PROP_CLASS(SURFACE_CLASS_VERY_SLIPPERY) | SURF_PROP_SOUND(3),
+    [SURFACE_HARD_VERY_SLIPPERY]       = SURF_PROP_CLASS(SURFACE_CLASS_VERY_SLIPPERY) | SURF_PROP_SOUND(3),
+    [SURFACE_NOISE_VERY_SLIPPERY_73]   = SURF_PROP_CLASS(SURFACE_CLASS_VERY_SLIPPERY) | SURF_PROP_SOUND(3), // Unused
+    [SURFACE_NOISE_VERY_SLIPPERY_74]   = SURF_PROP_CLASS(SURFACE_CLASS_VERY_SLIPPERY) | SURF_PROP_SOUND(3), // Unused
+    [SURFACE_NOISE_VERY_SLIPPERY]      = SURF_PROP_CLASS(SURFACE_CLASS_VERY_SLIPPERY) | SURF_PROP_SOUND(3),
+    [SURFACE_NO_CAM_COL_VERY_SLIPPERY] = SURF_PROP_CLASS(SURFACE_CLASS_VERY_SLIPPERY) | SURF_PROP_SOUND(3) | SURF_PROP_NO_CAM_COL,
+
+    [SURFACE_NOISE_DEFAULT]            = SURF_PROP_SOUND(4),
+
+    [SURFACE_NO_CAM_COLLISION]         = SURF_PROP_NO_CAM_COL,
+    [SURFACE_NO_CAM_COLLISION_77]      = SURF_PROP_NO_CAM_COL, // Unused
+};
+
 #ifndef ALL_SURFACES_HAVE_FORCE
 /**
  * Returns whether a surface has exertion/moves Mario
  * based on the surface type.
  */
 static s32 surface_has_force(s32 surfaceType) {
-    s32 hasForce = FALSE;
-
-    switch (surfaceType) {
-        case SURFACE_0004: // Unused
-        case SURFACE_FLOWING_WATER:
-        case SURFACE_DEEP_MOVING_QUICKSAND:
-        case SURFACE_SHALLOW_MOVING_QUICKSAND:
-        case SURFACE_MOVING_QUICKSAND:
-        case SURFACE_HORIZONTAL_WIND:
-        case SURFACE_INSTANT_MOVING_QUICKSAND:
-            hasForce = TRUE;
-            break;
-
-        default:
-            break;
-    }
-    return hasForce;
+    return SURFACE_TYPE_HAS_FORCE(surfaceType) != 0;
 }
 #endif
 
@@ -301,21 +696,7 @@ static s32 surface_has_force(s32 surfaceType) {
  * SURFACE_FLAG_NO_CAM_COLLISION flag.
  */
 static s32 surf_has_no_cam_collision(s32 surfaceType) {
-    s32 flags = SURFACE_FLAGS_NONE;
-
-    switch (surfaceType) {
-        case SURFACE_NO_CAM_COLLISION:
-        case SURFACE_NO_CAM_COLLISION_77: // Unused
-        case SURFACE_NO_CAM_COL_VERY_SLIPPERY:
-        case SURFACE_SWITCH:
-            flags = SURFACE_FLAG_NO_CAM_COLLISION;
-            break;
-
-        default:
-            break;
-    }
-
-    return flags;
+    return SURFACE_TYPE_NO_CAM_COL(surfaceType) ? SURFACE_FLAG_NO_CAM_COLLISION : SURFACE_FLAGS_NONE;
 }
 
 /**
@@ -380,6 +761,219 @@ static TerrainData *read_vertex_data(TerrainData **data) {
     return vertexData;
 }
 
+#ifdef ENVIRONMENT_REGION_GRID
+/**
+ * Bitmask per collision cell of which environmental regions overlap it. Baked when an
+ * area's regions load; heights are read from gEnvironmentRegions at query time, so
+ * runtime water level changes don't invalidate the grid.
+ */
+u32 gEnvironmentRegionMask[NUM_CELLS][NUM_CELLS];
+
+/**
+ * Bake the loaded environmental regions into the per-cell lookup grid.
+ */
+static void bake_environment_region_grid(void) {
+    bzero(gEnvironmentRegionMask, sizeof(gEnvironmentRegionMask));
+
+    TerrainData *p = gEnvironmentRegions;
+    if (p == NULL) {
+        return;
+    }
+    s32 numRegions = *p++;
+
+    for (s32 i = 0; i < numRegions; i++) {
+        p++; // region id
+        s32 loX = *p++;
+        s32 loZ = *p++;
+        s32 hiX = *p++;
+        s32 hiZ = *p++;
+        p++; // height
+
+        s32 minCellX = lower_cell_index(loX);
+        s32 maxCellX = upper_cell_index(hiX);
+        s32 minCellZ = lower_cell_index(loZ);
+        s32 maxCellZ = upper_cell_index(hiZ);
+
+        for (s32 cellZ = minCellZ; cellZ <= maxCellZ; cellZ++) {
+            for (s32 cellX = minCellX; cellX <= maxCellX; cellX++) {
+                gEnvironmentRegionMask[cellZ][cellX] |= (1 << i);
+            }
+        }
+    }
+}
+#endif
+
+#ifdef WATER_CURRENT_FIELD
+/**
+ * Baked water current field for the active area. Corner samples of the summed
+ * current over the union of the area's WATER_CURRENT_VOLUME bounds, quantized
+ * to s8 with a shared scale; perform_water_step samples it with one trilinear
+ * fetch regardless of how many volumes contributed.
+ */
+static struct {
+    u8 active;
+    Vec3f min;      // world position of sample [0][0][0]
+    Vec3f step;     // world size of one grid step per axis
+    f32 scale;      // world units per quantized unit
+    s8 samples[WATER_CURRENT_GRID_Y][WATER_CURRENT_GRID_Z][WATER_CURRENT_GRID_X][3];
+} sWaterCurrentField;
+
+/**
+ * Accumulate one volume's current at a world position.
+ */
+static void water_current_eval_source(struct WaterCurrentSource *source, Vec3f pos, Vec3f out) {
+    if (pos[0] < source->min[0] || pos[0] > source->max[0]
+     || pos[1] < source->min[1] || pos[1] > source->max[1]
+     || pos[2] < source->min[2] || pos[2] > source->max[2]) {
+        return;
+    }
+
+    if (source->type == WATER_CURRENT_TYPE_FLOW) {
+        f32 cosPitch = source->speed * coss(source->pitch);
+
+        out[0] += cosPitch * sins(source->yaw);
+        out[1] += source->speed * sins(source->pitch);
+        out[2] += cosPitch * coss(source->yaw);
+    } else { // WATER_CURRENT_TYPE_VORTEX
+        Vec3f center;
+        f32 distance;
+        s16 pitchToCenter, yawToCenter;
+
+        center[0] = ((f32) source->min[0] + source->max[0]) / 2.0f;
+        center[1] = ((f32) source->min[1] + source->max[1]) / 2.0f;
+        center[2] = ((f32) source->min[2] + source->max[2]) / 2.0f;
+        f32 radius = MAX(source->max[0] - center[0], source->max[2] - center[2]);
+
+        vec3f_get_dist_and_angle(pos, center, &distance, &pitchToCenter, &yawToCenter);
+        if (distance >= radius) {
+            return;
+        }
+
+        // Same swirl shape as the vanilla whirlpools in apply_water_current.
+        yawToCenter -= (s16)(0x2000 * 1000.0f / (distance + 1000.0f));
+        f32 strength = source->speed * (1.0f - distance / radius);
+
+        f32 cosPitch = strength * coss(pitchToCenter);
+        out[0] += cosPitch * sins(yawToCenter);
+        out[1] += strength * sins(pitchToCenter);
+        out[2] += cosPitch * coss(yawToCenter);
+    }
+}
+
+/**
+ * Sum every volume at a world position.
+ */
+static void water_current_eval(struct WaterCurrentSource *sources, Vec3f pos, Vec3f out) {
+    struct WaterCurrentSource *source;
+
+    vec3f_set(out, 0.0f, 0.0f, 0.0f);
+    for (source = sources; source != NULL; source = source->next) {
+        water_current_eval_source(source, pos, out);
+    }
+}
+
+/**
+ * Bake the active area's current volumes into the field grid. Two passes: the
+ * first finds the peak component so the shared quantization scale is as fine
+ * as possible, the second quantizes the samples.
+ */
+static void bake_water_current_field(void) {
+    struct WaterCurrentSource *source;
+    Vec3f pos, current;
+    s32 x, y, z, pass;
+    f32 maxComponent = 0.0f;
+
+    sWaterCurrentField.active = FALSE;
+
+    if (gCurrentArea == NULL || gCurrentArea->currentSources == NULL) {
+        return;
+    }
+
+    // Stretch the grid over the union of the volume bounds.
+    vec3f_set(sWaterCurrentField.min,  32767.0f,  32767.0f,  32767.0f);
+    Vec3f max = { -32768.0f, -32768.0f, -32768.0f };
+    for (source = gCurrentArea->currentSources; source != NULL; source = source->next) {
+        for (x = 0; x < 3; x++) {
+            sWaterCurrentField.min[x] = MIN(sWaterCurrentField.min[x], source->min[x]);
+            max[x] = MAX(max[x], source->max[x]);
+        }
+    }
+    sWaterCurrentField.step[0] = (max[0] - sWaterCurrentField.min[0]) / (WATER_CURRENT_GRID_X - 1);
+    sWaterCurrentField.step[1] = (max[1] - sWaterCurrentField.min[1]) / (WATER_CURRENT_GRID_Y - 1);
+    sWaterCurrentField.step[2] = (max[2] - sWaterCurrentField.min[2]) / (WATER_CURRENT_GRID_Z - 1);
+
+    for (pass = 0; pass < 2; pass++) {
+        for (y = 0; y < WATER_CURRENT_GRID_Y; y++) {
+            for (z = 0; z < WATER_CURRENT_GRID_Z; z++) {
+                for (x = 0; x < WATER_CURRENT_GRID_X; x++) {
+                    pos[0] = sWaterCurrentField.min[0] + x * sWaterCurrentField.step[0];
+                    pos[1] = sWaterCurrentField.min[1] + y * sWaterCurrentField.step[1];
+                    pos[2] = sWaterCurrentField.min[2] + z * sWaterCurrentField.step[2];
+                    water_current_eval(gCurrentArea->currentSources, pos, current);
+
+                    if (pass == 0) {
+                        maxComponent = MAX(maxComponent, MAX(absf(current[0]),
+                                           MAX(absf(current[1]), absf(current[2]))));
+                    } else {
+                        sWaterCurrentField.samples[y][z][x][0] = current[0] / sWaterCurrentField.scale;
+                        sWaterCurrentField.samples[y][z][x][1] = current[1] / sWaterCurrentField.scale;
+                        sWaterCurrentField.samples[y][z][x][2] = current[2] / sWaterCurrentField.scale;
+                    }
+                }
+            }
+        }
+
+        if (pass == 0) {
+            if (!FLT_IS_NONZERO(maxComponent)) {
+                return;
+            }
+            sWaterCurrentField.scale = maxComponent / 127.0f;
+        }
+    }
+
+    sWaterCurrentField.active = TRUE;
+}
+
+/**
+ * Sample the baked current field with one trilinear fetch. Writes a zero
+ * vector outside the field (or when the area has no volumes).
+ */
+void water_current_field_sample(Vec3f pos, Vec3f out) {
+    vec3f_set(out, 0.0f, 0.0f, 0.0f);
+
+    if (!sWaterCurrentField.active) {
+        return;
+    }
+
+    f32 fx = (pos[0] - sWaterCurrentField.min[0]) / sWaterCurrentField.step[0];
+    f32 fy = (pos[1] - sWaterCurrentField.min[1]) / sWaterCurrentField.step[1];
+    f32 fz = (pos[2] - sWaterCurrentField.min[2]) / sWaterCurrentField.step[2];
+
+    if (fx < 0.0f || fx > (WATER_CURRENT_GRID_X - 1)
+     || fy < 0.0f || fy > (WATER_CURRENT_GRID_Y - 1)
+     || fz < 0.0f || fz > (WATER_CURRENT_GRID_Z - 1)) {
+        return;
+    }
+
+    s32 x = MIN((s32) fx, WATER_CURRENT_GRID_X - 2);
+    s32 y = MIN((s32) fy, WATER_CURRENT_GRID_Y - 2);
+    s32 z = MIN((s32) fz, WATER_CURRENT_GRID_Z - 2);
+    f32 tx = fx - x;
+    f32 ty = fy - y;
+    f32 tz = fz - z;
+
+    for (s32 i = 0; i < 3; i++) {
+        f32 c00 = sWaterCurrentField.samples[y    ][z    ][x][i] * (1.0f - tx) + sWaterCurrentField.samples[y    ][z    ][x + 1][i] * tx;
+        f32 c01 = sWaterCurrentField.samples[y    ][z + 1][x][i] * (1.0f - tx) + sWaterCurrentField.samples[y    ][z + 1][x + 1][i] * tx;
+        f32 c10 = sWaterCurrentField.samples[y + 1][z    ][x][i] * (1.0f - tx) + sWaterCurrentField.samples[y + 1][z    ][x + 1][i] * tx;
+        f32 c11 = sWaterCurrentField.samples[y + 1][z + 1][x][i] * (1.0f - tx) + sWaterCurrentField.samples[y + 1][z + 1][x + 1][i] * tx;
+
+        out[i] = ((c00 * (1.0f - tz) + c01 * tz) * (1.0f - ty)
+                + (c10 * (1.0f - tz) + c11 * tz) * ty) * sWaterCurrentField.scale;
+    }
+}
+#endif
+
 /**
  * Loads in special environmental regions, such as water, poison gas, and JRB fog.
  */
@@ -393,14 +987,97 @@ static void load_environmental_regions(TerrainData **data) {
         *data += 5;
         gEnvironmentLevels[i] = *(*data)++;
     }
+#ifdef ENVIRONMENT_REGION_GRID
+    bake_environment_region_grid();
+#endif
+}
+
+#ifdef PER_LEVEL_SURFACE_POOLS
+/**
+ * Walk an area's terrain data and count the static surfaces and cell list nodes it will
+ * allocate, mirroring load_area_terrain/add_surface without writing anything. Used to
+ * size the surface pools exactly before they are allocated.
+ */
+void count_area_surface_pool_usage(TerrainData *data, s32 *surfaceCount, s32 *nodeCount) {
+    TerrainData *vertexData = NULL;
+    s32 minX, maxX, minZ, maxZ;
+
+    while (TRUE) {
+        s32 terrainLoadType = *data++;
+
+        if (TERRAIN_LOAD_IS_SURFACE_TYPE_LOW(terrainLoadType)
+         || TERRAIN_LOAD_IS_SURFACE_TYPE_HIGH(terrainLoadType)) {
+#ifndef ALL_SURFACES_HAVE_FORCE
+            s16 hasForce = surface_has_force(terrainLoadType);
+#endif
+            s32 numSurfaces = *data++;
+
+            for (s32 i = 0; i < numSurfaces; i++) {
+                TerrainData *v1 = vertexData + (3 * data[0]);
+                TerrainData *v2 = vertexData + (3 * data[1]);
+                TerrainData *v3 = vertexData + (3 * data[2]);
+
+                min_max_3i(v1[0], v2[0], v3[0], &minX, &maxX);
+                min_max_3i(v1[2], v2[2], v3[2], &minZ, &maxZ);
+
+                *nodeCount += (upper_cell_index(maxX) - lower_cell_index(minX) + 1)
+                            * (upper_cell_index(maxZ) - lower_cell_index(minZ) + 1);
+
+#ifdef ALL_SURFACES_HAVE_FORCE
+                data += 4;
+#else
+                data += 3 + hasForce;
+#endif
+            }
+            *surfaceCount += numSurfaces;
+        } else if (terrainLoadType == TERRAIN_LOAD_VERTICES) {
+            s32 numVertices = *data++;
+            vertexData = data;
+            data += 3 * numVertices;
+        } else if (terrainLoadType == TERRAIN_LOAD_OBJECTS) {
+            data += get_special_objects_size(data);
+        } else if (terrainLoadType == TERRAIN_LOAD_ENVIRONMENT) {
+            s32 numRegions = *data++;
+            data += 6 * numRegions;
+        } else if (terrainLoadType == TERRAIN_LOAD_END) {
+            break;
+        }
+    }
 }
+#endif
+
+#if defined(AREA_STATE_CACHE) && defined(PER_LEVEL_SURFACE_POOLS)
+static void area_state_cache_alloc(void);
+#endif
 
 /**
  * Allocate some of the main pool for surfaces (2300 surf) and for surface nodes (7000 nodes).
  */
 void alloc_surface_pools(void) {
+    MEM_TAG(MEM_TAG_SURFACES);
     sSurfaceNodePool = main_pool_alloc(sSurfaceNodePoolSize * sizeof(struct SurfaceNode), MEMORY_POOL_LEFT);
     sSurfacePool = main_pool_alloc(sSurfacePoolSize * sizeof(struct Surface), MEMORY_POOL_LEFT);
+    gMaxSurfaceNodesAllocated = 0;
+    gMaxSurfacesAllocated = 0;
+#ifdef COLLISION_STATIC_BVH
+    sSurfaceBvhPool = main_pool_alloc(SURFACE_BVH_POOL_SIZE * sizeof(struct SurfaceBvhNode), MEMORY_POOL_LEFT);
+    // The list copies only ever cover the static floor/ceil/wall lists, so the
+    // static node maximum bounds them.
+#ifdef PER_LEVEL_SURFACE_POOLS
+    sSurfaceBvhListPoolSize = sSurfaceNodePoolSize - (4 * gDynamicSurfaceReserve);
+#else
+    sSurfaceBvhListPoolSize = sSurfaceNodePoolSize;
+#endif
+    if (sSurfaceBvhListPoolSize < 0) {
+        sSurfaceBvhListPoolSize = 0;
+    }
+    sSurfaceBvhListPool = main_pool_alloc(sSurfaceBvhListPoolSize * sizeof(struct SurfaceNode), MEMORY_POOL_LEFT);
+    clear_static_surface_bvh();
+#endif
+#if defined(AREA_STATE_CACHE) && defined(PER_LEVEL_SURFACE_POOLS)
+    area_state_cache_alloc();
+#endif
+    MEM_TAG(MEM_TAG_OTHER);
 
     gCCMEnteredSlide = FALSE;
     reset_red_coins_collected();
@@ -463,6 +1140,324 @@ u32 get_area_terrain_size(TerrainData *data) {
 #endif
 
 
+/**
+ * Publish the static surface counts and build the derived acceleration data
+ * once every surface of the area is in the pools.
+ */
+static void terrain_load_finalize(void) {
+    gNumStaticSurfaceNodes = gSurfaceNodesAllocated;
+    gNumStaticSurfaces = gSurfacesAllocated;
+
+#ifdef COLLISION_STATIC_BVH
+    load_static_surface_bvh();
+#endif
+#ifdef WATER_CURRENT_FIELD
+    bake_water_current_field();
+#endif
+}
+
+#ifdef ASYNC_TERRAIN_LOADING
+/**
+ * Background static collision builder. load_area_terrain records each surface
+ * section of the terrain stream (pointer, vertex table, type) instead of
+ * building it, then hands the list to a worker thread that runs below the
+ * game thread, so triangle construction and cell insertion soak up the time
+ * the game thread spends blocked on the warp's remaining DMA and vsync waits.
+ * Everything the worker touches -- the surface pools, cell partitions and the
+ * room table cursor -- is private to it until terrain_load_join, which every
+ * collision query entry point calls through TERRAIN_LOAD_JOIN().
+ */
+#define TERRAIN_WORKER_MAX_SECTIONS 64
+// Below the game thread (10) and the segment loader's idle priority, so the
+// build never delays a transfer or the script work it overlaps with.
+#define TERRAIN_WORKER_PRI 4
+
+struct TerrainSurfaceSection {
+    TerrainData *data; // positioned at the section's surface count
+    TerrainData *vertexData;
+    s32 loadType;
+};
+
+static struct TerrainSurfaceSection sTerrainSections[TERRAIN_WORKER_MAX_SECTIONS];
+static s32 sTerrainNumSections = 0;
+static RoomData *sTerrainRoomCursor = NULL;
+static OSThread sTerrainWorkerThread;
+static u8 sTerrainWorkerActive = FALSE;
+static OSMesgQueue sTerrainFeedQueue;
+static OSMesg sTerrainFeedMesg;
+static OSMesgQueue sTerrainDoneQueue;
+static OSMesg sTerrainDoneMesg;
+volatile u8 gTerrainJobPending = FALSE;
+
+/**
+ * Build every recorded section, in stream order: the room table advances one
+ * entry per surface, so sections cannot be reordered or split.
+ */
+static void terrain_process_sections(void) {
+    s32 i;
+
+    for (i = 0; i < sTerrainNumSections; i++) {
+        TerrainData *data = sTerrainSections[i].data;
+
+        load_static_surfaces(&data, sTerrainSections[i].vertexData,
+                             sTerrainSections[i].loadType, &sTerrainRoomCursor);
+    }
+    sTerrainNumSections = 0;
+}
+
+/**
+ * Record a surface section for the worker and skip past it in the stream.
+ * Builds inline when the worker isn't running; an overflowing section list is
+ * drained in place so ordering holds.
+ */
+static void terrain_defer_surfaces(TerrainData **data, TerrainData *vertexData, s32 surfaceType) {
+    s32 numSurfaces;
+
+    if (!sTerrainWorkerActive) {
+        load_static_surfaces(data, vertexData, surfaceType, &sTerrainRoomCursor);
+        return;
+    }
+    if (sTerrainNumSections >= TERRAIN_WORKER_MAX_SECTIONS) {
+        terrain_process_sections();
+    }
+    sTerrainSections[sTerrainNumSections].data = *data;
+    sTerrainSections[sTerrainNumSections].vertexData = vertexData;
+    sTerrainSections[sTerrainNumSections].loadType = surfaceType;
+    sTerrainNumSections++;
+
+    numSurfaces = *(*data)++;
+#ifdef ALL_SURFACES_HAVE_FORCE
+    *data += 4 * numSurfaces;
+#else
+    *data += (3 + surface_has_force(surfaceType)) * numSurfaces;
+#endif
+}
+
+static void thread12_terrain_worker(UNUSED void *arg) {
+    OSMesg mesg;
+
+    while (TRUE) {
+        osRecvMesg(&sTerrainFeedQueue, &mesg, OS_MESG_BLOCK);
+        terrain_process_sections();
+        terrain_load_finalize();
+        osSendMesg(&sTerrainDoneQueue, NULL, OS_MESG_NOBLOCK);
+    }
+}
+
+/**
+ * Block until the in-flight terrain build has finished. Prefer the
+ * TERRAIN_LOAD_JOIN() guard, which skips the call when nothing is pending.
+ */
+void terrain_load_join(void) {
+    OSMesg mesg;
+
+    if (gTerrainJobPending) {
+        osRecvMesg(&sTerrainDoneQueue, &mesg, OS_MESG_BLOCK);
+        gTerrainJobPending = FALSE;
+    }
+}
+
+void create_terrain_worker_thread(void) {
+    osCreateMesgQueue(&sTerrainFeedQueue, &sTerrainFeedMesg, 1);
+    osCreateMesgQueue(&sTerrainDoneQueue, &sTerrainDoneMesg, 1);
+    osCreateThread(&sTerrainWorkerThread, THREAD_12_TERRAIN_WORKER, thread12_terrain_worker, NULL,
+                   gTerrainWorkerThreadStack + 0x800, TERRAIN_WORKER_PRI);
+    osStartThread(&sTerrainWorkerThread);
+    sTerrainWorkerActive = TRUE;
+}
+#endif // ASYNC_TERRAIN_LOADING
+
+#if defined(AREA_STATE_CACHE) && defined(PER_LEVEL_SURFACE_POOLS)
+/**
+ * Retained static collision builds of recently left areas. A build is captured
+ * from the live pools just before they are cleared for the next area, and
+ * restored to the exact addresses it was captured from, so every internal
+ * pointer (cell lists into the node pool, nodes into the surface pool, BVH
+ * leaves into both) stays valid without fixups. Entries are keyed by the
+ * terrain data pointer, which is unique per area and stable for the level's
+ * lifetime; the whole cache is dropped when the pools are reallocated.
+ */
+struct AreaStateCacheSlot {
+    TerrainData *terrainData; // key; NULL while the slot is empty
+    u32 stamp;                // LRU: older stamps are evicted first
+    s32 numSurfaces;
+    s32 numNodes;
+    struct Surface *surfaces;
+    struct SurfaceNode *nodes;
+    SpatialPartitionCell (*partition)[NUM_CELLS];
+#ifdef COLLISION_STATIC_BVH
+    s32 numBvhNodes;
+    s32 numBvhListNodes;
+    struct SurfaceBvhNode *bvhNodes;
+    struct SurfaceNode *bvhListNodes;
+    s16 (*bvhRoots)[NUM_CELLS][NUM_SPATIAL_PARTITIONS];
+#endif
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    s16 (*wallBounds)[NUM_CELLS][2];
+#endif
+};
+
+static struct AreaStateCacheSlot sAreaStateCache[AREA_STATE_CACHE_ENTRIES];
+static u32 sAreaStateCacheStamp = 0;
+static u8 sAreaStateCacheReady = FALSE;
+// Identity of the build currently in the live pools, recorded when it loads.
+static TerrainData *sLiveTerrainData = NULL;
+
+/**
+ * Size and allocate the slot buffers for this level's pools, and drop whatever
+ * the cache held for the previous level. The static maximums are exact under
+ * PER_LEVEL_SURFACE_POOLS, so each slot is as big as the worst area and no
+ * bigger.
+ */
+static void area_state_cache_alloc(void) {
+    s32 maxSurfaces = sSurfacePoolSize - gDynamicSurfaceReserve;
+    s32 maxNodes = sSurfaceNodePoolSize - (4 * gDynamicSurfaceReserve);
+    s32 i;
+
+    sLiveTerrainData = NULL;
+    sAreaStateCacheStamp = 0;
+    sAreaStateCacheReady = (maxSurfaces > 0 && maxNodes > 0);
+    if (!sAreaStateCacheReady) {
+        return;
+    }
+
+    for (i = 0; i < AREA_STATE_CACHE_ENTRIES; i++) {
+        struct AreaStateCacheSlot *slot = &sAreaStateCache[i];
+
+        slot->terrainData = NULL;
+        slot->surfaces = main_pool_alloc(maxSurfaces * sizeof(struct Surface), MEMORY_POOL_LEFT);
+        slot->nodes = main_pool_alloc(maxNodes * sizeof(struct SurfaceNode), MEMORY_POOL_LEFT);
+        slot->partition = main_pool_alloc(sizeof(gStaticSurfacePartition), MEMORY_POOL_LEFT);
+#ifdef COLLISION_STATIC_BVH
+        slot->bvhNodes = main_pool_alloc(SURFACE_BVH_POOL_SIZE * sizeof(struct SurfaceBvhNode), MEMORY_POOL_LEFT);
+        slot->bvhListNodes = main_pool_alloc(sSurfaceBvhListPoolSize * sizeof(struct SurfaceNode), MEMORY_POOL_LEFT);
+        slot->bvhRoots = main_pool_alloc(sizeof(gStaticSurfaceBvhRoots), MEMORY_POOL_LEFT);
+#endif
+#ifdef COLLISION_CELL_WALL_BOUNDS
+        slot->wallBounds = main_pool_alloc(sizeof(gStaticWallCellBounds), MEMORY_POOL_LEFT);
+#endif
+    }
+}
+
+/**
+ * Capture the live static build into a cache slot, reusing the slot that
+ * already holds this area (a refresh) or evicting the least recently used one.
+ * Called before the pools are cleared for the incoming area; a build that
+ * overflowed its pools is not worth keeping.
+ */
+static void area_state_cache_store(void) {
+    struct AreaStateCacheSlot *slot = &sAreaStateCache[0];
+    s32 i;
+
+    if (!sAreaStateCacheReady || sLiveTerrainData == NULL || gSurfacePoolError != 0) {
+        return;
+    }
+
+    for (i = 0; i < AREA_STATE_CACHE_ENTRIES; i++) {
+        if (sAreaStateCache[i].terrainData == sLiveTerrainData) {
+            slot = &sAreaStateCache[i];
+            break;
+        }
+        if (sAreaStateCache[i].terrainData == NULL
+         || sAreaStateCache[i].stamp < slot->stamp) {
+            slot = &sAreaStateCache[i];
+        }
+    }
+
+    slot->terrainData = sLiveTerrainData;
+    slot->stamp = ++sAreaStateCacheStamp;
+    slot->numSurfaces = gNumStaticSurfaces;
+    slot->numNodes = gNumStaticSurfaceNodes;
+    memcpy(slot->surfaces, sSurfacePool, gNumStaticSurfaces * sizeof(struct Surface));
+    memcpy(slot->nodes, sSurfaceNodePool, gNumStaticSurfaceNodes * sizeof(struct SurfaceNode));
+    memcpy(slot->partition, gStaticSurfacePartition, sizeof(gStaticSurfacePartition));
+#ifdef COLLISION_STATIC_BVH
+    slot->numBvhNodes = gSurfaceBvhNodesAllocated;
+    slot->numBvhListNodes = sSurfaceBvhListNodesUsed;
+    memcpy(slot->bvhNodes, sSurfaceBvhPool, gSurfaceBvhNodesAllocated * sizeof(struct SurfaceBvhNode));
+    memcpy(slot->bvhListNodes, sSurfaceBvhListPool, sSurfaceBvhListNodesUsed * sizeof(struct SurfaceNode));
+    memcpy(slot->bvhRoots, gStaticSurfaceBvhRoots, sizeof(gStaticSurfaceBvhRoots));
+#endif
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    memcpy(slot->wallBounds, gStaticWallCellBounds, sizeof(gStaticWallCellBounds));
+#endif
+    sLiveTerrainData = NULL;
+}
+
+/**
+ * Restore a retained build for the incoming area, if one is cached. Returns
+ * TRUE with the pools, partition and derived data exactly as the original
+ * build left them.
+ */
+static s32 area_state_cache_restore(TerrainData *data) {
+    struct AreaStateCacheSlot *slot = NULL;
+    s32 i;
+
+    if (!sAreaStateCacheReady) {
+        return FALSE;
+    }
+
+    for (i = 0; i < AREA_STATE_CACHE_ENTRIES; i++) {
+        if (sAreaStateCache[i].terrainData == data) {
+            slot = &sAreaStateCache[i];
+            break;
+        }
+    }
+    if (slot == NULL) {
+        return FALSE;
+    }
+
+    memcpy(sSurfacePool, slot->surfaces, slot->numSurfaces * sizeof(struct Surface));
+    memcpy(sSurfaceNodePool, slot->nodes, slot->numNodes * sizeof(struct SurfaceNode));
+    memcpy(gStaticSurfacePartition, slot->partition, sizeof(gStaticSurfacePartition));
+#ifdef COLLISION_STATIC_BVH
+    memcpy(sSurfaceBvhPool, slot->bvhNodes, slot->numBvhNodes * sizeof(struct SurfaceBvhNode));
+    memcpy(sSurfaceBvhListPool, slot->bvhListNodes, slot->numBvhListNodes * sizeof(struct SurfaceNode));
+    memcpy(gStaticSurfaceBvhRoots, slot->bvhRoots, sizeof(gStaticSurfaceBvhRoots));
+    gSurfaceBvhNodesAllocated = slot->numBvhNodes;
+    sSurfaceBvhListNodesUsed = slot->numBvhListNodes;
+#endif
+#ifdef COLLISION_CELL_WALL_BOUNDS
+    memcpy(gStaticWallCellBounds, slot->wallBounds, sizeof(gStaticWallCellBounds));
+#endif
+    gSurfacesAllocated = gNumStaticSurfaces = slot->numSurfaces;
+    gSurfaceNodesAllocated = gNumStaticSurfaceNodes = slot->numNodes;
+    slot->stamp = ++sAreaStateCacheStamp;
+    return TRUE;
+}
+
+/**
+ * The restore path's walk of the terrain stream: surface sections and vertex
+ * tables are skipped (the build is already restored), while special objects and
+ * environment boxes load through the normal path so re-entry spawns exactly
+ * what a fresh load would.
+ */
+static void load_area_terrain_retained(s32 index, TerrainData *data) {
+    while (TRUE) {
+        s32 terrainLoadType = *data++;
+
+        if (TERRAIN_LOAD_IS_SURFACE_TYPE_LOW(terrainLoadType)
+         || TERRAIN_LOAD_IS_SURFACE_TYPE_HIGH(terrainLoadType)) {
+            s32 numSurfaces = *data++;
+#ifdef ALL_SURFACES_HAVE_FORCE
+            data += 4 * numSurfaces;
+#else
+            data += (3 + surface_has_force(terrainLoadType)) * numSurfaces;
+#endif
+        } else if (terrainLoadType == TERRAIN_LOAD_VERTICES) {
+            s32 numVertices = *data++;
+            data += 3 * numVertices;
+        } else if (terrainLoadType == TERRAIN_LOAD_OBJECTS) {
+            spawn_special_objects(index, &data);
+        } else if (terrainLoadType == TERRAIN_LOAD_ENVIRONMENT) {
+            load_environmental_regions(&data);
+        } else if (terrainLoadType == TERRAIN_LOAD_END) {
+            break;
+        }
+    }
+}
+#endif // AREA_STATE_CACHE && PER_LEVEL_SURFACE_POOLS
+
 /**
  * Process the level file, loading in vertices, surfaces, some objects, and environmental
  * boxes (water, gas, JRB fog).
@@ -471,10 +1466,46 @@ void load_area_terrain(s32 index, TerrainData *data, RoomData *surfaceRooms, s16
     s32 terrainLoadType;
     TerrainData *vertexData = NULL;
 
+#ifdef ASYNC_TERRAIN_LOADING
+    // Any previous area's build must land before its pools are cleared.
+    terrain_load_join();
+    sTerrainRoomCursor = surfaceRooms;
+    sTerrainNumSections = 0;
+#endif
+
     // Initialize the data for this.
     gEnvironmentRegions = NULL;
+#ifdef ENVIRONMENT_REGION_GRID
+    bzero(gEnvironmentRegionMask, sizeof(gEnvironmentRegionMask));
+#endif
     gSurfaceNodesAllocated = 0;
     gSurfacesAllocated = 0;
+#ifdef DYNAMIC_SURFACE_RETENTION
+    sFreeSurfaceNodes = NULL;
+    sFreeSurfaces = NULL;
+#endif
+
+#if defined(AREA_STATE_CACHE) && defined(PER_LEVEL_SURFACE_POOLS)
+    // Capture the area being left before its build is cleared, then check
+    // whether the incoming one was retained from an earlier visit.
+    area_state_cache_store();
+    sLiveTerrainData = data;
+    if (area_state_cache_restore(data)) {
+        load_area_terrain_retained(index, data);
+
+        if (macroObjects != NULL && *macroObjects != -1) {
+            if (0 <= *macroObjects && *macroObjects < 30) {
+                spawn_macro_objects_hardcoded(index, macroObjects);
+            } else {
+                spawn_macro_objects(index, macroObjects);
+            }
+        }
+#ifdef WATER_CURRENT_FIELD
+        bake_water_current_field();
+#endif
+        return;
+    }
+#endif
 
     clear_static_surfaces();
 
@@ -485,7 +1516,11 @@ void load_area_terrain(s32 index, TerrainData *data, RoomData *surfaceRooms, s16
         terrainLoadType = *data++;
 
         if (TERRAIN_LOAD_IS_SURFACE_TYPE_LOW(terrainLoadType)) {
+#ifdef ASYNC_TERRAIN_LOADING
+            terrain_defer_surfaces(&data, vertexData, terrainLoadType);
+#else
             load_static_surfaces(&data, vertexData, terrainLoadType, &surfaceRooms);
+#endif
         } else if (terrainLoadType == TERRAIN_LOAD_VERTICES) {
             vertexData = read_vertex_data(&data);
         } else if (terrainLoadType == TERRAIN_LOAD_OBJECTS) {
@@ -497,7 +1532,11 @@ void load_area_terrain(s32 index, TerrainData *data, RoomData *surfaceRooms, s16
         } else if (terrainLoadType == TERRAIN_LOAD_END) {
             break;
         } else if (TERRAIN_LOAD_IS_SURFACE_TYPE_HIGH(terrainLoadType)) {
+#ifdef ASYNC_TERRAIN_LOADING
+            terrain_defer_surfaces(&data, vertexData, terrainLoadType);
+#else
             load_static_surfaces(&data, vertexData, terrainLoadType, &surfaceRooms);
+#endif
             continue;
         }
     }
@@ -514,22 +1553,127 @@ void load_area_terrain(s32 index, TerrainData *data, RoomData *surfaceRooms, s16
         }
     }
 
-    gNumStaticSurfaceNodes = gSurfaceNodesAllocated;
-    gNumStaticSurfaces = gSurfacesAllocated;
+#ifdef ASYNC_TERRAIN_LOADING
+    if (sTerrainNumSections > 0) {
+        // Hand the recorded sections to the worker; it publishes the counts
+        // and derived data, and TERRAIN_LOAD_JOIN() gates every query on it.
+        gTerrainJobPending = TRUE;
+        osSendMesg(&sTerrainFeedQueue, NULL, OS_MESG_NOBLOCK);
+        return;
+    }
+#endif
+
+    terrain_load_finalize();
 }
 
 /**
  * If not in time stop, clear the surface partitions.
  */
 void clear_dynamic_surfaces(void) {
+    TERRAIN_LOAD_JOIN();
     if (!(gTimeStopState & TIME_STOP_ACTIVE)) {
         gSurfacesAllocated = gNumStaticSurfaces;
         gSurfaceNodesAllocated = gNumStaticSurfaceNodes;
 
         clear_spatial_partition(&gDynamicSurfacePartition[0][0]);
+#ifdef COLLISION_CELL_WALL_BOUNDS
+        clear_wall_cell_bounds(gDynamicWallCellBounds);
+#endif
+
+#ifdef DYNAMIC_SURFACE_RETENTION
+        // Everything below the high-water mark is reclaimed wholesale.
+        sFreeSurfaceNodes = NULL;
+        sFreeSurfaces = NULL;
+#endif
+    }
+}
+
+#ifdef DYNAMIC_SURFACE_RETENTION
+/**
+ * Unlink and recycle every dynamic surface belonging to obj, walking only the
+ * cells the surfaces were bucketed into. Multi-cell surfaces are pushed to the
+ * free list once and marked SURFACE_FLAG_FREED so their remaining cell links
+ * are still recognized.
+ */
+void unload_object_surfaces(struct Object *obj) {
+    s32 cellX, cellZ, listIndex;
+
+    if (!obj->dynColLoaded) {
+        return;
+    }
+
+    for (cellZ = obj->dynColMinCellZ; cellZ <= obj->dynColMaxCellZ; cellZ++) {
+        for (cellX = obj->dynColMinCellX; cellX <= obj->dynColMaxCellX; cellX++) {
+            for (listIndex = 0; listIndex < NUM_SPATIAL_PARTITIONS; listIndex++) {
+                struct SurfaceNode *node = &gDynamicSurfacePartition[cellZ][cellX][listIndex];
+
+                while (node->next != NULL) {
+                    struct Surface *surf = node->next->surface;
+
+                    if ((surf->flags & SURFACE_FLAG_FREED) || (surf->object == obj)) {
+                        struct SurfaceNode *freed = node->next;
+
+                        node->next = freed->next;
+                        freed->next = sFreeSurfaceNodes;
+                        sFreeSurfaceNodes = freed;
+
+                        if (!(surf->flags & SURFACE_FLAG_FREED)) {
+                            surf->flags |= SURFACE_FLAG_FREED;
+                            surf->object = (struct Object *) sFreeSurfaces;
+                            sFreeSurfaces = surf;
+                        }
+                    } else {
+                        node = node->next;
+                    }
+                }
+
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+                if (listIndex == SPATIAL_PARTITION_FLOORS) {
+                    gDynamicCellRevision[cellZ][cellX]++;
+                }
+#endif
+            }
+        }
     }
+
+    obj->dynColLoaded = FALSE;
 }
 
+/**
+ * Whether the current object's retained surfaces still match its transform.
+ * Builds the transform from position and angle first if nothing else did,
+ * mirroring transform_object_vertices.
+ */
+static s32 object_dynamic_surfaces_current(void) {
+    s32 i;
+
+    if (!o->dynColLoaded) {
+        return FALSE;
+    }
+
+    if (o->header.gfx.throwMatrix == NULL) {
+        o->header.gfx.throwMatrix = &o->transform;
+        obj_build_transform_from_pos_and_angle(o, O_POS_INDEX, O_FACE_ANGLE_INDEX);
+    }
+
+    for (i = 0; i < 3; i++) {
+        if (o->header.gfx.scale[i] != o->dynColScale[i]) {
+            return FALSE;
+        }
+    }
+
+    f32 *cur = (f32 *) o->transform;
+    f32 *old = (f32 *) o->dynColMtx;
+    for (i = 0; i < 16; i++) {
+        if (cur[i] != old[i]) {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+#endif
+
 /**
  * Applies an object's transformation to the object's vertices.
  */
@@ -548,19 +1692,18 @@ void transform_object_vertices(TerrainData **data, TerrainData *vertexData) {
     Mat4 transform;
     mtxf_scale_vec3f(transform, *objectTransform, o->header.gfx.scale);
 
-    // Go through all vertices, rotating and translating them to transform the object.
-    Vec3f pos;
-    while (numVertices--) {
-        vec3s_to_vec3f(pos, vertices);
-        vertices += 3;
-
-        //! No bounds check on vertex data
-        linear_mtxf_mul_vec3_and_translate(transform, vertexData, pos);
-
-        vertexData += 3;
-    }
+    // Rotate and translate all vertices through the shared bulk transform.
+    //! No bounds check on vertex data
+#ifdef DYNAMIC_SURFACE_RETENTION
+    // World space bounds of the collision mesh come from the same pass, for
+    // broadphase consumers (cell range checks, future surface BVHs).
+    mtxf_transform_terrain_points(transform, vertexData, vertices, numVertices,
+                                  o->dynColAABBMin, o->dynColAABBMax);
+#else
+    mtxf_transform_terrain_points(transform, vertexData, vertices, numVertices, NULL, NULL);
+#endif
 
-    *data = vertices;
+    *data = vertices + (3 * numVertices);
 }
 
 /**
@@ -647,7 +1790,11 @@ void load_object_collision_model(void) {
     // On an object's first frame, the distance is set to 19000.0f.
     // If the distance hasn't been updated, update it now.
     if (o->oDistanceToMario == 19000.0f) {
+#ifdef MARIO_PROXIMITY_CACHE
+        marioDist = obj_dist_to_mario(o);
+#else
         marioDist = dist_between_objects(o, gMarioObject);
+#endif
     }
 
 #ifdef AUTO_COLLISION_DISTANCE
@@ -662,6 +1809,39 @@ void load_object_collision_model(void) {
         o->oDrawingDistance = o->oCollisionDistance;
     }
 
+#ifdef DYNAMIC_SURFACE_RETENTION
+    // Update if no Time Stop (retained surfaces persist through it regardless).
+    if (!(gTimeStopState & TIME_STOP_ACTIVE)) {
+        s32 shouldLoad = (marioDist < o->oCollisionDistance)
+                      && !(o->activeFlags & ACTIVE_FLAG_IN_DIFFERENT_ROOM);
+
+        if (!shouldLoad) {
+            unload_object_surfaces(o);
+        } else if (!object_dynamic_surfaces_current()) {
+            // The object moved (or has no surfaces yet), so rebuild.
+            unload_object_surfaces(o);
+
+            sDynMinCellX = sDynMinCellZ = NUM_CELLS - 1;
+            sDynMaxCellX = sDynMaxCellZ = 0;
+
+            collisionData++;
+            transform_object_vertices(&collisionData, vertexData);
+
+            // TERRAIN_LOAD_CONTINUE acts as an "end" to the terrain data.
+            while (*collisionData != TERRAIN_LOAD_CONTINUE) {
+                load_object_surfaces(&collisionData, vertexData);
+            }
+
+            mtxf_copy(o->dynColMtx, o->transform);
+            vec3f_copy(o->dynColScale, o->header.gfx.scale);
+            o->dynColMinCellX = sDynMinCellX;
+            o->dynColMaxCellX = sDynMaxCellX;
+            o->dynColMinCellZ = sDynMinCellZ;
+            o->dynColMaxCellZ = sDynMaxCellZ;
+            o->dynColLoaded = TRUE;
+        }
+    }
+#else
     // Update if no Time Stop, in range, and in the current room.
     if (
         !(gTimeStopState & TIME_STOP_ACTIVE)
@@ -676,5 +1856,6 @@ void load_object_collision_model(void) {
             load_object_surfaces(&collisionData, vertexData);
         }
     }
+#endif
     COND_BIT((marioDist < o->oDrawingDistance), o->header.gfx.node.flags, GRAPH_RENDER_ACTIVE);
 }
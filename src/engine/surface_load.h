@@ -28,19 +28,80 @@ enum SpatialPartitions {
 
 typedef struct SurfaceNode SpatialPartitionCell[NUM_SPATIAL_PARTITIONS];
 
+#ifdef COLLISION_STATIC_BVH
+/**
+ * A node in a static surface AABB tree. Interior nodes reference their two
+ * children by pool index; leaf nodes (children == -1) hold their own copy of
+ * part of a cell's SurfaceNode list, walked with the regular
+ * find_*_from_list routines. The cell partition lists themselves are never
+ * relinked by the build.
+ */
+struct SurfaceBvhNode {
+    TerrainData minX, minY, minZ;
+    TerrainData maxX, maxY, maxZ;
+    s16 left;
+    s16 right;
+    struct SurfaceNode *list;
+};
+#endif
+
 extern SpatialPartitionCell gStaticSurfacePartition[NUM_CELLS][NUM_CELLS];
 extern SpatialPartitionCell gDynamicSurfacePartition[NUM_CELLS][NUM_CELLS];
 extern struct SurfaceNode *sSurfaceNodePool;
 extern struct Surface *sSurfacePool;
 extern s32 sSurfaceNodePoolSize;
 extern s32 sSurfacePoolSize;
+#ifdef PER_LEVEL_SURFACE_POOLS
+extern s32 gDynamicSurfaceReserve;
+#endif
+extern s32 gMaxSurfaceNodesAllocated;
+extern s32 gMaxSurfacesAllocated;
+#ifdef COLLISION_STATIC_BVH
+extern struct SurfaceBvhNode *sSurfaceBvhPool;
+extern s16 gStaticSurfaceBvhRoots[NUM_CELLS][NUM_CELLS][NUM_SPATIAL_PARTITIONS];
+extern s32 gSurfaceBvhNodesAllocated;
+extern s8 gStaticBvhEnabled;
+#endif
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+extern u16 gDynamicCellRevision[NUM_CELLS][NUM_CELLS];
+#endif
+#ifdef ENVIRONMENT_REGION_GRID
+extern u32 gEnvironmentRegionMask[NUM_CELLS][NUM_CELLS];
+#endif
+#ifdef COLLISION_CELL_WALL_BOUNDS
+extern s16 gStaticWallCellBounds[NUM_CELLS][NUM_CELLS][2];
+extern s16 gDynamicWallCellBounds[NUM_CELLS][NUM_CELLS][2];
+#endif
+
+#ifdef WATER_CURRENT_FIELD
+void water_current_field_sample(Vec3f pos, Vec3f out);
+#endif
 
+#ifdef VARIABLE_CELL_GRID
+void surface_set_cell_size(u32 cellSize);
+#endif
+#ifdef PER_LEVEL_SURFACE_POOLS
+void count_area_surface_pool_usage(TerrainData *data, s32 *surfaceCount, s32 *nodeCount);
+#endif
 void alloc_surface_pools(void);
 #ifdef NO_SEGMENTED_MEMORY
 u32 get_area_terrain_size(TerrainData *data);
 #endif
 void load_area_terrain(s32 index, TerrainData *data, RoomData *surfaceRooms, MacroObject *macroObjects);
+#ifdef ASYNC_TERRAIN_LOADING
+extern volatile u8 gTerrainJobPending;
+void create_terrain_worker_thread(void);
+void terrain_load_join(void);
+// Cheap guard for collision query entry points: only calls into the join when
+// a background terrain build is actually in flight.
+#define TERRAIN_LOAD_JOIN() do { if (gTerrainJobPending) { terrain_load_join(); } } while (0)
+#else
+#define TERRAIN_LOAD_JOIN()
+#endif
 void clear_dynamic_surfaces(void);
+#ifdef DYNAMIC_SURFACE_RETENTION
+void unload_object_surfaces(struct Object *obj);
+#endif
 void load_object_collision_model(void);
 
 #endif // SURFACE_LOAD_H
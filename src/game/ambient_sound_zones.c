@@ -0,0 +1,106 @@
+#include <ultra64.h>
+
+#include "sm64.h"
+#include "ambient_sound_zones.h"
+#include "area.h"
+#include "audio/external.h"
+#include "camera.h"
+#include "engine/math_util.h"
+#include "level_update.h"
+
+#ifdef AMBIENT_SOUND_ZONES
+
+/**
+ * Level-authored ambient sound zones.
+ *
+ * Vanilla plays looping ambience (waterfalls, birds, droning) by scattering
+ * invisible emitter objects through a level, each one burning an object slot
+ * and a behavior update every frame just to call play_sound. Zones move that
+ * into level data: AMBIENT_SOUND_ZONE boxes are loaded by the level script
+ * alongside the other area setup commands, and this manager walks the table
+ * once per frame against Mario's position. A zone that Mario is inside keeps
+ * its sound alive by requesting it every frame, exactly like the emitter
+ * behaviors did; a zone he leaves simply stops being requested and the sound
+ * system lets it lapse.
+ *
+ * Zones turn on the moment Mario enters the box and turn off only once he is
+ * AMBIENT_SOUND_ZONE_HYSTERESIS units outside it, so pacing along a zone edge
+ * does not stutter the sound on and off.
+ */
+
+struct AmbientSoundZone gAmbientSoundZones[AMBIENT_SOUND_ZONE_MAX];
+u8 gAmbientZoneCount = 0;
+
+// play_sound keeps a pointer to the source vector it is handed, so each zone
+// needs a source that stays put between frames.
+static Vec3f sAmbientZoneSource[AMBIENT_SOUND_ZONE_MAX];
+
+/**
+ * Fill 'src' with the camera space position of the point of 'zone' nearest the
+ * camera. The sound system reads its source vectors in camera space (the same
+ * convention as header.gfx.cameraToObject): +x pans right and distance is the
+ * vector's length. Emitter objects get that transform for free during
+ * rendering; zones approximate it with the camera's yaw, which leaves the
+ * distance exact and only skews the pan when the camera pitches steeply.
+ */
+static void ambient_zone_calc_source(struct AmbientSoundZone *zone, Vec3f src) {
+    f32 dx = CLAMP(gLakituState.pos[0], zone->min[0], zone->max[0]) - gLakituState.pos[0];
+    f32 dy = CLAMP(gLakituState.pos[1], zone->min[1], zone->max[1]) - gLakituState.pos[1];
+    f32 dz = CLAMP(gLakituState.pos[2], zone->min[2], zone->max[2]) - gLakituState.pos[2];
+    s16 yaw = atan2s(gLakituState.focus[2] - gLakituState.pos[2],
+                     gLakituState.focus[0] - gLakituState.pos[0]);
+
+    src[0] = (dz * sins(yaw)) - (dx * coss(yaw));
+    src[1] = dy;
+    src[2] = -((dx * sins(yaw)) + (dz * coss(yaw)));
+}
+
+/**
+ * Evaluate every zone in the current area against Mario's position and keep
+ * the active ones sounding. Run once per frame from the level update.
+ */
+void ambient_sound_zones_update(void) {
+    struct AmbientSoundZone *zone;
+    f32 margin;
+    s32 i;
+
+    if (gMarioState->marioObj == NULL) {
+        return;
+    }
+
+    for (i = 0; i < gAmbientZoneCount; i++) {
+        zone = &gAmbientSoundZones[i];
+
+        if (zone->area != gCurrAreaIndex) {
+            zone->active = FALSE;
+            continue;
+        }
+
+        margin = zone->active ? AMBIENT_SOUND_ZONE_HYSTERESIS : 0;
+        zone->active = (gMarioState->pos[0] >= zone->min[0] - margin
+                     && gMarioState->pos[0] <= zone->max[0] + margin
+                     && gMarioState->pos[1] >= zone->min[1] - margin
+                     && gMarioState->pos[1] <= zone->max[1] + margin
+                     && gMarioState->pos[2] >= zone->min[2] - margin
+                     && gMarioState->pos[2] <= zone->max[2] + margin);
+
+        if (!zone->active) {
+            continue;
+        }
+
+        // Same gate the vanilla ambience emitters apply in Mario cam.
+        if ((zone->flags & AMBIENT_ZONE_FLAG_QUIET_FIRST_PERSON)
+            && gCamera->mode == CAMERA_MODE_BEHIND_MARIO) {
+            continue;
+        }
+
+        if (zone->flags & AMBIENT_ZONE_FLAG_GLOBAL) {
+            play_sound(zone->soundBits, gGlobalSoundSource);
+        } else {
+            ambient_zone_calc_source(zone, sAmbientZoneSource[i]);
+            play_sound(zone->soundBits, sAmbientZoneSource[i]);
+        }
+    }
+}
+
+#endif // AMBIENT_SOUND_ZONES
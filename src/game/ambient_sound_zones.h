@@ -0,0 +1,31 @@
+#ifndef AMBIENT_SOUND_ZONES_H
+#define AMBIENT_SOUND_ZONES_H
+
+#include "types.h"
+
+#ifdef AMBIENT_SOUND_ZONES
+
+// Play the zone's sound from gGlobalSoundSource (full volume, centered) instead
+// of spatializing it from the nearest point of the zone to the camera.
+#define AMBIENT_ZONE_FLAG_GLOBAL            (1 << 0) // 0x01
+// Mute the zone while the camera is in Mario cam (first person), matching the
+// gate the vanilla ambience/birds/sand emitter behaviors apply.
+#define AMBIENT_ZONE_FLAG_QUIET_FIRST_PERSON (1 << 1) // 0x02
+
+struct AmbientSoundZone {
+    Vec3s min; // Box corners in world space.
+    Vec3s max;
+    s32 soundBits; // SOUND_* id played every frame while the zone is active.
+    u8 flags; // AMBIENT_ZONE_FLAG_*
+    u8 area;
+    u8 active; // Hysteresis state; zones turn off only past the exit margin.
+};
+
+extern struct AmbientSoundZone gAmbientSoundZones[AMBIENT_SOUND_ZONE_MAX];
+extern u8 gAmbientZoneCount;
+
+void ambient_sound_zones_update(void);
+
+#endif // AMBIENT_SOUND_ZONES
+
+#endif // AMBIENT_SOUND_ZONES_H
@@ -12,16 +12,26 @@
 #include "screen_transition.h"
 #include "mario.h"
 #include "mario_actions_cutscene.h"
+#include "micro_coin.h"
+#include "moving_texture.h"
 #include "print.h"
 #include "hud.h"
 #include "audio/external.h"
+#ifdef PAUSE_SCENE_FREEZE
+#include "buffers/buffers.h"
+#endif
 #include "area.h"
 #include "rendering_graph_node.h"
 #include "level_update.h"
+#include "memory.h"
 #include "engine/geo_layout.h"
 #include "save_file.h"
 #include "level_table.h"
 #include "dialog_ids.h"
+#ifdef LEVEL_SNAPSHOT_RESTART
+#include "level_misc_macros.h"
+#include "string.h"
+#endif
 #include "puppyprint.h"
 #include "debug_box.h"
 #include "engine/colors.h"
@@ -176,9 +186,109 @@ void load_obj_warp_nodes(void) {
              != (struct Object *) gObjParentGraphNode.children);
 }
 
+#ifdef LEVEL_SNAPSHOT_RESTART
+/**
+ * Post-load copies of the level data that object collection mutates in place:
+ * each area's macro object list (whose params words pick up RESPAWN_INFO bits
+ * when coins are collected or enemies are killed) and the behaviorArg of every
+ * placed object's SpawnInfo. Restoring them before an area reload respawns the
+ * level exactly as first loaded, without re-running the level script or
+ * touching the cartridge. The buffer is allocated inside the level's main pool
+ * frame, so it is freed with the rest of the level on exit.
+ */
+static MacroObject *sSnapshotMacro[AREA_COUNT];
+static s32 sSnapshotMacroLen[AREA_COUNT];
+static u32 *sSnapshotSpawnArgs = NULL;
+static s8 sSnapshotValid = FALSE;
+
+static s32 macro_object_list_len(MacroObject *data) {
+    s32 len = 0;
+
+    while (data[len++] != MACRO_OBJECT_END()) {
+        len += 4;
+    }
+    return len;
+}
+
+void level_snapshot_capture(void) {
+    s32 i;
+    s32 macroTotal = 0;
+    s32 spawnCount = 0;
+    struct SpawnInfo *spawnInfo;
+    MacroObject *macroBuf;
+    u32 *argBuf;
+
+    sSnapshotValid = FALSE;
+
+    for (i = 0; i < AREA_COUNT; i++) {
+        sSnapshotMacroLen[i] = 0;
+        if (gAreaData[i].macroObjects != NULL) {
+            sSnapshotMacroLen[i] = macro_object_list_len(gAreaData[i].macroObjects);
+            macroTotal += sSnapshotMacroLen[i];
+        }
+        for (spawnInfo = gAreaData[i].objectSpawnInfos; spawnInfo != NULL; spawnInfo = spawnInfo->next) {
+            spawnCount++;
+        }
+    }
+    if (macroTotal == 0 && spawnCount == 0) {
+        return;
+    }
+
+    // The u32 spawn args go first so the s16 macro data after them stays aligned.
+    argBuf = main_pool_alloc(spawnCount * sizeof(u32) + macroTotal * sizeof(MacroObject),
+                             MEMORY_POOL_LEFT);
+    if (argBuf == NULL) {
+        return;
+    }
+    sSnapshotSpawnArgs = argBuf;
+    macroBuf = (MacroObject *) (argBuf + spawnCount);
+
+    for (i = 0; i < AREA_COUNT; i++) {
+        sSnapshotMacro[i] = NULL;
+        if (sSnapshotMacroLen[i] != 0) {
+            sSnapshotMacro[i] = macroBuf;
+            memcpy(macroBuf, gAreaData[i].macroObjects, sSnapshotMacroLen[i] * sizeof(MacroObject));
+            macroBuf += sSnapshotMacroLen[i];
+        }
+        for (spawnInfo = gAreaData[i].objectSpawnInfos; spawnInfo != NULL; spawnInfo = spawnInfo->next) {
+            *argBuf++ = spawnInfo->behaviorArg;
+        }
+    }
+    sSnapshotValid = TRUE;
+}
+
+s32 level_snapshot_restore(void) {
+    s32 i;
+    struct SpawnInfo *spawnInfo;
+    u32 *arg = sSnapshotSpawnArgs;
+
+    if (!sSnapshotValid) {
+        return FALSE;
+    }
+    for (i = 0; i < AREA_COUNT; i++) {
+        if (sSnapshotMacroLen[i] != 0) {
+            memcpy(gAreaData[i].macroObjects, sSnapshotMacro[i], sSnapshotMacroLen[i] * sizeof(MacroObject));
+        }
+        for (spawnInfo = gAreaData[i].objectSpawnInfos; spawnInfo != NULL; spawnInfo = spawnInfo->next) {
+            spawnInfo->behaviorArg = *arg++;
+        }
+    }
+    return TRUE;
+}
+#endif // LEVEL_SNAPSHOT_RESTART
+
 void clear_areas(void) {
     s32 i;
 
+#ifdef TEXTURE_CYCLE_REGISTRY
+    texture_cycle_clear();
+#endif
+#ifdef MICRO_COIN_POOL
+    micro_coin_clear();
+#endif
+#ifdef LEVEL_SNAPSHOT_RESTART
+    sSnapshotValid = FALSE;
+#endif
     gCurrentArea = NULL;
     gWarpTransition.isActive = FALSE;
     gWarpTransition.pauseRendering = FALSE;
@@ -200,6 +310,9 @@ void clear_areas(void) {
         gAreaData[i].unused = NULL;
         gAreaData[i].whirlpools[0] = NULL;
         gAreaData[i].whirlpools[1] = NULL;
+#ifdef WATER_CURRENT_FIELD
+        gAreaData[i].currentSources = NULL;
+#endif
         gAreaData[i].dialog[0] = DIALOG_NONE;
         gAreaData[i].dialog[1] = DIALOG_NONE;
         gAreaData[i].musicParam = 0;
@@ -251,6 +364,12 @@ void load_area(s32 index) {
 
 void unload_area(void) {
     if (gCurrentArea != NULL) {
+#ifdef TEXTURE_CYCLE_REGISTRY
+        texture_cycle_clear();
+#endif
+#ifdef MICRO_COIN_POOL
+        micro_coin_clear();
+#endif
         unload_objects_from_area(0, gCurrentArea->index);
 #ifndef DISABLE_GRAPH_NODE_TYPE_FUNCTIONAL
         geo_call_global_function_nodes(&gCurrentArea->graphNode->node, GEO_CONTEXT_AREA_UNLOAD);
@@ -376,23 +495,90 @@ void play_transition_after_delay(s16 transType, s16 time, u8 red, u8 green, u8 b
 }
 
 void render_game(void) {
+#ifdef FRAME_INTERPOLATION
+    gFrameInterp.sceneValid = FALSE;
+#endif
+#ifdef TEXTURE_CYCLE_REGISTRY
+    texture_cycle_update();
+#endif
+#ifdef PAUSE_SCENE_FREEZE
+    if (sCurrPlayMode != PLAY_MODE_PAUSED) {
+        // Covers unpausing, exiting the course, and warps out of the pause menu.
+        gPauseFreeze.active = FALSE;
+    }
+#endif
     if (gCurrentArea != NULL && !gWarpTransition.pauseRendering) {
         if (gCurrentArea->graphNode) {
+            GFX_POOL_TAG(GFX_POOL_TAG_GRAPH);
+#ifdef PAUSE_SCENE_FREEZE
+            if (gPauseFreeze.active) {
+                // Replay the frozen scene. Its commands use segmented addresses
+                // relative to the pool they were built in, so point the render
+                // segment at the parked pool for the duration of the call.
+                gSPSegment(gDisplayListHead++, SEGMENT_RENDER, VIRTUAL_TO_PHYSICAL(gGfxPools[gPauseFreeze.pool].buffer));
+                gSPDisplayList(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(gPauseFreeze.scene));
+                gSPSegment(gDisplayListHead++, SEGMENT_RENDER, VIRTUAL_TO_PHYSICAL(gGfxPool->buffer));
+            } else if (sCurrPlayMode == PLAY_MODE_PAUSED) {
+                // First paused frame: render the scene once as a callable
+                // sub-list. Two slots are reserved up front so this frame can
+                // call the scene and branch past its G_ENDDL terminator; later
+                // paused frames call gPauseFreeze.scene from their own pools.
+                Gfx *freezeCall = gDisplayListHead;
+                gDisplayListHead += 2;
+                Gfx *sceneStart = gDisplayListHead;
+                geo_process_root(gCurrentArea->graphNode, gViewportOverride, gViewportClip, gFBSetColor);
+                gSPEndDisplayList(gDisplayListHead++);
+                gSPDisplayList(&freezeCall[0], VIRTUAL_TO_PHYSICAL(sceneStart));
+                gSPBranchList(&freezeCall[1], VIRTUAL_TO_PHYSICAL(gDisplayListHead));
+                gPauseFreeze.scene = sceneStart;
+                gPauseFreeze.pool = gGfxPool - gGfxPools;
+                gPauseFreeze.active = TRUE;
+            } else {
+                geo_process_root(gCurrentArea->graphNode, gViewportOverride, gViewportClip, gFBSetColor);
+            }
+#else
             geo_process_root(gCurrentArea->graphNode, gViewportOverride, gViewportClip, gFBSetColor);
+#endif
+#ifdef FRAME_INTERPOLATION
+            s32 interpCapture = TRUE;
+#ifdef PAUSE_SCENE_FREEZE
+            // No interpolating a frozen scene, and the frame after unpausing
+            // may have rotated into pool 2, which frame_interp_build rebuilds
+            // every frame; don't hand it a scene it is about to clobber.
+            interpCapture = (!gPauseFreeze.active && gGfxPool != &gGfxPools[2]);
+#endif
+            if (interpCapture) {
+                // Capture what frame_interp_build needs to traverse this scene
+                // again; everything emitted from here on is the replayable overlay.
+                gFrameInterp.sceneRoot = gCurrentArea->graphNode;
+                gFrameInterp.viewport = gViewportOverride;
+                gFrameInterp.clip = gViewportClip;
+                gFrameInterp.clearColor = gFBSetColor;
+                gFrameInterp.overlayStart = gDisplayListHead;
+                gFrameInterp.sceneValid = TRUE;
+            }
+#endif
         }
 
+#ifdef ADAPTIVE_RESOLUTION
+        // 2D elements drawn through the ortho matrix ride this viewport, so
+        // squashing its y scale/translate squashes them all at once.
+        gViewport.vp.vscale[1] = gViewport.vp.vtrans[1] = ADAPTIVE_RES_Y(SCREEN_HEIGHT * 2);
+#endif
         gSPViewport(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(&gViewport));
 
-        gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, gBorderHeight, SCREEN_WIDTH,
-                      SCREEN_HEIGHT - gBorderHeight);
+        gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, ADAPTIVE_RES_Y(gBorderHeight), SCREEN_WIDTH,
+                      ADAPTIVE_RES_Y(SCREEN_HEIGHT - gBorderHeight));
+        GFX_POOL_TAG(GFX_POOL_TAG_HUD);
         render_hud();
 
-        gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+        gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, 0, SCREEN_WIDTH, ADAPTIVE_RES_Y(SCREEN_HEIGHT));
+        GFX_POOL_TAG(GFX_POOL_TAG_TEXT);
         render_text_labels();
         do_cutscene_handler();
         print_displaying_credits_entry();
-        gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, gBorderHeight, SCREEN_WIDTH,
-                      SCREEN_HEIGHT - gBorderHeight);
+        gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, ADAPTIVE_RES_Y(gBorderHeight), SCREEN_WIDTH,
+                      ADAPTIVE_RES_Y(SCREEN_HEIGHT - gBorderHeight));
         gMenuOptSelectIndex = render_menus_and_dialogs();
 
         if (gMenuOptSelectIndex != 0) {
@@ -429,9 +615,11 @@ void render_game(void) {
         }
     }
 
+    GFX_POOL_TAG(GFX_POOL_TAG_OTHER);
+
     gViewportOverride = NULL;
     gViewportClip     = NULL;
-    
+
     profiler_update(PROFILER_TIME_GFX);
     profiler_print_times();
 #if PUPPYPRINT_DEBUG
@@ -54,6 +54,22 @@ struct Whirlpool {
     /*0x03*/ s16 strength;
 };
 
+#ifdef WATER_CURRENT_FIELD
+/**
+ * A water current volume placed by the WATER_CURRENT_VOLUME level command.
+ * Baked into the area's current field grid when its terrain loads.
+ */
+struct WaterCurrentSource {
+    u8 type;    // WATER_CURRENT_TYPE_*
+    Vec3s min;  // volume bounds
+    Vec3s max;
+    s16 yaw;    // flow direction (unused for vortices)
+    s16 pitch;
+    s16 speed;  // flow speed, or vortex strength (negative pushes outward/up)
+    struct WaterCurrentSource *next;
+};
+#endif
+
 enum AreaFlags {
     AREA_FLAG_UNLOAD,
     AREA_FLAG_LOAD
@@ -74,6 +90,9 @@ struct Area {
     /*0x24*/ struct Camera *camera;
     /*0x28*/ struct UnusedArea28 *unused; // Filled by level script 0x3A, but is unused.
     /*0x2C*/ struct Whirlpool *whirlpools[2];
+#ifdef WATER_CURRENT_FIELD
+    struct WaterCurrentSource *currentSources;
+#endif
     /*0x34*/ u8 dialog[2]; // Level start dialog number (set by level script cmd 0x30)
     /*0x36*/ u16 musicParam;
     /*0x38*/ u16 musicParam2;
@@ -184,6 +203,10 @@ void override_viewport_and_clip(Vp *a, Vp *b, u8 c, u8 d, u8 e);
 void print_intro_text(void);
 u32 get_mario_spawn_type(struct Object *obj);
 struct ObjectWarpNode *area_get_warp_node(u8 id);
+#ifdef LEVEL_SNAPSHOT_RESTART
+void level_snapshot_capture(void);
+s32 level_snapshot_restore(void);
+#endif
 void clear_areas(void);
 void clear_area_graph_nodes(void);
 void load_area(s32 index);
@@ -234,3 +234,24 @@ void set_obj_anim_with_accel_and_sound(s16 frame1, s16 frame2, s32 sound) {
 #include "behaviors/strong_wind_particle.inc.c"
 #include "behaviors/sl_snowman_wind.inc.c"
 #include "behaviors/sl_walking_penguin.inc.c"
+
+#ifdef BHV_LOD_TIERS
+/**
+ * The behavior LOD registry (see struct BehaviorLodTier). Near tier = the
+ * behavior script below farDist, far tier = the listed update in
+ * [farDist, dormantDist), dormant = nothing beyond dormantDist (0 = no
+ * dormant band). A NULL far update skips the script entirely in the far band.
+ * Terminated by a NULL behavior.
+ */
+const struct BehaviorLodTier gBehaviorLodTiers[] = {
+    // Fish glide cheaply at range and stop updating entirely once offscreen;
+    // the spawner respawns them when Mario comes back.
+    { bhvFish,           bhv_fish_update_far, 2500.0f, 6000.0f },
+    // Birds keep flying (and despawning) at any range - their far tier does
+    // the despawn check, so no dormant band.
+    { bhvBird,           bhv_bird_update_far, 3000.0f,    0.0f },
+    // Ambient chirps are inaudible at range; skip the sound script outright.
+    { bhvBirdsSoundLoop, NULL,                4000.0f,    0.0f },
+    { NULL,              NULL,                   0.0f,    0.0f },
+};
+#endif
@@ -198,6 +198,9 @@ void bhv_tuxies_mother_loop(void);
 void bhv_small_penguin_loop(void);
 void bhv_fish_spawner_loop(void);
 void bhv_fish_loop(void);
+#ifdef BHV_LOD_TIERS
+void bhv_fish_update_far(void);
+#endif
 void bhv_wdw_express_elevator_loop(void);
 void bhv_bub_spawner_loop(void);
 void bhv_bub_loop(void);
@@ -523,6 +526,9 @@ void bhv_eyerok_hand_loop(void);
 void bhv_klepto_init(void);
 void bhv_klepto_update(void);
 void bhv_bird_update(void);
+#ifdef BHV_LOD_TIERS
+void bhv_bird_update_far(void);
+#endif
 void bhv_racing_penguin_init(void);
 void bhv_racing_penguin_update(void);
 void bhv_penguin_race_finish_line_update(void);
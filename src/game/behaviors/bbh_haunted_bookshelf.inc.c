@@ -12,7 +12,11 @@ void bhv_haunted_bookshelf_loop(void) {
     // oDistanceToMario is unused by this object.
     // This may have been used for revealing the books when Mario comes near,
     // but in the final game this is done by bhvHauntedBookshelfManager.
+#ifdef MARIO_PROXIMITY_CACHE
+    o->oDistanceToMario = obj_dist_to_mario(o);
+#else
     o->oDistanceToMario = dist_between_objects(o, gMarioObject);
+#endif
 
     o->oFaceAngleYaw = 0;
 
@@ -116,3 +116,29 @@ void bhv_bird_update(void) {
             break;
     }
 }
+
+#ifdef BHV_LOD_TIERS
+/**
+ * Far LOD tier for bhvBird (see gBehaviorLodTiers). Keeps a flying bird moving
+ * on its current pitch and yaw without the steering, rolling or catch-up speed
+ * logic; those resume when the bird is near again. Registered with no dormant
+ * band so the despawn check below always runs and offscreen flocks never leak
+ * object slots. Spawner arming (BIRD_ACT_INACTIVE) stays in the near tier,
+ * since it only triggers within 2000 units anyway.
+ */
+void bhv_bird_update_far(void) {
+    if (o->oAction != BIRD_ACT_FLY) {
+        return;
+    }
+
+    if (o->parentObj->oPosY > 8000.0f) {
+        obj_mark_for_deletion(o);
+        return;
+    }
+
+    obj_compute_vel_from_move_pitch(o->oBirdSpeed);
+    o->oPosX += o->oForwardVel * sins(o->oMoveAngleYaw);
+    o->oPosY += o->oVelY;
+    o->oPosZ += o->oForwardVel * coss(o->oMoveAngleYaw);
+}
+#endif
@@ -1435,7 +1435,7 @@ s32 bowser_check_fallen_off_stage(void) {
     return FALSE;
 }
 
-#ifdef PLATFORM_DISPLACEMENT_2
+#if defined(PLATFORM_DISPLACEMENT_2) && !defined(PLATFORM_RIDER_CACHE)
 struct PlatformDisplacementInfo sBowserDisplacementInfo;
 #endif
 
@@ -1512,8 +1512,10 @@ s8 sBowserHealth[] = { 1, 1, 3 };
  * Update Bowser's actions when he's hands free
  */
 void bowser_free_update(void) {
+#if defined(PLATFORM_DISPLACEMENT_2) && defined(PLATFORM_RIDER_CACHE)
+    apply_object_platform_displacement(o);
+#elif defined(PLATFORM_DISPLACEMENT_2)
     struct Object *platform = o->platform;
-#ifdef PLATFORM_DISPLACEMENT_2
     s16 tmpOFaceAngleYaw = (s16) o->oFaceAngleYaw;
     if (platform != NULL) {
         // NOTE: This function was at one point using '&o->oFaceAngleYaw', which is a s32 address. Should tmpOFaceAngleYaw be using the first 16 bits instead, or was that a bug?
@@ -1521,6 +1523,7 @@ void bowser_free_update(void) {
         o->oFaceAngleYaw = tmpOFaceAngleYaw;
     }
 #else
+    struct Object *platform = o->platform;
     if (platform != NULL) {
         apply_platform_displacement(FALSE, platform);
     }
@@ -41,7 +41,11 @@ void chuckya_act_0(void) {
         o->oChuckyaSubActionTimer = 0;
     }
 
+#ifdef MARIO_PROXIMITY_CACHE
+    o->oAngleToMario = obj_angle_to_mario(o);
+#else
     o->oAngleToMario = obj_angle_to_object(o, gMarioObject);
+#endif
 
     switch (initialSubAction = o->oSubAction) {
         case 0:
@@ -254,3 +254,32 @@ void bhv_fish_loop(void) {
         obj_mark_for_deletion(o);
     }
 }
+
+#ifdef BHV_LOD_TIERS
+/**
+ * Far LOD tier for bhvFish (see gBehaviorLodTiers). Glides the fish along its
+ * current heading and drifts it back toward the school, skipping the per-fish
+ * water probe, wall resolution, animation pacing and flee logic. The water
+ * surface cap reuses the last oFishWaterLevel the full update measured.
+ */
+void bhv_fish_update_far(void) {
+    if (o->parentObj->oAction == FISH_SPAWNER_ACT_RESPAWN) {
+        obj_mark_for_deletion(o);
+        return;
+    }
+
+    // Steer back toward the spawner once outside the roam range, so distant
+    // schools hold together without the per-fish Mario tracking.
+    if (lateral_dist_between_objects(o, o->parentObj) > o->oFishRoamDistance + 500.0f) {
+        cur_obj_rotate_yaw_toward(obj_angle_to_object(o, o->parentObj), 0x200);
+    }
+
+    o->oPosX += o->oForwardVel * sins(o->oMoveAngleYaw);
+    o->oPosZ += o->oForwardVel * coss(o->oMoveAngleYaw);
+    o->oPosY = approach_f32_symmetric(o->oPosY, o->oFishGoalY, 2.0f);
+
+    if (o->oPosY > o->oFishWaterLevel - 50.0f) {
+        o->oPosY = o->oFishWaterLevel - 50.0f;
+    }
+}
+#endif
@@ -109,7 +109,11 @@ void spawn_wf_platform_group(void) {
 void bhv_tower_platform_group_loop(void) {
     f32 marioY = gMarioObject->oPosY;
 
+#ifdef MARIO_PROXIMITY_CACHE
+    o->oDistanceToMario = obj_dist_to_mario(o);
+#else
     o->oDistanceToMario = dist_between_objects(o, gMarioObject);
+#endif
 
     switch (o->oAction) {
         case 0:
@@ -71,7 +71,7 @@ void bhv_small_water_wave_loop(void) {
     if (o->oPosY > find_water_level(o->oPosX, o->oPosZ)) {
         o->activeFlags = ACTIVE_FLAG_DEACTIVATED;
         o->oPosY += 5.0f;
-        if (gFreeObjectList.next != NULL) {
+        if (obj_pool_has_free_slot()) {
             spawn_object(o, MODEL_SMALL_WATER_SPLASH, bhvObjectWaterSplash);
         }
     }
@@ -190,6 +190,10 @@ f32 sCutsceneSplineSegmentProgress;
  */
 s16 sCutsceneSplineSegment;
 
+#ifdef CUTSCENE_SPLINE_BAKE
+static void cutscene_spline_bake_invalidate(void);
+#endif
+
 // Shaky Hand-held Camera effect variables
 struct HandheldShakePoint sHandheldShakeSpline[4];
 s16 sHandheldShakeMag;
@@ -448,6 +452,54 @@ CameraTransition sModeTransitions[] = {
     update_spiral_stairs_camera
 };
 
+void mode_radial_camera(struct Camera *c);
+void mode_8_directions_camera(struct Camera *c);
+void mode_outward_radial_camera(struct Camera *c);
+void mode_boss_fight_camera(struct Camera *c);
+void mode_parallel_tracking_camera(struct Camera *c);
+void mode_fixed_camera(struct Camera *c);
+void mode_behind_mario_camera(struct Camera *c);
+void mode_water_surface_camera(struct Camera *c);
+void mode_lakitu_camera(struct Camera *c);
+void mode_mario_camera(struct Camera *c);
+void mode_spiral_stairs_camera(struct Camera *c);
+void mode_slide_camera(struct Camera *c);
+void mode_c_up_camera(struct Camera *c);
+void mode_cannon_camera(struct Camera *c);
+
+typedef void (*CameraModeFunc)(struct Camera *c);
+
+/**
+ * Per-mode update routine run by update_camera while no cutscene is playing,
+ * indexed by the current camera mode. Modes without a routine (NONE and the
+ * unused ones) leave Lakitu's goals untouched for the frame.
+ */
+static const CameraModeFunc sModeUpdateFuncs[] = {
+    [CAMERA_MODE_RADIAL]            = mode_radial_camera,
+    [CAMERA_MODE_OUTWARD_RADIAL]    = mode_outward_radial_camera,
+    [CAMERA_MODE_BEHIND_MARIO]      = mode_behind_mario_camera,
+    [CAMERA_MODE_CLOSE]             = mode_lakitu_camera,
+    [CAMERA_MODE_C_UP]              = mode_c_up_camera,
+    [CAMERA_MODE_WATER_SURFACE]     = mode_water_surface_camera,
+    [CAMERA_MODE_SLIDE_HOOT]        = mode_slide_camera,
+    [CAMERA_MODE_INSIDE_CANNON]     = mode_cannon_camera,
+    [CAMERA_MODE_BOSS_FIGHT]        = mode_boss_fight_camera,
+    [CAMERA_MODE_PARALLEL_TRACKING] = mode_parallel_tracking_camera,
+    [CAMERA_MODE_FIXED]             = mode_fixed_camera,
+    [CAMERA_MODE_8_DIRECTIONS]      = mode_8_directions_camera,
+    [CAMERA_MODE_FREE_ROAM]         = mode_lakitu_camera,
+    [CAMERA_MODE_SPIRAL_STAIRS]     = mode_spiral_stairs_camera,
+};
+
+/**
+ * Modes that keep their own update routine while the Mario cam is selected;
+ * every other mode falls back to mode_mario_camera.
+ */
+#define MARIO_CAM_MODE_MASK ((1 << CAMERA_MODE_BEHIND_MARIO)  \
+                           | (1 << CAMERA_MODE_C_UP)          \
+                           | (1 << CAMERA_MODE_WATER_SURFACE) \
+                           | (1 << CAMERA_MODE_INSIDE_CANNON))
+
 // Move these two tables to another include file?
 extern u8 sDanceCutsceneIndexTable[][4];
 extern u8 sZoomOutAreaMasks[];
@@ -1327,9 +1379,7 @@ s32 update_parallel_tracking_camera(struct Camera *c, Vec3f focus, Vec3f pos) {
         sParTrackTransOff.pos[2] = oldPos[2] - c->pos[2];
     }
     // Slowly transition to the next path
-    approach_f32_asymptotic_bool(&sParTrackTransOff.pos[0], 0.f, 0.025f);
-    approach_f32_asymptotic_bool(&sParTrackTransOff.pos[1], 0.f, 0.025f);
-    approach_f32_asymptotic_bool(&sParTrackTransOff.pos[2], 0.f, 0.025f);
+    approach_vec3f_asymptotic(sParTrackTransOff.pos, gVec3fZero, 0.025f, 0.025f, 0.025f);
     vec3f_add(c->pos, sParTrackTransOff.pos);
 
     // Check if the camera should go to the next path
@@ -2140,9 +2190,18 @@ s16 update_default_camera(struct Camera *c) {
     marioFloorHeight = 125.f + sMarioGeometry.currFloorHeight;
     marioFloor = sMarioGeometry.currFloor;
     camFloorHeight = find_floor(cPos[0], cPos[1] + 50.f, cPos[2], &cFloor) + 125.f;
+    // Probe the floor along the line from the camera to Mario in one batched
+    // query, since several of the sample points usually share a cell.
+    struct FloorQuery lineFloors[5];
+    s32 numLineFloors = 0;
     for (scale = 0.1f; scale < 1.f; scale += 0.2f) {
         scale_along_line(tempPos, cPos, sMarioCamState->pos, scale);
-        tempFloorHeight = find_floor(tempPos[0], tempPos[1], tempPos[2], &tempFloor) + 125.f;
+        vec3f_copy(lineFloors[numLineFloors++].pos, tempPos);
+    }
+    find_floor_batch(lineFloors, numLineFloors);
+    for (s32 i = 0; i < numLineFloors; i++) {
+        tempFloor = lineFloors[i].floor;
+        tempFloorHeight = lineFloors[i].height + 125.f;
         if (tempFloor != NULL && tempFloorHeight > marioFloorHeight) {
             marioFloorHeight = tempFloorHeight;
             marioFloor = tempFloor;
@@ -2773,6 +2832,36 @@ void set_camera_mode(struct Camera *c, s16 mode, s16 frames) {
 #endif
 }
 
+#ifdef CAMERA_HALF_RATE_MODE_LOGIC
+/**
+ * Whether this frame runs the full camera mode machine. Every other frame is
+ * eligible to skip it, but only while the camera is in an interpolatable steady
+ * state: cutscenes, mode transitions, the init frame and the modes that answer
+ * stick input directly (C-Up, behind-Mario, cannon) always run at full rate.
+ */
+static s32 camera_should_run_mode_logic(struct Camera *c) {
+    if (!(gGlobalTimer & 1)) {
+        return TRUE;
+    }
+    if (c->cutscene != CUTSCENE_NONE) {
+        return TRUE;
+    }
+    if (gCameraMovementFlags & (CAM_MOVE_INIT_CAMERA | CAM_MOVING_INTO_MODE | CAM_MOVE_FIX_IN_PLACE)) {
+        return TRUE;
+    }
+    if ((sStatusFlags & CAM_FLAG_FRAME_AFTER_CAM_INIT) || !(sStatusFlags & CAM_FLAG_SMOOTH_MOVEMENT)) {
+        return TRUE;
+    }
+    switch (c->mode) {
+        case CAMERA_MODE_C_UP:
+        case CAMERA_MODE_BEHIND_MARIO:
+        case CAMERA_MODE_INSIDE_CANNON:
+            return TRUE;
+    }
+    return FALSE;
+}
+#endif
+
 /**
  * Updates Lakitu's position/focus and applies camera shakes.
  */
@@ -2901,6 +2990,11 @@ void update_camera(struct Camera *c) {
 
 #ifdef PUPPYCAM
     if (!gPuppyCam.enabled || c->cutscene != CUTSCENE_NONE || gCurrentArea->camera->mode == CAMERA_MODE_INSIDE_CANNON) {
+#endif
+#ifdef CAMERA_HALF_RATE_MODE_LOGIC
+    s32 runModeLogic = camera_should_run_mode_logic(c);
+
+    if (runModeLogic) {
 #endif
     // Store previous geometry information
     sMarioGeometry.prevFloorHeight = sMarioGeometry.currFloorHeight;
@@ -2911,6 +3005,9 @@ void update_camera(struct Camera *c) {
     sMarioGeometry.prevCeilType = sMarioGeometry.currCeilType;
 
     find_mario_floor_and_ceil(&sMarioGeometry);
+#ifdef CAMERA_HALF_RATE_MODE_LOGIC
+    }
+#endif
     gCollisionFlags |= COLLISION_FLAG_CAMERA;
     vec3f_copy(c->pos, gLakituState.goalPos);
     vec3f_copy(c->focus, gLakituState.goalFocus);
@@ -2941,88 +3038,23 @@ void update_camera(struct Camera *c) {
         }
     }
     // If not in a cutscene, do mode processing
+#ifdef CAMERA_HALF_RATE_MODE_LOGIC
+    if (c->cutscene == CUTSCENE_NONE && !runModeLogic) {
+        // Interpolation frame: hold the goals the last full update computed and
+        // let update_lakitu's asymptotic approach carry the camera toward them.
+        sYawSpeed = 0x400;
+    } else
+#endif
     if (c->cutscene == CUTSCENE_NONE) {
         sYawSpeed = 0x400;
 
-        if (sSelectionFlags & CAM_MODE_MARIO_ACTIVE) {
-            switch (c->mode) {
-                case CAMERA_MODE_BEHIND_MARIO:
-                    mode_behind_mario_camera(c);
-                    break;
-
-                case CAMERA_MODE_C_UP:
-                    mode_c_up_camera(c);
-                    break;
-
-                case CAMERA_MODE_WATER_SURFACE:
-                    mode_water_surface_camera(c);
-                    break;
-
-                case CAMERA_MODE_INSIDE_CANNON:
-                    mode_cannon_camera(c);
-                    break;
-
-                default:
-                    mode_mario_camera(c);
-            }
-        } else {
-            switch (c->mode) {
-                case CAMERA_MODE_BEHIND_MARIO:
-                    mode_behind_mario_camera(c);
-                    break;
-
-                case CAMERA_MODE_C_UP:
-                    mode_c_up_camera(c);
-                    break;
-
-                case CAMERA_MODE_WATER_SURFACE:
-                    mode_water_surface_camera(c);
-                    break;
-
-                case CAMERA_MODE_INSIDE_CANNON:
-                    mode_cannon_camera(c);
-                    break;
-
-                case CAMERA_MODE_8_DIRECTIONS:
-                    mode_8_directions_camera(c);
-                    break;
+        CameraModeFunc modeFunc = sModeUpdateFuncs[c->mode];
 
-                case CAMERA_MODE_RADIAL:
-                    mode_radial_camera(c);
-                    break;
-
-                case CAMERA_MODE_OUTWARD_RADIAL:
-                    mode_outward_radial_camera(c);
-                    break;
-
-                case CAMERA_MODE_CLOSE:
-                    mode_lakitu_camera(c);
-                    break;
-
-                case CAMERA_MODE_FREE_ROAM:
-                    mode_lakitu_camera(c);
-                    break;
-
-                case CAMERA_MODE_BOSS_FIGHT:
-                    mode_boss_fight_camera(c);
-                    break;
-
-                case CAMERA_MODE_PARALLEL_TRACKING:
-                    mode_parallel_tracking_camera(c);
-                    break;
-
-                case CAMERA_MODE_SLIDE_HOOT:
-                    mode_slide_camera(c);
-                    break;
-
-                case CAMERA_MODE_FIXED:
-                    mode_fixed_camera(c);
-                    break;
-
-                case CAMERA_MODE_SPIRAL_STAIRS:
-                    mode_spiral_stairs_camera(c);
-                    break;
-            }
+        if ((sSelectionFlags & CAM_MODE_MARIO_ACTIVE) && !(MARIO_CAM_MODE_MASK & (1 << c->mode))) {
+            modeFunc = mode_mario_camera;
+        }
+        if (modeFunc != NULL) {
+            modeFunc(c);
         }
     }
 #ifdef PUPPYCAM
@@ -3212,6 +3244,9 @@ void init_camera(struct Camera *c) {
     }
     sCutsceneSplineSegment = 0;
     sCutsceneSplineSegmentProgress = 0.f;
+#ifdef CUTSCENE_SPLINE_BAKE
+    cutscene_spline_bake_invalidate();
+#endif
     sHandheldShakeInc = 0.f;
     sHandheldShakeTimer = 0.f;
     sHandheldShakeMag = 0;
@@ -3470,6 +3505,77 @@ void evaluate_cubic_spline(f32 u, Vec3f Q, Vec3f spline1, Vec3f spline2, Vec3f s
     Q[2] = (B[0] * spline1[2]) + (B[1] * spline2[2]) + (B[2] * spline3[2]) + (B[3] * spline4[2]);
 }
 
+#ifdef SPLINE_COEFF_CACHE
+/**
+ * Polynomial coefficients for one cutscene spline segment, so the per-frame work in
+ * move_point_along_spline is a Horner evaluation: Q(u) = ((d * u + c) * u + b) * u + a
+ * per axis. The control points are kept as the cache key because some cutscenes (the
+ * credits) rewrite their spline arrays in place between scenes.
+ */
+struct SplineSegmentCoeffs {
+    struct CutsceneSplinePoint *spline;
+    s32 segment;
+    Vec3s points[4];
+    Vec3f a, b, c, d;
+};
+
+static struct SplineSegmentCoeffs sSplineCoeffCache[2];
+static u8 sSplineCoeffNext = 0;
+
+/**
+ * evaluate_cubic_spline for a segment of a CutsceneSplinePoint array, reusing the
+ * segment's cached polynomial coefficients when it was evaluated before.
+ */
+static void evaluate_cached_spline_segment(f32 u, Vec3f Q, struct CutsceneSplinePoint spline[], s32 segment) {
+    struct SplineSegmentCoeffs *coeffs = NULL;
+    s32 i;
+
+    for (i = 0; i < 2; i++) {
+        struct SplineSegmentCoeffs *entry = &sSplineCoeffCache[i];
+        if (entry->spline == spline && entry->segment == segment) {
+            s32 axis;
+            coeffs = entry;
+            for (axis = 0; axis < 3 && coeffs != NULL; axis++) {
+                if (entry->points[0][axis] != spline[segment + 0].point[axis]
+                 || entry->points[1][axis] != spline[segment + 1].point[axis]
+                 || entry->points[2][axis] != spline[segment + 2].point[axis]
+                 || entry->points[3][axis] != spline[segment + 3].point[axis]) {
+                    coeffs = NULL; // Spline was rewritten in place; rebuild.
+                }
+            }
+            break;
+        }
+    }
+
+    if (coeffs == NULL) {
+        coeffs = &sSplineCoeffCache[sSplineCoeffNext];
+        sSplineCoeffNext ^= 1;
+        coeffs->spline = spline;
+        coeffs->segment = segment;
+        for (i = 0; i < 3; i++) {
+            f32 p0 = spline[segment + 0].point[i];
+            f32 p1 = spline[segment + 1].point[i];
+            f32 p2 = spline[segment + 2].point[i];
+            f32 p3 = spline[segment + 3].point[i];
+            coeffs->points[0][i] = spline[segment + 0].point[i];
+            coeffs->points[1][i] = spline[segment + 1].point[i];
+            coeffs->points[2][i] = spline[segment + 2].point[i];
+            coeffs->points[3][i] = spline[segment + 3].point[i];
+            // The uniform cubic B-spline basis of evaluate_cubic_spline, expanded in u.
+            coeffs->a[i] = (p0 + (4.0f * p1) + p2) * (1.0f / 6.0f);
+            coeffs->b[i] = (p2 - p0) * 0.5f;
+            coeffs->c[i] = (p0 - (2.0f * p1) + p2) * 0.5f;
+            coeffs->d[i] = (((p1 - p2) * 3.0f) + (p3 - p0)) * (1.0f / 6.0f);
+        }
+    }
+
+    if (u > 1.0f) u = 1.0f;
+    for (i = 0; i < 3; i++) {
+        Q[i] = ((((coeffs->d[i] * u) + coeffs->c[i]) * u) + coeffs->b[i]) * u + coeffs->a[i];
+    }
+}
+#endif // SPLINE_COEFF_CACHE
+
 /**
  * Computes the point that is `progress` percent of the way through segment `splineSegment` of `spline`,
  * and stores the result in `p`. `progress` and `splineSegment` are updated if `progress` becomes >= 1.0.
@@ -3493,8 +3599,10 @@ void evaluate_cubic_spline(f32 u, Vec3f Q, Vec3f spline1, Vec3f spline2, Vec3f s
  */
 s32 move_point_along_spline(Vec3f p, struct CutsceneSplinePoint spline[], s16 *splineSegment, f32 *progress) {
     s32 finished = FALSE;
+#ifndef SPLINE_COEFF_CACHE
     Vec3f controlPoints[4];
     s32 i = 0;
+#endif
     f32 u = *progress;
     f32 progressChange;
     f32 firstSpeed = 0;
@@ -3509,12 +3617,16 @@ s32 move_point_along_spline(Vec3f p, struct CutsceneSplinePoint spline[], s16 *s
         return 1;
     }
 
+#ifdef SPLINE_COEFF_CACHE
+    evaluate_cached_spline_segment(u, p, spline, segment);
+#else
     for (i = 0; i < 4; i++) {
         controlPoints[i][0] = spline[segment + i].point[0];
         controlPoints[i][1] = spline[segment + i].point[1];
         controlPoints[i][2] = spline[segment + i].point[2];
     }
     evaluate_cubic_spline(u, p, controlPoints[0], controlPoints[1], controlPoints[2], controlPoints[3]);
+#endif
 
     if (spline[*splineSegment + 1].speed != 0) {
         firstSpeed = 1.0f / spline[*splineSegment + 1].speed;
@@ -3535,6 +3647,108 @@ s32 move_point_along_spline(Vec3f p, struct CutsceneSplinePoint spline[], s16 *s
     return finished;
 }
 
+#ifdef CUTSCENE_SPLINE_BAKE
+/**
+ * Baked keyframe streams for a cutscene shot that walks a position spline and a focus
+ * spline with the shared segment/progress state. The whole shot is evaluated on its
+ * first frame, so playback is a keyframe lookup per frame and the shot's pacing is
+ * settled up front. Keyframes are the same values live evaluation would produce; they
+ * come from the same code, just run ahead of time.
+ */
+struct BakedSplinePair {
+    struct CutsceneSplinePoint *posSpline;
+    struct CutsceneSplinePoint *focusSpline;
+    u32 checksum;
+    s16 frameCount;
+    s16 cursor;
+    s16 bakeFinished; // The spline's end landed inside the keyframe buffer.
+    s16 liveSegment;  // Resume state for shots that outlive the buffer.
+    f32 liveProgress;
+    Vec3f pos[CUTSCENE_SPLINE_BAKE_FRAMES];
+    Vec3f focus[CUTSCENE_SPLINE_BAKE_FRAMES];
+};
+
+static struct BakedSplinePair sBakedSplinePair;
+
+/**
+ * Rolling checksum over a spline's control points. The credits rewrite their spline
+ * arrays in place between scenes, so pointer identity alone can't validate a bake.
+ */
+static u32 cutscene_spline_checksum(struct CutsceneSplinePoint spline[]) {
+    u32 sum = 0;
+    s32 i;
+
+    for (i = 0; i < 32 && spline[i].index != -1; i++) {
+        sum = (sum << 1) + (u16) spline[i].point[0];
+        sum = (sum << 1) + (u16) spline[i].point[1];
+        sum = (sum << 1) + (u16) spline[i].point[2];
+        sum = (sum << 1) + spline[i].speed;
+    }
+    return sum;
+}
+
+/**
+ * Throw away the current bake. Called whenever the shared spline progress is reset,
+ * since a replayed shot must restart from its first keyframe.
+ */
+static void cutscene_spline_bake_invalidate(void) {
+    sBakedSplinePair.posSpline = NULL;
+}
+#endif // CUTSCENE_SPLINE_BAKE
+
+/**
+ * move_point_along_spline for the shots that follow a position spline and a focus
+ * spline in the same frame, sharing sCutsceneSplineSegment/Progress between the two
+ * calls. With CUTSCENE_SPLINE_BAKE the pair is baked into keyframes on the shot's
+ * first frame and played back by index. Returns whether the focus spline finished,
+ * matching what the two live calls report.
+ */
+s32 move_point_pair_along_spline(Vec3f pos, Vec3f focus, struct CutsceneSplinePoint posSpline[],
+                                 struct CutsceneSplinePoint focusSpline[]) {
+#ifdef CUTSCENE_SPLINE_BAKE
+    struct BakedSplinePair *bake = &sBakedSplinePair;
+    u32 checksum = cutscene_spline_checksum(posSpline) + cutscene_spline_checksum(focusSpline);
+    s32 finished;
+
+    if (bake->posSpline != posSpline || bake->focusSpline != focusSpline
+        || bake->checksum != checksum) {
+        s16 segment = sCutsceneSplineSegment;
+        f32 progress = sCutsceneSplineSegmentProgress;
+
+        bake->posSpline = posSpline;
+        bake->focusSpline = focusSpline;
+        bake->checksum = checksum;
+        bake->cursor = 0;
+        bake->frameCount = 0;
+        bake->bakeFinished = FALSE;
+        while (bake->frameCount < CUTSCENE_SPLINE_BAKE_FRAMES && !bake->bakeFinished) {
+            move_point_along_spline(bake->pos[bake->frameCount], posSpline, &segment, &progress);
+            bake->bakeFinished =
+                move_point_along_spline(bake->focus[bake->frameCount], focusSpline, &segment, &progress);
+            bake->frameCount++;
+        }
+        bake->liveSegment = segment;
+        bake->liveProgress = progress;
+    }
+
+    if (bake->cursor < bake->frameCount) {
+        vec3f_copy(pos, bake->pos[bake->cursor]);
+        vec3f_copy(focus, bake->focus[bake->cursor]);
+        finished = (bake->bakeFinished && bake->cursor == bake->frameCount - 1);
+        bake->cursor++;
+    } else {
+        // The shot outlived the keyframe buffer (or wrapped past its spline's end);
+        // finish it live from where the bake left off.
+        move_point_along_spline(pos, posSpline, &bake->liveSegment, &bake->liveProgress);
+        finished = move_point_along_spline(focus, focusSpline, &bake->liveSegment, &bake->liveProgress);
+    }
+    return finished;
+#else
+    move_point_along_spline(pos, posSpline, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
+    return move_point_along_spline(focus, focusSpline, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
+#endif
+}
+
 /**
  * If `selection` is 0, just get the current selection
  * If `selection` is 1, select 'Mario' as the alt mode.
@@ -3846,33 +4060,15 @@ s32 set_or_approach_f32_asymptotic(f32 *dst, f32 goal, f32 scale) {
 }
 
 /**
- * Applies the approach_f32_asymptotic_bool function to each of the X, Y, & Z components of the given
- * vector.
- */
-void approach_vec3f_asymptotic(Vec3f current, Vec3f target, f32 xMul, f32 yMul, f32 zMul) {
-    approach_f32_asymptotic_bool(&current[0], target[0], xMul);
-    approach_f32_asymptotic_bool(&current[1], target[1], yMul);
-    approach_f32_asymptotic_bool(&current[2], target[2], zMul);
-}
-
-/**
- * Applies the set_or_approach_f32_asymptotic_bool function to each of the X, Y, & Z components of the
- * given vector.
+ * Applies the set_or_approach_f32_asymptotic behavior to each of the X, Y, & Z components of the
+ * given vector. The smooth movement flag is checked once for the whole vector.
  */
 void set_or_approach_vec3f_asymptotic(Vec3f dst, Vec3f goal, f32 xMul, f32 yMul, f32 zMul) {
-    set_or_approach_f32_asymptotic(&dst[0], goal[0], xMul);
-    set_or_approach_f32_asymptotic(&dst[1], goal[1], yMul);
-    set_or_approach_f32_asymptotic(&dst[2], goal[2], zMul);
-}
-
-/**
- * Applies the approach_s32_asymptotic function to each of the X, Y, & Z components of the given
- * vector.
- */
-void approach_vec3s_asymptotic(Vec3s current, Vec3s target, s16 xMul, s16 yMul, s16 zMul) {
-    approach_s16_asymptotic_bool(&current[0], target[0], xMul);
-    approach_s16_asymptotic_bool(&current[1], target[1], yMul);
-    approach_s16_asymptotic_bool(&current[2], target[2], zMul);
+    if (sStatusFlags & CAM_FLAG_SMOOTH_MOVEMENT) {
+        approach_vec3f_asymptotic(dst, goal, xMul, yMul, zMul);
+    } else {
+        vec3f_copy(dst, goal);
+    }
 }
 
 s32 camera_approach_s16_symmetric_bool(s16 *current, s16 target, s16 increment) {
@@ -6178,6 +6374,132 @@ struct CutsceneSplinePoint sEndingLookAtSkyFocus[] = {
     { -1, 0, { 636, 2027, -415 } }
 };
 
+#ifdef CAMERA_TRIGGER_GRID
+#define TRIGGER_GRID_CELLS        16
+#define TRIGGER_GRID_CELL_SIZE    ((LEVEL_BOUNDARY_MAX * 2) / TRIGGER_GRID_CELLS)
+#define TRIGGER_GRID_MAX_TRIGGERS 32
+#define TRIGGER_GRID_MAX_DEFAULTS 8
+
+/**
+ * The current area's camera triggers, baked into a coarse XZ grid so the
+ * per-frame lookup is one cell read. Each cell holds a bitmask over
+ * sActiveTriggers; default (area == -1) triggers are position-independent and
+ * kept in their own list. Rebuilt whenever the level or area changes, which
+ * also drops anything added with camera_register_trigger.
+ */
+static struct CameraTrigger *sActiveTriggers[TRIGGER_GRID_MAX_TRIGGERS];
+static struct CameraTrigger *sDefaultTriggers[TRIGGER_GRID_MAX_DEFAULTS];
+static u32 sTriggerGrid[TRIGGER_GRID_CELLS][TRIGGER_GRID_CELLS];
+static s32 sActiveTriggerCount = 0;
+static s32 sDefaultTriggerCount = 0;
+static s16 sTriggerGridLevel = -1;
+static s8 sTriggerGridArea = -1;
+// When an area has more triggers than the bitmask can index, the whole area
+// falls back to the linear table scan rather than dropping triggers.
+static s8 sTriggerGridOverflow = FALSE;
+
+static s32 trigger_grid_cell(f32 coord) {
+    s32 cell = (s32)(coord + LEVEL_BOUNDARY_MAX) / TRIGGER_GRID_CELL_SIZE;
+    return CLAMP(cell, 0, TRIGGER_GRID_CELLS - 1);
+}
+
+/**
+ * Sets `index`'s bit in every cell the trigger's bounds can reach. A yawed box
+ * is covered conservatively by its largest possible extent; exact containment
+ * is still decided by is_pos_in_bounds at lookup time.
+ */
+static void camera_trigger_rasterize(s32 index) {
+    struct CameraTrigger *trigger = sActiveTriggers[index];
+    f32 radiusX = trigger->boundsX;
+    f32 radiusZ = trigger->boundsZ;
+    s32 cellX, cellZ;
+
+    if (trigger->boundsYaw != 0) {
+        radiusX = radiusZ = (f32) trigger->boundsX + (f32) trigger->boundsZ;
+    }
+    s32 minX = trigger_grid_cell(trigger->centerX - radiusX);
+    s32 maxX = trigger_grid_cell(trigger->centerX + radiusX);
+    s32 minZ = trigger_grid_cell(trigger->centerZ - radiusZ);
+    s32 maxZ = trigger_grid_cell(trigger->centerZ + radiusZ);
+
+    for (cellZ = minZ; cellZ <= maxZ; cellZ++) {
+        for (cellX = minX; cellX <= maxX; cellX++) {
+            sTriggerGrid[cellZ][cellX] |= (1 << index);
+        }
+    }
+}
+
+static void camera_add_active_trigger(struct CameraTrigger *trigger) {
+    if (trigger->area == -1) {
+        if (sDefaultTriggerCount >= TRIGGER_GRID_MAX_DEFAULTS) {
+            sTriggerGridOverflow = TRUE;
+            return;
+        }
+        sDefaultTriggers[sDefaultTriggerCount++] = trigger;
+    } else {
+        if (sActiveTriggerCount >= TRIGGER_GRID_MAX_TRIGGERS) {
+            sTriggerGridOverflow = TRUE;
+            return;
+        }
+        sActiveTriggers[sActiveTriggerCount] = trigger;
+        camera_trigger_rasterize(sActiveTriggerCount);
+        sActiveTriggerCount++;
+    }
+}
+
+static void camera_build_trigger_grid(s16 level, s8 area) {
+    u32 b = 0;
+
+    bzero(sTriggerGrid, sizeof(sTriggerGrid));
+    sActiveTriggerCount = 0;
+    sDefaultTriggerCount = 0;
+    sTriggerGridOverflow = FALSE;
+    sTriggerGridLevel = level;
+    sTriggerGridArea = area;
+
+    if (sCameraTriggers[level] == NULL) {
+        return;
+    }
+    while (sCameraTriggers[level][b].event != NULL) {
+        if (sCameraTriggers[level][b].area == area || sCameraTriggers[level][b].area == -1) {
+            camera_add_active_trigger(&sCameraTriggers[level][b]);
+        }
+        b++;
+    }
+}
+
+/**
+ * Registers a camera trigger for the current area without growing the static
+ * tables. Intended to be called from level scripts or area init code after the
+ * area has loaded; registrations are dropped when the level or area changes.
+ * The trigger must stay valid while registered (point it at static data).
+ * Returns TRUE if the trigger was accepted.
+ */
+s32 camera_register_trigger(struct CameraTrigger *trigger) {
+    if (gCurrentArea == NULL) {
+        return FALSE;
+    }
+    s16 level = gCurrLevelNum;
+    if (level > LEVEL_COUNT + 1) {
+        level = LEVEL_COUNT + 1;
+    }
+    if (sTriggerGridLevel != level || sTriggerGridArea != gCurrentArea->index) {
+        camera_build_trigger_grid(level, gCurrentArea->index);
+    }
+    if (sTriggerGridOverflow) {
+        return FALSE;
+    }
+    camera_add_active_trigger(trigger);
+    if (sTriggerGridOverflow) {
+        // The dynamic trigger didn't fit. The linear fallback scan wouldn't
+        // know about it either, so reject it rather than degrade the area.
+        sTriggerGridOverflow = FALSE;
+        return FALSE;
+    }
+    return TRUE;
+}
+#endif
+
 /**
  * Activates any CameraTriggers that Mario is inside.
  * Then, applies area-specific processing to the camera, such as setting the default mode, or changing
@@ -6203,6 +6525,40 @@ s16 camera_course_processing(struct Camera *c) {
         level = LEVEL_COUNT + 1;
     }
 
+#ifdef CAMERA_TRIGGER_GRID
+    if (sTriggerGridLevel != level || sTriggerGridArea != area) {
+        camera_build_trigger_grid(level, area);
+    }
+    if (!sTriggerGridOverflow) {
+        if (sActiveTriggerCount != 0) {
+            struct CameraTrigger *trigger;
+            u32 mask = sTriggerGrid[trigger_grid_cell(sMarioCamState->pos[2])]
+                                   [trigger_grid_cell(sMarioCamState->pos[0])];
+
+            // Process positional triggers whose cells Mario's cell touches.
+            // All triggered events are called, not just the first one.
+            for (b = 0; mask != 0; b++, mask >>= 1) {
+                if (!(mask & 1)) {
+                    continue;
+                }
+                trigger = sActiveTriggers[b];
+                vec3f_set(center, trigger->centerX, trigger->centerY, trigger->centerZ);
+                vec3f_set(bounds, trigger->boundsX, trigger->boundsY, trigger->boundsZ);
+                if (is_pos_in_bounds(sMarioCamState->pos, center, bounds, trigger->boundsYaw)
+                    && !(sStatusFlags & CAM_FLAG_BLOCK_AREA_PROCESSING)) {
+                    trigger->event(c);
+                    insideBounds = TRUE;
+                }
+            }
+        }
+        // Default triggers are only active if Mario is not inside another trigger
+        if (!insideBounds && !(sStatusFlags & CAM_FLAG_BLOCK_AREA_PROCESSING)) {
+            for (b = 0; b < (u32) sDefaultTriggerCount; b++) {
+                sDefaultTriggers[b]->event(c);
+            }
+        }
+    } else
+#endif
     if (sCameraTriggers[level] != NULL) {
         b = 0;
 
@@ -6411,6 +6767,45 @@ void resolve_geometry_collisions(Vec3f pos) {
  *
  * @return 3 if a wall is covering Mario, 1 if a wall is only near the camera.
  */
+#ifdef CAMERA_PROBE_BUDGET
+/**
+ * Last completed wall-avoidance scan, kept per call site (the lakitu update and
+ * the 8-directional mode pass use different yaw ranges) so each can reuse its
+ * own result while the camera and Mario sit still.
+ */
+struct CameraProbeResult {
+    u32 frame;      // gGlobalTimer when the scan completed, 0 if never
+    Vec3f camPos;   // camera position the scan ran from
+    Vec3f marioPos; // Mario's position at scan time
+    s16 avoidYaw;
+    s16 status;
+    s16 nearWall;   // whether the scan raised CAM_FLAG_CAM_NEAR_WALL
+};
+
+static struct CameraProbeResult sWallScanCache[2];
+static u32 sCameraProbeFrame = 0;
+static s32 sCameraProbeCount = 0;
+
+/**
+ * Charge `cost` probes against this frame's raycast budget. Returns FALSE once
+ * the budget is spent, which truncates the current scan.
+ */
+static s32 camera_probe_charge(s32 cost) {
+    if (sCameraProbeFrame != gGlobalTimer) {
+        sCameraProbeFrame = gGlobalTimer;
+        sCameraProbeCount = 0;
+    }
+    sCameraProbeCount += cost;
+    return sCameraProbeCount <= CAMERA_PROBE_BUDGET;
+}
+
+static s32 camera_probe_pos_still(Vec3f cached, Vec3f now) {
+    return (absf(now[0] - cached[0]) < CAMERA_PROBE_REUSE_DIST)
+        && (absf(now[1] - cached[1]) < CAMERA_PROBE_REUSE_DIST)
+        && (absf(now[2] - cached[2]) < CAMERA_PROBE_REUSE_DIST);
+}
+#endif
+
 s32 rotate_camera_around_walls(UNUSED struct Camera *c, Vec3f cPos, s16 *avoidYaw, s16 yawRange) {
     struct WallCollisionData colData;
     struct Surface *wall;
@@ -6425,6 +6820,35 @@ s32 rotate_camera_around_walls(UNUSED struct Camera *c, Vec3f cPos, s16 *avoidYa
     /// The current iteration. The algorithm takes 8 equal steps from Mario back to the camera.
     s32 step = 0;
 
+#ifdef CAMERA_PROBE_BUDGET
+    struct CameraProbeResult *cache = &sWallScanCache[yawRange > 0x400];
+    s32 stepInc = 1;
+    s32 scanComplete = TRUE;
+
+    // Neither endpoint has moved since the last scan: serve its result instead
+    // of probing again. Capped at CAMERA_PROBE_REUSE_FRAMES so surfaces moving
+    // around a stationary camera are still picked up.
+    if (cache->frame != 0 && (gGlobalTimer - cache->frame) < CAMERA_PROBE_REUSE_FRAMES
+        && camera_probe_pos_still(cache->camPos, cPos)
+        && camera_probe_pos_still(cache->marioPos, sMarioCamState->pos)) {
+        if (cache->nearWall) {
+            sStatusFlags |= CAM_FLAG_CAM_NEAR_WALL;
+        } else {
+            sStatusFlags &= ~CAM_FLAG_CAM_NEAR_WALL;
+        }
+        *avoidYaw = cache->avoidYaw;
+        return cache->status;
+    }
+
+    // The previous scan was clean, so these feelers are non-critical: march
+    // every other step, alternating parity each frame so the full ray is still
+    // covered every two frames.
+    if (cache->frame != 0 && cache->status == 0 && !cache->nearWall) {
+        stepInc = 2;
+        step = gGlobalTimer & 1;
+    }
+#endif
+
     vec3f_get_dist_and_angle(sMarioCamState->pos, cPos, &dummyDist, &dummyPitch, &yawFromMario);
     sStatusFlags &= ~CAM_FLAG_CAM_NEAR_WALL;
     colData.offsetY = 100.0f;
@@ -6436,7 +6860,21 @@ s32 rotate_camera_around_walls(UNUSED struct Camera *c, Vec3f cPos, s16 *avoidYa
     /// This only increases when there is a wall collision found in the coarse pass
     fineRadius = 100.0f;
 
+#ifdef CAMERA_PROBE_BUDGET
+    for (; step < 8; step += stepInc) {
+        if (!camera_probe_charge(1)) {
+            scanComplete = FALSE;
+            break;
+        }
+        checkDist = step * 0.125f;
+        // The radius the step-by-step growth below would have reached by this step
+        coarseRadius = 150.f + (30.f * step);
+        if (coarseRadius > 250.f) {
+            coarseRadius = 250.f;
+        }
+#else
     for (step = 0; step < 8; step++) {
+#endif
         // Start at Mario, move backwards to Lakitu's position
         colData.x = sMarioCamState->pos[0] + ((cPos[0] - sMarioCamState->pos[0]) * checkDist);
         colData.y = sMarioCamState->pos[1] + ((cPos[1] - sMarioCamState->pos[1]) * checkDist);
@@ -6470,6 +6908,11 @@ s32 rotate_camera_around_walls(UNUSED struct Camera *c, Vec3f cPos, s16 *avoidYa
             // Increase the fine check radius
             camera_approach_f32_symmetric_bool(&fineRadius, 200.f, 20.f);
 
+#ifdef CAMERA_PROBE_BUDGET
+            // The fine probe is never skipped mid-step (that would drop a hit
+            // the coarse pass already paid for), but it does count.
+            camera_probe_charge(1);
+#endif
             if (find_wall_collisions(&colData) != 0) {
                 wall = colData.walls[colData.numWalls - 1];
                 horWallNorm = atan2s(wall->normal.z, wall->normal.x);
@@ -6491,6 +6934,20 @@ s32 rotate_camera_around_walls(UNUSED struct Camera *c, Vec3f cPos, s16 *avoidYa
         checkDist += 0.125f;
     }
 
+#ifdef CAMERA_PROBE_BUDGET
+    // Only completed scans become reusable; a budget-truncated scan may have
+    // missed a wall and must not be served to later frames.
+    if (scanComplete) {
+        cache->frame = gGlobalTimer;
+        vec3f_copy(cache->camPos, cPos);
+        vec3f_copy(cache->marioPos, sMarioCamState->pos);
+        // avoidYaw is only written on a hit; don't read it back otherwise.
+        cache->avoidYaw = (status != 0) ? *avoidYaw : 0;
+        cache->status = status;
+        cache->nearWall = (sStatusFlags & CAM_FLAG_CAM_NEAR_WALL) != 0;
+    }
+#endif
+
     return status;
 }
 
@@ -6615,6 +7072,9 @@ void update_camera_yaw(struct Camera *c) {
 void cutscene_reset_spline(void) {
     sCutsceneSplineSegment = 0;
     sCutsceneSplineSegmentProgress = 0;
+#ifdef CUTSCENE_SPLINE_BAKE
+    cutscene_spline_bake_invalidate();
+#endif
 }
 
 void stop_cutscene_and_retrieve_stored_info(struct Camera *c) {
@@ -6919,8 +7379,7 @@ void cutscene_ending_reset_spline(UNUSED struct Camera *c) {
  * Follow sEndingFlyToWindowPos/Focus up to the window.
  */
 void cutscene_ending_fly_up_to_window(struct Camera *c) {
-    move_point_along_spline(c->pos, sEndingFlyToWindowPos, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
-    move_point_along_spline(c->focus, sEndingFlyToWindowFocus, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
+    move_point_pair_along_spline(c->pos, c->focus, sEndingFlyToWindowPos, sEndingFlyToWindowFocus);
 }
 
 /**
@@ -7015,8 +7474,7 @@ void cutscene_ending_peach_descends(struct Camera *c) {
  */
 void cutscene_ending_mario_to_peach(struct Camera *c) {
     cutscene_event(cutscene_ending_reset_spline, c, 0, 0);
-    move_point_along_spline(c->pos, sEndingMarioToPeachPos, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
-    move_point_along_spline(c->focus, sEndingMarioToPeachFocus, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
+    move_point_pair_along_spline(c->pos, c->focus, sEndingMarioToPeachPos, sEndingMarioToPeachFocus);
     player2_rotate_cam(c, -0x2000, 0x2000, -0x2000, 0x2000);
 }
 
@@ -8967,9 +9425,10 @@ void cutscene_cap_switch_press_approach_mario(struct Camera *c) {
     approach_s16_asymptotic_bool(&pitch, 0, 0x10);
     vec3f_set_dist_and_angle(sMarioCamState->pos, c->pos, dist, pitch, yaw);
 
-    approach_f32_asymptotic_bool(&c->focus[0], sMarioCamState->pos[0], 0.1f);
-    approach_f32_asymptotic_bool(&c->focus[1], sMarioCamState->pos[1] + 110.f, 0.1f);
-    approach_f32_asymptotic_bool(&c->focus[2], sMarioCamState->pos[2], 0.1f);
+    Vec3f focusGoal;
+    vec3f_copy(focusGoal, sMarioCamState->pos);
+    focusGoal[1] += 110.f;
+    approach_vec3f_asymptotic(c->focus, focusGoal, 0.1f, 0.1f, 0.1f);
 }
 
 /**
@@ -9097,16 +9556,14 @@ void cutscene_unlock_key_door(UNUSED struct Camera *c) {
 s32 intro_peach_move_camera_start_to_pipe(struct Camera *c, struct CutsceneSplinePoint positionSpline[],
                   struct CutsceneSplinePoint focusSpline[]) {
     Vec3f offset;
-    s32 posReturn = 0;
-    s32 focusReturn = 0;
+    s32 focusReturn;
 
     /**
      * The position spline's speed parameters are all 0, so sCutsceneSplineSegmentProgress doesn't get
      * updated. Otherwise position would move two frames ahead, and c->focus would always be one frame
      * further along the spline than c->pos.
      */
-    posReturn = move_point_along_spline(c->pos, positionSpline, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
-    focusReturn = move_point_along_spline(c->focus, focusSpline, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
+    focusReturn = move_point_pair_along_spline(c->pos, c->focus, positionSpline, focusSpline);
 
     // The two splines used by this function are reflected in the horizontal plane for some reason,
     // so they are rotated every frame. Why do this, Nintendo?
@@ -9117,7 +9574,6 @@ s32 intro_peach_move_camera_start_to_pipe(struct Camera *c, struct CutsceneSplin
     vec3f_add(c->focus, offset);
     vec3f_add(c->pos, offset);
 
-    posReturn += focusReturn; // Unused
     return focusReturn;
 }
 
@@ -9159,8 +9615,7 @@ void cutscene_intro_peach_dialog(struct Camera *c) {
 }
 
 void cutscene_intro_peach_follow_pipe_spline(struct Camera *c) {
-    move_point_along_spline(c->pos, sIntroPipeToDialogPosition, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
-    move_point_along_spline(c->focus, sIntroPipeToDialogFocus, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
+    move_point_pair_along_spline(c->pos, c->focus, sIntroPipeToDialogPosition, sIntroPipeToDialogFocus);
 }
 
 void cutscene_intro_peach_clear_cutscene_status(UNUSED struct Camera *c) {
@@ -9181,6 +9636,9 @@ void cutscene_intro_peach_zoom_fov(UNUSED struct Camera *c) {
 void cutscene_intro_peach_reset_spline(UNUSED struct Camera *c) {
     sCutsceneSplineSegment = 0;
     sCutsceneSplineSegmentProgress = 0.1f;
+#ifdef CUTSCENE_SPLINE_BAKE
+    cutscene_spline_bake_invalidate();
+#endif
     //! @bug since this event is only called for one frame, this handheld shake is turned off on the
     //! next frame.
     set_handheld_shake(HAND_CAM_SHAKE_HIGH);
@@ -9316,8 +9774,7 @@ struct CutsceneSplinePoint gEndWavingFocus[] = {
 
 void cutscene_end_waving(struct Camera *c) {
     cutscene_event(cutscene_end_waving_start, c, 0, 0);
-    move_point_along_spline(c->pos, gEndWavingPos, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
-    move_point_along_spline(c->focus, gEndWavingFocus, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
+    move_point_pair_along_spline(c->pos, c->focus, gEndWavingPos, gEndWavingFocus);
     cutscene_spawn_obj(CUTSCENE_OBJ_BEGINNING_LAKITU, 120);
 }
 
@@ -9473,8 +9930,7 @@ void cutscene_credits(struct Camera *c) {
 
     copy_spline_segment(sCurCreditsSplinePos, pos);
     copy_spline_segment(sCurCreditsSplineFocus, focus);
-    move_point_along_spline(c->pos, sCurCreditsSplinePos, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
-    move_point_along_spline(c->focus, sCurCreditsSplineFocus, &sCutsceneSplineSegment, &sCutsceneSplineSegmentProgress);
+    move_point_pair_along_spline(c->pos, c->focus, sCurCreditsSplinePos, sCurCreditsSplineFocus);
     player2_rotate_cam(c, -0x2000, 0x2000, -0x4000, 0x4000);
 }
 
@@ -284,6 +284,21 @@ void draw_stacktrace(OSThread *thread, UNUSED s32 cause) {
 
 extern char *insn_disasm(u32 insn, u32 isPC);
 static u32 sProgramPosition = 0;
+
+#ifdef CRASH_SCREEN_DISASM_LUT
+#define DISASM_NUM_LINES 19
+
+static char sDisasmCache[DISASM_NUM_LINES][100];
+static u32 sDisasmCacheBase = 0;
+static u8 sDisasmCacheValid = FALSE;
+
+static void disasm_cache_line(s32 line, u32 pc) {
+    u32 addr = (sProgramPosition + (line * 4));
+
+    strcpy(sDisasmCache[line], insn_disasm(*(u32*)(addr), (addr == pc)));
+}
+#endif
+
 void draw_disasm(OSThread *thread) {
     __OSThreadContext *tc = &thread->context;
     // u32 insn = *(u32*)tc->pc;
@@ -295,13 +310,38 @@ void draw_disasm(OSThread *thread) {
     crash_screen_print(30, 25, "DISASM %08X", sProgramPosition);
     osWritebackDCacheAll();
 
+#ifdef CRASH_SCREEN_DISASM_LUT
+    // Scrolling moves the page by one line, so recycle the other 18 cached
+    // strings and only disassemble what came into view.
+    if (sDisasmCacheValid && sProgramPosition == (sDisasmCacheBase + 4)) {
+        for (int i = 0; i < (DISASM_NUM_LINES - 1); i++) {
+            memcpy(sDisasmCache[i], sDisasmCache[i + 1], sizeof(sDisasmCache[0]));
+        }
+        disasm_cache_line(DISASM_NUM_LINES - 1, tc->pc);
+    } else if (sDisasmCacheValid && sProgramPosition == (sDisasmCacheBase - 4)) {
+        for (int i = (DISASM_NUM_LINES - 1); i > 0; i--) {
+            memcpy(sDisasmCache[i], sDisasmCache[i - 1], sizeof(sDisasmCache[0]));
+        }
+        disasm_cache_line(0, tc->pc);
+    } else if (!sDisasmCacheValid || sProgramPosition != sDisasmCacheBase) {
+        for (int i = 0; i < DISASM_NUM_LINES; i++) {
+            disasm_cache_line(i, tc->pc);
+        }
+    }
+    sDisasmCacheBase = sProgramPosition;
+    sDisasmCacheValid = TRUE;
 
+    for (int i = 0; i < DISASM_NUM_LINES; i++) {
+        crash_screen_print(30, (35 + (i * 10)), "%s", sDisasmCache[i]);
+    }
+#else
     for (int i = 0; i < 19; i++) {
         u32 addr = (sProgramPosition + (i * 4));
         u32 toDisasm = *(u32*)(addr);
 
         crash_screen_print(30, (35 + (i * 10)), "%s", insn_disasm(toDisasm, (addr == tc->pc)));
     }
+#endif
 
     osWritebackDCacheAll();
 }
@@ -359,6 +399,13 @@ void draw_crash_screen(OSThread *thread) {
     if (updateBuffer) {
         crash_screen_draw_rect(25, 8, 270, 12);
         crash_screen_print(30, 10, "Page:%02d                L/Z: Left   R: Right", crashPage);
+        // Put the framebuffer on screen before drawing the page body. The VI
+        // rescans it every retrace, so the header is visible immediately and
+        // the sections below appear progressively as they are drawn instead
+        // of only once the whole page is finished.
+        osWritebackDCacheAll();
+        osViBlack(FALSE);
+        osViSwapBuffer(gCrashScreen.framebuffer);
         switch (crashPage) {
             case PAGE_CONTEXT:    draw_crash_context(thread, cause); break;
 #if PUPPYPRINT_DEBUG
@@ -370,8 +417,6 @@ void draw_crash_screen(OSThread *thread) {
         }
 
         osWritebackDCacheAll();
-        osViBlack(FALSE);
-        osViSwapBuffer(gCrashScreen.framebuffer);
         updateBuffer = FALSE;
     }
 }
@@ -148,6 +148,7 @@ u32 sCurBoxColor = ((DBG_BOX_ALPHA << 24) | DBG_BOX_DEF_COLOR);
 /**
  * Sets up the RCP for drawing the boxes
  */
+#ifndef DEBUG_BOX_BATCHING
 static const Gfx dl_debug_box_begin[] = {
     gsDPPipeSync(),
     gsDPSetRenderMode(G_RM_ZB_XLU_SURF, G_RM_NOOP2),
@@ -157,6 +158,7 @@ static const Gfx dl_debug_box_begin[] = {
     gsDPSetCombineLERP(0, 0, 0, ENVIRONMENT, 0, 0, 0, ENVIRONMENT, 0, 0, 0, ENVIRONMENT, 0, 0, 0, ENVIRONMENT),
     gsSPEndDisplayList(),
 };
+#endif
 
 static const Gfx dl_visual_surface[] = {
     gsDPPipeSync(),
@@ -167,6 +169,35 @@ static const Gfx dl_visual_surface[] = {
     gsSPEndDisplayList(),
 };
 
+#ifdef DEBUG_BOX_BATCHING
+/**
+ * Shared state for the batched path: one render mode and combiner for every
+ * shape, with the color coming from the pre-transformed vertices instead of
+ * a per-box environment color.
+ */
+static const Gfx dl_debug_box_batch_begin[] = {
+    gsDPPipeSync(),
+    gsDPSetRenderMode(G_RM_ZB_XLU_SURF, G_RM_NOOP2),
+    gsSPClearGeometryMode(G_CULL_BACK | G_LIGHTING),
+    gsSPSetGeometryMode(G_ZBUFFER),
+    gsSPTexture(0, 0, 0, G_TX_RENDERTILE, G_OFF),
+    gsDPSetCombineMode(G_CC_SHADE, G_CC_SHADE),
+    gsSPEndDisplayList(),
+};
+
+// dl_debug_box_verts with the box corners rebased to 0 and no vertex load;
+// the batched path loads each shape's arena verts itself.
+static const Gfx dl_debug_box_batch_tris[] = {
+    gsSP2Triangles(0, 1, 2, 0x0, 3, 1, 0, 0x0),
+    gsSP2Triangles(4, 3, 0, 0x0, 0, 2, 4, 0x0),
+    gsSP2Triangles(4, 2, 5, 0x0, 5, 2, 1, 0x0),
+    gsSP2Triangles(5, 1, 6, 0x0, 3, 6, 1, 0x0),
+    gsSP2Triangles(7, 6, 3, 0x0, 4, 7, 3, 0x0),
+    gsSP2Triangles(4, 5, 7, 0x0, 7, 5, 6, 0x0),
+    gsSPEndDisplayList(),
+};
+#endif
+
 static const Gfx dl_debug_box_end[] = {
     gsDPPipeSync(),
     gsDPSetRenderMode(G_RM_OPA_SURF, G_RM_OPA_SURF2),
@@ -453,6 +484,50 @@ void debug_box_pos_rot(Vec3f pMin, Vec3f pMax, s16 yaw, s32 type) {
     append_debug_box(center, bounds, yaw, type);
 }
 
+#ifdef DEBUG_BOX_BATCHING
+/**
+ * Transforms one shape's template vertices into the shared world-space arena
+ * (scale, yaw and translate folded into the CPU pass, the box color baked
+ * into the vertex colors) and emits one vertex load plus the shape's
+ * triangle list.
+ */
+static void debug_box_emit_shape(struct DebugBox *box, const Vtx *mesh, s32 numVerts,
+                                 const Gfx *tris, Vtx *verts, s32 *vtxCount) {
+    f32 sinYaw = sins(box->yaw);
+    f32 cosYaw = coss(box->yaw);
+    s32 base = *vtxCount;
+    u8 r = ((box->color >> 16) & 0xFF);
+    u8 g = ((box->color >>  8) & 0xFF);
+    u8 b = ((box->color      ) & 0xFF);
+    u8 a = ((box->color >> 24) & 0xFF);
+    s32 i;
+
+    for (i = 0; i < numVerts; i++) {
+        f32 x = (mesh[i].v.ob[0] * ((f32) box->bounds[0] * 0.01f));
+        f32 y = (mesh[i].v.ob[1] * ((f32) box->bounds[1] * 0.01f));
+        f32 z = (mesh[i].v.ob[2] * ((f32) box->bounds[2] * 0.01f));
+
+        make_vertex(verts, (base + i), (box->center[0] + ((x * cosYaw) + (z * sinYaw))),
+                                       (box->center[1] + y),
+                                       (box->center[2] + ((z * cosYaw) - (x * sinYaw))),
+                    0, 0, r, g, b, a);
+    }
+
+    gSPVertex(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(verts + base), numVerts, 0);
+    gSPDisplayList(gDisplayListHead++, tris);
+    *vtxCount += numVerts;
+}
+
+/**
+ * Whether a queued box matches the ucode pass being rendered.
+ */
+static s32 debug_box_matches_pass(struct DebugBox *box, s32 type) {
+    return ((type & DEBUG_UCODE_DEFAULT) && (box->type & DEBUG_UCODE_DEFAULT))
+        || ((type & DEBUG_UCODE_REJ    ) && (box->type & DEBUG_UCODE_REJ    ));
+}
+#endif
+
+#ifndef DEBUG_BOX_BATCHING
 static void render_box(int index) {
     struct DebugBox *box = &sBoxes[index];
     s32 color = box->color;
@@ -494,6 +569,7 @@ static void render_box(int index) {
 
     gSPPopMatrix(gDisplayListHead++, G_MTX_MODELVIEW);
 }
+#endif // !DEBUG_BOX_BATCHING
 
 void render_debug_boxes(s32 type) {
     s32 i;
@@ -503,6 +579,46 @@ void render_debug_boxes(s32 type) {
     if (sNumBoxes == 0) return;
     if (gAreaUpdateCounter < 3) return;
 
+#ifdef DEBUG_BOX_BATCHING
+    s32 numVerts = 0;
+
+    for (i = 0; i < sNumBoxes; ++i) {
+        if (debug_box_matches_pass(&sBoxes[i], type)) {
+            if (sBoxes[i].type & DEBUG_SHAPE_BOX     ) numVerts +=  8;
+            if (sBoxes[i].type & DEBUG_SHAPE_CYLINDER) numVerts += 24;
+        }
+    }
+
+    if (numVerts > 0) {
+        Mtx *mtx   = alloc_display_list(sizeof(Mtx));
+        Vtx *verts = alloc_display_list(numVerts * sizeof(Vtx));
+
+        if ((mtx != NULL) && (verts != NULL)) {
+            s32 vtxCount = 0;
+
+            mtxf_to_mtx(mtx, gMatStack[1]);
+            gSPDisplayList(gDisplayListHead++, dl_debug_box_batch_begin);
+            gSPMatrix(gDisplayListHead++, mtx, (G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH));
+
+            for (i = 0; i < sNumBoxes; ++i) {
+                if (!debug_box_matches_pass(&sBoxes[i], type)) continue;
+
+                if (sBoxes[i].type & DEBUG_SHAPE_BOX) {
+                    debug_box_emit_shape(&sBoxes[i], &debug_box_mesh[24], 8,
+                                         dl_debug_box_batch_tris, verts, &vtxCount);
+                }
+                if (sBoxes[i].type & DEBUG_SHAPE_CYLINDER) {
+                    // Skip the template's own vertex load; the indices are already 0-based.
+                    debug_box_emit_shape(&sBoxes[i], debug_box_mesh, 24,
+                                         &dl_debug_cylinder_verts[1], verts, &vtxCount);
+                }
+            }
+
+            gSPPopMatrix(gDisplayListHead++, G_MTX_MODELVIEW);
+            gSPDisplayList(gDisplayListHead++, dl_debug_box_end);
+        }
+    }
+#else
     gSPDisplayList(gDisplayListHead++, dl_debug_box_begin);
 
     for (i = 0; i < sNumBoxes; ++i) {
@@ -510,10 +626,12 @@ void render_debug_boxes(s32 type) {
         if ((type & DEBUG_UCODE_REJ    ) && (sBoxes[i].type & DEBUG_UCODE_REJ    )) render_box(i);
     }
 
+    gSPDisplayList(gDisplayListHead++, dl_debug_box_end);
+#endif
+
     if (type & DEBUG_BOX_CLEAR) {
         sNumBoxes = 0;
     }
-    gSPDisplayList(gDisplayListHead++, dl_debug_box_end);
 }
 
 #endif
@@ -0,0 +1,195 @@
+#include <ultra64.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "config.h"
+#include "debug_commands.h"
+#include "game_init.h"
+#include "memory.h"
+#include "profiling.h"
+#include "frame_stats.h"
+
+#if defined(USB_DEBUG_COMMANDS) && defined(UNF)
+
+#include "usb/debug.h"
+
+// gGlobalTimer based capture window armed by the "capture" command. The
+// profiler history records between start and end and is paused afterwards,
+// so the host gets a reproducible window untouched by menu navigation.
+#if defined(USE_PROFILER) && defined(PROFILER_HISTORY)
+static u32 sCaptureStart = 0;
+static u32 sCaptureEnd = 0;
+static vs32 sCaptureArmed = FALSE;
+#endif
+
+/**
+ * Reads the next command token into a small buffer as a nul terminated
+ * string. Returns its length, or 0 if there is no token or it doesn't fit.
+ */
+static s32 debug_commands_read_token(char *buf, s32 bufSize) {
+    s32 size = debug_sizecommand();
+
+    if (size == 0 || size > bufSize - 1) {
+        return 0;
+    }
+    debug_parsecommand(buf);
+    buf[size] = '\0';
+    return size;
+}
+
+/**
+ * Parses a decimal token. Returns -1 on a malformed number.
+ */
+static s32 debug_commands_read_number(void) {
+    char buf[12];
+    char *p;
+    s32 value = 0;
+
+    if (debug_commands_read_token(buf, sizeof(buf)) == 0) {
+        return -1;
+    }
+    for (p = buf; *p != '\0'; p++) {
+        if (*p < '0' || *p > '9') {
+            return -1;
+        }
+        value = value * 10 + (*p - '0');
+    }
+    return value;
+}
+
+/**
+ * "profile <start|stop|dump>". Start and stop control the history ring;
+ * dump sends the whole ring as one raw binary write, preceded by a text
+ * line describing its layout so the host can unwrap it.
+ */
+static char *debug_commands_profile(void) {
+#if defined(USE_PROFILER) && defined(PROFILER_HISTORY)
+    char sub[8];
+
+    if (debug_commands_read_token(sub, sizeof(sub)) == 0) {
+        return "Usage: profile <start|stop|dump>";
+    }
+
+    if (strcmp(sub, "start") == 0) {
+        gProfilerHistoryPaused = FALSE;
+    } else if (strcmp(sub, "stop") == 0) {
+        gProfilerHistoryPaused = TRUE;
+    } else if (strcmp(sub, "dump") == 0) {
+        char header[96];
+        sprintf(header, "PROFDUMP,index=%d,frames=%d,channels=%d,u16be\n",
+                gProfilerHistoryIndex, PROFILER_HISTORY_FRAMES, PROFILER_HIST_COUNT);
+        // Already on the USB thread, so writing directly is safe.
+        usb_write(DATATYPE_TEXT, header, strlen(header) + 1);
+        usb_write(DATATYPE_RAWBINARY, gProfilerHistory, sizeof(gProfilerHistory));
+    } else {
+        return "Usage: profile <start|stop|dump>";
+    }
+    return NULL;
+#else
+    return "Build without USE_PROFILER and PROFILER_HISTORY";
+#endif
+}
+
+/**
+ * "capture <start> <frames>". Arms a gGlobalTimer window: the history ring
+ * unpauses when the timer reaches start (or immediately if it already has)
+ * and pauses again after the requested number of frames.
+ */
+static char *debug_commands_capture(void) {
+#if defined(USE_PROFILER) && defined(PROFILER_HISTORY)
+    s32 start = debug_commands_read_number();
+    s32 frames = debug_commands_read_number();
+
+    if (start < 0 || frames <= 0) {
+        return "Usage: capture <startTimer> <frames>";
+    }
+
+    sCaptureStart = start;
+    sCaptureEnd = start + frames;
+    sCaptureArmed = TRUE;
+    return NULL;
+#else
+    return "Build without USE_PROFILER and PROFILER_HISTORY";
+#endif
+}
+
+/**
+ * "stats <on|off>". Toggles streaming the frame stats registry as CSV.
+ */
+static char *debug_commands_stats(void) {
+#ifdef FRAME_STATS_COUNTERS
+    char sub[4];
+
+    if (debug_commands_read_token(sub, sizeof(sub)) == 0) {
+        return "Usage: stats <on|off>";
+    }
+    if (strcmp(sub, "on") == 0) {
+        gFrameStatsStream = TRUE;
+    } else if (strcmp(sub, "off") == 0) {
+        gFrameStatsStream = FALSE;
+    } else {
+        return "Usage: stats <on|off>";
+    }
+    return NULL;
+#else
+    return "Build without FRAME_STATS_COUNTERS";
+#endif
+}
+
+/**
+ * "memdump". Prints the memory accounting tables: main pool free space and,
+ * on PUPPYPRINT_DEBUG builds, current and peak usage per subsystem tag.
+ */
+static char *debug_commands_memdump(void) {
+    debug_printf("MEM,main_pool_free=%d\n", main_pool_available());
+#if PUPPYPRINT_DEBUG
+    {
+        static const char *tagNames[MEM_TAG_COUNT] = {
+            "other", "segments", "surfaces", "anims", "pools",
+        };
+        s32 i;
+
+        for (i = 0; i < MEM_TAG_COUNT; i++) {
+            debug_printf("MEM,tag=%s,used=%d,peak=%d\n",
+                         tagNames[i], gMemTagUsage[i], gMemTagPeak[i]);
+        }
+    }
+#endif
+    return NULL;
+}
+
+/**
+ * Registers the remote commands. Called once UNF itself is up.
+ */
+void debug_commands_init(void) {
+    debug_addcommand("profile", "Profiler history control: profile <start|stop|dump>",
+                     debug_commands_profile);
+    debug_addcommand("capture", "Arm a capture window: capture <startTimer> <frames>",
+                     debug_commands_capture);
+    debug_addcommand("stats", "Frame stats CSV stream: stats <on|off>",
+                     debug_commands_stats);
+    debug_addcommand("memdump", "Dump the memory accounting tables",
+                     debug_commands_memdump);
+}
+
+/**
+ * Per frame upkeep on the game thread: polls the USB for commands and runs
+ * the armed capture window against gGlobalTimer.
+ */
+void debug_commands_update(void) {
+    debug_pollcommands();
+
+#if defined(USE_PROFILER) && defined(PROFILER_HISTORY)
+    if (sCaptureArmed) {
+        if (gGlobalTimer >= sCaptureEnd) {
+            gProfilerHistoryPaused = TRUE;
+            sCaptureArmed = FALSE;
+            debug_printf("CAPTURE,done,start=%d,end=%d\n", sCaptureStart, sCaptureEnd);
+        } else if (gGlobalTimer >= sCaptureStart) {
+            gProfilerHistoryPaused = FALSE;
+        }
+    }
+#endif
+}
+
+#endif // USB_DEBUG_COMMANDS && UNF
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ultra64.h>
+#include "config.h"
+
+#if defined(USB_DEBUG_COMMANDS) && defined(UNF)
+
+/**
+ * Remote perf-investigation commands over the UNFLoader USB channel, so
+ * captures can be driven from the host without touching the controller
+ * driven debug menus (which themselves perturb the frame). See
+ * debug_commands_init() for the command list.
+ */
+void debug_commands_init(void);
+void debug_commands_update(void);
+
+#else
+
+#define debug_commands_init()
+#define debug_commands_update()
+
+#endif // USB_DEBUG_COMMANDS && UNF
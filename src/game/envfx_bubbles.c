@@ -39,8 +39,8 @@ Vtx_t gBubbleTempVtx[3] = {
  * kill flower and bubble particles.
  */
 s32 particle_is_laterally_close(s32 index, s32 x, s32 z, s32 distance) {
-    s32 xPos = (gEnvFxBuffer + index)->xPos;
-    s32 zPos = (gEnvFxBuffer + index)->zPos;
+    s32 xPos = ENVFX_X(index);
+    s32 zPos = ENVFX_Z(index);
 
     if (sqr(xPos - x) + sqr(zPos - z) > sqr(distance)) {
         return FALSE;
@@ -54,7 +54,7 @@ s32 particle_is_laterally_close(s32 index, s32 x, s32 z, s32 distance) {
  * Used to position flower particles
  */
 s32 random_flower_offset(void) {
-    s32 result = random_float() * 2000.0f - 1000.0f;
+    s32 result = random_stream_float(&gEnvFxRandomStream) * 2000.0f - 1000.0f;
     if (result < 0) {
         result -= 1000;
     } else {
@@ -76,17 +76,17 @@ void envfx_update_flower(Vec3s centerPos) {
     s16 centerZ = centerPos[2];
 
     for (i = 0; i < sBubbleParticleMaxCount; i++) {
-        (gEnvFxBuffer + i)->isAlive = particle_is_laterally_close(i, centerX, centerZ, 3000);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->xPos = random_flower_offset() + centerX;
-            (gEnvFxBuffer + i)->zPos = random_flower_offset() + centerZ;
-            (gEnvFxBuffer + i)->yPos = find_floor_height((gEnvFxBuffer + i)->xPos, 10000.0f, (gEnvFxBuffer + i)->zPos);
-            (gEnvFxBuffer + i)->isAlive = TRUE;
-            (gEnvFxBuffer + i)->animFrame = random_float() * 5.0f;
+        ENVFX_IS_ALIVE(i) = particle_is_laterally_close(i, centerX, centerZ, 3000);
+        if (!ENVFX_IS_ALIVE(i)) {
+            ENVFX_X(i) = random_flower_offset() + centerX;
+            ENVFX_Z(i) = random_flower_offset() + centerZ;
+            ENVFX_Y(i) = find_floor_height(ENVFX_X(i), 10000.0f, ENVFX_Z(i));
+            ENVFX_IS_ALIVE(i) = TRUE;
+            ENVFX_ANIM_FRAME(i) = random_stream_float(&gEnvFxRandomStream) * 5.0f;
         } else if (!(globalTimer & 3)) {
-            (gEnvFxBuffer + i)->animFrame++;
-            if ((gEnvFxBuffer + i)->animFrame > 5) {
-                (gEnvFxBuffer + i)->animFrame = 0;
+            ENVFX_ANIM_FRAME(i)++;
+            if (ENVFX_ANIM_FRAME(i) > 5) {
+                ENVFX_ANIM_FRAME(i) = 0;
             }
         }
     }
@@ -109,34 +109,34 @@ void envfx_set_lava_bubble_position(s32 index, Vec3s centerPos) {
     s16 centerY = centerPos[1];
     s16 centerZ = centerPos[2];
 
-    (gEnvFxBuffer + index)->xPos = random_float() * 6000.0f - 3000.0f + centerX;
-    (gEnvFxBuffer + index)->zPos = random_float() * 6000.0f - 3000.0f + centerZ;
+    ENVFX_X(index) = random_stream_float(&gEnvFxRandomStream) * 6000.0f - 3000.0f + centerX;
+    ENVFX_Z(index) = random_stream_float(&gEnvFxRandomStream) * 6000.0f - 3000.0f + centerZ;
 
-    if ((gEnvFxBuffer + index)->xPos > 8000) {
-        (gEnvFxBuffer + index)->xPos = 16000 - (gEnvFxBuffer + index)->xPos;
+    if (ENVFX_X(index) > 8000) {
+        ENVFX_X(index) = 16000 - ENVFX_X(index);
     }
-    if ((gEnvFxBuffer + index)->xPos < -8000) {
-        (gEnvFxBuffer + index)->xPos = -16000 - (gEnvFxBuffer + index)->xPos;
+    if (ENVFX_X(index) < -8000) {
+        ENVFX_X(index) = -16000 - ENVFX_X(index);
     }
 
-    if ((gEnvFxBuffer + index)->zPos > 8000) {
-        (gEnvFxBuffer + index)->zPos = 16000 - (gEnvFxBuffer + index)->zPos;
+    if (ENVFX_Z(index) > 8000) {
+        ENVFX_Z(index) = 16000 - ENVFX_Z(index);
     }
-    if ((gEnvFxBuffer + index)->zPos < -8000) {
-        (gEnvFxBuffer + index)->zPos = -16000 - (gEnvFxBuffer + index)->zPos;
+    if (ENVFX_Z(index) < -8000) {
+        ENVFX_Z(index) = -16000 - ENVFX_Z(index);
     }
 
     floorY =
-        find_floor((gEnvFxBuffer + index)->xPos, centerY + 500, (gEnvFxBuffer + index)->zPos, &surface);
+        find_floor(ENVFX_X(index), centerY + 500, ENVFX_Z(index), &surface);
     if (surface == NULL) {
-        (gEnvFxBuffer + index)->yPos = FLOOR_LOWER_LIMIT_MISC;
+        ENVFX_Y(index) = FLOOR_LOWER_LIMIT_MISC;
         return;
     }
 
     if (surface->type == SURFACE_BURNING) {
-        (gEnvFxBuffer + index)->yPos = floorY;
+        ENVFX_Y(index) = floorY;
     } else {
-        (gEnvFxBuffer + index)->yPos = FLOOR_LOWER_LIMIT_MISC;
+        ENVFX_Y(index) = FLOOR_LOWER_LIMIT_MISC;
     }
 }
 
@@ -149,19 +149,19 @@ void envfx_update_lava(Vec3s centerPos) {
     s32 globalTimer = gGlobalTimer;
 
     for (i = 0; i < sBubbleParticleMaxCount; i++) {
-        if (!(gEnvFxBuffer + i)->isAlive) {
+        if (!ENVFX_IS_ALIVE(i)) {
             envfx_set_lava_bubble_position(i, centerPos);
-            (gEnvFxBuffer + i)->isAlive = TRUE;
+            ENVFX_IS_ALIVE(i) = TRUE;
         } else if (!(globalTimer & 1)) {
-            (gEnvFxBuffer + i)->animFrame += 1;
-            if ((gEnvFxBuffer + i)->animFrame > 8) {
-                (gEnvFxBuffer + i)->isAlive = FALSE;
-                (gEnvFxBuffer + i)->animFrame = 0;
+            ENVFX_ANIM_FRAME(i) += 1;
+            if (ENVFX_ANIM_FRAME(i) > 8) {
+                ENVFX_IS_ALIVE(i) = FALSE;
+                ENVFX_ANIM_FRAME(i) = 0;
             }
         }
     }
 
-    if (((s8)(s32)(random_float() * 16.0f)) == 8) {
+    if (((s8)(s32)(random_stream_float(&gEnvFxRandomStream) * 16.0f)) == 8) {
         play_sound(SOUND_GENERAL_QUIET_BUBBLE2, gGlobalSoundSource);
     }
 }
@@ -193,11 +193,11 @@ void envfx_rotate_around_whirlpool(s32 *x, s32 *y, s32 *z) {
  * low or close to the center.
  */
 s32 envfx_is_whirlpool_bubble_alive(s32 index) {
-    if ((gEnvFxBuffer + index)->bubbleY < gEnvFxBubbleConfig[ENVFX_STATE_DEST_Y] - 100) {
+    if (ENVFX_BUBBLE_Y(index) < gEnvFxBubbleConfig[ENVFX_STATE_DEST_Y] - 100) {
         return FALSE;
     }
 
-    if ((gEnvFxBuffer + index)->angleAndDist[1] < 10) {
+    if (ENVFX_DIST(index) < 10) {
         return FALSE;
     }
 
@@ -212,39 +212,36 @@ void envfx_update_whirlpool(void) {
     s32 i;
 
     for (i = 0; i < sBubbleParticleMaxCount; i++) {
-        (gEnvFxBuffer + i)->isAlive = envfx_is_whirlpool_bubble_alive(i);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->angleAndDist[1] = random_float() * 1000.0f;
-            (gEnvFxBuffer + i)->angleAndDist[0] = random_float() * 65536.0f;
-            (gEnvFxBuffer + i)->xPos =
+        ENVFX_IS_ALIVE(i) = envfx_is_whirlpool_bubble_alive(i);
+        if (!ENVFX_IS_ALIVE(i)) {
+            ENVFX_DIST(i) = random_stream_float(&gEnvFxRandomStream) * 1000.0f;
+            ENVFX_ANGLE(i) = random_stream_float(&gEnvFxRandomStream) * 65536.0f;
+            ENVFX_X(i) =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_X]
-                + sins((gEnvFxBuffer + i)->angleAndDist[0]) * (gEnvFxBuffer + i)->angleAndDist[1];
-            (gEnvFxBuffer + i)->zPos =
+                + sins(ENVFX_ANGLE(i)) * ENVFX_DIST(i);
+            ENVFX_Z(i) =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_Z]
-                + coss((gEnvFxBuffer + i)->angleAndDist[0]) * (gEnvFxBuffer + i)->angleAndDist[1];
-            (gEnvFxBuffer + i)->bubbleY =
-                gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + (random_float() * 100.0f - 50.0f);
-            (gEnvFxBuffer + i)->yPos = (i + gEnvFxBuffer)->bubbleY;
-            (gEnvFxBuffer + i)->unusedBubbleVar = 0;
-            (gEnvFxBuffer + i)->isAlive = TRUE;
-
-            envfx_rotate_around_whirlpool(&(gEnvFxBuffer + i)->xPos, &(gEnvFxBuffer + i)->yPos,
-                                          &(gEnvFxBuffer + i)->zPos);
+                + coss(ENVFX_ANGLE(i)) * ENVFX_DIST(i);
+            ENVFX_BUBBLE_Y(i) =
+                gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + (random_stream_float(&gEnvFxRandomStream) * 100.0f - 50.0f);
+            ENVFX_Y(i) = ENVFX_BUBBLE_Y(i);
+            ENVFX_IS_ALIVE(i) = TRUE;
+
+            envfx_rotate_around_whirlpool(&ENVFX_X(i), &ENVFX_Y(i), &ENVFX_Z(i));
         } else {
-            (gEnvFxBuffer + i)->angleAndDist[1] -= 40;
-            (gEnvFxBuffer + i)->angleAndDist[0] +=
-                (s16)(3000 - (gEnvFxBuffer + i)->angleAndDist[1] * 2) + 0x400;
-            (gEnvFxBuffer + i)->xPos =
+            ENVFX_DIST(i) -= 40;
+            ENVFX_ANGLE(i) +=
+                (s16)(3000 - ENVFX_DIST(i) * 2) + 0x400;
+            ENVFX_X(i) =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_X]
-                + sins((gEnvFxBuffer + i)->angleAndDist[0]) * (gEnvFxBuffer + i)->angleAndDist[1];
-            (gEnvFxBuffer + i)->zPos =
+                + sins(ENVFX_ANGLE(i)) * ENVFX_DIST(i);
+            ENVFX_Z(i) =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_Z]
-                + coss((gEnvFxBuffer + i)->angleAndDist[0]) * (gEnvFxBuffer + i)->angleAndDist[1];
-            (gEnvFxBuffer + i)->bubbleY -= 40 - ((s16)(gEnvFxBuffer + i)->angleAndDist[1] / 100);
-            (gEnvFxBuffer + i)->yPos = (i + gEnvFxBuffer)->bubbleY;
+                + coss(ENVFX_ANGLE(i)) * ENVFX_DIST(i);
+            ENVFX_BUBBLE_Y(i) -= 40 - ((s16) ENVFX_DIST(i) / 100);
+            ENVFX_Y(i) = ENVFX_BUBBLE_Y(i);
 
-            envfx_rotate_around_whirlpool(&(gEnvFxBuffer + i)->xPos, &(gEnvFxBuffer + i)->yPos,
-                                          &(gEnvFxBuffer + i)->zPos);
+            envfx_rotate_around_whirlpool(&ENVFX_X(i), &ENVFX_Y(i), &ENVFX_Z(i));
         }
     }
 }
@@ -256,7 +253,7 @@ void envfx_update_whirlpool(void) {
 s32 envfx_is_jestream_bubble_alive(s32 index) {
     if (!particle_is_laterally_close(index, gEnvFxBubbleConfig[ENVFX_STATE_SRC_X],
                                      gEnvFxBubbleConfig[ENVFX_STATE_SRC_Z], 1000)
-        || gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + 1500 < (gEnvFxBuffer + index)->yPos) {
+        || gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + 1500 < ENVFX_Y(index)) {
         return FALSE;
     }
 
@@ -271,23 +268,23 @@ void envfx_update_jetstream(void) {
     s32 i;
 
     for (i = 0; i < sBubbleParticleMaxCount; i++) {
-        (gEnvFxBuffer + i)->isAlive = envfx_is_jestream_bubble_alive(i);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->angleAndDist[1] = random_float() * 300.0f;
-            (gEnvFxBuffer + i)->angleAndDist[0] = random_u16();
-            (gEnvFxBuffer + i)->xPos =
+        ENVFX_IS_ALIVE(i) = envfx_is_jestream_bubble_alive(i);
+        if (!ENVFX_IS_ALIVE(i)) {
+            ENVFX_DIST(i) = random_stream_float(&gEnvFxRandomStream) * 300.0f;
+            ENVFX_ANGLE(i) = random_stream_u16(&gEnvFxRandomStream);
+            ENVFX_X(i) =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_X]
-                + sins((gEnvFxBuffer + i)->angleAndDist[0]) * (gEnvFxBuffer + i)->angleAndDist[1];
-            (gEnvFxBuffer + i)->zPos =
+                + sins(ENVFX_ANGLE(i)) * ENVFX_DIST(i);
+            ENVFX_Z(i) =
                 gEnvFxBubbleConfig[ENVFX_STATE_SRC_Z]
-                + coss((gEnvFxBuffer + i)->angleAndDist[0]) * (gEnvFxBuffer + i)->angleAndDist[1];
-            (gEnvFxBuffer + i)->yPos =
-                gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + (random_float() * 400.0f - 200.0f);
+                + coss(ENVFX_ANGLE(i)) * ENVFX_DIST(i);
+            ENVFX_Y(i) =
+                gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y] + (random_stream_float(&gEnvFxRandomStream) * 400.0f - 200.0f);
         } else {
-            (gEnvFxBuffer + i)->angleAndDist[1] += 10;
-            (gEnvFxBuffer + i)->xPos += sins((gEnvFxBuffer + i)->angleAndDist[0]) * 10.0f;
-            (gEnvFxBuffer + i)->zPos += coss((gEnvFxBuffer + i)->angleAndDist[0]) * 10.0f;
-            (gEnvFxBuffer + i)->yPos -= ((gEnvFxBuffer + i)->angleAndDist[1] / 30) - 50;
+            ENVFX_DIST(i) += 10;
+            ENVFX_X(i) += sins(ENVFX_ANGLE(i)) * 10.0f;
+            ENVFX_Z(i) += coss(ENVFX_ANGLE(i)) * 10.0f;
+            ENVFX_Y(i) -= (ENVFX_DIST(i) / 30) - 50;
         }
     }
 }
@@ -323,19 +320,18 @@ s32 envfx_init_bubble(s32 mode) {
             break;
     }
 
-    gEnvFxBuffer = mem_pool_alloc(gEffectsMemoryPool,
-                                  sBubbleParticleCount * sizeof(struct EnvFxParticle));
-    if (gEnvFxBuffer == NULL) {
+    if (!envfx_alloc_particle_buffer(sBubbleParticleCount)) {
         return FALSE;
     }
 
-    bzero(gEnvFxBuffer, sBubbleParticleCount * sizeof(struct EnvFxParticle));
     bzero(gEnvFxBubbleConfig, sizeof(gEnvFxBubbleConfig));
 
+    random_stream_seed(&gEnvFxRandomStream, 0x50A8C92E);
+
     switch (mode) {
         case ENVFX_LAVA_BUBBLES:
             for (i = 0; i < sBubbleParticleCount; i++) {
-                (gEnvFxBuffer + i)->animFrame = random_float() * 7.0f;
+                ENVFX_ANIM_FRAME(i) = random_stream_float(&gEnvFxRandomStream) * 7.0f;
             }
             break;
     }
@@ -381,6 +377,48 @@ void envfx_bubbles_update_switch(s32 mode, Vec3s camTo, Vec3s vertex1, Vec3s ver
     }
 }
 
+#ifdef ENVFX_SOA_PARTICLES
+/**
+ * Write the vertices for all bubbles into one display list pool allocation,
+ * walking the position arrays linearly. The 3 input vertices represent the
+ * rotated triangle around (0,0,0) that is translated to each bubble position.
+ */
+static Vtx *envfx_build_bubble_vertices(s32 count, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3,
+                                        Vtx *template) {
+    Vtx *vertBuf = alloc_display_list(count * 3 * sizeof(Vtx));
+    Vtx *vtx = vertBuf;
+    s32 i;
+
+    if (vertBuf == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < count; i++) {
+        s32 x = ENVFX_X(i);
+        s32 y = ENVFX_Y(i);
+        s32 z = ENVFX_Z(i);
+
+        vtx[0] = template[0];
+        vtx[0].v.ob[0] = x + vertex1[0];
+        vtx[0].v.ob[1] = y + vertex1[1];
+        vtx[0].v.ob[2] = z + vertex1[2];
+
+        vtx[1] = template[1];
+        vtx[1].v.ob[0] = x + vertex2[0];
+        vtx[1].v.ob[1] = y + vertex2[1];
+        vtx[1].v.ob[2] = z + vertex2[2];
+
+        vtx[2] = template[2];
+        vtx[2].v.ob[0] = x + vertex3[0];
+        vtx[2].v.ob[1] = y + vertex3[1];
+        vtx[2].v.ob[2] = z + vertex3[2];
+
+        vtx += 3;
+    }
+
+    return vertBuf;
+}
+#else
 /**
  * Append 15 vertices to 'gfx', which is enough for 5 bubbles starting at
  * 'index'. The 3 input vertices represent the rotated triangle around (0,0,0)
@@ -414,6 +452,7 @@ void append_bubble_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s verte
 
     gSPVertex(gfx, VIRTUAL_TO_PHYSICAL(vertBuf), 15, 0);
 }
+#endif // ENVFX_SOA_PARTICLES
 
 /**
  * Appends to the enfvx display list a command setting the appropriate texture
@@ -422,17 +461,17 @@ void append_bubble_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s verte
  */
 void envfx_set_bubble_texture(s32 mode, s16 index) {
     void **imageArr;
-    s16 frame = (gEnvFxBuffer + index)->animFrame;
+    s16 frame = ENVFX_ANIM_FRAME(index);
 
     switch (mode) {
         case ENVFX_FLOWERS:
             imageArr = segmented_to_virtual(&flower_bubbles_textures_ptr_0B002008);
-            frame = (gEnvFxBuffer + index)->animFrame;
+            frame = ENVFX_ANIM_FRAME(index);
             break;
 
         case ENVFX_LAVA_BUBBLES:
             imageArr = segmented_to_virtual(&lava_bubble_ptr_0B006020);
-            frame = (gEnvFxBuffer + index)->animFrame;
+            frame = ENVFX_ANIM_FRAME(index);
             break;
 
         case ENVFX_WHIRLPOOL_BUBBLES:
@@ -474,6 +513,28 @@ Gfx *envfx_update_bubble_particles(s32 mode, UNUSED Vec3s marioPos, Vec3s camFro
 
     gSPDisplayList(sGfxCursor++, &tiny_bubble_dl_0B006D38);
 
+#ifdef ENVFX_SOA_PARTICLES
+    {
+        // Round up to whole groups of 5 so the last gSPVertex batch stays in
+        // bounds; the particle buffer always holds a multiple of 5 particles.
+        Vtx *vertBuf = envfx_build_bubble_vertices(((sBubbleParticleMaxCount + 4) / 5) * 5,
+                                                   vertex1, vertex2, vertex3, (Vtx *) gBubbleTempVtx);
+        if (vertBuf == NULL) {
+            return NULL;
+        }
+
+        for (i = 0; i < sBubbleParticleMaxCount; i += 5) {
+            gDPPipeSync(sGfxCursor++);
+            envfx_set_bubble_texture(mode, i);
+            gSPVertex(sGfxCursor++, VIRTUAL_TO_PHYSICAL(vertBuf + i * 3), 15, 0);
+            gSP1Triangle(sGfxCursor++, 0, 1, 2, 0);
+            gSP1Triangle(sGfxCursor++, 3, 4, 5, 0);
+            gSP1Triangle(sGfxCursor++, 6, 7, 8, 0);
+            gSP1Triangle(sGfxCursor++, 9, 10, 11, 0);
+            gSP1Triangle(sGfxCursor++, 12, 13, 14, 0);
+        }
+    }
+#else
     for (i = 0; i < sBubbleParticleMaxCount; i += 5) {
         gDPPipeSync(sGfxCursor++);
         envfx_set_bubble_texture(mode, i);
@@ -484,6 +545,7 @@ Gfx *envfx_update_bubble_particles(s32 mode, UNUSED Vec3s marioPos, Vec3s camFro
         gSP1Triangle(sGfxCursor++, 9, 10, 11, 0);
         gSP1Triangle(sGfxCursor++, 12, 13, 14, 0);
     }
+#endif
 
     gSPDisplayList(sGfxCursor++, &tiny_bubble_dl_0B006AB0);
     gSPEndDisplayList(sGfxCursor++);
@@ -33,7 +33,84 @@ struct SnowFlakeVertex {
     s16 z;
 };
 
+#ifdef ENVFX_SOA_PARTICLES
+struct EnvFxParticles gEnvFxParticles;
+void *gEnvFxBuffer;
+/// Particle count the current buffer was carved up for, for relocation
+static s32 sEnvFxBufferCount;
+#else
 struct EnvFxParticle *gEnvFxBuffer;
+#endif
+
+/**
+ * Pseudorandom stream for all envfx particles (snow and bubbles). Envfx is
+ * purely visual, so it gets its own stream instead of draining the global
+ * random_u16 sequence the gameplay code depends on; reseeded from a constant
+ * on every envfx init so particle placement is replay-stable.
+ */
+struct RandomStream gEnvFxRandomStream;
+
+#ifdef ENVFX_SOA_PARTICLES
+/**
+ * Point the attribute arrays of gEnvFxParticles into the single particle
+ * buffer. The s32 arrays come first so every array is naturally aligned.
+ */
+static void envfx_setup_particle_arrays(void *base, s32 count) {
+    u8 *p = base;
+
+    gEnvFxParticles.xPos = (s32 *) p;      p += count * sizeof(s32);
+    gEnvFxParticles.yPos = (s32 *) p;      p += count * sizeof(s32);
+    gEnvFxParticles.zPos = (s32 *) p;      p += count * sizeof(s32);
+    gEnvFxParticles.angle = (s32 *) p;     p += count * sizeof(s32);
+    gEnvFxParticles.dist = (s32 *) p;      p += count * sizeof(s32);
+    gEnvFxParticles.bubbleY = (s32 *) p;   p += count * sizeof(s32);
+    gEnvFxParticles.animFrame = (s16 *) p; p += count * sizeof(s16);
+    gEnvFxParticles.isAlive = (s8 *) p;
+}
+
+#define ENVFX_BUFFER_SIZE(count) ((count) * (6 * sizeof(s32) + sizeof(s16) + sizeof(s8)))
+#else
+#define ENVFX_BUFFER_SIZE(count) ((count) * sizeof(struct EnvFxParticle))
+#endif
+
+#ifdef MEM_POOL_COMPACTION
+/**
+ * Keep gEnvFxBuffer pointing at the particle buffer when the effects pool is
+ * compacted. The buffer is self-contained, so nothing else needs fixing up
+ * beyond re-deriving the attribute arrays in the struct-of-arrays layout.
+ */
+static void envfx_buffer_relocated(struct MemPoolHandle *handle) {
+    gEnvFxBuffer = handle->addr;
+#ifdef ENVFX_SOA_PARTICLES
+    envfx_setup_particle_arrays(gEnvFxBuffer, sEnvFxBufferCount);
+#endif
+}
+
+struct MemPoolHandle gEnvFxBufferHandle = { NULL, envfx_buffer_relocated };
+#endif
+
+/**
+ * Allocate and zero the particle state buffer for 'count' particles from the
+ * effects pool. Shared by the snow and bubble initializers.
+ */
+s32 envfx_alloc_particle_buffer(s32 count) {
+#ifdef MEM_POOL_COMPACTION
+    gEnvFxBuffer = mem_pool_alloc_handle(gEffectsMemoryPool, ENVFX_BUFFER_SIZE(count),
+                                         &gEnvFxBufferHandle);
+#else
+    gEnvFxBuffer = mem_pool_alloc(gEffectsMemoryPool, ENVFX_BUFFER_SIZE(count));
+#endif
+    if (gEnvFxBuffer == NULL) {
+        return FALSE;
+    }
+
+    bzero(gEnvFxBuffer, ENVFX_BUFFER_SIZE(count));
+#ifdef ENVFX_SOA_PARTICLES
+    sEnvFxBufferCount = count;
+    envfx_setup_particle_arrays(gEnvFxBuffer, count);
+#endif
+    return TRUE;
+}
 Vec3i gSnowCylinderLastPos;
 s16 gSnowParticleCount;
 s16 gSnowParticleMaxCount;
@@ -46,6 +123,14 @@ Vtx gSnowTempVtx[3] = { { { { -5, 5, 0 }, 0, { 0, 0 }, { 0x7F, 0x7F, 0x7F, 0xFF
                         { { { -5, -5, 0 }, 0, { 0, 960 }, { 0x7F, 0x7F, 0x7F, 0xFF } } },
                         { { { 5, 5, 0 }, 0, { 960, 0 }, { 0x7F, 0x7F, 0x7F, 0xFF } } } };
 
+// Snowflakes spawn and despawn in groups of this size; the doubled budget
+// keeps the same ramp-up time by growing twice as fast.
+#ifdef ENVFX_SOA_PARTICLES
+#define SNOW_PARTICLE_STEP 10
+#else
+#define SNOW_PARTICLE_STEP 5
+#endif
+
 // Change these to make snowflakes smaller or bigger
 struct SnowFlakeVertex gSnowFlakeVertex1 = { -5, 5, 0 };
 struct SnowFlakeVertex gSnowFlakeVertex2 = { -5, -5, 0 };
@@ -64,6 +149,22 @@ s32 envfx_init_snow(s32 mode) {
         case ENVFX_MODE_NONE:
             return FALSE;
 
+#ifdef ENVFX_SOA_PARTICLES
+        case ENVFX_SNOW_NORMAL:
+            gSnowParticleMaxCount = 280;
+            gSnowParticleCount = 10;
+            break;
+
+        case ENVFX_SNOW_WATER:
+            gSnowParticleMaxCount = 60;
+            gSnowParticleCount = 60;
+            break;
+
+        case ENVFX_SNOW_BLIZZARD:
+            gSnowParticleMaxCount = 280;
+            gSnowParticleCount = 280;
+            break;
+#else
         case ENVFX_SNOW_NORMAL:
             gSnowParticleMaxCount = 140;
             gSnowParticleCount = 5;
@@ -78,15 +179,14 @@ s32 envfx_init_snow(s32 mode) {
             gSnowParticleMaxCount = 140;
             gSnowParticleCount = 140;
             break;
+#endif
     }
 
-    gEnvFxBuffer = mem_pool_alloc(gEffectsMemoryPool,
-                                  gSnowParticleMaxCount * sizeof(struct EnvFxParticle));
-    if (gEnvFxBuffer == NULL) {
+    if (!envfx_alloc_particle_buffer(gSnowParticleMaxCount)) {
         return FALSE;
     }
 
-    bzero(gEnvFxBuffer, gSnowParticleMaxCount * sizeof(struct EnvFxParticle));
+    random_stream_seed(&gEnvFxRandomStream, 0x50A8C92E);
 
     gEnvFxMode = mode;
     return TRUE;
@@ -106,7 +206,7 @@ void envfx_update_snowflake_count(s32 mode, Vec3s marioPos) {
         case ENVFX_SNOW_NORMAL:
             if (gSnowParticleMaxCount > gSnowParticleCount) {
                 if (!(globalTimer & 63)) {
-                    gSnowParticleCount += 5;
+                    gSnowParticleCount += SNOW_PARTICLE_STEP;
                 }
             }
             break;
@@ -115,7 +215,8 @@ void envfx_update_snowflake_count(s32 mode, Vec3s marioPos) {
             waterLevel = find_water_level(marioPos[0], marioPos[2]);
 
             gSnowParticleCount =
-                (((s32)((waterLevel - 400.0f - (f32) marioPos[1]) * 0.001f) << 0x10) >> 0x10) * 5;
+                (((s32)((waterLevel - 400.0f - (f32) marioPos[1]) * 0.001f) << 0x10) >> 0x10)
+                * SNOW_PARTICLE_STEP;
 
             if (gSnowParticleCount < 0) {
                 gSnowParticleCount = 0;
@@ -139,7 +240,11 @@ void envfx_update_snowflake_count(s32 mode, Vec3s marioPos) {
 void envfx_cleanup_snow(void *snowParticleArray) {
     if (gEnvFxMode != ENVFX_MODE_NONE) {
         if (snowParticleArray) {
+#ifdef MEM_POOL_COMPACTION
+            mem_pool_free_handle(gEffectsMemoryPool, &gEnvFxBufferHandle);
+#else
             mem_pool_free(gEffectsMemoryPool, snowParticleArray);
+#endif
         }
         gEnvFxMode = ENVFX_MODE_NONE;
     }
@@ -175,9 +280,9 @@ void pos_from_orbit(Vec3s origin, Vec3s result, s16 radius, s16 pitch, s16 yaw)
  * x, y and z.
  */
 s32 envfx_is_snowflake_alive(s32 index, s32 snowCylinderX, s32 snowCylinderY, s32 snowCylinderZ) {
-    s32 x = (gEnvFxBuffer + index)->xPos;
-    s32 y = (gEnvFxBuffer + index)->yPos;
-    s32 z = (gEnvFxBuffer + index)->zPos;
+    s32 x = ENVFX_X(index);
+    s32 y = ENVFX_Y(index);
+    s32 z = ENVFX_Z(index);
 
     if (sqr(x - snowCylinderX) + sqr(z - snowCylinderZ) > sqr(300)) {
         return FALSE;
@@ -211,19 +316,19 @@ void envfx_update_snow_normal(s32 snowCylinderX, s32 snowCylinderY, s32 snowCyli
     s32 deltaZ = snowCylinderZ - gSnowCylinderLastPos[2];
 
     for (i = 0; i < gSnowParticleCount; i++) {
-        (gEnvFxBuffer + i)->isAlive =
+        ENVFX_IS_ALIVE(i) =
             envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->xPos =
-                400.0f * random_float() - 200.0f + snowCylinderX + (s16)(deltaX * 2);
-            (gEnvFxBuffer + i)->zPos =
-                400.0f * random_float() - 200.0f + snowCylinderZ + (s16)(deltaZ * 2);
-            (gEnvFxBuffer + i)->yPos = 200.0f * random_float() + snowCylinderY;
-            (gEnvFxBuffer + i)->isAlive = TRUE;
+        if (!ENVFX_IS_ALIVE(i)) {
+            ENVFX_X(i) =
+                400.0f * random_stream_float(&gEnvFxRandomStream) - 200.0f + snowCylinderX + (s16)(deltaX * 2);
+            ENVFX_Z(i) =
+                400.0f * random_stream_float(&gEnvFxRandomStream) - 200.0f + snowCylinderZ + (s16)(deltaZ * 2);
+            ENVFX_Y(i) = 200.0f * random_stream_float(&gEnvFxRandomStream) + snowCylinderY;
+            ENVFX_IS_ALIVE(i) = TRUE;
         } else {
-            (gEnvFxBuffer + i)->xPos += random_float() * 2 - 1.0f + (s16)(deltaX / 1.2);
-            (gEnvFxBuffer + i)->yPos -= 2 -(s16)(deltaY * 0.8);
-            (gEnvFxBuffer + i)->zPos += random_float() * 2 - 1.0f + (s16)(deltaZ / 1.2);
+            ENVFX_X(i) += random_stream_float(&gEnvFxRandomStream) * 2 - 1.0f + (s16)(deltaX / 1.2);
+            ENVFX_Y(i) -= 2 -(s16)(deltaY * 0.8);
+            ENVFX_Z(i) += random_stream_float(&gEnvFxRandomStream) * 2 - 1.0f + (s16)(deltaZ / 1.2);
         }
     }
 
@@ -245,19 +350,19 @@ void envfx_update_snow_blizzard(s32 snowCylinderX, s32 snowCylinderY, s32 snowCy
     s32 deltaZ = snowCylinderZ - gSnowCylinderLastPos[2];
 
     for (i = 0; i < gSnowParticleCount; i++) {
-        (gEnvFxBuffer + i)->isAlive =
+        ENVFX_IS_ALIVE(i) =
             envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->xPos =
-                400.0f * random_float() - 200.0f + snowCylinderX + (s16)(deltaX * 2);
-            (gEnvFxBuffer + i)->zPos =
-                400.0f * random_float() - 200.0f + snowCylinderZ + (s16)(deltaZ * 2);
-            (gEnvFxBuffer + i)->yPos = 400.0f * random_float() - 200.0f + snowCylinderY;
-            (gEnvFxBuffer + i)->isAlive = TRUE;
+        if (!ENVFX_IS_ALIVE(i)) {
+            ENVFX_X(i) =
+                400.0f * random_stream_float(&gEnvFxRandomStream) - 200.0f + snowCylinderX + (s16)(deltaX * 2);
+            ENVFX_Z(i) =
+                400.0f * random_stream_float(&gEnvFxRandomStream) - 200.0f + snowCylinderZ + (s16)(deltaZ * 2);
+            ENVFX_Y(i) = 400.0f * random_stream_float(&gEnvFxRandomStream) - 200.0f + snowCylinderY;
+            ENVFX_IS_ALIVE(i) = TRUE;
         } else {
-            (gEnvFxBuffer + i)->xPos += random_float() * 2 - 1.0f + (s16)(deltaX / 1.2) + 20.0f;
-            (gEnvFxBuffer + i)->yPos -= 5 -(s16)(deltaY * 0.8);
-            (gEnvFxBuffer + i)->zPos += random_float() * 2 - 1.0f + (s16)(deltaZ / 1.2);
+            ENVFX_X(i) += random_stream_float(&gEnvFxRandomStream) * 2 - 1.0f + (s16)(deltaX / 1.2) + 20.0f;
+            ENVFX_Y(i) -= 5 -(s16)(deltaY * 0.8);
+            ENVFX_Z(i) += random_stream_float(&gEnvFxRandomStream) * 2 - 1.0f + (s16)(deltaZ / 1.2);
         }
     }
 
@@ -290,13 +395,13 @@ void envfx_update_snow_water(s32 snowCylinderX, s32 snowCylinderY, s32 snowCylin
     s32 i;
 
     for (i = 0; i < gSnowParticleCount; i++) {
-        (gEnvFxBuffer + i)->isAlive =
+        ENVFX_IS_ALIVE(i) =
             envfx_is_snowflake_alive(i, snowCylinderX, snowCylinderY, snowCylinderZ);
-        if (!(gEnvFxBuffer + i)->isAlive) {
-            (gEnvFxBuffer + i)->xPos = 400.0f * random_float() - 200.0f + snowCylinderX;
-            (gEnvFxBuffer + i)->zPos = 400.0f * random_float() - 200.0f + snowCylinderZ;
-            (gEnvFxBuffer + i)->yPos = 400.0f * random_float() - 200.0f + snowCylinderY;
-            (gEnvFxBuffer + i)->isAlive = TRUE;
+        if (!ENVFX_IS_ALIVE(i)) {
+            ENVFX_X(i) = 400.0f * random_stream_float(&gEnvFxRandomStream) - 200.0f + snowCylinderX;
+            ENVFX_Z(i) = 400.0f * random_stream_float(&gEnvFxRandomStream) - 200.0f + snowCylinderZ;
+            ENVFX_Y(i) = 400.0f * random_stream_float(&gEnvFxRandomStream) - 200.0f + snowCylinderY;
+            ENVFX_IS_ALIVE(i) = TRUE;
         }
     }
 }
@@ -338,6 +443,48 @@ void rotate_triangle_vertices(Vec3s vertex1, Vec3s vertex2, Vec3s vertex3, s16 p
     vertex3[2] = v3[0] * sinMYaw + v3[1] * (-sinPitch * cosMYaw) + v3[2] * (cosPitch * cosMYaw);
 }
 
+#ifdef ENVFX_SOA_PARTICLES
+/**
+ * Write the vertices for all snowflakes into one display list pool
+ * allocation. The 3 input vertices represent the rotated triangle around
+ * (0,0,0) that is translated to each snowflake position; the position arrays
+ * are walked linearly so the whole batch is a single streaming pass.
+ */
+static Vtx *envfx_build_snowflake_vertices(s32 count, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3) {
+    Vtx *vertBuf = alloc_display_list(count * 3 * sizeof(Vtx));
+    Vtx *vtx = vertBuf;
+    s32 i;
+
+    if (vertBuf == NULL) {
+        return NULL;
+    }
+
+    for (i = 0; i < count; i++) {
+        s32 x = ENVFX_X(i);
+        s32 y = ENVFX_Y(i);
+        s32 z = ENVFX_Z(i);
+
+        vtx[0] = gSnowTempVtx[0];
+        vtx[0].v.ob[0] = x + vertex1[0];
+        vtx[0].v.ob[1] = y + vertex1[1];
+        vtx[0].v.ob[2] = z + vertex1[2];
+
+        vtx[1] = gSnowTempVtx[1];
+        vtx[1].v.ob[0] = x + vertex2[0];
+        vtx[1].v.ob[1] = y + vertex2[1];
+        vtx[1].v.ob[2] = z + vertex2[2];
+
+        vtx[2] = gSnowTempVtx[2];
+        vtx[2].v.ob[0] = x + vertex3[0];
+        vtx[2].v.ob[1] = y + vertex3[1];
+        vtx[2].v.ob[2] = z + vertex3[2];
+
+        vtx += 3;
+    }
+
+    return vertBuf;
+}
+#else
 /**
  * Append 15 vertices to 'gfx', which is enough for 5 snowflakes starting at
  * 'index' in the buffer. The 3 input vertices represent the rotated triangle
@@ -371,13 +518,109 @@ void append_snowflake_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s ve
 
     gSPVertex(gfx, VIRTUAL_TO_PHYSICAL(vertBuf), 15, 0);
 }
+#endif // ENVFX_SOA_PARTICLES
+
+#ifdef ENVFX_RETAINED_PARTICLE_DL
+
+#define ENVFX_RETAINED_MAX_PARTICLES 280
+#define ENVFX_RETAINED_GFX_COUNT ((ENVFX_RETAINED_MAX_PARTICLES / 5) * 6 + 1)
+
+/**
+ * Retained snowflake vertex buffers and command streams, double buffered by
+ * frame parity since the RCP may still be reading last frame's copy. The
+ * constant vertex attributes are filled in once; per frame only the flake
+ * positions are written, and the command stream is rebuilt only when the
+ * particle count changes (it ramps in steps when snow starts and stops).
+ */
+static Vtx sSnowRetainedVtx[2][ENVFX_RETAINED_MAX_PARTICLES * 3];
+static Gfx sSnowRetainedGfx[2][ENVFX_RETAINED_GFX_COUNT];
+static s16 sSnowRetainedGfxCount[2] = { -1, -1 };
+static s8 sSnowRetainedVtxInit = FALSE;
+
+/**
+ * Rebuild the retained gSPVertex/gSP1Triangle stream of one buffer for
+ * 'count' flakes. Like the throwaway builders, flakes are drawn in groups of
+ * five (the particle counts are all multiples of 5).
+ */
+static void envfx_build_retained_snow_gfx(s32 parity, s32 count) {
+    Gfx *gfx = sSnowRetainedGfx[parity];
+    Vtx *vtx = sSnowRetainedVtx[parity];
+    s32 i;
+
+    for (i = 0; i < count; i += 5) {
+        gSPVertex(gfx++, VIRTUAL_TO_PHYSICAL(vtx + i * 3), 15, 0);
+        gSP1Triangle(gfx++, 0, 1, 2, 0);
+        gSP1Triangle(gfx++, 3, 4, 5, 0);
+        gSP1Triangle(gfx++, 6, 7, 8, 0);
+        gSP1Triangle(gfx++, 9, 10, 11, 0);
+        gSP1Triangle(gfx++, 12, 13, 14, 0);
+    }
+    gSPEndDisplayList(gfx);
+
+    sSnowRetainedGfxCount[parity] = count;
+}
+
+/**
+ * Write this frame's snowflake positions into the retained vertex buffer for
+ * the current frame parity and return the command stream drawing them. This
+ * is the entire per-frame cost of getting the flakes to the RSP: nine short
+ * stores per flake, no Vtx copies and no command emission.
+ */
+static Gfx *envfx_update_retained_snow(s32 count, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3) {
+    s32 parity = gGlobalTimer & 1;
+    Vtx *vtx = sSnowRetainedVtx[parity];
+    s32 i, j;
+
+    if (!sSnowRetainedVtxInit) {
+        for (i = 0; i < ENVFX_RETAINED_MAX_PARTICLES * 3; i += 3) {
+            for (j = 0; j < 3; j++) {
+                sSnowRetainedVtx[0][i + j] = gSnowTempVtx[j];
+                sSnowRetainedVtx[1][i + j] = gSnowTempVtx[j];
+            }
+        }
+        sSnowRetainedVtxInit = TRUE;
+    }
+
+    if (count > ENVFX_RETAINED_MAX_PARTICLES) {
+        count = ENVFX_RETAINED_MAX_PARTICLES;
+    }
+
+    for (i = 0; i < count; i++) {
+        s32 x = ENVFX_X(i);
+        s32 y = ENVFX_Y(i);
+        s32 z = ENVFX_Z(i);
+
+        vtx[0].v.ob[0] = x + vertex1[0];
+        vtx[0].v.ob[1] = y + vertex1[1];
+        vtx[0].v.ob[2] = z + vertex1[2];
+
+        vtx[1].v.ob[0] = x + vertex2[0];
+        vtx[1].v.ob[1] = y + vertex2[1];
+        vtx[1].v.ob[2] = z + vertex2[2];
+
+        vtx[2].v.ob[0] = x + vertex3[0];
+        vtx[2].v.ob[1] = y + vertex3[1];
+        vtx[2].v.ob[2] = z + vertex3[2];
+
+        vtx += 3;
+    }
+
+    if (sSnowRetainedGfxCount[parity] != count) {
+        envfx_build_retained_snow_gfx(parity, count);
+    }
+
+    return sSnowRetainedGfx[parity];
+}
+#endif // ENVFX_RETAINED_PARTICLE_DL
 
 /**
  * Updates positions of snow particles and returns a pointer to a display list
  * drawing all snowflakes.
  */
 Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo) {
+#ifndef ENVFX_RETAINED_PARTICLE_DL
     s32 i;
+#endif
     s16 radius, pitch, yaw;
     Vec3s snowCylinderPos;
     struct SnowFlakeVertex vertex1, vertex2, vertex3;
@@ -388,7 +631,12 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
     vertex2 = gSnowFlakeVertex2;
     vertex3 = gSnowFlakeVertex3;
 
+#ifdef ENVFX_RETAINED_PARTICLE_DL
+    // Just the texture setup, a call into the retained stream, and the close.
+    gfxStart = (Gfx *) alloc_display_list(4 * sizeof(Gfx));
+#else
     gfxStart = (Gfx *) alloc_display_list((gSnowParticleCount * 6 + 3) * sizeof(Gfx));
+#endif
     gfx = gfxStart;
 
     if (gfxStart == NULL) {
@@ -444,6 +692,27 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
         gSPDisplayList(gfx++, &tiny_bubble_dl_0B006CD8); // snowflake with blue edge
     }
 
+#ifdef ENVFX_RETAINED_PARTICLE_DL
+    gSPDisplayList(gfx++, envfx_update_retained_snow(gSnowParticleCount, (s16 *) &vertex1,
+                                                     (s16 *) &vertex2, (s16 *) &vertex3));
+#elif defined(ENVFX_SOA_PARTICLES)
+    {
+        Vtx *vertBuf = envfx_build_snowflake_vertices(gSnowParticleCount, (s16 *) &vertex1,
+                                                      (s16 *) &vertex2, (s16 *) &vertex3);
+        if (vertBuf == NULL) {
+            return NULL;
+        }
+
+        for (i = 0; i < gSnowParticleCount; i += 5) {
+            gSPVertex(gfx++, VIRTUAL_TO_PHYSICAL(vertBuf + i * 3), 15, 0);
+            gSP1Triangle(gfx++, 0, 1, 2, 0);
+            gSP1Triangle(gfx++, 3, 4, 5, 0);
+            gSP1Triangle(gfx++, 6, 7, 8, 0);
+            gSP1Triangle(gfx++, 9, 10, 11, 0);
+            gSP1Triangle(gfx++, 12, 13, 14, 0);
+        }
+    }
+#else
     for (i = 0; i < gSnowParticleCount; i += 5) {
         append_snowflake_vertex_buffer(gfx++, i, (s16 *) &vertex1, (s16 *) &vertex2, (s16 *) &vertex3);
 
@@ -453,6 +722,7 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
         gSP1Triangle(gfx++, 9, 10, 11, 0);
         gSP1Triangle(gfx++, 12, 13, 14, 0);
     }
+#endif
 
     gSPDisplayList(gfx++, &tiny_bubble_dl_0B006AB0) gSPEndDisplayList(gfx++);
 
@@ -4,6 +4,41 @@
 #include <PR/ultratypes.h>
 #include "types.h"
 
+#ifdef ENVFX_SOA_PARTICLES
+
+/**
+ * Particle state stored as struct-of-arrays: every attribute is a tight,
+ * contiguous array carved from one allocation (see
+ * envfx_alloc_particle_buffer), so the per-frame update loops stream through
+ * memory instead of striding over a 56 byte struct to touch a handful of
+ * fields. Snow only ever reads positions and isAlive; packing those densely
+ * is what pays for the doubled snowflake budget.
+ */
+struct EnvFxParticles {
+    s32 *xPos;
+    s32 *yPos;
+    s32 *zPos;
+    s32 *angle;     // for whirlpools/jet streams, angle from center
+    s32 *dist;      // for whirlpools/jet streams, distance from center
+    s32 *bubbleY;   // for bubbles, yPos is always set to this
+    s16 *animFrame; // lava bubbles and flowers have frame animations
+    s8 *isAlive;
+};
+
+extern struct EnvFxParticles gEnvFxParticles;
+extern void *gEnvFxBuffer;
+
+#define ENVFX_IS_ALIVE(i)   gEnvFxParticles.isAlive[i]
+#define ENVFX_ANIM_FRAME(i) gEnvFxParticles.animFrame[i]
+#define ENVFX_X(i)          gEnvFxParticles.xPos[i]
+#define ENVFX_Y(i)          gEnvFxParticles.yPos[i]
+#define ENVFX_Z(i)          gEnvFxParticles.zPos[i]
+#define ENVFX_ANGLE(i)      gEnvFxParticles.angle[i]
+#define ENVFX_DIST(i)       gEnvFxParticles.dist[i]
+#define ENVFX_BUBBLE_Y(i)   gEnvFxParticles.bubbleY[i]
+
+#else
+
 struct EnvFxParticle {
     s8 isAlive;
     s16 animFrame; // lava bubbles and flowers have frame animations
@@ -16,12 +51,29 @@ struct EnvFxParticle {
     u8 filler[24];
 };
 
+extern struct EnvFxParticle *gEnvFxBuffer;
+
+#define ENVFX_IS_ALIVE(i)   (gEnvFxBuffer + (i))->isAlive
+#define ENVFX_ANIM_FRAME(i) (gEnvFxBuffer + (i))->animFrame
+#define ENVFX_X(i)          (gEnvFxBuffer + (i))->xPos
+#define ENVFX_Y(i)          (gEnvFxBuffer + (i))->yPos
+#define ENVFX_Z(i)          (gEnvFxBuffer + (i))->zPos
+#define ENVFX_ANGLE(i)      (gEnvFxBuffer + (i))->angleAndDist[0]
+#define ENVFX_DIST(i)       (gEnvFxBuffer + (i))->angleAndDist[1]
+#define ENVFX_BUBBLE_Y(i)   (gEnvFxBuffer + (i))->bubbleY
+
+#endif // ENVFX_SOA_PARTICLES
+
 extern s8 gEnvFxMode;
 
-extern struct EnvFxParticle *gEnvFxBuffer;
+extern struct RandomStream gEnvFxRandomStream;
+#ifdef MEM_POOL_COMPACTION
+extern struct MemPoolHandle gEnvFxBufferHandle;
+#endif
 extern Vec3i gSnowCylinderLastPos;
 extern s16 gSnowParticleCount;
 
+s32 envfx_alloc_particle_buffer(s32 count);
 Gfx *envfx_update_particles(s32 mode, Vec3s marioPos, Vec3s camTo, Vec3s camFrom);
 void orbit_from_positions(Vec3s from, Vec3s to, s16 *radius, s16 *pitch, s16 *yaw);
 void rotate_triangle_vertices(Vec3s vertex1, Vec3s vertex2, Vec3s vertex3, s16 pitch, s16 yaw);
@@ -2,6 +2,13 @@
 // See the original repo for more details.
 
 #include <ultra64.h>
+#include <stdarg.h>
+
+#include "config.h"
+#include "gfx_dimensions.h"
+#include "game_init.h"
+#include "printf.h"
+#include "fasttext.h"
 
 #define TEX_ASCII_START '!'
 #define TAB_WIDTH 16
@@ -73,7 +80,7 @@ void drawSmallString_impl(Gfx **dl, int x, int y, const char* string, int r, int
         } else {
             if (cur_char != ' ') {
                 s = computeS(cur_char);
-                gSPTextureRectangle(dlHead++, (xPos + 0) << 2, (yPos + 0) << 2, (xPos + 8) << 2, (yPos + 12) << 2, 0, s << 5, 0, 1 << 10, 1 << 10);
+                gSPTextureRectangle(dlHead++, (xPos + 0) << 2, ADAPTIVE_RES_Y((yPos + 0) << 2), (xPos + 8) << 2, ADAPTIVE_RES_Y((yPos + 12) << 2), 0, s << 5, 0, 1 << 10, ADAPTIVE_RES_STEP_T(1 << 10));
             }
             xPos += fast_text_font_kerning[cur_char - ' '];
         }
@@ -85,3 +92,131 @@ void drawSmallString_impl(Gfx **dl, int x, int y, const char* string, int r, int
 
     *dl = dlHead;
 }
+
+#ifdef FASTTEXT_STRING_CACHE
+
+#define FASTTEXT_CACHE_SLOTS 8
+#define FASTTEXT_CACHE_CHARS 64
+#define FASTTEXT_CACHE_CMDS 208 // 3 per glyph plus setup/teardown and the end command
+
+struct FastTextCacheSlot {
+    char str[FASTTEXT_CACHE_CHARS];
+    u32 lastUse;
+    s16 x, y;
+    u8 r, g, b;
+    u8 valid;
+    s8 side;
+    Gfx gfx[2][FASTTEXT_CACHE_CMDS];
+};
+
+static struct FastTextCacheSlot sFastTextCache[FASTTEXT_CACHE_SLOTS];
+
+/**
+ * Interning wrapper around drawSmallString_impl. Strings are rendered into a
+ * retained buffer the first time they are drawn; while the string, position
+ * and colour stay the same, later frames replay the retained copy with a
+ * single command instead of re-emitting a texture rectangle per glyph. Slots
+ * are evicted least recently used, and each slot keeps two copies so a
+ * rebuild never writes the buffer the RCP may still be reading from the
+ * previous frame. Oversized strings fall back to direct rendering.
+ */
+void drawSmallStringCached_impl(Gfx **dl, int x, int y, const char *string, int r, int g, int b) {
+    struct FastTextCacheSlot *slot = NULL;
+    Gfx *head;
+    int len = 0;
+    int glyphs = 0;
+    int i, j;
+
+    while (string[len] != '\0') {
+        char c = string[len];
+        if (c != ' ' && c != '\n' && c != '\t') {
+            glyphs++;
+        }
+        len++;
+    }
+
+    if (len >= FASTTEXT_CACHE_CHARS || glyphs * 3 + 13 > FASTTEXT_CACHE_CMDS) {
+        drawSmallString_impl(dl, x, y, string, r, g, b);
+        return;
+    }
+
+    for (i = 0; i < FASTTEXT_CACHE_SLOTS; i++) {
+        struct FastTextCacheSlot *s = &sFastTextCache[i];
+        if (s->valid && s->x == x && s->y == y && s->r == r && s->g == g && s->b == b) {
+            for (j = 0; j <= len; j++) {
+                if (s->str[j] != string[j]) {
+                    break;
+                }
+            }
+            if (j > len) {
+                gSPDisplayList((*dl)++, s->gfx[s->side]);
+                s->lastUse = gGlobalTimer;
+                return;
+            }
+        }
+    }
+
+    for (i = 0; i < FASTTEXT_CACHE_SLOTS; i++) {
+        struct FastTextCacheSlot *s = &sFastTextCache[i];
+        if (!s->valid) {
+            slot = s;
+            break;
+        }
+        if (slot == NULL || s->lastUse < slot->lastUse) {
+            slot = s;
+        }
+    }
+
+    slot->side ^= 1;
+    head = slot->gfx[slot->side];
+    drawSmallString_impl(&head, x, y, string, r, g, b);
+    gSPEndDisplayList(head++);
+
+    for (j = 0; j <= len; j++) {
+        slot->str[j] = string[j];
+    }
+    slot->x = x;
+    slot->y = y;
+    slot->r = r;
+    slot->g = g;
+    slot->b = b;
+    slot->valid = TRUE;
+    slot->lastUse = gGlobalTimer;
+
+    gSPDisplayList((*dl)++, slot->gfx[slot->side]);
+}
+
+#endif
+
+static char *fasttext_write_to_buf(char *buffer, const char *data, size_t size) {
+    while (size-- > 0) {
+        *buffer++ = *data++;
+    }
+    return buffer;
+}
+
+/**
+ * Formatted entry point for the fasttext backend. The formatted output goes
+ * through the string cache when it is enabled, so text that formats to the
+ * same bytes as last frame is not re-rendered.
+ */
+void drawSmallStringFmt(Gfx **dl, int x, int y, int r, int g, int b, const char *fmt, ...) {
+    char buf[256];
+    s32 size;
+    va_list args;
+
+    va_start(args, fmt);
+    size = _Printf(fasttext_write_to_buf, buf, fmt, args);
+    va_end(args);
+
+    if (size <= 0) {
+        return;
+    }
+    buf[size] = '\0';
+
+#ifdef FASTTEXT_STRING_CACHE
+    drawSmallStringCached_impl(dl, x, y, buf, r, g, b);
+#else
+    drawSmallString_impl(dl, x, y, buf, r, g, b);
+#endif
+}
@@ -2,6 +2,13 @@
 #define __FASTTEXT_H__
 
 void drawSmallString_impl(Gfx**, int, int, const char*, int, int , int);
+void drawSmallStringFmt(Gfx **dl, int x, int y, int r, int g, int b, const char *fmt, ...);
+
+#ifdef FASTTEXT_STRING_CACHE
+void drawSmallStringCached_impl(Gfx**, int, int, const char*, int, int, int);
+#else
+#define drawSmallStringCached_impl drawSmallString_impl
+#endif
 
 static inline void drawSmallString(Gfx **dl, int x, int y, const char* string) {
   drawSmallString_impl(dl, x, y, string, 255, 255, 255);
@@ -11,4 +18,12 @@ static inline void drawSmallStringCol(Gfx **dl, int x, int y, const char* string
   drawSmallString_impl(dl, x, y, string, r, g, b);
 }
 
+static inline void drawSmallStringCached(Gfx **dl, int x, int y, const char* string) {
+  drawSmallStringCached_impl(dl, x, y, string, 255, 255, 255);
+}
+
+static inline void drawSmallStringCachedCol(Gfx **dl, int x, int y, const char* string, int r, int g, int b) {
+  drawSmallStringCached_impl(dl, x, y, string, r, g, b);
+}
+
 #endif
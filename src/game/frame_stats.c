@@ -0,0 +1,60 @@
+#include <ultra64.h>
+
+#include "config.h"
+#include "frame_stats.h"
+#include "game_init.h"
+
+#if defined(FRAME_STATS_COUNTERS) && defined(UNF)
+#include "usb/debug.h"
+#endif
+
+#ifdef FRAME_STATS_COUNTERS
+
+u32 gFrameStats[FRAME_STAT_COUNT];
+u32 gFrameStatsLast[FRAME_STAT_COUNT];
+u8 gFrameStatsStream = FALSE;
+
+const char *gFrameStatNames[FRAME_STAT_COUNT] = {
+    "FLOOR CALLS",
+    "CEIL CALLS",
+    "WALL CALLS",
+    "SURFS TESTED",
+    "CELLS VISITED",
+    "POOL BYTES",
+    "DL WORDS",
+    "ZEX DL NODES",
+    "REJ DL NODES",
+    "UCODE LOADS",
+};
+
+/**
+ * Publishes this frame's counters and restarts them. Called once per frame
+ * right after the master display list is closed, so the display list size
+ * can be read off directly.
+ */
+void frame_stats_end_frame(void) {
+    s32 i;
+
+    gFrameStats[FRAME_STAT_DL_WORDS] =
+        (gDisplayListHead - gGfxPool->buffer) * (sizeof(Gfx) / sizeof(u32));
+
+    for (i = 0; i < FRAME_STAT_COUNT; i++) {
+        gFrameStatsLast[i] = gFrameStats[i];
+        gFrameStats[i] = 0;
+    }
+
+#ifdef UNF
+    if (gFrameStatsStream) {
+        debug_printf("STATS,%d,%d,%d,%d,%d,%d,%d\n",
+                     gFrameStatsLast[FRAME_STAT_FIND_FLOOR],
+                     gFrameStatsLast[FRAME_STAT_FIND_CEIL],
+                     gFrameStatsLast[FRAME_STAT_FIND_WALL],
+                     gFrameStatsLast[FRAME_STAT_SURFACES_TESTED],
+                     gFrameStatsLast[FRAME_STAT_CELLS_VISITED],
+                     gFrameStatsLast[FRAME_STAT_POOL_BYTES],
+                     gFrameStatsLast[FRAME_STAT_DL_WORDS]);
+    }
+#endif
+}
+
+#endif // FRAME_STATS_COUNTERS
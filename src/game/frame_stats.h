@@ -0,0 +1,45 @@
+#pragma once
+
+#include <ultra64.h>
+#include "config.h"
+
+#ifdef FRAME_STATS_COUNTERS
+
+/**
+ * Lightweight per-frame counters. Hot paths bump them through the macros
+ * below, frame_stats_end_frame() publishes the finished frame's values to
+ * gFrameStatsLast and restarts the live counters, and the Puppyprint
+ * "Counters" page (or the USB stream) reads the published copy. Keeping the
+ * registry here means new counters only need an enum entry and a name.
+ */
+enum FrameStat {
+    FRAME_STAT_FIND_FLOOR,      // find_floor family calls
+    FRAME_STAT_FIND_CEIL,       // find_ceil calls
+    FRAME_STAT_FIND_WALL,       // find_wall_collisions calls
+    FRAME_STAT_SURFACES_TESTED, // surfaces examined across all cell list walks
+    FRAME_STAT_CELLS_VISITED,   // cell surface lists walked
+    FRAME_STAT_POOL_BYTES,      // bytes handed out by main_pool_alloc
+    FRAME_STAT_DL_WORDS,        // 32-bit words in the master display list
+    FRAME_STAT_DL_ZEX_NODES,    // master list entries drawn with the default ucode
+    FRAME_STAT_DL_REJ_NODES,    // master list entries drawn with the .rej ucode
+    FRAME_STAT_UCODE_SWITCHES,  // microcode reloads emitted by switch_ucode
+    FRAME_STAT_COUNT,
+};
+
+extern u32 gFrameStats[FRAME_STAT_COUNT];
+extern u32 gFrameStatsLast[FRAME_STAT_COUNT];
+extern const char *gFrameStatNames[FRAME_STAT_COUNT];
+extern u8 gFrameStatsStream;
+
+#define FRAME_STAT_ADD(stat, n) (gFrameStats[stat] += (u32)(n))
+#define FRAME_STAT_INC(stat)    FRAME_STAT_ADD(stat, 1)
+
+void frame_stats_end_frame(void);
+
+#else
+
+#define FRAME_STAT_ADD(stat, n)
+#define FRAME_STAT_INC(stat)
+#define frame_stats_end_frame()
+
+#endif // FRAME_STATS_COUNTERS
@@ -19,6 +19,9 @@
 #include "print.h"
 #include "segment2.h"
 #include "segment_symbols.h"
+#ifdef FRAME_INTERPOLATION
+#include "rendering_graph_node.h"
+#endif
 #include "rumble_init.h"
 #ifdef HVQM
 #include <hvqm/hvqm.h>
@@ -31,6 +34,10 @@
 #include "debug_box.h"
 #include "vc_check.h"
 #include "profiling.h"
+#include "frame_stats.h"
+#include "telemetry.h"
+#include "hot_reload.h"
+#include "debug_commands.h"
 
 // First 3 controller slots
 struct Controller gControllers[3];
@@ -171,8 +178,8 @@ void init_z_buffer(s32 resetZB) {
     gDPSetFillColor(gDisplayListHead++,
                     GPACK_ZDZ(G_MAXFBZ, 0) << 16 | GPACK_ZDZ(G_MAXFBZ, 0));
 
-    gDPFillRectangle(gDisplayListHead++, 0, gBorderHeight, SCREEN_WIDTH - 1,
-                     SCREEN_HEIGHT - 1 - gBorderHeight);
+    gDPFillRectangle(gDisplayListHead++, 0, ADAPTIVE_RES_Y(gBorderHeight), SCREEN_WIDTH - 1,
+                     ADAPTIVE_RES_Y(SCREEN_HEIGHT - gBorderHeight) - 1);
 }
 
 /**
@@ -184,8 +191,8 @@ void select_framebuffer(void) {
     gDPSetCycleType(gDisplayListHead++, G_CYC_1CYCLE);
     gDPSetColorImage(gDisplayListHead++, G_IM_FMT_RGBA, G_IM_SIZ_16b, SCREEN_WIDTH,
                      gPhysicalFramebuffers[sRenderingFramebuffer]);
-    gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, gBorderHeight, SCREEN_WIDTH,
-                  SCREEN_HEIGHT - gBorderHeight);
+    gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, ADAPTIVE_RES_Y(gBorderHeight), SCREEN_WIDTH,
+                  ADAPTIVE_RES_Y(SCREEN_HEIGHT - gBorderHeight));
 }
 
 /**
@@ -200,8 +207,8 @@ void clear_framebuffer(s32 color) {
 
     gDPSetFillColor(gDisplayListHead++, color);
     gDPFillRectangle(gDisplayListHead++,
-                     GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0), gBorderHeight,
-                     GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, SCREEN_HEIGHT - gBorderHeight - 1);
+                     GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0), ADAPTIVE_RES_Y(gBorderHeight),
+                     GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, ADAPTIVE_RES_Y(SCREEN_HEIGHT - gBorderHeight) - 1);
 
     gDPPipeSync(gDisplayListHead++);
 
@@ -217,6 +224,11 @@ void clear_viewport(Vp *viewport, s32 color) {
     s16 vpLrx = (viewport->vp.vtrans[0] + viewport->vp.vscale[0]) / 4 - 2;
     s16 vpLry = (viewport->vp.vtrans[1] + viewport->vp.vscale[1]) / 4 - 2;
 
+#ifdef ADAPTIVE_RESOLUTION
+    vpUly = ADAPTIVE_RES_Y(vpUly);
+    vpLry = ADAPTIVE_RES_Y(vpLry);
+#endif
+
 #ifdef WIDESCREEN
     vpUlx = GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(vpUlx);
     vpLrx = GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(SCREEN_WIDTH - vpLrx);
@@ -249,10 +261,10 @@ void draw_screen_borders(void) {
 
     if (gBorderHeight) {
         gDPFillRectangle(gDisplayListHead++, GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0), 0,
-                        GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, gBorderHeight - 1);
+                        GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, ADAPTIVE_RES_Y(gBorderHeight) - 1);
         gDPFillRectangle(gDisplayListHead++,
-                        GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0), SCREEN_HEIGHT - gBorderHeight,
-                        GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, SCREEN_HEIGHT - 1);
+                        GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0), ADAPTIVE_RES_Y(SCREEN_HEIGHT - gBorderHeight),
+                        GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, ADAPTIVE_RES_Y(SCREEN_HEIGHT) - 1);
     }
 }
 
@@ -266,9 +278,69 @@ void make_viewport_clip_rect(Vp *viewport) {
     s16 vpLrx = (viewport->vp.vtrans[0] + viewport->vp.vscale[0]) / 4 - 1;
     s16 vpLry = (viewport->vp.vtrans[1] + viewport->vp.vscale[1]) / 4 - 1;
 
+#ifdef ADAPTIVE_RESOLUTION
+    vpPly = ADAPTIVE_RES_Y(vpPly);
+    vpLry = ADAPTIVE_RES_Y(vpLry);
+#endif
+
     gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, vpUlx, vpPly, vpLrx, vpLry);
 }
 
+#ifdef ADAPTIVE_RESOLUTION
+f32 gResolutionScale = 1.0f;
+static u8 sResScaleStep = 0;
+static u16 sResOverloadFrames = 0;
+static u16 sResHeadroomFrames = 0;
+
+// The DPC counters tick at the 62.5MHz RCP clock; one 30Hz logic frame is
+// this many cycles. Overload/headroom thresholds are fractions of it.
+#define RES_FRAME_CYCLES    (62500000 / 30)
+#define RES_OVERLOAD_CYCLES ((RES_FRAME_CYCLES / 20) * 17) // pipe busy > 85%
+#define RES_HEADROOM_CYCLES ((RES_FRAME_CYCLES / 20) * 13) // pipe busy < 65%
+
+/**
+ * Step the vertical rendering resolution against measured RDP load. Called
+ * once per frame before the profiler resets the DPC counters, so the
+ * pipe-busy read covers the frame that just finished. Sustained overload
+ * drops the scale 10% at a time; sustained headroom raises it back.
+ */
+void adaptive_res_update(void) {
+    u32 pipeBusy = IO_READ(DPC_PIPEBUSY_REG);
+
+#ifdef PAUSE_SCENE_FREEZE
+    // Hold the scale while a frozen scene is replayed: the near-idle RDP would
+    // ramp it back up and stretch a scene rendered at the old resolution.
+    if (gPauseFreeze.active) {
+        return;
+    }
+#endif
+#ifndef USE_PROFILER
+    // Without the profiler, nobody else resets the counters each frame.
+    IO_WRITE(DPC_STATUS_REG, (DPC_CLR_CLOCK_CTR | DPC_CLR_CMD_CTR | DPC_CLR_PIPE_CTR | DPC_CLR_TMEM_CTR));
+#endif
+
+    if (pipeBusy > RES_OVERLOAD_CYCLES) {
+        sResOverloadFrames++;
+        sResHeadroomFrames = 0;
+    } else if (pipeBusy < RES_HEADROOM_CYCLES) {
+        sResHeadroomFrames++;
+        sResOverloadFrames = 0;
+    } else {
+        sResOverloadFrames = 0;
+        sResHeadroomFrames = 0;
+    }
+
+    if (sResOverloadFrames >= ADAPTIVE_RES_OVERLOAD_FRAMES && sResScaleStep < ADAPTIVE_RES_MAX_STEPS) {
+        sResScaleStep++;
+        sResOverloadFrames = 0;
+    } else if (sResHeadroomFrames >= ADAPTIVE_RES_RECOVER_FRAMES && sResScaleStep > 0) {
+        sResScaleStep--;
+        sResHeadroomFrames = 0;
+    }
+    gResolutionScale = 1.0f - 0.1f * sResScaleStep;
+}
+#endif // ADAPTIVE_RESOLUTION
+
 /**
  * Initializes the Fast3D OSTask structure.
  * If you plan on using gSPLoadUcode, make sure to add OS_TASK_LOADABLE to the flags member.
@@ -358,6 +430,10 @@ void end_master_display_list(void) {
     gDPFullSync(gDisplayListHead++);
     gSPEndDisplayList(gDisplayListHead++);
 
+    // The master list is complete, so its final size can be published.
+    frame_stats_end_frame();
+    telemetry_frame_update();
+
     create_gfx_task_structure();
 }
 
@@ -443,16 +519,128 @@ void render_init(void) {
     gGlobalTimer++;
 }
 
+#ifdef PAUSE_SCENE_FREEZE
+struct PauseFreeze gPauseFreeze;
+#endif
+
 /**
  * Selects the location of the F3D output buffer (gDisplayListHead).
  */
 void select_gfx_pool(void) {
+#ifdef PAUSE_SCENE_FREEZE
+    static s8 sLastBuildPool = 0;
+    s32 pool;
+
+    if (gPauseFreeze.active) {
+        // Rotate through the pools the frozen scene is not parked in. Pool 2
+        // is fair game: the interpolator is idle while the scene is frozen.
+        pool = (sLastBuildPool + 1) % (s32) ARRAY_COUNT(gGfxPools);
+        if (pool == gPauseFreeze.pool) {
+            pool = (pool + 1) % (s32) ARRAY_COUNT(gGfxPools);
+        }
+    } else {
+        pool = gGlobalTimer % 2;
+        if (pool == sLastBuildPool) {
+            // A freeze rotated off the timer's cadence; never reuse the pool
+            // the task in flight was built in.
+            pool ^= 1;
+        }
+    }
+    sLastBuildPool = pool;
+    gGfxPool = &gGfxPools[pool];
+#elif defined(FRAME_INTERPOLATION)
+    // Pool 2 is reserved for the interpolated frame; only 0/1 double buffer.
+    gGfxPool = &gGfxPools[gGlobalTimer % 2];
+#else
     gGfxPool = &gGfxPools[gGlobalTimer % ARRAY_COUNT(gGfxPools)];
+#endif
     set_segment_base_addr(SEGMENT_RENDER, gGfxPool->buffer);
     gGfxSPTask = &gGfxPool->spTask;
     gDisplayListHead = gGfxPool->buffer;
     gGfxPoolEnd = (u8 *) (gGfxPool->buffer + GFX_POOL_SIZE);
+#if PUPPYPRINT_DEBUG
+    // Roll the per-subsystem pool usage over to the display copy.
+    for (s32 i = 0; i < GFX_POOL_TAG_COUNT; i++) {
+        gGfxPoolTagUsageLast[i] = gGfxPoolTagUsage[i];
+        gGfxPoolTagUsage[i] = 0;
+    }
+    gGfxPoolTag = GFX_POOL_TAG_OTHER;
+#endif
+}
+
+#ifdef DEMO_FAST_FORWARD
+/**
+ * Whether the current frame is a headless fast-forward step: a recorded demo
+ * is playing back and this is not one of the periodic presentation frames.
+ * Logic (including the camera, which runs during graph processing) still
+ * executes every frame, so playback stays deterministic.
+ */
+static s32 demo_fast_forward_frame(void) {
+    if (gCurrDemoInput == NULL) {
+        return FALSE;
+    }
+    return (gGlobalTimer % DEMO_FAST_FORWARD_RENDER_INTERVAL) != 0;
 }
+#endif
+
+#ifdef FRAME_INTERPOLATION
+struct FrameInterp gFrameInterp;
+static u8 sInterpTaskReady = FALSE;
+static s8 sInterpFramebuffer = 0;
+
+/**
+ * Build the in-between frame for 60Hz presentation. The 3D scene captured by
+ * render_game is traversed a second time with gIsInterpolationFrame set, so
+ * object and camera transforms land halfway between the previous and current
+ * logic frame. The resulting display list lives in the dedicated third gfx
+ * pool, targets the framebuffer not used by either displayed frame, and ends
+ * by branching into the main frame's 2D overlay commands, which replays the
+ * HUD, text and menus verbatim without re-running their logic.
+ */
+static void frame_interp_build(void) {
+    struct GfxPool *mainPool = gGfxPool;
+    Gfx *mainHead = gDisplayListHead;
+    u8 *mainEnd = gGfxPoolEnd;
+    s8 mainFb = sRenderingFramebuffer;
+
+    if (!gFrameInterp.sceneValid) {
+        return;
+    }
+    gFrameInterp.sceneValid = FALSE;
+
+    // Redirect the display list build at the interpolation pool.
+    gGfxPool = &gGfxPools[2];
+    set_segment_base_addr(SEGMENT_RENDER, gGfxPool->buffer);
+    gGfxSPTask = &gGfxPool->spTask;
+    gDisplayListHead = gGfxPool->buffer;
+    gGfxPoolEnd = (u8 *) (gGfxPool->buffer + GFX_POOL_SIZE);
+
+    // The third framebuffer is free: the previous frame is on screen and the
+    // main frame waits in sRenderingFramebuffer.
+    sInterpFramebuffer = (mainFb + 1) % 3;
+    sRenderingFramebuffer = sInterpFramebuffer;
+    init_rcp(CLEAR_ZBUFFER);
+    sRenderingFramebuffer = mainFb;
+
+    gIsInterpolationFrame = TRUE;
+    geo_process_root(gFrameInterp.sceneRoot, gFrameInterp.viewport, gFrameInterp.clip,
+                     gFrameInterp.clearColor);
+    gIsInterpolationFrame = FALSE;
+
+    // Replay the main frame's overlay; its tail also ends the display list.
+    gSPSegment(gDisplayListHead++, SEGMENT_RENDER, VIRTUAL_TO_PHYSICAL(mainPool->buffer));
+    gSPBranchList(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(gFrameInterp.overlayStart));
+    create_gfx_task_structure();
+    sInterpTaskReady = TRUE;
+
+    // Restore the build globals to the main frame's pool.
+    gGfxPool = mainPool;
+    set_segment_base_addr(SEGMENT_RENDER, mainPool->buffer);
+    gGfxSPTask = &mainPool->spTask;
+    gDisplayListHead = mainHead;
+    gGfxPoolEnd = mainEnd;
+}
+#endif // FRAME_INTERPOLATION
 
 /**
  * This function:
@@ -462,11 +650,51 @@ void select_gfx_pool(void) {
  * - Selects which framebuffer will be rendered and displayed to next time.
  */
 void display_and_vsync(void) {
+#ifdef ADAPTIVE_RESOLUTION
+    static f32 sAppliedYScale = 1.0f;
+
+    if (gResolutionScale != sAppliedYScale) {
+        // The VI stretches the squashed image back to full height.
+        osViSetYScale(gResolutionScale);
+        sAppliedYScale = gResolutionScale;
+    }
+#endif
+#ifdef DEMO_FAST_FORWARD
+    if (demo_fast_forward_frame()) {
+        // Headless step: drop this frame's display list and do not wait for
+        // the VI. The screen keeps showing the last presented frame.
+        gGlobalTimer++;
+        return;
+    }
+#endif
+#ifdef FRAME_INTERPOLATION
+    frame_interp_build();
+#endif
     osRecvMesg(&gGfxVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
     if (gGoddardVblankCallback != NULL) {
         gGoddardVblankCallback();
         gGoddardVblankCallback = NULL;
     }
+#ifdef FRAME_INTERPOLATION
+    if (sInterpTaskReady) {
+        sInterpTaskReady = FALSE;
+        // Show the in-between frame for one vblank, then the real frame takes
+        // the second vblank of the logic interval: 60Hz presentation.
+        exec_display_list(&gGfxPools[2].spTask);
+        osRecvMesg(&gGfxVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
+        osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
+        osViSwapBuffer((void *) PHYSICAL_TO_VIRTUAL(gPhysicalFramebuffers[sInterpFramebuffer]));
+        exec_display_list(&gGfxPool->spTask);
+        osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
+        osViSwapBuffer((void *) PHYSICAL_TO_VIRTUAL(gPhysicalFramebuffers[sRenderedFramebuffer]));
+    } else {
+        // No 3D scene this frame (file select, goddard): vanilla 30Hz cadence.
+        exec_display_list(&gGfxPool->spTask);
+        osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
+        osViSwapBuffer((void *) PHYSICAL_TO_VIRTUAL(gPhysicalFramebuffers[sRenderedFramebuffer]));
+        osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
+    }
+#else
     exec_display_list(&gGfxPool->spTask);
 #ifndef UNLOCK_FPS
     osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
@@ -475,6 +703,7 @@ void display_and_vsync(void) {
 #ifndef UNLOCK_FPS
     osRecvMesg(&gGameVblankQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
 #endif
+#endif // FRAME_INTERPOLATION
     // Skip swapping buffers on inaccurate emulators other than VC so that they display immediately as the Gfx task finishes
     if (gIsConsole || gIsVC || gCacheEmulated) {
         if (++sRenderedFramebuffer == 3) {
@@ -625,12 +854,32 @@ void read_controller_inputs(s32 threadID) {
 
     // If any controllers are plugged in, update the controller information.
     if (gControllerBits) {
+#ifdef INPUT_POLLING_THREAD
+        if (threadID == THREAD_5_GAME_LOOP) {
+            // The poll thread owns the SI; consume its freshest sample, which
+            // is at most one poll interval old.
+            if (gInputSampleCount > 0) {
+                struct InputSample *latest =
+                    &gInputSamples[(gInputSampleCount - 1) % INPUT_POLL_LOG_SIZE];
+                for (i = 0; i < 4; i++) {
+                    gControllerPads[i] = latest->pads[i];
+                }
+            }
+        } else {
+            // The crash screen issues its own SI read.
+            osContGetReadData(&gControllerPads[0]);
+#if ENABLE_RUMBLE
+            release_rumble_pak_control();
+#endif
+        }
+#else
         if (threadID == THREAD_5_GAME_LOOP) {
             osRecvMesg(&gSIEventMesgQueue, &gMainReceivedMesg, OS_MESG_BLOCK);
         }
         osContGetReadData(&gControllerPads[0]);
 #if ENABLE_RUMBLE
         release_rumble_pak_control();
+#endif
 #endif
     }
 #if !defined(DISABLE_DEMO) && defined(KEEP_MARIO_HEAD)
@@ -691,6 +940,9 @@ void init_controllers(void) {
 #endif
 #ifdef SRAM
     gSramProbe = nuPiInitSram();
+#ifdef PROFILER_SRAM_CAPTURE_ACTIVE
+    profiler_sram_capture_load();
+#endif
 #endif
 
     // Loop over the 4 ports and link the controller structs to the appropriate
@@ -714,6 +966,77 @@ void init_controllers(void) {
     }
 }
 
+#ifdef INPUT_POLLING_THREAD
+OSThread gInputPollThread;
+static OSTimer sInputPollTimer;
+static OSMesg sInputPollTimerMesgBuf[1];
+static OSMesgQueue sInputPollTimerMesgQueue;
+
+// Token guarding the SI between the poll thread and EEPROM saves on the game
+// thread, same pattern as the rumble pak scheduler queue. The rumble token
+// itself still covers motor commands, so the poll thread takes both.
+static OSMesg sSIAccessMesgBuf[1];
+static OSMesgQueue sSIAccessMesgQueue;
+
+struct InputSample gInputSamples[INPUT_POLL_LOG_SIZE];
+volatile u32 gInputSampleCount = 0;
+
+void si_access_acquire(void) {
+    OSMesg msg;
+    osRecvMesg(&sSIAccessMesgQueue, &msg, OS_MESG_BLOCK);
+}
+
+void si_access_release(void) {
+    osSendMesg(&sSIAccessMesgQueue, (OSMesg) 0, OS_MESG_NOBLOCK);
+}
+
+/**
+ * Samples the controllers INPUT_POLL_RATE_HZ times per second into the ring
+ * of timestamped samples. The game loop consumes the freshest one each frame,
+ * so a button press waits at most one poll interval instead of up to a whole
+ * game frame before the SI even reads it.
+ */
+static void input_poll_loop(UNUSED void *arg) {
+    OSMesg msg;
+
+    osSetTimer(&sInputPollTimer, 0, OS_USEC_TO_CYCLES(1000000 / INPUT_POLL_RATE_HZ),
+               &sInputPollTimerMesgQueue, (OSMesg) 0);
+
+    while (TRUE) {
+        osRecvMesg(&sInputPollTimerMesgQueue, &msg, OS_MESG_BLOCK);
+
+        if (!gControllerBits) {
+            continue;
+        }
+#if ENABLE_RUMBLE
+        block_until_rumble_pak_free();
+#endif
+        si_access_acquire();
+        osContStartReadData(&gSIEventMesgQueue);
+        osRecvMesg(&gSIEventMesgQueue, &msg, OS_MESG_BLOCK);
+
+        struct InputSample *sample = &gInputSamples[gInputSampleCount % INPUT_POLL_LOG_SIZE];
+        osContGetReadData(sample->pads);
+        si_access_release();
+#if ENABLE_RUMBLE
+        release_rumble_pak_control();
+#endif
+        sample->time = osGetTime();
+        // Publish only after the entry is complete; readers index off the count.
+        gInputSampleCount++;
+    }
+}
+
+void create_input_poll_thread(void) {
+    osCreateMesgQueue(&sInputPollTimerMesgQueue, sInputPollTimerMesgBuf, 1);
+    osCreateMesgQueue(&sSIAccessMesgQueue, sSIAccessMesgBuf, 1);
+    osSendMesg(&sSIAccessMesgQueue, (OSMesg) 0, OS_MESG_NOBLOCK);
+    osCreateThread(&gInputPollThread, THREAD_11_INPUT_POLL, input_poll_loop, NULL,
+                   gInputPollThreadStack + 0x800, /* priority above the game loop */ 25);
+    osStartThread(&gInputPollThread);
+}
+#endif // INPUT_POLLING_THREAD
+
 // Game thread core
 // ----------------------------------------------------------------------------------------------------
 
@@ -732,13 +1055,26 @@ void setup_game_memory(void) {
     gPhysicalFramebuffers[1] = VIRTUAL_TO_PHYSICAL(gFramebuffer1);
     gPhysicalFramebuffers[2] = VIRTUAL_TO_PHYSICAL(gFramebuffer2);
     // Setup Mario Animations
+    MEM_TAG(MEM_TAG_ANIMS);
     gMarioAnimsMemAlloc = main_pool_alloc(MARIO_ANIMS_POOL_SIZE, MEMORY_POOL_LEFT);
     set_segment_base_addr(SEGMENT_MARIO_ANIMS, (void *) gMarioAnimsMemAlloc);
     setup_dma_table_list(&gMarioAnimsBuf, gMarioAnims, gMarioAnimsMemAlloc);
+#ifdef ANIM_COMPRESSION
+    // Compressed animation entries are DMA'd here and decoded into bufTarget.
+    gMarioAnimsBuf.decodeBuf = main_pool_alloc(MARIO_ANIMS_POOL_SIZE, MEMORY_POOL_LEFT);
+#endif
     // Setup Demo Inputs List
     gDemoInputsMemAlloc = main_pool_alloc(DEMO_INPUTS_POOL_SIZE, MEMORY_POOL_LEFT);
     set_segment_base_addr(SEGMENT_DEMO_INPUTS, (void *) gDemoInputsMemAlloc);
     setup_dma_table_list(&gDemoInputsBuf, gDemoInputs, gDemoInputsMemAlloc);
+    MEM_TAG(MEM_TAG_OTHER);
+#if defined(MENU_SEGMENT_CACHE) && !defined(NO_SEGMENTED_MEMORY)
+    // Retain the menu screens' segments so death-retry trips through the act
+    // selector skip the cartridge reads after the first visit.
+    segment_cache_init();
+    segment_cache_retain(_menu_segment_7SegmentRomStart, _menu_segment_7SegmentRomEnd);
+    segment_cache_retain(_behaviorSegmentRomStart, _behaviorSegmentRomEnd);
+#endif
     // Setup Level Script Entry
     load_segment(SEGMENT_LEVEL_ENTRY, _entrySegmentRomStart, _entrySegmentRomEnd, MEMORY_POOL_LEFT, NULL, NULL);
     // Setup Segment 2 (Fonts, Text, etc)
@@ -754,6 +1090,9 @@ void thread5_game_loop(UNUSED void *arg) {
     init_rumble_pak_scheduler_queue();
 #endif
     init_controllers();
+#ifdef INPUT_POLLING_THREAD
+    create_input_poll_thread();
+#endif
 #if ENABLE_RUMBLE
     create_thread_6();
 #endif
@@ -778,13 +1117,20 @@ void thread5_game_loop(UNUSED void *arg) {
     render_init();
 
     while (TRUE) {
+#ifdef ADAPTIVE_RESOLUTION
+        // Sample the RDP counters before the profiler resets them.
+        adaptive_res_update();
+#endif
         profiler_frame_setup();
         // If the reset timer is active, run the process to reset the game.
         if (gResetTimer != 0) {
+            // Make sure no save data is still waiting on the trickle queue.
+            save_file_flush_writes();
             draw_reset_bars();
             continue;
         }
 
+#ifndef INPUT_POLLING_THREAD
         // If any controllers are plugged in, start read the data for when
         // read_controller_inputs is called later.
         if (gControllerBits) {
@@ -793,11 +1139,19 @@ void thread5_game_loop(UNUSED void *arg) {
 #endif
             osContStartReadData(&gSIEventMesgQueue);
         }
+#endif
 
         audio_game_loop_tick();
         select_gfx_pool();
         read_controller_inputs(THREAD_5_GAME_LOOP);
         profiler_update(PROFILER_TIME_CONTROLLERS);
+        // Apply any hot swapped segments before the frame is built.
+        hot_reload_update();
+        debug_commands_update();
+        // Trickle out any save blocks queued by a recent save.
+        save_file_update_queued_writes();
+        // Finish the save file reads deferred by the fast boot path.
+        save_file_update_pending_loads();
         addr = level_script_execute(addr);
 #if !PUPPYPRINT_DEBUG && defined(VISUAL_DEBUG)
         debug_box_input();
@@ -18,6 +18,40 @@ struct GfxPool {
     struct SPTask spTask;
 };
 
+#ifdef FRAME_INTERPOLATION
+/**
+ * What frame_interp_build needs from the frame render_game just built: the
+ * scene root and the arguments it was rendered with, plus where the 2D
+ * overlay's commands start inside the main frame's display list.
+ */
+struct FrameInterp {
+    u8 sceneValid;
+    struct GraphNodeRoot *sceneRoot;
+    Vp *viewport;
+    Vp *clip;
+    s32 clearColor;
+    Gfx *overlayStart;
+};
+
+extern struct FrameInterp gFrameInterp;
+#endif
+
+#ifdef PAUSE_SCENE_FREEZE
+/**
+ * The frozen pause scene: a callable sub-list (ending in G_ENDDL) that
+ * render_game captured on the first paused frame, and the gfx pool it is
+ * parked in. While active, that pool is excluded from pool selection so the
+ * scene survives until the pause ends.
+ */
+struct PauseFreeze {
+    u8 active;
+    s8 pool;
+    Gfx *scene;
+};
+
+extern struct PauseFreeze gPauseFreeze;
+#endif
+
 struct DemoInput {
     u8 timer; // time until next input. if this value is 0, it means the demo is over
     s8 rawStickX;
@@ -33,6 +67,25 @@ enum ZBmodes {
 extern struct Controller gControllers[3];
 extern OSContStatus gControllerStatuses[4];
 extern OSContPad gControllerPads[4];
+
+#ifdef INPUT_POLLING_THREAD
+/**
+ * One controller sample taken by the input poll thread. The newest
+ * INPUT_POLL_LOG_SIZE samples stay in gInputSamples, so input display and
+ * TAS tooling can read sub-frame press timings from the timestamps.
+ */
+struct InputSample {
+    OSTime time;        // osGetTime() right after the SI read completed
+    OSContPad pads[4];
+};
+
+extern struct InputSample gInputSamples[];
+extern volatile u32 gInputSampleCount;
+
+void si_access_acquire(void);
+void si_access_release(void);
+void create_input_poll_thread(void);
+#endif
 extern OSMesgQueue gGameVblankQueue;
 extern OSMesgQueue gGfxVblankQueue;
 extern OSMesg gGameMesgBuf[1];
@@ -86,6 +139,9 @@ void thread5_game_loop(UNUSED void *arg);
 void clear_framebuffer(s32 color);
 void clear_viewport(Vp *viewport, s32 color);
 void make_viewport_clip_rect(Vp *viewport);
+#ifdef ADAPTIVE_RESOLUTION
+void adaptive_res_update(void);
+#endif
 void init_rcp(s32 resetZB);
 void end_master_display_list(void);
 void render_init(void);
@@ -0,0 +1,133 @@
+#include <ultra64.h>
+
+#include "config.h"
+#include "hot_reload.h"
+#include "memory.h"
+#include "segments.h"
+
+#if defined(USB_HOT_RELOAD) && defined(UNF)
+
+#include "usb/debug.h"
+
+// round up to the next multiple of 16
+#define ALIGN16(val) (((val) + 0xF) & ~0xF)
+
+// Reserved pool the uploads land in. Uploads are bump allocated and the
+// allocator wraps when it runs out, invalidating the oldest uploads, so the
+// pool only needs to hold the segments currently being iterated on.
+#define HOT_RELOAD_POOL_SIZE 0x10000
+#define HOT_RELOAD_MAX_PENDING 8
+
+static u8 sHotReloadPool[HOT_RELOAD_POOL_SIZE] __attribute__((aligned(16)));
+static u32 sHotReloadPoolUsed = 0;
+
+// Uploads staged by the USB thread, applied by the game thread.
+struct HotReloadPending {
+    void *addr;
+    u32 size;
+    s16 segment;
+    s16 valid;
+};
+
+static struct HotReloadPending sHotReloadPending[HOT_RELOAD_MAX_PENDING];
+static vs32 sHotReloadPendingCount = 0;
+
+/**
+ * USB thread side of the "segswap <segment> <file>" command. Copies the
+ * uploaded file into the reserved pool and queues it; the actual segment
+ * repoint happens on the game thread at the next frame boundary.
+ */
+static char *hot_reload_command_segswap(void) {
+    char segtext[8];
+    char *p;
+    s32 segment = 0;
+    s32 size;
+    u8 *dest;
+    u32 saved;
+
+    size = debug_sizecommand();
+    if (size == 0 || size > (s32) sizeof(segtext) - 1) {
+        return "Usage: segswap <segment> <file>";
+    }
+    debug_parsecommand(segtext);
+    segtext[size] = '\0';
+
+    for (p = segtext; *p != '\0'; p++) {
+        if (*p < '0' || *p > '9') {
+            return "Segment must be a decimal number";
+        }
+        segment = segment * 10 + (*p - '0');
+    }
+    if (segment <= 0 || segment >= 32) {
+        return "Segment out of range";
+    }
+
+    size = debug_sizecommand();
+    if (size == 0) {
+        return "Missing segment data";
+    }
+    if (size > HOT_RELOAD_POOL_SIZE) {
+        return "Upload larger than the hot reload pool";
+    }
+    if (sHotReloadPendingCount >= HOT_RELOAD_MAX_PENDING) {
+        return "Too many uploads queued this frame";
+    }
+
+    // Wrap the bump allocator when the upload doesn't fit anymore.
+    if (sHotReloadPoolUsed + size > HOT_RELOAD_POOL_SIZE) {
+        sHotReloadPoolUsed = 0;
+    }
+    dest = &sHotReloadPool[sHotReloadPoolUsed];
+    sHotReloadPoolUsed += ALIGN16(size);
+
+    debug_parsecommand(dest);
+    // The RSP may read the swapped data directly, so flush it out of cache.
+    osWritebackDCache(dest, size);
+
+    saved = __osDisableInt();
+    sHotReloadPending[sHotReloadPendingCount].addr = dest;
+    sHotReloadPending[sHotReloadPendingCount].size = size;
+    sHotReloadPending[sHotReloadPendingCount].segment = segment;
+    sHotReloadPending[sHotReloadPendingCount].valid = TRUE;
+    sHotReloadPendingCount++;
+    __osRestoreInt(saved);
+
+    return NULL;
+}
+
+/**
+ * Registers the hot reload commands. Called once UNF itself is up.
+ */
+void hot_reload_init(void) {
+    debug_addcommand("segswap", "Replace a segment's data: segswap <segment> <file>",
+                     hot_reload_command_segswap);
+}
+
+/**
+ * Applies queued uploads at a safe frame boundary, before the level script
+ * runs and a new display list is built. Note that level transitions repoint
+ * segments from ROM again, so uploads must be resent after them.
+ */
+void hot_reload_update(void) {
+    u32 saved;
+    s32 i;
+
+    // Processes any commands sitting in the USB, including segswap uploads.
+    debug_pollcommands();
+
+    if (sHotReloadPendingCount == 0) {
+        return;
+    }
+
+    saved = __osDisableInt();
+    for (i = 0; i < sHotReloadPendingCount; i++) {
+        if (sHotReloadPending[i].valid) {
+            set_segment_base_addr(sHotReloadPending[i].segment, sHotReloadPending[i].addr);
+            sHotReloadPending[i].valid = FALSE;
+        }
+    }
+    sHotReloadPendingCount = 0;
+    __osRestoreInt(saved);
+}
+
+#endif // USB_HOT_RELOAD && UNF
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <ultra64.h>
+#include "config.h"
+
+#if defined(USB_HOT_RELOAD) && defined(UNF)
+
+/**
+ * Development-only hot swapping of segment data over USB. The UNFLoader
+ * "segswap" command uploads a replacement image for a segment into a
+ * reserved pool, and the game thread repoints the segment base address at a
+ * frame boundary, so behavior scripts, macro object tables and actor data
+ * can be tuned without a ROM rebuild and reflash.
+ */
+void hot_reload_init(void);
+void hot_reload_update(void);
+
+#else
+
+#define hot_reload_init()
+#define hot_reload_update()
+
+#endif // USB_HOT_RELOAD && UNF
@@ -119,6 +119,21 @@ s32 sBreathMeterVisibleTimer = 0;
 
 static struct CameraHUD sCameraHUD = { CAM_STATUS_NONE };
 
+#ifdef HUD_RETAINED_DL
+/**
+ * Retained display list for the camera status element. Its glyphs depend only
+ * on sCameraHUD.status, the resolved glyph table and the screen position, so
+ * the texture loads and rectangles are rebuilt only when one of those changes
+ * and replayed with one command otherwise. Two buffers alternate on rebuild so
+ * the copy the RCP may still be reading is never written.
+ */
+static Gfx sCameraHUDGfx[2][20];
+static s16 sCameraHUDCachedStatus[2] = { CAM_STATUS_NONE, CAM_STATUS_NONE };
+static s32 sCameraHUDCachedX[2] = { -1, -1 };
+static Texture **sCameraHUDCachedLUT[2] = { NULL, NULL };
+static s8 sCameraHUDSide = 0;
+#endif
+
 /**
  * Renders a rgba16 16x16 glyph texture from a table list.
  */
@@ -126,8 +141,8 @@ void render_hud_tex_lut(s32 x, s32 y, Texture *texture) {
     gDPPipeSync(gDisplayListHead++);
     gDPSetTextureImage(gDisplayListHead++, G_IM_FMT_RGBA, G_IM_SIZ_16b, 1, texture);
     gSPDisplayList(gDisplayListHead++, &dl_hud_img_load_tex_block);
-    gSPTextureRectangle(gDisplayListHead++, x << 2, y << 2, (x + 15) << 2, (y + 15) << 2,
-                        G_TX_RENDERTILE, 0, 0, 4 << 10, 1 << 10);
+    gSPTextureRectangle(gDisplayListHead++, x << 2, ADAPTIVE_RES_Y(y << 2), (x + 15) << 2, ADAPTIVE_RES_Y((y + 15) << 2),
+                        G_TX_RENDERTILE, 0, 0, 4 << 10, ADAPTIVE_RES_STEP_T(1 << 10));
 }
 
 /**
@@ -144,8 +159,8 @@ void render_hud_small_tex_lut(s32 x, s32 y, Texture *texture) {
     gDPSetTextureImage(gDisplayListHead++, G_IM_FMT_RGBA, G_IM_SIZ_16b, 1, texture);
     gDPLoadSync(gDisplayListHead++);
     gDPLoadBlock(gDisplayListHead++, G_TX_LOADTILE, 0, 0, 8 * 8 - 1, CALC_DXT(8, G_IM_SIZ_16b_BYTES));
-    gSPTextureRectangle(gDisplayListHead++, x << 2, y << 2, (x + 7) << 2, (y + 7) << 2, G_TX_RENDERTILE,
-                        0, 0, 4 << 10, 1 << 10);
+    gSPTextureRectangle(gDisplayListHead++, x << 2, ADAPTIVE_RES_Y(y << 2), (x + 7) << 2, ADAPTIVE_RES_Y((y + 7) << 2), G_TX_RENDERTILE,
+                        0, 0, 4 << 10, ADAPTIVE_RES_STEP_T(1 << 10));
 }
 
 /**
@@ -497,7 +512,20 @@ void render_hud_camera_status(void) {
         return;
     }
 
+#ifdef HUD_RETAINED_DL
+    gSPDisplayList(gDisplayListHead++, dl_hud_img_begin);
+
+    if (sCameraHUDCachedStatus[sCameraHUDSide] != sCameraHUD.status
+        || sCameraHUDCachedX[sCameraHUDSide] != x
+        || sCameraHUDCachedLUT[sCameraHUDSide] != *cameraLUT) {
+        // Rebuild into the copy the RCP can't still be reading.
+        Gfx *savedHead = gDisplayListHead;
+
+        sCameraHUDSide ^= 1;
+        gDisplayListHead = sCameraHUDGfx[sCameraHUDSide];
+#else
     gSPDisplayList(gDisplayListHead++, dl_hud_img_begin);
+#endif
     render_hud_tex_lut(x, y, (*cameraLUT)[GLYPH_CAM_CAMERA]);
 
     switch (sCameraHUD.status & CAM_STATUS_MODE_GROUP) {
@@ -521,6 +549,18 @@ void render_hud_camera_status(void) {
             break;
     }
 
+#ifdef HUD_RETAINED_DL
+        gSPEndDisplayList(gDisplayListHead++);
+        gDisplayListHead = savedHead;
+
+        sCameraHUDCachedStatus[sCameraHUDSide] = sCameraHUD.status;
+        sCameraHUDCachedX[sCameraHUDSide] = x;
+        sCameraHUDCachedLUT[sCameraHUDSide] = *cameraLUT;
+    }
+
+    gSPDisplayList(gDisplayListHead++, sCameraHUDGfx[sCameraHUDSide]);
+#endif
+
     gSPDisplayList(gDisplayListHead++, dl_hud_img_end);
 }
 
@@ -8,6 +8,9 @@
 #include "dialog_ids.h"
 #include "engine/math_util.h"
 #include "eu_translation.h"
+#ifdef GZIP
+#include <gzip.h>
+#endif
 #include "segment_symbols.h"
 #include "game_init.h"
 #include "gfx_dimensions.h"
@@ -273,8 +276,8 @@ void render_generic_char(u8 c) {
 #endif
     gSPDisplayList(gDisplayListHead++, dl_ia_text_tex_settings);
 #ifdef VERSION_EU
-    gSPTextureRectangleFlip(gDisplayListHead++, gDialogX << 2, (gDialogY - 16) << 2,
-                            (gDialogX + 8) << 2, gDialogY << 2, G_TX_RENDERTILE, 8 << 6, 4 << 6, 1 << 10, 1 << 10);
+    gSPTextureRectangleFlip(gDisplayListHead++, gDialogX << 2, ADAPTIVE_RES_Y((gDialogY - 16) << 2),
+                            (gDialogX + 8) << 2, ADAPTIVE_RES_Y(gDialogY << 2), G_TX_RENDERTILE, 8 << 6, 4 << 6, ADAPTIVE_RES_STEP_T(1 << 10), 1 << 10);
 #endif
 }
 #endif
@@ -459,6 +462,183 @@ void print_generic_string(s16 x, s16 y, const u8 *str) {
     gSPPopMatrix(gDisplayListHead++, G_MTX_MODELVIEW);
 }
 
+#if defined(MENU_RETAINED_TEXT) && MULTILANG
+// EU re-unpacks glyph textures into the frame pool every character, so the
+// emitted commands can't outlive the frame.
+#undef MENU_RETAINED_TEXT
+#endif
+
+#ifdef MENU_RETAINED_TEXT
+/*
+ * Retained menu text display lists. Dialog pages and pause menu strings emit
+ * the same commands every frame they are shown, but reference translation
+ * matrices allocated from the frame display list pool. The capture below
+ * copies an emitted span into static storage, relocating (and deduplicating -
+ * character advances repeat) the matrices it references, so the span can be
+ * replayed with a single command on later frames. Buffers are double
+ * buffered by their owners, since the RCP may still be reading last frame's
+ * copy while a new one is captured.
+ */
+#define DIALOG_PAGE_CACHE_CMDS 896
+#define DIALOG_PAGE_CACHE_MTX 96
+#define MENU_STRING_CACHE_SLOTS 4
+#define MENU_STRING_CACHE_CHARS 48
+#define MENU_STRING_CACHE_CMDS 224
+#define MENU_STRING_CACHE_MTX 28
+
+/**
+ * Copies the commands emitted since start into dst, moving the frame pool
+ * matrices they reference into mtxArena so the copy stays valid across
+ * frames. Returns the command count, or -1 if the span or its matrices
+ * don't fit (the caller then leaves the direct emission in place).
+ */
+static s32 menu_text_capture(Gfx *start, Gfx *dst, s32 maxCmds, Mtx *mtxArena, s32 maxMtx) {
+    s32 span = gDisplayListHead - start;
+    s32 mtxCount = 0;
+    s32 i, j, k;
+
+    if (span > maxCmds - 1) {
+        return -1;
+    }
+
+    for (i = 0; i < span; i++) {
+        dst[i] = start[i];
+
+        if (((dst[i].words.w0 >> 24) & 0xFF) == G_MTX) {
+            u32 *src = (u32 *) PHYSICAL_TO_VIRTUAL(dst[i].words.w1);
+            s32 match = -1;
+
+            // menu text uses a few distinct translations (character advances,
+            // line starts), so most matrices dedupe to an earlier copy
+            for (j = 0; j < mtxCount && match < 0; j++) {
+                u32 *cand = (u32 *) &mtxArena[j];
+
+                for (k = 0; k < 16; k++) {
+                    if (cand[k] != src[k]) {
+                        break;
+                    }
+                }
+                if (k == 16) {
+                    match = j;
+                }
+            }
+
+            if (match < 0) {
+                if (mtxCount >= maxMtx) {
+                    return -1;
+                }
+                for (k = 0; k < 16; k++) {
+                    ((u32 *) &mtxArena[mtxCount])[k] = src[k];
+                }
+                match = mtxCount++;
+            }
+
+            dst[i].words.w1 = VIRTUAL_TO_PHYSICAL(&mtxArena[match]);
+        }
+    }
+
+    gSPEndDisplayList(&dst[span]);
+
+    return span;
+}
+
+// Retained copy of the current dialog page (one is shown at a time).
+static Gfx sDialogPageGfx[2][DIALOG_PAGE_CACHE_CMDS];
+static Mtx sDialogPageMtx[2][DIALOG_PAGE_CACHE_MTX];
+static s16 sDialogPageID = DIALOG_NONE;
+static s16 sDialogPageTextPos = -1;
+static s8 sDialogPageBoxType;
+static s32 sDialogPageVariable;
+// outputs of the page walk, restored on replay
+static s16 sDialogPageLastStrPos;
+static s8 sDialogPageLastLineNum;
+static s8 sDialogPageSide = 0;
+static s8 sDialogPageValid = FALSE;
+
+// Retained pause menu strings (course name, act name), evicted least recently used.
+struct CachedMenuString {
+    u8 str[MENU_STRING_CACHE_CHARS];
+    s16 x;
+    s16 y;
+    s8 side;
+    u8 valid;
+    u32 lastUse;
+    Gfx gfx[2][MENU_STRING_CACHE_CMDS];
+    Mtx mtx[2][MENU_STRING_CACHE_MTX];
+};
+static struct CachedMenuString sMenuStringCache[MENU_STRING_CACHE_SLOTS];
+
+/**
+ * print_generic_string through the retained string cache: replays the stored
+ * commands while the string and position are unchanged, rebuilding the least
+ * recently used slot otherwise. Oversized strings render directly.
+ */
+static void print_generic_string_cached(s16 x, s16 y, const u8 *str) {
+    struct CachedMenuString *slot = NULL;
+    Gfx *start;
+    s32 len = 0;
+    s32 i, j;
+    s8 side;
+
+    while (str[len] != DIALOG_CHAR_TERMINATOR && len < MENU_STRING_CACHE_CHARS) {
+        len++;
+    }
+    if (len >= MENU_STRING_CACHE_CHARS) {
+        print_generic_string(x, y, str);
+        return;
+    }
+
+    for (i = 0; i < MENU_STRING_CACHE_SLOTS; i++) {
+        struct CachedMenuString *c = &sMenuStringCache[i];
+
+        if (c->valid && c->x == x && c->y == y) {
+            for (j = 0; j <= len; j++) {
+                if (c->str[j] != str[j]) {
+                    break;
+                }
+            }
+            if (j > len) {
+                c->lastUse = gGlobalTimer;
+                gSPDisplayList(gDisplayListHead++, c->gfx[c->side]);
+                return;
+            }
+        }
+    }
+
+    slot = &sMenuStringCache[0];
+    for (i = 1; i < MENU_STRING_CACHE_SLOTS; i++) {
+        struct CachedMenuString *c = &sMenuStringCache[i];
+
+        if (!c->valid || (slot->valid && c->lastUse < slot->lastUse)) {
+            slot = c;
+        }
+    }
+
+    start = gDisplayListHead;
+    print_generic_string(x, y, str);
+
+    side = slot->side ^ 1;
+    if (menu_text_capture(start, slot->gfx[side], MENU_STRING_CACHE_CMDS,
+                          slot->mtx[side], MENU_STRING_CACHE_MTX) < 0) {
+        slot->valid = FALSE;
+        return;
+    }
+
+    gDisplayListHead = start;
+    gSPDisplayList(gDisplayListHead++, slot->gfx[side]);
+
+    for (j = 0; j <= len; j++) {
+        slot->str[j] = str[j];
+    }
+    slot->x = x;
+    slot->y = y;
+    slot->side = side;
+    slot->valid = TRUE;
+    slot->lastUse = gGlobalTimer;
+}
+#else
+#define print_generic_string_cached print_generic_string
+#endif // MENU_RETAINED_TEXT
 
 /**
  * Prints a hud string depending of the hud table list defined.
@@ -495,8 +675,8 @@ void print_hud_lut_string(s8 hudLUT, s16 x, s16 y, const u8 *str) {
                 }
 
                 gSPDisplayList(gDisplayListHead++, dl_rgba16_load_tex_block);
-                gSPTextureRectangle(gDisplayListHead++, curX << 2, curY << 2, (curX + 16) << 2,
-                                    (curY + 16) << 2, G_TX_RENDERTILE, 0, 0, 1 << 10, 1 << 10);
+                gSPTextureRectangle(gDisplayListHead++, curX << 2, ADAPTIVE_RES_Y(curY << 2), (curX + 16) << 2,
+                                    ADAPTIVE_RES_Y((curY + 16) << 2), G_TX_RENDERTILE, 0, 0, 1 << 10, ADAPTIVE_RES_STEP_T(1 << 10));
 
                 curX += xStride;
         }
@@ -527,15 +707,15 @@ void print_menu_generic_string(s16 x, s16 y, const u8 *str) {
                 gDPSetTextureImage(gDisplayListHead++, G_IM_FMT_IA, G_IM_SIZ_8b, 1, fontLUT[str[strPos]]);
                 gDPLoadSync(gDisplayListHead++);
                 gDPLoadBlock(gDisplayListHead++, G_TX_LOADTILE, 0, 0, 8 * 8 - 1, CALC_DXT(8, G_IM_SIZ_8b_BYTES));
-                gSPTextureRectangle(gDisplayListHead++, curX << 2, curY << 2, (curX + 8) << 2,
-                                    (curY + 8) << 2, G_TX_RENDERTILE, 0, 0, 1 << 10, 1 << 10);
+                gSPTextureRectangle(gDisplayListHead++, curX << 2, ADAPTIVE_RES_Y(curY << 2), (curX + 8) << 2,
+                                    ADAPTIVE_RES_Y((curY + 8) << 2), G_TX_RENDERTILE, 0, 0, 1 << 10, ADAPTIVE_RES_STEP_T(1 << 10));
 
                 if (mark != DIALOG_MARK_NONE) {
                     gDPSetTextureImage(gDisplayListHead++, G_IM_FMT_IA, G_IM_SIZ_8b, 1, fontLUT[DIALOG_CHAR_MARK_START + mark]);
                     gDPLoadSync(gDisplayListHead++);
                     gDPLoadBlock(gDisplayListHead++, G_TX_LOADTILE, 0, 0, 8 * 8 - 1, CALC_DXT(8, G_IM_SIZ_8b_BYTES));
-                    gSPTextureRectangle(gDisplayListHead++, (curX + 6) << 2, (curY - 7) << 2,
-                                        (curX + 6 + 8) << 2, (curY - 7 + 8) << 2, G_TX_RENDERTILE, 0, 0, 1 << 10, 1 << 10);
+                    gSPTextureRectangle(gDisplayListHead++, (curX + 6) << 2, ADAPTIVE_RES_Y((curY - 7) << 2),
+                                        (curX + 6 + 8) << 2, ADAPTIVE_RES_Y((curY - 7 + 8) << 2), G_TX_RENDERTILE, 0, 0, 1 << 10, ADAPTIVE_RES_STEP_T(1 << 10));
 
                     mark = DIALOG_MARK_NONE;
                 }
@@ -568,8 +748,8 @@ void print_credits_string(s16 x, s16 y, const u8 *str) {
                 gDPSetTextureImage(gDisplayListHead++, G_IM_FMT_RGBA, G_IM_SIZ_16b, 1, fontLUT[str[strPos]]);
                 gDPLoadSync(gDisplayListHead++);
                 gDPLoadBlock(gDisplayListHead++, G_TX_LOADTILE, 0, 0, 8 * 8 - 1, CALC_DXT(8, G_IM_SIZ_16b_BYTES));
-                gSPTextureRectangle(gDisplayListHead++, curX << 2, curY << 2, (curX + 8) << 2,
-                                    (curY + 8) << 2, G_TX_RENDERTILE, 0, 0, 1 << 10, 1 << 10);
+                gSPTextureRectangle(gDisplayListHead++, curX << 2, ADAPTIVE_RES_Y(curY << 2), (curX + 8) << 2,
+                                    ADAPTIVE_RES_Y((curY + 8) << 2), G_TX_RENDERTILE, 0, 0, 1 << 10, ADAPTIVE_RES_STEP_T(1 << 10));
                 curX += 7;
                 break;
         }
@@ -873,13 +1053,84 @@ u32 ensure_nonnegative(s16 value) {
     return ((value < 0) ? 0 : value);
 }
 
+#ifdef GZIP
+/**
+ * Dialog text inflation cache. In gzip builds, tools/compress_dialogs.py stores
+ * each dialog's text as a raw deflate stream behind an 8 byte header, cutting
+ * the resident size of the dialog tables by roughly half. Entries are inflated
+ * on demand into one of these slots when a box opens and stick around until
+ * evicted, so reopening the same sign costs nothing. Entries the tool left raw
+ * (ones that didn't shrink) are detected by the header magic and passed through
+ * untouched.
+ */
+#define DIALOG_GZIP_CACHE_SLOTS 2
+// Largest inflated dialog the cache can hold. Keep in sync with MAX_RAW in
+// tools/compress_dialogs.py, which leaves bigger entries uncompressed.
+#define DIALOG_GZIP_BUFFER_SIZE 2048
+
+// Starts with 0xFF (the dialog terminator), which real text never leads with.
+// Keep in sync with MAGIC in tools/compress_dialogs.py.
+static const u8 sDialogGzipMagic[4] = { 0xFF, 0x67, 0x7A, 0x01 };
+
+struct DialogTextCacheSlot {
+    s16 dialogID;
+    u32 stamp; // Last use; 0 means the slot is empty.
+    u8 text[DIALOG_GZIP_BUFFER_SIZE];
+};
+
+static struct DialogTextCacheSlot sDialogTextCache[DIALOG_GZIP_CACHE_SLOTS];
+static u32 sDialogTextCacheStamp = 0;
+
+/**
+ * Return the inflated text of `dialog`, inflating it into the least recently
+ * used cache slot on a miss. Raw (uncompressed) entries are returned directly.
+ */
+static u8 *dialog_get_text(s16 dialogID, struct DialogEntry *dialog) {
+    u8 *raw = segmented_to_virtual(dialog->str);
+    struct DialogTextCacheSlot *slot = &sDialogTextCache[0];
+    u32 rawLen;
+    u32 compLen;
+    s32 i;
+
+    if (raw[0] != sDialogGzipMagic[0] || raw[1] != sDialogGzipMagic[1]
+     || raw[2] != sDialogGzipMagic[2] || raw[3] != sDialogGzipMagic[3]) {
+        return raw;
+    }
+
+    for (i = 0; i < DIALOG_GZIP_CACHE_SLOTS; i++) {
+        if (sDialogTextCache[i].stamp != 0 && sDialogTextCache[i].dialogID == dialogID) {
+            sDialogTextCache[i].stamp = ++sDialogTextCacheStamp;
+            return sDialogTextCache[i].text;
+        }
+        if (sDialogTextCache[i].stamp < slot->stamp) {
+            slot = &sDialogTextCache[i];
+        }
+    }
+
+    rawLen  = ((u32) raw[4] << 8) | raw[5];
+    compLen = ((u32) raw[6] << 8) | raw[7];
+    if (rawLen > DIALOG_GZIP_BUFFER_SIZE
+        || expand_gzip(raw + 8, slot->text, compLen, sizeof(slot->text)) != rawLen) {
+        // Corrupt entry; show an empty box rather than garbage.
+        slot->text[0] = 0xFF;
+    }
+    slot->dialogID = dialogID;
+    slot->stamp = ++sDialogTextCacheStamp;
+    return slot->text;
+}
+#endif // GZIP
+
 void handle_dialog_text_and_pages(s8 colorMode, struct DialogEntry *dialog, s8 lowerBound) {
     u8 strChar;
     s16 colorLoop;
     ColorRGBA rgbaColors = { 0x00, 0x00, 0x00, 0x00 };
     u8 customColor = 0;
     u8 diffTmp = 0;
+#ifdef GZIP
+    u8 *str = dialog_get_text(gDialogID, dialog);
+#else
     u8 *str = segmented_to_virtual(dialog->str);
+#endif
     s8 lineNum = 1;
     s8 totalLines;
     s8 pageState = DIALOG_PAGE_STATE_NONE;
@@ -1228,19 +1479,62 @@ void render_dialog_entries(void) {
 #else
                   ensure_nonnegative(dialog->leftOffset),
 #endif
-                  ensure_nonnegative(DIAG_VAL2 - dialog->width),
+                  ADAPTIVE_RES_Y(ensure_nonnegative(DIAG_VAL2 - dialog->width)),
 #ifdef WIDESCREEN
                   SCREEN_WIDTH,
 #else
                   ensure_nonnegative(DIAG_VAL3 + dialog->leftOffset),
 #endif
-                  ensure_nonnegative(240 + ((dialog->linesPerBox * 80) / DIAG_VAL4) - dialog->width));
+                  ADAPTIVE_RES_Y(ensure_nonnegative(240 + ((dialog->linesPerBox * 80) / DIAG_VAL4) - dialog->width)));
+
+#ifdef MENU_RETAINED_TEXT
+    // The page's commands are identical every frame it sits still (the box
+    // open/close rotation and scroll translation are applied outside them),
+    // so replay the retained copy and only rebuild when the page changes.
+    // The scroll state shifts the visible line window every frame and is
+    // rendered directly.
+    if (gDialogBoxState == DIALOG_STATE_VERTICAL && sDialogPageValid
+        && sDialogPageID == gDialogID && sDialogPageTextPos == gDialogTextPos
+        && sDialogPageBoxType == gDialogBoxType && sDialogPageVariable == gDialogVariable) {
+        gSPDisplayList(gDisplayListHead++, sDialogPageGfx[sDialogPageSide]);
+        // the page walk also decides these, so restore them from the build
+        gLastDialogPageStrPos = sDialogPageLastStrPos;
+        gLastDialogLineNum = sDialogPageLastLineNum;
+    } else {
+        Gfx *start = gDisplayListHead;
+
+        handle_dialog_text_and_pages(0, dialog, lowerBound);
+
+        if (gDialogBoxState == DIALOG_STATE_VERTICAL) {
+            s8 side = sDialogPageSide ^ 1;
+
+            if (menu_text_capture(start, sDialogPageGfx[side], DIALOG_PAGE_CACHE_CMDS,
+                                  sDialogPageMtx[side], DIALOG_PAGE_CACHE_MTX) >= 0) {
+                gDisplayListHead = start;
+                gSPDisplayList(gDisplayListHead++, sDialogPageGfx[side]);
+                sDialogPageSide = side;
+                sDialogPageID = gDialogID;
+                sDialogPageTextPos = gDialogTextPos;
+                sDialogPageBoxType = gDialogBoxType;
+                sDialogPageVariable = gDialogVariable;
+                sDialogPageLastStrPos = gLastDialogPageStrPos;
+                sDialogPageLastLineNum = gLastDialogLineNum;
+                sDialogPageValid = TRUE;
+            } else {
+                sDialogPageValid = FALSE;
+            }
+        } else {
+            sDialogPageValid = FALSE;
+        }
+    }
+#else
     handle_dialog_text_and_pages(0, dialog, lowerBound);
+#endif
 
     if (gLastDialogPageStrPos == -1 && gLastDialogResponse == 1) {
         render_dialog_triangle_choice();
     }
-    gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 2, 2, SCREEN_WIDTH - gBorderHeight / 2, SCREEN_HEIGHT - gBorderHeight / 2);
+    gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 2, 2, SCREEN_WIDTH - gBorderHeight / 2, ADAPTIVE_RES_Y(SCREEN_HEIGHT - gBorderHeight / 2));
     if (gLastDialogPageStrPos != -1 && gDialogBoxState == DIALOG_STATE_VERTICAL) {
         render_dialog_triangle_next(dialog->linesPerBox);
     }
@@ -1272,7 +1566,12 @@ void dl_rgba16_stop_cutscene_msg_fade(void) {
     }
 }
 
-u32 ascii_to_credits_char(u8 c) {
+#ifdef TEXT_GLYPH_LUT
+static u8 sCreditsCharLut[128];
+static u8 sCreditsCharLutBuilt = FALSE;
+#endif
+
+static u32 ascii_to_credits_char_classify(u8 c) {
     if (c >= 'A' && c <= 'Z') return (c - ('A' - 0xA));
     if (c >= 'a' && c <= 'z') return (c - ('a' - 0xA)); // remap lower to upper case
     if (c == ' ') return GLOBAL_CHAR_SPACE;
@@ -1284,6 +1583,21 @@ u32 ascii_to_credits_char(u8 c) {
     return GLOBAL_CHAR_SPACE;
 }
 
+u32 ascii_to_credits_char(u8 c) {
+#ifdef TEXT_GLYPH_LUT
+    if (!sCreditsCharLutBuilt) {
+        s32 i;
+        for (i = 0; i < 128; i++) {
+            sCreditsCharLut[i] = ascii_to_credits_char_classify(i);
+        }
+        sCreditsCharLutBuilt = TRUE;
+    }
+    return sCreditsCharLut[c & 0x7F];
+#else
+    return ascii_to_credits_char_classify(c);
+#endif
+}
+
 void print_credits_str_ascii(s16 x, s16 y, const char *str) {
     s32 pos = 0;
     u8 c = str[pos];
@@ -1376,7 +1690,11 @@ void print_peach_letter_message(void) {
     void **dialogTable = segmented_to_virtual(seg2_dialog_table);
 #endif
     struct DialogEntry *dialog = segmented_to_virtual(dialogTable[gDialogID]);
+#ifdef GZIP
+    u8 *str = dialog_get_text(gDialogID, dialog);
+#else
     u8 *str = segmented_to_virtual(dialog->str);
+#endif
 
     create_dl_translation_matrix(MENU_MTX_PUSH, 97.0f, 118.0f, 0);
 
@@ -1615,10 +1933,10 @@ void render_pause_my_score_coins(void) {
             print_generic_string(TXT_STAR_X, 140, textUnfilledStar);
         }
 
-        print_generic_string(ACT_NAME_X, 140, actName);
-        print_generic_string(LVL_NAME_X, 157, &courseName[3]);
+        print_generic_string_cached(ACT_NAME_X, 140, actName);
+        print_generic_string_cached(LVL_NAME_X, 157, &courseName[3]);
     } else {
-        print_generic_string(SECRET_LVL_NAME_X, 157, &courseName[3]);
+        print_generic_string_cached(SECRET_LVL_NAME_X, 157, &courseName[3]);
     }
 
     gSPDisplayList(gDisplayListHead++, dl_ia_text_end);
@@ -1838,7 +2156,7 @@ void render_pause_castle_main_strings(s16 x, s16 y) {
         print_generic_string(x + 60, y + 13, strVal);
     }
 
-    print_generic_string(x - 9, y + 30, courseName);
+    print_generic_string_cached(x - 9, y + 30, courseName);
 
     gSPDisplayList(gDisplayListHead++, dl_ia_text_end);
 }
@@ -94,6 +94,29 @@ char registerMaps[][4] = {
     "$GP", "$SP", "$FP", "$RA",
 };
 
+#ifdef CRASH_SCREEN_DISASM_LUT
+// Template index by opcode / SPECIAL function; 0xFF = no template.
+#define INSN_LUT_NONE 0xFF
+static u8 insn_opcode_lut[64];
+static u8 insn_funct_lut[64];
+static u8 insn_luts_built = FALSE;
+
+static void build_insn_luts(void) {
+    for (int i = 0; i < 64; i++) {
+        insn_opcode_lut[i] = INSN_LUT_NONE;
+        insn_funct_lut[i] = INSN_LUT_NONE;
+    }
+    for (int i = 0; i < ARRAY_COUNT(insn_db); i++) {
+        if (insn_db[i].opcode != 0) {
+            insn_opcode_lut[insn_db[i].opcode] = i;
+        } else {
+            insn_funct_lut[insn_db[i].function] = i;
+        }
+    }
+    insn_luts_built = TRUE;
+}
+#endif
+
 char *insn_disasm(InsnData insn, u32 isPC) {
     char *strp = &insn_as_string[0];
     int successful_print = 0;
@@ -109,6 +132,61 @@ char *insn_disasm(InsnData insn, u32 isPC) {
 
     for (int i = 0; i < ARRAY_COUNT(insn_as_string); i++) insn_as_string[i] = 0;
 
+#ifdef CRASH_SCREEN_DISASM_LUT
+    if (!insn_luts_built) {
+        build_insn_luts();
+    }
+
+    if (insn.i.opcode != 0) {
+        u8 i = insn_opcode_lut[insn.i.opcode];
+
+        if (i != INSN_LUT_NONE) {
+            switch (insn_db[i].arbitraryParam) {
+                case PARAM_SWAP_RS_IMM:
+                    strp += sprintf(strp, "%-8s %s %s  %04X", insn_db[i].name,
+                                               registerMaps[insn.i.rt],
+                                               registerMaps[insn.i.rs],
+                                               insn.i.immediate
+                    ); break;
+                case PARAM_LUI:
+                    strp += sprintf(strp, "%-8s %s %04X", insn_db[i].name,
+                                               registerMaps[insn.i.rt],
+                                               insn.i.immediate
+                    ); break;
+                case PARAM_JAL:
+                    target = 0x80000000 | ((insn.d & 0x1FFFFFF) * 4);
+                    if ((u32)parse_map != MAP_PARSER_ADDRESS) {
+                        strp += sprintf(strp, "%-8s %s", insn_db[i].name,
+                                                         parse_map(target)
+                        );
+                    } else {
+                        strp += sprintf(strp, "%-8s %08X", insn_db[i].name,
+                                                           target
+                        );
+                    }
+                    break;
+                case PARAM_NONE:
+                    strp += sprintf(strp, "%-8s %s %04X (%s)", insn_db[i].name,
+                                                   registerMaps[insn.i.rt],
+                                                   insn.i.immediate,
+                                                   registerMaps[insn.i.rs]
+                    ); break;
+            }
+            successful_print = 1;
+        }
+    } else if (insn.i.rdata.function != 0) {
+        u8 i = insn_funct_lut[insn.i.rdata.function];
+
+        if (i != INSN_LUT_NONE) {
+            strp += sprintf(strp, "%-8s %s %s %s", insn_db[i].name,
+                                               registerMaps[insn.i.rdata.rd],
+                                               registerMaps[insn.i.rs],
+                                               registerMaps[insn.i.rt]
+            );
+            successful_print = 1;
+        }
+    }
+#else
     for (int i = 0; i < ARRAY_COUNT(insn_db); i++) {
         if (insn.i.opcode != 0 && insn.i.opcode == insn_db[i].opcode) {
             switch (insn_db[i].arbitraryParam) {
@@ -156,6 +234,7 @@ char *insn_disasm(InsnData insn, u32 isPC) {
                 break;
         }
     }
+#endif // CRASH_SCREEN_DISASM_LUT
     if (successful_print == 0) {
         strp += sprintf(strp, "unimpl %08X", insn.d);
     }
@@ -96,6 +96,85 @@ static struct InteractionHandler sInteractionHandlers[] = {
     { INTERACT_TEXT,           interact_text },
 };
 
+#ifdef INTERACTION_CONTACT_CACHE
+// Persistent Mario<->object contact pairs, tracked across frames so handlers
+// that only matter on first contact ("enter") are skipped while an overlap is
+// sustained. An entry whose seenFrame is continuous with this frame is a
+// "stay" contact; a gap (or eviction) makes the next overlap an "enter" again.
+#define INTERACTION_CONTACT_ENTRIES 16
+
+// Types safe to skip during sustained overlap. These handlers either always
+// consume the object on first touch (coins, caps) or gate on Mario's action
+// and inputs (doors, warps, cannon, text) - so a stay contact is only skipped
+// while his action is unchanged and no new button was pressed, which is
+// exactly when re-evaluating them cannot produce a different answer.
+#define INTERACT_ENTER_ONLY_TYPES                                          \
+    (INTERACT_COIN | INTERACT_WATER_RING | INTERACT_STAR_OR_KEY            \
+   | INTERACT_BBH_ENTRANCE | INTERACT_WARP | INTERACT_WARP_DOOR            \
+   | INTERACT_DOOR | INTERACT_CANNON_BASE | INTERACT_CAP | INTERACT_TEXT)
+
+struct InteractionContact {
+    struct Object *obj;
+#ifdef OBJECT_POOL_BITMAP
+    u32 generation;
+#endif
+    u32 action;    // Mario's action when the handler last evaluated this contact.
+    u32 seenFrame;
+};
+
+static struct InteractionContact sInteractionContacts[INTERACTION_CONTACT_ENTRIES];
+
+/**
+ * Update the contact table for a colliding object and decide whether its
+ * handler can be skipped this frame. Evicts the stalest entry when a new
+ * contact needs a slot; a stolen slot just re-enters that contact later.
+ */
+static s32 interaction_contact_should_skip(struct MarioState *m, u32 interactType, struct Object *obj) {
+    struct InteractionContact *entry = NULL;
+    struct InteractionContact *oldest = &sInteractionContacts[0];
+    s32 isStay;
+    s32 i;
+
+    for (i = 0; i < INTERACTION_CONTACT_ENTRIES; i++) {
+        if (sInteractionContacts[i].obj == obj
+#ifdef OBJECT_POOL_BITMAP
+         && sInteractionContacts[i].generation == obj->generation
+#endif
+        ) {
+            entry = &sInteractionContacts[i];
+            break;
+        }
+        if (sInteractionContacts[i].seenFrame < oldest->seenFrame) {
+            oldest = &sInteractionContacts[i];
+        }
+    }
+
+    if (entry == NULL) {
+        // Enter: first contact with this object, always evaluate.
+        entry = oldest;
+        entry->obj = obj;
+#ifdef OBJECT_POOL_BITMAP
+        entry->generation = obj->generation;
+#endif
+        entry->action = m->action;
+        entry->seenFrame = gGlobalTimer;
+        return FALSE;
+    }
+
+    isStay = (entry->seenFrame + 1 == gGlobalTimer);
+    entry->seenFrame = gGlobalTimer;
+
+    if (isStay && (interactType & INTERACT_ENTER_ONLY_TYPES)
+     && (m->action == entry->action)
+     && (m->controller->buttonPressed == 0)) {
+        return TRUE;
+    }
+
+    entry->action = m->action;
+    return FALSE;
+}
+#endif
+
 static u32 sForwardKnockbackActions[][3] = {
 //    Soft                        Normal                 Hard
     { ACT_SOFT_FORWARD_GROUND_KB, ACT_FORWARD_GROUND_KB, ACT_HARD_FORWARD_GROUND_KB }, // Ground
@@ -750,6 +829,33 @@ u32 interact_coin(struct MarioState *m, UNUSED u32 interactType, struct Object *
     return FALSE;
 }
 
+#ifdef MICRO_COIN_POOL
+/**
+ * Award a coin collected from the micro coin pool. Mirrors interact_coin
+ * minus the object plumbing: micro coins have no interaction status, so the
+ * pool reports the coin's value directly.
+ */
+void micro_coin_interact(struct MarioState *m, s32 value) {
+    m->numCoins += value;
+    m->healCounter += 4 * value;
+#ifdef BREATH_METER
+    m->breathCounter += (4 * value);
+#endif
+
+#ifdef X_COIN_STAR
+    if (COURSE_IS_MAIN_COURSE(gCurrCourseNum) && m->numCoins - value < X_COIN_STAR
+        && m->numCoins >= X_COIN_STAR) {
+        bhv_spawn_star_no_level_exit(STAR_BP_ACT_100_COINS);
+    }
+#endif
+#if ENABLE_RUMBLE
+    if (value >= 2) {
+        queue_rumble_data(5, 80);
+    }
+#endif
+}
+#endif
+
 u32 interact_water_ring(struct MarioState *m, UNUSED u32 interactType, struct Object *obj) {
 #ifdef BREATH_METER
     m->breathCounter += 4 * obj->oDamageOrCoinValue;
@@ -1821,7 +1927,11 @@ void mario_process_interactions(struct MarioState *m) {
 
                 m->collidedObjInteractTypes &= ~interactType;
 
-                if (!(object->oInteractStatus & INT_STATUS_INTERACTED)) {
+                if (!(object->oInteractStatus & INT_STATUS_INTERACTED)
+#ifdef INTERACTION_CONTACT_CACHE
+                 && !interaction_contact_should_skip(m, interactType, object)
+#endif
+                ) {
                     if (sInteractionHandlers[i].handler(m, interactType, object)) {
                         break;
                     }
@@ -135,6 +135,9 @@ void mario_blow_off_cap(struct MarioState *m, f32 capSpeed);
 u32  mario_lose_cap_to_enemy(u32 enemyType);
 void mario_retrieve_cap(void);
 struct Object *mario_get_collided_object(struct MarioState *m, u32 interactType);
+#ifdef MICRO_COIN_POOL
+void micro_coin_interact(struct MarioState *m, s32 value);
+#endif
 u32  mario_check_object_grab(struct MarioState *m);
 u32  get_door_save_file_flag(struct Object *door);
 void mario_process_interactions(struct MarioState *m);
@@ -6,6 +6,7 @@
 #include "skybox.h"
 #include "engine/math_util.h"
 #include "camera.h"
+#include "memory.h"
 #include "envfx_snow.h"
 #include "level_geo.h"
 
@@ -13,6 +14,11 @@
  * Geo function that generates a displaylist for environment effects such as
  * snow or jet stream bubbles.
  */
+#ifdef FRAME_INTERPOLATION
+// Particle list generated this logic frame, replayed on the in-between frame.
+static void *sEnvfxLastParticles = NULL;
+#endif
+
 Gfx *geo_envfx_main(s32 callContext, struct GraphNode *node, Mat4 mtxf) {
     Vec3s marioPos;
     Vec3s camFrom;
@@ -31,7 +37,11 @@ Gfx *geo_envfx_main(s32 callContext, struct GraphNode *node, Mat4 mtxf) {
             vec3f_to_vec3s(camTo, gCurGraphNodeCamera->focus);
             vec3f_to_vec3s(camFrom, gCurGraphNodeCamera->pos);
             vec3f_to_vec3s(marioPos, gPlayerCameraState->pos);
+            GFX_POOL_TAG(GFX_POOL_TAG_EFFECTS);
             particleList = envfx_update_particles(snowMode, marioPos, camTo, camFrom);
+#ifdef FRAME_INTERPOLATION
+            sEnvfxLastParticles = particleList;
+#endif
             if (particleList != NULL) {
                 Mtx *mtx = alloc_display_list(sizeof(*mtx));
 
@@ -41,9 +51,25 @@ Gfx *geo_envfx_main(s32 callContext, struct GraphNode *node, Mat4 mtxf) {
                 gSPBranchList(&gfx[1], VIRTUAL_TO_PHYSICAL(particleList));
                 SET_GRAPH_NODE_LAYER(execNode->fnNode.node.flags, LAYER_OCCLUDE_SILHOUETTE_ALPHA);
             }
+            GFX_POOL_TAG(GFX_POOL_TAG_GRAPH);
             SET_HIGH_U16_OF_32(*params, gAreaUpdateCounter);
         }
+#ifdef FRAME_INTERPOLATION
+        else if (gIsInterpolationFrame && sEnvfxLastParticles != NULL) {
+            // Replay this frame's particles under the interpolated view; the
+            // vertices are in world space, only the matrix differs.
+            Mtx *mtx = alloc_display_list(sizeof(*mtx));
+
+            gfx = alloc_display_list(2 * sizeof(*gfx));
+            mtxf_to_mtx(mtx, mtxf);
+            gSPMatrix(&gfx[0], VIRTUAL_TO_PHYSICAL(mtx), G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH);
+            gSPBranchList(&gfx[1], VIRTUAL_TO_PHYSICAL(sEnvfxLastParticles));
+        }
+#endif
     } else if (callContext == GEO_CONTEXT_AREA_INIT) {
+#ifdef FRAME_INTERPOLATION
+        sEnvfxLastParticles = NULL;
+#endif
         // Give these arguments some dummy values. Not used in ENVFX_MODE_NONE
         vec3s_copy(camTo, gVec3sZero);
         vec3s_copy(camFrom, gVec3sZero);
@@ -69,7 +95,18 @@ Gfx *geo_skybox_main(s32 callContext, struct GraphNode *node, UNUSED Mat4 *mtx)
         struct GraphNodeCamera *camNode = (struct GraphNodeCamera *) gCurGraphNodeRoot->views[0];
         struct GraphNodePerspective *camFrustum =
             (struct GraphNodePerspective *) camNode->fnNode.node.parent;
+#ifdef FRAME_INTERPOLATION
+        // Keep the skybox in step with the interpolated eye so it doesn't
+        // judder against the world on in-between frames.
+        if (gIsInterpolationFrame) {
+            gfx = create_skybox_facing_camera(0, backgroundNode->background, camFrustum->fov,
+                                              gInterpCamPos, gInterpCamFocus);
+        } else {
+            gfx = create_skybox_facing_camera(0, backgroundNode->background, camFrustum->fov, gLakituState.pos, gLakituState.focus);
+        }
+#else
         gfx = create_skybox_facing_camera(0, backgroundNode->background, camFrustum->fov, gLakituState.pos, gLakituState.focus);
+#endif
 #endif
     }
 
@@ -30,6 +30,7 @@
 #include "puppycam2.h"
 #include "puppyprint.h"
 #include "puppylights.h"
+#include "ambient_sound_zones.h"
 #include "level_commands.h"
 
 #include "config.h"
@@ -141,6 +142,10 @@ s16 sSourceWarpNodeId;
 s32 sDelayedWarpArg;
 s8 sTimerRunning;
 s8 gNeverEnteredCastle;
+#ifdef LEVEL_SNAPSHOT_RESTART
+// Set when a death warp should restore the level snapshot before reloading.
+static s8 sSnapshotRetryQueued = FALSE;
+#endif
 
 struct MarioState *gMarioState = &gMarioStates[0];
 s8 sWarpCheckpointActive = FALSE;
@@ -367,6 +372,9 @@ void init_mario_after_warp(void) {
     reset_camera(gCurrentArea->camera);
     sWarpDest.type = WARP_TYPE_NOT_WARPING;
     sDelayedWarpOp = WARP_OP_NONE;
+#ifdef LEVEL_SNAPSHOT_RESTART
+    sSnapshotRetryQueued = FALSE;
+#endif
 
     switch (marioSpawnType) {
         case MARIO_SPAWN_PIPE:
@@ -427,6 +435,20 @@ void init_mario_after_warp(void) {
 // used for warps inside one level
 void warp_area(void) {
     if (sWarpDest.type != WARP_TYPE_NOT_WARPING) {
+#ifdef LEVEL_SNAPSHOT_RESTART
+        if (sSnapshotRetryQueued) {
+            sSnapshotRetryQueued = FALSE;
+            if (level_snapshot_restore()) {
+                // Fully unload the area so the reload below respawns coins and
+                // enemies from the restored spawn data, like a fresh entry.
+                unload_mario_area();
+                unload_area();
+                sWarpDest.type = WARP_TYPE_CHANGE_AREA;
+                gMarioState->numCoins = 0;
+                gHudDisplay.coins = 0;
+            }
+        }
+#endif
         if (sWarpDest.type == WARP_TYPE_CHANGE_AREA) {
             level_control_timer(TIMER_CONTROL_HIDE);
             unload_mario_area();
@@ -447,7 +469,7 @@ void warp_level(void) {
     init_mario_after_warp();
 }
 
-void warp_credits(void) {
+COLD void warp_credits(void) {
     s32 marioAction = ACT_UNINITIALIZED;
 
     switch (sWarpDest.nodeId) {
@@ -618,6 +640,12 @@ void initiate_warp(s16 destLevel, s16 destArea, s16 destWarpNode, s32 warpFlags)
         levelAmbient = FALSE;
     }
 #endif
+#ifdef AMBIENT_SOUND_ZONES
+    if (sWarpDest.type == WARP_TYPE_CHANGE_LEVEL)
+    {
+        gAmbientZoneCount = 0;
+    }
+#endif
 }
 
 // From Surface 0xD3 to 0xFC
@@ -735,6 +763,11 @@ s16 level_trigger_warp(struct MarioState *m, s32 warpOp) {
                 play_sound(SOUND_MENU_BOWSER_LAUGH, gGlobalSoundSource);
 #ifdef PREVENT_DEATH_LOOP
                 m->isDead = TRUE;
+#endif
+#ifdef LEVEL_SNAPSHOT_RESTART
+                if (sDelayedWarpOp == WARP_OP_DEATH) {
+                    sSnapshotRetryQueued = TRUE;
+                }
 #endif
                 break;
 
@@ -963,6 +996,9 @@ void basic_update(void) {
 #ifdef PUPPYLIGHTS
     delete_lights();
 #endif
+#ifdef AMBIENT_SOUND_ZONES
+    ambient_sound_zones_update();
+#endif
 
     if (gCurrentArea != NULL) {
         update_camera(gCurrentArea->camera);
@@ -994,6 +1030,9 @@ s32 play_mode_normal(void) {
 #ifdef PUPPYLIGHTS
     delete_lights();
 #endif
+#ifdef AMBIENT_SOUND_ZONES
+    ambient_sound_zones_update();
+#endif
 
     if (gCurrentArea != NULL) {
         update_camera(gCurrentArea->camera);
@@ -1,9 +1,12 @@
 #include <PR/ultratypes.h>
 
 #include "sm64.h"
+#include "engine/math_util.h"
 #include "object_helpers.h"
 #include "macro_special_objects.h"
+#include "memory.h"
 #include "object_list_processor.h"
+#include "spawn_object.h"
 
 #include "behavior_data.h"
 
@@ -83,15 +86,301 @@ struct LoadedMacroObject {
     /*0x08*/ s16 params;
 };
 
+#ifdef MACRO_PLACEMENT_TABLE
+
+// The current area's resolved placement table; rebuilt by spawn_macro_objects
+// on every area load. Lives in the level pool, so it is freed with the area.
+static struct MacroPlacement *sMacroPlacements = NULL;
+static s32 sMacroPlacementCount = 0;
+
+/**
+ * Resolve a packed macro list into a placement table: one preset lookup, yaw
+ * conversion and param merge per entry, done once per area load. On allocation
+ * failure the table stays empty and callers decode the packed list directly.
+ */
+static void macro_placement_build(MacroObject *macroObjList) {
+    MacroObject *entry = macroObjList;
+    s32 count = 0;
+    s32 i;
+
+    sMacroPlacements = NULL;
+    sMacroPlacementCount = 0;
+
+    while (entry[0] != -1 && (entry[0] & 0x1FF) - 31 >= 0) {
+        entry += 5;
+        count++;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    sMacroPlacements = main_pool_alloc(count * sizeof(struct MacroPlacement), MEMORY_POOL_LEFT);
+    if (sMacroPlacements == NULL) {
+        return;
+    }
+
+    for (i = 0; i < count; i++) {
+        struct MacroPlacement *p = &sMacroPlacements[i];
+        struct MacroPreset *preset;
+
+        entry = macroObjList + i * 5;
+        preset = &MacroObjectPresets[(entry[0] & 0x1FF) - 31];
+
+        p->model = preset->model;
+        p->behavior = preset->behavior;
+        p->pos[0] = entry[1];
+        p->pos[1] = entry[2];
+        p->pos[2] = entry[3];
+        p->yaw = convert_rotation(((entry[0] >> 9) & 0x7F) << 1);
+        p->params = entry[4];
+        if (preset->param != 0) {
+            p->params = (p->params & 0xFF00) + (preset->param & 0x00FF);
+        }
+        p->respawnInfo = entry + 4;
+    }
+    sMacroPlacementCount = count;
+}
+
+#endif // MACRO_PLACEMENT_TABLE
+
+#ifdef OBJECT_DORMANCY
+
+// Upper bound on tracked macro list entries; each costs one bit of state.
+#define DORMANCY_MAX_ENTRIES 1024
+// Dormant entries checked for wake-up per frame (round robin over the list).
+#define DORMANCY_SCAN_SLICE 64
+
+// The current area's macro object list doubles as the dormant record store: an
+// entry holds everything needed to respawn its object (preset, position, yaw,
+// params, respawn info bits), so going dormant is just an unload plus one bit
+// set here. State is re-registered by spawn_macro_objects on every area load.
+static MacroObject *sDormancyMacroList = NULL;
+static s32 sDormancyEntryCount = 0;
+static s32 sDormancyAreaIndex = 0;
+static s32 sDormancyScanCursor = 0;
+static u32 sDormancyBits[DORMANCY_MAX_ENTRIES / 32];
+
+/**
+ * Forget the tracked macro list. Called when objects are cleared, since the
+ * list lives in the level pool and may be about to be freed.
+ */
+void dormancy_reset(void) {
+    s32 i;
+
+    sDormancyMacroList = NULL;
+    sDormancyEntryCount = 0;
+    sDormancyScanCursor = 0;
+    for (i = 0; i < (s32) ARRAY_COUNT(sDormancyBits); i++) {
+        sDormancyBits[i] = 0;
+    }
+#ifdef MACRO_PLACEMENT_TABLE
+    // The placement table lives in the level pool alongside the macro list.
+    sMacroPlacements = NULL;
+    sMacroPlacementCount = 0;
+#endif
+}
+
+/**
+ * Start tracking an area's macro list for dormancy. All entries begin resident
+ * (spawn_macro_objects queues them); entries beyond DORMANCY_MAX_ENTRIES are
+ * spawned normally but never go dormant.
+ */
+static void dormancy_begin_area(s32 areaIndex, MacroObject *macroObjList) {
+    MacroObject *entry = macroObjList;
+    s32 count = 0;
+
+    while (*entry != -1 && (*entry & 0x1FF) - 31 >= 0 && count < DORMANCY_MAX_ENTRIES) {
+        entry += 5;
+        count++;
+    }
+
+    dormancy_reset();
+    sDormancyMacroList = macroObjList;
+    sDormancyEntryCount = count;
+    sDormancyAreaIndex = areaIndex;
+}
+
+/**
+ * Map an object's respawnInfo pointer (which points at the params word of its
+ * macro list entry) back to that entry's index, or -1 if the object was not
+ * spawned from the tracked list.
+ */
+static s32 dormancy_entry_index(void *respawnInfo) {
+    s32 offset = (MacroObject *) respawnInfo - sDormancyMacroList;
+
+    if (offset < 4 || (offset % 5) != 4) {
+        return -1;
+    }
+    offset /= 5;
+    if (offset >= sDormancyEntryCount) {
+        return -1;
+    }
+    return offset;
+}
+
+/**
+ * Respawn a dormant macro list entry through the deferred spawn queue,
+ * mirroring how spawn_macro_objects reads the entry.
+ */
+static void dormancy_wake_entry(s32 entryIndex) {
+    MacroObject *entry = sDormancyMacroList + entryIndex * 5;
+    struct MacroPreset preset;
+    s16 yaw;
+    s16 params;
+
+#ifdef MACRO_PLACEMENT_TABLE
+    if (sMacroPlacements != NULL && entryIndex < sMacroPlacementCount) {
+        struct MacroPlacement *p = &sMacroPlacements[entryIndex];
+
+        // Respawn bits behaviors set while the object was resident live in the
+        // macro list entry, not the table; re-read its upper byte.
+        params = (entry[4] & 0xFF00) | (p->params & 0x00FF);
+        deferred_spawn_enqueue(p->model, p->behavior,
+                               p->pos[0], p->pos[1], p->pos[2],
+                               p->yaw, params,
+                               p->respawnInfo, sDormancyAreaIndex, FALSE);
+        return;
+    }
+#endif
+
+    preset = MacroObjectPresets[(entry[0] & 0x1FF) - 31];
+    yaw = ((entry[0] >> 9) & 0x7F) << 1;
+    params = entry[4];
+
+    if (preset.param != 0) {
+        params = (params & 0xFF00) + (preset.param & 0x00FF);
+    }
+
+    deferred_spawn_enqueue(preset.model, preset.behavior,
+                           entry[1], entry[2], entry[3],
+                           convert_rotation(yaw), params,
+                           entry + 4, sDormancyAreaIndex, FALSE);
+}
+
+/**
+ * Stream macro objects in and out around Mario. Resident objects already
+ * hidden by drawing distance are unloaded once far enough away, and a slice of
+ * dormant entries is checked for wake-up each frame. Runs once per frame from
+ * update_objects, before any object updates.
+ */
+void dormancy_update(void) {
+    s32 i;
+    s32 n;
+
+    if (sDormancyMacroList == NULL || gMarioObject == NULL) {
+        return;
+    }
+
+    // Sleep pass: put distant macro objects to sleep. ACTIVE_FLAG_FAR_AWAY
+    // limits this to objects with no collision data and no room assignment,
+    // whose only live state is what the macro list entry restores.
+    for (i = 0; i < OBJECT_POOL_CAPACITY; i++) {
+        struct Object *obj = &gObjectPool[i];
+        s32 entryIndex;
+        f32 dx, dy, dz;
+
+        if (obj->activeFlags == ACTIVE_FLAG_DEACTIVATED
+         || obj->respawnInfoType != RESPAWN_INFO_TYPE_MACRO_OBJECT
+         || !(obj->activeFlags & ACTIVE_FLAG_FAR_AWAY)
+         || obj->oHeldState != HELD_FREE) {
+            continue;
+        }
+
+        entryIndex = dormancy_entry_index(obj->respawnInfo);
+        if (entryIndex < 0) {
+            continue;
+        }
+
+        dx = obj->oPosX - gMarioObject->oPosX;
+        dy = obj->oPosY - gMarioObject->oPosY;
+        dz = obj->oPosZ - gMarioObject->oPosZ;
+        if ((sqr(dx) + sqr(dy) + sqr(dz)) > sqr(OBJ_DORMANCY_SLEEP_DIST)) {
+            sDormancyBits[entryIndex / 32] |= (1 << (entryIndex % 32));
+            unload_object(obj);
+        }
+    }
+
+    // Wake pass: respawn dormant entries Mario has approached. Only a slice of
+    // the list is scanned per frame; with the wake distance below the sleep
+    // distance, the hysteresis keeps borderline objects from thrashing.
+    for (n = 0; n < DORMANCY_SCAN_SLICE && sDormancyEntryCount > 0; n++) {
+        MacroObject *entry;
+        f32 dx, dy, dz;
+
+        i = sDormancyScanCursor;
+        sDormancyScanCursor = (sDormancyScanCursor + 1) % sDormancyEntryCount;
+
+        if (!(sDormancyBits[i / 32] & (1 << (i % 32)))) {
+            continue;
+        }
+
+        entry = sDormancyMacroList + i * 5;
+
+        // Killed/collected while resident never sets the dormant bit, but
+        // respect the respawn info bits anyway in case a behavior wrote them.
+        if ((GET_BPARAM3(entry[4]) & RESPAWN_INFO_DONT_RESPAWN) == RESPAWN_INFO_DONT_RESPAWN) {
+            sDormancyBits[i / 32] &= ~(1 << (i % 32));
+            continue;
+        }
+
+        dx = entry[1] - gMarioObject->oPosX;
+        dy = entry[2] - gMarioObject->oPosY;
+        dz = entry[3] - gMarioObject->oPosZ;
+        if ((sqr(dx) + sqr(dy) + sqr(dz)) < sqr(OBJ_DORMANCY_WAKE_DIST)) {
+            sDormancyBits[i / 32] &= ~(1 << (i % 32));
+            dormancy_wake_entry(i);
+        }
+    }
+}
+
+#endif // OBJECT_DORMANCY
+
 void spawn_macro_objects(s32 areaIndex, MacroObject *macroObjList) {
     s32 presetID;
     struct LoadedMacroObject macroObject;
-    struct Object *newObj;
+    UNUSED struct Object *newObj;
     struct MacroPreset preset;
 
     gMacroObjectDefaultParent.header.gfx.areaIndex = areaIndex;
     gMacroObjectDefaultParent.header.gfx.activeAreaIndex = areaIndex;
 
+#ifdef OBJECT_DORMANCY
+    dormancy_begin_area(areaIndex, macroObjList);
+#endif
+
+#ifdef MACRO_PLACEMENT_TABLE
+    macro_placement_build(macroObjList);
+    if (sMacroPlacements != NULL) {
+        s32 i;
+
+        for (i = 0; i < sMacroPlacementCount; i++) {
+            struct MacroPlacement *p = &sMacroPlacements[i];
+
+            // If object has been killed (bparam3 check), prevent it from respawning
+            if ((GET_BPARAM3(p->params) & RESPAWN_INFO_DONT_RESPAWN) == RESPAWN_INFO_DONT_RESPAWN) {
+                continue;
+            }
+#ifdef DEFERRED_SPAWN_QUEUE
+            deferred_spawn_enqueue(p->model, p->behavior,
+                                   p->pos[0], p->pos[1], p->pos[2],
+                                   p->yaw, p->params, p->respawnInfo, areaIndex, FALSE);
+#else
+            newObj = spawn_object_abs_with_rot(&gMacroObjectDefaultParent, 0, p->model, p->behavior,
+                                               p->pos[0], p->pos[1], p->pos[2], 0, p->yaw, 0);
+            newObj->oUnusedCoinParams =    p->params;
+            newObj->oBehParams        = (((p->params & 0x00FF) << 16)
+                                        | (p->params & 0xFF00));
+            newObj->oBehParams2ndByte =   (p->params & 0x00FF);
+            newObj->respawnInfoType = RESPAWN_INFO_TYPE_MACRO_OBJECT;
+            newObj->respawnInfo = p->respawnInfo;
+            newObj->parentObj = newObj;
+#endif
+        }
+        return;
+    }
+    // Allocation failed; decode the packed list directly.
+#endif
+
     while (TRUE) {
         if (*macroObjList == -1) { // An encountered value of -1 means the list has ended.
             break;
@@ -121,6 +410,14 @@ void spawn_macro_objects(s32 areaIndex, MacroObject *macroObjList) {
 
         // If object has been killed (bparam3 check), prevent it from respawning
         if ((GET_BPARAM3(macroObject.params) & RESPAWN_INFO_DONT_RESPAWN) != RESPAWN_INFO_DONT_RESPAWN) {
+#ifdef DEFERRED_SPAWN_QUEUE
+            // Queue the spawn instead of doing the whole burst this frame; the
+            // queue drains on a per-frame budget during the level-entry frames.
+            deferred_spawn_enqueue(preset.model, preset.behavior,
+                                   macroObject.pos[0], macroObject.pos[1], macroObject.pos[2],
+                                   convert_rotation(macroObject.yaw), macroObject.params,
+                                   macroObjList - 1, areaIndex, FALSE);
+#else
             // Spawn the new macro object.
             newObj = spawn_object_abs_with_rot(
                          &gMacroObjectDefaultParent,        // Parent object
@@ -142,6 +439,7 @@ void spawn_macro_objects(s32 areaIndex, MacroObject *macroObjList) {
             newObj->respawnInfoType = RESPAWN_INFO_TYPE_MACRO_OBJECT;
             newObj->respawnInfo = macroObjList - 1;
             newObj->parentObj = newObj;
+#endif
         }
     }
 }
@@ -5,6 +5,20 @@
 
 #include "types.h"
 
+#ifdef MACRO_PLACEMENT_TABLE
+// A macro list entry resolved into spawn-ready form: the preset lookup, yaw
+// conversion and param merge are done once when the table is built, so a spawn
+// is a direct read of this record.
+struct MacroPlacement {
+    /*0x00*/ ModelID32 model;
+    /*0x04*/ const BehaviorScript *behavior;
+    /*0x08*/ Vec3s pos;
+    /*0x0E*/ s16 yaw;    // already through convert_rotation
+    /*0x10*/ s16 params; // preset param merged into the low byte
+    /*0x14*/ MacroObject *respawnInfo; // live respawn bits stay in the macro list
+};
+#endif
+
 s32 convert_rotation(s16 inRotation);
 
 void spawn_macro_abs_yrot_2params(ModelID32 model, const BehaviorScript *behavior, s16 x, s16 y, s16 z, s16 ry, s16 params);
@@ -12,6 +26,10 @@ void spawn_macro_abs_yrot_param1(ModelID32 model, const BehaviorScript *behavior
 void spawn_macro_abs_special(ModelID32 model, const BehaviorScript *behavior, s16 x, s16 y, s16 z, s16 unkA, s16 unkB, s16 unkC);
 
 void spawn_macro_objects(s32 areaIndex, MacroObject *macroObjList);
+#ifdef OBJECT_DORMANCY
+void dormancy_reset(void);
+void dormancy_update(void);
+#endif
 void spawn_macro_objects_hardcoded(s32 areaIndex, MacroObject *macroObjList);
 void spawn_special_objects(s32 areaIndex, TerrainData **specialObjList);
 #ifdef NO_SEGMENTED_MEMORY
@@ -14,6 +14,9 @@ enum ThreadID {
     THREAD_7_HVQM,
     THREAD_8_TIMEKEEPER,
     THREAD_9_DA_COUNTER,
+    THREAD_10_SEGMENT_LOADER,
+    THREAD_11_INPUT_POLL,
+    THREAD_12_TERRAIN_WORKER,
 };
 
 struct RumbleData {
@@ -42,16 +42,25 @@ void map_data_init(void) {
 }
 
 char *parse_map(u32 pc) {
-	u32 i;
-
-	for (i = 0; i < gMapEntrySize; i++) {
-		if (gMapEntries[i].addr >= pc) break;
+	u32 lo = 0;
+	u32 hi = gMapEntrySize;
+
+	// gMapEntries is sorted by address when mapPacker.py packs it, so the
+	// first entry at or above pc can be found with a binary search instead
+	// of a linear scan. This keeps repeated lookups during stack walks fast.
+	while (lo < hi) {
+		u32 mid = (lo + hi) / 2;
+		if (gMapEntries[mid].addr >= pc) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
 	}
 
-	if (i == gMapEntrySize - 1) {
+	if (lo == gMapEntrySize - 1) {
 		return NULL;
 	} else {
-		return (char*) ((u32)gMapStrings + gMapEntries[i - 1].nm_offset);
+		return (char*) ((u32)gMapStrings + gMapEntries[lo - 1].nm_offset);
 	}
 }
 
@@ -390,29 +390,11 @@ s32 mario_get_floor_class(struct MarioState *m) {
     }
 
     if (m->floor != NULL) {
-        switch (m->floor->type) {
-            case SURFACE_NOT_SLIPPERY:
-            case SURFACE_HARD_NOT_SLIPPERY:
-            case SURFACE_SWITCH:
-                floorClass = SURFACE_CLASS_NOT_SLIPPERY;
-                break;
-
-            case SURFACE_SLIPPERY:
-            case SURFACE_NOISE_SLIPPERY:
-            case SURFACE_HARD_SLIPPERY:
-            case SURFACE_NO_CAM_COL_SLIPPERY:
-                floorClass = SURFACE_CLASS_SLIPPERY;
-                break;
-
-            case SURFACE_VERY_SLIPPERY:
-            case SURFACE_ICE:
-            case SURFACE_HARD_VERY_SLIPPERY:
-            case SURFACE_NOISE_VERY_SLIPPERY_73:
-            case SURFACE_NOISE_VERY_SLIPPERY_74:
-            case SURFACE_NOISE_VERY_SLIPPERY:
-            case SURFACE_NO_CAM_COL_VERY_SLIPPERY:
-                floorClass = SURFACE_CLASS_VERY_SLIPPERY;
-                break;
+        // Types with a default class (most of them) keep the terrain default
+        // chosen above.
+        s32 typeClass = SURFACE_TYPE_CLASS(m->floor->type);
+        if (typeClass != SURFACE_CLASS_DEFAULT) {
+            floorClass = typeClass;
         }
     }
 
@@ -464,42 +446,7 @@ u32 mario_get_terrain_sound_addend(struct MarioState *m) {
         } else if (SURFACE_IS_QUICKSAND(floorType)) {
             ret = SOUND_TERRAIN_SAND << 16;
         } else {
-            switch (floorType) {
-                default:
-                    floorSoundType = 0;
-                    break;
-
-                case SURFACE_NOT_SLIPPERY:
-                case SURFACE_HARD:
-                case SURFACE_HARD_NOT_SLIPPERY:
-                case SURFACE_SWITCH:
-                    floorSoundType = 1;
-                    break;
-
-                case SURFACE_SLIPPERY:
-                case SURFACE_HARD_SLIPPERY:
-                case SURFACE_NO_CAM_COL_SLIPPERY:
-                    floorSoundType = 2;
-                    break;
-
-                case SURFACE_VERY_SLIPPERY:
-                case SURFACE_ICE:
-                case SURFACE_HARD_VERY_SLIPPERY:
-                case SURFACE_NOISE_VERY_SLIPPERY_73:
-                case SURFACE_NOISE_VERY_SLIPPERY_74:
-                case SURFACE_NOISE_VERY_SLIPPERY:
-                case SURFACE_NO_CAM_COL_VERY_SLIPPERY:
-                    floorSoundType = 3;
-                    break;
-
-                case SURFACE_NOISE_DEFAULT:
-                    floorSoundType = 4;
-                    break;
-
-                case SURFACE_NOISE_SLIPPERY:
-                    floorSoundType = 5;
-                    break;
-            }
+            floorSoundType = SURFACE_TYPE_SOUND(floorType);
 
             ret = sTerrainSounds[terrainType][floorSoundType] << 16;
         }
@@ -1691,6 +1638,21 @@ void queue_rumble_particles(struct MarioState *m) {
 }
 #endif
 
+/* clang-format off */
+// Per-group action executors; each runs its group's common cancels and then
+// dispatches through its own action table. A NULL group (custom or unused)
+// ends the action loop for the frame.
+static const MarioActionFunc sMarioActionGroups[ACT_NUM_GROUPS] = {
+    [ACT_GROUP_INDEX(ACT_GROUP_STATIONARY)] = mario_execute_stationary_action,
+    [ACT_GROUP_INDEX(ACT_GROUP_MOVING)]     = mario_execute_moving_action,
+    [ACT_GROUP_INDEX(ACT_GROUP_AIRBORNE)]   = mario_execute_airborne_action,
+    [ACT_GROUP_INDEX(ACT_GROUP_SUBMERGED)]  = mario_execute_submerged_action,
+    [ACT_GROUP_INDEX(ACT_GROUP_CUTSCENE)]   = mario_execute_cutscene_action,
+    [ACT_GROUP_INDEX(ACT_GROUP_AUTOMATIC)]  = mario_execute_automatic_action,
+    [ACT_GROUP_INDEX(ACT_GROUP_OBJECT)]     = mario_execute_object_action,
+};
+/* clang-format on */
+
 /**
  * Main function for executing Mario's behavior. Returns particleFlags.
  */
@@ -1739,15 +1701,8 @@ s32 execute_mario_action(UNUSED struct Object *obj) {
         // which can lead to unexpected sub-frame behavior. Could potentially hang
         // if a loop of actions were found, but there has not been a situation found.
         while (inLoop) {
-            switch (gMarioState->action & ACT_GROUP_MASK) {
-                case ACT_GROUP_STATIONARY: inLoop = mario_execute_stationary_action(gMarioState); break;
-                case ACT_GROUP_MOVING:     inLoop = mario_execute_moving_action(gMarioState);     break;
-                case ACT_GROUP_AIRBORNE:   inLoop = mario_execute_airborne_action(gMarioState);   break;
-                case ACT_GROUP_SUBMERGED:  inLoop = mario_execute_submerged_action(gMarioState);  break;
-                case ACT_GROUP_CUTSCENE:   inLoop = mario_execute_cutscene_action(gMarioState);   break;
-                case ACT_GROUP_AUTOMATIC:  inLoop = mario_execute_automatic_action(gMarioState);  break;
-                case ACT_GROUP_OBJECT:     inLoop = mario_execute_object_action(gMarioState);     break;
-            }
+            MarioActionFunc groupFunc = sMarioActionGroups[ACT_GROUP_INDEX(gMarioState->action)];
+            inLoop = (groupFunc != NULL) ? groupFunc(gMarioState) : FALSE;
         }
 
         sink_mario_in_quicksand(gMarioState);
@@ -2640,68 +2640,73 @@ static s32 check_for_instant_quicksand(struct MarioState *m) {
     return FALSE;
 }
 
+/* clang-format off */
+static const MarioActionFunc sCutsceneActions[ACT_NUM_ACTIONS_PER_GROUP] = {
+    [ACT_INDEX_IN_GROUP(ACT_DISAPPEARED)]              = act_disappeared,
+    [ACT_INDEX_IN_GROUP(ACT_INTRO_CUTSCENE)]           = act_intro_cutscene,
+    [ACT_INDEX_IN_GROUP(ACT_STAR_DANCE_EXIT)]          = act_star_dance,
+    [ACT_INDEX_IN_GROUP(ACT_STAR_DANCE_NO_EXIT)]       = act_star_dance,
+    [ACT_INDEX_IN_GROUP(ACT_STAR_DANCE_WATER)]         = act_star_dance_water,
+    [ACT_INDEX_IN_GROUP(ACT_FALL_AFTER_STAR_GRAB)]     = act_fall_after_star_grab,
+    [ACT_INDEX_IN_GROUP(ACT_READING_AUTOMATIC_DIALOG)] = act_reading_automatic_dialog,
+    [ACT_INDEX_IN_GROUP(ACT_READING_NPC_DIALOG)]       = act_reading_npc_dialog,
+    [ACT_INDEX_IN_GROUP(ACT_DEBUG_FREE_MOVE)]          = act_debug_free_move,
+    [ACT_INDEX_IN_GROUP(ACT_READING_SIGN)]             = act_reading_sign,
+    [ACT_INDEX_IN_GROUP(ACT_JUMBO_STAR_CUTSCENE)]      = act_jumbo_star_cutscene,
+    [ACT_INDEX_IN_GROUP(ACT_WAITING_FOR_DIALOG)]       = act_waiting_for_dialog,
+    [ACT_INDEX_IN_GROUP(ACT_STANDING_DEATH)]           = act_standing_death,
+    [ACT_INDEX_IN_GROUP(ACT_QUICKSAND_DEATH)]          = act_quicksand_death,
+    [ACT_INDEX_IN_GROUP(ACT_ELECTROCUTION)]            = act_electrocution,
+    [ACT_INDEX_IN_GROUP(ACT_SUFFOCATION)]              = act_suffocation,
+    [ACT_INDEX_IN_GROUP(ACT_DEATH_ON_STOMACH)]         = act_death_on_stomach,
+    [ACT_INDEX_IN_GROUP(ACT_DEATH_ON_BACK)]            = act_death_on_back,
+    [ACT_INDEX_IN_GROUP(ACT_EATEN_BY_BUBBA)]           = act_eaten_by_bubba,
+    [ACT_INDEX_IN_GROUP(ACT_END_PEACH_CUTSCENE)]       = act_end_peach_cutscene,
+    [ACT_INDEX_IN_GROUP(ACT_CREDITS_CUTSCENE)]         = act_credits_cutscene,
+    [ACT_INDEX_IN_GROUP(ACT_END_WAVING_CUTSCENE)]      = act_end_waving_cutscene,
+    [ACT_INDEX_IN_GROUP(ACT_PULLING_DOOR)]             = act_going_through_door,
+    [ACT_INDEX_IN_GROUP(ACT_PUSHING_DOOR)]             = act_going_through_door,
+    [ACT_INDEX_IN_GROUP(ACT_WARP_DOOR_SPAWN)]          = act_warp_door_spawn,
+    [ACT_INDEX_IN_GROUP(ACT_EMERGE_FROM_PIPE)]         = act_emerge_from_pipe,
+    [ACT_INDEX_IN_GROUP(ACT_SPAWN_SPIN_AIRBORNE)]      = act_spawn_spin_airborne,
+    [ACT_INDEX_IN_GROUP(ACT_SPAWN_SPIN_LANDING)]       = act_spawn_spin_landing,
+    [ACT_INDEX_IN_GROUP(ACT_EXIT_AIRBORNE)]            = act_exit_airborne,
+    [ACT_INDEX_IN_GROUP(ACT_EXIT_LAND_SAVE_DIALOG)]    = act_exit_land_save_dialog,
+    [ACT_INDEX_IN_GROUP(ACT_DEATH_EXIT)]               = act_death_exit,
+    [ACT_INDEX_IN_GROUP(ACT_UNUSED_DEATH_EXIT)]        = act_unused_death_exit,
+    [ACT_INDEX_IN_GROUP(ACT_FALLING_DEATH_EXIT)]       = act_falling_death_exit,
+    [ACT_INDEX_IN_GROUP(ACT_SPECIAL_EXIT_AIRBORNE)]    = act_special_exit_airborne,
+    [ACT_INDEX_IN_GROUP(ACT_SPECIAL_DEATH_EXIT)]       = act_special_death_exit,
+    [ACT_INDEX_IN_GROUP(ACT_FALLING_EXIT_AIRBORNE)]    = act_falling_exit_airborne,
+    [ACT_INDEX_IN_GROUP(ACT_UNLOCKING_KEY_DOOR)]       = act_unlocking_key_door,
+    [ACT_INDEX_IN_GROUP(ACT_UNLOCKING_STAR_DOOR)]      = act_unlocking_star_door,
+    [ACT_INDEX_IN_GROUP(ACT_ENTERING_STAR_DOOR)]       = act_entering_star_door,
+    [ACT_INDEX_IN_GROUP(ACT_SPAWN_NO_SPIN_AIRBORNE)]   = act_spawn_no_spin_airborne,
+    [ACT_INDEX_IN_GROUP(ACT_SPAWN_NO_SPIN_LANDING)]    = act_spawn_no_spin_landing,
+    [ACT_INDEX_IN_GROUP(ACT_BBH_ENTER_JUMP)]           = act_bbh_enter_jump,
+    [ACT_INDEX_IN_GROUP(ACT_BBH_ENTER_SPIN)]           = act_bbh_enter_spin,
+    [ACT_INDEX_IN_GROUP(ACT_TELEPORT_FADE_OUT)]        = act_teleport_fade_out,
+    [ACT_INDEX_IN_GROUP(ACT_TELEPORT_FADE_IN)]         = act_teleport_fade_in,
+    [ACT_INDEX_IN_GROUP(ACT_SHOCKED)]                  = act_shocked,
+    [ACT_INDEX_IN_GROUP(ACT_SQUISHED)]                 = act_squished,
+    [ACT_INDEX_IN_GROUP(ACT_HEAD_STUCK_IN_GROUND)]     = act_head_stuck_in_ground,
+    [ACT_INDEX_IN_GROUP(ACT_BUTT_STUCK_IN_GROUND)]     = act_butt_stuck_in_ground,
+    [ACT_INDEX_IN_GROUP(ACT_FEET_STUCK_IN_GROUND)]     = act_feet_stuck_in_ground,
+    [ACT_INDEX_IN_GROUP(ACT_PUTTING_ON_CAP)]           = act_putting_on_cap,
+};
+/* clang-format on */
+
 s32 mario_execute_cutscene_action(struct MarioState *m) {
-    s32 cancel;
+    s32 cancel = FALSE;
 
     if (check_for_instant_quicksand(m)) {
         return TRUE;
     }
 
-    /* clang-format off */
-    switch (m->action) {
-        case ACT_DISAPPEARED:                cancel = act_disappeared(m);                break;
-        case ACT_INTRO_CUTSCENE:             cancel = act_intro_cutscene(m);             break;
-        case ACT_STAR_DANCE_EXIT:            cancel = act_star_dance(m);                 break;
-        case ACT_STAR_DANCE_NO_EXIT:         cancel = act_star_dance(m);                 break;
-        case ACT_STAR_DANCE_WATER:           cancel = act_star_dance_water(m);           break;
-        case ACT_FALL_AFTER_STAR_GRAB:       cancel = act_fall_after_star_grab(m);       break;
-        case ACT_READING_AUTOMATIC_DIALOG:   cancel = act_reading_automatic_dialog(m);   break;
-        case ACT_READING_NPC_DIALOG:         cancel = act_reading_npc_dialog(m);         break;
-        case ACT_DEBUG_FREE_MOVE:            cancel = act_debug_free_move(m);            break;
-        case ACT_READING_SIGN:               cancel = act_reading_sign(m);               break;
-        case ACT_JUMBO_STAR_CUTSCENE:        cancel = act_jumbo_star_cutscene(m);        break;
-        case ACT_WAITING_FOR_DIALOG:         cancel = act_waiting_for_dialog(m);         break;
-        case ACT_STANDING_DEATH:             cancel = act_standing_death(m);             break;
-        case ACT_QUICKSAND_DEATH:            cancel = act_quicksand_death(m);            break;
-        case ACT_ELECTROCUTION:              cancel = act_electrocution(m);              break;
-        case ACT_SUFFOCATION:                cancel = act_suffocation(m);                break;
-        case ACT_DEATH_ON_STOMACH:           cancel = act_death_on_stomach(m);           break;
-        case ACT_DEATH_ON_BACK:              cancel = act_death_on_back(m);              break;
-        case ACT_EATEN_BY_BUBBA:             cancel = act_eaten_by_bubba(m);             break;
-        case ACT_END_PEACH_CUTSCENE:         cancel = act_end_peach_cutscene(m);         break;
-        case ACT_CREDITS_CUTSCENE:           cancel = act_credits_cutscene(m);           break;
-        case ACT_END_WAVING_CUTSCENE:        cancel = act_end_waving_cutscene(m);        break;
-        case ACT_PULLING_DOOR:
-        case ACT_PUSHING_DOOR:               cancel = act_going_through_door(m);         break;
-        case ACT_WARP_DOOR_SPAWN:            cancel = act_warp_door_spawn(m);            break;
-        case ACT_EMERGE_FROM_PIPE:           cancel = act_emerge_from_pipe(m);           break;
-        case ACT_SPAWN_SPIN_AIRBORNE:        cancel = act_spawn_spin_airborne(m);        break;
-        case ACT_SPAWN_SPIN_LANDING:         cancel = act_spawn_spin_landing(m);         break;
-        case ACT_EXIT_AIRBORNE:              cancel = act_exit_airborne(m);              break;
-        case ACT_EXIT_LAND_SAVE_DIALOG:      cancel = act_exit_land_save_dialog(m);      break;
-        case ACT_DEATH_EXIT:                 cancel = act_death_exit(m);                 break;
-        case ACT_UNUSED_DEATH_EXIT:          cancel = act_unused_death_exit(m);          break;
-        case ACT_FALLING_DEATH_EXIT:         cancel = act_falling_death_exit(m);         break;
-        case ACT_SPECIAL_EXIT_AIRBORNE:      cancel = act_special_exit_airborne(m);      break;
-        case ACT_SPECIAL_DEATH_EXIT:         cancel = act_special_death_exit(m);         break;
-        case ACT_FALLING_EXIT_AIRBORNE:      cancel = act_falling_exit_airborne(m);      break;
-        case ACT_UNLOCKING_KEY_DOOR:         cancel = act_unlocking_key_door(m);         break;
-        case ACT_UNLOCKING_STAR_DOOR:        cancel = act_unlocking_star_door(m);        break;
-        case ACT_ENTERING_STAR_DOOR:         cancel = act_entering_star_door(m);         break;
-        case ACT_SPAWN_NO_SPIN_AIRBORNE:     cancel = act_spawn_no_spin_airborne(m);     break;
-        case ACT_SPAWN_NO_SPIN_LANDING:      cancel = act_spawn_no_spin_landing(m);      break;
-        case ACT_BBH_ENTER_JUMP:             cancel = act_bbh_enter_jump(m);             break;
-        case ACT_BBH_ENTER_SPIN:             cancel = act_bbh_enter_spin(m);             break;
-        case ACT_TELEPORT_FADE_OUT:          cancel = act_teleport_fade_out(m);          break;
-        case ACT_TELEPORT_FADE_IN:           cancel = act_teleport_fade_in(m);           break;
-        case ACT_SHOCKED:                    cancel = act_shocked(m);                    break;
-        case ACT_SQUISHED:                   cancel = act_squished(m);                   break;
-        case ACT_HEAD_STUCK_IN_GROUND:       cancel = act_head_stuck_in_ground(m);       break;
-        case ACT_BUTT_STUCK_IN_GROUND:       cancel = act_butt_stuck_in_ground(m);       break;
-        case ACT_FEET_STUCK_IN_GROUND:       cancel = act_feet_stuck_in_ground(m);       break;
-        case ACT_PUTTING_ON_CAP:             cancel = act_putting_on_cap(m);             break;
-    }
-    /* clang-format on */
+    MarioActionFunc actionFunc = sCutsceneActions[ACT_INDEX_IN_GROUP(m->action)];
+    if (actionFunc != NULL) {
+        cancel = actionFunc(m);
+    }
 
     if (!cancel && (m->input & INPUT_IN_WATER)) {
         m->particleFlags |= PARTICLE_IDLE_WATER_WAVE;
@@ -1947,6 +1947,49 @@ s32 check_common_moving_cancels(struct MarioState *m) {
     return FALSE;
 }
 
+/* clang-format off */
+static const MarioActionFunc sMovingActions[ACT_NUM_ACTIONS_PER_GROUP] = {
+    [ACT_INDEX_IN_GROUP(ACT_WALKING)]                  = act_walking,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_WALKING)]             = act_hold_walking,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_HEAVY_WALKING)]       = act_hold_heavy_walking,
+    [ACT_INDEX_IN_GROUP(ACT_TURNING_AROUND)]           = act_turning_around,
+    [ACT_INDEX_IN_GROUP(ACT_FINISH_TURNING_AROUND)]    = act_finish_turning_around,
+    [ACT_INDEX_IN_GROUP(ACT_BRAKING)]                  = act_braking,
+    [ACT_INDEX_IN_GROUP(ACT_RIDING_SHELL_GROUND)]      = act_riding_shell_ground,
+    [ACT_INDEX_IN_GROUP(ACT_CRAWLING)]                 = act_crawling,
+    [ACT_INDEX_IN_GROUP(ACT_BURNING_GROUND)]           = act_burning_ground,
+    [ACT_INDEX_IN_GROUP(ACT_DECELERATING)]             = act_decelerating,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_DECELERATING)]        = act_hold_decelerating,
+    [ACT_INDEX_IN_GROUP(ACT_BUTT_SLIDE)]               = act_butt_slide,
+    [ACT_INDEX_IN_GROUP(ACT_STOMACH_SLIDE)]            = act_stomach_slide,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_BUTT_SLIDE)]          = act_hold_butt_slide,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_STOMACH_SLIDE)]       = act_hold_stomach_slide,
+    [ACT_INDEX_IN_GROUP(ACT_DIVE_SLIDE)]               = act_dive_slide,
+    [ACT_INDEX_IN_GROUP(ACT_MOVE_PUNCHING)]            = act_move_punching,
+    [ACT_INDEX_IN_GROUP(ACT_CROUCH_SLIDE)]             = act_crouch_slide,
+    [ACT_INDEX_IN_GROUP(ACT_SLIDE_KICK_SLIDE)]         = act_slide_kick_slide,
+    [ACT_INDEX_IN_GROUP(ACT_HARD_BACKWARD_GROUND_KB)]  = act_hard_backward_ground_kb,
+    [ACT_INDEX_IN_GROUP(ACT_HARD_FORWARD_GROUND_KB)]   = act_hard_forward_ground_kb,
+    [ACT_INDEX_IN_GROUP(ACT_BACKWARD_GROUND_KB)]       = act_backward_ground_kb,
+    [ACT_INDEX_IN_GROUP(ACT_FORWARD_GROUND_KB)]        = act_forward_ground_kb,
+    [ACT_INDEX_IN_GROUP(ACT_SOFT_BACKWARD_GROUND_KB)]  = act_soft_backward_ground_kb,
+    [ACT_INDEX_IN_GROUP(ACT_SOFT_FORWARD_GROUND_KB)]   = act_soft_forward_ground_kb,
+    [ACT_INDEX_IN_GROUP(ACT_GROUND_BONK)]              = act_ground_bonk,
+    [ACT_INDEX_IN_GROUP(ACT_DEATH_EXIT_LAND)]          = act_death_exit_land,
+    [ACT_INDEX_IN_GROUP(ACT_JUMP_LAND)]                = act_jump_land,
+    [ACT_INDEX_IN_GROUP(ACT_FREEFALL_LAND)]            = act_freefall_land,
+    [ACT_INDEX_IN_GROUP(ACT_DOUBLE_JUMP_LAND)]         = act_double_jump_land,
+    [ACT_INDEX_IN_GROUP(ACT_SIDE_FLIP_LAND)]           = act_side_flip_land,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_JUMP_LAND)]           = act_hold_jump_land,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_FREEFALL_LAND)]       = act_hold_freefall_land,
+    [ACT_INDEX_IN_GROUP(ACT_TRIPLE_JUMP_LAND)]         = act_triple_jump_land,
+    [ACT_INDEX_IN_GROUP(ACT_BACKFLIP_LAND)]            = act_backflip_land,
+    [ACT_INDEX_IN_GROUP(ACT_QUICKSAND_JUMP_LAND)]      = act_quicksand_jump_land,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_QUICKSAND_JUMP_LAND)] = act_hold_quicksand_jump_land,
+    [ACT_INDEX_IN_GROUP(ACT_LONG_JUMP_LAND)]           = act_long_jump_land,
+};
+/* clang-format on */
+
 s32 mario_execute_moving_action(struct MarioState *m) {
     s32 cancel = FALSE;
 
@@ -1958,48 +2001,10 @@ s32 mario_execute_moving_action(struct MarioState *m) {
         return TRUE;
     }
 
-    /* clang-format off */
-    switch (m->action) {
-        case ACT_WALKING:                  cancel = act_walking(m);                  break;
-        case ACT_HOLD_WALKING:             cancel = act_hold_walking(m);             break;
-        case ACT_HOLD_HEAVY_WALKING:       cancel = act_hold_heavy_walking(m);       break;
-        case ACT_TURNING_AROUND:           cancel = act_turning_around(m);           break;
-        case ACT_FINISH_TURNING_AROUND:    cancel = act_finish_turning_around(m);    break;
-        case ACT_BRAKING:                  cancel = act_braking(m);                  break;
-        case ACT_RIDING_SHELL_GROUND:      cancel = act_riding_shell_ground(m);      break;
-        case ACT_CRAWLING:                 cancel = act_crawling(m);                 break;
-        case ACT_BURNING_GROUND:           cancel = act_burning_ground(m);           break;
-        case ACT_DECELERATING:             cancel = act_decelerating(m);             break;
-        case ACT_HOLD_DECELERATING:        cancel = act_hold_decelerating(m);        break;
-        case ACT_BUTT_SLIDE:               cancel = act_butt_slide(m);               break;
-        case ACT_STOMACH_SLIDE:            cancel = act_stomach_slide(m);            break;
-        case ACT_HOLD_BUTT_SLIDE:          cancel = act_hold_butt_slide(m);          break;
-        case ACT_HOLD_STOMACH_SLIDE:       cancel = act_hold_stomach_slide(m);       break;
-        case ACT_DIVE_SLIDE:               cancel = act_dive_slide(m);               break;
-        case ACT_MOVE_PUNCHING:            cancel = act_move_punching(m);            break;
-        case ACT_CROUCH_SLIDE:             cancel = act_crouch_slide(m);             break;
-        case ACT_SLIDE_KICK_SLIDE:         cancel = act_slide_kick_slide(m);         break;
-        case ACT_HARD_BACKWARD_GROUND_KB:  cancel = act_hard_backward_ground_kb(m);  break;
-        case ACT_HARD_FORWARD_GROUND_KB:   cancel = act_hard_forward_ground_kb(m);   break;
-        case ACT_BACKWARD_GROUND_KB:       cancel = act_backward_ground_kb(m);       break;
-        case ACT_FORWARD_GROUND_KB:        cancel = act_forward_ground_kb(m);        break;
-        case ACT_SOFT_BACKWARD_GROUND_KB:  cancel = act_soft_backward_ground_kb(m);  break;
-        case ACT_SOFT_FORWARD_GROUND_KB:   cancel = act_soft_forward_ground_kb(m);   break;
-        case ACT_GROUND_BONK:              cancel = act_ground_bonk(m);              break;
-        case ACT_DEATH_EXIT_LAND:          cancel = act_death_exit_land(m);          break;
-        case ACT_JUMP_LAND:                cancel = act_jump_land(m);                break;
-        case ACT_FREEFALL_LAND:            cancel = act_freefall_land(m);            break;
-        case ACT_DOUBLE_JUMP_LAND:         cancel = act_double_jump_land(m);         break;
-        case ACT_SIDE_FLIP_LAND:           cancel = act_side_flip_land(m);           break;
-        case ACT_HOLD_JUMP_LAND:           cancel = act_hold_jump_land(m);           break;
-        case ACT_HOLD_FREEFALL_LAND:       cancel = act_hold_freefall_land(m);       break;
-        case ACT_TRIPLE_JUMP_LAND:         cancel = act_triple_jump_land(m);         break;
-        case ACT_BACKFLIP_LAND:            cancel = act_backflip_land(m);            break;
-        case ACT_QUICKSAND_JUMP_LAND:      cancel = act_quicksand_jump_land(m);      break;
-        case ACT_HOLD_QUICKSAND_JUMP_LAND: cancel = act_hold_quicksand_jump_land(m); break;
-        case ACT_LONG_JUMP_LAND:           cancel = act_long_jump_land(m);           break;
-    }
-    /* clang-format on */
+    MarioActionFunc actionFunc = sMovingActions[ACT_INDEX_IN_GROUP(m->action)];
+    if (actionFunc != NULL) {
+        cancel = actionFunc(m);
+    }
 
     if (!cancel && (m->input & INPUT_IN_WATER)) {
         m->particleFlags |= PARTICLE_WAVE_TRAIL;
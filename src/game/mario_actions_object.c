@@ -450,6 +450,21 @@ s32 check_common_object_cancels(struct MarioState *m) {
     return FALSE;
 }
 
+/* clang-format off */
+static const MarioActionFunc sObjectActions[ACT_NUM_ACTIONS_PER_GROUP] = {
+    [ACT_INDEX_IN_GROUP(ACT_PUNCHING)]           = act_punching,
+    [ACT_INDEX_IN_GROUP(ACT_PICKING_UP)]         = act_picking_up,
+    [ACT_INDEX_IN_GROUP(ACT_DIVE_PICKING_UP)]    = act_dive_picking_up,
+    [ACT_INDEX_IN_GROUP(ACT_STOMACH_SLIDE_STOP)] = act_stomach_slide_stop,
+    [ACT_INDEX_IN_GROUP(ACT_PLACING_DOWN)]       = act_placing_down,
+    [ACT_INDEX_IN_GROUP(ACT_THROWING)]           = act_throwing,
+    [ACT_INDEX_IN_GROUP(ACT_HEAVY_THROW)]        = act_heavy_throw,
+    [ACT_INDEX_IN_GROUP(ACT_PICKING_UP_BOWSER)]  = act_picking_up_bowser,
+    [ACT_INDEX_IN_GROUP(ACT_HOLDING_BOWSER)]     = act_holding_bowser,
+    [ACT_INDEX_IN_GROUP(ACT_RELEASING_BOWSER)]   = act_releasing_bowser,
+};
+/* clang-format on */
+
 s32 mario_execute_object_action(struct MarioState *m) {
     s32 cancel = FALSE;
 
@@ -461,20 +476,10 @@ s32 mario_execute_object_action(struct MarioState *m) {
         return TRUE;
     }
 
-    /* clang-format off */
-    switch (m->action) {
-        case ACT_PUNCHING:           cancel = act_punching(m);           break;
-        case ACT_PICKING_UP:         cancel = act_picking_up(m);         break;
-        case ACT_DIVE_PICKING_UP:    cancel = act_dive_picking_up(m);    break;
-        case ACT_STOMACH_SLIDE_STOP: cancel = act_stomach_slide_stop(m); break;
-        case ACT_PLACING_DOWN:       cancel = act_placing_down(m);       break;
-        case ACT_THROWING:           cancel = act_throwing(m);           break;
-        case ACT_HEAVY_THROW:        cancel = act_heavy_throw(m);        break;
-        case ACT_PICKING_UP_BOWSER:  cancel = act_picking_up_bowser(m);  break;
-        case ACT_HOLDING_BOWSER:     cancel = act_holding_bowser(m);     break;
-        case ACT_RELEASING_BOWSER:   cancel = act_releasing_bowser(m);   break;
-    }
-    /* clang-format on */
+    MarioActionFunc actionFunc = sObjectActions[ACT_INDEX_IN_GROUP(m->action)];
+    if (actionFunc != NULL) {
+        cancel = actionFunc(m);
+    }
 
     if (!cancel && (m->input & INPUT_IN_WATER)) {
         m->particleFlags |= PARTICLE_IDLE_WATER_WAVE;
@@ -1080,6 +1080,47 @@ s32 check_common_stationary_cancels(struct MarioState *m) {
     return FALSE;
 }
 
+/* clang-format off */
+static const MarioActionFunc sStationaryActions[ACT_NUM_ACTIONS_PER_GROUP] = {
+    [ACT_INDEX_IN_GROUP(ACT_IDLE)]                    = act_idle,
+    [ACT_INDEX_IN_GROUP(ACT_START_SLEEPING)]          = act_start_sleeping,
+    [ACT_INDEX_IN_GROUP(ACT_SLEEPING)]                = act_sleeping,
+    [ACT_INDEX_IN_GROUP(ACT_WAKING_UP)]               = act_waking_up,
+    [ACT_INDEX_IN_GROUP(ACT_PANTING)]                 = act_panting,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_PANTING_UNUSED)]     = act_hold_panting_unused,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_IDLE)]               = act_hold_idle,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_HEAVY_IDLE)]         = act_hold_heavy_idle,
+    [ACT_INDEX_IN_GROUP(ACT_IN_QUICKSAND)]            = act_in_quicksand,
+    [ACT_INDEX_IN_GROUP(ACT_STANDING_AGAINST_WALL)]   = act_standing_against_wall,
+    [ACT_INDEX_IN_GROUP(ACT_COUGHING)]                = act_coughing,
+    [ACT_INDEX_IN_GROUP(ACT_SHIVERING)]               = act_shivering,
+    [ACT_INDEX_IN_GROUP(ACT_CROUCHING)]               = act_crouching,
+    [ACT_INDEX_IN_GROUP(ACT_START_CROUCHING)]         = act_start_crouching,
+    [ACT_INDEX_IN_GROUP(ACT_STOP_CROUCHING)]          = act_stop_crouching,
+    [ACT_INDEX_IN_GROUP(ACT_START_CRAWLING)]          = act_start_crawling,
+    [ACT_INDEX_IN_GROUP(ACT_STOP_CRAWLING)]           = act_stop_crawling,
+    [ACT_INDEX_IN_GROUP(ACT_SLIDE_KICK_SLIDE_STOP)]   = act_slide_kick_slide_stop,
+    [ACT_INDEX_IN_GROUP(ACT_SHOCKWAVE_BOUNCE)]        = act_shockwave_bounce,
+    [ACT_INDEX_IN_GROUP(ACT_FIRST_PERSON)]            = act_first_person,
+    [ACT_INDEX_IN_GROUP(ACT_JUMP_LAND_STOP)]          = act_jump_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_DOUBLE_JUMP_LAND_STOP)]   = act_double_jump_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_FREEFALL_LAND_STOP)]      = act_freefall_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_SIDE_FLIP_LAND_STOP)]     = act_side_flip_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_JUMP_LAND_STOP)]     = act_hold_jump_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_FREEFALL_LAND_STOP)] = act_hold_freefall_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_AIR_THROW_LAND)]          = act_air_throw_land,
+    [ACT_INDEX_IN_GROUP(ACT_LAVA_BOOST_LAND)]         = act_lava_boost_land,
+    [ACT_INDEX_IN_GROUP(ACT_TWIRL_LAND)]              = act_twirl_land,
+    [ACT_INDEX_IN_GROUP(ACT_TRIPLE_JUMP_LAND_STOP)]   = act_triple_jump_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_BACKFLIP_LAND_STOP)]      = act_backflip_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_LONG_JUMP_LAND_STOP)]     = act_long_jump_land_stop,
+    [ACT_INDEX_IN_GROUP(ACT_GROUND_POUND_LAND)]       = act_ground_pound_land,
+    [ACT_INDEX_IN_GROUP(ACT_BRAKING_STOP)]            = act_braking_stop,
+    [ACT_INDEX_IN_GROUP(ACT_BUTT_SLIDE_STOP)]         = act_butt_slide_stop,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_BUTT_SLIDE_STOP)]    = act_hold_butt_slide_stop,
+};
+/* clang-format on */
+
 s32 mario_execute_stationary_action(struct MarioState *m) {
     s32 cancel;
 
@@ -1091,47 +1132,8 @@ s32 mario_execute_stationary_action(struct MarioState *m) {
         return TRUE;
     }
 
-    /* clang-format off */
-    switch (m->action) {
-        case ACT_IDLE:                    cancel = act_idle(m);                             break;
-        case ACT_START_SLEEPING:          cancel = act_start_sleeping(m);                   break;
-        case ACT_SLEEPING:                cancel = act_sleeping(m);                         break;
-        case ACT_WAKING_UP:               cancel = act_waking_up(m);                        break;
-        case ACT_PANTING:                 cancel = act_panting(m);                          break;
-        case ACT_HOLD_PANTING_UNUSED:     cancel = act_hold_panting_unused(m);              break;
-        case ACT_HOLD_IDLE:               cancel = act_hold_idle(m);                        break;
-        case ACT_HOLD_HEAVY_IDLE:         cancel = act_hold_heavy_idle(m);                  break;
-        case ACT_IN_QUICKSAND:            cancel = act_in_quicksand(m);                     break;
-        case ACT_STANDING_AGAINST_WALL:   cancel = act_standing_against_wall(m);            break;
-        case ACT_COUGHING:                cancel = act_coughing(m);                         break;
-        case ACT_SHIVERING:               cancel = act_shivering(m);                        break;
-        case ACT_CROUCHING:               cancel = act_crouching(m);                        break;
-        case ACT_START_CROUCHING:         cancel = act_start_crouching(m);                  break;
-        case ACT_STOP_CROUCHING:          cancel = act_stop_crouching(m);                   break;
-        case ACT_START_CRAWLING:          cancel = act_start_crawling(m);                   break;
-        case ACT_STOP_CRAWLING:           cancel = act_stop_crawling(m);                    break;
-        case ACT_SLIDE_KICK_SLIDE_STOP:   cancel = act_slide_kick_slide_stop(m);            break;
-        case ACT_SHOCKWAVE_BOUNCE:        cancel = act_shockwave_bounce(m);                 break;
-        case ACT_FIRST_PERSON:            cancel = act_first_person(m);                     break;
-        case ACT_JUMP_LAND_STOP:          cancel = act_jump_land_stop(m);                   break;
-        case ACT_DOUBLE_JUMP_LAND_STOP:   cancel = act_double_jump_land_stop(m);            break;
-        case ACT_FREEFALL_LAND_STOP:      cancel = act_freefall_land_stop(m);               break;
-        case ACT_SIDE_FLIP_LAND_STOP:     cancel = act_side_flip_land_stop(m);              break;
-        case ACT_HOLD_JUMP_LAND_STOP:     cancel = act_hold_jump_land_stop(m);              break;
-        case ACT_HOLD_FREEFALL_LAND_STOP: cancel = act_hold_freefall_land_stop(m);          break;
-        case ACT_AIR_THROW_LAND:          cancel = act_air_throw_land(m);                   break;
-        case ACT_LAVA_BOOST_LAND:         cancel = act_lava_boost_land(m);                  break;
-        case ACT_TWIRL_LAND:              cancel = act_twirl_land(m);                       break;
-        case ACT_TRIPLE_JUMP_LAND_STOP:   cancel = act_triple_jump_land_stop(m);            break;
-        case ACT_BACKFLIP_LAND_STOP:      cancel = act_backflip_land_stop(m);               break;
-        case ACT_LONG_JUMP_LAND_STOP:     cancel = act_long_jump_land_stop(m);              break;
-        case ACT_GROUND_POUND_LAND:       cancel = act_ground_pound_land(m);                break;
-        case ACT_BRAKING_STOP:            cancel = act_braking_stop(m);                     break;
-        case ACT_BUTT_SLIDE_STOP:         cancel = act_butt_slide_stop(m);                  break;
-        case ACT_HOLD_BUTT_SLIDE_STOP:    cancel = act_hold_butt_slide_stop(m);             break;
-        default:                          cancel = TRUE;                                    break;
-    }
-    /* clang-format on */
+    MarioActionFunc actionFunc = sStationaryActions[ACT_INDEX_IN_GROUP(m->action)];
+    cancel = (actionFunc != NULL) ? actionFunc(m) : TRUE;
 
     if (!cancel && (m->input & INPUT_IN_WATER)) {
         m->particleFlags |= PARTICLE_IDLE_WATER_WAVE;
@@ -132,6 +132,13 @@ static void apply_water_current(struct MarioState *m, Vec3f step) {
         step[2] += currentSpeed * coss(currentAngle);
     }
 
+#ifdef WATER_CURRENT_FIELD
+    // One trilinear fetch covers every current volume the area placed.
+    Vec3f fieldCurrent;
+    water_current_field_sample(m->pos, fieldCurrent);
+    vec3f_add(step, fieldCurrent);
+#endif
+
     for (i = 0; i < 2; i++) {
         struct Whirlpool *whirlpool = gCurrentArea->whirlpools[i];
         if (whirlpool != NULL) {
@@ -1523,6 +1530,43 @@ static s32 check_common_submerged_cancels(struct MarioState *m) {
     return FALSE;
 }
 
+/* clang-format off */
+static const MarioActionFunc sSubmergedActions[ACT_NUM_ACTIONS_PER_GROUP] = {
+    [ACT_INDEX_IN_GROUP(ACT_WATER_IDLE)]                 = act_water_idle,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_WATER_IDLE)]            = act_hold_water_idle,
+    [ACT_INDEX_IN_GROUP(ACT_WATER_ACTION_END)]           = act_water_action_end,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_WATER_ACTION_END)]      = act_hold_water_action_end,
+    [ACT_INDEX_IN_GROUP(ACT_DROWNING)]                   = act_drowning,
+    [ACT_INDEX_IN_GROUP(ACT_BACKWARD_WATER_KB)]          = act_backward_water_kb,
+    [ACT_INDEX_IN_GROUP(ACT_FORWARD_WATER_KB)]           = act_forward_water_kb,
+    [ACT_INDEX_IN_GROUP(ACT_WATER_DEATH)]                = act_water_death,
+    [ACT_INDEX_IN_GROUP(ACT_WATER_SHOCKED)]              = act_water_shocked,
+    [ACT_INDEX_IN_GROUP(ACT_BREASTSTROKE)]               = act_breaststroke,
+    [ACT_INDEX_IN_GROUP(ACT_SWIMMING_END)]               = act_swimming_end,
+    [ACT_INDEX_IN_GROUP(ACT_FLUTTER_KICK)]               = act_flutter_kick,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_BREASTSTROKE)]          = act_hold_breaststroke,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_SWIMMING_END)]          = act_hold_swimming_end,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_FLUTTER_KICK)]          = act_hold_flutter_kick,
+    [ACT_INDEX_IN_GROUP(ACT_WATER_SHELL_SWIMMING)]       = act_water_shell_swimming,
+    [ACT_INDEX_IN_GROUP(ACT_WATER_THROW)]                = act_water_throw,
+    [ACT_INDEX_IN_GROUP(ACT_WATER_PUNCH)]                = act_water_punch,
+    [ACT_INDEX_IN_GROUP(ACT_WATER_PLUNGE)]               = act_water_plunge,
+    [ACT_INDEX_IN_GROUP(ACT_CAUGHT_IN_WHIRLPOOL)]        = act_caught_in_whirlpool,
+    [ACT_INDEX_IN_GROUP(ACT_METAL_WATER_STANDING)]       = act_metal_water_standing,
+    [ACT_INDEX_IN_GROUP(ACT_METAL_WATER_WALKING)]        = act_metal_water_walking,
+    [ACT_INDEX_IN_GROUP(ACT_METAL_WATER_FALLING)]        = act_metal_water_falling,
+    [ACT_INDEX_IN_GROUP(ACT_METAL_WATER_FALL_LAND)]      = act_metal_water_fall_land,
+    [ACT_INDEX_IN_GROUP(ACT_METAL_WATER_JUMP)]           = act_metal_water_jump,
+    [ACT_INDEX_IN_GROUP(ACT_METAL_WATER_JUMP_LAND)]      = act_metal_water_jump_land,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_METAL_WATER_STANDING)]  = act_hold_metal_water_standing,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_METAL_WATER_WALKING)]   = act_hold_metal_water_walking,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_METAL_WATER_FALLING)]   = act_hold_metal_water_falling,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_METAL_WATER_FALL_LAND)] = act_hold_metal_water_fall_land,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_METAL_WATER_JUMP)]      = act_hold_metal_water_jump,
+    [ACT_INDEX_IN_GROUP(ACT_HOLD_METAL_WATER_JUMP_LAND)] = act_hold_metal_water_jump_land,
+};
+/* clang-format on */
+
 s32 mario_execute_submerged_action(struct MarioState *m) {
     s32 cancel = FALSE;
 
@@ -1535,42 +1579,10 @@ s32 mario_execute_submerged_action(struct MarioState *m) {
     m->marioBodyState->headAngle[1] = 0;
     m->marioBodyState->headAngle[2] = 0;
 
-    /* clang-format off */
-    switch (m->action) {
-        case ACT_WATER_IDLE:                 cancel = act_water_idle(m);                 break;
-        case ACT_HOLD_WATER_IDLE:            cancel = act_hold_water_idle(m);            break;
-        case ACT_WATER_ACTION_END:           cancel = act_water_action_end(m);           break;
-        case ACT_HOLD_WATER_ACTION_END:      cancel = act_hold_water_action_end(m);      break;
-        case ACT_DROWNING:                   cancel = act_drowning(m);                   break;
-        case ACT_BACKWARD_WATER_KB:          cancel = act_backward_water_kb(m);          break;
-        case ACT_FORWARD_WATER_KB:           cancel = act_forward_water_kb(m);           break;
-        case ACT_WATER_DEATH:                cancel = act_water_death(m);                break;
-        case ACT_WATER_SHOCKED:              cancel = act_water_shocked(m);              break;
-        case ACT_BREASTSTROKE:               cancel = act_breaststroke(m);               break;
-        case ACT_SWIMMING_END:               cancel = act_swimming_end(m);               break;
-        case ACT_FLUTTER_KICK:               cancel = act_flutter_kick(m);               break;
-        case ACT_HOLD_BREASTSTROKE:          cancel = act_hold_breaststroke(m);          break;
-        case ACT_HOLD_SWIMMING_END:          cancel = act_hold_swimming_end(m);          break;
-        case ACT_HOLD_FLUTTER_KICK:          cancel = act_hold_flutter_kick(m);          break;
-        case ACT_WATER_SHELL_SWIMMING:       cancel = act_water_shell_swimming(m);       break;
-        case ACT_WATER_THROW:                cancel = act_water_throw(m);                break;
-        case ACT_WATER_PUNCH:                cancel = act_water_punch(m);                break;
-        case ACT_WATER_PLUNGE:               cancel = act_water_plunge(m);               break;
-        case ACT_CAUGHT_IN_WHIRLPOOL:        cancel = act_caught_in_whirlpool(m);        break;
-        case ACT_METAL_WATER_STANDING:       cancel = act_metal_water_standing(m);       break;
-        case ACT_METAL_WATER_WALKING:        cancel = act_metal_water_walking(m);        break;
-        case ACT_METAL_WATER_FALLING:        cancel = act_metal_water_falling(m);        break;
-        case ACT_METAL_WATER_FALL_LAND:      cancel = act_metal_water_fall_land(m);      break;
-        case ACT_METAL_WATER_JUMP:           cancel = act_metal_water_jump(m);           break;
-        case ACT_METAL_WATER_JUMP_LAND:      cancel = act_metal_water_jump_land(m);      break;
-        case ACT_HOLD_METAL_WATER_STANDING:  cancel = act_hold_metal_water_standing(m);  break;
-        case ACT_HOLD_METAL_WATER_WALKING:   cancel = act_hold_metal_water_walking(m);   break;
-        case ACT_HOLD_METAL_WATER_FALLING:   cancel = act_hold_metal_water_falling(m);   break;
-        case ACT_HOLD_METAL_WATER_FALL_LAND: cancel = act_hold_metal_water_fall_land(m); break;
-        case ACT_HOLD_METAL_WATER_JUMP:      cancel = act_hold_metal_water_jump(m);      break;
-        case ACT_HOLD_METAL_WATER_JUMP_LAND: cancel = act_hold_metal_water_jump_land(m); break;
-    }
-    /* clang-format on */
+    MarioActionFunc actionFunc = sSubmergedActions[ACT_INDEX_IN_GROUP(m->action)];
+    if (actionFunc != NULL) {
+        cancel = actionFunc(m);
+    }
 
     return cancel;
 }
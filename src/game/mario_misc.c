@@ -76,6 +76,26 @@ static s8 gMarioAttackScaleAnimation[3 * 6] = {
 struct MarioBodyState gBodyStates[2]; // 2nd is never accessed in practice, most likely Luigi related
 struct GraphNodeObject gMirrorMario;  // copy of Mario's geo node for drawing mirror Mario
 
+#ifdef MARIO_PART_CACHE
+/**
+ * Mario's switch-case part states, resolved once per frame from the body state.
+ * Mirror Mario and any other repeat traversal of his graph read these instead of
+ * re-deriving the same results. The hand entries live in slot 0 only, since both
+ * hand node variants read gBodyStates[0].
+ */
+struct MarioPartCache {
+    u16 resolvedFrame;  // gAreaUpdateCounter the entries below were resolved on
+    u16 wingFlagsFrame; // last frame the cap node walked its siblings' wing flags
+    s16 standRun;
+    s16 eyes;
+    s16 hand[2];        // [0]: five-case hand nodes, [1]: two-case hand nodes
+    s16 capEffect;
+    s16 capOnOff;
+};
+
+static struct MarioPartCache sMarioPartCache[2];
+#endif
+
 // This whole file is weirdly organized. It has to be the same file due
 // to rodata boundaries and function aligns, which means the programmer
 // treated this like a "misc" file for vaguely Mario related things
@@ -342,6 +362,52 @@ Gfx *geo_mirror_mario_set_alpha(s32 callContext, struct GraphNode *node, UNUSED
     return gfx;
 }
 
+#ifdef MARIO_PART_CACHE
+/**
+ * Resolve every cached part state for one body state, on its first geo switch
+ * evaluation of the frame. Later evaluations - the rest of Mario's own graph
+ * and the whole mirror Mario traversal - just read the table.
+ */
+static struct MarioPartCache *resolve_mario_part_cache(s32 index) {
+    struct MarioPartCache *cache = &sMarioPartCache[index];
+    struct MarioBodyState *bodyState = &gBodyStates[index];
+
+    if (cache->resolvedFrame == gAreaUpdateCounter) {
+        return cache;
+    }
+    cache->resolvedFrame = gAreaUpdateCounter;
+
+    // Stand/run LOD: 0 if moving, 1 if stationary.
+    cache->standRun = ((bodyState->action & ACT_FLAG_STATIONARY) == 0);
+
+    // Eye blink.
+    if (bodyState->eyeState == 0) {
+        s16 blinkFrame = ((index * 32 + gAreaUpdateCounter) >> 1) & 0x1F;
+        cache->eyes = (blinkFrame < 7) ? gMarioBlinkAnimation[blinkFrame] : 0;
+    } else {
+        cache->eyes = bodyState->eyeState - 1;
+    }
+
+    // Hand pose, for both node variants. Hand nodes always read body state 0.
+    if (index == 0) {
+        if (bodyState->handState == MARIO_HAND_FISTS) {
+            // switch between fists (0) and open (1)
+            cache->hand[0] = cache->hand[1] =
+                ((bodyState->action & ACT_FLAG_SWIMMING_OR_FLYING) != 0);
+        } else {
+            cache->hand[0] = (bodyState->handState < 5) ? bodyState->handState : MARIO_HAND_OPEN;
+            cache->hand[1] = (bodyState->handState < 2) ? bodyState->handState : MARIO_HAND_FISTS;
+        }
+    }
+
+    // Cap effect and cap on/off.
+    cache->capEffect = bodyState->modelState >> 8;
+    cache->capOnOff  = bodyState->capState & MARIO_HAS_DEFAULT_CAP_OFF;
+
+    return cache;
+}
+#endif
+
 /**
  * Determines if Mario is standing or running for the level of detail of his model.
  * If Mario is standing still, he is always high poly. If he is running,
@@ -349,11 +415,15 @@ Gfx *geo_mirror_mario_set_alpha(s32 callContext, struct GraphNode *node, UNUSED
  */
 Gfx *geo_switch_mario_stand_run(s32 callContext, struct GraphNode *node, UNUSED Mat4 *mtx) {
     struct GraphNodeSwitchCase *switchCase = (struct GraphNodeSwitchCase *) node;
-    struct MarioBodyState *bodyState = &gBodyStates[switchCase->numCases];
 
     if (callContext == GEO_CONTEXT_RENDER) {
+#ifdef MARIO_PART_CACHE
+        switchCase->selectedCase = resolve_mario_part_cache(switchCase->numCases)->standRun;
+#else
+        struct MarioBodyState *bodyState = &gBodyStates[switchCase->numCases];
         // assign result. 0 if moving, 1 if stationary.
         switchCase->selectedCase = ((bodyState->action & ACT_FLAG_STATIONARY) == 0);
+#endif
     }
     return NULL;
 }
@@ -363,10 +433,15 @@ Gfx *geo_switch_mario_stand_run(s32 callContext, struct GraphNode *node, UNUSED
  */
 Gfx *geo_switch_mario_eyes(s32 callContext, struct GraphNode *node, UNUSED Mat4 *mtx) {
     struct GraphNodeSwitchCase *switchCase = (struct GraphNodeSwitchCase *) node;
+#ifndef MARIO_PART_CACHE
     struct MarioBodyState *bodyState = &gBodyStates[switchCase->numCases];
     s16 blinkFrame;
+#endif
 
     if (callContext == GEO_CONTEXT_RENDER) {
+#ifdef MARIO_PART_CACHE
+        switchCase->selectedCase = resolve_mario_part_cache(switchCase->numCases)->eyes;
+#else
         if (bodyState->eyeState == 0) {
             blinkFrame = ((switchCase->numCases * 32 + gAreaUpdateCounter) >> 1) & 0x1F;
             if (blinkFrame < 7) {
@@ -377,6 +452,7 @@ Gfx *geo_switch_mario_eyes(s32 callContext, struct GraphNode *node, UNUSED Mat4
         } else {
             switchCase->selectedCase = bodyState->eyeState - 1;
         }
+#endif
     }
     return NULL;
 }
@@ -439,6 +515,11 @@ Gfx *geo_switch_mario_hand(s32 callContext, struct GraphNode *node, UNUSED Mat4
     struct MarioBodyState *bodyState = &gBodyStates[0];
 
     if (callContext == GEO_CONTEXT_RENDER) {
+#ifdef MARIO_PART_CACHE
+        (void) bodyState;
+        switchCase->selectedCase =
+            resolve_mario_part_cache(0)->hand[switchCase->numCases != 0];
+#else
         if (bodyState->handState == MARIO_HAND_FISTS) {
             // switch between fists (0) and open (1)
             switchCase->selectedCase = ((bodyState->action & ACT_FLAG_SWIMMING_OR_FLYING) != 0);
@@ -451,6 +532,7 @@ Gfx *geo_switch_mario_hand(s32 callContext, struct GraphNode *node, UNUSED Mat4
                     (bodyState->handState < 2) ? bodyState->handState : MARIO_HAND_FISTS;
             }
         }
+#endif
     }
     return NULL;
 }
@@ -489,10 +571,14 @@ Gfx *geo_mario_hand_foot_scaler(s32 callContext, struct GraphNode *node, UNUSED
  */
 Gfx *geo_switch_mario_cap_effect(s32 callContext, struct GraphNode *node, UNUSED Mat4 *mtx) {
     struct GraphNodeSwitchCase *switchCase = (struct GraphNodeSwitchCase *) node;
-    struct MarioBodyState *bodyState = &gBodyStates[switchCase->numCases];
 
     if (callContext == GEO_CONTEXT_RENDER) {
+#ifdef MARIO_PART_CACHE
+        switchCase->selectedCase = resolve_mario_part_cache(switchCase->numCases)->capEffect;
+#else
+        struct MarioBodyState *bodyState = &gBodyStates[switchCase->numCases];
         switchCase->selectedCase = bodyState->modelState >> 8;
+#endif
     }
     return NULL;
 }
@@ -507,7 +593,18 @@ Gfx *geo_switch_mario_cap_on_off(s32 callContext, struct GraphNode *node, UNUSED
     struct MarioBodyState *bodyState = &gBodyStates[switchCase->numCases];
 
     if (callContext == GEO_CONTEXT_RENDER) {
+#ifdef MARIO_PART_CACHE
+        struct MarioPartCache *cache = resolve_mario_part_cache(switchCase->numCases);
+        switchCase->selectedCase = cache->capOnOff;
+        // The wing flags live on the shared geo nodes, so walking the sibling
+        // ring once per frame covers every traversal that draws them.
+        if (cache->wingFlagsFrame == gAreaUpdateCounter) {
+            return NULL;
+        }
+        cache->wingFlagsFrame = gAreaUpdateCounter;
+#else
         switchCase->selectedCase = bodyState->capState & MARIO_HAS_DEFAULT_CAP_OFF;
+#endif
         while (next != node) {
             if (next->type == GRAPH_NODE_TYPE_TRANSLATION_ROTATION) {
                 COND_BIT((bodyState->capState & MARIO_HAS_WING_CAP_ON), next->flags, GRAPH_RENDER_ACTIVE);
@@ -278,8 +278,12 @@ static s32 perform_ground_quarter_step(struct MarioState *m, Vec3f nextPos) {
     s16 wallDYaw;
     s32 oldWallDYaw;
 
+#ifdef COLLISION_PAIRED_WALL_QUERIES
+    resolve_and_return_wall_collisions_paired(nextPos, 30.0f, 24.0f, &lowerWall, 60.0f, 50.0f, &upperWall);
+#else
     resolve_and_return_wall_collisions(nextPos, 30.0f, 24.0f, &lowerWall);
     resolve_and_return_wall_collisions(nextPos, 60.0f, 50.0f, &upperWall);
+#endif
 
     f32 floorHeight = find_floor(nextPos[0], nextPos[1], nextPos[2], &floor);
     f32 ceilHeight = find_mario_ceil(nextPos, floorHeight, &ceil);
@@ -462,8 +466,12 @@ s32 perform_air_quarter_step(struct MarioState *m, Vec3f intendedPos, u32 stepAr
 
     vec3f_copy(nextPos, intendedPos);
 
+#ifdef COLLISION_PAIRED_WALL_QUERIES
+    resolve_and_return_wall_collisions_paired(nextPos, 150.0f, 50.0f, &upperWall, 30.0f, 50.0f, &lowerWall);
+#else
     resolve_and_return_wall_collisions(nextPos, 150.0f, 50.0f, &upperWall);
     resolve_and_return_wall_collisions(nextPos, 30.0f, 50.0f, &lowerWall);
+#endif
 
     f32 floorHeight = find_floor(nextPos[0], nextPos[1], nextPos[2], &floor);
     f32 ceilHeight = find_mario_ceil(nextPos, floorHeight, &ceil);
@@ -36,6 +36,28 @@ struct DmaHandlerList {
     struct DmaTable *dmaTable;
     void *currentAddr;
     void *bufTarget;
+#ifdef ANIM_COMPRESSION
+    // Staging buffer for compressed entries, or NULL if this table is stored
+    // raw (demo inputs). Set by the owner after setup_dma_table_list.
+    void *decodeBuf;
+#endif
+};
+
+// Maximum simultaneously pending asynchronous DMA requests.
+#define DMA_QUEUE_SIZE 8
+
+enum DmaPriority {
+    DMA_PRIORITY_NORMAL,
+    DMA_PRIORITY_HIGH,
+};
+
+struct DmaRequest {
+    u8 *dest;
+    u8 *srcStart;
+    u32 remaining;
+    void (*callback)(struct DmaRequest *); // run on the main thread when the transfer finishes
+    s8 priority;
+    u8 active;
 };
 
 #define EFFECTS_MEMORY_POOL 0x4000
@@ -52,6 +74,7 @@ void main_pool_init(void *start, void *end);
 void *main_pool_alloc(u32 size, u32 side);
 u32 main_pool_free(void *addr);
 void *main_pool_realloc(void *addr, u32 size);
+void *main_pool_try_grow(void *addr, u32 size);
 u32 main_pool_available(void);
 u32 main_pool_push_state(void);
 u32 main_pool_pop_state(void);
@@ -78,8 +101,83 @@ struct MemoryPool *mem_pool_init(u32 size, u32 side);
 void *mem_pool_alloc(struct MemoryPool *pool, u32 size);
 void mem_pool_free(struct MemoryPool *pool, void *addr);
 
+#ifdef MEM_POOL_COMPACTION
+// A relocatable allocation in a MemoryPool. Always access the memory through
+// addr, which compaction may change; relocate (if set) runs after each move so
+// the owner can fix up any other pointers into the block.
+struct MemPoolHandle {
+    void *addr;
+    void (*relocate)(struct MemPoolHandle *handle);
+};
+
+void *mem_pool_alloc_handle(struct MemoryPool *pool, u32 size, struct MemPoolHandle *handle);
+void mem_pool_free_handle(struct MemoryPool *pool, struct MemPoolHandle *handle);
+void mem_pool_compact(struct MemoryPool *pool);
+#endif
+
+// Subsystems tracked by the display list pool usage instrumentation.
+enum GfxPoolTag {
+    GFX_POOL_TAG_OTHER,
+    GFX_POOL_TAG_GRAPH,   // rendering_graph_node processing
+    GFX_POOL_TAG_HUD,
+    GFX_POOL_TAG_TEXT,    // text labels, menus, dialogs, puppyprint
+    GFX_POOL_TAG_EFFECTS, // envfx particles
+    GFX_POOL_TAG_COUNT,
+};
+
+#if PUPPYPRINT_DEBUG
+extern u8 gGfxPoolTag;
+extern u32 gGfxPoolTagUsage[GFX_POOL_TAG_COUNT];
+extern u32 gGfxPoolTagUsageLast[GFX_POOL_TAG_COUNT];
+// Attribute subsequent alloc_display_list calls to a subsystem.
+#define GFX_POOL_TAG(tag) (gGfxPoolTag = (tag))
+#else
+#define GFX_POOL_TAG(tag)
+#endif
+
+// Subsystems tracked by the main pool memory accounting.
+enum MemTag {
+    MEM_TAG_OTHER,
+    MEM_TAG_SEGMENTS, // segment data loaded by the level script
+    MEM_TAG_SURFACES, // collision surface, node and BVH pools
+    MEM_TAG_ANIMS,    // Mario animation and demo input buffers
+    MEM_TAG_POOLS,    // memory pools and alloc-only pools, contents included
+    MEM_TAG_COUNT,
+};
+
+#if PUPPYPRINT_DEBUG
+extern u8 gMemTag;
+extern u32 gMemTagUsage[MEM_TAG_COUNT];
+extern u32 gMemTagPeak[MEM_TAG_COUNT];
+// Attribute subsequent main_pool_alloc calls to a subsystem.
+#define MEM_TAG(tag) (gMemTag = (tag))
+
+u32 mem_pool_get_used(struct MemoryPool *pool);
+u32 mem_pool_get_peak(struct MemoryPool *pool);
+u32 mem_pool_get_total(struct MemoryPool *pool);
+#else
+#define MEM_TAG(tag)
+#endif
+
 void *alloc_display_list(u32 size);
 void setup_dma_table_list(struct DmaHandlerList *list, void *srcAddr, void *buffer);
 s32 load_patchable_table(struct DmaHandlerList *list, s32 index);
 
+struct DmaRequest *dma_read_async(u8 *dest, u8 *srcStart, u8 *srcEnd, s32 priority,
+                                  void (*callback)(struct DmaRequest *));
+s32 dma_async_process(s32 flag);
+void dma_async_wait(struct DmaRequest *req);
+
+#ifdef MENU_SEGMENT_CACHE
+void segment_cache_init(void);
+void segment_cache_retain(u8 *srcStart, u8 *srcEnd);
+#endif
+
+void create_segment_loader_thread(void);
+void segment_prefetch(u8 *srcStart, u8 *srcEnd);
+s32 segment_prefetch_poll(u8 *srcStart, u8 *srcEnd);
+u8 *segment_prefetch_take(u8 *srcStart, u8 *srcEnd);
+void segment_prefetch_release(u8 *buffer);
+void segment_loader_set_busy(s32 busy);
+
 #endif // MEMORY_H
@@ -0,0 +1,169 @@
+#include <ultra64.h>
+
+#include "sm64.h"
+#include "micro_coin.h"
+
+#ifdef MICRO_COIN_POOL
+
+#include "area.h"
+#include "behavior_data.h"
+#include "engine/math_util.h"
+#include "engine/surface_collision.h"
+#include "interaction.h"
+#include "level_update.h"
+#include "model_ids.h"
+#include "object_fields.h"
+#include "object_helpers.h"
+#include "object_list_processor.h"
+
+/**
+ * This file implements the burst coin micro pool. Coins spat out by killed
+ * enemies, coin spurts and similar one-shot sources only ever need a position,
+ * a falling arc and a collected check, yet each one normally costs a full
+ * 'struct Object' plus a behavior script interpretation per frame. The pool
+ * stores them as compact records instead and updates every coin in one loop.
+ *
+ * The physics are a deliberate approximation of bhv_coin_loop: the floor
+ * height is sampled once at spawn and the coin bounces against that plane, so
+ * a burst of 30 coins costs 30 find_floor calls total rather than 30 per
+ * frame. Coins whose spawn point hangs over a death floor are rejected, and
+ * the caller falls back to a real object (which keeps the lava flicker and
+ * moving-floor handling for the rare cases that need it).
+ *
+ * Rendering happens in rendering_graph_node.c (geo_append_micro_coins), which
+ * appends the coin model's current animation-frame display list once per
+ * instance under a billboard matrix — no graph traversal per coin.
+ */
+
+struct MicroCoin gMicroCoinPool[MICRO_COIN_CAPACITY];
+s16 gMicroCoinHighWater = 0;
+
+// Tangibility and overlap mirror the vanilla coin hitbox (radius 100,
+// height 64) against Mario's 37 x 160 cylinder.
+#define MICRO_COIN_TANGIBLE_TIMER 10
+#define MICRO_COIN_PICKUP_RADIUS (100.0f + 37.0f)
+#define MICRO_COIN_HEIGHT 64.0f
+#define MICRO_COIN_GRAVITY 4.0f
+
+void micro_coin_clear(void) {
+    s32 i;
+
+    for (i = 0; i < MICRO_COIN_CAPACITY; i++) {
+        gMicroCoinPool[i].active = FALSE;
+    }
+    gMicroCoinHighWater = 0;
+}
+
+/**
+ * Spawn a burst coin. The launch velocity matches bhv_coin_init: a random
+ * upward kick on top of the caller's base y velocity, with a random lateral
+ * scatter. Returns FALSE (caller should spawn a real object instead) when the
+ * pool is full or the spawn point hangs over a death floor.
+ */
+s32 micro_coin_spawn(f32 x, f32 y, f32 z, f32 baseYVel, s32 type) {
+    struct MicroCoin *coin = NULL;
+    f32 floorHeight;
+    f32 forwardVel;
+    s16 yaw;
+    s32 i;
+
+    for (i = 0; i < MICRO_COIN_CAPACITY; i++) {
+        if (!gMicroCoinPool[i].active) {
+            coin = &gMicroCoinPool[i];
+            break;
+        }
+    }
+    if (coin == NULL) {
+        return FALSE;
+    }
+
+    floorHeight = find_floor_height(x, y + 100.0f, z);
+    if (floorHeight < FLOOR_LOWER_LIMIT_MISC) {
+        return FALSE;
+    }
+
+    forwardVel = random_float() * 10.0f;
+    yaw = random_u16();
+
+    coin->active = TRUE;
+    coin->type = type;
+    coin->timer = 0;
+    vec3f_set(coin->pos, x, y, z);
+    vec3f_set(coin->vel, sins(yaw) * forwardVel,
+              random_float() * 10.0f + 30.0f + baseYVel, coss(yaw) * forwardVel);
+    coin->floorHeight = floorHeight;
+
+    if (i >= gMicroCoinHighWater) {
+        gMicroCoinHighWater = i + 1;
+    }
+    return TRUE;
+}
+
+static void micro_coin_collect(struct MicroCoin *coin) {
+    struct Object *sparkles = spawn_object(gMarioObject, MODEL_SPARKLES, bhvCoinSparklesSpawner);
+
+    sparkles->oPosX = coin->pos[0];
+    sparkles->oPosY = coin->pos[1];
+    sparkles->oPosZ = coin->pos[2];
+
+    micro_coin_interact(gMarioState, coin->type == MICRO_COIN_BLUE ? 5 : 1);
+    coin->active = FALSE;
+}
+
+/**
+ * Batch-update every live micro coin: gravity and floor bounce, the pickup
+ * check against Mario, and the shared lifetime/blink window. One pass, no
+ * per-coin dispatch.
+ */
+void micro_coin_update(void) {
+    struct MarioState *m = gMarioState;
+    s16 highWater = 0;
+    s32 i;
+
+    if (gMarioObject == NULL) {
+        return;
+    }
+
+    for (i = 0; i < gMicroCoinHighWater; i++) {
+        struct MicroCoin *coin = &gMicroCoinPool[i];
+
+        if (!coin->active) {
+            continue;
+        }
+
+        if (++coin->timer >= MICRO_COIN_LIFETIME + MICRO_COIN_BLINK_TIME) {
+            coin->active = FALSE;
+            continue;
+        }
+
+        coin->vel[1] -= MICRO_COIN_GRAVITY;
+        vec3f_add(coin->pos, coin->vel);
+        if (coin->pos[1] <= coin->floorHeight) {
+            coin->pos[1] = coin->floorHeight;
+            if (coin->vel[1] < -17.0f) {
+                coin->vel[1] *= -0.5f;
+            } else {
+                // Settled: kill the lateral scatter along with the bounce.
+                vec3_zero(coin->vel);
+            }
+        }
+
+        if (coin->timer >= MICRO_COIN_TANGIBLE_TIMER) {
+            f32 dx = m->pos[0] - coin->pos[0];
+            f32 dz = m->pos[2] - coin->pos[2];
+
+            if (sqr(dx) + sqr(dz) < sqr(MICRO_COIN_PICKUP_RADIUS)
+                && m->pos[1] < coin->pos[1] + MICRO_COIN_HEIGHT
+                && coin->pos[1] < m->pos[1] + 160.0f) {
+                micro_coin_collect(coin);
+                continue;
+            }
+        }
+
+        highWater = i + 1;
+    }
+
+    gMicroCoinHighWater = highWater;
+}
+
+#endif // MICRO_COIN_POOL
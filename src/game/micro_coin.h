@@ -0,0 +1,38 @@
+#ifndef MICRO_COIN_H
+#define MICRO_COIN_H
+
+#include <PR/ultratypes.h>
+
+#include "types.h"
+
+#ifdef MICRO_COIN_POOL
+
+enum MicroCoinType {
+    MICRO_COIN_YELLOW,
+    MICRO_COIN_BLUE,
+    MICRO_COIN_TYPE_COUNT,
+};
+
+/**
+ * A burst coin stripped down to what its lifetime actually needs. 32 bytes,
+ * so the whole pool is smaller than one 'struct Object'.
+ */
+struct MicroCoin {
+    /*0x00*/ u8 active;
+    /*0x01*/ u8 type; // enum MicroCoinType
+    /*0x02*/ s16 timer;
+    /*0x04*/ Vec3f pos;
+    /*0x10*/ Vec3f vel;
+    /*0x1C*/ f32 floorHeight;
+};
+
+extern struct MicroCoin gMicroCoinPool[MICRO_COIN_CAPACITY];
+extern s16 gMicroCoinHighWater;
+
+void micro_coin_clear(void);
+s32 micro_coin_spawn(f32 x, f32 y, f32 z, f32 baseYVel, s32 type);
+void micro_coin_update(void);
+
+#endif // MICRO_COIN_POOL
+
+#endif // MICRO_COIN_H
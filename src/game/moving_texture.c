@@ -6,6 +6,7 @@
 #include "camera.h"
 #include "rendering_graph_node.h"
 #include "engine/math_util.h"
+#include "game_init.h"
 #include "memory.h"
 #include "save_file.h"
 #include "segment2.h"
@@ -53,12 +54,6 @@
 // First entry in array is texture movement speed for both layouts
 #define MOVTEX_ATTR_SPEED 0
 
-// Different layouts for vertices
-enum MovtexLayouts {
-    MOVTEX_LAYOUT_NOCOLOR,
-    MOVTEX_LAYOUT_COLORED
-};
-
 enum MovtexAttributes {
     MOVTEX_ATTR_NONE,
     // Attributes for movtex vertices
@@ -79,36 +74,6 @@ enum MovtexAttributes {
 #define MOVTEX_ATTR_POS_INDEX MOVTEX_ATTR_X
 #define MOVTEX_ATTR_RGB_INDEX MOVTEX_ATTR_COLORED_R
 
-/**
- * An object containing all info for a mesh with moving textures.
- * Contains the vertices that are animated, but also the display list which
- * determines the connectivity, as well as the texture, texture blend color
- * and drawing layer.
- */
-struct MovtexObject {
-    /// number that geo nodes have as parameter to refer to this mesh
-    u32 geoId;
-    /// which texture to use for this mesh, index into gMovtexIdToTexture
-    s32 textureId;
-    /// amount of moving vertices
-    s32 vtx_count;
-    /// segmented address to movtex mesh with vertices
-    void *movtexVerts;
-    /// display list inserted before moving triangles
-    Gfx *beginDl;
-    /// display list inserted after moving triangles
-    Gfx *endDl;
-    /// display list with the actual moving texture triangles.
-    /// Assumes the animated vertices are buffered and correct texture is set
-    Gfx *triDl;
-    // if the list does not have per-vertex colors, all vertices have these colors
-    u8 r;      /// red
-    u8 g;      /// green
-    u8 b;      /// blue
-    u8 a;      /// alpha
-    s32 layer; /// the drawing layer for this mesh
-};
-
 /// Counters to make textures move iff the game is not paused.
 s16 gMovtexCounter = 1;
 s16 gMovtexCounterPrev = 0;
@@ -719,24 +684,178 @@ void movtex_write_vertex_index(Vtx *verts, s32 index, s16 *movtexVerts, struct M
     }
 }
 
+#ifdef MOVTEX_RETAINED_VTX
+
+/**
+ * Pool for retained movtex vertex buffers. Sized for the busiest level (SSL,
+ * with the pyramid pathway, pyramid sides and sand pits visible at once) and
+ * reset whenever the level changes, which also invalidates the per-mesh
+ * buffers through their retainedLevel stamp.
+ */
+#define MOVTEX_RETAINED_POOL_SIZE 0x1800
+static u8 sMovtexRetainedPool[MOVTEX_RETAINED_POOL_SIZE] ALIGNED16;
+static u32 sMovtexRetainedPoolUsed = 0;
+static s16 sMovtexRetainedPoolLevel = LEVEL_NONE;
+
+/// Custom meshes added through movtex_register, searched after the built-in tables.
+#define MOVTEX_CUSTOM_MESHES 8
+static struct MovtexObject *sMovtexCustom[MOVTEX_CUSTOM_MESHES];
+static s8 sMovtexCustomLayout[MOVTEX_CUSTOM_MESHES];
+
+/**
+ * Bump-allocate from the retained vertex pool, or NULL when it is full.
+ */
+static void *movtex_retained_alloc(u32 size) {
+    void *addr;
+
+    size = ALIGN16(size);
+    if (sMovtexRetainedPoolUsed + size > MOVTEX_RETAINED_POOL_SIZE) {
+        return NULL;
+    }
+    addr = &sMovtexRetainedPool[sMovtexRetainedPoolUsed];
+    sMovtexRetainedPoolUsed += size;
+    return addr;
+}
+
+/**
+ * Patch the texture coordinates of a retained vertex buffer from the current
+ * movtex data. This is the only per-frame work scrolling actually requires:
+ * update_moving_texture_offset advances the base vertex's s (or t) in the
+ * segment data, and every vertex's coordinate is that base plus a constant
+ * offset, so two short writes per vertex track the scroll exactly as the full
+ * rebuild did.
+ */
+static void movtex_patch_texcoords(Vtx *verts, s16 *movtexVerts, s32 vtxCount, s8 attrLayout) {
+    s32 stride = (attrLayout == MOVTEX_LAYOUT_NOCOLOR) ? 5 : 8;
+    s32 attrS = (attrLayout == MOVTEX_LAYOUT_NOCOLOR) ? MOVTEX_ATTR_NOCOLOR_S : MOVTEX_ATTR_COLORED_S;
+    s16 baseS = movtexVerts[attrS];
+    s16 baseT = movtexVerts[attrS + 1];
+    s16 *entry;
+    s32 i;
+
+    verts[0].v.tc[0] = baseS;
+    verts[0].v.tc[1] = baseT;
+    for (i = 1; i < vtxCount; i++) {
+        entry = &movtexVerts[i * stride];
+        verts[i].v.tc[0] = baseS + ((entry[attrS] * 32) * 32U);
+        verts[i].v.tc[1] = baseT + ((entry[attrS + 1] * 32) * 32U);
+    }
+}
+
+/**
+ * Return a vertex buffer for a MovtexObject, building the retained copies on
+ * the first draw in a level and only patching texture coordinates afterwards.
+ * Two copies alternate by frame parity so the CPU never writes the buffer the
+ * RCP may still be rendering from. Falls back to a throwaway frame pool build
+ * if the retained pool is full.
+ */
+static Vtx *movtex_retained_verts(s16 *movtexVerts, struct MovtexObject *movtexList, s8 attrLayout) {
+    u32 size = movtexList->vtx_count * sizeof(Vtx);
+    Vtx *verts;
+    s32 i;
+
+    if (sMovtexRetainedPoolLevel != gCurrLevelNum) {
+        sMovtexRetainedPoolUsed = 0;
+        sMovtexRetainedPoolLevel = gCurrLevelNum;
+    }
+
+    if (movtexList->retainedLevel != gCurrLevelNum) {
+        movtexList->retainedVtx[0] = movtex_retained_alloc(size);
+        movtexList->retainedVtx[1] = movtex_retained_alloc(size);
+        if (movtexList->retainedVtx[1] == NULL) {
+            verts = alloc_display_list(size);
+            if (verts != NULL) {
+                movtex_write_vertex_first(verts, movtexVerts, movtexList, attrLayout);
+                for (i = 1; i < movtexList->vtx_count; i++) {
+                    movtex_write_vertex_index(verts, i, movtexVerts, movtexList, attrLayout);
+                }
+            }
+            return verts;
+        }
+        movtex_write_vertex_first(movtexList->retainedVtx[0], movtexVerts, movtexList, attrLayout);
+        for (i = 1; i < movtexList->vtx_count; i++) {
+            movtex_write_vertex_index(movtexList->retainedVtx[0], i, movtexVerts, movtexList, attrLayout);
+        }
+        bcopy(movtexList->retainedVtx[0], movtexList->retainedVtx[1], size);
+        movtexList->retainedLevel = gCurrLevelNum;
+    }
+
+    verts = movtexList->retainedVtx[gGlobalTimer & 1];
+    movtex_patch_texcoords(verts, movtexVerts, movtexList->vtx_count, attrLayout);
+    return verts;
+}
+
+/**
+ * Register a custom MovtexObject (e.g. a waterfall or shifting sand mesh) so
+ * the geo_movtex_draw_nocolor / geo_movtex_draw_colored nodes can find it by
+ * geoId without it being in the built-in tables. 'attrLayout' is one of
+ * MOVTEX_LAYOUT_NOCOLOR and MOVTEX_LAYOUT_COLORED and must match the draw
+ * node used. Registering an already registered geoId replaces the old entry.
+ * Returns FALSE if the registration table is full.
+ */
+s32 movtex_register(struct MovtexObject *movtexObject, s8 attrLayout) {
+    s32 i;
+
+    for (i = 0; i < MOVTEX_CUSTOM_MESHES; i++) {
+        if (sMovtexCustom[i] != NULL && sMovtexCustom[i]->geoId == movtexObject->geoId
+            && sMovtexCustomLayout[i] == attrLayout) {
+            sMovtexCustom[i] = movtexObject;
+            return TRUE;
+        }
+    }
+    for (i = 0; i < MOVTEX_CUSTOM_MESHES; i++) {
+        if (sMovtexCustom[i] == NULL) {
+            sMovtexCustom[i] = movtexObject;
+            sMovtexCustomLayout[i] = attrLayout;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * Find a registered custom MovtexObject by geoId, or NULL.
+ */
+static struct MovtexObject *movtex_find_custom(u32 geoId, s8 attrLayout) {
+    s32 i;
+
+    for (i = 0; i < MOVTEX_CUSTOM_MESHES; i++) {
+        if (sMovtexCustom[i] != NULL && sMovtexCustom[i]->geoId == geoId
+            && sMovtexCustomLayout[i] == attrLayout) {
+            return sMovtexCustom[i];
+        }
+    }
+    return NULL;
+}
+
+#endif // MOVTEX_RETAINED_VTX
+
 /**
  * Generate a displaylist for a MovtexObject.
  * 'attrLayout' is one of MOVTEX_LAYOUT_NOCOLOR and MOVTEX_LAYOUT_COLORED.
  */
 Gfx *movtex_gen_list(s16 *movtexVerts, struct MovtexObject *movtexList, s8 attrLayout) {
+#ifdef MOVTEX_RETAINED_VTX
+    Vtx *verts = movtex_retained_verts(movtexVerts, movtexList, attrLayout);
+#else
     Vtx *verts = alloc_display_list(movtexList->vtx_count * sizeof(*verts));
+#endif
     Gfx *gfxHead = alloc_display_list(11 * sizeof(*gfxHead));
     Gfx *gfx = gfxHead;
+#ifndef MOVTEX_RETAINED_VTX
     s32 i;
+#endif
 
     if (verts == NULL || gfxHead == NULL) {
         return NULL;
     }
 
+#ifndef MOVTEX_RETAINED_VTX
     movtex_write_vertex_first(verts, movtexVerts, movtexList, attrLayout);
     for (i = 1; i < movtexList->vtx_count; i++) {
         movtex_write_vertex_index(verts, i, movtexVerts, movtexList, attrLayout);
     }
+#endif
 
     gSPDisplayList(gfx++, movtexList->beginDl);
     gLoadBlockTexture(gfx++, 32, 32, G_IM_FMT_RGBA, gMovtexIdToTexture[movtexList->textureId]);
@@ -769,6 +888,17 @@ Gfx *geo_movtex_draw_nocolor(s32 callContext, struct GraphNode *node, UNUSED Mat
             }
             i++;
         }
+#ifdef MOVTEX_RETAINED_VTX
+        if (gfx == NULL) {
+            struct MovtexObject *custom = movtex_find_custom(asGenerated->parameter, MOVTEX_LAYOUT_NOCOLOR);
+            if (custom != NULL) {
+                SET_GRAPH_NODE_LAYER(asGenerated->fnNode.node.flags, custom->layer);
+                movtexVerts = segmented_to_virtual(custom->movtexVerts);
+                update_moving_texture_offset(movtexVerts, MOVTEX_ATTR_NOCOLOR_S);
+                gfx = movtex_gen_list(movtexVerts, custom, MOVTEX_LAYOUT_NOCOLOR);
+            }
+        }
+#endif
     }
     return gfx;
 }
@@ -795,6 +925,17 @@ Gfx *geo_movtex_draw_colored(s32 callContext, struct GraphNode *node, UNUSED Mat
             }
             i++;
         }
+#ifdef MOVTEX_RETAINED_VTX
+        if (gfx == NULL) {
+            struct MovtexObject *custom = movtex_find_custom(asGenerated->parameter, MOVTEX_LAYOUT_COLORED);
+            if (custom != NULL) {
+                SET_GRAPH_NODE_LAYER(asGenerated->fnNode.node.flags, custom->layer);
+                movtexVerts = segmented_to_virtual(custom->movtexVerts);
+                update_moving_texture_offset(movtexVerts, MOVTEX_ATTR_COLORED_S);
+                gfx = movtex_gen_list(movtexVerts, custom, MOVTEX_LAYOUT_COLORED);
+            }
+        }
+#endif
     }
     return gfx;
 }
@@ -892,3 +1033,122 @@ Gfx *geo_movtex_update_horizontal(s32 callContext, struct GraphNode *node, UNUSE
     }
     return NULL;
 }
+
+#ifdef TEXTURE_CYCLE_REGISTRY
+/**
+ * One frame-cycled material. 'images' caches the addresses of every G_SETTIMG
+ * command in the registered display list that points at one of the material's
+ * frames, so the per-frame update is a handful of word writes.
+ */
+struct TextureCycle {
+    const Texture *const *frames;
+    s16 frameCount;
+    s16 delay;
+    s16 imageCount;
+    Gfx *images[TEXTURE_CYCLE_MAX_IMAGES];
+};
+
+static struct TextureCycle sTextureCycles[TEXTURE_CYCLE_MAX_MATERIALS];
+static s16 sTextureCycleCount = 0;
+
+/**
+ * Forget all registered materials. Called when areas are unloaded; the patched
+ * display lists go away with their segment.
+ */
+void texture_cycle_clear(void) {
+    sTextureCycleCount = 0;
+}
+
+/**
+ * Walk a (possibly nested) display list and record every G_SETTIMG command
+ * whose image is one of the cycle's frames.
+ */
+static void texture_cycle_scan(struct TextureCycle *cycle, Gfx *dl) {
+    Gfx *returnStack[4];
+    s32 depth = 0;
+    s32 i;
+
+    while (dl != NULL) {
+        s32 cmd = (dl->words.w0 >> 24) & 0xFF;
+
+        if (cmd == G_ENDDL) {
+            if (depth == 0) {
+                break;
+            }
+            dl = returnStack[--depth];
+            continue;
+        }
+        if (cmd == G_DL) {
+            if (((dl->words.w0 >> 16) & 0xFF) == G_DL_PUSH && depth < 4) {
+                returnStack[depth++] = dl + 1;
+            }
+            dl = segmented_to_virtual((void *)dl->words.w1);
+            continue;
+        }
+        if (cmd == G_SETTIMG && cycle->imageCount < TEXTURE_CYCLE_MAX_IMAGES) {
+            for (i = 0; i < cycle->frameCount; i++) {
+                if (dl->words.w1 == (uintptr_t)cycle->frames[i]) {
+                    cycle->images[cycle->imageCount++] = dl;
+                    break;
+                }
+            }
+        }
+        dl++;
+    }
+}
+
+/**
+ * Register a material for frame cycling. 'frames' must use the same (segmented
+ * or virtual) address space as the display list's G_SETTIMG commands, and the
+ * display list must be retained data, not built per frame. Registering the
+ * same display list again is a no-op. Returns FALSE when the registry or the
+ * image table is full.
+ */
+s32 texture_cycle_register(Gfx *displayList, const Texture *const *frames, s16 frameCount, s16 delay) {
+    struct TextureCycle *cycle;
+    s32 i;
+
+    if (sTextureCycleCount >= TEXTURE_CYCLE_MAX_MATERIALS || frameCount <= 0 || delay <= 0) {
+        return FALSE;
+    }
+    for (i = 0; i < sTextureCycleCount; i++) {
+        if (sTextureCycles[i].frames == frames) {
+            return TRUE;
+        }
+    }
+    cycle = &sTextureCycles[sTextureCycleCount];
+    cycle->frames = frames;
+    cycle->frameCount = frameCount;
+    cycle->delay = delay;
+    cycle->imageCount = 0;
+    texture_cycle_scan(cycle, segmented_to_virtual(displayList));
+    if (cycle->imageCount == 0) {
+        return FALSE;
+    }
+    sTextureCycleCount++;
+    return TRUE;
+}
+
+/**
+ * Advance all registered cycles. Patches the retained G_SETTIMG words in
+ * place, so the cost per material is independent of how many surfaces (or
+ * how many frames of geometry) share it. Runs once per logic frame, before
+ * the frame's task is built.
+ */
+void texture_cycle_update(void) {
+    s32 i, j;
+
+    for (i = 0; i < sTextureCycleCount; i++) {
+        struct TextureCycle *cycle = &sTextureCycles[i];
+        s32 frame = (gAreaUpdateCounter / cycle->delay) % cycle->frameCount;
+        uintptr_t image = (uintptr_t)cycle->frames[frame];
+
+        if (cycle->images[0]->words.w1 == image) {
+            continue; // still on the same frame
+        }
+        for (j = 0; j < cycle->imageCount; j++) {
+            cycle->images[j]->words.w1 = image;
+        }
+    }
+}
+#endif // TEXTURE_CYCLE_REGISTRY
@@ -23,6 +23,49 @@ enum MovtexRectTextureId {
     TEX_YELLOW_TRI_TTC
 };
 
+// Different layouts for movtex mesh vertices
+enum MovtexLayouts {
+    MOVTEX_LAYOUT_NOCOLOR,
+    MOVTEX_LAYOUT_COLORED
+};
+
+/**
+ * An object containing all info for a mesh with moving textures.
+ * Contains the vertices that are animated, but also the display list which
+ * determines the connectivity, as well as the texture, texture blend color
+ * and drawing layer.
+ */
+struct MovtexObject {
+    /// number that geo nodes have as parameter to refer to this mesh
+    u32 geoId;
+    /// which texture to use for this mesh, index into gMovtexIdToTexture
+    s32 textureId;
+    /// amount of moving vertices
+    s32 vtx_count;
+    /// segmented address to movtex mesh with vertices
+    void *movtexVerts;
+    /// display list inserted before moving triangles
+    Gfx *beginDl;
+    /// display list inserted after moving triangles
+    Gfx *endDl;
+    /// display list with the actual moving texture triangles.
+    /// Assumes the animated vertices are buffered and correct texture is set
+    Gfx *triDl;
+    // if the list does not have per-vertex colors, all vertices have these colors
+    u8 r;      /// red
+    u8 g;      /// green
+    u8 b;      /// blue
+    u8 a;      /// alpha
+    s32 layer; /// the drawing layer for this mesh
+#ifdef MOVTEX_RETAINED_VTX
+    /// double buffered retained vertex buffers, built once per level.
+    /// Left zero-initialized in the built-in tables; filled in on first draw.
+    Vtx *retainedVtx[2];
+    /// level the retained buffers were built for, LEVEL_NONE if not built
+    s16 retainedLevel;
+#endif
+};
+
 /**
  * Contains an id and an array of MovtexQuad structs.
  */
@@ -122,4 +165,14 @@ Gfx *geo_movtex_draw_colored_2_no_update(s32 callContext, struct GraphNode *node
 Gfx *geo_movtex_update_horizontal(s32 callContext, struct GraphNode *node, UNUSED Mat4 mtx);
 Gfx *geo_movtex_draw_colored_no_update(s32 callContext, struct GraphNode *node, UNUSED Mat4 mtx);
 
+#ifdef MOVTEX_RETAINED_VTX
+s32 movtex_register(struct MovtexObject *movtexObject, s8 attrLayout);
+#endif
+
+#ifdef TEXTURE_CYCLE_REGISTRY
+void texture_cycle_clear(void);
+s32 texture_cycle_register(Gfx *displayList, const Texture *const *frames, s16 frameCount, s16 delay);
+void texture_cycle_update(void);
+#endif
+
 #endif // MOVING_TEXTURE_H
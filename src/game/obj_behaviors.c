@@ -274,7 +274,11 @@ void calc_new_obj_vel_and_pos_y(struct Surface *objFloor, f32 objFloorY, f32 obj
         }
 
         calc_obj_friction(&objFriction, floor_nY);
+#ifdef OBJ_FAST_PHYSICS
+        o->oForwardVel = fast_sqrtf(sqr(objVelX) + sqr(objVelZ)) * objFriction;
+#else
         o->oForwardVel = sqrtf(sqr(objVelX) + sqr(objVelZ)) * objFriction;
+#endif
     }
 }
 
@@ -336,7 +340,11 @@ void calc_new_obj_vel_and_pos_y_underwater(struct Surface *objFloor, f32 floorY,
 
     // Decreases both vertical velocity and forward velocity. Likely so that skips above
     // don't loop infinitely.
+#ifdef OBJ_FAST_PHYSICS
+    o->oForwardVel = fast_sqrtf(sqr(objVelX) + sqr(objVelZ)) * 0.8f;
+#else
     o->oForwardVel = sqrtf(sqr(objVelX) + sqr(objVelZ)) * 0.8f;
+#endif
     o->oVelY *= 0.8f;
 }
 
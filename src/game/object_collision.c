@@ -4,6 +4,8 @@
 #include "debug.h"
 #include "interaction.h"
 #include "mario.h"
+#include "memory.h"
+#include "object_helpers.h"
 #include "object_list_processor.h"
 #include "spawn_object.h"
 #include "engine/math_util.h"
@@ -93,6 +95,294 @@ void clear_object_collision(struct Object *a) {
     }
 }
 
+#ifdef COLLISION_OBJECT_BROADPHASE
+
+// The hash is a wrapped grid over the XZ plane; queries expand their bucket range by the
+// largest inserted radius, so wrapping never loses a pair, only revisits cells on huge maps.
+#define COLLISION_HASH_CELL_SHIFT 9 // 512-unit buckets.
+#define COLLISION_HASH_CELLS     16 // Buckets per axis (must be a power of 2).
+
+struct CollisionHashEntry {
+    struct Object *obj;
+    struct CollisionHashEntry *next;
+    s16 list;       // Object list the object came from (OBJ_LIST_*).
+    s16 seq;        // Position within that list, used to pair each same-list couple once.
+    s16 intangible; // Skipped by collision checks, but visible to proximity queries.
+};
+
+static struct CollisionHashEntry **sCollisionHash = NULL;
+static f32 sCollisionHashMaxRadius = 0.0f;
+// Whether the hash can serve behavior proximity queries: set after a successful
+// build, cleared at the end of the object update pass (positions go stale) and
+// when an object spawns into a hashed list mid-frame (it would be missed).
+static s32 sCollisionHashValid = FALSE;
+
+// The lists inserted by build_collision_hash. Queries for any other list fall
+// back to the plain list scan.
+#define COLLISION_HASH_LIST_MASK ((1 << OBJ_LIST_PLAYER) | (1 << OBJ_LIST_POLELIKE) \
+                                | (1 << OBJ_LIST_LEVEL) | (1 << OBJ_LIST_GENACTOR) \
+                                | (1 << OBJ_LIST_PUSHABLE) | (1 << OBJ_LIST_SURFACE) \
+                                | (1 << OBJ_LIST_DESTRUCTIVE))
+
+#define COLLISION_HASH_BUCKET(cx, cz) (sCollisionHash[(((cx) & (COLLISION_HASH_CELLS - 1)) * COLLISION_HASH_CELLS) + ((cz) & (COLLISION_HASH_CELLS - 1))])
+
+/**
+ * Insert every tangible object of a list into the hash. Returns FALSE if the frame pool
+ * ran out, in which case the caller falls back to the plain list walks.
+ */
+static s32 collision_hash_add_list(s32 list) {
+    struct Object *listHead = (struct Object *) &gObjectLists[list];
+    struct Object *obj = (struct Object *) listHead->header.next;
+    s16 seq = 0;
+
+    while (obj != listHead) {
+        struct CollisionHashEntry *entry = alloc_display_list(sizeof(struct CollisionHashEntry));
+        if (entry == NULL) {
+            return FALSE;
+        }
+        struct CollisionHashEntry **bucket = &COLLISION_HASH_BUCKET(((s32) obj->oPosX) >> COLLISION_HASH_CELL_SHIFT,
+                                                                    ((s32) obj->oPosZ) >> COLLISION_HASH_CELL_SHIFT);
+        entry->obj = obj;
+        entry->list = list;
+        entry->seq = seq;
+        entry->intangible = (obj->oIntangibleTimer != 0);
+        entry->next = *bucket;
+        *bucket = entry;
+        if (!entry->intangible && obj->hitboxRadius > sCollisionHashMaxRadius) {
+            sCollisionHashMaxRadius = obj->hitboxRadius;
+        }
+        seq++;
+        obj = (struct Object *) obj->header.next;
+    }
+    return TRUE;
+}
+
+/**
+ * Build the frame's spatial hash over every collision-relevant object list.
+ */
+static s32 build_collision_hash(void) {
+    sCollisionHash = alloc_display_list(sizeof(struct CollisionHashEntry *) * COLLISION_HASH_CELLS * COLLISION_HASH_CELLS);
+    if (sCollisionHash == NULL) {
+        return FALSE;
+    }
+    bzero(sCollisionHash, sizeof(struct CollisionHashEntry *) * COLLISION_HASH_CELLS * COLLISION_HASH_CELLS);
+    sCollisionHashMaxRadius = 0.0f;
+
+    return collision_hash_add_list(OBJ_LIST_PLAYER)
+        && collision_hash_add_list(OBJ_LIST_POLELIKE)
+        && collision_hash_add_list(OBJ_LIST_LEVEL)
+        && collision_hash_add_list(OBJ_LIST_GENACTOR)
+        && collision_hash_add_list(OBJ_LIST_PUSHABLE)
+        && collision_hash_add_list(OBJ_LIST_SURFACE)
+        && collision_hash_add_list(OBJ_LIST_DESTRUCTIVE);
+}
+
+/**
+ * Test 'a' against every hashed object of 'list' within broadphase range. 'minSeq' pairs
+ * each same-list couple exactly once, mirroring the partial list walks; pass -1 when 'a'
+ * is not from 'list'.
+ */
+static void check_collision_in_hash(struct Object *a, s32 list, s32 minSeq) {
+    if (a->oIntangibleTimer != 0) {
+        return;
+    }
+    f32 range = a->hitboxRadius + sCollisionHashMaxRadius;
+    s32 minCX = ((s32) (a->oPosX - range)) >> COLLISION_HASH_CELL_SHIFT;
+    s32 maxCX = ((s32) (a->oPosX + range)) >> COLLISION_HASH_CELL_SHIFT;
+    s32 minCZ = ((s32) (a->oPosZ - range)) >> COLLISION_HASH_CELL_SHIFT;
+    s32 maxCZ = ((s32) (a->oPosZ + range)) >> COLLISION_HASH_CELL_SHIFT;
+    // Never visit a wrapped bucket twice.
+    if ((maxCX - minCX) >= COLLISION_HASH_CELLS) maxCX = minCX + COLLISION_HASH_CELLS - 1;
+    if ((maxCZ - minCZ) >= COLLISION_HASH_CELLS) maxCZ = minCZ + COLLISION_HASH_CELLS - 1;
+
+    for (s32 cx = minCX; cx <= maxCX; cx++) {
+        for (s32 cz = minCZ; cz <= maxCZ; cz++) {
+            struct CollisionHashEntry *entry = COLLISION_HASH_BUCKET(cx, cz);
+            for (; entry != NULL; entry = entry->next) {
+                if (entry->intangible || entry->list != list || entry->seq <= minSeq || entry->obj == a) {
+                    continue;
+                }
+                if (detect_object_hitbox_overlap(a, entry->obj) && entry->obj->hurtboxRadius != 0.0f) {
+                    detect_object_hurtbox_overlap(a, entry->obj);
+                }
+            }
+        }
+    }
+}
+
+static void check_player_object_collision_hash(void) {
+    struct Object *playerObj = (struct Object *) &gObjectLists[OBJ_LIST_PLAYER];
+    struct Object *nextObj = (struct Object *) playerObj->header.next;
+    s16 seq = 0;
+
+    while (nextObj != playerObj) {
+        check_collision_in_hash(nextObj, OBJ_LIST_PLAYER, seq);
+        check_collision_in_hash(nextObj, OBJ_LIST_POLELIKE, -1);
+        check_collision_in_hash(nextObj, OBJ_LIST_LEVEL, -1);
+        check_collision_in_hash(nextObj, OBJ_LIST_GENACTOR, -1);
+        check_collision_in_hash(nextObj, OBJ_LIST_PUSHABLE, -1);
+        check_collision_in_hash(nextObj, OBJ_LIST_SURFACE, -1);
+        check_collision_in_hash(nextObj, OBJ_LIST_DESTRUCTIVE, -1);
+        seq++;
+        nextObj = (struct Object *) nextObj->header.next;
+    }
+}
+
+static void check_pushable_object_collision_hash(void) {
+    struct Object *pushableObj = (struct Object *) &gObjectLists[OBJ_LIST_PUSHABLE];
+    struct Object *nextObj = (struct Object *) pushableObj->header.next;
+    s16 seq = 0;
+
+    while (nextObj != pushableObj) {
+        check_collision_in_hash(nextObj, OBJ_LIST_PUSHABLE, seq);
+        seq++;
+        nextObj = (struct Object *) nextObj->header.next;
+    }
+}
+
+static void check_destructive_object_collision_hash(void) {
+    struct Object *destructiveObj = (struct Object *) &gObjectLists[OBJ_LIST_DESTRUCTIVE];
+    struct Object *nextObj = (struct Object *) destructiveObj->header.next;
+    s16 seq = 0;
+
+    while (nextObj != destructiveObj) {
+        if (nextObj->oDistanceToMario < 2000.0f && !(nextObj->activeFlags & ACTIVE_FLAG_DESTRUCTIVE_OBJ_DONT_DESTROY)) {
+            check_collision_in_hash(nextObj, OBJ_LIST_DESTRUCTIVE, seq);
+            check_collision_in_hash(nextObj, OBJ_LIST_GENACTOR, -1);
+            check_collision_in_hash(nextObj, OBJ_LIST_PUSHABLE, -1);
+            check_collision_in_hash(nextObj, OBJ_LIST_SURFACE, -1);
+        }
+        seq++;
+        nextObj = (struct Object *) nextObj->header.next;
+    }
+}
+
+/**
+ * Whether behavior proximity queries can use the hash for this object list.
+ */
+s32 collision_hash_usable(s32 list) {
+    return sCollisionHashValid && (COLLISION_HASH_LIST_MASK & (1 << list));
+}
+
+/**
+ * Invalidate the hash for proximity queries. Called once object updates are
+ * done (positions have moved since the hash was built) and when an object
+ * spawns into a hashed list mid-frame, since the hash would not contain it.
+ */
+void collision_hash_invalidate(void) {
+    sCollisionHashValid = FALSE;
+}
+
+void collision_hash_note_spawn(s32 list) {
+    if (COLLISION_HASH_LIST_MASK & (1 << list)) {
+        sCollisionHashValid = FALSE;
+    }
+}
+
+/**
+ * Hash-backed version of cur_obj_find_nearest_object_with_behavior. Searches
+ * outward in rings of buckets from the querying object's cell and stops once
+ * the best match is provably closer than anything an unvisited ring could
+ * hold. 'behavior' must already be a virtual address, and 'list' a hashed
+ * list (collision_hash_usable). Matches the list-scan semantics: deactivated
+ * objects and 'from' itself are skipped, distance is the full 3D distance.
+ */
+struct Object *collision_hash_find_nearest_with_behavior(struct Object *from, const BehaviorScript *behavior,
+                                                         s32 list, f32 *dist) {
+    struct Object *closestObj = NULL;
+    f32 minDist = 0x20000;
+    s32 baseCX = ((s32) from->oPosX) >> COLLISION_HASH_CELL_SHIFT;
+    s32 baseCZ = ((s32) from->oPosZ) >> COLLISION_HASH_CELL_SHIFT;
+    s32 ring;
+
+    for (ring = 0; ring <= COLLISION_HASH_CELLS / 2; ring++) {
+        // Anything in an unvisited ring is at least (ring - 1) full cells away.
+        if (closestObj != NULL && minDist <= (f32) ((ring - 1) << COLLISION_HASH_CELL_SHIFT)) {
+            break;
+        }
+        for (s32 cx = baseCX - ring; cx <= baseCX + ring; cx++) {
+            for (s32 cz = baseCZ - ring; cz <= baseCZ + ring; cz++) {
+                // Only the outer shell of the ring is new.
+                if (ring != 0 && cx != baseCX - ring && cx != baseCX + ring
+                 && cz != baseCZ - ring && cz != baseCZ + ring) {
+                    continue;
+                }
+                struct CollisionHashEntry *entry = COLLISION_HASH_BUCKET(cx, cz);
+                for (; entry != NULL; entry = entry->next) {
+                    struct Object *obj = entry->obj;
+                    if (entry->list != list || obj == from
+                     || obj->behavior != (const void *) behavior
+                     || obj->activeFlags == ACTIVE_FLAG_DEACTIVATED) {
+                        continue;
+                    }
+                    f32 objDist = dist_between_objects(from, obj);
+                    if (objDist < minDist) {
+                        closestObj = obj;
+                        minDist = objDist;
+                    }
+                }
+            }
+        }
+    }
+
+    *dist = minDist;
+    return closestObj;
+}
+
+/**
+ * Collect every active object with the given behavior within 'radius' (3D) of
+ * (x, y, z) into 'dest', probing only the buckets the radius overlaps.
+ * 'behavior' must be virtual and 'list' hashed. Returns the number collected.
+ */
+s32 collision_hash_collect_with_behavior_in_radius(const BehaviorScript *behavior, s32 list,
+                                                   f32 x, f32 y, f32 z, f32 radius,
+                                                   struct Object **dest, s32 maxCount) {
+    s32 count = 0;
+    s32 minCX = ((s32) (x - radius)) >> COLLISION_HASH_CELL_SHIFT;
+    s32 maxCX = ((s32) (x + radius)) >> COLLISION_HASH_CELL_SHIFT;
+    s32 minCZ = ((s32) (z - radius)) >> COLLISION_HASH_CELL_SHIFT;
+    s32 maxCZ = ((s32) (z + radius)) >> COLLISION_HASH_CELL_SHIFT;
+    // Never visit a wrapped bucket twice.
+    if ((maxCX - minCX) >= COLLISION_HASH_CELLS) maxCX = minCX + COLLISION_HASH_CELLS - 1;
+    if ((maxCZ - minCZ) >= COLLISION_HASH_CELLS) maxCZ = minCZ + COLLISION_HASH_CELLS - 1;
+
+    for (s32 cx = minCX; cx <= maxCX; cx++) {
+        for (s32 cz = minCZ; cz <= maxCZ; cz++) {
+            struct CollisionHashEntry *entry = COLLISION_HASH_BUCKET(cx, cz);
+            for (; entry != NULL; entry = entry->next) {
+                struct Object *obj = entry->obj;
+                if (entry->list != list
+                 || obj->behavior != (const void *) behavior
+                 || obj->activeFlags == ACTIVE_FLAG_DEACTIVATED) {
+                    continue;
+                }
+                if (sqr(obj->oPosX - x) + sqr(obj->oPosY - y) + sqr(obj->oPosZ - z) > sqr(radius)) {
+                    continue;
+                }
+                // Wrapped buckets can alias; don't return the same object twice.
+                s32 duplicate = FALSE;
+                for (s32 i = 0; i < count; i++) {
+                    if (dest[i] == obj) {
+                        duplicate = TRUE;
+                        break;
+                    }
+                }
+                if (duplicate) {
+                    continue;
+                }
+                if (count < maxCount) {
+                    dest[count++] = obj;
+                } else {
+                    return count;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+#endif // COLLISION_OBJECT_BROADPHASE
+
 void check_collision_in_list(struct Object *a, struct Object *b, struct Object *c) {
     if (a->oIntangibleTimer == 0) {
         while (b != c) {
@@ -170,6 +460,17 @@ void detect_object_collisions(void) {
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_LEVEL]);
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_SURFACE]);
     clear_object_collision((struct Object *) &gObjectLists[OBJ_LIST_DESTRUCTIVE]);
+#ifdef COLLISION_OBJECT_BROADPHASE
+    sCollisionHashValid = FALSE;
+    if (build_collision_hash()) {
+        // Behavior proximity queries may use the hash until it is invalidated.
+        sCollisionHashValid = TRUE;
+        check_player_object_collision_hash();
+        check_destructive_object_collision_hash();
+        check_pushable_object_collision_hash();
+        return;
+    }
+#endif
     check_player_object_collision();
     check_destructive_object_collision();
     check_pushable_object_collision();
@@ -1,6 +1,25 @@
 #ifndef OBJECT_COLLISION_H
 #define OBJECT_COLLISION_H
 
+#include <PR/ultratypes.h>
+
+#include "types.h"
+
 void detect_object_collisions(void);
 
+#ifdef COLLISION_OBJECT_BROADPHASE
+// Proximity query API over the per-frame collision broadphase hash. The hash
+// is only usable between detect_object_collisions and the end of the object
+// update pass, and only for the object lists it covers; check
+// collision_hash_usable first and fall back to a list scan otherwise.
+s32 collision_hash_usable(s32 list);
+void collision_hash_invalidate(void);
+void collision_hash_note_spawn(s32 list);
+struct Object *collision_hash_find_nearest_with_behavior(struct Object *from, const BehaviorScript *behavior,
+                                                         s32 list, f32 *dist);
+s32 collision_hash_collect_with_behavior_in_radius(const BehaviorScript *behavior, s32 list,
+                                                   f32 x, f32 y, f32 z, f32 radius,
+                                                   struct Object **dest, s32 maxCount);
+#endif
+
 #endif // OBJECT_COLLISION_H
@@ -2,6 +2,7 @@
 
 #include "sm64.h"
 #include "area.h"
+#include "audio/external.h"
 #include "behavior_actions.h"
 #include "behavior_data.h"
 #include "camera.h"
@@ -20,7 +21,9 @@
 #include "mario.h"
 #include "mario_actions_cutscene.h"
 #include "memory.h"
+#include "micro_coin.h"
 #include "obj_behaviors.h"
+#include "object_collision.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
 #include "rendering_graph_node.h"
@@ -239,6 +242,54 @@ f32 dist_between_objects_squared(struct Object *obj1, struct Object *obj2) {
     return vec3_sumsq(d);
 }
 
+#ifdef MARIO_PROXIMITY_CACHE
+/**
+ * Per pool slot memo of the object's distance and facing angle to Mario,
+ * stamped with the frame it was computed on. The first query an object makes
+ * in a frame computes the deltas once and derives distance, squared distance
+ * and angle together; everything after that frame-stamp hits for free. The
+ * values are from the moment of the first query (the top of the object's
+ * behavior tick for flagged objects), which is also when vanilla computed them.
+ */
+struct MarioProximity {
+    u32 frame;
+    f32 dist;
+    f32 distSq;
+    s16 angleToMario;
+};
+
+static struct MarioProximity sMarioProximityTable[OBJECT_POOL_CAPACITY];
+
+static struct MarioProximity *mario_proximity_entry(struct Object *obj) {
+    struct MarioProximity *entry = &sMarioProximityTable[obj - gObjectPool];
+    if (entry->frame != gGlobalTimer) {
+        f32 dx = gMarioObject->oPosX - obj->oPosX;
+        f32 dy = gMarioObject->oPosY - obj->oPosY;
+        f32 dz = gMarioObject->oPosZ - obj->oPosZ;
+        entry->distSq = sqr(dx) + sqr(dy) + sqr(dz);
+        entry->dist = sqrtf(entry->distSq);
+        entry->angleToMario = atan2s(dz, dx);
+        entry->frame = gGlobalTimer;
+    }
+    return entry;
+}
+
+/// This frame's distance from the object to Mario (see sMarioProximityTable).
+f32 obj_dist_to_mario(struct Object *obj) {
+    return mario_proximity_entry(obj)->dist;
+}
+
+/// This frame's squared distance from the object to Mario.
+f32 obj_dist_sq_to_mario(struct Object *obj) {
+    return mario_proximity_entry(obj)->distSq;
+}
+
+/// This frame's yaw from the object toward Mario.
+s16 obj_angle_to_mario(struct Object *obj) {
+    return mario_proximity_entry(obj)->angleToMario;
+}
+#endif // MARIO_PROXIMITY_CACHE
+
 void cur_obj_forward_vel_approach_upward(f32 target, f32 increment) {
     if (o->oForwardVel >= target) {
         o->oForwardVel = target;
@@ -396,6 +447,12 @@ struct Object *spawn_object_at_origin(struct Object *parent, UNUSED s32 unusedAr
     obj->header.gfx.activeAreaIndex = parent->header.gfx.areaIndex;
 
     geo_obj_init((struct GraphNodeObject *) &obj->header.gfx, gLoadedGraphNodes[model], gVec3fZero, gVec3sZero);
+#ifdef ASYNC_MODEL_LOADING
+    // Model still in flight: render as a placeholder until the load lands.
+    if (obj->header.gfx.sharedChild == NULL && model != MODEL_NONE) {
+        obj->header.gfx.pendingModelID = model;
+    }
+#endif
 
     return obj;
 }
@@ -410,7 +467,7 @@ struct Object *spawn_object(struct Object *parent, ModelID32 model, const Behavi
 
 struct Object *try_to_spawn_object(s16 offsetY, f32 scale, struct Object *parent, ModelID32 model,
                                    const BehaviorScript *behavior) {
-    if (gFreeObjectList.next != NULL) {
+    if (obj_pool_has_free_slot()) {
         struct Object *obj = spawn_object(parent, model, behavior);
         obj->oPosY += offsetY;
         obj_scale(obj, scale);
@@ -615,11 +672,22 @@ f32 cur_obj_dist_to_nearest_object_with_behavior(const BehaviorScript *behavior)
 
 struct Object *cur_obj_find_nearest_object_with_behavior(const BehaviorScript *behavior, f32 *dist) {
     uintptr_t *behaviorAddr = segmented_to_virtual(behavior);
-    struct ObjectNode *listHead = &gObjectLists[get_object_list_from_behavior(behaviorAddr)];
-    struct Object *obj = (struct Object *) listHead->next;
+    s32 objectList = get_object_list_from_behavior(behaviorAddr);
+    struct ObjectNode *listHead;
+    struct Object *obj;
     struct Object *closestObj = NULL;
     f32 minDist = 0x20000;
 
+#ifdef COLLISION_OBJECT_BROADPHASE
+    if (collision_hash_usable(objectList)) {
+        return collision_hash_find_nearest_with_behavior(o, (const BehaviorScript *) behaviorAddr,
+                                                         objectList, dist);
+    }
+#endif
+
+    listHead = &gObjectLists[objectList];
+    obj = (struct Object *) listHead->next;
+
     while (obj != (struct Object *) listHead) {
         if (obj->behavior == behaviorAddr
             && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED
@@ -680,6 +748,45 @@ s32 count_objects_with_behavior(const BehaviorScript *behavior) {
     return count;
 }
 
+/**
+ * Collect every active object with the given behavior within radius (3D) of
+ * pos into dest, up to maxCount, returning the number found. Served from the
+ * collision broadphase hash when it is valid this frame; otherwise (or for
+ * object lists the hash doesn't cover) falls back to scanning the list.
+ */
+s32 find_objects_with_behavior_in_radius(const BehaviorScript *behavior, Vec3f pos, f32 radius,
+                                         struct Object **dest, s32 maxCount) {
+    uintptr_t *behaviorAddr = segmented_to_virtual(behavior);
+    s32 objectList = get_object_list_from_behavior(behaviorAddr);
+    struct ObjectNode *listHead;
+    struct Object *obj;
+    s32 count = 0;
+
+#ifdef COLLISION_OBJECT_BROADPHASE
+    if (collision_hash_usable(objectList)) {
+        return collision_hash_collect_with_behavior_in_radius((const BehaviorScript *) behaviorAddr,
+                                                              objectList, pos[0], pos[1], pos[2],
+                                                              radius, dest, maxCount);
+    }
+#endif
+
+    listHead = &gObjectLists[objectList];
+    obj = (struct Object *) listHead->next;
+
+    while (obj != (struct Object *) listHead && count < maxCount) {
+        if (obj->behavior == behaviorAddr
+            && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED
+            && sqr(obj->oPosX - pos[0]) + sqr(obj->oPosY - pos[1]) + sqr(obj->oPosZ - pos[2]) <= sqr(radius)
+        ) {
+            dest[count++] = obj;
+        }
+
+        obj = (struct Object *) obj->header.next;
+    }
+
+    return count;
+}
+
 struct Object *cur_obj_find_nearby_held_actor(const BehaviorScript *behavior, f32 maxDist) {
     const BehaviorScript *behaviorAddr = segmented_to_virtual(behavior);
     struct ObjectNode *listHead = &gObjectLists[OBJ_LIST_GENACTOR];
@@ -852,10 +959,20 @@ void cur_obj_get_dropped(void) {
 
 void obj_set_model(struct Object *obj, ModelID16 modelID) {
     obj->header.gfx.sharedChild = gLoadedGraphNodes[modelID];
+#ifdef ASYNC_MODEL_LOADING
+    if (obj->header.gfx.sharedChild == NULL && modelID != MODEL_NONE) {
+        obj->header.gfx.pendingModelID = modelID;
+    }
+#endif
 }
 
 void cur_obj_set_model(ModelID16 modelID) {
     o->header.gfx.sharedChild = gLoadedGraphNodes[modelID];
+#ifdef ASYNC_MODEL_LOADING
+    if (o->header.gfx.sharedChild == NULL && modelID != MODEL_NONE) {
+        o->header.gfx.pendingModelID = modelID;
+    }
+#endif
 }
 
 s32 obj_has_model(struct Object *obj, ModelID16 modelID) {
@@ -925,32 +1042,95 @@ void obj_become_tangible(struct Object *obj) {
     obj->oIntangibleTimer = 0;
 }
 
+#ifdef OBJ_COLLISION_LOD
+/**
+ * Whether the current object is far enough from Mario for approximate
+ * collision. Held objects always use full fidelity.
+ */
+static s32 cur_obj_collision_lod_active(void) {
+    return (o->oFlags & OBJ_FLAG_COLLISION_LOD)
+        && (o->oHeldState == HELD_FREE)
+        && (o->oDistanceToMario > OBJ_COLLISION_LOD_DIST);
+}
+
+/**
+ * Try to satisfy this frame's floor query from the cached floor. Between the
+ * staggered refresh frames the height is extrapolated from the cached
+ * triangle's plane, which is exact while the object stays above it and close
+ * enough at LOD range when it doesn't. Dynamic surfaces are rebuilt every
+ * frame, so a cached dynamic floor is never reused.
+ */
+static s32 cur_obj_collision_lod_reuse_floor(void) {
+    struct Surface *floor = o->oFloor;
+
+    if (!cur_obj_collision_lod_active()
+     || floor == NULL
+     || (floor->flags & SURFACE_FLAG_DYNAMIC)) {
+        return FALSE;
+    }
+    // Stagger full refreshes by pool slot, like the update throttling does.
+    if (((gGlobalTimer + (u32)(o - gObjectPool)) % OBJ_COLLISION_LOD_REFRESH) == 0) {
+        return FALSE;
+    }
+    o->oFloorHeight = get_surface_height_at_location(o->oPosX, o->oPosZ, floor);
+    return TRUE;
+}
+#endif // OBJ_COLLISION_LOD
+
 void cur_obj_update_floor_height(void) {
     struct Surface *floor;
+#ifdef OBJ_COLLISION_LOD
+    if (cur_obj_collision_lod_reuse_floor()) {
+        return;
+    }
+#endif
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+    o->oFloorHeight = find_object_floor(o, o->oPosX, o->oPosY, o->oPosZ, &floor);
+#else
     o->oFloorHeight = find_floor(o->oPosX, o->oPosY, o->oPosZ, &floor);
+#endif
 }
 
 struct Surface *cur_obj_update_floor_height_and_get_floor(void) {
     struct Surface *floor;
+#ifdef OBJ_COLLISION_LOD
+    if (cur_obj_collision_lod_reuse_floor()) {
+        return o->oFloor;
+    }
+#endif
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+    o->oFloorHeight = find_object_floor(o, o->oPosX, o->oPosY, o->oPosZ, &floor);
+#else
     o->oFloorHeight = find_floor(o->oPosX, o->oPosY, o->oPosZ, &floor);
+#endif
     return floor;
 }
 
+#ifdef OBJ_FAST_PHYSICS
+// Single-precision drag constants; the vanilla 'L' literals promote the whole
+// drag expression to double, costing mul.d and conversion stalls per axis.
+#define DRAG_SCALE 0.0001f
+#define DRAG_EPS   0.001f
+#else
+#define DRAG_SCALE 0.0001L
+#define DRAG_EPS   0.001L
+#endif
+
 static void apply_drag_to_value(f32 *value, f32 dragStrength) {
     f32 decel;
 
     if (*value != 0) {
         //! Can overshoot if |*value| > 1 / (dragStrength * 0.0001)
-        decel = sqr(*value) * (dragStrength * 0.0001L);
+        decel = sqr(*value) * (dragStrength * DRAG_SCALE);
 
         if (*value > 0) {
             *value -= decel;
-            if (*value < 0.001L) {
+            if (*value < DRAG_EPS) {
                 *value = 0;
             }
         } else {
             *value += decel;
-            if (*value > -0.001L) {
+            if (*value > -DRAG_EPS) {
                 *value = 0;
             }
         }
@@ -1012,7 +1192,12 @@ static void cur_obj_move_xz(f32 steepSlopeNormalY, s32 careAboutEdgesAndSteepSlo
 }
 
 static void cur_obj_move_update_underwater_flags(void) {
+#ifdef OBJ_FAST_PHYSICS
+    // sqrtf(v * v) is just absf(v), and the double divide becomes a multiply.
+    f32 decelY = absf(o->oVelY) * (o->oDragStrength * 7.0f) * 0.01f;
+#else
     f32 decelY = (f32)(sqrtf(o->oVelY * o->oVelY) * (o->oDragStrength * 7.0f)) / 100.0L;
+#endif
 
     if (o->oVelY > 0) {
         o->oVelY -= decelY;
@@ -1187,10 +1372,16 @@ s32 obj_check_if_collided_with_object(struct Object *obj1, struct Object *obj2)
 
 void cur_obj_set_behavior(const BehaviorScript *behavior) {
     o->behavior = segmented_to_virtual(behavior);
+#ifdef BHV_LOD_TIERS
+    o->behaviorLodTier = bhv_lod_find_tier(o->behavior);
+#endif
 }
 
 void obj_set_behavior(struct Object *obj, const BehaviorScript *behavior) {
     obj->behavior = segmented_to_virtual(behavior);
+#ifdef BHV_LOD_TIERS
+    obj->behaviorLodTier = bhv_lod_find_tier(obj->behavior);
+#endif
 }
 
 s32 cur_obj_has_behavior(const BehaviorScript *behavior) {
@@ -1274,6 +1465,9 @@ static void obj_spawn_loot_coins(struct Object *obj, s32 numCoins, f32 baseYVel,
     s32 i;
     struct Surface *floor;
     struct Object *coin;
+#ifdef MICRO_COIN_POOL
+    s32 numMicroCoins = 0;
+#endif
 
     f32 spawnHeight = find_floor(obj->oPosX, obj->oPosY, obj->oPosZ, &floor);
     if (obj->oPosY - spawnHeight > 100.0f) {
@@ -1287,11 +1481,30 @@ static void obj_spawn_loot_coins(struct Object *obj, s32 numCoins, f32 baseYVel,
 
         obj->oNumLootCoins--;
 
+#ifdef MICRO_COIN_POOL
+        // Burst coins go to the micro pool; a full pool or a death-floor
+        // spawn point falls through to a real object.
+        if (micro_coin_spawn(obj->oPosX + random_f32_around_zero(posJitter), spawnHeight,
+                             obj->oPosZ + random_f32_around_zero(posJitter), baseYVel,
+                             model == MODEL_BLUE_COIN ? MICRO_COIN_BLUE : MICRO_COIN_YELLOW)) {
+            numMicroCoins++;
+            continue;
+        }
+#endif
+
         coin = spawn_object(obj, model, coinBehavior);
         obj_translate_xz_random(coin, posJitter);
         coin->oPosY = spawnHeight;
         coin->oCoinBaseYVel = baseYVel;
     }
+
+#ifdef MICRO_COIN_POOL
+    // Object coins each play the spurt from their behavior; cover the
+    // micro coins with one shot from the source.
+    if (numMicroCoins > 0) {
+        play_sound(SOUND_GENERAL_COIN_SPURT, obj->header.gfx.cameraToObject);
+    }
+#endif
 }
 
 void obj_spawn_loot_blue_coins(struct Object *obj, s32 numCoins, f32 baseYVel, s16 posJitter) {
@@ -1406,7 +1619,12 @@ static void cur_obj_update_floor(void) {
 static void cur_obj_update_floor_and_resolve_wall_collisions(s16 steepSlopeDegrees) {
     o->oMoveFlags &= ~(OBJ_MOVE_ABOVE_LAVA | OBJ_MOVE_ABOVE_DEATH_BARRIER);
 
-    if (o->activeFlags & (ACTIVE_FLAG_FAR_AWAY | ACTIVE_FLAG_IN_DIFFERENT_ROOM)) {
+    if ((o->activeFlags & (ACTIVE_FLAG_FAR_AWAY | ACTIVE_FLAG_IN_DIFFERENT_ROOM))
+#ifdef OBJ_COLLISION_LOD
+        // At LOD range, wall and steep-slope resolution is skipped entirely.
+        || cur_obj_collision_lod_active()
+#endif
+        ) {
         cur_obj_update_floor();
         o->oMoveFlags &= ~(OBJ_MOVE_HIT_WALL | OBJ_MOVE_MASK_IN_WATER);
 
@@ -1473,7 +1691,11 @@ void cur_obj_move_standard(s16 steepSlopeAngleDegrees) {
         if (o->oForwardVel < 0.0f) {
             negativeSpeed = TRUE;
         }
+#ifdef OBJ_FAST_PHYSICS
+        o->oForwardVel = fast_sqrtf(sqr(o->oVelX) + sqr(o->oVelZ));
+#else
         o->oForwardVel = sqrtf(sqr(o->oVelX) + sqr(o->oVelZ));
+#endif
         if (negativeSpeed == TRUE) {
             o->oForwardVel = -o->oForwardVel;
         }
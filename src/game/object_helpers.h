@@ -69,6 +69,11 @@ void obj_set_held_state(struct Object *obj, const BehaviorScript *heldBehavior);
 f32 lateral_dist_between_objects(struct Object *obj1, struct Object *obj2);
 f32 dist_between_objects(struct Object *obj1, struct Object *obj2);
 f32 dist_between_objects_squared(struct Object *obj1, struct Object *obj2);
+#ifdef MARIO_PROXIMITY_CACHE
+f32 obj_dist_to_mario(struct Object *obj);
+f32 obj_dist_sq_to_mario(struct Object *obj);
+s16 obj_angle_to_mario(struct Object *obj);
+#endif
 void cur_obj_forward_vel_approach_upward(f32 target, f32 increment);
 s32 cur_obj_rotate_yaw_toward(s16 target, s16 increment);
 s32 obj_angle_to_object(struct Object *obj1, struct Object *obj2);
@@ -119,6 +124,7 @@ struct Object *cur_obj_find_nearest_object_with_behavior(const BehaviorScript *
 struct Object *find_unimportant_object(void);
 s32 count_unimportant_objects(void);
 s32 count_objects_with_behavior(const BehaviorScript *behavior);
+s32 find_objects_with_behavior_in_radius(const BehaviorScript *behavior, Vec3f pos, f32 radius, struct Object **dest, s32 maxCount);
 struct Object *cur_obj_find_nearby_held_actor(const BehaviorScript *behavior, f32 maxDist);
 void cur_obj_change_action(s32 action);
 void cur_obj_set_vel_from_mario_vel(f32 f12,f32 f14);
@@ -9,16 +9,20 @@
 #include "engine/graph_node.h"
 #include "engine/surface_collision.h"
 #include "engine/surface_load.h"
+#include "engine/level_script.h"
 #include "engine/math_util.h"
 #include "interaction.h"
 #include "level_update.h"
+#include "macro_special_objects.h"
 #include "mario.h"
 #include "memory.h"
+#include "micro_coin.h"
 #include "object_collision.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
 #include "platform_displacement.h"
 #include "spawn_object.h"
+#include "spawn_sound.h"
 #include "puppyprint.h"
 #include "puppylights.h"
 #include "profiling.h"
@@ -283,6 +287,158 @@ void bhv_mario_update(void) {
     }
 }
 
+/**
+ * Update the object referenced by gCurrentObject.
+ */
+static void update_current_object(void) {
+    gCurrentObject->header.gfx.node.flags |= GRAPH_RENDER_HAS_ANIMATION;
+    cur_obj_update();
+}
+
+#ifdef OBJ_DEPENDENCY_ORDERED_UPDATE
+// Pool-indexed bits for objects already updated this frame, plus the frame's
+// deferred dependents.
+static u32 sObjUpdatedBits[(OBJECT_POOL_CAPACITY + 31) / 32];
+static struct Object *sDeferredObjs[OBJ_DEPENDENCY_QUEUE_SIZE];
+static s32 sNumDeferredObjs = 0;
+
+static void obj_mark_updated(struct Object *obj) {
+    s32 index = obj - gObjectPool;
+    sObjUpdatedBits[index / 32] |= (1 << (index % 32));
+}
+
+static s32 obj_was_updated(struct Object *obj) {
+    s32 index = obj - gObjectPool;
+    return (sObjUpdatedBits[index / 32] & (1 << (index % 32))) != 0;
+}
+
+/**
+ * Whether dep is something obj should wait for: a distinct live object that
+ * hasn't run its update yet this frame.
+ */
+static s32 obj_dependency_pending(struct Object *obj, struct Object *dep) {
+    return dep != NULL
+        && dep != obj
+        && dep->activeFlags != ACTIVE_FLAG_DEACTIVATED
+        && !obj_was_updated(dep);
+}
+
+static s32 obj_has_pending_dependency(struct Object *obj) {
+    return obj_dependency_pending(obj, obj->parentObj)
+        || obj_dependency_pending(obj, obj->platform);
+}
+
+/**
+ * update_current_object, but dependents whose parent or platform hasn't
+ * updated yet are deferred to the end of the frame's list walks so they read
+ * current-frame state instead of trailing their parent by a frame.
+ */
+static void update_current_object_dep_ordered(void) {
+    struct Object *obj = gCurrentObject;
+
+    if (sNumDeferredObjs < OBJ_DEPENDENCY_QUEUE_SIZE && obj_has_pending_dependency(obj)) {
+        sDeferredObjs[sNumDeferredObjs++] = obj;
+        return;
+    }
+    update_current_object();
+    obj_mark_updated(obj);
+}
+
+static void obj_dependency_frame_reset(void) {
+    s32 i;
+
+    for (i = 0; i < (s32) ARRAY_COUNT(sObjUpdatedBits); i++) {
+        sObjUpdatedBits[i] = 0;
+    }
+    sNumDeferredObjs = 0;
+}
+
+/**
+ * Run the deferred updates once every list has been walked. Chains (a child
+ * riding a child) resolve over multiple passes as their parents clear; after
+ * that, anything still blocked is part of a dependency cycle and updates in
+ * queue order, which matches the old list-order behavior.
+ */
+static void obj_drain_deferred_updates(void) {
+    s32 pass, i;
+
+    for (pass = 0; pass < 8 && sNumDeferredObjs > 0; pass++) {
+        s32 progress = FALSE;
+
+        for (i = 0; i < sNumDeferredObjs; i++) {
+            struct Object *obj = sDeferredObjs[i];
+
+            if (obj == NULL) {
+                continue;
+            }
+            if (obj->activeFlags == ACTIVE_FLAG_DEACTIVATED || obj_was_updated(obj)) {
+                // Deactivated by its parent, or the slot was reused and
+                // already updated through its own list.
+                sDeferredObjs[i] = NULL;
+                progress = TRUE;
+                continue;
+            }
+            if (!obj_has_pending_dependency(obj)) {
+                gCurrentObject = obj;
+                update_current_object();
+                obj_mark_updated(obj);
+                sDeferredObjs[i] = NULL;
+                progress = TRUE;
+            }
+        }
+        if (!progress) {
+            break;
+        }
+    }
+
+    for (i = 0; i < sNumDeferredObjs; i++) {
+        if (sDeferredObjs[i] != NULL
+         && sDeferredObjs[i]->activeFlags != ACTIVE_FLAG_DEACTIVATED
+         && !obj_was_updated(sDeferredObjs[i])) {
+            gCurrentObject = sDeferredObjs[i];
+            update_current_object();
+            obj_mark_updated(sDeferredObjs[i]);
+        }
+    }
+    sNumDeferredObjs = 0;
+}
+#endif // OBJ_DEPENDENCY_ORDERED_UPDATE
+
+/**
+ * Update the object referenced by gCurrentObject while time stop is active,
+ * which means only selectively unfreezing certain objects such as Mario,
+ * doors, unimportant objects, and the object that initiated time stop.
+ * The exact set of objects that are updated depends on which flags are set
+ * in gTimeStopState.
+ */
+static void update_current_object_during_time_stop(void) {
+    s32 unfrozen = FALSE;
+
+    // Selectively unfreeze certain objects
+    if (!(gTimeStopState & TIME_STOP_ALL_OBJECTS)) {
+        if (gCurrentObject == gMarioObject && !(gTimeStopState & TIME_STOP_MARIO_AND_DOORS)) {
+            unfrozen = TRUE;
+        }
+
+        if ((gCurrentObject->oInteractType & (INTERACT_DOOR | INTERACT_WARP_DOOR))
+            && !(gTimeStopState & TIME_STOP_MARIO_AND_DOORS)) {
+            unfrozen = TRUE;
+        }
+
+        if (gCurrentObject->activeFlags
+            & (ACTIVE_FLAG_UNIMPORTANT | ACTIVE_FLAG_INITIATED_TIME_STOP)) {
+            unfrozen = TRUE;
+        }
+    }
+
+    // Only update if unfrozen
+    if (unfrozen) {
+        update_current_object();
+    } else {
+        gCurrentObject->header.gfx.node.flags &= ~GRAPH_RENDER_HAS_ANIMATION;
+    }
+}
+
 /**
  * Update every object that occurs after firstObj in the given object list,
  * including firstObj itself. Return the number of objects that were updated.
@@ -293,8 +449,11 @@ s32 update_objects_starting_at(struct ObjectNode *objList, struct ObjectNode *fi
     while (objList != firstObj) {
         gCurrentObject = (struct Object *) firstObj;
 
-        gCurrentObject->header.gfx.node.flags |= GRAPH_RENDER_HAS_ANIMATION;
-        cur_obj_update();
+#ifdef OBJ_DEPENDENCY_ORDERED_UPDATE
+        update_current_object_dep_ordered();
+#else
+        update_current_object();
+#endif
 
         firstObj = firstObj->next;
         count++;
@@ -314,37 +473,11 @@ s32 update_objects_starting_at(struct ObjectNode *objList, struct ObjectNode *fi
  */
 s32 update_objects_during_time_stop(struct ObjectNode *objList, struct ObjectNode *firstObj) {
     s32 count = 0;
-    s32 unfrozen;
 
     while (objList != firstObj) {
         gCurrentObject = (struct Object *) firstObj;
 
-        unfrozen = FALSE;
-
-        // Selectively unfreeze certain objects
-        if (!(gTimeStopState & TIME_STOP_ALL_OBJECTS)) {
-            if (gCurrentObject == gMarioObject && !(gTimeStopState & TIME_STOP_MARIO_AND_DOORS)) {
-                unfrozen = TRUE;
-            }
-
-            if ((gCurrentObject->oInteractType & (INTERACT_DOOR | INTERACT_WARP_DOOR))
-                && !(gTimeStopState & TIME_STOP_MARIO_AND_DOORS)) {
-                unfrozen = TRUE;
-            }
-
-            if (gCurrentObject->activeFlags
-                & (ACTIVE_FLAG_UNIMPORTANT | ACTIVE_FLAG_INITIATED_TIME_STOP)) {
-                unfrozen = TRUE;
-            }
-        }
-
-        // Only update if unfrozen
-        if (unfrozen) {
-            gCurrentObject->header.gfx.node.flags |= GRAPH_RENDER_HAS_ANIMATION;
-            cur_obj_update();
-        } else {
-            gCurrentObject->header.gfx.node.flags &= ~GRAPH_RENDER_HAS_ANIMATION;
-        }
+        update_current_object_during_time_stop();
 
         firstObj = firstObj->next;
         count++;
@@ -359,6 +492,33 @@ s32 update_objects_during_time_stop(struct ObjectNode *objList, struct ObjectNod
  */
 s32 update_objects_in_list(struct ObjectNode *objList) {
     s32 count;
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    s32 listIndex = objList - gObjectLists;
+    s32 timeStop = (gTimeStopState & TIME_STOP_ACTIVE);
+
+    // Walk the list's slot array instead of chasing node pointers across the
+    // pool. The count is re-read every iteration, so objects appended by a
+    // spawn mid-walk still update this frame, and deallocate_object pulls
+    // gObjectListWalkPos back when a removal shifts the array under us.
+    count = 0;
+    gObjectListWalkList = listIndex;
+    for (gObjectListWalkPos = 0; gObjectListWalkPos < gObjectListSlotCount[listIndex];
+         gObjectListWalkPos++) {
+        gCurrentObject = &gObjectPool[gObjectListSlots[listIndex][gObjectListWalkPos]];
+
+        if (!timeStop) {
+#ifdef OBJ_DEPENDENCY_ORDERED_UPDATE
+            update_current_object_dep_ordered();
+#else
+            update_current_object();
+#endif
+        } else {
+            update_current_object_during_time_stop();
+        }
+        count++;
+    }
+    gObjectListWalkList = -1;
+#else
     struct ObjectNode *firstObj = objList->next;
 
     if (!(gTimeStopState & TIME_STOP_ACTIVE)) {
@@ -366,6 +526,7 @@ s32 update_objects_in_list(struct ObjectNode *objList) {
     } else {
         count = update_objects_during_time_stop(objList, firstObj);
     }
+#endif
 
     return count;
 }
@@ -374,12 +535,21 @@ s32 update_objects_in_list(struct ObjectNode *objList) {
  * Unload any objects in the list that have been deactivated.
  */
 s32 unload_deactivated_objects_in_list(struct ObjectNode *objList) {
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    s32 listIndex = objList - gObjectLists;
+
+    gObjectListWalkList = listIndex;
+    for (gObjectListWalkPos = 0; gObjectListWalkPos < gObjectListSlotCount[listIndex];
+         gObjectListWalkPos++) {
+        gCurrentObject = &gObjectPool[gObjectListSlots[listIndex][gObjectListWalkPos]];
+#else
     struct ObjectNode *obj = objList->next;
 
     while (objList != obj) {
         gCurrentObject = (struct Object *) obj;
 
         obj = obj->next;
+#endif
 
         if ((gCurrentObject->activeFlags & ACTIVE_FLAG_ACTIVE) != ACTIVE_FLAG_ACTIVE) {
 #ifdef PUPPYLIGHTS
@@ -395,6 +565,9 @@ s32 unload_deactivated_objects_in_list(struct ObjectNode *objList) {
             unload_object(gCurrentObject);
         }
     }
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    gObjectListWalkList = -1;
+#endif
 
     return 0;
 }
@@ -428,11 +601,26 @@ void set_object_respawn_info_bits(struct Object *obj, u8 bits) {
  */
 void unload_objects_from_area(UNUSED s32 unused, s32 areaIndex) {
     struct Object *obj;
-    struct ObjectNode *node;
-    struct ObjectNode *list;
     s32 i;
     gObjectLists = gObjectListArray;
 
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    for (i = 0; i < NUM_OBJ_LISTS; i++) {
+        gObjectListWalkList = i;
+        for (gObjectListWalkPos = 0; gObjectListWalkPos < gObjectListSlotCount[i];
+             gObjectListWalkPos++) {
+            obj = &gObjectPool[gObjectListSlots[i][gObjectListWalkPos]];
+
+            if (obj->header.gfx.activeAreaIndex == areaIndex) {
+                unload_object(obj);
+            }
+        }
+    }
+    gObjectListWalkList = -1;
+#else
+    struct ObjectNode *node;
+    struct ObjectNode *list;
+
     for (i = 0; i < NUM_OBJ_LISTS; i++) {
         list = gObjectLists + i;
         node = list->next;
@@ -446,6 +634,7 @@ void unload_objects_from_area(UNUSED s32 unused, s32 areaIndex) {
             }
         }
     }
+#endif
 }
 
 /**
@@ -464,6 +653,10 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
         gCCMEnteredSlide |= 1;
     }
 
+#ifdef SPAWN_INFO_PRUNING
+    struct SpawnInfo **prevLink = NULL;
+#endif
+
     while (spawnInfo != NULL) {
         struct Object *object;
         const BehaviorScript *script;
@@ -505,6 +698,14 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
             vec3s_to_vec3i(&object->oMoveAngleVec, spawnInfo->startAngle);
 
             object->oFloorHeight = find_floor(object->oPosX, object->oPosY, object->oPosZ, &object->oFloor);
+#ifdef SPAWN_INFO_PRUNING
+            prevLink = &spawnInfo->next;
+        } else if (prevLink != NULL) {
+            // This entry is dead for the rest of the level; unlink it so later
+            // re-entries of the area never touch it. (A dead list head just
+            // costs the one check above, since the head pointer isn't ours.)
+            *prevLink = spawnInfo->next;
+#endif
         }
 
         spawnInfo = spawnInfo->next;
@@ -529,6 +730,15 @@ void clear_objects(void) {
 
     debug_unknown_level_select_check();
 
+#ifdef DEFERRED_SPAWN_QUEUE
+    // Drop spawns still queued from the previous area.
+    deferred_spawn_clear();
+#endif
+#ifdef OBJECT_DORMANCY
+    // The tracked macro list lives in the level pool, so stop touching it.
+    dormancy_reset();
+#endif
+
     init_free_object_list();
     clear_object_lists(gObjectListArray);
 
@@ -628,8 +838,36 @@ void update_objects(UNUSED s32 unused) {
 
     gObjectLists = gObjectListArray;
 
+#ifndef DYNAMIC_SURFACE_RETENTION
     // If time stop is not active, unload object surfaces
     clear_dynamic_surfaces();
+#endif
+
+#ifdef DEFERRED_SPAWN_QUEUE
+    // Work through this frame's share of queued spawns before any updates, so
+    // objects that appear this frame also get their first behavior tick.
+    deferred_spawn_process();
+#endif
+
+#ifdef ASYNC_MODEL_LOADING
+    // Swap finished background model loads into their placeholder objects.
+    async_model_load_update();
+#endif
+
+#ifdef MICRO_COIN_POOL
+    // Batch-update the burst coin pool alongside the object lists.
+    micro_coin_update();
+#endif
+
+#ifdef OBJECT_DORMANCY
+    // Stream far macro objects out of the pool and queue approached dormant
+    // entries for respawn.
+    dormancy_update();
+#endif
+
+#ifdef OBJ_DEPENDENCY_ORDERED_UPDATE
+    obj_dependency_frame_reset();
+#endif
 
     // Update spawners and objects with surfaces
     update_terrain_objects();
@@ -646,9 +884,27 @@ void update_objects(UNUSED s32 unused) {
     // Update all other objects that haven't been updated yet
     update_non_terrain_objects();
 
+#ifdef OBJ_DEPENDENCY_ORDERED_UPDATE
+    // Every list has been walked; run the dependents that waited on their
+    // parent or platform, now against current-frame state.
+    obj_drain_deferred_updates();
+#endif
+
     // Unload any objects that have been deactivated
     unload_deactivated_objects();
 
+#ifdef OBJ_SOUND_DEDUP
+    // All object behaviors have run; forward the frame's surviving sound
+    // requests to the audio engine.
+    obj_sound_flush_deduped();
+#endif
+
+#ifdef COLLISION_OBJECT_BROADPHASE
+    // Objects have moved, so the broadphase hash no longer answers proximity
+    // queries correctly.
+    collision_hash_invalidate();
+#endif
+
     // Check if Mario is on a platform object and save this object
     update_mario_platform();
 
@@ -663,6 +919,10 @@ void update_objects(UNUSED s32 unused) {
     }
 
     gPrevFrameObjectCount = gObjectCounter;
-    
+
+#if PUPPYPRINT_DEBUG
+    bhv_profiling_frame_done();
+#endif
+
     profiler_update(PROFILER_TIME_BEHAVIOR_AFTER_MARIO);
 }
@@ -83,6 +83,17 @@ extern struct Object gMacroObjectDefaultParent;
 extern struct ObjectNode *gObjectLists;
 extern struct ObjectNode gFreeObjectList;
 
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+// Compact mirror of the object lists: pool slot numbers in insertion order,
+// maintained by try_allocate_object/deallocate_object alongside the lists.
+extern u8 gObjectListSlots[NUM_OBJ_LISTS][OBJECT_POOL_CAPACITY];
+extern u16 gObjectListSlotCount[NUM_OBJ_LISTS];
+// List currently being walked through its slot array (or -1) and the walk
+// cursor, which deallocate_object adjusts when a removal shifts the array.
+extern s16 gObjectListWalkList;
+extern s16 gObjectListWalkPos;
+#endif
+
 extern struct Object *gMarioObject;
 extern struct Object *gLuigiObject;
 extern struct Object *gCurrentObject;
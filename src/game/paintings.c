@@ -626,16 +626,24 @@ s16 calculate_ripple_at_point(struct Painting *painting, f32 posX, f32 posY) {
 
     f32 distanceToOrigin;
     f32 rippleDistance;
+    f32 dx, dy, distSq, reach;
 
     posX *= painting->size / PAINTING_SIZE;
     posY *= painting->size / PAINTING_SIZE;
-    distanceToOrigin = sqrtf((posX - rippleX) * (posX - rippleX) + (posY - rippleY) * (posY - rippleY));
-    // A larger dispersionFactor makes the ripple spread slower
-    rippleDistance = distanceToOrigin / dispersionFactor;
-    if (rippleTimer < rippleDistance) {
+    dx = posX - rippleX;
+    dy = posY - rippleY;
+    distSq = (dx * dx) + (dy * dy);
+    // How far the wavefront has spread. Comparing squared distances culls the
+    // points the ripple hasn't reached yet - most of the mesh early in a
+    // ripple - before paying for the sqrtf and cosf below.
+    reach = rippleTimer * dispersionFactor;
+    if (distSq > reach * reach) {
         // if the ripple hasn't reached the point yet, make the point magnitude 0
         return 0;
     } else {
+        distanceToOrigin = sqrtf(distSq);
+        // A larger dispersionFactor makes the ripple spread slower
+        rippleDistance = distanceToOrigin / dispersionFactor;
         // use a cosine wave to make the ripple go up and down,
         // scaled by the painting's ripple magnitude
         f32 rippleZ = rippleMag * cosf(rippleRate * (2 * M_PI) * (rippleTimer - rippleDistance));
@@ -794,6 +802,17 @@ void painting_average_vertex_normals(PaintingData *neighborTris, PaintingData nu
         // Move to the next vertex's entry
         entry += neighbors + 1;
 
+        // Vertices the ripple hasn't disturbed sit in a flat neighborhood: the
+        // x/y cross product terms cancel exactly, so the average points straight
+        // out and the normalize below would just compute (0, 0, 127) the
+        // expensive way. This is most of the mesh for most of a ripple.
+        if (nx == 0.0f && ny == 0.0f && nz > 0.0f) {
+            gPaintingMesh[i].norm[0] = 0;
+            gPaintingMesh[i].norm[1] = 0;
+            gPaintingMesh[i].norm[2] = 127;
+            continue;
+        }
+
         // average the surface normals from each neighboring tri
         nx /= neighbors;
         ny /= neighbors;
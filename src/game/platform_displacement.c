@@ -15,6 +15,11 @@
 
 struct Object *gMarioPlatform = NULL;
 
+#ifdef OBJECT_POOL_BITMAP
+// Pool generation of gMarioPlatform when it was saved, to detect slot reuse.
+static u32 sMarioPlatformGeneration;
+#endif
+
 /**
  * Determine if Mario is standing on a platform object, meaning that he is
  * within 4 units of the floor. Set his referenced platform object accordingly.
@@ -37,7 +42,22 @@ void update_mario_platform(void) {
     marioX = gMarioObject->oPosX;
     marioY = gMarioObject->oPosY;
     marioZ = gMarioObject->oPosZ;
+#ifdef PLATFORM_RIDER_CACHE
+    // Mario's movement code already found his floor this frame; reuse it
+    // instead of running another find_floor, as long as he hasn't been moved
+    // since (e.g. by a warp or debug code).
+    if (gMarioState->floor != NULL
+     && marioX == gMarioState->pos[0]
+     && marioY == gMarioState->pos[1]
+     && marioZ == gMarioState->pos[2]) {
+        floor = gMarioState->floor;
+        floorHeight = gMarioState->floorHeight;
+    } else {
+        floorHeight = find_floor(marioX, marioY, marioZ, &floor);
+    }
+#else
     floorHeight = find_floor(marioX, marioY, marioZ, &floor);
+#endif
 
     awayFromFloor =  absf(marioY - floorHeight) >= 4.0f;
 
@@ -48,6 +68,9 @@ void update_mario_platform(void) {
         if (floor != NULL && floor->object != NULL) {
             gMarioPlatform = floor->object;
             gMarioObject->platform = floor->object;
+#ifdef OBJECT_POOL_BITMAP
+            sMarioPlatformGeneration = floor->object->generation;
+#endif
         } else {
             gMarioPlatform = NULL;
             gMarioObject->platform = NULL;
@@ -169,6 +192,72 @@ void apply_platform_displacement(struct PlatformDisplacementInfo *displaceInfo,
     displaceInfo->prevTimer = gGlobalTimer;
 }
 
+#ifdef PLATFORM_RIDER_CACHE
+// Shared displacement state for object riders, so behaviors don't each need a
+// static PlatformDisplacementInfo. Slots are keyed by the rider object and
+// reclaimed once a rider hasn't been displaced for a frame, so the cache only
+// needs to cover objects simultaneously riding platforms.
+#define PLATFORM_RIDER_CACHE_SIZE 8
+
+struct PlatformRider {
+    struct Object *rider;
+#ifdef OBJECT_POOL_BITMAP
+    u32 generation;
+#endif
+    struct PlatformDisplacementInfo info;
+};
+
+static struct PlatformRider sPlatformRiders[PLATFORM_RIDER_CACHE_SIZE];
+
+/**
+ * Find the cached displacement state for a rider, or claim a slot for it. The
+ * stalest slot is stolen if all are in use; apply_platform_displacement treats
+ * the mismatched timer as a first contact frame, so a stolen slot just means
+ * that rider restarts its contact tracking.
+ */
+static struct PlatformDisplacementInfo *platform_rider_get_info(struct Object *rider) {
+    struct PlatformRider *slot = &sPlatformRiders[0];
+    s32 i;
+
+    for (i = 0; i < PLATFORM_RIDER_CACHE_SIZE; i++) {
+        if (sPlatformRiders[i].rider == rider
+#ifdef OBJECT_POOL_BITMAP
+         && sPlatformRiders[i].generation == rider->generation
+#endif
+        ) {
+            return &sPlatformRiders[i].info;
+        }
+        if (sPlatformRiders[i].info.prevTimer < slot->info.prevTimer) {
+            slot = &sPlatformRiders[i];
+        }
+    }
+
+    slot->rider = rider;
+#ifdef OBJECT_POOL_BITMAP
+    slot->generation = rider->generation;
+#endif
+    // Force the first-contact path on the claimed slot.
+    slot->info.prevPlatform = NULL;
+    return &slot->info;
+}
+
+/**
+ * Apply platform displacement to an object riding obj->platform (as set by the
+ * object's own floor checks), using the shared rider cache for contact state.
+ */
+void apply_object_platform_displacement(struct Object *obj) {
+    struct Object *platform = obj->platform;
+    s16 yaw = (s16) obj->oFaceAngleYaw;
+
+    if (platform == NULL) {
+        return;
+    }
+
+    apply_platform_displacement(platform_rider_get_info(obj), &obj->oPosVec, &yaw, platform);
+    obj->oFaceAngleYaw = yaw;
+}
+#endif
+
 // Doesn't change in the code, set this to FALSE if you don't want inertia
 u8 gDoInertia = TRUE;
 
@@ -205,6 +294,14 @@ void apply_mario_platform_displacement(void) {
     struct Object *platform;
 
     platform = gMarioPlatform;
+#ifdef OBJECT_POOL_BITMAP
+    // The platform may have unloaded (and had its slot taken by a different
+    // object) since update_mario_platform saved it at the end of last frame.
+    if (platform != NULL && platform->generation != sMarioPlatformGeneration) {
+        gMarioPlatform = NULL;
+        platform = NULL;
+    }
+#endif
     if (!(gTimeStopState & TIME_STOP_ACTIVE) && gMarioObject != NULL) {
         if (platform != NULL) {
             apply_platform_displacement(&sMarioDisplacementInfo, gMarioState->pos, &gMarioState->faceAngle[1], platform);
@@ -298,6 +395,14 @@ void apply_platform_displacement(u32 isMario, struct Object *platform) {
 void apply_mario_platform_displacement(void) {
     struct Object *platform = gMarioPlatform;
 
+#ifdef OBJECT_POOL_BITMAP
+    // The platform may have unloaded (and had its slot taken by a different
+    // object) since update_mario_platform saved it at the end of last frame.
+    if (platform != NULL && platform->generation != sMarioPlatformGeneration) {
+        gMarioPlatform = NULL;
+        platform = NULL;
+    }
+#endif
     if (!(gTimeStopState & TIME_STOP_ACTIVE) && gMarioObject != NULL && platform != NULL) {
         apply_platform_displacement(TRUE, platform);
     }
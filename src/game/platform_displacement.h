@@ -21,6 +21,9 @@ void get_mario_pos(f32 *x, f32 *y, f32 *z);
 void set_mario_pos(f32 x, f32 y, f32 z);
 #ifdef PLATFORM_DISPLACEMENT_2
 void apply_platform_displacement(struct PlatformDisplacementInfo *displaceInfo, Vec3f pos, s16 *yaw, struct Object *platform);
+#ifdef PLATFORM_RIDER_CACHE
+void apply_object_platform_displacement(struct Object *obj);
+#endif
 #else
 void apply_platform_displacement(u32 isMario, struct Object *platform);
 #endif
@@ -1,6 +1,7 @@
 #include <ultra64.h>
 
 #include "config.h"
+#include "gfx_dimensions.h"
 #include "game_init.h"
 #include "memory.h"
 #include "print.h"
@@ -25,6 +26,32 @@ struct TextLabel {
 struct TextLabel *sTextLabels[52];
 s16 sTextLabelsCount = 0;
 
+#ifdef HUD_RETAINED_DL
+/**
+ * Retained glyph display list for the colorful text labels. The label set
+ * (HUD counters, "PRESS START", ...) is identical between most frames, so the
+ * per-glyph texture loads and rectangles are rebuilt into a static buffer
+ * only when a label actually changes and replayed with one command otherwise.
+ * Two buffers alternate on rebuild so the copy the RCP may still be reading
+ * is never written. Oversized label sets fall back to direct rendering.
+ */
+#define TEXT_CACHE_MAX_GLYPHS 96
+static Gfx sTextCacheGfx[2][TEXT_CACHE_MAX_GLYPHS * 4 + 1];
+static struct TextLabel sTextCacheLabels[ARRAY_COUNT(sTextLabels)];
+static s16 sTextCacheLabelCount = -1; // -1 = nothing cached
+static s8 sTextCacheSide = 0;
+/// Resolved glyph table the cache was built with; catches segment reloads
+static const Texture *const *sTextCacheGlyphs = NULL;
+
+/**
+ * Throw away the cached glyph display list, forcing a rebuild on the next
+ * render_text_labels call.
+ */
+void print_text_invalidate(void) {
+    sTextCacheLabelCount = -1;
+}
+#endif // HUD_RETAINED_DL
+
 /**
  * Returns n to the exponent power, only for non-negative powers.
  */
@@ -408,10 +435,69 @@ void render_textrect(s32 x, s32 y, s32 pos) {
 #endif
     rectX = rectBaseX;
     rectY = rectBaseY;
-    gSPTextureRectangle(gDisplayListHead++, rectX << 2, rectY << 2, (rectX + 15) << 2,
-                        (rectY + 15) << 2, G_TX_RENDERTILE, 0, 0, 4 << 10, 1 << 10);
+    gSPTextureRectangle(gDisplayListHead++, rectX << 2, ADAPTIVE_RES_Y(rectY << 2), (rectX + 15) << 2,
+                        ADAPTIVE_RES_Y((rectY + 15) << 2), G_TX_RENDERTILE, 0, 0, 4 << 10, ADAPTIVE_RES_STEP_T(1 << 10));
 }
 
+#ifdef HUD_RETAINED_DL
+/**
+ * Check whether the current frame's labels match the cached snapshot, so the
+ * retained glyph display list can be replayed unchanged.
+ */
+static s32 text_labels_match_cache(const Texture *const *glyphs) {
+    s32 i;
+    s32 j;
+
+    if (sTextCacheLabelCount != sTextLabelsCount || sTextCacheGlyphs != glyphs) {
+        return FALSE;
+    }
+
+    for (i = 0; i < sTextLabelsCount; i++) {
+        struct TextLabel *label = sTextLabels[i];
+        struct TextLabel *cached = &sTextCacheLabels[i];
+
+        if (label->x != cached->x || label->y != cached->y || label->length != cached->length) {
+            return FALSE;
+        }
+
+        for (j = 0; j < label->length; j++) {
+            if (label->buffer[j] != cached->buffer[j]) {
+                return FALSE;
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * Count the display list commands the current labels will emit, to check the
+ * glyph stream fits in the retained buffer before redirecting output into it.
+ */
+static s32 text_labels_count_commands(void) {
+    s32 commands = 0;
+    s32 i;
+    s32 j;
+
+    for (i = 0; i < sTextLabelsCount; i++) {
+        for (j = 0; j < sTextLabels[i]->length; j++) {
+            s32 glyphIndex = char_to_glyph_index(sTextLabels[i]->buffer[j]);
+
+            if (glyphIndex != GLYPH_SPACE) {
+#ifdef VERSION_EU
+                // The reused beta key glyph renders as two stacked glyphs.
+                commands += (glyphIndex == GLYPH_BETA_KEY) ? 8 : 4;
+#else
+                commands += 4;
+#endif
+            }
+        }
+    }
+
+    return commands;
+}
+#endif // HUD_RETAINED_DL
+
 /**
  * Renders the text in sTextLabels on screen at the proper locations by iterating
  * a for loop.
@@ -421,6 +507,10 @@ void render_text_labels(void) {
     s32 j;
     s8 glyphIndex;
     Mtx *mtx;
+#ifdef HUD_RETAINED_DL
+    const Texture *const *glyphs;
+    Gfx *savedHead = NULL;
+#endif
 
     if (sTextLabelsCount == 0) {
         return;
@@ -438,6 +528,40 @@ void render_text_labels(void) {
     gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(mtx), G_MTX_PROJECTION | G_MTX_LOAD | G_MTX_NOPUSH);
     gSPDisplayList(gDisplayListHead++, dl_hud_img_begin);
 
+#ifdef HUD_RETAINED_DL
+    glyphs = segmented_to_virtual(main_hud_lut);
+
+    if (text_labels_match_cache(glyphs)) {
+        // Same labels as the cached frame: replay the retained glyph stream.
+        gSPDisplayList(gDisplayListHead++, sTextCacheGfx[sTextCacheSide]);
+
+        for (i = 0; i < sTextLabelsCount; i++) {
+            mem_pool_free(gEffectsMemoryPool, sTextLabels[i]);
+        }
+
+        gSPDisplayList(gDisplayListHead++, dl_hud_img_end);
+        sTextLabelsCount = 0;
+        return;
+    }
+
+    if (text_labels_count_commands() <= TEXT_CACHE_MAX_GLYPHS * 4) {
+        // Rebuild into the copy the RCP can't still be reading, and snapshot
+        // the labels for next frame's comparison before they are freed.
+        sTextCacheSide ^= 1;
+        sTextCacheLabelCount = sTextLabelsCount;
+        sTextCacheGlyphs = glyphs;
+
+        for (i = 0; i < sTextLabelsCount; i++) {
+            sTextCacheLabels[i] = *sTextLabels[i];
+        }
+
+        savedHead = gDisplayListHead;
+        gDisplayListHead = sTextCacheGfx[sTextCacheSide];
+    } else {
+        sTextCacheLabelCount = -1; // doesn't fit; render directly this frame
+    }
+#endif
+
     for (i = 0; i < sTextLabelsCount; i++) {
         for (j = 0; j < sTextLabels[i]->length; j++) {
             glyphIndex = char_to_glyph_index(sTextLabels[i]->buffer[j]);
@@ -466,6 +590,14 @@ void render_text_labels(void) {
         mem_pool_free(gEffectsMemoryPool, sTextLabels[i]);
     }
 
+#ifdef HUD_RETAINED_DL
+    if (savedHead != NULL) {
+        gSPEndDisplayList(gDisplayListHead++);
+        gDisplayListHead = savedHead;
+        gSPDisplayList(gDisplayListHead++, sTextCacheGfx[sTextCacheSide]);
+    }
+#endif
+
     gSPDisplayList(gDisplayListHead++, dl_hud_img_end);
 
     sTextLabelsCount = 0;
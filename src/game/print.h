@@ -34,5 +34,8 @@ void print_text_fmt_int(s32 x, s32 y, const char *str, s32 n);
 void print_text(s32 x, s32 y, const char *str);
 void print_text_centered(s32 x, s32 y, const char *str);
 void render_text_labels(void);
+#ifdef HUD_RETAINED_DL
+void print_text_invalidate(void);
+#endif
 
 #endif // PRINT_H
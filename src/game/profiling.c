@@ -1,10 +1,21 @@
 #include <ultra64.h>
 #include <PR/os_internal_reg.h>
 #include "game_init.h"
+#include "area.h"
 
 #include "profiling.h"
 #include "fasttext.h"
 
+#ifdef PROFILER_SRAM_CAPTURE_ACTIVE
+#include "sram.h"
+#include "save_file.h"
+#endif
+
+#if defined(ENABLE_BENCHMARK_REPLAY) && defined(UNF)
+#include "usb/debug.h"
+#include "version.h"
+#endif
+
 #ifdef USE_PROFILER
 
 #define RDP_CYCLE_CONV(x) ((10 * (x)) / 625) // 62.5 million cycles per frame
@@ -16,6 +27,15 @@ typedef struct {
 
 ProfileTimeData all_profiling_data[PROFILER_TIME_COUNT];
 
+#ifdef PROFILER_RDP_ATTRIBUTION
+// RDP pipe-busy cycles that elapsed while each CPU scope was running. The
+// pipe-busy counter keeps counting across the whole frame and is cleared
+// once per frame in update_rdp_timers, so the delta between two scope
+// boundaries is the RDP work that overlapped that scope.
+ProfileTimeData rdp_scope_data[PROFILER_TIME_COUNT];
+static u32 prev_rdp_pipe;
+#endif
+
 int profile_buffer_index = -1;
 int rsp_buffer_indices[PROFILER_RSP_COUNT];
 // Holds either the start time if the task is running, or the amount of time the task has run for so far if yielded
@@ -52,6 +72,12 @@ void profiler_update(enum ProfilerTime which) {
     
     buffer_update(cur_data, diff, profile_buffer_index);
     prev_time = cur_time;
+
+#ifdef PROFILER_RDP_ATTRIBUTION
+    u32 pipe = IO_READ(DPC_PIPEBUSY_REG);
+    buffer_update(&rdp_scope_data[which], pipe - prev_rdp_pipe, profile_buffer_index);
+    prev_rdp_pipe = pipe;
+#endif
 }
 
 void profiler_rsp_started(enum ProfilerRSPTime which) {
@@ -129,6 +155,11 @@ static void update_rdp_timers() {
     buffer_update(&all_profiling_data[PROFILER_TIME_TMEM], tmem, profile_buffer_index);
     buffer_update(&all_profiling_data[PROFILER_TIME_CMD], cmd, profile_buffer_index);
     buffer_update(&all_profiling_data[PROFILER_TIME_PIPE], pipe, profile_buffer_index);
+
+#ifdef PROFILER_RDP_ATTRIBUTION
+    // the per-scope deltas restart from zero once the counters are cleared
+    prev_rdp_pipe = (gGlobalTimer > 5) ? 0 : pipe;
+#endif
 }
 
 #ifdef PUPPYPRINT_DEBUG
@@ -136,6 +167,230 @@ extern u8 sPPDebugPage;
 extern u8 fDebug;
 #endif
 
+#ifdef PROFILER_HISTORY
+u16 gProfilerHistory[PROFILER_HIST_COUNT][PROFILER_HISTORY_FRAMES];
+s32 gProfilerHistoryIndex = 0;
+u8 gProfilerHistoryPaused = FALSE;
+
+static u16 history_usec(u32 cycles) {
+    u32 us = OS_CYCLES_TO_USEC(cycles);
+    return (us > 0xFFFF) ? 0xFFFF : us;
+}
+
+#ifdef PROFILER_SRAM_CAPTURE_ACTIVE
+struct ProfilerSramCapture gProfilerSramCapture;
+u8 gProfilerSramCaptureValid = FALSE;
+static struct ProfilerSramCapture sSramCaptureStaging;
+// Worst spike known to be stored, so lesser spikes don't churn the SRAM.
+static u16 sSramCaptureWorstUs = 0;
+
+STATIC_ASSERT(sizeof(struct ProfilerSramCapture) <= (0x8000 - PROFILER_SRAM_CAPTURE_ADDR),
+              "SRAM hitch capture overruns the end of SRAM");
+STATIC_ASSERT(sizeof(struct SaveBuffer) <= PROFILER_SRAM_CAPTURE_ADDR,
+              "SRAM hitch capture overlaps the save image");
+
+/**
+ * Read a previously stored capture back at boot. Its spike time seeds the
+ * overwrite threshold, so only a worse hitch replaces it.
+ */
+void profiler_sram_capture_load(void) {
+    if (gSramProbe == 0) {
+        return;
+    }
+    nuPiReadSram(PROFILER_SRAM_CAPTURE_ADDR, &gProfilerSramCapture, sizeof(gProfilerSramCapture));
+    if (gProfilerSramCapture.magic == PROFILER_SRAM_CAPTURE_MAGIC) {
+        gProfilerSramCaptureValid = TRUE;
+        sSramCaptureWorstUs = gProfilerSramCapture.spikeUs;
+    }
+}
+
+void profiler_sram_capture_clear(void) {
+    gProfilerSramCaptureValid = FALSE;
+    sSramCaptureWorstUs = 0;
+    if (gSramProbe != 0) {
+        sSramCaptureStaging.magic = 0;
+        nuPiWriteSram(PROFILER_SRAM_CAPTURE_ADDR, &sSramCaptureStaging, sizeof(u32));
+    }
+}
+
+/**
+ * Checkpoint the history ring to SRAM when this frame spiked. Called before
+ * the ring index advances, so gProfilerHistoryIndex is the spike frame's
+ * slot and lands in the capture's last column. The blocking SRAM DMA costs
+ * around a millisecond, acceptable on a frame that already blew its budget.
+ */
+static void profiler_sram_capture_check(u16 spikeUs) {
+    s32 ch, i;
+
+    if (gSramProbe == 0
+     || gGlobalTimer < 300 // boot and first level load always spike
+     || spikeUs < PROFILER_SRAM_SPIKE_US
+     || spikeUs <= sSramCaptureWorstUs) {
+        return;
+    }
+
+    sSramCaptureStaging.magic = PROFILER_SRAM_CAPTURE_MAGIC;
+    sSramCaptureStaging.globalTimer = gGlobalTimer;
+    sSramCaptureStaging.spikeUs = spikeUs;
+    sSramCaptureStaging.levelNum = gCurrLevelNum;
+    sSramCaptureStaging.areaIndex = gCurrAreaIndex;
+    for (ch = 0; ch < PROFILER_HIST_COUNT; ch++) {
+        for (i = 0; i < PROFILER_SRAM_CAPTURE_FRAMES; i++) {
+            s32 frame = (gProfilerHistoryIndex - (PROFILER_SRAM_CAPTURE_FRAMES - 1) + i
+                         + (PROFILER_HISTORY_FRAMES * 2)) % PROFILER_HISTORY_FRAMES;
+            sSramCaptureStaging.samples[ch][i] = gProfilerHistory[ch][frame];
+        }
+    }
+
+    nuPiWriteSram(PROFILER_SRAM_CAPTURE_ADDR, &sSramCaptureStaging, sizeof(sSramCaptureStaging));
+    sSramCaptureWorstUs = spikeUs;
+    // Show the fresh capture on the Hitches page without a reboot.
+    gProfilerSramCapture = sSramCaptureStaging;
+    gProfilerSramCaptureValid = TRUE;
+}
+#endif // PROFILER_SRAM_CAPTURE_ACTIVE
+
+/**
+ * Records this frame's raw per-subsystem samples into the long history ring.
+ * Unlike the averaging buffers above, these keep single-frame values, so a
+ * one-frame spike stays visible until 600 frames later. The audio and RSP
+ * buffers advance on their own indices, so their most recent completed
+ * sample is read instead of this frame's slot.
+ */
+static void profiler_history_capture(void) {
+    s32 idx = profile_buffer_index;
+    s32 audioIdx = (audio_buffer_index == 0) ? (PROFILING_BUFFER_SIZE - 1) : (s32)(audio_buffer_index - 1);
+    s32 rspIdx = (rsp_buffer_indices[PROFILER_RSP_GFX] == 0) ? (PROFILING_BUFFER_SIZE - 1) : (rsp_buffer_indices[PROFILER_RSP_GFX] - 1);
+    u32 audio = all_profiling_data[PROFILER_TIME_AUDIO].counts[audioIdx];
+    u32 behavior = all_profiling_data[PROFILER_TIME_BEHAVIOR_BEFORE_MARIO].counts[idx]
+                 + all_profiling_data[PROFILER_TIME_MARIO].counts[idx]
+                 + all_profiling_data[PROFILER_TIME_BEHAVIOR_AFTER_MARIO].counts[idx];
+    u32 rdpMax = MAX(MAX(all_profiling_data[PROFILER_TIME_TMEM].counts[idx],
+                         all_profiling_data[PROFILER_TIME_CMD].counts[idx]),
+                     all_profiling_data[PROFILER_TIME_PIPE].counts[idx]);
+    u32 rdpUsec = RDP_CYCLE_CONV(rdpMax);
+
+    if (gProfilerHistoryPaused) {
+        return;
+    }
+
+    // audio runs at 60Hz, so it lands on the frame twice
+    gProfilerHistory[PROFILER_HIST_CPU][gProfilerHistoryIndex] =
+        history_usec(all_profiling_data[PROFILER_TIME_TOTAL].counts[idx] + audio * 2);
+    gProfilerHistory[PROFILER_HIST_BEHAVIOR][gProfilerHistoryIndex] = history_usec(behavior);
+    gProfilerHistory[PROFILER_HIST_GRAPH][gProfilerHistoryIndex] =
+        history_usec(all_profiling_data[PROFILER_TIME_GFX].counts[idx]);
+    gProfilerHistory[PROFILER_HIST_AUDIO][gProfilerHistoryIndex] = history_usec(audio * 2);
+    gProfilerHistory[PROFILER_HIST_RSP][gProfilerHistoryIndex] =
+        history_usec(all_profiling_data[PROFILER_TIME_RSP_GFX].counts[rspIdx]);
+    gProfilerHistory[PROFILER_HIST_RDP][gProfilerHistoryIndex] = (rdpUsec > 0xFFFF) ? 0xFFFF : rdpUsec;
+
+#ifdef PROFILER_SRAM_CAPTURE_ACTIVE
+    profiler_sram_capture_check(gProfilerHistory[PROFILER_HIST_CPU][gProfilerHistoryIndex]);
+#endif
+
+    gProfilerHistoryIndex++;
+    if (gProfilerHistoryIndex >= PROFILER_HISTORY_FRAMES) {
+        gProfilerHistoryIndex = 0;
+    }
+}
+#endif
+
+#ifdef ENABLE_BENCHMARK_REPLAY
+enum BenchmarkChannel {
+    BENCH_CPU,
+    BENCH_BEHAVIOR,
+    BENCH_GRAPH,
+    BENCH_AUDIO,
+    BENCH_RSP,
+    BENCH_RDP,
+    BENCH_COUNT,
+};
+
+static u32 sBenchSum[BENCH_COUNT];
+static u32 sBenchMin[BENCH_COUNT];
+static u32 sBenchMax[BENCH_COUNT];
+static u32 sBenchFrames = 0;
+static u16 sBenchDemoID = 0;
+static s16 sBenchLevel = 0;
+static u8 sBenchActive = FALSE;
+
+static void benchmark_sample(u32 vals[BENCH_COUNT]) {
+    s32 idx = profile_buffer_index;
+    s32 audioIdx = (audio_buffer_index == 0) ? (PROFILING_BUFFER_SIZE - 1) : (s32)(audio_buffer_index - 1);
+    s32 rspIdx = (rsp_buffer_indices[PROFILER_RSP_GFX] == 0) ? (PROFILING_BUFFER_SIZE - 1) : (rsp_buffer_indices[PROFILER_RSP_GFX] - 1);
+    u32 audio = all_profiling_data[PROFILER_TIME_AUDIO].counts[audioIdx];
+    u32 rdpMax = MAX(MAX(all_profiling_data[PROFILER_TIME_TMEM].counts[idx],
+                         all_profiling_data[PROFILER_TIME_CMD].counts[idx]),
+                     all_profiling_data[PROFILER_TIME_PIPE].counts[idx]);
+
+    vals[BENCH_CPU] = OS_CYCLES_TO_USEC(all_profiling_data[PROFILER_TIME_TOTAL].counts[idx] + audio * 2);
+    vals[BENCH_BEHAVIOR] = OS_CYCLES_TO_USEC(all_profiling_data[PROFILER_TIME_BEHAVIOR_BEFORE_MARIO].counts[idx]
+                                           + all_profiling_data[PROFILER_TIME_MARIO].counts[idx]
+                                           + all_profiling_data[PROFILER_TIME_BEHAVIOR_AFTER_MARIO].counts[idx]);
+    vals[BENCH_GRAPH] = OS_CYCLES_TO_USEC(all_profiling_data[PROFILER_TIME_GFX].counts[idx]);
+    vals[BENCH_AUDIO] = OS_CYCLES_TO_USEC(audio * 2);
+    vals[BENCH_RSP] = OS_CYCLES_TO_USEC(all_profiling_data[PROFILER_TIME_RSP_GFX].counts[rspIdx]);
+    vals[BENCH_RDP] = RDP_CYCLE_CONV(rdpMax);
+}
+
+static void benchmark_report(void) {
+#ifdef UNF
+    static const char *channelNames[BENCH_COUNT] = {
+        "cpu", "behavior", "graph", "audio", "rsp", "rdp",
+    };
+    s32 i;
+
+    debug_printf("BENCH,config=%s\n", gConfigFingerprint);
+    debug_printf("BENCH,demo=%d,level=%d,frames=%d\n", sBenchDemoID, sBenchLevel, sBenchFrames);
+    for (i = 0; i < BENCH_COUNT; i++) {
+        debug_printf("BENCH,chan=%s,min=%d,avg=%d,max=%d\n",
+                     channelNames[i], sBenchMin[i], (sBenchSum[i] / sBenchFrames), sBenchMax[i]);
+    }
+#endif
+}
+
+/**
+ * Collects per-subsystem frame statistics while a recorded demo is playing
+ * back and emits one machine-readable report per completed replay. Demo
+ * playback is deterministic, so two builds running the same demo can be
+ * compared number for number.
+ */
+static void benchmark_replay_update(void) {
+    s32 i;
+
+    if (gCurrDemoInput != NULL) {
+        u32 vals[BENCH_COUNT];
+
+        if (!sBenchActive) {
+            sBenchActive = TRUE;
+            sBenchFrames = 0;
+            sBenchDemoID = gDemoInputListID;
+            for (i = 0; i < BENCH_COUNT; i++) {
+                sBenchSum[i] = 0;
+                sBenchMin[i] = 0xFFFFFFFF;
+                sBenchMax[i] = 0;
+            }
+        }
+        // the level loads after playback starts, so keep this fresh
+        sBenchLevel = gCurrLevelNum;
+
+        benchmark_sample(vals);
+        for (i = 0; i < BENCH_COUNT; i++) {
+            sBenchSum[i] += vals[i];
+            sBenchMin[i] = MIN(sBenchMin[i], vals[i]);
+            sBenchMax[i] = MAX(sBenchMax[i], vals[i]);
+        }
+        sBenchFrames++;
+    } else if (sBenchActive) {
+        sBenchActive = FALSE;
+        if (sBenchFrames > 0) {
+            benchmark_report();
+        }
+    }
+}
+#endif
+
 float profiler_get_fps() {
     return (1000000.0f * PROFILING_BUFFER_SIZE) / (OS_CYCLES_TO_USEC(all_profiling_data[PROFILER_TIME_FPS].total));
 }
@@ -186,11 +441,16 @@ u32 profiler_get_rdp_microseconds() {
 
 void profiler_print_times() {
     u32 microseconds[PROFILER_TIME_COUNT];
-    char text_buffer[196];
 
     update_fps_timer();
     update_total_timer();
     update_rdp_timers();
+#ifdef PROFILER_HISTORY
+    profiler_history_capture();
+#endif
+#ifdef ENABLE_BENCHMARK_REPLAY
+    benchmark_replay_update();
+#endif
 
 #ifndef PUPPYPRINT_DEBUG
     static u8 show_profiler = 0;
@@ -217,7 +477,14 @@ void profiler_print_times() {
         u32 total_rsp = microseconds[PROFILER_TIME_RSP_GFX] + microseconds[PROFILER_TIME_RSP_AUDIO];
         u32 max_rdp = MAX(MAX(microseconds[PROFILER_TIME_TMEM], microseconds[PROFILER_TIME_CMD]), microseconds[PROFILER_TIME_PIPE]);
 
-        sprintf(text_buffer,
+        Gfx* dlHead = gDisplayListHead;
+        gDPPipeSync(dlHead++);
+        gDPSetCycleType(dlHead++, G_CYC_1CYCLE);
+        gDPSetRenderMode(dlHead++, G_RM_TEX_EDGE, G_RM_TEX_EDGE2);
+        gDPSetTexturePersp(dlHead++, G_TP_NONE);
+        gDPSetTextureFilter(dlHead++, G_TF_POINT);
+        gDPSetTextureLUT(dlHead++, G_TT_NONE);
+        drawSmallStringFmt(&dlHead, 10, 10, 255, 255, 255,
             "FPS: %5.2f\n"
             "\n"
             "CPU\t\t%d (%d%%)\n"
@@ -253,14 +520,31 @@ void profiler_print_times() {
             microseconds[PROFILER_TIME_RSP_AUDIO]
         );
 
-        Gfx* dlHead = gDisplayListHead;
-        gDPPipeSync(dlHead++);
-        gDPSetCycleType(dlHead++, G_CYC_1CYCLE);
-        gDPSetRenderMode(dlHead++, G_RM_TEX_EDGE, G_RM_TEX_EDGE2);
-        gDPSetTexturePersp(dlHead++, G_TP_NONE);
-        gDPSetTextureFilter(dlHead++, G_TF_POINT);
-        gDPSetTextureLUT(dlHead++, G_TT_NONE);
-        drawSmallStringCol(&dlHead, 10, 10, text_buffer, 255, 255, 255);
+#ifdef PROFILER_RDP_ATTRIBUTION
+        u32 rdp_in_gfx = RDP_CYCLE_CONV(rdp_scope_data[PROFILER_TIME_GFX].total / PROFILING_BUFFER_SIZE);
+        u32 rdp_in_bhv = RDP_CYCLE_CONV((rdp_scope_data[PROFILER_TIME_BEHAVIOR_BEFORE_MARIO].total
+                                       + rdp_scope_data[PROFILER_TIME_MARIO].total
+                                       + rdp_scope_data[PROFILER_TIME_BEHAVIOR_AFTER_MARIO].total) / PROFILING_BUFFER_SIZE);
+        u32 rdp_other = (max_rdp > rdp_in_gfx + rdp_in_bhv) ? (max_rdp - rdp_in_gfx - rdp_in_bhv) : 0;
+        const char *bound;
+
+        if (max_rdp > total_cpu && max_rdp > total_rsp) {
+            bound = "RDP";
+        } else if (total_cpu > total_rsp) {
+            bound = "CPU";
+        } else {
+            bound = "RSP";
+        }
+
+        drawSmallStringFmt(&dlHead, 170, 10, 255, 255, 255,
+            "BOUND: %s\n"
+            "\n"
+            "RDP BUSY IN\n"
+            " Graph\t\t%d\n"
+            " Behavior\t%d\n"
+            " Other\t\t%d\n",
+            bound, rdp_in_gfx, rdp_in_bhv, rdp_other);
+#endif
         gDisplayListHead = dlHead;
     }
 }
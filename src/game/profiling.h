@@ -33,6 +33,54 @@ enum ProfilerRSPTime {
     PROFILER_RSP_COUNT
 };
 
+#if defined(USE_PROFILER) && defined(PROFILER_HISTORY)
+#define PROFILER_HISTORY_FRAMES 600
+
+enum ProfilerHistoryChannel {
+    PROFILER_HIST_CPU,
+    PROFILER_HIST_BEHAVIOR,
+    PROFILER_HIST_GRAPH,
+    PROFILER_HIST_AUDIO,
+    PROFILER_HIST_RSP,
+    PROFILER_HIST_RDP,
+    PROFILER_HIST_COUNT,
+};
+
+// Per-frame microsecond samples, oldest overwritten first. gProfilerHistoryIndex
+// is the next slot to be written, so (index - 1) is the most recent frame.
+extern u16 gProfilerHistory[PROFILER_HIST_COUNT][PROFILER_HISTORY_FRAMES];
+extern s32 gProfilerHistoryIndex;
+extern u8 gProfilerHistoryPaused;
+
+#if defined(PROFILER_SRAM_CAPTURE) && defined(SRAM)
+// All of PROFILER_SRAM_CAPTURE's prerequisites are met.
+#define PROFILER_SRAM_CAPTURE_ACTIVE
+#endif
+#endif
+
+#ifdef PROFILER_SRAM_CAPTURE_ACTIVE
+// Frames of history stored per capture; the spike frame is the newest.
+#define PROFILER_SRAM_CAPTURE_FRAMES 120
+#define PROFILER_SRAM_CAPTURE_MAGIC 0x48495443 // 'HITC'
+// SRAM offset of the capture, at the far end past the save image.
+#define PROFILER_SRAM_CAPTURE_ADDR (0x8000 - 0x600)
+
+struct ProfilerSramCapture {
+    u32 magic;
+    u32 globalTimer; // gGlobalTimer of the spike frame
+    u16 spikeUs;
+    u8 levelNum;
+    u8 areaIndex;
+    u16 samples[PROFILER_HIST_COUNT][PROFILER_SRAM_CAPTURE_FRAMES];
+};
+
+// The capture read back from SRAM at boot (or written this session).
+extern struct ProfilerSramCapture gProfilerSramCapture;
+extern u8 gProfilerSramCaptureValid;
+void profiler_sram_capture_load(void);
+void profiler_sram_capture_clear(void);
+#endif
+
 #ifdef USE_PROFILER
 void profiler_update(enum ProfilerTime which);
 void profiler_print_times();
@@ -10,6 +10,7 @@
 #include "audio/data.h"
 #include "game_init.h"
 #include "engine/math_util.h"
+#include "gfx_dimensions.h"
 #include "print.h"
 #include "engine/surface_collision.h"
 #include "engine/surface_load.h"
@@ -294,7 +295,7 @@ static void puppycam_display_box(s32 x1, s32 y1, s32 x2, s32 y2, u8 r, u8 g, u8
         gDPSetRenderMode(gDisplayListHead++, G_RM_OPA_SURF, G_RM_OPA_SURF);
     }
     gDPSetEnvColor(   gDisplayListHead++, r, g, b, a);
-    gDPFillRectangle( gDisplayListHead++, x1, y1, x2, y2);
+    gDPFillRectangle( gDisplayListHead++, x1, ADAPTIVE_RES_Y(y1), x2, ADAPTIVE_RES_Y(y2));
     gDPPipeSync(      gDisplayListHead++);
     gDPSetEnvColor(   gDisplayListHead++, 255, 255, 255, 255);
     gDPSetCycleType(  gDisplayListHead++, G_CYC_1CYCLE);
@@ -1241,6 +1242,15 @@ static void puppycam_script(void) {
     }
 }
 
+#ifdef PUPPYCAM_COLLISION_CACHE
+// The surfaces the two camera rays hit last frame, and the collision distance
+// that frame settled on. NULL entries mean the ray was clear (or hit a dynamic
+// surface, whose pointer can't be held across the per-frame rebuild).
+static struct Surface *sPuppycamHitSurf[2] = { NULL, NULL };
+static u32 sPuppycamHitFrame = 0;
+static f32 sPuppycamLastColDist = 0.f;
+#endif
+
 // Handles collision detection using ray casting.
 static void puppycam_collision(void) {
     struct WallCollisionData wall0, wall1;
@@ -1265,8 +1275,36 @@ static void puppycam_collision(void) {
 
     vec3_copy(camdir[1], camdir[0]);
 
+#ifdef PUPPYCAM_COLLISION_CACHE
+    // Re-verify last frame's hit surfaces against this frame's rays before
+    // paying for the full spatial-partition cast. Every 4th frame the full
+    // cast runs regardless, so a surface that moved between the camera and a
+    // still-intersecting cached hit can't stay hidden for long.
+    s32 reverify = (sPuppycamHitFrame + 1 == gGlobalTimer) && ((gGlobalTimer & 3) != 0);
+    f32 dirLength = vec3_mag(camdir[0]);
+    Vec3f dirNorm;
+    s32 i;
+    f32 hitLength;
+
+    sPuppycamHitFrame = gGlobalTimer;
+    vec3_copy(dirNorm, camdir[0]);
+    if (dirLength > NEAR_ZERO) {
+        vec3_div_val(dirNorm, dirLength);
+    }
+    for (i = 0; i < 2; i++) {
+        if (reverify && sPuppycamHitSurf[i] != NULL
+            && ray_surface_intersect(target[i], dirNorm, dirLength, sPuppycamHitSurf[i], hitpos[i], &hitLength)) {
+            surf[i] = sPuppycamHitSurf[i];
+        } else {
+            surf[i] = NULL;
+            find_surface_on_ray(target[i], camdir[i], &surf[i], hitpos[i], RAYCAST_FIND_FLOOR | RAYCAST_FIND_CEIL | RAYCAST_FIND_WALL);
+            sPuppycamHitSurf[i] = (surf[i] != NULL && surf[i]->object == NULL) ? surf[i] : NULL;
+        }
+    }
+#else
     find_surface_on_ray(target[0], camdir[0], &surf[0], hitpos[0], RAYCAST_FIND_FLOOR | RAYCAST_FIND_CEIL | RAYCAST_FIND_WALL);
     find_surface_on_ray(target[1], camdir[1], &surf[1], hitpos[1], RAYCAST_FIND_FLOOR | RAYCAST_FIND_CEIL | RAYCAST_FIND_WALL);
+#endif
     resolve_and_return_wall_collisions(hitpos[0], 0.0f, 25.0f, &wall0);
     resolve_and_return_wall_collisions(hitpos[1], 0.0f, 25.0f, &wall1);
     dist[0] = ((target[0][0] - hitpos[0][0]) * (target[0][0] - hitpos[0][0]) + (target[0][1] - hitpos[0][1]) * (target[0][1] - hitpos[0][1]) + (target[0][2] - hitpos[0][2]) * (target[0][2] - hitpos[0][2]));
@@ -1276,6 +1314,13 @@ static void puppycam_collision(void) {
 
     if (surf[0] && surf[1]) {
         gPuppyCam.collisionDistance = sqrtf(MAX(dist[0], dist[1]));
+#ifdef PUPPYCAM_COLLISION_CACHE
+        // Let the allowed distance grow back gradually when the obstruction
+        // recedes; shrinking still snaps so the camera never clips through.
+        if (gPuppyCam.collisionDistance > sPuppycamLastColDist) {
+            gPuppyCam.collisionDistance = approach_f32_asymptotic(sPuppycamLastColDist, gPuppyCam.collisionDistance, 0.35f);
+        }
+#endif
         if (gPuppyCam.zoom > gPuppyCam.collisionDistance) {
             gPuppyCam.zoom = MIN(gPuppyCam.collisionDistance, gPuppyCam.zoomTarget);
             if (gPuppyCam.zoom - gPuppyCam.zoomTarget < 5) {
@@ -1287,6 +1332,9 @@ static void puppycam_collision(void) {
             }
         }
     }
+#ifdef PUPPYCAM_COLLISION_CACHE
+    sPuppycamLastColDist = gPuppyCam.collisionDistance;
+#endif
     #define START_DIST 500
     #define END_DIST   250
     gPuppyCam.opacity = CLAMP((f32)(((gPuppyCam.zoom - END_DIST) / 255.0f) * (START_DIST - END_DIST)), 0, 255);
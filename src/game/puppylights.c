@@ -36,6 +36,7 @@ shaped and rotated correctly, for accurate representation of their properties.
 #include "level_update.h"
 #include "engine/surface_collision.h"
 #include "surface_terrains.h"
+#include "game_init.h"
 
 #ifdef PUPPYLIGHTS
 
@@ -72,6 +73,157 @@ void puppylights_allocate(void) {
 
 extern Mat4 gMatStack[32];
 
+#ifdef PUPPYLIGHTS_GRID
+STATIC_ASSERT(MAX_LIGHTS <= 32, "PUPPYLIGHTS_GRID packs light indices into u32 cell masks.");
+
+#define LIGHT_GRID_CELLS     16
+#define LIGHT_GRID_CELL_SIZE ((LEVEL_BOUNDARY_MAX * 2) / LIGHT_GRID_CELLS)
+
+/**
+ * Bitmask per grid cell of which gPuppyLights volumes can reach it, with the cell
+ * range and a content checksum cached per light so the grid is only rewritten for
+ * lights that actually moved or changed. sLightCellStamp holds the frame number of
+ * the last change touching each cell, which is what lets puppylights_run prove
+ * that nothing relevant to an object has changed and skip its light pass.
+ */
+static u32 sLightCellMask[LIGHT_GRID_CELLS][LIGHT_GRID_CELLS];
+static u32 sLightCellStamp[LIGHT_GRID_CELLS][LIGHT_GRID_CELLS];
+// Bits of slotted directional lights. Their output depends on the camera, so a
+// cell containing one can never take the skip or static-base paths.
+static u32 sLightCellDirMask[LIGHT_GRID_CELLS][LIGHT_GRID_CELLS];
+#ifdef PUPPYLIGHTS_STATIC_BAKE
+// Stamped only by changes to static (index < gDynLightStart) lights.
+static u32 sLightCellStaticStamp[LIGHT_GRID_CELLS][LIGHT_GRID_CELLS];
+#endif
+static struct LightGridSlot {
+    u8 slotted;                // Whether this light currently has bits in the grid.
+    u8 isStatic;               // Whether it was a static (level script) slot when slotted.
+    u8 isDirectional;          // Whether PUPPYLIGHT_DIRECTIONAL was set when slotted.
+    s8 minX, maxX, minZ, maxZ; // The cell range those bits cover.
+    u32 checksum;              // Checksum of the light struct when last slotted.
+} sLightGridSlots[MAX_LIGHTS];
+static u32 sLightGridTimer = 0;       // Frame the grid was last refreshed.
+static u32 sLightGridGlobalStamp = 0; // Frame the area, room or base light last changed.
+static s16 sLightGridPrevArea = -1;
+static s16 sLightGridPrevRoom = -1;
+static u32 sLightGridBaseSum = 0;
+
+static s32 light_grid_cell(s32 coord) {
+    s32 cell = (coord + LEVEL_BOUNDARY_MAX) / LIGHT_GRID_CELL_SIZE;
+    return CLAMP(cell, 0, LIGHT_GRID_CELLS - 1);
+}
+
+// Order-sensitive byte checksum, cheap enough to run over every light each frame.
+static u32 light_grid_checksum(void *data, u32 size) {
+    u8 *bytes = data;
+    u32 sum = 0;
+    u32 i;
+
+    for (i = 0; i < size; i++) {
+        sum = (sum << 1) + bytes[i];
+    }
+    return sum;
+}
+
+// Sets or clears a light's bit over its slotted cell range, stamping every touched
+// cell. Setting an already slotted light is how a pure content change is stamped.
+static void light_grid_mark(s32 index, s32 set) {
+    struct LightGridSlot *slot = &sLightGridSlots[index];
+    u32 bit = (1 << index);
+    s32 cellX, cellZ;
+
+    for (cellZ = slot->minZ; cellZ <= slot->maxZ; cellZ++) {
+        for (cellX = slot->minX; cellX <= slot->maxX; cellX++) {
+            if (set) {
+                sLightCellMask[cellZ][cellX] |= bit;
+            } else {
+                sLightCellMask[cellZ][cellX] &= ~bit;
+            }
+            if (set && slot->isDirectional) {
+                sLightCellDirMask[cellZ][cellX] |= bit;
+            } else {
+                sLightCellDirMask[cellZ][cellX] &= ~bit;
+            }
+            sLightCellStamp[cellZ][cellX] = gGlobalTimer;
+#ifdef PUPPYLIGHTS_STATIC_BAKE
+            if (slot->isStatic) {
+                sLightCellStaticStamp[cellZ][cellX] = gGlobalTimer;
+            }
+#endif
+        }
+    }
+}
+
+/**
+ * Reslots any light whose reach or contents changed since the previous frame. Ran
+ * once per frame before the first light pass; a light that hasn't changed costs a
+ * checksum and a handful of compares.
+ */
+static void puppylights_grid_refresh(void) {
+    s32 i;
+
+    if (sLightGridTimer == gGlobalTimer) {
+        return;
+    }
+    sLightGridTimer = gGlobalTimer;
+
+    // Light eligibility also hangs off the current area and room, and the base
+    // light is the canvas every pass blends onto, so any of those changing
+    // invalidates every cached result at once.
+    u32 baseSum = light_grid_checksum(levelAmbient ? &gLevelLight : &sDefaultLights, sizeof(Lights1));
+    if (gCurrAreaIndex != sLightGridPrevArea || gMarioCurrentRoom != sLightGridPrevRoom
+        || baseSum != sLightGridBaseSum) {
+        sLightGridPrevArea = gCurrAreaIndex;
+        sLightGridPrevRoom = gMarioCurrentRoom;
+        sLightGridBaseSum = baseSum;
+        sLightGridGlobalStamp = gGlobalTimer;
+    }
+
+    for (i = 0; i < MAX_LIGHTS; i++) {
+        struct LightGridSlot *slot = &sLightGridSlots[i];
+        struct PuppyLight *light = (i < gNumLights) ? gPuppyLights[i] : NULL;
+        s32 eligible = (light != NULL && light->active == TRUE && light->rgba[3] > 0);
+        s8 minX = 0, maxX = 0, minZ = 0, maxZ = 0;
+
+        if (eligible) {
+            // A yawed box is covered conservatively by the sum of its half
+            // extents; exact containment still happens in puppylights_iterate.
+            s32 radius = light->pos[1][0] + light->pos[1][2];
+            minX = light_grid_cell(light->pos[0][0] - radius);
+            maxX = light_grid_cell(light->pos[0][0] + radius);
+            minZ = light_grid_cell(light->pos[0][2] - radius);
+            maxZ = light_grid_cell(light->pos[0][2] + radius);
+        }
+
+        if (slot->slotted && (!eligible || slot->minX != minX || slot->maxX != maxX
+                              || slot->minZ != minZ || slot->maxZ != maxZ)) {
+            light_grid_mark(i, FALSE);
+            slot->slotted = FALSE;
+        }
+        if (!eligible) {
+            continue;
+        }
+
+        u32 checksum = light_grid_checksum(light, sizeof(struct PuppyLight));
+        if (!slot->slotted) {
+            slot->slotted = TRUE;
+            slot->isStatic = (i < gDynLightStart);
+            slot->isDirectional = ((light->flags & PUPPYLIGHT_DIRECTIONAL) != 0);
+            slot->minX = minX;
+            slot->maxX = maxX;
+            slot->minZ = minZ;
+            slot->maxZ = maxZ;
+            slot->checksum = checksum;
+            light_grid_mark(i, TRUE);
+        } else if (checksum != slot->checksum) {
+            slot->checksum = checksum;
+            slot->isDirectional = ((light->flags & PUPPYLIGHT_DIRECTIONAL) != 0);
+            light_grid_mark(i, TRUE); // Same cells, but their stamps need to move.
+        }
+    }
+}
+#endif
+
 // Function that iterates through each light.
 void puppylights_iterate(struct PuppyLight *light, Lights1 *src, struct Object *obj, s32 flags) {
     Lights1 *tempLight;
@@ -204,6 +356,15 @@ void puppylights_iterate(struct PuppyLight *light, Lights1 *src, struct Object *
     }
 }
 
+#ifdef PUPPYLIGHTS_STATIC_BAKE
+// Snapshots the blended static portion of a pass before any dynamic light lands on top.
+static void puppylights_bake_static(struct Object *obj, Lights1 *src, s32 offsetPlaced) {
+    memcpy(&obj->puppylightStaticBase, segmented_to_virtual(src), sizeof(Lights1));
+    obj->puppylightStaticOffsetPlaced = offsetPlaced;
+    obj->puppylightStaticStamp = gGlobalTimer;
+}
+#endif
+
 // Main function. Run this in the object you wish to illuminate, and just give it its light, object pointer and any potential flags if you want to use them.
 // If the object has multiple lights, then you run this for each light.
 void puppylights_run(Lights1 *src, struct Object *obj, s32 flags, u32 baseColour) {
@@ -211,32 +372,101 @@ void puppylights_run(Lights1 *src, struct Object *obj, s32 flags, u32 baseColour
     s32 numlights = 0;
     s32 offsetPlaced = 0;
     s32 lightFlags = flags;
+#ifdef PUPPYLIGHTS_GRID
+    s32 cellX, cellZ;
+    u32 cellMask;
+#endif
 
     if (gCurrLevelNum < LEVEL_BBH) {
         return;
     }
+#ifdef PUPPYLIGHTS_GRID
+    puppylights_grid_refresh();
+    cellX = light_grid_cell(obj->oPosX);
+    cellZ = light_grid_cell(obj->oPosZ);
+    cellMask = sLightCellMask[cellZ][cellX];
+
+    // The previous pass can only be reused if the call's inputs are identical and
+    // no directional light can reach the cell, since those blend through the
+    // camera matrix and change even while everything else holds still. An object
+    // running several lights through here ping-pongs puppylightGridSrc and simply
+    // never reuses anything, which is safe.
+    s32 inputsMatch = (sLightCellDirMask[cellZ][cellX] == 0
+        && src == obj->puppylightGridSrc && flags == obj->puppylightGridFlags
+        && baseColour == obj->puppylightGridColour
+        && obj->oPosX == obj->puppylightGridPos[0]
+        && obj->oPosY == obj->puppylightGridPos[1]
+        && obj->oPosZ == obj->puppylightGridPos[2]);
+
+    // src already holds the right colours when nothing that can reach the cell
+    // has changed since the last pass, so skip the recompute outright.
+    if (inputsMatch && sLightCellStamp[cellZ][cellX] <= obj->puppylightGridStamp
+        && sLightGridGlobalStamp <= obj->puppylightGridStamp) {
+        return;
+    }
+#ifdef PUPPYLIGHTS_STATIC_BAKE
+    // Failing that, the cached static-lights-only base can still stand in for the
+    // static half of the pass as long as no static light has changed either.
+    s32 staticValid = (inputsMatch
+        && sLightCellStaticStamp[cellZ][cellX] <= obj->puppylightStaticStamp
+        && sLightGridGlobalStamp <= obj->puppylightStaticStamp);
+#endif
+    obj->puppylightGridSrc = src;
+    obj->puppylightGridFlags = flags;
+    obj->puppylightGridColour = baseColour;
+    obj->puppylightGridPos[0] = obj->oPosX;
+    obj->puppylightGridPos[1] = obj->oPosY;
+    obj->puppylightGridPos[2] = obj->oPosZ;
+    obj->puppylightGridStamp = gGlobalTimer;
+#endif
     // Checks if there's a hardset colour. Colours are only the first 3 bytes, so you can really put whatever you want in the last.
     // If there isn't a colour, then it decides whether to apply the ambient lighting, or the default lighting as the baseline.
     // Otherwise, it hardsets a colour to begin with. I don't recommend you use this, simply because it's intended to be used
     // As a hacky quick-fix for models coloured by lights. Lightcoloured models don't blend nearly as nicely as ones coloured
     // By other means.
-    if (baseColour < 0x100) {
-        sLightBase = (levelAmbient ? &gLevelLight : &sDefaultLights);
-    } else {
-        s32 colour;
-        sLightBase = (levelAmbient) ? &gLevelLight : &sDefaultLights;
-        for (i = 0; i < 3; i++) {
-            colour = (((baseColour >> (24-(i*8)))) & 0xFF);
-            sLightBase->l[0].l.col[i] = colour;
-            sLightBase->l[0].l.colc[i] = colour;
-            sLightBase->a.l.col[i] = colour/2;
-            sLightBase->a.l.colc[i] = colour/2;
-            sLightBase->l->l.dir[i] = 0x28;
+    i = 0;
+#ifdef PUPPYLIGHTS_STATIC_BAKE
+    if (staticValid) {
+        // The cached base already contains every static light's contribution, so
+        // the pass resumes at the first dynamic slot.
+        memcpy(segmented_to_virtual(src), &obj->puppylightStaticBase, sizeof(Lights1));
+        offsetPlaced = obj->puppylightStaticOffsetPlaced;
+        i = gDynLightStart;
+    } else
+#endif
+    {
+        if (baseColour < 0x100) {
+            sLightBase = (levelAmbient ? &gLevelLight : &sDefaultLights);
+        } else {
+            s32 colour;
+            s32 j;
+            sLightBase = (levelAmbient) ? &gLevelLight : &sDefaultLights;
+            for (j = 0; j < 3; j++) {
+                colour = (((baseColour >> (24-(j*8)))) & 0xFF);
+                sLightBase->l[0].l.col[j] = colour;
+                sLightBase->l[0].l.colc[j] = colour;
+                sLightBase->a.l.col[j] = colour/2;
+                sLightBase->a.l.colc[j] = colour/2;
+                sLightBase->l->l.dir[j] = 0x28;
+            }
         }
+        memcpy(segmented_to_virtual(src), &sLightBase[0], sizeof(Lights1));
     }
-    memcpy(segmented_to_virtual(src), &sLightBase[0], sizeof(Lights1));
 
-    for (i = 0; i < gNumLights; i++) {
+    for (; i < gNumLights; i++) {
+#ifdef PUPPYLIGHTS_STATIC_BAKE
+        // Everything below gDynLightStart is blended; snapshot the static half
+        // before the first dynamic light lands on top of it.
+        if (i == gDynLightStart && !staticValid) {
+            puppylights_bake_static(obj, src, offsetPlaced);
+            staticValid = TRUE;
+        }
+#endif
+#ifdef PUPPYLIGHTS_GRID
+        if (!(cellMask & (1 << i))) {
+            continue;
+        }
+#endif
         if (gPuppyLights[i]->rgba[3] > 0 && gPuppyLights[i]->active == TRUE && gPuppyLights[i]->area == gCurrAreaIndex && (gPuppyLights[i]->room == -1 || gPuppyLights[i]->room == gMarioCurrentRoom)) {
             if (gPuppyLights[i]->flags & PUPPYLIGHT_DIRECTIONAL && !offsetPlaced) {
                 lightFlags |= LIGHTFLAG_DIRECTIONAL_OFFSET;
@@ -248,6 +478,12 @@ void puppylights_run(Lights1 *src, struct Object *obj, s32 flags, u32 baseColour
             numlights++;
         }
     }
+#ifdef PUPPYLIGHTS_STATIC_BAKE
+    // No dynamic slots were allocated, so the finished pass is all static.
+    if (!staticValid) {
+        puppylights_bake_static(obj, src, offsetPlaced);
+    }
+#endif
 }
 
 // Sets and updates dynamic lights from objects.
@@ -26,6 +26,7 @@ a modern game engine's developer's console.
 #include <ultra64.h>
 
 #include "config.h"
+#include "gfx_dimensions.h"
 #include "game_init.h"
 #include "memory.h"
 #include "print.h"
@@ -41,9 +42,14 @@ a modern game engine's developer's console.
 #include "engine/surface_load.h"
 #include "audio/data.h"
 #include "audio/heap.h"
+#include "audio/external.h"
 #include "hud.h"
 #include "debug_box.h"
 #include "color_presets.h"
+#include "puppylights.h"
+#include "puppycam2.h"
+#include "profiling.h"
+#include "frame_stats.h"
 
 #ifdef PUPPYPRINT
 
@@ -126,8 +132,8 @@ void puppyprint_calculate_ram_usage(void) {
     // gEffectsMemoryPool is 0x4000, gObjectMemoryPool is 0x800. Epic C limitations mean I can't just sizeof their values :)
     ramsizeSegment[5] = (EFFECTS_MEMORY_POOL + OBJECT_MEMORY_POOL
                        + EFFECTS_MEMORY_POOL + OBJECT_MEMORY_POOL);
-    ramsizeSegment[6] = ((SURFACE_NODE_POOL_SIZE * sizeof(struct SurfaceNode))
-                       + (     SURFACE_POOL_SIZE * sizeof(struct Surface    )));
+    ramsizeSegment[6] = ((sSurfaceNodePoolSize * sizeof(struct SurfaceNode))
+                       + (     sSurfacePoolSize * sizeof(struct Surface    )));
     ramsizeSegment[7] = gAudioHeapSize;
 }
 
@@ -360,6 +366,247 @@ void print_audio_ram_overview(void) {
     print_small_text(x, tmpY, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
 }
 
+#if defined(VERSION_JP) || defined(VERSION_US)
+const char *audioPhaseNames[AUDIO_PHASE_COUNT] = {
+    "Game sound",
+    "Sequences",
+    "Synthesis",
+    "DMA waits",
+};
+
+/**
+ * Min/avg/max per audio-thread phase over the last AUDIO_PROFILING_BUFFER_SIZE
+ * audio frames. The numbers come from the timers in create_next_audio_frame_task,
+ * so they cover the audio thread only, unlike the whole-frame "Audio" bar on the
+ * standard page.
+ */
+void print_audio_profiling(void) {
+    char textBytes[80];
+    const s32 x = 16;
+    s32 y = 16;
+    s32 i, j;
+
+    prepare_blank_box();
+    render_blank_box(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0, 0, 192);
+    finish_blank_box();
+
+    print_small_text(x, y, "AUDIO THREAD (MIN / AVG / MAX US):", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+    y += 16;
+    for (i = 0; i < AUDIO_PHASE_COUNT; i++) {
+        u32 min = 0xFFFFFFFF;
+        u32 max = 0;
+        u32 avg = 0;
+        for (j = 0; j < AUDIO_PROFILING_BUFFER_SIZE; j++) {
+            u32 sample = gAudioPhaseTimes[i][j];
+            if (sample < min) min = sample;
+            if (sample > max) max = sample;
+            avg += sample;
+        }
+        avg /= AUDIO_PROFILING_BUFFER_SIZE;
+
+        sprintf(textBytes, "%s: %d / %d / %d", audioPhaseNames[i],
+                (s32) CYCLE_CONV(min),
+                (s32) CYCLE_CONV(avg),
+                (s32) CYCLE_CONV(max));
+        print_set_envcolour(colourChart[i][0], colourChart[i][1], colourChart[i][2], 255);
+        print_small_text(x, y, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+        y += 12;
+    }
+
+    print_set_envcolour(255, 255, 255, 255);
+    print_small_text(x, (SCREEN_HEIGHT - 28), "R: Dump to log", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+
+    if (gPlayer1Controller->buttonPressed & R_JPAD) {
+        for (i = 0; i < AUDIO_PHASE_COUNT; i++) {
+            for (j = 0; j < AUDIO_PROFILING_BUFFER_SIZE; j++) {
+                append_puppyprint_log("%s[%d]: %d\n", audioPhaseNames[i], j,
+                                      (s32) CYCLE_CONV(gAudioPhaseTimes[i][j]));
+            }
+        }
+    }
+}
+#endif
+
+/**
+ * Top behaviors by CPU cost this frame, from the per-behavior cycle accounting
+ * in cur_obj_update. Behaviors are identified by script address; look the
+ * address up in the map file for the name.
+ */
+void print_behavior_profiling(void) {
+    char textBytes[80];
+    struct BhvProfileEntry entries[BHV_PROFILE_MAX_BEHAVIORS];
+    s32 len = gBhvProfileSnapshotLen;
+    const s32 x = 16;
+    s32 y = 16;
+    s32 i, j;
+
+    for (i = 0; i < len; i++) {
+        entries[i] = gBhvProfileSnapshot[i];
+    }
+    // Selection sort by total cycles; only the displayed prefix needs ordering.
+    for (i = 0; i < len - 1 && i < 10; i++) {
+        s32 top = i;
+        for (j = i + 1; j < len; j++) {
+            if (entries[j].cycles > entries[top].cycles) {
+                top = j;
+            }
+        }
+        if (top != i) {
+            struct BhvProfileEntry tmp = entries[i];
+            entries[i] = entries[top];
+            entries[top] = tmp;
+        }
+    }
+
+    prepare_blank_box();
+    render_blank_box(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0, 0, 192);
+    finish_blank_box();
+
+    print_small_text(x, y, "BEHAVIOR (COUNT): TOTAL / EACH US", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+    y += 16;
+    for (i = 0; i < len && i < 10; i++) {
+        sprintf(textBytes, "%08X (%d): %d / %d", (u32) (uintptr_t) entries[i].behavior,
+                entries[i].count,
+                (s32) CYCLE_CONV(entries[i].cycles),
+                (s32) CYCLE_CONV(entries[i].cycles / entries[i].count));
+        print_set_envcolour(colourChart[i][0], colourChart[i][1], colourChart[i][2], 255);
+        print_small_text(x, y, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+        y += 12;
+    }
+
+    print_set_envcolour(255, 255, 255, 255);
+    print_small_text(x, (SCREEN_HEIGHT - 28), "R: Dump to log", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+
+    if (gPlayer1Controller->buttonPressed & R_JPAD) {
+        for (i = 0; i < len; i++) {
+            append_puppyprint_log("bhv %08X (%d): %d / %d us\n",
+                                  (u32) (uintptr_t) entries[i].behavior,
+                                  entries[i].count,
+                                  (s32) CYCLE_CONV(entries[i].cycles),
+                                  (s32) CYCLE_CONV(entries[i].cycles / entries[i].count));
+        }
+    }
+}
+
+const char memTagNames[MEM_TAG_COUNT][12] = {
+    "Other",
+    "Segments",
+    "Surfaces",
+    "Anims",
+    "Pools",
+};
+
+struct MemoryPool **memPoolList[] = {
+    &gEffectsMemoryPool,
+    &gObjectMemoryPool,
+#ifdef PUPPYLIGHTS
+    &gLightsPool,
+#endif
+#ifdef PUPPYCAM
+    &gPuppyMemoryPool,
+#endif
+};
+
+const char *memPoolNames[] = {
+    "Effects",
+    "Objects",
+#ifdef PUPPYLIGHTS
+    "Lights",
+#endif
+#ifdef PUPPYCAM
+    "Puppycam",
+#endif
+};
+
+#define NUM_TRACKED_POOLS (s32)(sizeof(memPoolList) / sizeof(memPoolList[0]))
+
+/**
+ * Dump the per-tag and per-pool watermarks to the console log (and over USB
+ * when UNF is enabled), so pool sizes can be tuned from captured numbers.
+ */
+void puppyprint_dump_memory(void) {
+    s32 i;
+
+    for (i = 0; i < MEM_TAG_COUNT; i++) {
+        append_puppyprint_log("%s: %X / %X\n", memTagNames[i], gMemTagUsage[i], gMemTagPeak[i]);
+    }
+    for (i = 0; i < NUM_TRACKED_POOLS; i++) {
+        if (*memPoolList[i] == NULL) {
+            continue;
+        }
+        append_puppyprint_log("%s pool: %X / %X / %X\n", memPoolNames[i],
+                              mem_pool_get_used(*memPoolList[i]),
+                              mem_pool_get_peak(*memPoolList[i]),
+                              mem_pool_get_total(*memPoolList[i]));
+    }
+    append_puppyprint_log("Main pool free: %X\n", main_pool_available());
+}
+
+void print_memory_overview(void) {
+    char textBytes[64];
+    const s32 x = 16;
+    s32 y = 16;
+    s32 i;
+
+    prepare_blank_box();
+    render_blank_box(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0, 0, 192);
+    finish_blank_box();
+
+    print_small_text(x, y, "MAIN POOL (USED / PEAK):", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+    y += 12;
+    for (i = 0; i < MEM_TAG_COUNT; i++) {
+        sprintf(textBytes, "%s: %X / %X", memTagNames[i], gMemTagUsage[i], gMemTagPeak[i]);
+        print_set_envcolour(colourChart[i][0], colourChart[i][1], colourChart[i][2], 255);
+        print_small_text(x, y, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+        y += 12;
+    }
+
+    y += 12;
+    print_set_envcolour(255, 255, 255, 255);
+    print_small_text(x, y, "POOLS (USED / PEAK / SIZE):", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+    y += 12;
+    for (i = 0; i < NUM_TRACKED_POOLS; i++) {
+        if (*memPoolList[i] == NULL) {
+            continue;
+        }
+        sprintf(textBytes, "%s: %X / %X / %X", memPoolNames[i],
+                mem_pool_get_used(*memPoolList[i]),
+                mem_pool_get_peak(*memPoolList[i]),
+                mem_pool_get_total(*memPoolList[i]));
+        print_set_envcolour(colourChart[MEM_TAG_COUNT + i][0], colourChart[MEM_TAG_COUNT + i][1], colourChart[MEM_TAG_COUNT + i][2], 255);
+        print_small_text(x, y, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+        y += 12;
+    }
+
+    print_set_envcolour(255, 255, 255, 255);
+    sprintf(textBytes, "RAM: %06X/%06X (%d_)", main_pool_available(), mempool, (s32)(((f32)main_pool_available() / (f32)mempool) * 100));
+    print_small_text(SCREEN_CENTER_X, (SCREEN_HEIGHT - 16), textBytes, PRINT_TEXT_ALIGN_CENTRE, PRINT_ALL, FONT_OUTLINE);
+    print_small_text(x, (SCREEN_HEIGHT - 28), "R: Dump to log", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+
+    if (gPlayer1Controller->buttonPressed & R_JPAD) {
+        puppyprint_dump_memory();
+    }
+}
+
+/**
+ * Sweep the whole object pool touching exactly the fields cur_obj_update reads
+ * for every object each frame. With the hot fields packed at the front of
+ * rawData this stays within the first cache lines per object; benchmarking it
+ * (custom option on the benchmark page) measures the cache cost of the object
+ * layout in isolation.
+ */
+static void benchmark_object_kernel(void) {
+    volatile f32 sink = 0.0f;
+    s32 i;
+
+    for (i = 0; i < OBJECT_POOL_CAPACITY; i++) {
+        struct Object *obj = &gObjectPool[i];
+        sink += (f32) obj->oFlags + (f32) obj->oAction + (f32) obj->oTimer
+              + (f32) obj->oPrevAction + obj->oPosX + obj->oPosY + obj->oPosZ
+              + obj->oVelX + obj->oVelY + obj->oVelZ;
+    }
+}
+
 void benchmark_custom(void) {
     if ((benchmarkLoop == 0)
      || (benchOption != 2)) {
@@ -369,7 +616,7 @@ void benchmark_custom(void) {
     OSTime lastTime;
     while (TRUE) {
         lastTime = osGetTime();
-        // Insert your function here!
+        benchmark_object_kernel();
 
         if ((benchmarkLoop > 0)
          && (benchOption == 2)) {
@@ -454,8 +701,8 @@ extern s16 gVisualSurfaceCount;
 void puppyprint_render_collision(void) {
     char textBytes[200];
 
-    sprintf(textBytes, "Pool Size: %X#Node Size: %X#Surfaces Allocated: %d#Nodes Allocated: %d#Current Cell: %d", (SURFACE_NODE_POOL_SIZE * sizeof(struct SurfaceNode)), (SURFACE_POOL_SIZE * sizeof(struct Surface)),
-            gSurfacesAllocated, gSurfaceNodesAllocated, gVisualSurfaceCount);
+    sprintf(textBytes, "Pool Size: %X#Node Size: %X#Surfaces Allocated: %d (max %d/%d)#Nodes Allocated: %d (max %d/%d)#Current Cell: %d", (sSurfaceNodePoolSize * sizeof(struct SurfaceNode)), (sSurfacePoolSize * sizeof(struct Surface)),
+            gSurfacesAllocated, gMaxSurfacesAllocated, sSurfacePoolSize, gSurfaceNodesAllocated, gMaxSurfaceNodesAllocated, sSurfaceNodePoolSize, gVisualSurfaceCount);
     print_small_text(304, 60, textBytes, PRINT_TEXT_ALIGN_RIGHT, PRINT_ALL, 1);
 
 
@@ -521,9 +768,19 @@ void print_basic_profiling(void) {
 void puppyprint_render_standard(void) {
     char textBytes[80];
 
-    sprintf(textBytes, "OBJ: %d/%d", gObjectCounter, OBJECT_POOL_CAPACITY);
+    sprintf(textBytes, "OBJ: %d/%d (%d culled)", gObjectCounter, OBJECT_POOL_CAPACITY, gCulledObjectCount);
     print_small_text((SCREEN_WIDTH - 16), 16, textBytes, PRINT_TEXT_ALIGN_RIGHT, PRINT_ALL, FONT_OUTLINE);
 
+    // Last frame's display list pool usage per subsystem, plus the headroom that was left.
+    sprintf(textBytes, "DL: G %d H %d T %d E %d O %d#Free: %d",
+        gGfxPoolTagUsageLast[GFX_POOL_TAG_GRAPH],
+        gGfxPoolTagUsageLast[GFX_POOL_TAG_HUD],
+        gGfxPoolTagUsageLast[GFX_POOL_TAG_TEXT],
+        gGfxPoolTagUsageLast[GFX_POOL_TAG_EFFECTS],
+        gGfxPoolTagUsageLast[GFX_POOL_TAG_OTHER],
+        (s32)(gGfxPoolEnd - (u8 *) gDisplayListHead));
+    print_small_text(16, 40, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+
 #ifndef ENABLE_CREDITS_BENCHMARK
     // Very little point printing useless info if Mario doesn't even exist.
     if (gMarioState->marioObj) {
@@ -595,12 +852,220 @@ void puppyprint_render_minimal(void) {
     print_basic_profiling();
 }
 
+#if defined(USE_PROFILER) && defined(PROFILER_HISTORY)
+
+#define HISTORY_GRAPH_FRAMES 120 // frames visible at once, 2 pixels per frame
+#define HISTORY_GRAPH_X      40
+#define HISTORY_GRAPH_Y      170 // baseline of the graph
+#define HISTORY_GRAPH_H      90
+#define HISTORY_FRAME_BUDGET 33333 // two retraces; the budget line sits at half height
+
+static s32 sHistoryScrub = 0;
+
+// Maps a window column to its slot in the history ring. Column
+// (HISTORY_GRAPH_FRAMES - 1) is the newest visible frame.
+static s32 history_frame_index(s32 col) {
+    s32 frame = gProfilerHistoryIndex - 1 - sHistoryScrub - (HISTORY_GRAPH_FRAMES - 1) + col;
+    return (frame + (PROFILER_HISTORY_FRAMES * 2)) % PROFILER_HISTORY_FRAMES;
+}
+
+void puppyprint_render_history(void) {
+    char textBytes[128];
+    s32 col;
+    s32 worstCol = 0;
+    s32 worstUs = -1;
+    s32 frame;
+
+    if (gPlayer1Controller->buttonPressed & D_JPAD) {
+        gProfilerHistoryPaused ^= TRUE;
+        if (!gProfilerHistoryPaused) {
+            sHistoryScrub = 0;
+        }
+    }
+    if (gProfilerHistoryPaused) {
+        if (gPlayer1Controller->buttonPressed & L_JPAD) {
+            sHistoryScrub += (HISTORY_GRAPH_FRAMES / 2);
+        }
+        if (gPlayer1Controller->buttonPressed & R_JPAD) {
+            sHistoryScrub -= (HISTORY_GRAPH_FRAMES / 2);
+        }
+        sHistoryScrub = CLAMP(sHistoryScrub, 0, (PROFILER_HISTORY_FRAMES - HISTORY_GRAPH_FRAMES));
+    }
+
+    prepare_blank_box();
+    render_blank_box((HISTORY_GRAPH_X - 2), (HISTORY_GRAPH_Y - HISTORY_GRAPH_H - 2),
+                     (HISTORY_GRAPH_X + (HISTORY_GRAPH_FRAMES * 2) + 2), (HISTORY_GRAPH_Y + 2), 0, 0, 0, 168);
+
+    for (col = 0; col < HISTORY_GRAPH_FRAMES; col++) {
+        s32 us = gProfilerHistory[PROFILER_HIST_CPU][history_frame_index(col)];
+        s32 barHeight = (us * HISTORY_GRAPH_H) / (HISTORY_FRAME_BUDGET * 2);
+        s32 x = (HISTORY_GRAPH_X + (col * 2));
+
+        barHeight = CLAMP(barHeight, 1, HISTORY_GRAPH_H);
+        if (us > worstUs) {
+            worstUs = us;
+            worstCol = col;
+        }
+
+        if (us > HISTORY_FRAME_BUDGET) {
+            render_blank_box(x, (HISTORY_GRAPH_Y - barHeight), (x + 2), HISTORY_GRAPH_Y, 255, 64, 64, 255);
+        } else {
+            render_blank_box(x, (HISTORY_GRAPH_Y - barHeight), (x + 2), HISTORY_GRAPH_Y, 64, 255, 64, 255);
+        }
+    }
+
+    // frame budget marker, then a caret under the worst visible frame
+    render_blank_box((HISTORY_GRAPH_X - 2), (HISTORY_GRAPH_Y - (HISTORY_GRAPH_H / 2)),
+                     (HISTORY_GRAPH_X + (HISTORY_GRAPH_FRAMES * 2) + 2), (HISTORY_GRAPH_Y - (HISTORY_GRAPH_H / 2) + 1), 255, 255, 255, 255);
+    render_blank_box((HISTORY_GRAPH_X + (worstCol * 2) - 1), (HISTORY_GRAPH_Y + 2),
+                     (HISTORY_GRAPH_X + (worstCol * 2) + 3), (HISTORY_GRAPH_Y + 5), 255, 255, 0, 255);
+    finish_blank_box();
+
+    print_set_envcolour(255, 255, 255, 255);
+    sprintf(textBytes, "FRAME HISTORY (%d FRAMES BACK)", sHistoryScrub);
+    print_small_text(HISTORY_GRAPH_X, 40, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+
+    frame = history_frame_index(worstCol);
+    sprintf(textBytes, "WORST IN VIEW: %d US (%d FRAMES AGO)#BEH %d  GFX %d  AUD %d#RSP %d  RDP %d",
+        worstUs, (sHistoryScrub + (HISTORY_GRAPH_FRAMES - 1) - worstCol),
+        gProfilerHistory[PROFILER_HIST_BEHAVIOR][frame],
+        gProfilerHistory[PROFILER_HIST_GRAPH][frame],
+        gProfilerHistory[PROFILER_HIST_AUDIO][frame],
+        gProfilerHistory[PROFILER_HIST_RSP][frame],
+        gProfilerHistory[PROFILER_HIST_RDP][frame]);
+    print_small_text(HISTORY_GRAPH_X, (HISTORY_GRAPH_Y + 8), textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+
+    if (gProfilerHistoryPaused) {
+        print_small_text(HISTORY_GRAPH_X, 52, "PAUSED - DPAD L/R: SCRUB  DOWN: RESUME", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+    } else {
+        print_small_text(HISTORY_GRAPH_X, 52, "DPAD DOWN: PAUSE", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+    }
+}
+
+#ifdef PROFILER_SRAM_CAPTURE_ACTIVE
+
+/**
+ * Shows the hitch capture read back from SRAM: the 120 frames of history
+ * leading up to the worst recorded spike, drawn in the history page's
+ * layout, with the spike frame in the rightmost column.
+ */
+void puppyprint_render_sram_capture(void) {
+    char textBytes[128];
+    s32 col;
+
+    if (gPlayer1Controller->buttonPressed & D_JPAD) {
+        profiler_sram_capture_clear();
+    }
+
+    print_set_envcolour(255, 255, 255, 255);
+    print_small_text(160, 24, "SRAM HITCH CAPTURE", PRINT_TEXT_ALIGN_CENTRE, PRINT_ALL, FONT_OUTLINE);
+
+    if (!gProfilerSramCaptureValid) {
+        print_small_text(160, 120, "NO CAPTURED HITCH IN SRAM", PRINT_TEXT_ALIGN_CENTRE, PRINT_ALL, FONT_DEFAULT);
+        return;
+    }
+
+    prepare_blank_box();
+    render_blank_box((HISTORY_GRAPH_X - 2), (HISTORY_GRAPH_Y - HISTORY_GRAPH_H - 2),
+                     (HISTORY_GRAPH_X + (PROFILER_SRAM_CAPTURE_FRAMES * 2) + 2), (HISTORY_GRAPH_Y + 2), 0, 0, 0, 168);
+
+    for (col = 0; col < PROFILER_SRAM_CAPTURE_FRAMES; col++) {
+        s32 us = gProfilerSramCapture.samples[PROFILER_HIST_CPU][col];
+        s32 barHeight = (us * HISTORY_GRAPH_H) / (HISTORY_FRAME_BUDGET * 2);
+        s32 x = (HISTORY_GRAPH_X + (col * 2));
+
+        barHeight = CLAMP(barHeight, 1, HISTORY_GRAPH_H);
+        if (us > HISTORY_FRAME_BUDGET) {
+            render_blank_box(x, (HISTORY_GRAPH_Y - barHeight), (x + 2), HISTORY_GRAPH_Y, 255, 64, 64, 255);
+        } else {
+            render_blank_box(x, (HISTORY_GRAPH_Y - barHeight), (x + 2), HISTORY_GRAPH_Y, 64, 255, 64, 255);
+        }
+    }
+
+    // frame budget marker, then a caret under the spike frame
+    render_blank_box((HISTORY_GRAPH_X - 2), (HISTORY_GRAPH_Y - (HISTORY_GRAPH_H / 2)),
+                     (HISTORY_GRAPH_X + (PROFILER_SRAM_CAPTURE_FRAMES * 2) + 2), (HISTORY_GRAPH_Y - (HISTORY_GRAPH_H / 2) + 1), 255, 255, 255, 255);
+    render_blank_box((HISTORY_GRAPH_X + ((PROFILER_SRAM_CAPTURE_FRAMES - 1) * 2) - 1), (HISTORY_GRAPH_Y + 2),
+                     (HISTORY_GRAPH_X + ((PROFILER_SRAM_CAPTURE_FRAMES - 1) * 2) + 3), (HISTORY_GRAPH_Y + 5), 255, 255, 0, 255);
+    finish_blank_box();
+
+    print_set_envcolour(255, 255, 255, 255);
+    sprintf(textBytes, "SPIKE: %d US  LEVEL %d AREA %d  TIMER %d",
+        gProfilerSramCapture.spikeUs, gProfilerSramCapture.levelNum,
+        gProfilerSramCapture.areaIndex, gProfilerSramCapture.globalTimer);
+    print_small_text(HISTORY_GRAPH_X, 40, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+
+    sprintf(textBytes, "SPIKE FRAME: BEH %d  GFX %d  AUD %d#RSP %d  RDP %d",
+        gProfilerSramCapture.samples[PROFILER_HIST_BEHAVIOR][PROFILER_SRAM_CAPTURE_FRAMES - 1],
+        gProfilerSramCapture.samples[PROFILER_HIST_GRAPH][PROFILER_SRAM_CAPTURE_FRAMES - 1],
+        gProfilerSramCapture.samples[PROFILER_HIST_AUDIO][PROFILER_SRAM_CAPTURE_FRAMES - 1],
+        gProfilerSramCapture.samples[PROFILER_HIST_RSP][PROFILER_SRAM_CAPTURE_FRAMES - 1],
+        gProfilerSramCapture.samples[PROFILER_HIST_RDP][PROFILER_SRAM_CAPTURE_FRAMES - 1]);
+    print_small_text(HISTORY_GRAPH_X, (HISTORY_GRAPH_Y + 8), textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_OUTLINE);
+
+    print_small_text(HISTORY_GRAPH_X, 52, "DPAD DOWN: CLEAR CAPTURE", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+}
+
+#endif // PROFILER_SRAM_CAPTURE_ACTIVE
+
+#endif // USE_PROFILER && PROFILER_HISTORY
+
+#ifdef FRAME_STATS_COUNTERS
+
+/**
+ * Lists last frame's counters from the frame stats registry. On UNF builds,
+ * dpad right toggles streaming the same values over USB as CSV lines.
+ */
+void puppyprint_render_frame_stats(void) {
+    s32 i;
+    s32 posY = 40;
+
+#ifdef UNF
+    if (gPlayer1Controller->buttonPressed & R_JPAD) {
+        gFrameStatsStream ^= TRUE;
+    }
+#endif
+
+    print_set_envcolour(255, 255, 255, 255);
+    print_small_text(160, 24, "FRAME COUNTERS", PRINT_TEXT_ALIGN_CENTRE, PRINT_ALL, FONT_OUTLINE);
+
+    for (i = 0; i < FRAME_STAT_COUNT; i++) {
+        sprintf(textBytes, "%s: %d", gFrameStatNames[i], gFrameStatsLast[i]);
+        print_small_text(40, posY, textBytes, PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+        posY += 12;
+    }
+
+#ifdef UNF
+    if (gFrameStatsStream) {
+        print_small_text(40, (posY + 4), "STREAMING - DPAD RIGHT: STOP", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+    } else {
+        print_small_text(40, (posY + 4), "DPAD RIGHT: STREAM OVER USB", PRINT_TEXT_ALIGN_LEFT, PRINT_ALL, FONT_DEFAULT);
+    }
+#endif
+}
+
+#endif // FRAME_STATS_COUNTERS
+
 struct PuppyPrintPage ppPages[] = {
     {&puppyprint_render_standard,  "Standard" },
     {&puppyprint_render_minimal,   "Minimal"  },
     {&print_audio_ram_overview,    "Audio"    },
+#if defined(VERSION_JP) || defined(VERSION_US)
+    {&print_audio_profiling,       "AudioPerf"},
+#endif
+    {&print_behavior_profiling,    "Behaviors"},
     {&print_ram_overview,          "Segments" },
+    {&print_memory_overview,       "Memory"   },
     {&puppyprint_render_collision, "Collision"},
+#if defined(USE_PROFILER) && defined(PROFILER_HISTORY)
+    {&puppyprint_render_history,   "History"  },
+#ifdef PROFILER_SRAM_CAPTURE_ACTIVE
+    {&puppyprint_render_sram_capture, "Hitches" },
+#endif
+#endif
+#ifdef FRAME_STATS_COUNTERS
+    {&puppyprint_render_frame_stats, "Counters" },
+#endif
     {&print_console_log,           "Log"      },
 };
 
@@ -721,7 +1186,7 @@ void render_blank_box(s32 x1, s32 y1, s32 x2, s32 y2, s32 r, s32 g, s32 b, s32 a
     gDPPipeSync(gDisplayListHead++);
     gDPSetFillColor(gDisplayListHead++, (GPACK_RGBA5551(r, g, b, 1) << 16) | GPACK_RGBA5551(r, g, b, 1));
     print_set_envcolour(r, g, b, a);
-    gDPFillRectangle(gDisplayListHead++, x1, y1, x2 - cycleadd, y2 - cycleadd);
+    gDPFillRectangle(gDisplayListHead++, x1, ADAPTIVE_RES_Y(y1), x2 - cycleadd, ADAPTIVE_RES_Y(y2) - cycleadd);
 }
 
 extern s32 text_iterate_command(const char *str, s32 i, s32 runCMD);
@@ -731,9 +1196,10 @@ s32 get_text_width(const char *str, s32 font) {
     s32 i       = 0;
     s32 textPos = 0;
     s32 wideX   = 0;
+    s32 len     = strlen(str);
     s32 textX, textY, offsetY, spaceX;
 
-    for (i = 0; i < (signed)strlen(str); i++) {
+    for (i = 0; i < len; i++) {
         if (str[i] == '#') {
             i++;
             textPos = 0;
@@ -752,8 +1218,9 @@ s32 get_text_width(const char *str, s32 font) {
 s32 get_text_height(const char *str) {
     s32 i= 0;
     s32 textPos = 0;
+    s32 len = strlen(str);
 
-    for (i = 0; i < (signed)strlen(str); i++) {
+    for (i = 0; i < len; i++) {
         if (str[i] == '#') {
             i++;
             textPos += 12;
@@ -789,18 +1256,19 @@ void print_small_text(s32 x, s32 y, const char *str, s32 align, s32 amount, s32
     s32 lines = 0;
     s32 xlu = currEnv[3];
     s32 prevxlu = 256; // Set out of bounds, so it will *always* be different at first.
+    s32 len = strlen(str);
     Texture *(*fontTex)[] = segmented_to_virtual(&puppyprint_font_lut);
 
     shakeToggle = 0;
     waveToggle  = 0;
 
     if (amount == PRINT_ALL) {
-        tx = (signed)strlen(str);
+        tx = len;
     }
 
     gSPDisplayList(gDisplayListHead++, dl_small_text_begin);
     if (align == PRINT_TEXT_ALIGN_CENTRE) {
-        for (i = 0; i < (signed)strlen(str); i++) {
+        for (i = 0; i < len; i++) {
             if (str[i] == '#') {
                 i++;
                 textPos[0] = 0;
@@ -818,7 +1286,7 @@ void print_small_text(s32 x, s32 y, const char *str, s32 align, s32 amount, s32
 
         textPos[0] = -(wideX[0] / 2);
     } else if (align == PRINT_TEXT_ALIGN_RIGHT) {
-        for (i = 0; i < (signed)strlen(str); i++) {
+        for (i = 0; i < len; i++) {
             if (str[i] == '#') {
                 i++;
                 textPos[0] = 0;
@@ -893,7 +1361,7 @@ void print_small_text(s32 x, s32 y, const char *str, s32 align, s32 amount, s32
 
 s32 text_iterate_command(const char *str, s32 i, s32 runCMD) {
     s32 len = 0;
-    while ((str[i + len] != '>') && ((i + len) < (signed)strlen(str))) len++;
+    while ((str[i + len] != '>') && (str[i + len] != '\0')) len++;
     len++;
 
     if (runCMD) {
@@ -961,6 +1429,110 @@ s32 text_iterate_command(const char *str, s32 i, s32 runCMD) {
     return len;
 }
 
+#ifdef TEXT_GLYPH_LUT
+// No kerning entry; the glyph uses the fixed space width.
+#define PP_GLYPH_NO_KERN 0xFF
+
+struct PuppyprintGlyph {
+    u8 textX;
+    u8 textY;
+    u8 kernIdx; // index into the font's kerning table
+    u8 offsetY; // baseline drop
+    u8 offsetYDefaultFont; // baseline drop when the font is FONT_DEFAULT
+};
+
+static struct PuppyprintGlyph sPuppyprintGlyphs[128];
+static u8 sPuppyprintGlyphsBuilt = FALSE;
+
+/**
+ * The original range check cascade from get_char_from_byte, run once per
+ * character code to fill the lookup table. Records the kerning index instead
+ * of the width itself, so one table serves every font.
+ */
+static void puppyprint_classify_glyph(u8 letter, struct PuppyprintGlyph *g) {
+    g->offsetY = 0;
+    g->offsetYDefaultFont = 0;
+
+    if (letter >= '0' && letter <= '9') { // Line 1
+        g->textX = ((letter - '0') * 4);
+        g->textY = 0;
+        g->kernIdx = (letter - '0') +  0;
+    } else if (letter >= 'A' && letter <= 'P') { // Line 2
+        g->textX = ((letter - 'A') * 4);
+        g->textY = 6;
+        g->kernIdx = (letter - 'A') + 16;
+    } else if (letter >= 'Q' && letter <= 'Z') { // Line 3
+        g->textX = ((letter - 'Q') * 4);
+        g->textY = 12;
+        g->kernIdx = (letter - 'Q') + 32;
+    } else if (letter >= 'a' && letter <= 'p') { // Line 4
+        g->textX = ((letter - 'a') * 4);
+        g->textY = 18;
+        g->kernIdx = (letter - 'a') + 48;
+    } else if (letter >= 'q' && letter <= 'z') { // Line 5
+        g->textX = ((letter - 'q') * 4);
+        g->textY = 24;
+        g->kernIdx = (letter - 'q') + 64;
+    } else { // Space, the final frontier.
+        g->textX = 128;
+        g->textY =  12;
+        g->kernIdx = PP_GLYPH_NO_KERN;
+    }
+
+    switch (letter) {
+        case '-': g->textX = 40; g->textY =  0; g->kernIdx = 10; break; // Hyphen
+        case '+': g->textX = 44; g->textY =  0; g->kernIdx = 11; break; // Plus
+        case '(': g->textX = 48; g->textY =  0; g->kernIdx = 12; break; // Open Bracket
+        case ')': g->textX = 52; g->textY =  0; g->kernIdx = 13; break; // Close Bracket
+        case '!': g->textX = 56; g->textY =  0; g->kernIdx = 14; break; // Exclamation mark
+        case '?': g->textX = 60; g->textY =  0; g->kernIdx = 15; break; // Question mark
+
+        case '"': g->textX = 40; g->textY = 12; g->kernIdx = 42; break; // Speech mark
+        case'\'': g->textX = 44; g->textY = 12; g->kernIdx = 43; break; // Apostrophe
+        case ':': g->textX = 48; g->textY = 12; g->kernIdx = 44; break; // Colon
+        case ';': g->textX = 52; g->textY = 12; g->kernIdx = 45; break; // Semicolon
+        case '.': g->textX = 56; g->textY = 12; g->kernIdx = 46; break; // Full stop
+        case ',': g->textX = 60; g->textY = 12; g->kernIdx = 47; break; // Comma
+
+        case '~': g->textX = 40; g->textY = 24; g->kernIdx = 74; break; // Tilde
+        case '@': g->textX = 44; g->textY = 24; g->kernIdx = 75; break; // Umlaut
+        case '^': g->textX = 48; g->textY = 24; g->kernIdx = 76; break; // Caret
+        case '/': g->textX = 52; g->textY = 24; g->kernIdx = 77; break; // Slash
+        case '_': g->textX = 56; g->textY = 24; g->kernIdx = 78; break; // Percent
+        case '&': g->textX = 60; g->textY = 24; g->kernIdx = 79; break; // Ampersand
+
+        // This is for the letters that sit differently on the line. It just moves them down a bit.
+        case 'g': g->offsetY = 1; g->offsetYDefaultFont = 1; break;
+        case 'q': g->offsetY = 1; g->offsetYDefaultFont = 1; break;
+        case 'p': g->offsetYDefaultFont = 3; break;
+        case 'y': g->offsetYDefaultFont = 1; break;
+    }
+}
+
+void get_char_from_byte(u8 letter, s32 *textX, s32 *textY, s32 *spaceX, s32 *offsetY, s32 font) {
+    const struct PuppyprintGlyph *g;
+
+    if (!sPuppyprintGlyphsBuilt) {
+        s32 i;
+        for (i = 0; i < 128; i++) {
+            puppyprint_classify_glyph(i, &sPuppyprintGlyphs[i]);
+        }
+        sPuppyprintGlyphsBuilt = TRUE;
+    }
+
+    g = &sPuppyprintGlyphs[letter & 0x7F];
+    *textX = g->textX;
+    *textY = g->textY;
+    *offsetY = (font == FONT_DEFAULT) ? g->offsetYDefaultFont : g->offsetY;
+    if (g->kernIdx == PP_GLYPH_NO_KERN) {
+        *spaceX = 2;
+    } else {
+        u8 **textKern = segmented_to_virtual(puppyprint_kerning_lut);
+        u8 *textLen = segmented_to_virtual(textKern[font]);
+        *spaceX = textLen[g->kernIdx];
+    }
+}
+#else
 void get_char_from_byte(u8 letter, s32 *textX, s32 *textY, s32 *spaceX, s32 *offsetY, s32 font) {
     *offsetY = 0;
     u8 **textKern = segmented_to_virtual(puppyprint_kerning_lut);
@@ -1021,6 +1593,7 @@ void get_char_from_byte(u8 letter, s32 *textX, s32 *textY, s32 *spaceX, s32 *off
         case 'y': if (font == FONT_DEFAULT) *offsetY = 1; break;
     }
 }
+#endif // TEXT_GLYPH_LUT
 
 void render_multi_image(Texture *image, s32 x, s32 y, s32 width, s32 height, UNUSED s32 scaleX, UNUSED s32 scaleY, s32 mode) {
     s32 posW, posH, imW, imH, modeSC, mOne;
@@ -66,4 +66,5 @@ extern void prepare_blank_box(void);
 extern void finish_blank_box(void);
 extern void render_blank_box(s32 x1, s32 y1, s32 x2, s32 y2, s32 r, s32 g, s32 b, s32 a);
 extern void append_puppyprint_log(const char *str, ...);
+extern void puppyprint_dump_memory(void);
 extern char consoleLogTable[LOG_BUFFER_SIZE][255];
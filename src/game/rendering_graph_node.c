@@ -5,7 +5,12 @@
 #include "game_init.h"
 #include "gfx_dimensions.h"
 #include "main.h"
+#include "mario_misc.h"
 #include "memory.h"
+#include "micro_coin.h"
+#include "model_ids.h"
+#include "object_helpers.h"
+#include "object_list_processor.h"
 #include "print.h"
 #include "rendering_graph_node.h"
 #include "shadow.h"
@@ -17,6 +22,7 @@
 #include "behavior_data.h"
 #include "string.h"
 #include "color_presets.h"
+#include "frame_stats.h"
 
 #include "config.h"
 #include "config/config_world.h"
@@ -51,6 +57,12 @@ ALIGNED16 Mat4 gMatStack[32];
 ALIGNED16 Mtx *gMatStackFixed[32];
 f32 sAspectRatio;
 
+/**
+ * Objects rejected by obj_is_in_view's frustum tests this frame (invisible
+ * objects aren't counted). Read by the Puppyprint object display.
+ */
+u32 gCulledObjectCount = 0;
+
 /**
  * Animation nodes have state in global variables, so this struct captures
  * the animation state so a 'context switch' can be made when rendering the
@@ -244,6 +256,7 @@ extern const Gfx init_rsp[];
 
 #ifdef OBJECTS_REJ
 void switch_ucode(s32 ucode) {
+    FRAME_STAT_INC(FRAME_STAT_UCODE_SWITCHES);
     // Set the ucode and RCP settings
     switch (ucode) {
         default: // GRAPH_NODE_UCODE_DEFAULT
@@ -268,6 +281,56 @@ void switch_ucode(s32 ucode) {
 }
 #endif
 
+#ifdef MASTER_LIST_MATERIAL_SORT
+/**
+ * Stable group-by pass over a master list layer: every entry sharing a display
+ * list is pulled up behind the first entry with that display list, so the RDP
+ * loads each model's materials once per run instead of once per object. Group
+ * order follows first submission, so the result is deterministic.
+ */
+static struct DisplayListNode *group_master_list_by_material(struct DisplayListNode *head) {
+    struct DisplayListNode *sortedHead = NULL;
+    struct DisplayListNode *sortedTail = NULL;
+
+    while (head != NULL) {
+        struct DisplayListNode *node = head;
+        void *key = node->displayList;
+        head = head->next;
+
+        if (sortedHead == NULL) {
+            sortedHead = node;
+        } else {
+            sortedTail->next = node;
+        }
+        sortedTail = node;
+
+        // Pull every later entry with the same display list up behind this one.
+        struct DisplayListNode **link = &head;
+        while (*link != NULL) {
+            if ((*link)->displayList == key) {
+                struct DisplayListNode *match = *link;
+                *link = match->next;
+                sortedTail->next = match;
+                sortedTail = match;
+            } else {
+                link = &(*link)->next;
+            }
+        }
+    }
+
+    if (sortedTail != NULL) {
+        sortedTail->next = NULL;
+    }
+    return sortedHead;
+}
+#endif
+
+#ifdef STATIC_GEO_NO_ZREAD
+// Opaque layers eligible for the no-z-read pass. LAYER_FORCE stays out so the
+// background fill keeps its submission order; decals need the z read.
+#define NO_ZREAD_LAYER(layer) ((layer) >= LAYER_OPAQUE && (layer) <= LAYER_OPAQUE_INTER)
+#endif
+
 /**
  * Process a master list node. This has been modified, so now it runs twice, for each microcode.
  * It iterates through the first 5 layers of if the first index using F3DLX2.Rej, then it switches
@@ -286,6 +349,9 @@ void geo_process_master_list_sub(struct GraphNodeMasterList *node) {
     s32 enableZBuffer = (node->node.flags & GRAPH_RENDER_Z_BUFFER) != 0;
     struct RenderModeContainer *mode1List = &renderModeTable_1Cycle[enableZBuffer];
     struct RenderModeContainer *mode2List = &renderModeTable_2Cycle[enableZBuffer];
+#if defined(OBJECTS_REJ) && defined(UCODE_SWITCH_PRUNING)
+    s32 loadedUcode = -1; // unknown; the first phase always loads
+#endif
 
 #ifdef F3DEX_GBI_2
     // @bug This is where the LookAt values should be calculated but aren't.
@@ -307,9 +373,34 @@ void geo_process_master_list_sub(struct GraphNodeMasterList *node) {
         endLayer    = renderPhase->endLayer;
 #ifdef OBJECTS_REJ
         ucode       = renderPhase->ucode;
+ #ifdef UCODE_SWITCH_PRUNING
+        // An empty .rej phase would only emit a pair of microcode reloads;
+        // skip it outright. The default-ucode phases still run, since they
+        // carry the layer render-mode settings.
+        if (ucode == GRAPH_NODE_UCODE_REJ) {
+            s32 phaseEmpty = TRUE;
+            for (currLayer = startLayer; currLayer <= endLayer; currLayer++) {
+                if (node->listHeads[ucode][currLayer] != NULL) {
+                    phaseEmpty = FALSE;
+                    break;
+                }
+            }
+            if (phaseEmpty) {
+                continue;
+            }
+        }
+        // Only reload the microcode when the phase actually changes it; the
+        // LookAt pointer survives along with the rest of the RSP state.
+        if (ucode != loadedUcode) {
+            switch_ucode(ucode);
+            gSPLookAt(gDisplayListHead++, &lookAt);
+            loadedUcode = ucode;
+        }
+ #else
         // Set the ucode for the current render phase
         switch_ucode(ucode);
         gSPLookAt(gDisplayListHead++, &lookAt);
+ #endif
 #endif
         if (enableZBuffer) {
             // Enable z buffer.
@@ -318,6 +409,14 @@ void geo_process_master_list_sub(struct GraphNodeMasterList *node) {
         }
         // Iterate through the layers on the current render phase.
         for (currLayer = startLayer; currLayer <= endLayer; currLayer++) {
+#ifdef MASTER_LIST_MATERIAL_SORT
+            // Group the opaque layers by display list; the z buffer makes the
+            // reorder safe, and the blended layers keep their submission order.
+            if (currLayer <= LAYER_OPAQUE_DECAL) {
+                node->listHeads[ucode][currLayer] =
+                    group_master_list_by_material(node->listHeads[ucode][currLayer]);
+            }
+#endif
             // Set 'currList' to the first DisplayListNode on the current layer.
             currList = node->listHeads[ucode][currLayer];
 #if defined(DISABLE_AA) || !SILHOUETTE
@@ -335,9 +434,58 @@ void geo_process_master_list_sub(struct GraphNodeMasterList *node) {
                 gDPSetRenderMode(gDisplayListHead++, mode1List->modes[currLayer],
                                                      mode2List->modes[currLayer]);
             }
+#endif
+#ifdef SHADOW_BATCHING
+            // Draw the frame's shadow batch contiguously at the head of the
+            // decal layer, under this layer's render mode. Exactly one default
+            // ucode phase covers this layer, so the batch flushes once.
+            if (ucode == GRAPH_NODE_UCODE_DEFAULT && currLayer == LAYER_TRANSPARENT_DECAL) {
+                shadow_batch_flush();
+            }
+#endif
+#ifdef STATIC_GEO_NO_ZREAD
+            // Emit the room-sorted level geometry first, writing z without
+            // reading it; objects on the same layer then depth-test against
+            // it under the normal render mode.
+            if (enableZBuffer && NO_ZREAD_LAYER(currLayer)) {
+                struct DisplayListNode *staticList = currList;
+                s32 anyNoZRead = FALSE;
+
+                while (staticList != NULL) {
+                    if (staticList->noZRead) {
+                        if (!anyNoZRead) {
+                            gDPSetRenderMode(gDisplayListHead++, mode1List->modes[currLayer] & ~Z_CMP,
+                                                                 mode2List->modes[currLayer] & ~Z_CMP);
+                            anyNoZRead = TRUE;
+                        }
+                        gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(staticList->transform),
+                                  (G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH));
+                        gSPDisplayList(gDisplayListHead++, staticList->displayList);
+                    }
+                    staticList = staticList->next;
+                }
+                if (anyNoZRead) {
+                    gDPPipeSync(gDisplayListHead++);
+                    gDPSetRenderMode(gDisplayListHead++, mode1List->modes[currLayer],
+                                                         mode2List->modes[currLayer]);
+                }
+            }
 #endif
             // Iterate through all the displaylists on the current layer.
             while (currList != NULL) {
+#ifdef STATIC_GEO_NO_ZREAD
+                // Already emitted by the no-z-read pass above.
+                if (currList->noZRead) {
+                    currList = currList->next;
+                    continue;
+                }
+#endif
+#ifdef OBJECTS_REJ
+                FRAME_STAT_INC((ucode == GRAPH_NODE_UCODE_REJ) ? FRAME_STAT_DL_REJ_NODES
+                                                               : FRAME_STAT_DL_ZEX_NODES);
+#else
+                FRAME_STAT_INC(FRAME_STAT_DL_ZEX_NODES);
+#endif
                 // Add the display list's transformation to the master list.
                 gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(currList->transform),
                           (G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH));
@@ -370,7 +518,14 @@ void geo_process_master_list_sub(struct GraphNodeMasterList *node) {
  #if defined(F3DEX_GBI_2) && defined(VISUAL_DEBUG)
     if (hitboxView) render_debug_boxes(DEBUG_UCODE_REJ);
  #endif
+ #if defined(UCODE_SWITCH_PRUNING) && !defined(VISUAL_DEBUG)
+    // Restore the default microcode only if a .rej phase actually ran.
+    if (loadedUcode != GRAPH_NODE_UCODE_DEFAULT) {
+        switch_ucode(GRAPH_NODE_UCODE_DEFAULT);
+    }
+ #else
     switch_ucode(GRAPH_NODE_UCODE_DEFAULT);
+ #endif
 #endif
 #ifdef VISUAL_DEBUG
     if ( hitboxView) render_debug_boxes(DEBUG_UCODE_DEFAULT | DEBUG_BOX_CLEAR);
@@ -378,6 +533,102 @@ void geo_process_master_list_sub(struct GraphNodeMasterList *node) {
 #endif
 }
 
+#ifdef LAZY_MTX_CONVERSION
+/**
+ * Levels of gMatStackFixed whose fixed point conversion is still pending.
+ * inc_mat_stack only marks its level here; the display list pool alloc and the
+ * mtxf_to_mtx conversion run in mat_stack_fixed() when a display list is first
+ * emitted at that level. Pushes whose subtrees draw nothing never convert.
+ */
+static u32 sMatStackPending = 0;
+#endif
+
+/**
+ * Returns the fixed point matrix for the current stack level, converting it
+ * from the float stack first if the level was pushed lazily.
+ */
+static Mtx *mat_stack_fixed(void) {
+#ifdef LAZY_MTX_CONVERSION
+    if (sMatStackPending & (1 << gMatStackIndex)) {
+        Mtx *mtx = alloc_display_list(sizeof(*mtx));
+        mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
+        gMatStackFixed[gMatStackIndex] = mtx;
+        sMatStackPending &= ~(1 << gMatStackIndex);
+    }
+#endif
+    return gMatStackFixed[gMatStackIndex];
+}
+
+#ifdef MIRROR_RENDER_CACHE
+// Commands worth of a frame-pool generated display list an entry can absorb.
+#define MIRROR_RENDER_CACHE_GFX_CMDS 8
+
+/**
+ * One appended entry of mirror Mario's sub-scene. Display lists that live in
+ * the per-frame gfx pool (backface culling flips, color setters) are copied
+ * into gfxCopy, since the pool memory is recycled before any replay.
+ * The matrix and copy are double buffered by frame parity like the other
+ * retained buffers: each frame emits the set indexed by gGlobalTimer & 1 and
+ * only ever writes that set, so the set last frame's in-flight display list
+ * references is never touched.
+ */
+struct MirrorCacheEntry {
+    void *displayList;
+    s16 layer;
+    u8 usesCopy;
+    u8 numGfx;
+    Mtx mtx[2];
+    Gfx gfxCopy[2][MIRROR_RENDER_CACHE_GFX_CMDS];
+};
+
+static struct MirrorCacheEntry sMirrorCacheEntries[MIRROR_RENDER_CACHE_ENTRIES];
+static s32 sMirrorCacheCount = 0;
+static u8 sMirrorCaptureActive = FALSE;
+static u8 sMirrorCaptureFailed = FALSE;
+// Buffer set holding the freshest capture/refresh, i.e. the one last emitted.
+static u8 sMirrorCacheActiveSet = 0;
+
+/**
+ * Record one master list append of the mirror subtree: display list, layer
+ * and a persistent copy of the converted matrix.
+ */
+static void mirror_cache_record(void *displayList, s16 layer, Mtx *transform) {
+    struct MirrorCacheEntry *entry;
+    s32 parity = gGlobalTimer & 1;
+
+    if (sMirrorCacheCount >= MIRROR_RENDER_CACHE_ENTRIES) {
+        sMirrorCaptureFailed = TRUE;
+        return;
+    }
+    entry = &sMirrorCacheEntries[sMirrorCacheCount];
+    entry->mtx[parity] = *transform;
+    entry->layer = layer;
+    entry->usesCopy = FALSE;
+    entry->numGfx = 0;
+    entry->displayList = displayList;
+
+    if ((u8 *) displayList >= (u8 *) gGfxPool && (u8 *) displayList < gGfxPoolEnd) {
+        Gfx *src = displayList;
+        s32 i = 0;
+
+        while (TRUE) {
+            if (i >= MIRROR_RENDER_CACHE_GFX_CMDS) {
+                sMirrorCaptureFailed = TRUE;
+                return;
+            }
+            entry->gfxCopy[parity][i] = src[i];
+            if ((u8)(src[i].words.w0 >> 24) == G_ENDDL) {
+                break;
+            }
+            i++;
+        }
+        entry->usesCopy = TRUE;
+        entry->numGfx = i + 1;
+    }
+    sMirrorCacheCount++;
+}
+#endif // MIRROR_RENDER_CACHE
+
 /**
  * Appends the display list to one of the master lists based on the layer
  * parameter. Look at the RenderModeContainer struct to see the corresponding
@@ -385,6 +636,14 @@ void geo_process_master_list_sub(struct GraphNodeMasterList *node) {
  */
 void geo_append_display_list(void *displayList, s32 layer) {
     s32 ucode = GRAPH_NODE_UCODE_DEFAULT;
+#if GFX_POOL_RESERVE > 0
+    // When the display list pool is nearly exhausted, shed transparent entries rather
+    // than overflowing the pool and dropping arbitrary later geometry.
+    if (layer >= LAYER_TRANSPARENT_DECAL
+     && ((u8 *) gGfxPoolEnd - (u8 *) gDisplayListHead) < GFX_POOL_RESERVE) {
+        return;
+    }
+#endif
 #ifdef F3DEX_GBI_2
     gSPLookAt(gDisplayListHead++, &lookAt);
 #endif
@@ -413,8 +672,21 @@ void geo_append_display_list(void *displayList, s32 layer) {
         struct DisplayListNode *listNode =
             alloc_only_pool_alloc(gDisplayListHeap, sizeof(struct DisplayListNode));
 
-        listNode->transform = gMatStackFixed[gMatStackIndex];
+        listNode->transform = mat_stack_fixed();
         listNode->displayList = displayList;
+#ifdef MIRROR_RENDER_CACHE
+        if (sMirrorCaptureActive) {
+            mirror_cache_record(displayList, layer, listNode->transform);
+        }
+#endif
+#ifdef STATIC_GEO_NO_ZREAD
+        // Opaque level geometry inside a room skips the z read: the room cases
+        // provide the ordering, and the z write is kept for everything after.
+        listNode->noZRead = (gCurGraphNodeObject == NULL
+                          && NO_ZREAD_LAYER(layer)
+                          && gMarioCurrentRoom > 0
+                          && (gCurGraphNodeMasterList->node.flags & GRAPH_RENDER_Z_BUFFER) != 0);
+#endif
         listNode->next = NULL;
         if (gCurGraphNodeMasterList->listHeads[ucode][layer] == NULL) {
             gCurGraphNodeMasterList->listHeads[ucode][layer] = listNode;
@@ -426,15 +698,401 @@ void geo_append_display_list(void *displayList, s32 layer) {
 }
 
 static void inc_mat_stack() {
+#ifdef LAZY_MTX_CONVERSION
+    gMatStackIndex++;
+    sMatStackPending |= (1 << gMatStackIndex);
+#else
     Mtx *mtx = alloc_display_list(sizeof(*mtx));
     gMatStackIndex++;
     mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
     gMatStackFixed[gMatStackIndex] = mtx;
+#endif
+}
+
+#ifdef BILLBOARD_MTX_CACHE
+// mtxf_billboard writes exactly five nonzero rotation block entries; they are the
+// full cache key, since everything outside them is 0/1 or the translation column.
+static const u8 sBillboardMtxKeyIdx[5] = { 0, 1, 4, 5, 10 };
+static Mtx sBillboardMtxTemplate;
+static f32 sBillboardMtxKey[5];
+static u8 sBillboardMtxValid = FALSE;
+
+/**
+ * inc_mat_stack for billboards. A billboard's model-view matrix is a pure scale
+ * (plus camera roll) in the rotation block, so every billboard with the same scale
+ * produces the same fixed point matrix up to the translation column: convert it
+ * once, then copy the cached template and patch the three translation entries per
+ * instance. The template stays valid across frames, keyed on the block itself.
+ */
+static void inc_mat_stack_billboard(void) {
+    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    f32 *src = (f32 *) gMatStack[gMatStackIndex + 1];
+    s16 *m = (s16 *) mtx;
+    s32 i;
+
+    gMatStackIndex++;
+    if (sBillboardMtxValid
+     && sBillboardMtxKey[0] == src[sBillboardMtxKeyIdx[0]]
+     && sBillboardMtxKey[1] == src[sBillboardMtxKeyIdx[1]]
+     && sBillboardMtxKey[2] == src[sBillboardMtxKeyIdx[2]]
+     && sBillboardMtxKey[3] == src[sBillboardMtxKeyIdx[3]]
+     && sBillboardMtxKey[4] == src[sBillboardMtxKeyIdx[4]]) {
+        *mtx = sBillboardMtxTemplate;
+    } else {
+        mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
+        sBillboardMtxTemplate = *mtx;
+        for (i = 0; i < 5; i++) {
+            sBillboardMtxKey[i] = src[sBillboardMtxKeyIdx[i]];
+        }
+        sBillboardMtxValid = TRUE;
+    }
+    // Patch the translation column (same conversion as mtxf_to_mtx_fast).
+    for (i = 0; i < 3; i++) {
+        s32 fixed = (s32)(src[12 + i] * (65536.0f / WORLD_SCALE));
+        m[12 + i] = (s16)(fixed >> 16);
+        m[28 + i] = (s16) fixed;
+    }
+    gMatStackFixed[gMatStackIndex] = mtx;
+#ifdef LAZY_MTX_CONVERSION
+    sMatStackPending &= ~(1 << gMatStackIndex);
+#endif
+}
+#endif // BILLBOARD_MTX_CACHE
+
+#ifdef ANIM_MATRIX_CACHE
+/**
+ * A bone matrix cache owned by one object. The Mtx storage is double buffered
+ * because the RCP may still be reading last frame's matrices while this frame
+ * rewrites them; with the one frame render pipeline, flipping per rewrite is
+ * enough. anim == NULL means the slot holds no valid pose.
+ */
+struct AnimMtxCacheSlot {
+    Mtx mtx[ANIM_MATRIX_CACHE_BONES][2];
+    Mat4 objMtx;
+    struct Animation *anim;
+    s16 animFrame;
+    s16 animYTrans;
+    u8 parity[ANIM_MATRIX_CACHE_BONES];
+    u8 bonesUsed;
+    u8 inUse;
+};
+
+static struct AnimMtxCacheSlot sAnimMtxCache[ANIM_MATRIX_CACHE_SLOTS];
+
+// Cache state for the object currently being processed.
+static struct AnimMtxCacheSlot *sAnimMtxCacheSlot = NULL;
+static s32 sAnimMtxCacheBone = 0;
+static s32 sAnimMtxCacheHit = FALSE;
+
+/**
+ * Select (and if needed, acquire) the bone matrix cache for an object about to
+ * be processed, and decide whether its cached pose can be reused. The key is
+ * the animation, the animation frame, the Y translation scale and the object's
+ * full model-view matrix, so any object or camera movement is a miss.
+ */
+static void anim_mtx_cache_begin(struct Object *obj, Mat4 objMtx) {
+    sAnimMtxCacheSlot = NULL;
+    sAnimMtxCacheBone = 0;
+
+    struct AnimInfo *animInfo = &obj->header.gfx.animInfo;
+    if (animInfo->curAnim == NULL) {
+        return;
+    }
+
+    s32 slotIndex = obj->animMtxCacheIndex;
+    if (slotIndex < 0) {
+        for (slotIndex = 0; slotIndex < ANIM_MATRIX_CACHE_SLOTS; slotIndex++) {
+            if (!sAnimMtxCache[slotIndex].inUse) break;
+        }
+        if (slotIndex == ANIM_MATRIX_CACHE_SLOTS) {
+            return; // No free slot; keep using the display list pool.
+        }
+        sAnimMtxCache[slotIndex].inUse = TRUE;
+        sAnimMtxCache[slotIndex].anim = NULL;
+        obj->animMtxCacheIndex = slotIndex;
+    }
+
+    struct AnimMtxCacheSlot *slot = &sAnimMtxCache[slotIndex];
+
+    sAnimMtxCacheHit = (slot->anim == animInfo->curAnim
+                     && slot->animFrame == animInfo->animFrame
+                     && slot->animYTrans == animInfo->animYTrans);
+    if (sAnimMtxCacheHit) {
+        f32 *a = (f32 *) objMtx;
+        f32 *b = (f32 *) slot->objMtx;
+        for (s32 i = 0; i < 16; i++) {
+            if (a[i] != b[i]) {
+                sAnimMtxCacheHit = FALSE;
+                break;
+            }
+        }
+    }
+
+    if (!sAnimMtxCacheHit) {
+        slot->anim = animInfo->curAnim;
+        slot->animFrame = animInfo->animFrame;
+        slot->animYTrans = animInfo->animYTrans;
+        mtxf_copy(slot->objMtx, objMtx);
+    }
+
+    sAnimMtxCacheSlot = slot;
+}
+
+/**
+ * Close out the current object's cache. If a reused pose consumed a different
+ * number of bones than it was built with, a timer driven switch changed the
+ * traversal under an unchanged key; drop the pose so next frame rebuilds it.
+ */
+static void anim_mtx_cache_end(void) {
+    if (sAnimMtxCacheSlot != NULL) {
+        if (sAnimMtxCacheHit && sAnimMtxCacheBone != sAnimMtxCacheSlot->bonesUsed) {
+            sAnimMtxCacheSlot->anim = NULL;
+        }
+        sAnimMtxCacheSlot->bonesUsed = sAnimMtxCacheBone;
+        sAnimMtxCacheSlot = NULL;
+    }
+    sAnimMtxCacheBone = 0;
+}
+
+/**
+ * Return an object's bone matrix cache slot when it unloads.
+ */
+void anim_mtx_cache_release(struct Object *obj) {
+    if (obj->animMtxCacheIndex >= 0) {
+        sAnimMtxCache[obj->animMtxCacheIndex].inUse = FALSE;
+        sAnimMtxCache[obj->animMtxCacheIndex].anim = NULL;
+        obj->animMtxCacheIndex = -1;
+    }
+}
+#endif
+
+#ifdef ANIM_BLENDING
+/**
+ * Pose memory for one blending object. livePose always holds the bone rotations
+ * that were last rendered (blended or not); when the object switches animation,
+ * it is frozen and the next ANIM_BLENDING_FRAMES frames interpolate from the
+ * frozen pose to the new animation's channels. Since the frozen pose is whatever
+ * was on screen, a switch in the middle of a blend retargets smoothly too.
+ */
+struct AnimBlendSlot {
+    Vec3s livePose[ANIM_BLENDING_BONES];
+    Vec3s frozenPose[ANIM_BLENDING_BONES];
+    struct Animation *lastAnim;
+    u8 liveBones;
+    u8 frozenBones;
+    u8 blendTimer;
+    u8 inUse;
+};
+
+static struct AnimBlendSlot sAnimBlendPool[ANIM_BLENDING_SLOTS];
+
+// Blend state for the object currently being processed.
+static struct AnimBlendSlot *sAnimBlendSlot = NULL;
+static s32 sAnimBlendBone = 0;
+static f32 sAnimBlendWeight = 1.0f;
+
+/**
+ * Select (and if needed, acquire) the pose slot for an object about to be
+ * processed, and start a cross fade if its animation changed since it was last
+ * rendered. Watching animInfo.curAnim here catches every animation setter
+ * (geo_obj_init_animation, Mario's set_mario_animation, ...) without hooks.
+ */
+static void anim_blend_begin(struct Object *obj) {
+    sAnimBlendSlot = NULL;
+    sAnimBlendBone = 0;
+    sAnimBlendWeight = 1.0f;
+
+    struct Animation *curAnim = obj->header.gfx.animInfo.curAnim;
+    if (curAnim == NULL) {
+        return;
+    }
+
+    s32 slotIndex = obj->animBlendIndex;
+    if (slotIndex < 0) {
+        for (slotIndex = 0; slotIndex < ANIM_BLENDING_SLOTS; slotIndex++) {
+            if (!sAnimBlendPool[slotIndex].inUse) break;
+        }
+        if (slotIndex == ANIM_BLENDING_SLOTS) {
+            return; // No free slot; this object pops like vanilla.
+        }
+        sAnimBlendPool[slotIndex].inUse = TRUE;
+        sAnimBlendPool[slotIndex].lastAnim = NULL;
+        sAnimBlendPool[slotIndex].liveBones = 0;
+        sAnimBlendPool[slotIndex].blendTimer = 0;
+        obj->animBlendIndex = slotIndex;
+    }
+
+    struct AnimBlendSlot *slot = &sAnimBlendPool[slotIndex];
+
+    if (slot->lastAnim != curAnim) {
+        if (slot->lastAnim != NULL && slot->liveBones > 0) {
+            bcopy(slot->livePose, slot->frozenPose, slot->liveBones * sizeof(Vec3s));
+            slot->frozenBones = slot->liveBones;
+            slot->blendTimer = ANIM_BLENDING_FRAMES;
+        }
+        slot->lastAnim = curAnim;
+    }
+
+    if (slot->blendTimer > 0) {
+        slot->blendTimer--;
+        sAnimBlendWeight = (f32)(ANIM_BLENDING_FRAMES - slot->blendTimer) / ANIM_BLENDING_FRAMES;
+    }
+
+    sAnimBlendSlot = slot;
 }
 
+/**
+ * Blend the rotation an animated part is about to use toward the frozen pose,
+ * and record the result as this bone's live pose. The s16 deltas wrap, so each
+ * axis interpolates along the shortest arc. Translation channels are left
+ * alone: they are mostly root offsets tied to footing, and fading them makes
+ * feet slide. Held objects are skipped, like the bone matrix cache, since
+ * their bone indices don't belong to the rendering object's skeleton.
+ */
+static void anim_blend_apply(Vec3s rotation) {
+    if (sAnimBlendSlot != NULL && gCurGraphNodeHeldObject == NULL
+        && sAnimBlendBone < ANIM_BLENDING_BONES) {
+        struct AnimBlendSlot *slot = sAnimBlendSlot;
+        s32 bone = sAnimBlendBone++;
+        if (sAnimBlendWeight < 1.0f && bone < slot->frozenBones) {
+            s32 axis;
+            for (axis = 0; axis < 3; axis++) {
+                s16 from = slot->frozenPose[bone][axis];
+                s16 delta = rotation[axis] - from;
+                rotation[axis] = from + (s16)(delta * sAnimBlendWeight);
+            }
+        }
+        vec3s_copy(slot->livePose[bone], rotation);
+    }
+}
+
+/**
+ * Close out the current object's blend state, remembering how many bones the
+ * live pose covers.
+ */
+static void anim_blend_end(void) {
+    if (sAnimBlendSlot != NULL) {
+        sAnimBlendSlot->liveBones = sAnimBlendBone;
+        sAnimBlendSlot = NULL;
+    }
+    sAnimBlendBone = 0;
+    sAnimBlendWeight = 1.0f;
+}
+
+/**
+ * Return an object's pose slot when it unloads.
+ */
+void anim_blend_release(struct Object *obj) {
+    if (obj->animBlendIndex >= 0) {
+        sAnimBlendPool[obj->animBlendIndex].inUse = FALSE;
+        obj->animBlendIndex = -1;
+    }
+}
+#endif // ANIM_BLENDING
+
+/**
+ * inc_mat_stack for animated parts and bones: when the owning object's cached
+ * pose is valid, reuse the stored Mtx (skipping the display list pool alloc
+ * and the fixed point conversion); on a miss, convert into the cache instead
+ * of the pool. Held objects always take the plain path, since their animation
+ * state is separate from the key.
+ */
+static void inc_mat_stack_animated() {
+#ifdef ANIM_MATRIX_CACHE
+    if (sAnimMtxCacheSlot != NULL && gCurGraphNodeHeldObject == NULL
+        && sAnimMtxCacheBone < ANIM_MATRIX_CACHE_BONES) {
+        s32 bone = sAnimMtxCacheBone++;
+        gMatStackIndex++;
+#ifdef LAZY_MTX_CONVERSION
+        sMatStackPending &= ~(1 << gMatStackIndex);
+#endif
+        if (sAnimMtxCacheHit) {
+            gMatStackFixed[gMatStackIndex] = &sAnimMtxCacheSlot->mtx[bone][sAnimMtxCacheSlot->parity[bone]];
+        } else {
+            u8 parity = sAnimMtxCacheSlot->parity[bone] ^ 1;
+            sAnimMtxCacheSlot->parity[bone] = parity;
+            mtxf_to_mtx(&sAnimMtxCacheSlot->mtx[bone][parity], gMatStack[gMatStackIndex]);
+            gMatStackFixed[gMatStackIndex] = &sAnimMtxCacheSlot->mtx[bone][parity];
+        }
+        return;
+    }
+#endif
+    inc_mat_stack();
+}
+
+#ifdef GFX_LOD_VARIANTS
+/**
+ * Registered display list variant pairs. Each entry maps a full resolution
+ * display list to a variant (typically the same mesh with half resolution
+ * textures) drawn in its place beyond 'distance' units from the camera. The
+ * swap happens at selection time, per draw, so a display list shared by many
+ * objects picks independently for each instance.
+ */
+struct GfxLodVariant {
+    void *fullDl;
+    void *farDl;
+    f32 distance;
+};
+
+static struct GfxLodVariant sGfxLodVariants[GFX_LOD_VARIANT_MAX];
+static s32 sGfxLodVariantCount = 0;
+
+/**
+ * Register (or re-register) a far variant for a display list. Returns FALSE
+ * when the table is full.
+ */
+s32 gfx_register_lod_variant(void *fullDl, void *farDl, f32 distance) {
+    s32 i;
+
+    for (i = 0; i < sGfxLodVariantCount; i++) {
+        if (sGfxLodVariants[i].fullDl == fullDl) {
+            sGfxLodVariants[i].farDl = farDl;
+            sGfxLodVariants[i].distance = distance;
+            return TRUE;
+        }
+    }
+    if (sGfxLodVariantCount == GFX_LOD_VARIANT_MAX) {
+        return FALSE;
+    }
+    sGfxLodVariants[sGfxLodVariantCount].fullDl = fullDl;
+    sGfxLodVariants[sGfxLodVariantCount].farDl = farDl;
+    sGfxLodVariants[sGfxLodVariantCount].distance = distance;
+    sGfxLodVariantCount++;
+    return TRUE;
+}
+
+/**
+ * Substitute a display list with its registered far variant when the current
+ * transform is beyond the variant's camera distance.
+ */
+static void *gfx_select_lod_variant(void *displayList) {
+#ifdef AUTO_LOD
+    f32 distanceFromCam = gIsConsole ? -gMatStack[gMatStackIndex][3][2] : 50.0f;
+#else
+    f32 distanceFromCam = -gMatStack[gMatStackIndex][3][2];
+#endif
+    s32 i;
+
+    for (i = 0; i < sGfxLodVariantCount; i++) {
+        if (sGfxLodVariants[i].fullDl == displayList) {
+            if (distanceFromCam > sGfxLodVariants[i].distance) {
+                return sGfxLodVariants[i].farDl;
+            }
+            break;
+        }
+    }
+    return displayList;
+}
+#endif // GFX_LOD_VARIANTS
+
 static void append_dl_and_return(struct GraphNodeDisplayList *node) {
     if (node->displayList != NULL) {
+#ifdef GFX_LOD_VARIANTS
+        geo_append_display_list(gfx_select_lod_variant(node->displayList),
+                                GET_GRAPH_NODE_LAYER(node->node.flags));
+#else
         geo_append_display_list(node->displayList, GET_GRAPH_NODE_LAYER(node->node.flags));
+#endif
     }
     if (node->node.children != NULL) {
         geo_process_node_and_siblings(node->node.children);
@@ -481,11 +1139,148 @@ void geo_process_master_list(struct GraphNodeMasterList *node) {
     }
 }
 
+#ifdef FRAME_INTERPOLATION
+/**
+ * Frame interpolation pass state. On the second traversal of each logic frame
+ * (gIsInterpolationFrame set by frame_interp_build), object and camera
+ * transforms are rendered halfway between the previous and the current logic
+ * frame. The previous-frame history rolls forward during the interpolation
+ * pass itself, so the main pass stays untouched.
+ */
+s8 gIsInterpolationFrame = FALSE;
+
+// Camera eye as rendered this frame and last frame, snapshotted on the main pass.
+static Vec3f sCamCurPos, sCamCurFocus, sCamPrevPos, sCamPrevFocus;
+static s16 sCamCurRoll = 0, sCamPrevRoll = 0;
+static u32 sCamStamp = 0;
+
+// The interpolated eye for the current pass, also used by the skybox.
+Vec3f gInterpCamPos, gInterpCamFocus;
+static s16 sInterpCamRoll = 0;
+
+// Midpoint of two s16 angles along the shorter arc.
+static s16 interp_angle(s16 prev, s16 cur) {
+    return cur - ((s16)(cur - prev) >> 1);
+}
+
+/**
+ * Record the camera eye rendered on the main pass, keeping the previous
+ * frame's value around for the in-between frame.
+ */
+static void frame_interp_camera_snapshot(struct GraphNodeCamera *node) {
+    if (sCamStamp != gGlobalTimer) {
+        if (sCamStamp == gGlobalTimer - 1) {
+            vec3f_copy(sCamPrevPos, sCamCurPos);
+            vec3f_copy(sCamPrevFocus, sCamCurFocus);
+            sCamPrevRoll = sCamCurRoll;
+        } else {
+            // The camera wasn't rendered last frame; nothing to sweep from.
+            vec3f_copy(sCamPrevPos, node->pos);
+            vec3f_copy(sCamPrevFocus, node->focus);
+            sCamPrevRoll = node->roll;
+        }
+        vec3f_copy(sCamCurPos, node->pos);
+        vec3f_copy(sCamCurFocus, node->focus);
+        sCamCurRoll = node->roll;
+        sCamStamp = gGlobalTimer;
+    }
+}
+
+/**
+ * Compute the interpolated camera eye at the start of the in-between pass.
+ * Camera cuts (mode changes, warps) snap instead of sweeping.
+ */
+static void frame_interp_begin_pass(void) {
+    s32 i;
+    s32 snap = (sCamStamp != gGlobalTimer);
+
+    for (i = 0; i < 3 && !snap; i++) {
+        if (absf(sCamCurPos[i] - sCamPrevPos[i]) > FRAME_INTERP_TELEPORT_DIST
+         || absf(sCamCurFocus[i] - sCamPrevFocus[i]) > FRAME_INTERP_TELEPORT_DIST) {
+            snap = TRUE;
+        }
+    }
+    if (snap) {
+        vec3f_copy(gInterpCamPos, sCamCurPos);
+        vec3f_copy(gInterpCamFocus, sCamCurFocus);
+        sInterpCamRoll = sCamCurRoll;
+    } else {
+        for (i = 0; i < 3; i++) {
+            gInterpCamPos[i] = (sCamPrevPos[i] + sCamCurPos[i]) * 0.5f;
+            gInterpCamFocus[i] = (sCamPrevFocus[i] + sCamCurFocus[i]) * 0.5f;
+        }
+        sInterpCamRoll = interp_angle(sCamPrevRoll, sCamCurRoll);
+    }
+}
+
+/**
+ * Previous-frame transform of each object, kept out of struct Object in a
+ * contiguous array indexed by object pool slot. Only the interpolation pass
+ * touches it, so the history stays packed in the cache instead of being
+ * scattered across 1.4KB object structs. The last slot catches the few
+ * GraphNodeObjects that live outside the pool (mirror Mario); they share it,
+ * which at worst makes them snap instead of sweep.
+ */
+struct ObjInterpState {
+    Vec3s angle;
+    u32 timestamp; // gGlobalTimer value of the frame this was rendered on
+    Vec3f pos;
+    Vec3f scale;
+};
+static struct ObjInterpState sObjInterpHistory[OBJECT_POOL_CAPACITY + 1];
+
+static struct ObjInterpState *frame_interp_history(struct GraphNodeObject *gfx) {
+    struct Object *obj = (struct Object *) gfx;
+
+    if (obj >= gObjectPool && obj < &gObjectPool[OBJECT_POOL_CAPACITY]) {
+        return &sObjInterpHistory[obj - gObjectPool];
+    }
+    return &sObjInterpHistory[OBJECT_POOL_CAPACITY];
+}
+
+/**
+ * Produce the halfway transform for an object and roll its history forward.
+ * Objects that weren't rendered last frame or that moved a teleport's worth
+ * of distance in one frame snap to their current transform.
+ */
+static void frame_interp_object(struct GraphNodeObject *gfx, Vec3f pos, Vec3s angle, Vec3f scale) {
+    struct ObjInterpState *hist = frame_interp_history(gfx);
+    s32 i;
+    s32 snap = (hist->timestamp != gGlobalTimer - 1);
+
+    for (i = 0; i < 3 && !snap; i++) {
+        if (absf(gfx->pos[i] - hist->pos[i]) > FRAME_INTERP_TELEPORT_DIST) {
+            snap = TRUE;
+        }
+    }
+    if (snap) {
+        vec3f_copy(pos, gfx->pos);
+        vec3s_copy(angle, gfx->angle);
+        vec3f_copy(scale, gfx->scale);
+    } else {
+        for (i = 0; i < 3; i++) {
+            pos[i] = (hist->pos[i] + gfx->pos[i]) * 0.5f;
+            scale[i] = (hist->scale[i] + gfx->scale[i]) * 0.5f;
+            angle[i] = interp_angle(hist->angle[i], gfx->angle[i]);
+        }
+    }
+    vec3f_copy(hist->pos, gfx->pos);
+    vec3s_copy(hist->angle, gfx->angle);
+    vec3f_copy(hist->scale, gfx->scale);
+    hist->timestamp = gGlobalTimer;
+}
+#endif // FRAME_INTERPOLATION
+
 /**
  * Process a perspective projection node.
  */
 void geo_process_perspective(struct GraphNodePerspective *node) {
+#ifdef FRAME_INTERPOLATION
+    // FOV transitions are logic state; keep them at logic rate.
+    if (node->fnNode.func != NULL && !gIsInterpolationFrame) {
+#else
     if (node->fnNode.func != NULL) {
+#endif
         node->fnNode.func(GEO_CONTEXT_RENDER, &node->fnNode.node, gMatStack[gMatStackIndex]);
     }
     if (node->fnNode.node.children != NULL) {
@@ -524,12 +1319,38 @@ void geo_process_level_of_detail(struct GraphNodeLevelOfDetail *node) {
 #else
     f32 distanceFromCam = -gMatStack[gMatStackIndex][3][2];
 #endif
+#ifdef LOD_HYSTERESIS
+    f32 minDistance = node->minDistance;
+    f32 maxDistance = node->maxDistance;
 
+    // Bias the range in favor of the band this object drew last frame, so an
+    // object hovering at a LOD boundary doesn't flicker between meshes. The
+    // biases cancel at each shared boundary, so exactly one band still matches.
+    if (gCurGraphNodeObject != NULL) {
+        if (gCurGraphNodeObject->lodBandMin == node->minDistance) {
+            minDistance -= LOD_HYSTERESIS;
+            maxDistance += LOD_HYSTERESIS;
+        } else if (gCurGraphNodeObject->lodBandMin != LOD_BAND_NONE) {
+            minDistance += LOD_HYSTERESIS;
+            maxDistance -= LOD_HYSTERESIS;
+        }
+    }
+
+    if (minDistance <= distanceFromCam
+        && distanceFromCam < maxDistance
+        && node->node.children != NULL) {
+        if (gCurGraphNodeObject != NULL) {
+            gCurGraphNodeObject->lodBandMin = node->minDistance;
+        }
+        geo_process_node_and_siblings(node->node.children);
+    }
+#else
     if ((f32)node->minDistance <= distanceFromCam
         && distanceFromCam < (f32)node->maxDistance
         && node->node.children != 0) {
         geo_process_node_and_siblings(node->node.children);
     }
+#endif
 }
 
 /**
@@ -544,6 +1365,22 @@ void geo_process_switch(struct GraphNodeSwitchCase *node) {
     if (node->fnNode.func != NULL) {
         node->fnNode.func(GEO_CONTEXT_RENDER, &node->fnNode.node, gMatStack[gMatStackIndex]);
     }
+#ifdef ROOM_NEIGHBOR_RENDERING
+    // For the room switch, render the current room and its door-connected
+    // neighbors; everything else stays occluded.
+    if (node->fnNode.func == (GraphNodeFunc) geo_switch_area && gMarioCurrentRoom > 0) {
+        struct GraphNode *child = node->fnNode.node.children;
+
+        for (i = 1; child != NULL; i++, child = child->next) {
+            if (i == gMarioCurrentRoom
+             || i == gDoorAdjacentRooms[gMarioCurrentRoom][0]
+             || i == gDoorAdjacentRooms[gMarioCurrentRoom][1]) {
+                geo_process_node_and_siblings(child);
+            }
+        }
+        return;
+    }
+#endif
     for (i = 0; selectedChild != NULL && node->selectedCase > i; i++) {
         selectedChild = selectedChild->next;
     }
@@ -552,6 +1389,139 @@ void geo_process_switch(struct GraphNodeSwitchCase *node) {
     }
 }
 
+#ifdef MICRO_COIN_POOL
+#define MICRO_COIN_MAX_FRAMES 8
+
+/**
+ * Cached animation-frame display lists of the coin models, rescanned whenever
+ * the loaded graph node changes (level transitions reload the model tables).
+ */
+static struct {
+    struct GraphNode *root;
+    void *frameDls[MICRO_COIN_MAX_FRAMES];
+    s16 frameLayers[MICRO_COIN_MAX_FRAMES];
+    s16 frameCount;
+} sMicroCoinModels[MICRO_COIN_TYPE_COUNT];
+
+static const ModelID16 sMicroCoinModelIds[MICRO_COIN_TYPE_COUNT] = {
+    MODEL_YELLOW_COIN,
+    MODEL_BLUE_COIN,
+};
+
+static struct GraphNodeSwitchCase *micro_coin_find_switch(struct GraphNode *node) {
+    struct GraphNode *child = node->children;
+
+    if (node->type == GRAPH_NODE_TYPE_SWITCH_CASE) {
+        return (struct GraphNodeSwitchCase *) node;
+    }
+    if (child != NULL) {
+        do {
+            struct GraphNodeSwitchCase *found = micro_coin_find_switch(child);
+            if (found != NULL) {
+                return found;
+            }
+            child = child->next;
+        } while (child != node->children);
+    }
+    return NULL;
+}
+
+static struct GraphNodeDisplayList *micro_coin_find_display_list(struct GraphNode *node) {
+    struct GraphNode *child = node->children;
+
+    if (node->type == GRAPH_NODE_TYPE_DISPLAY_LIST
+        && ((struct GraphNodeDisplayList *) node)->displayList != NULL) {
+        return (struct GraphNodeDisplayList *) node;
+    }
+    if (child != NULL) {
+        do {
+            struct GraphNodeDisplayList *found = micro_coin_find_display_list(child);
+            if (found != NULL) {
+                return found;
+            }
+            child = child->next;
+        } while (child != node->children);
+    }
+    return NULL;
+}
+
+/**
+ * Collect one display list per animation state from the coin model's switch
+ * node (the same node geo_switch_anim_state drives for object coins).
+ */
+static void micro_coin_scan_model(s32 type) {
+    struct GraphNode *root = gLoadedGraphNodes[sMicroCoinModelIds[type]];
+    struct GraphNodeSwitchCase *switchCase;
+    struct GraphNode *child;
+
+    sMicroCoinModels[type].root = root;
+    sMicroCoinModels[type].frameCount = 0;
+    if (root == NULL || (switchCase = micro_coin_find_switch(root)) == NULL
+        || (child = switchCase->fnNode.node.children) == NULL) {
+        return;
+    }
+    do {
+        struct GraphNodeDisplayList *dlNode = micro_coin_find_display_list(child);
+        if (dlNode != NULL && sMicroCoinModels[type].frameCount < MICRO_COIN_MAX_FRAMES) {
+            sMicroCoinModels[type].frameDls[sMicroCoinModels[type].frameCount] = dlNode->displayList;
+            sMicroCoinModels[type].frameLayers[sMicroCoinModels[type].frameCount] =
+                GET_GRAPH_NODE_LAYER(dlNode->node.flags);
+            sMicroCoinModels[type].frameCount++;
+        }
+        child = child->next;
+    } while (child != switchCase->fnNode.node.children);
+}
+
+/**
+ * Batch-render the micro coin pool: each instance costs one billboard matrix
+ * and one master list append of the shared animation-frame display list, no
+ * graph traversal. Appending the same display list back to back also lets the
+ * master list material sort keep the coins in one pipeline state run.
+ */
+static void geo_append_micro_coins(void) {
+    Vec3f scale = { 1.0f, 1.0f, 1.0f };
+    s32 i;
+
+    for (i = 0; i < MICRO_COIN_TYPE_COUNT; i++) {
+        if (sMicroCoinModels[i].root != gLoadedGraphNodes[sMicroCoinModelIds[i]]) {
+            micro_coin_scan_model(i);
+        }
+    }
+
+    for (i = 0; i < gMicroCoinHighWater; i++) {
+        struct MicroCoin *coin = &gMicroCoinPool[i];
+        s32 frame;
+
+        if (!coin->active || sMicroCoinModels[coin->type].frameCount == 0) {
+            continue;
+        }
+        // Flicker through the blink window like obj_flicker_and_disappear.
+        if (coin->timer >= MICRO_COIN_LIFETIME && (gGlobalTimer & 1)) {
+            continue;
+        }
+
+        mtxf_billboard(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex], coin->pos, scale,
+                       gCurGraphNodeCamera->roll);
+        // Cheap view check: camera-space z from the fresh matrix.
+        if (gMatStack[gMatStackIndex + 1][3][2] > -100.0f
+            || gMatStack[gMatStackIndex + 1][3][2] < -20000.0f) {
+            continue;
+        }
+        inc_mat_stack();
+
+        frame = gAreaUpdateCounter % sMicroCoinModels[coin->type].frameCount;
+#ifdef GFX_LOD_VARIANTS
+        geo_append_display_list(gfx_select_lod_variant(sMicroCoinModels[coin->type].frameDls[frame]),
+                                sMicroCoinModels[coin->type].frameLayers[frame]);
+#else
+        geo_append_display_list(sMicroCoinModels[coin->type].frameDls[frame],
+                                sMicroCoinModels[coin->type].frameLayers[frame]);
+#endif
+        gMatStackIndex--;
+    }
+}
+#endif // MICRO_COIN_POOL
+
 /**
  * Process a camera node.
  */
@@ -559,14 +1529,28 @@ void geo_process_camera(struct GraphNodeCamera *node) {
     Mat4 cameraTransform;
     Mtx *rollMtx = alloc_display_list(sizeof(*rollMtx));
 
+#ifdef FRAME_INTERPOLATION
+    // The camera update is game logic and already ran on the main pass.
+    if (node->fnNode.func != NULL && !gIsInterpolationFrame) {
+#else
     if (node->fnNode.func != NULL) {
+#endif
         node->fnNode.func(GEO_CONTEXT_RENDER, &node->fnNode.node, gMatStack[gMatStackIndex]);
     }
     mtxf_rotate_xy(rollMtx, node->rollScreen);
 
     gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(rollMtx), G_MTX_PROJECTION | G_MTX_MUL | G_MTX_NOPUSH);
 
+#ifdef FRAME_INTERPOLATION
+    if (gIsInterpolationFrame) {
+        mtxf_lookat(cameraTransform, gInterpCamPos, gInterpCamFocus, sInterpCamRoll);
+    } else {
+        frame_interp_camera_snapshot(node);
+        mtxf_lookat(cameraTransform, node->pos, node->focus, node->roll);
+    }
+#else
     mtxf_lookat(cameraTransform, node->pos, node->focus, node->roll);
+#endif
     mtxf_mul(gMatStack[gMatStackIndex + 1], cameraTransform, gMatStack[gMatStackIndex]);
     inc_mat_stack();
 
@@ -574,6 +1558,9 @@ void geo_process_camera(struct GraphNodeCamera *node) {
         gCurGraphNodeCamera = node;
         node->matrixPtr = &gMatStack[gMatStackIndex];
         geo_process_node_and_siblings(node->fnNode.node.children);
+#ifdef MICRO_COIN_POOL
+        geo_append_micro_coins();
+#endif
         gCurGraphNodeCamera = NULL;
     }
     gMatStackIndex--;
@@ -604,7 +1591,7 @@ void geo_process_translation(struct GraphNodeTranslation *node) {
     Vec3f translation;
 
     vec3s_to_vec3f(translation, node->translation);
-    mtxf_rotate_zxy_and_translate_and_mul(gVec3sZero, translation, gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex]);
+    mtxf_translate_and_mul(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex], translation);
 
     inc_mat_stack();
     append_dl_and_return((struct GraphNodeDisplayList *)node);
@@ -616,7 +1603,7 @@ void geo_process_translation(struct GraphNodeTranslation *node) {
  * For the rest it acts as a normal display list node.
  */
 void geo_process_rotation(struct GraphNodeRotation *node) {
-    mtxf_rotate_zxy_and_translate_and_mul(node->rotation, gVec3fZero, gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex]);
+    mtxf_rotate_zxy_and_mul(node->rotation, gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex]);
 
     inc_mat_stack();
     append_dl_and_return(((struct GraphNodeDisplayList *)node));
@@ -657,7 +1644,11 @@ void geo_process_billboard(struct GraphNodeBillboard *node) {
 
     mtxf_billboard(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex], translation, scale, gCurGraphNodeCamera->roll);
 
+#ifdef BILLBOARD_MTX_CACHE
+    inc_mat_stack_billboard();
+#else
     inc_mat_stack();
+#endif
     append_dl_and_return((struct GraphNodeDisplayList *)node);
 }
 
@@ -714,8 +1705,8 @@ void geo_process_background(struct GraphNodeBackground *node) {
         gDPPipeSync(gfx++);
         gDPSetCycleType(gfx++, G_CYC_FILL);
         gDPSetFillColor(gfx++, node->background);
-        gDPFillRectangle(gfx++, GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0), gBorderHeight,
-        GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, SCREEN_HEIGHT - gBorderHeight - 1);
+        gDPFillRectangle(gfx++, GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0), ADAPTIVE_RES_Y(gBorderHeight),
+        GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, ADAPTIVE_RES_Y(SCREEN_HEIGHT - gBorderHeight) - 1);
         gDPPipeSync(gfx++);
         gDPSetCycleType(gfx++, G_CYC_1CYCLE);
         gSPEndDisplayList(gfx++);
@@ -774,9 +1765,12 @@ void geo_process_animated_part(struct GraphNodeAnimatedPart *node) {
         rotation[2] = gCurrAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)];
     }
 
+#ifdef ANIM_BLENDING
+    anim_blend_apply(rotation);
+#endif
     mtxf_rotate_xyz_and_translate_and_mul(rotation, translation, gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex]);
 
-    inc_mat_stack();
+    inc_mat_stack_animated();
     append_dl_and_return(((struct GraphNodeDisplayList *)node));
 }
 
@@ -826,9 +1820,12 @@ void geo_process_bone(struct GraphNodeBone *node) {
         rotation[2] += gCurrAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)];
     }
 
+#ifdef ANIM_BLENDING
+    anim_blend_apply(rotation);
+#endif
     mtxf_rotate_xyz_and_translate_and_mul(rotation, translation, gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex]);
 
-    inc_mat_stack();
+    inc_mat_stack_animated();
     append_dl_and_return((struct GraphNodeDisplayList *)node);
 }
 
@@ -921,10 +1918,23 @@ void geo_process_shadow(struct GraphNodeShadow *node) {
                 gCurrShadow.floorNormal, shadowPos, gCurrShadow.scale, gCurGraphNodeObject->angle[1]);
 
             inc_mat_stack();
+#ifdef SHADOW_BATCHING
+            if (gCurrShadow.isDecal) {
+                // Decal shadows queue into the per-frame batch; the master list
+                // draws the whole batch contiguously at the decal layer.
+                shadow_batch_add(mat_stack_fixed(), node->shadowType, shadowPos);
+            } else {
+                // Shadows on transparent surfaces keep the per-shadow display
+                // list, since they need the non-decal render mode.
+                geo_append_display_list((void *) VIRTUAL_TO_PHYSICAL(shadowList),
+                                        LAYER_TRANSPARENT);
+            }
+#else
             geo_append_display_list(
                 (void *) VIRTUAL_TO_PHYSICAL(shadowList),
                 gCurrShadow.isDecal ? LAYER_TRANSPARENT_DECAL : LAYER_TRANSPARENT
             );
+#endif
 
             gMatStackIndex--;
         }
@@ -983,6 +1993,7 @@ s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
 
     // Don't render if the object is close to or behind the camera
     if (matrix[3][2] > -100.0f + cullingRadius) {
+        gCulledObjectCount++;
         return FALSE;
     }
 
@@ -991,6 +2002,7 @@ s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
     //  If Mario were rendered with a depth over 65536 it would cause overflow
     //  when converting the transformation matrix to a fixed point matrix.
     if (matrix[3][2] < -20000.0f - cullingRadius) {
+        gCulledObjectCount++;
         return FALSE;
     }
 
@@ -1009,12 +2021,31 @@ s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
 
     // Check whether the object is horizontally in view
     if (matrix[3][0] > hScreenEdge + cullingRadius) {
+        gCulledObjectCount++;
         return FALSE;
     }
     if (matrix[3][0] < -hScreenEdge - cullingRadius) {
+        gCulledObjectCount++;
         return FALSE;
     }
 
+#ifdef OBJECTS_CULL_VERTICALLY
+    // half of the vertical fov, with the same 1 degree pop-in margin as above
+    s16 halfFovY = ((((gCurGraphNodeCamFrustum->fov / 2.0f) + 1.0f) * 32768.0f) / 180.0f) + 0.5f;
+
+    f32 vScreenEdge = -matrix[3][2] * tans(halfFovY);
+
+    // Check whether the object is vertically in view
+    if (matrix[3][1] > vScreenEdge + cullingRadius) {
+        gCulledObjectCount++;
+        return FALSE;
+    }
+    if (matrix[3][1] < -vScreenEdge - cullingRadius) {
+        gCulledObjectCount++;
+        return FALSE;
+    }
+#endif
+
     return TRUE;
 }
 
@@ -1048,11 +2079,218 @@ void visualise_object_hitbox(struct Object *node) {
 }
 #endif
 
+#ifdef STATIC_PROP_INSTANCING
+/**
+ * Returns whether an object's shared subtree is a pure static prop: one
+ * culling radius or start node whose children are all childless display list
+ * nodes (trees, posts, most level decorations). Such a subtree carries no
+ * per-node state, so instances don't need to traverse it at all. Non-props
+ * bail out on the first or second check.
+ */
+static s32 obj_is_static_prop(struct GraphNode *root) {
+    struct GraphNode *child = root->children;
+
+    if (root->next != root || child == NULL) {
+        return FALSE;
+    }
+    if (root->type != GRAPH_NODE_TYPE_CULLING_RADIUS && root->type != GRAPH_NODE_TYPE_START) {
+        return FALSE;
+    }
+    do {
+        if (child->type != GRAPH_NODE_TYPE_DISPLAY_LIST || child->children != NULL) {
+            return FALSE;
+        }
+        child = child->next;
+    } while (child != root->children);
+    return TRUE;
+}
+
+/**
+ * Submit a static prop instance without traversing its subtree: the shared
+ * display lists are appended directly under the object's transform, matching
+ * what the recursive walk through geo_process_display_list would emit.
+ */
+static void geo_append_static_prop(struct GraphNode *root) {
+    struct GraphNode *child = root->children;
+
+    if (!(root->flags & GRAPH_RENDER_ACTIVE)) {
+        return;
+    }
+    do {
+        struct GraphNodeDisplayList *dlNode = (struct GraphNodeDisplayList *) child;
+        if ((child->flags & GRAPH_RENDER_ACTIVE) && dlNode->displayList != NULL) {
+#ifdef GFX_LOD_VARIANTS
+            geo_append_display_list(gfx_select_lod_variant(dlNode->displayList),
+                                    GET_GRAPH_NODE_LAYER(child->flags));
+#else
+            geo_append_display_list(dlNode->displayList, GET_GRAPH_NODE_LAYER(child->flags));
+#endif
+        }
+        child = child->next;
+    } while (child != root->children);
+}
+#endif
+
+#ifdef MIRROR_RENDER_CACHE
+/**
+ * Everything the mirror image depends on, quantized. Deliberately excludes the
+ * animation frame: idle breathing advances it every frame and would defeat the
+ * cache, and MIRROR_RENDER_CACHE_MAX_AGE bounds how stale the pose can get.
+ */
+struct MirrorCacheKey {
+    void *curAnim;
+    void *sharedChild;
+    u32 action;
+    s16 pos[3];
+    s16 yaw;
+    s16 areaIndex;
+    s16 camPos[3];
+    s16 camFocus[3];
+    s16 camRoll;
+    s16 modelState;
+    s8 capState;
+    s8 eyeState;
+    s8 handState;
+    u8 punchState;
+    s16 torsoAngle[3];
+    s16 headAngle[3];
+};
+
+static struct MirrorCacheKey sMirrorCacheKey;
+static u8 sMirrorCacheValid = FALSE;
+static u8 sMirrorCacheAge = 0;
+
+static void mirror_cache_build_key(struct MirrorCacheKey *key) {
+    struct MarioBodyState *bodyState = &gBodyStates[0];
+    s32 i;
+
+    bzero(key, sizeof(*key));
+    key->curAnim = gMirrorMario.animInfo.curAnim;
+    key->sharedChild = gMirrorMario.sharedChild;
+    key->action = bodyState->action;
+    key->yaw = gMirrorMario.angle[1] / MIRROR_RENDER_CACHE_ANGLE_EPS;
+    key->areaIndex = gMirrorMario.areaIndex;
+    key->camRoll = gCurGraphNodeCamera->roll;
+    key->modelState = bodyState->modelState;
+    key->capState = bodyState->capState;
+    key->eyeState = bodyState->eyeState;
+    key->handState = bodyState->handState;
+    key->punchState = bodyState->punchState;
+    for (i = 0; i < 3; i++) {
+        key->pos[i] = gMirrorMario.pos[i] / MIRROR_RENDER_CACHE_POS_EPS;
+        key->camPos[i] = gCurGraphNodeCamera->pos[i] / MIRROR_RENDER_CACHE_POS_EPS;
+        key->camFocus[i] = gCurGraphNodeCamera->focus[i] / MIRROR_RENDER_CACHE_POS_EPS;
+        key->torsoAngle[i] = bodyState->torsoAngle[i] / MIRROR_RENDER_CACHE_ANGLE_EPS;
+        key->headAngle[i] = bodyState->headAngle[i] / MIRROR_RENDER_CACHE_ANGLE_EPS;
+    }
+}
+
+/**
+ * Re-append the cached entries. Each replay pushes a matrix stack slot pointed
+ * at the entry's stored fixed point matrix and goes back through
+ * geo_append_display_list, so the ucode pick and silhouette layer mapping are
+ * reapplied from the live gCurGraphNodeObject exactly as during capture.
+ * The current parity set is refreshed from the active set (identical in
+ * content, and settled since the frame that wrote it has retired) before it is
+ * emitted, keeping every frame's display list pointed at buffers the next
+ * frame won't rewrite.
+ */
+static void mirror_cache_replay(void) {
+    s32 parity = gGlobalTimer & 1;
+    s32 src = sMirrorCacheActiveSet;
+    s32 i;
+
+    for (i = 0; i < sMirrorCacheCount; i++) {
+        struct MirrorCacheEntry *entry = &sMirrorCacheEntries[i];
+
+        if (src != parity) {
+            entry->mtx[parity] = entry->mtx[src];
+            if (entry->usesCopy) {
+                memcpy(entry->gfxCopy[parity], entry->gfxCopy[src],
+                       entry->numGfx * sizeof(Gfx));
+            }
+        }
+
+        gMatStackIndex++;
+#ifdef LAZY_MTX_CONVERSION
+        sMatStackPending &= ~(1 << gMatStackIndex);
+#endif
+        gMatStackFixed[gMatStackIndex] = &entry->mtx[parity];
+        geo_append_display_list(entry->usesCopy ? entry->gfxCopy[parity] : entry->displayList,
+                                entry->layer);
+        gMatStackIndex--;
+    }
+
+    sMirrorCacheActiveSet = parity;
+}
+
+/**
+ * Render mirror Mario through the sub-scene cache: while his pose key holds
+ * (and the cache is younger than MIRROR_RENDER_CACHE_MAX_AGE frames), replay
+ * the captured appends instead of traversing his whole model subtree again.
+ * Otherwise traverse normally with capture hooked into geo_append_display_list
+ * and store the new key. The mirror room renders Mario twice per frame; this
+ * takes the second copy's animation, skinning and switch logic off the frames
+ * where he and the camera hold still enough.
+ */
+static void mirror_subscene_render(struct Object *node) {
+    struct MirrorCacheKey key;
+
+    mirror_cache_build_key(&key);
+    if (sMirrorCacheValid && sMirrorCacheAge < MIRROR_RENDER_CACHE_MAX_AGE
+     && memcmp(&key, &sMirrorCacheKey, sizeof(key)) == 0) {
+        sMirrorCacheAge++;
+        mirror_cache_replay();
+        return;
+    }
+
+    sMirrorCacheCount = 0;
+    sMirrorCaptureFailed = FALSE;
+    sMirrorCaptureActive = TRUE;
+    node->header.gfx.sharedChild->parent = &node->header.gfx.node;
+    geo_process_node_and_siblings(node->header.gfx.sharedChild);
+    node->header.gfx.sharedChild->parent = NULL;
+    sMirrorCaptureActive = FALSE;
+
+    sMirrorCacheKey = key;
+    sMirrorCacheAge = 0;
+    sMirrorCacheActiveSet = gGlobalTimer & 1;
+    sMirrorCacheValid = !sMirrorCaptureFailed;
+}
+#endif // MIRROR_RENDER_CACHE
+
 /**
  * Process an object node.
  */
 void geo_process_object(struct Object *node) {
     if (node->header.gfx.areaIndex == gCurGraphNodeRoot->areaIndex) {
+#ifdef FRAME_INTERPOLATION
+        Vec3f interpPos;
+        Vec3s interpAngle;
+        Vec3f interpScale;
+        f32 *objPos = node->header.gfx.pos;
+        s16 *objAngle = node->header.gfx.angle;
+        f32 *objScale = node->header.gfx.scale;
+
+        if (gIsInterpolationFrame) {
+            frame_interp_object(&node->header.gfx, interpPos, interpAngle, interpScale);
+            objPos = interpPos;
+            objAngle = interpAngle;
+            objScale = interpScale;
+        }
+        if (node->header.gfx.throwMatrix != NULL) {
+            // Thrown/held matrices are built by game logic and aren't interpolated.
+            mtxf_mul(gMatStack[gMatStackIndex + 1], *node->header.gfx.throwMatrix,
+                     gMatStack[gMatStackIndex]);
+            mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex + 1], node->header.gfx.scale);
+        } else if (node->header.gfx.node.flags & GRAPH_RENDER_BILLBOARD) {
+            mtxf_billboard(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex],
+                           objPos, objScale, gCurGraphNodeCamera->roll);
+        } else {
+            mtxf_rotate_zxy_and_translate_and_mul(objAngle, objPos, gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex]);
+            mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex + 1], objScale);
+        }
+#else
         if (node->header.gfx.throwMatrix != NULL) {
             mtxf_mul(gMatStack[gMatStackIndex + 1], *node->header.gfx.throwMatrix,
                      gMatStack[gMatStackIndex]);
@@ -1064,6 +2302,7 @@ void geo_process_object(struct Object *node) {
             mtxf_rotate_zxy_and_translate_and_mul(node->header.gfx.angle, node->header.gfx.pos, gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex]);
             mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex + 1], node->header.gfx.scale);
         }
+#endif
 
         node->header.gfx.throwMatrix = &gMatStack[++gMatStackIndex];
         vec3_copy(node->header.gfx.cameraToObject, gMatStack[gMatStackIndex][3]);
@@ -1075,20 +2314,56 @@ void geo_process_object(struct Object *node) {
         if (obj_is_in_view(&node->header.gfx, gMatStack[gMatStackIndex])) {
             gMatStackIndex--;
             inc_mat_stack();
+#ifdef ANIM_BLENDING
+            anim_blend_begin(node);
+#endif
+#ifdef ANIM_MATRIX_CACHE
+ #ifdef ANIM_BLENDING
+            // While a cross fade is active, the rendered pose isn't the animation's own,
+            // so don't let the bone matrix cache store or serve it under a pure key.
+            if (sAnimBlendWeight == 1.0f)
+ #endif
+            anim_mtx_cache_begin(node, gMatStack[gMatStackIndex]);
+#endif
 
             if (node->header.gfx.sharedChild != NULL) {
 #ifdef VISUAL_DEBUG
                 if (hitboxView) visualise_object_hitbox(node);
 #endif
                 gCurGraphNodeObject = (struct GraphNodeObject *) node;
-                node->header.gfx.sharedChild->parent = &node->header.gfx.node;
-                geo_process_node_and_siblings(node->header.gfx.sharedChild);
-                node->header.gfx.sharedChild->parent = NULL;
+#ifdef MIRROR_RENDER_CACHE
+                if (gCurGraphNodeObject == &gMirrorMario) {
+                    mirror_subscene_render(node);
+                } else
+#endif
+#ifdef STATIC_PROP_INSTANCING
+                if (obj_is_static_prop(node->header.gfx.sharedChild)) {
+                    // Shared static geometry: every instance costs just its
+                    // matrix and master list entries, not a subtree traversal.
+                    geo_append_static_prop(node->header.gfx.sharedChild);
+                } else {
+                    node->header.gfx.sharedChild->parent = &node->header.gfx.node;
+                    geo_process_node_and_siblings(node->header.gfx.sharedChild);
+                    node->header.gfx.sharedChild->parent = NULL;
+                }
+#else
+                {
+                    node->header.gfx.sharedChild->parent = &node->header.gfx.node;
+                    geo_process_node_and_siblings(node->header.gfx.sharedChild);
+                    node->header.gfx.sharedChild->parent = NULL;
+                }
+#endif
                 gCurGraphNodeObject = NULL;
             }
             if (node->header.gfx.node.children != NULL) {
                 geo_process_node_and_siblings(node->header.gfx.node.children);
             }
+#ifdef ANIM_MATRIX_CACHE
+            anim_mtx_cache_end();
+#endif
+#ifdef ANIM_BLENDING
+            anim_blend_end();
+#endif
         }
 
         gMatStackIndex--;
@@ -1185,6 +2460,38 @@ void geo_try_process_children(struct GraphNode *node) {
  * The first argument is the start node, and all its siblings will
  * be iterated over.
  */
+#ifdef DISABLE_GRAPH_NODE_TYPE_FUNCTIONAL
+typedef void (*GeoProcessFunc)(struct GraphNode *);
+
+/* clang-format off */
+// Per-type node processors, indexed by the dense type enum. Types without an
+// entry (root, start, culling radius) have no processing of their own and
+// just descend into their children.
+static const GeoProcessFunc sGeoProcessFuncs[GRAPH_NODE_TYPES_COUNT] = {
+    [GRAPH_NODE_TYPE_ORTHO_PROJECTION]     = (GeoProcessFunc) geo_process_ortho_projection,
+    [GRAPH_NODE_TYPE_PERSPECTIVE]          = (GeoProcessFunc) geo_process_perspective,
+    [GRAPH_NODE_TYPE_MASTER_LIST]          = (GeoProcessFunc) geo_process_master_list,
+    [GRAPH_NODE_TYPE_LEVEL_OF_DETAIL]      = (GeoProcessFunc) geo_process_level_of_detail,
+    [GRAPH_NODE_TYPE_SWITCH_CASE]          = (GeoProcessFunc) geo_process_switch,
+    [GRAPH_NODE_TYPE_CAMERA]               = (GeoProcessFunc) geo_process_camera,
+    [GRAPH_NODE_TYPE_TRANSLATION_ROTATION] = (GeoProcessFunc) geo_process_translation_rotation,
+    [GRAPH_NODE_TYPE_TRANSLATION]          = (GeoProcessFunc) geo_process_translation,
+    [GRAPH_NODE_TYPE_ROTATION]             = (GeoProcessFunc) geo_process_rotation,
+    [GRAPH_NODE_TYPE_OBJECT]               = (GeoProcessFunc) geo_process_object,
+    [GRAPH_NODE_TYPE_ANIMATED_PART]        = (GeoProcessFunc) geo_process_animated_part,
+    [GRAPH_NODE_TYPE_BILLBOARD]            = (GeoProcessFunc) geo_process_billboard,
+    [GRAPH_NODE_TYPE_DISPLAY_LIST]         = (GeoProcessFunc) geo_process_display_list,
+    [GRAPH_NODE_TYPE_SCALE]                = (GeoProcessFunc) geo_process_scale,
+    [GRAPH_NODE_TYPE_SHADOW]               = (GeoProcessFunc) geo_process_shadow,
+    [GRAPH_NODE_TYPE_OBJECT_PARENT]        = (GeoProcessFunc) geo_process_object_parent,
+    [GRAPH_NODE_TYPE_GENERATED_LIST]       = (GeoProcessFunc) geo_process_generated_list,
+    [GRAPH_NODE_TYPE_BACKGROUND]           = (GeoProcessFunc) geo_process_background,
+    [GRAPH_NODE_TYPE_HELD_OBJ]             = (GeoProcessFunc) geo_process_held_object,
+    [GRAPH_NODE_TYPE_BONE]                 = (GeoProcessFunc) geo_process_bone,
+};
+/* clang-format on */
+#endif
+
 void geo_process_node_and_siblings(struct GraphNode *firstNode) {
     s32 iterateChildren = TRUE;
     struct GraphNode *curGraphNode = firstNode;
@@ -1201,6 +2508,14 @@ void geo_process_node_and_siblings(struct GraphNode *firstNode) {
             if (curGraphNode->flags & GRAPH_RENDER_CHILDREN_FIRST) {
                 geo_try_process_children(curGraphNode);
             } else {
+#ifdef DISABLE_GRAPH_NODE_TYPE_FUNCTIONAL
+                GeoProcessFunc processFunc = sGeoProcessFuncs[curGraphNode->type];
+                if (processFunc != NULL) {
+                    processFunc(curGraphNode);
+                } else {
+                    geo_try_process_children(curGraphNode);
+                }
+#else
                 switch (curGraphNode->type) {
                     case GRAPH_NODE_TYPE_ORTHO_PROJECTION:     geo_process_ortho_projection    ((struct GraphNodeOrthoProjection     *) curGraphNode); break;
                     case GRAPH_NODE_TYPE_PERSPECTIVE:          geo_process_perspective         ((struct GraphNodePerspective         *) curGraphNode); break;
@@ -1224,6 +2539,7 @@ void geo_process_node_and_siblings(struct GraphNode *firstNode) {
                     case GRAPH_NODE_TYPE_BONE:                 geo_process_bone                ((struct GraphNodeBone                *) curGraphNode); break;
                     default:                                   geo_try_process_children        ((struct GraphNode                    *) curGraphNode); break;
                 }
+#endif
             }
         } else {
             if (curGraphNode->type == GRAPH_NODE_TYPE_OBJECT) {
@@ -1243,10 +2559,17 @@ void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor)
         Mtx *initialMatrix;
         Vp *viewport = alloc_display_list(sizeof(*viewport));
 
+#ifdef FRAME_INTERPOLATION
+        if (gIsInterpolationFrame) {
+            frame_interp_begin_pass();
+        }
+#endif
+
         gDisplayListHeap = alloc_only_pool_init(main_pool_available() - sizeof(struct AllocOnlyPool), MEMORY_POOL_LEFT);
         initialMatrix = alloc_display_list(sizeof(*initialMatrix));
         gMatStackIndex = 0;
         gCurrAnimType = ANIM_TYPE_NONE;
+        gCulledObjectCount = 0;
         vec3s_set(viewport->vp.vtrans, node->x * 4, node->y * 4, 511);
         vec3s_set(viewport->vp.vscale, node->width * 4, node->height * 4, 511);
 
@@ -1264,6 +2587,14 @@ void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor)
         mtxf_identity(gMatStack[gMatStackIndex]);
         mtxf_to_mtx(initialMatrix, gMatStack[gMatStackIndex]);
         gMatStackFixed[gMatStackIndex] = initialMatrix;
+#ifdef LAZY_MTX_CONVERSION
+        sMatStackPending = 0;
+#endif
+#ifdef ADAPTIVE_RESOLUTION
+        // Squash the 3D viewport vertically; the VI stretches it back out.
+        viewport->vp.vscale[1] = ADAPTIVE_RES_Y(viewport->vp.vscale[1]);
+        viewport->vp.vtrans[1] = ADAPTIVE_RES_Y(viewport->vp.vtrans[1]);
+#endif
         gSPViewport(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(viewport));
         gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(gMatStackFixed[gMatStackIndex]),
                   G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH);
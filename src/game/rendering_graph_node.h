@@ -14,6 +14,26 @@ extern struct GraphNodeHeldObject  *gCurGraphNodeHeldObject;
 #define gCurGraphNodeObjectNode ((struct Object *)gCurGraphNodeObject)
 extern u16 gAreaUpdateCounter;
 
+#ifdef FRAME_INTERPOLATION
+extern s8 gIsInterpolationFrame;
+extern Vec3f gInterpCamPos;
+extern Vec3f gInterpCamFocus;
+#endif
+extern u32 gCulledObjectCount;
+
+#ifdef ANIM_MATRIX_CACHE
+void anim_mtx_cache_release(struct Object *obj);
+#endif
+
+#ifdef ANIM_BLENDING
+void anim_blend_release(struct Object *obj);
+#endif
+
+#ifdef LOD_HYSTERESIS
+// lodBandMin value meaning no LOD band was drawn last frame.
+#define LOD_BAND_NONE 0x7FFF
+#endif
+
 enum AnimType {
     // after processing an object, the type is reset to this
     ANIM_TYPE_NONE,
@@ -86,5 +106,8 @@ enum AnimType {
 
 void geo_process_node_and_siblings(struct GraphNode *firstNode);
 void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor);
+#ifdef GFX_LOD_VARIANTS
+s32 gfx_register_lod_variant(void *fullDl, void *farDl, f32 distance);
+#endif
 
 #endif // RENDERING_GRAPH_NODE_H
@@ -25,6 +25,19 @@ s32 sRumblePakActive = FALSE;
 s32 sRumblePakErrorCount = 0;
 s32 gRumblePakTimer = 0;
 
+#ifdef RUMBLE_MOTOR_STATE_TRACKING
+enum RumbleMotorState {
+    MOTOR_STATE_UNKNOWN = -1, // issue the next command unconditionally
+    MOTOR_STATE_OFF,
+    MOTOR_STATE_ON,
+};
+
+// The state the motor was last successfully commanded to. The update loop
+// requests a state every VI, but only transitions need an SI transaction;
+// repeats used to go out on the wire anyway and could stall a controller poll.
+static s8 sRumblePakMotorState = MOTOR_STATE_UNKNOWN;
+#endif
+
 void init_rumble_pak_scheduler_queue(void) {
     osCreateMesgQueue(&gRumblePakSchedulerMesgQueue, gRumblePakSchedulerMesgBuf, 1);
     osSendMesg(&gRumblePakSchedulerMesgQueue, (OSMesg) 0, OS_MESG_NOBLOCK);
@@ -43,14 +56,27 @@ static void start_rumble(void) {
     if (!sRumblePakActive) {
         return;
     }
+#ifdef RUMBLE_MOTOR_STATE_TRACKING
+    if (sRumblePakMotorState == MOTOR_STATE_ON) {
+        return;
+    }
+#endif
 
     block_until_rumble_pak_free();
 
     if (!osMotorStart(&gRumblePakPfs)) {
         sRumblePakErrorCount = 0;
+#ifdef RUMBLE_MOTOR_STATE_TRACKING
+        sRumblePakMotorState = MOTOR_STATE_ON;
     } else {
         sRumblePakErrorCount++;
+        sRumblePakMotorState = MOTOR_STATE_UNKNOWN;
     }
+#else
+    } else {
+        sRumblePakErrorCount++;
+    }
+#endif
 
     release_rumble_pak_control();
 }
@@ -59,14 +85,27 @@ static void stop_rumble(void) {
     if (!sRumblePakActive) {
         return;
     }
+#ifdef RUMBLE_MOTOR_STATE_TRACKING
+    if (sRumblePakMotorState == MOTOR_STATE_OFF) {
+        return;
+    }
+#endif
 
     block_until_rumble_pak_free();
 
     if (!osMotorStop(&gRumblePakPfs)) {
         sRumblePakErrorCount = 0;
+#ifdef RUMBLE_MOTOR_STATE_TRACKING
+        sRumblePakMotorState = MOTOR_STATE_OFF;
     } else {
         sRumblePakErrorCount++;
+        sRumblePakMotorState = MOTOR_STATE_UNKNOWN;
     }
+#else
+    } else {
+        sRumblePakErrorCount++;
+    }
+#endif
 
     release_rumble_pak_control();
 }
@@ -234,6 +273,10 @@ static void thread6_rumble_loop(UNUSED void *arg) {
         } else if (gNumVblanks % 60 == 0) {
             sRumblePakActive = osMotorInit(&gSIEventMesgQueue, &gRumblePakPfs, gPlayer1Controller->port) < 1;
             sRumblePakErrorCount = 0;
+#ifdef RUMBLE_MOTOR_STATE_TRACKING
+            // A fresh pak (or a reinserted one) is in an unknown motor state.
+            sRumblePakMotorState = MOTOR_STATE_UNKNOWN;
+#endif
         }
 
         if (gRumblePakTimer > 0) {
@@ -248,6 +291,9 @@ void cancel_rumble(void) {
     if (sRumblePakActive) {
         osMotorStop(&gRumblePakPfs);
     }
+#ifdef RUMBLE_MOTOR_STATE_TRACKING
+    sRumblePakMotorState = sRumblePakActive ? MOTOR_STATE_OFF : MOTOR_STATE_UNKNOWN;
+#endif
 
     gRumbleDataQueue[0].comm = 0;
     gRumbleDataQueue[1].comm = 0;
@@ -51,6 +51,55 @@ s8 gLevelToCourseNumTable[] = {
 
 STATIC_ASSERT(ARRAY_COUNT(gLevelToCourseNumTable) == LEVEL_COUNT - 1,
               "change this array if you are adding levels");
+
+#ifdef SAVE_CODEC
+/**
+ * Versioned, bit-packed on-device save format. gSaveBuffer stays the in-RAM
+ * working copy; sPackedSave mirrors what actually lives on EEPROM/SRAM. Each
+ * packed slot is a version byte, a fixed bitstream data area filled from
+ * sSaveFileSchema, and the usual trailing signature, so slot recovery works
+ * the same way as with the raw format. Menu data is small and already
+ * self-verifying, so it is mirrored raw.
+ */
+#define SAVE_CODEC_VERSION 1
+
+// Bitstream area per packed slot. Sized so a slot stays an 8 byte multiple
+// (EEPROM writes address 8 byte blocks); the bits not used by the schema
+// below are headroom for new fields.
+#ifdef SAVE_NUM_LIVES
+#define PACKED_SAVE_DATA_SIZE 51
+#else
+// capPos costs 48 bits where numLives costs 8, pushing the bitstream past 51
+// bytes; the next 8 byte aligned slot size needs EEP16K or SRAM (the
+// STATIC_ASSERT below catches a build where it no longer fits).
+#define PACKED_SAVE_DATA_SIZE 59
+#endif
+
+struct PackedSaveFile {
+    u8 version;
+    u8 data[PACKED_SAVE_DATA_SIZE];
+    struct SaveBlockSignature signature;
+};
+
+struct PackedSaveBuffer {
+    // Same two-copies-per-file layout as the raw format.
+    struct PackedSaveFile files[NUM_SAVE_FILES][2];
+    struct MainMenuSaveData menuData;
+};
+
+static struct PackedSaveBuffer sPackedSave;
+
+STATIC_ASSERT(sizeof(struct PackedSaveFile) % 8 == 0,
+              "packed slots must stay 8 byte multiples for EEPROM block writes");
+STATIC_ASSERT(sizeof(struct PackedSaveBuffer) <= EEPROM_SIZE,
+              "ERROR: Packed save too big for specified save type");
+
+#define SAVE_DEVICE_IMAGE ((u8 *) &sPackedSave)
+#define SAVE_DEVICE_IMAGE_SIZE sizeof(sPackedSave)
+#else
+#define SAVE_DEVICE_IMAGE ((u8 *) &gSaveBuffer)
+#define SAVE_DEVICE_IMAGE_SIZE sizeof(gSaveBuffer)
+#endif
 #ifdef EEP
 /**
  * Read from EEPROM to a given address.
@@ -63,14 +112,21 @@ static s32 read_eeprom_data(void *buffer, s32 size) {
 
     if (gEepromProbe != 0) {
         s32 triesLeft = 4;
-        u32 offset = (u32)((u8 *) buffer - (u8 *) &gSaveBuffer) / 8;
+        u32 offset = (u32)((u8 *) buffer - SAVE_DEVICE_IMAGE) / 8;
 
         do {
 #if ENABLE_RUMBLE
             block_until_rumble_pak_free();
+#endif
+#ifdef INPUT_POLLING_THREAD
+            // Keep the poll thread off the SI while the EEPROM transaction runs.
+            si_access_acquire();
 #endif
             triesLeft--;
             status = osEepromLongRead(&gSIEventMesgQueue, offset, buffer, size);
+#ifdef INPUT_POLLING_THREAD
+            si_access_release();
+#endif
 #if ENABLE_RUMBLE
             release_rumble_pak_control();
 #endif
@@ -91,14 +147,20 @@ static s32 write_eeprom_data(void *buffer, s32 size) {
 
     if (gEepromProbe != 0) {
         s32 triesLeft = 4;
-        u32 offset = (u32)((u8 *) buffer - (u8 *) &gSaveBuffer) >> 3;
+        u32 offset = (u32)((u8 *) buffer - SAVE_DEVICE_IMAGE) >> 3;
 
         do {
 #if ENABLE_RUMBLE
             block_until_rumble_pak_free();
+#endif
+#ifdef INPUT_POLLING_THREAD
+            si_access_acquire();
 #endif
             triesLeft--;
             status = osEepromLongWrite(&gSIEventMesgQueue, offset, buffer, size);
+#ifdef INPUT_POLLING_THREAD
+            si_access_release();
+#endif
 #if ENABLE_RUMBLE
             release_rumble_pak_control();
 #endif
@@ -120,7 +182,7 @@ static s32 read_eeprom_data(void *buffer, s32 size) {
 
     if (gSramProbe != 0) {
         s32 triesLeft = 4;
-        u32 offset = (u32)((u8 *) buffer - (u8 *) &gSaveBuffer);
+        u32 offset = (u32)((u8 *) buffer - SAVE_DEVICE_IMAGE);
 
         do {
 #if ENABLE_RUMBLE
@@ -148,7 +210,7 @@ static s32 write_eeprom_data(void *buffer, s32 size) {
 
     if (gSramProbe != 0) {
         s32 triesLeft = 4;
-        u32 offset = (u32)((u8 *) buffer - (u8 *) &gSaveBuffer);
+        u32 offset = (u32)((u8 *) buffer - SAVE_DEVICE_IMAGE);
 
         do {
 #if ENABLE_RUMBLE
@@ -167,6 +229,108 @@ static s32 write_eeprom_data(void *buffer, s32 size) {
 #endif
 
 
+#ifdef DEFERRED_SAVE_WRITES
+/**
+ * Deferred save writes. Saving marks the changed 8 byte blocks of gSaveBuffer
+ * dirty instead of writing the device synchronously; a small budget of blocks
+ * is then trickled out each frame by save_file_update_queued_writes(). Reads
+ * always come from gSaveBuffer in RAM, so gameplay never sees stale data.
+ *
+ * Blocks are flushed in ascending address order, so a file's primary slot
+ * (which ends in its checksum) always finishes before its backup slot is
+ * touched. If power is cut mid-flush, the slot being written fails its
+ * checksum on the next boot and the other slot restores it, the same recovery
+ * path an interrupted synchronous save uses.
+ */
+#define SAVE_BLOCK_SIZE 8
+#define SAVE_NUM_BLOCKS (((s32) SAVE_DEVICE_IMAGE_SIZE + SAVE_BLOCK_SIZE - 1) / SAVE_BLOCK_SIZE)
+#ifdef SRAM
+// SRAM writes are fast PI DMAs, so drain in larger chunks.
+#define SAVE_BLOCKS_PER_FRAME 8
+#else
+// One native EEPROM block per frame keeps the SI stall well under a frame.
+#define SAVE_BLOCKS_PER_FRAME 1
+#endif
+
+static u32 sSaveDirtyMask[(SAVE_NUM_BLOCKS + 31) / 32];
+static s32 sSaveDirtyCount = 0;
+
+#define SAVE_BLOCK_IS_DIRTY(i) (sSaveDirtyMask[(i) / 32] & (1u << ((i) % 32)))
+
+/**
+ * Mark the blocks covering [buffer, buffer + size) as needing a device write.
+ */
+static void queue_save_write(void *buffer, s32 size) {
+    s32 first = (s32)((u8 *) buffer - SAVE_DEVICE_IMAGE) / SAVE_BLOCK_SIZE;
+    s32 last = (s32)((u8 *) buffer - SAVE_DEVICE_IMAGE + size - 1) / SAVE_BLOCK_SIZE;
+    s32 i;
+
+    for (i = first; i <= last; i++) {
+        if (!SAVE_BLOCK_IS_DIRTY(i)) {
+            sSaveDirtyMask[i / 32] |= 1u << (i % 32);
+            sSaveDirtyCount++;
+        }
+    }
+}
+
+/**
+ * Write up to maxBlocks dirty blocks to the device, coalescing contiguous
+ * runs into single transfers.
+ */
+static void save_file_write_dirty_blocks(s32 maxBlocks) {
+    s32 i = 0;
+
+    while (i < SAVE_NUM_BLOCKS && maxBlocks > 0) {
+        if (SAVE_BLOCK_IS_DIRTY(i)) {
+            s32 run = 0;
+            s32 j;
+
+            while (i + run < SAVE_NUM_BLOCKS && run < maxBlocks && SAVE_BLOCK_IS_DIRTY(i + run)) {
+                run++;
+            }
+            write_eeprom_data(SAVE_DEVICE_IMAGE + i * SAVE_BLOCK_SIZE, run * SAVE_BLOCK_SIZE);
+            for (j = i; j < i + run; j++) {
+                sSaveDirtyMask[j / 32] &= ~(1u << (j % 32));
+            }
+            sSaveDirtyCount -= run;
+            maxBlocks -= run;
+            i += run;
+        } else {
+            i++;
+        }
+    }
+}
+
+/**
+ * Per-frame trickle; called from the main game loop.
+ */
+void save_file_update_queued_writes(void) {
+    if (sSaveDirtyCount > 0) {
+        save_file_write_dirty_blocks(SAVE_BLOCKS_PER_FRAME);
+    }
+}
+
+/**
+ * Synchronously drain all queued blocks (used before a console reset).
+ */
+void save_file_flush_writes(void) {
+    while (sSaveDirtyCount > 0) {
+        save_file_write_dirty_blocks(SAVE_NUM_BLOCKS);
+    }
+}
+#endif // DEFERRED_SAVE_WRITES
+
+/**
+ * Write a block of save data, either immediately or via the deferred queue.
+ */
+static void commit_save_write(void *buffer, s32 size) {
+#ifdef DEFERRED_SAVE_WRITES
+    queue_save_write(buffer, size);
+#else
+    write_eeprom_data(buffer, size);
+#endif
+}
+
 /**
  * Sum the bytes in data to data + size - 2. The last two bytes are ignored
  * because that is where the checksum is stored.
@@ -205,13 +369,144 @@ static void add_save_block_signature(void *buffer, s32 size, u16 magic) {
     sig->chksum = calc_checksum(buffer, size);
 }
 
+#ifdef SAVE_CODEC
+/**
+ * Per-field description of what a packed slot stores. Each entry is one
+ * struct SaveFile field (or array), packed MSB-first at its declared bit
+ * width. To extend the format, append an entry and bump SAVE_CODEC_VERSION;
+ * unpack wipes slots carrying a different version, the same way a failed
+ * checksum would.
+ */
+struct SaveFieldSchema {
+    u16 offset;   // byte offset of the field within struct SaveFile
+    u8 elemSize;  // size of one element in bytes (1, 2 or 4)
+    u8 bits;      // bits stored per element
+    u8 count;     // number of elements (1 for scalars)
+};
+
+// There is no offsetof in this codebase; a null-based member address is the
+// usual stand-in.
+#define SAVE_FIELD_OFFSET(field) ((u16)(u32) &((struct SaveFile *) 0)->field)
+
+#define SAVE_SCHEMA_FIELD(field, numBits) \
+    { SAVE_FIELD_OFFSET(field), sizeof(((struct SaveFile *) 0)->field), (numBits), 1 }
+#define SAVE_SCHEMA_ARRAY(field, numBits) \
+    { SAVE_FIELD_OFFSET(field[0]), sizeof(((struct SaveFile *) 0)->field[0]), (numBits), \
+      ARRAY_COUNT(((struct SaveFile *) 0)->field) }
+
+static const struct SaveFieldSchema sSaveFileSchema[] = {
+    SAVE_SCHEMA_FIELD(capLevel, 8),
+    SAVE_SCHEMA_FIELD(capArea, 8),
+#ifdef SAVE_NUM_LIVES
+    SAVE_SCHEMA_FIELD(numLives, 8),
+#else
+    SAVE_SCHEMA_ARRAY(capPos, 16),
+#endif
+    SAVE_SCHEMA_FIELD(flags, 32),
+    // Every bit of courseStars is meaningful: the MSB of each byte is the
+    // *previous* course's cannon-open flag.
+    SAVE_SCHEMA_ARRAY(courseStars, 8),
+    SAVE_SCHEMA_ARRAY(courseCoinScores, 8),
+};
+
+static void save_codec_put_bits(u8 *data, u32 *bitPos, u32 value, u32 bits) {
+    while (bits-- > 0) {
+        if ((value >> bits) & 1) {
+            data[*bitPos >> 3] |= 0x80 >> (*bitPos & 7);
+        }
+        (*bitPos)++;
+    }
+}
+
+static u32 save_codec_get_bits(const u8 *data, u32 *bitPos, u32 bits) {
+    u32 value = 0;
+
+    while (bits-- > 0) {
+        value = (value << 1) | ((data[*bitPos >> 3] >> (7 - (*bitPos & 7))) & 1);
+        (*bitPos)++;
+    }
+    return value;
+}
+
+/**
+ * Pack a raw save file into a device slot and sign it.
+ */
+static void pack_save_file(struct PackedSaveFile *dest, const struct SaveFile *src) {
+    u32 bitPos = 0;
+    u32 i, e;
+
+    bzero(dest, sizeof(*dest));
+    dest->version = SAVE_CODEC_VERSION;
+
+    for (i = 0; i < ARRAY_COUNT(sSaveFileSchema); i++) {
+        const struct SaveFieldSchema *field = &sSaveFileSchema[i];
+        const u8 *src8 = (const u8 *) src + field->offset;
+
+        for (e = 0; e < field->count; e++) {
+            u32 value;
+
+            switch (field->elemSize) {
+                case 1:  value = ((const u8 *) src8)[e];  break;
+                case 2:  value = ((const u16 *) src8)[e]; break;
+                default: value = ((const u32 *) src8)[e]; break;
+            }
+            save_codec_put_bits(dest->data, &bitPos, value, field->bits);
+        }
+    }
+
+    add_save_block_signature(dest, sizeof(*dest), SAVE_FILE_MAGIC);
+}
+
+/**
+ * Unpack a device slot into a raw save file. Returns FALSE (leaving dest
+ * untouched) if the slot fails its checksum or carries a different format
+ * version. The unpacked copy is re-signed so the RAM buffer stays
+ * self-consistent for save_file_reload.
+ */
+static s32 unpack_save_file(struct SaveFile *dest, struct PackedSaveFile *src) {
+    u32 bitPos = 0;
+    u32 i, e;
+
+    if (!verify_save_block_signature(src, sizeof(*src), SAVE_FILE_MAGIC)
+        || src->version != SAVE_CODEC_VERSION) {
+        return FALSE;
+    }
+
+    bzero(dest, sizeof(*dest));
+
+    for (i = 0; i < ARRAY_COUNT(sSaveFileSchema); i++) {
+        const struct SaveFieldSchema *field = &sSaveFileSchema[i];
+        u8 *dest8 = (u8 *) dest + field->offset;
+
+        for (e = 0; e < field->count; e++) {
+            u32 value = save_codec_get_bits(src->data, &bitPos, field->bits);
+
+            switch (field->elemSize) {
+                case 1:  ((u8 *) dest8)[e] = value;  break;
+                case 2:  ((u16 *) dest8)[e] = value; break;
+                default: ((u32 *) dest8)[e] = value; break;
+            }
+        }
+    }
+
+    add_save_block_signature(dest, sizeof(*dest), SAVE_FILE_MAGIC);
+    return TRUE;
+}
+#endif // SAVE_CODEC
+
 static void save_main_menu_data(void) {
     if (gMainMenuDataModified) {
         // Compute checksum
         add_save_block_signature(&gSaveBuffer.menuData, sizeof(gSaveBuffer.menuData), MENU_DATA_MAGIC);
 
+#ifdef SAVE_CODEC
+        // Menu data is mirrored raw into the packed device image.
+        bcopy(&gSaveBuffer.menuData, &sPackedSave.menuData, sizeof(sPackedSave.menuData));
+        commit_save_write(&sPackedSave.menuData, sizeof(sPackedSave.menuData));
+#else
         // Write to EEPROM
-        write_eeprom_data(&gSaveBuffer.menuData, sizeof(gSaveBuffer.menuData));
+        commit_save_write(&gSaveBuffer.menuData, sizeof(gSaveBuffer.menuData));
+#endif
 
         gMainMenuDataModified = FALSE;
     }
@@ -287,8 +582,14 @@ static void restore_save_file_data(s32 fileIndex, s32 srcSlot) {
           sizeof(gSaveBuffer.files[fileIndex][destSlot]));
 
     // Write destination data to EEPROM
-    write_eeprom_data(&gSaveBuffer.files[fileIndex][destSlot],
+#ifdef SAVE_CODEC
+    pack_save_file(&sPackedSave.files[fileIndex][destSlot], &gSaveBuffer.files[fileIndex][destSlot]);
+    commit_save_write(&sPackedSave.files[fileIndex][destSlot],
+                      sizeof(sPackedSave.files[fileIndex][destSlot]));
+#else
+    commit_save_write(&gSaveBuffer.files[fileIndex][destSlot],
                       sizeof(gSaveBuffer.files[fileIndex][destSlot]));
+#endif
 }
 
 void save_file_do_save(s32 fileIndex) {
@@ -302,7 +603,14 @@ void save_file_do_save(s32 fileIndex) {
               sizeof(gSaveBuffer.files[fileIndex][1]));
 
         // Write to EEPROM
-        write_eeprom_data(&gSaveBuffer.files[fileIndex], sizeof(gSaveBuffer.files[fileIndex]));
+#ifdef SAVE_CODEC
+        pack_save_file(&sPackedSave.files[fileIndex][0], &gSaveBuffer.files[fileIndex][0]);
+        bcopy(&sPackedSave.files[fileIndex][0], &sPackedSave.files[fileIndex][1],
+              sizeof(sPackedSave.files[fileIndex][1]));
+        commit_save_write(&sPackedSave.files[fileIndex], sizeof(sPackedSave.files[fileIndex]));
+#else
+        commit_save_write(&gSaveBuffer.files[fileIndex], sizeof(gSaveBuffer.files[fileIndex]));
+#endif
 
         gSaveFileModified = FALSE;
     }
@@ -319,6 +627,7 @@ void save_file_erase(s32 fileIndex) {
 }
 
 void save_file_copy(s32 srcFileIndex, s32 destFileIndex) {
+    save_file_ensure_loaded();
     touch_high_score_ages(destFileIndex);
     bcopy(&gSaveBuffer.files[srcFileIndex][0], &gSaveBuffer.files[destFileIndex][0],
           sizeof(gSaveBuffer.files[destFileIndex][0]));
@@ -327,37 +636,133 @@ void save_file_copy(s32 srcFileIndex, s32 destFileIndex) {
     save_file_do_save(destFileIndex);
 }
 
+#ifdef FAST_BOOT
+// Save files whose device reads haven't happened yet (one bit per file).
+static u8 sSaveFilesPendingLoad = 0;
+#endif
+
+/**
+ * Verify a save file already read into the device image and repair it: restore
+ * from the valid slot when only one checksum holds, erase when neither does.
+ */
+static void save_file_verify_file(s32 file) {
+    s32 validSlots;
+
+#ifdef SAVE_CODEC
+    validSlots = unpack_save_file(&gSaveBuffer.files[file][0], &sPackedSave.files[file][0]);
+    validSlots |= unpack_save_file(&gSaveBuffer.files[file][1], &sPackedSave.files[file][1]) << 1;
+#else
+    validSlots = verify_save_block_signature(&gSaveBuffer.files[file][0], sizeof(gSaveBuffer.files[file][0]), SAVE_FILE_MAGIC);
+    validSlots |= verify_save_block_signature(&gSaveBuffer.files[file][1], sizeof(gSaveBuffer.files[file][1]), SAVE_FILE_MAGIC) << 1;
+#endif
+    switch (validSlots) {
+        case 0: // Neither copy is correct
+            save_file_erase(file);
+            break;
+        case 1: // Slot 0 is correct and slot 1 is incorrect
+            restore_save_file_data(file, 0);
+            break;
+        case 2: // Slot 1 is correct and slot 0 is incorrect
+            restore_save_file_data(file, 1);
+            break;
+    }
+}
+
+#ifdef FAST_BOOT
+/**
+ * Read one save file's two slots from the device and verify them.
+ */
+static void save_file_load_pending_file(s32 file) {
+#ifdef SAVE_CODEC
+    read_eeprom_data(&sPackedSave.files[file][0], sizeof(sPackedSave.files[file]));
+#else
+    read_eeprom_data(&gSaveBuffer.files[file][0], sizeof(gSaveBuffer.files[file]));
+#endif
+    save_file_verify_file(file);
+}
+
+/**
+ * Trickle in one pending save file per frame. Called from the game loop, so
+ * the files read in during the logo/intro instead of stalling boot.
+ */
+void save_file_update_pending_loads(void) {
+    s32 file;
+
+    for (file = 0; file < NUM_SAVE_FILES; file++) {
+        if (sSaveFilesPendingLoad & (1 << file)) {
+            sSaveFilesPendingLoad &= ~(1 << file);
+            save_file_load_pending_file(file);
+            return;
+        }
+    }
+}
+
+/**
+ * Complete all pending save file reads now. Guards every accessor that touches
+ * file data, so an early access just degrades to the synchronous boot read.
+ */
+void save_file_ensure_loaded(void) {
+    s32 file;
+
+    if (sSaveFilesPendingLoad == 0) {
+        return;
+    }
+    for (file = 0; file < NUM_SAVE_FILES; file++) {
+        if (sSaveFilesPendingLoad & (1 << file)) {
+            sSaveFilesPendingLoad &= ~(1 << file);
+            save_file_load_pending_file(file);
+        }
+    }
+}
+#endif // FAST_BOOT
+
 void save_file_load_all(void) {
+#ifndef FAST_BOOT
     s32 file;
+#endif
     s32 validSlots;
 
     gMainMenuDataModified = FALSE;
     gSaveFileModified = FALSE;
 
     bzero(&gSaveBuffer, sizeof(gSaveBuffer));
+#ifdef FAST_BOOT
+    // Only pull in the main menu data before the first frame; the save files
+    // themselves trickle in via save_file_update_pending_loads.
+#ifdef SAVE_CODEC
+    bzero(&sPackedSave, sizeof(sPackedSave));
+    read_eeprom_data(&sPackedSave.menuData, sizeof(sPackedSave.menuData));
+
+    // Menu data is stored raw inside the packed image.
+    bcopy(&sPackedSave.menuData, &gSaveBuffer.menuData, sizeof(gSaveBuffer.menuData));
+#else
+    read_eeprom_data(&gSaveBuffer.menuData, sizeof(gSaveBuffer.menuData));
+#endif
+#else
+#ifdef SAVE_CODEC
+    bzero(&sPackedSave, sizeof(sPackedSave));
+    read_eeprom_data(&sPackedSave, sizeof(sPackedSave));
+
+    // Menu data is stored raw inside the packed image.
+    bcopy(&sPackedSave.menuData, &gSaveBuffer.menuData, sizeof(gSaveBuffer.menuData));
+#else
     read_eeprom_data(&gSaveBuffer, sizeof(gSaveBuffer));
+#endif
+#endif
 
     // Verify the main menu data and wipe it if invalid.
     validSlots = verify_save_block_signature(&gSaveBuffer.menuData, sizeof(gSaveBuffer.menuData), MENU_DATA_MAGIC);
     if (!validSlots)
         wipe_main_menu_data();
 
+#ifdef FAST_BOOT
+    sSaveFilesPendingLoad = (1 << NUM_SAVE_FILES) - 1;
+#else
     for (file = 0; file < NUM_SAVE_FILES; file++) {
         // Verify the save file and create a backup copy if only one of the slots is valid.
-        validSlots = verify_save_block_signature(&gSaveBuffer.files[file][0], sizeof(gSaveBuffer.files[file][0]), SAVE_FILE_MAGIC);
-        validSlots |= verify_save_block_signature(&gSaveBuffer.files[file][1], sizeof(gSaveBuffer.files[file][1]), SAVE_FILE_MAGIC) << 1;
-        switch (validSlots) {
-            case 0: // Neither copy is correct
-                save_file_erase(file);
-                break;
-            case 1: // Slot 0 is correct and slot 1 is incorrect
-                restore_save_file_data(file, 0);
-                break;
-            case 2: // Slot 1 is correct and slot 0 is incorrect
-                restore_save_file_data(file, 1);
-                break;
-        }
+        save_file_verify_file(file);
     }
+#endif
 }
 
 #ifdef PUPPYCAM
@@ -401,6 +806,7 @@ void puppycam_check_save(void) {
  * This is used after getting a game over.
  */
 void save_file_reload(void) {
+    save_file_ensure_loaded();
     // Copy save file data from backup
     bcopy(&gSaveBuffer.files[gCurrSaveFileNum - 1][1], &gSaveBuffer.files[gCurrSaveFileNum - 1][0],
           sizeof(gSaveBuffer.files[gCurrSaveFileNum - 1][0]));
@@ -414,6 +820,7 @@ void save_file_reload(void) {
  * If coin score is greater than the current high score, update it.
  */
 void save_file_collect_star_or_key(s16 coinScore, s16 starIndex) {
+    save_file_ensure_loaded();
     s32 fileIndex = gCurrSaveFileNum - 1;
     s32 courseIndex = COURSE_NUM_TO_INDEX(gCurrCourseNum);
 #ifdef GLOBAL_STAR_IDS
@@ -477,6 +884,7 @@ void save_file_collect_star_or_key(s16 coinScore, s16 starIndex) {
 }
 
 s32 save_file_exists(s32 fileIndex) {
+    save_file_ensure_loaded();
     return (gSaveBuffer.files[fileIndex][0].flags & SAVE_FLAG_FILE_EXISTS) != 0;
 }
 
@@ -486,6 +894,7 @@ s32 save_file_exists(s32 fileIndex) {
  * of the save file with this score.
  */
 u32 save_file_get_max_coin_score(s32 courseIndex) {
+    save_file_ensure_loaded();
     s32 fileIndex;
     s32 maxCoinScore = -1;
     s32 maxScoreAge = -1;
@@ -508,10 +917,12 @@ u32 save_file_get_max_coin_score(s32 courseIndex) {
 
 #ifdef COMPLETE_SAVE_FILE
 s32 save_file_get_course_star_count(UNUSED s32 fileIndex, UNUSED s32 courseIndex) {
+    save_file_ensure_loaded();
     return 7;
 }
 #else
 s32 save_file_get_course_star_count(s32 fileIndex, s32 courseIndex) {
+    save_file_ensure_loaded();
     s32 i;
     s32 count = 0;
     u8 flag = 1;
@@ -527,6 +938,7 @@ s32 save_file_get_course_star_count(s32 fileIndex, s32 courseIndex) {
 #endif
 
 s32 save_file_get_total_star_count(s32 fileIndex, s32 minCourse, s32 maxCourse) {
+    save_file_ensure_loaded();
     s32 count = 0;
 
     // Get standard course star count.
@@ -539,17 +951,20 @@ s32 save_file_get_total_star_count(s32 fileIndex, s32 minCourse, s32 maxCourse)
 }
 
 void save_file_set_flags(u32 flags) {
+    save_file_ensure_loaded();
     gSaveBuffer.files[gCurrSaveFileNum - 1][0].flags |= (flags | SAVE_FLAG_FILE_EXISTS);
     gSaveFileModified = TRUE;
 }
 
 void save_file_clear_flags(u32 flags) {
+    save_file_ensure_loaded();
     gSaveBuffer.files[gCurrSaveFileNum - 1][0].flags &= ~flags;
     gSaveBuffer.files[gCurrSaveFileNum - 1][0].flags |= SAVE_FLAG_FILE_EXISTS;
     gSaveFileModified = TRUE;
 }
 
 u32 save_file_get_flags(void) {
+    save_file_ensure_loaded();
 #ifdef COMPLETE_SAVE_FILE
     return (SAVE_FLAG_FILE_EXISTS            |
             SAVE_FLAG_HAVE_WING_CAP          |
@@ -585,10 +1000,12 @@ u32 save_file_get_flags(void) {
  */
 #ifdef COMPLETE_SAVE_FILE
 u32 save_file_get_star_flags(UNUSED s32 fileIndex, UNUSED s32 courseIndex) {
+    save_file_ensure_loaded();
     return 0x7F;
 }
 #else
 u32 save_file_get_star_flags(s32 fileIndex, s32 courseIndex) {
+    save_file_ensure_loaded();
     u32 starFlags;
 
     if (courseIndex == COURSE_NUM_TO_INDEX(COURSE_NONE)) {
@@ -606,6 +1023,7 @@ u32 save_file_get_star_flags(s32 fileIndex, s32 courseIndex) {
  * If course is COURSE_NONE, add to the bitset of obtained castle secret stars.
  */
 void save_file_set_star_flags(s32 fileIndex, s32 courseIndex, u32 starFlags) {
+    save_file_ensure_loaded();
     if (courseIndex == COURSE_NUM_TO_INDEX(COURSE_NONE)) {
         gSaveBuffer.files[fileIndex][0].flags |= STAR_FLAG_TO_SAVE_FLAG(starFlags);
     } else {
@@ -618,10 +1036,12 @@ void save_file_set_star_flags(s32 fileIndex, s32 courseIndex, u32 starFlags) {
 
 #ifdef COMPLETE_SAVE_FILE
 s32 save_file_get_course_coin_score(UNUSED s32 fileIndex, UNUSED s32 courseIndex) {
+    save_file_ensure_loaded();
     return MAX_NUM_COINS;
 }
 #else
 s32 save_file_get_course_coin_score(s32 fileIndex, s32 courseIndex) {
+    save_file_ensure_loaded();
     return gSaveBuffer.files[fileIndex][0].courseCoinScores[courseIndex];
 }
 #endif
@@ -630,6 +1050,7 @@ s32 save_file_get_course_coin_score(s32 fileIndex, s32 courseIndex) {
  * Return TRUE if the cannon is unlocked in the current course.
  */
 s32 save_file_is_cannon_unlocked(void) {
+    save_file_ensure_loaded();
 #ifdef UNLOCK_ALL
     return TRUE;
 #else
@@ -641,12 +1062,14 @@ s32 save_file_is_cannon_unlocked(void) {
  * Sets the cannon status to unlocked in the current course.
  */
 void save_file_set_cannon_unlocked(void) {
+    save_file_ensure_loaded();
     gSaveBuffer.files[gCurrSaveFileNum - 1][0].courseStars[gCurrCourseNum] |= COURSE_FLAG_CANNON_UNLOCKED;
     gSaveBuffer.files[gCurrSaveFileNum - 1][0].flags |= SAVE_FLAG_FILE_EXISTS;
     gSaveFileModified = TRUE;
 }
 
 void save_file_set_cap_pos(s16 x, s16 y, s16 z) {
+    save_file_ensure_loaded();
     struct SaveFile *saveFile = &gSaveBuffer.files[gCurrSaveFileNum - 1][0];
 
     saveFile->capLevel = gCurrLevelNum;
@@ -660,6 +1083,7 @@ void save_file_set_cap_pos(s16 x, s16 y, s16 z) {
 }
 
 s32 save_file_get_cap_pos(Vec3s capPos) {
+    save_file_ensure_loaded();
     struct SaveFile *saveFile = &gSaveBuffer.files[gCurrSaveFileNum - 1][0];
     s32 flags = save_file_get_flags();
 
@@ -677,6 +1101,7 @@ s32 save_file_get_cap_pos(Vec3s capPos) {
 
 #ifdef SAVE_NUM_LIVES
 void save_file_set_num_lives(s8 numLives) {
+    save_file_ensure_loaded();
     struct SaveFile *saveFile = &gSaveBuffer.files[gCurrSaveFileNum - 1][0];
     saveFile->numLives = numLives;
     saveFile->flags |= SAVE_FLAG_FILE_EXISTS;
@@ -684,6 +1109,7 @@ void save_file_set_num_lives(s8 numLives) {
 }
 
 s32 save_file_get_num_lives(void) {
+    save_file_ensure_loaded();
     struct SaveFile *saveFile = &gSaveBuffer.files[gCurrSaveFileNum - 1][0];
     return saveFile->numLives;
 }
@@ -715,6 +1141,7 @@ u32 save_file_get_sound_mode(void) {
 }
 
 void save_file_move_cap_to_default_location(void) {
+    save_file_ensure_loaded();
     if (save_file_get_flags() & SAVE_FLAG_CAP_ON_GROUND) {
         switch (gSaveBuffer.files[gCurrSaveFileNum - 1][0].capLevel) {
             case LEVEL_SSL:
@@ -172,7 +172,21 @@ extern s8 gSaveFileModified;
 
 void save_file_do_save(s32 fileIndex);
 void save_file_erase(s32 fileIndex);
+#ifdef DEFERRED_SAVE_WRITES
+void save_file_update_queued_writes(void);
+void save_file_flush_writes(void);
+#else
+#define save_file_update_queued_writes()
+#define save_file_flush_writes()
+#endif
 void save_file_copy(s32 srcFileIndex, s32 destFileIndex);
+#ifdef FAST_BOOT
+void save_file_update_pending_loads(void);
+void save_file_ensure_loaded(void);
+#else
+#define save_file_update_pending_loads()
+#define save_file_ensure_loaded()
+#endif
 void save_file_load_all(void);
 void save_file_reload(void);
 void save_file_collect_star_or_key(s16 coinScore, s16 starIndex);
@@ -16,6 +16,51 @@
 u8 sTransitionColorFadeCount[4] = { 0 };
 u16 sTransitionTextureFadeCount[2] = { 0 };
 
+#ifdef SCREEN_EFFECT_REGIONS
+/**
+ * Set up fill mode for the solid-color part of a screen effect. Bands drawn
+ * between begin/end run at 4 pixels per cycle with no blender read, instead
+ * of going through the shaded triangle path.
+ */
+void screen_effect_fill_begin(u8 red, u8 green, u8 blue) {
+    u16 color = GPACK_RGBA5551(red, green, blue, 1);
+
+    gDPPipeSync(gDisplayListHead++);
+    gDPSetRenderMode(gDisplayListHead++, G_RM_OPA_SURF, G_RM_OPA_SURF2);
+    gDPSetCycleType(gDisplayListHead++, G_CYC_FILL);
+    gDPSetFillColor(gDisplayListHead++, (color << 16) | color);
+}
+
+/**
+ * Fill a solid band in framebuffer coordinates. Degenerate bands (fully
+ * clipped away) are skipped.
+ */
+void screen_effect_fill_band(s32 ulx, s32 uly, s32 lrx, s32 lry) {
+    if (ulx > lrx || uly > lry) {
+        return;
+    }
+    gDPFillRectangle(gDisplayListHead++, ulx, ADAPTIVE_RES_Y(uly), lrx, ADAPTIVE_RES_Y(lry));
+}
+
+void screen_effect_fill_end(void) {
+    gDPPipeSync(gDisplayListHead++);
+    gDPSetCycleType(gDisplayListHead++, G_CYC_1CYCLE);
+}
+
+/**
+ * Scissor the following passes to an effect's bounding box, given in the
+ * bottom-up geometry space the fullscreen ortho matrix uses.
+ */
+static void screen_effect_scissor_box(s32 ulx, s32 uly, s32 lrx, s32 lry) {
+    gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, ulx, ADAPTIVE_RES_Y(SCREEN_HEIGHT - lry),
+                  lrx, ADAPTIVE_RES_Y(SCREEN_HEIGHT - uly));
+}
+
+static void screen_effect_scissor_reset(void) {
+    gDPSetScissor(gDisplayListHead++, G_SC_NON_INTERLACE, 0, 0, SCREEN_WIDTH, ADAPTIVE_RES_Y(SCREEN_HEIGHT));
+}
+#endif // SCREEN_EFFECT_REGIONS
+
 s32 set_and_reset_transition_fade_timer(s8 fadeTimer, u8 transTime) {
     s32 reset = FALSE;
 
@@ -59,7 +104,24 @@ Vtx *vertex_transition_color(struct WarpTransitionData *transData, u8 alpha) {
 }
 
 s32 dl_transition_color(s8 fadeTimer, u8 transTime, struct WarpTransitionData *transData, u8 alpha) {
-    Vtx *verts = vertex_transition_color(transData, alpha);
+    Vtx *verts;
+
+#ifdef SCREEN_EFFECT_REGIONS
+    // The edge frames don't need the blended full-screen quad: at alpha 0 it
+    // changes nothing, and at alpha 255 a fill rectangle covers it outright.
+    if (alpha == 0) {
+        return set_and_reset_transition_fade_timer(fadeTimer, transTime);
+    }
+    if (alpha == 255) {
+        screen_effect_fill_begin(transData->red, transData->green, transData->blue);
+        screen_effect_fill_band(GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0), 0,
+                                GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1, SCREEN_HEIGHT - 1);
+        screen_effect_fill_end();
+        return set_and_reset_transition_fade_timer(fadeTimer, transTime);
+    }
+#endif
+
+    verts = vertex_transition_color(transData, alpha);
 
     if (verts != NULL) {
         gSPDisplayList(gDisplayListHead++, dl_proj_mtx_fullscreen);
@@ -172,9 +234,31 @@ s32 render_textured_transition(s8 fadeTimer, s8 transTime, struct WarpTransition
     s16 centerTransY = center_tex_transition_y(transData, texTransTime, texTransPos);
     s16 texTransRadius = calc_tex_transition_radius(fadeTimer, transTime, transData);
     Vtx *verts = alloc_display_list(8 * sizeof(*verts));
+#ifdef SCREEN_EFFECT_REGIONS
+    // Bounding box of the rotating wipe quad (radius * sqrt(2) covers any
+    // rotation), in the ortho matrix's bottom-up space.
+    s32 ext = (s32)(texTransRadius * 1.4143f) + 2;
+    s32 minX = GFX_DIMENSIONS_RECT_FROM_LEFT_EDGE(0);
+    s32 maxX = GFX_DIMENSIONS_RECT_FROM_RIGHT_EDGE(0) - 1;
+    s32 boxX0 = CLAMP(centerTransX - ext, minX, maxX);
+    s32 boxX1 = CLAMP(centerTransX + ext, minX, maxX);
+    s32 boxY0 = CLAMP(centerTransY - ext, 0, SCREEN_HEIGHT - 1);
+    s32 boxY1 = CLAMP(centerTransY + ext, 0, SCREEN_HEIGHT - 1);
+#endif
 
     if (verts != NULL) {
         load_tex_transition_vertex(verts, fadeTimer, transData, centerTransX, centerTransY, texTransRadius, transTexType);
+#ifdef SCREEN_EFFECT_REGIONS
+        // Everything outside the box is solid transition color: cover it with
+        // fill bands and scissor the blended passes down to the box itself.
+        screen_effect_fill_begin(transData->red, transData->green, transData->blue);
+        screen_effect_fill_band(minX, 0, maxX, SCREEN_HEIGHT - 2 - boxY1);
+        screen_effect_fill_band(minX, SCREEN_HEIGHT - boxY0, maxX, SCREEN_HEIGHT - 1);
+        screen_effect_fill_band(minX, SCREEN_HEIGHT - 1 - boxY1, boxX0 - 1, SCREEN_HEIGHT - 1 - boxY0);
+        screen_effect_fill_band(boxX1 + 1, SCREEN_HEIGHT - 1 - boxY1, maxX, SCREEN_HEIGHT - 1 - boxY0);
+        screen_effect_fill_end();
+        screen_effect_scissor_box(boxX0, boxY0, boxX1 + 1, boxY1 + 1);
+#endif
         gSPDisplayList(gDisplayListHead++, dl_proj_mtx_fullscreen);
         gDPSetCombineMode(gDisplayListHead++, G_CC_SHADE, G_CC_SHADE);
         gDPSetRenderMode(gDisplayListHead++, G_RM_AA_OPA_SURF, G_RM_AA_OPA_SURF2);
@@ -199,6 +283,9 @@ s32 render_textured_transition(s8 fadeTimer, s8 transTime, struct WarpTransition
         gSPDisplayList(gDisplayListHead++, dl_draw_quad_verts_0123);
         gSPTexture(gDisplayListHead++, 0xFFFF, 0xFFFF, 0, G_TX_RENDERTILE, G_OFF);
         gSPDisplayList(gDisplayListHead++, dl_screen_transition_end);
+#ifdef SCREEN_EFFECT_REGIONS
+        screen_effect_scissor_reset();
+#endif
         sTransitionTextureFadeCount[fadeTimer] += transData->texTimer;
     }
     return set_and_reset_transition_fade_timer(fadeTimer, transTime);
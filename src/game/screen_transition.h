@@ -24,6 +24,11 @@ enum ColorTransitionFade {
     COLOR_TRANS_FADE_FROM_COLOR,
 };
 
+#ifdef SCREEN_EFFECT_REGIONS
+void screen_effect_fill_begin(u8 red, u8 green, u8 blue);
+void screen_effect_fill_band(s32 ulx, s32 uly, s32 lrx, s32 lry);
+void screen_effect_fill_end(void);
+#endif
 s32 render_screen_transition(s8 fadeTimer, s8 transType, u8 transTime, struct WarpTransitionData *transData);
 Gfx *geo_cannon_circle_base(s32 callContext, struct GraphNode *node, UNUSED Mat4 mtx);
 
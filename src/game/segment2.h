@@ -31,6 +31,10 @@ extern Gfx dl_shadow_circle[];
 extern Gfx dl_shadow_square[];
 extern Gfx dl_shadow_4_verts[];
 extern Gfx dl_shadow_end[];
+#ifdef SHADOW_BATCHING
+extern Gfx dl_shadow_quad[];
+extern Gfx dl_shadow_batch_end[];
+#endif
 extern Gfx dl_skybox_begin[];
 extern Gfx dl_skybox_tile_tex_settings[];
 extern Gfx dl_skybox_end[];
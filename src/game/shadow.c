@@ -13,6 +13,9 @@
 #include "segment2.h"
 #include "shadow.h"
 #include "sm64.h"
+#ifdef SHADOW_BATCHING
+#include "game_init.h"
+#endif
 
 /**
  * @file shadow.c
@@ -30,6 +33,30 @@ static ShadowRectangle sShadowRectangles[2] = {
 struct Shadow gCurrShadow;
 struct Shadow *s = &gCurrShadow;
 
+#ifdef SHADOW_BATCHING
+/**
+ * One decal shadow queued for the frame's batch. The transform lives in the
+ * display list pool, so only the pointer is kept here.
+ */
+struct ShadowBatchEntry {
+    Mtx *transform;
+    f32 distSq;    // squared distance to the camera, for quota dropping
+    u8 solidity;
+    u8 isCircle;
+};
+
+static struct ShadowBatchEntry sShadowBatch[SHADOW_BATCH_QUOTA];
+static s16 sShadowBatchCount = 0;
+static u16 sShadowBatchFrame = 0;
+#endif
+
+// The last shadow display list built this frame and the parameters it encodes,
+// shared between all shadows that would generate identical commands.
+static Gfx *sSharedShadowDl = NULL;
+static u16 sSharedShadowFrame = 0;
+static u8 sSharedShadowSolidity = 0;
+static s8 sSharedShadowType = 0;
+
 /**
  * Shrink a shadow when its parent object is further from the floor, given the
  * initial size of the shadow and the current distance.
@@ -215,7 +242,13 @@ Gfx *create_shadow_below_xyz(Vec3f pos, s16 shadowScale, u8 shadowSolidity, s8 s
     } else {
         // The object has no referenced floor, so find a new one.
         // gCollisionFlags |= COLLISION_FLAG_RETURN_FIRST;
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+        // Route through the object's floor cache, so objects whose behaviors never
+        // query the floor don't pay for a full find_floor every rendered frame.
+        floorHeight = find_object_floor(obj, x, y, z, &floor);
+#else
         floorHeight = find_floor(x, y, z, &floor);
+#endif
 
         // No shadow if the position is OOB.
         if (floor == NULL) {
@@ -353,6 +386,28 @@ Gfx *create_shadow_below_xyz(Vec3f pos, s16 shadowScale, u8 shadowSolidity, s8 s
         }
     }
 
+#ifdef SHADOW_BATCHING
+    if (s->isDecal) {
+        // Decal shadows draw through the frame's shadow batch, which emits the
+        // setup and teardown itself; there is no per-shadow display list to
+        // build. Return the bare quad so the caller knows the shadow is live.
+        pos[1] = floorHeight;
+        return dl_shadow_quad;
+    }
+#endif
+
+    // Identical shadows share one display list per frame: the generated commands
+    // depend only on the type and solidity (scale and position are applied through
+    // the matrix stack), so a crowd of grounded enemies builds the solidity wrapper
+    // once and every later shadow reuses it.
+    if (sSharedShadowDl != NULL
+        && sSharedShadowFrame == gAreaUpdateCounter
+        && sSharedShadowType == shadowType
+        && sSharedShadowSolidity == s->solidity) {
+        pos[1] = floorHeight;
+        return sSharedShadowDl;
+    }
+
     Gfx *displayList = alloc_display_list(4 * sizeof(Gfx));
 
     if (displayList == NULL) {
@@ -362,8 +417,93 @@ Gfx *create_shadow_below_xyz(Vec3f pos, s16 shadowScale, u8 shadowSolidity, s8 s
     // Generate the shadow display list with type and solidity.
     add_shadow_to_display_list(displayList, shadowType);
 
+    sSharedShadowDl       = displayList;
+    sSharedShadowFrame    = gAreaUpdateCounter;
+    sSharedShadowType     = shadowType;
+    sSharedShadowSolidity = s->solidity;
+
     // Move the shadow position to the floor height.
     pos[1] = floorHeight;
 
     return displayList;
 }
+
+#ifdef SHADOW_BATCHING
+/**
+ * Queue a decal shadow for this frame's batch. When the quota is full, the
+ * entry farthest from the camera is dropped, so dense frames shed the shadows
+ * nobody can see clearly instead of arbitrary ones.
+ */
+void shadow_batch_add(Mtx *transform, s8 shadowType, Vec3f shadowPos) {
+    if (sShadowBatchFrame != gAreaUpdateCounter) {
+        sShadowBatchFrame = gAreaUpdateCounter;
+        sShadowBatchCount = 0;
+    }
+
+    f32 dx = shadowPos[0] - gCurGraphNodeCamera->pos[0];
+    f32 dy = shadowPos[1] - gCurGraphNodeCamera->pos[1];
+    f32 dz = shadowPos[2] - gCurGraphNodeCamera->pos[2];
+    f32 distSq = sqr(dx) + sqr(dy) + sqr(dz);
+
+    struct ShadowBatchEntry *entry;
+    if (sShadowBatchCount < SHADOW_BATCH_QUOTA) {
+        entry = &sShadowBatch[sShadowBatchCount++];
+    } else {
+        // Over quota: replace the farthest queued shadow, if this one is nearer.
+        entry = &sShadowBatch[0];
+        for (s16 i = 1; i < SHADOW_BATCH_QUOTA; i++) {
+            if (sShadowBatch[i].distSq > entry->distSq) {
+                entry = &sShadowBatch[i];
+            }
+        }
+        if (distSq >= entry->distSq) {
+            return;
+        }
+    }
+
+    entry->transform = transform;
+    entry->distSq    = distSq;
+    entry->solidity  = s->solidity;
+    entry->isCircle  = (shadowType == SHADOW_CIRCLE);
+}
+
+/**
+ * Emit every queued shadow contiguously into the current display list. Called
+ * from the master list at the start of LAYER_TRANSPARENT_DECAL, so the whole
+ * batch shares that layer's render mode: one texture load per shadow texture,
+ * an env color write only when the solidity changes, and one pipeline teardown
+ * for the lot - instead of the full setup/teardown around every single quad.
+ */
+void shadow_batch_flush(void) {
+    if (sShadowBatchFrame != gAreaUpdateCounter || sShadowBatchCount == 0) {
+        return;
+    }
+
+    // One pass per texture: circles first, then squares (and rectangles).
+    for (s32 isCircle = TRUE; isCircle >= FALSE; isCircle--) {
+        s32 lastSolidity = -1;
+        for (s16 i = 0; i < sShadowBatchCount; i++) {
+            struct ShadowBatchEntry *entry = &sShadowBatch[i];
+            if (entry->isCircle != isCircle) {
+                continue;
+            }
+            if (lastSolidity == -1) {
+                gSPDisplayList(gDisplayListHead++,
+                               isCircle ? dl_shadow_circle : dl_shadow_square);
+            } else if (entry->solidity != lastSolidity) {
+                gDPPipeSync(gDisplayListHead++);
+            }
+            if (entry->solidity != lastSolidity) {
+                gDPSetEnvColor(gDisplayListHead++, 255, 255, 255, entry->solidity);
+                lastSolidity = entry->solidity;
+            }
+            gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(entry->transform),
+                      (G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH));
+            gSPDisplayList(gDisplayListHead++, dl_shadow_quad);
+        }
+    }
+
+    gSPDisplayList(gDisplayListHead++, dl_shadow_batch_end);
+    sShadowBatchCount = 0;
+}
+#endif
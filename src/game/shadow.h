@@ -102,4 +102,9 @@ extern struct Shadow gCurrShadow;
  */
 Gfx *create_shadow_below_xyz(Vec3f pos, s16 shadowScale, u8 shadowSolidity, s8 shadowType, s8 shifted);
 
+#ifdef SHADOW_BATCHING
+void shadow_batch_add(Mtx *transform, s8 shadowType, Vec3f shadowPos);
+void shadow_batch_flush(void);
+#endif
+
 #endif // SHADOW_H
@@ -2,6 +2,7 @@
 
 #include "area.h"
 #include "engine/math_util.h"
+#include "game_init.h"
 #include "geo_misc.h"
 #include "gfx_dimensions.h"
 #include "level_update.h"
@@ -232,6 +233,75 @@ void draw_skybox_tile_grid(Gfx **dlist, s8 background, s8 player, s8 colorIndex)
     }
 }
 
+#ifdef SKYBOX_RETAINED_GRID
+
+/**
+ * Number of tiles in the drawn 3x3 grid (scaled for SKYBOX_SIZE).
+ */
+#define SKYBOX_GRID_TILES (9 * sqr(SKYBOX_SIZE))
+
+/**
+ * Retained tile grid display lists and their vertices. The grid's vertex
+ * positions and textures depend only on the upper-left tile index, the skybox
+ * image and the color mask, so it only changes when the camera crosses a
+ * 45 degree tile boundary; sub-tile scrolling is entirely in the ortho
+ * matrix. Two buffers alternate by frame parity so a rebuild never writes
+ * the copy the RCP may still be reading.
+ */
+static Gfx sSkyboxGridGfx[2][SKYBOX_GRID_TILES * 7 + 1];
+static Vtx sSkyboxGridVtx[2][SKYBOX_GRID_TILES * 4];
+/// Cache keys per buffer side; texList also invalidates on segment reload
+static s32 sSkyboxGridTile[2] = { -1, -1 };
+static s8 sSkyboxGridColor[2] = { -1, -1 };
+static SkyboxTexture *sSkyboxGridTexList[2] = { NULL, NULL };
+
+/**
+ * Rebuild one retained grid buffer for the current upper-left tile. Same
+ * output as draw_skybox_tile_grid plus a terminating end command, but the
+ * vertices go into the static buffer instead of the frame pool.
+ */
+static void build_skybox_tile_grid(s32 side, SkyboxTexture *texList, s8 player, s8 colorIndex) {
+    Gfx *dlist = sSkyboxGridGfx[side];
+    Vtx *verts = sSkyboxGridVtx[side];
+    s32 row;
+    s32 col;
+
+    for (row = 0; row < (3 * SKYBOX_SIZE); row++) {
+        for (col = 0; col < (3 * SKYBOX_SIZE); col++) {
+            s32 tileIndex = sSkyBoxInfo[player].upperLeftTile + row * SKYBOX_COLS + col;
+            if (tileIndex >= SKYBOX_ROWS * SKYBOX_COLS) {
+                continue;
+            }
+
+            s16 x = tileIndex % SKYBOX_COLS * SKYBOX_TILE_WIDTH;
+            s16 y = SKYBOX_HEIGHT - tileIndex / SKYBOX_COLS * SKYBOX_TILE_HEIGHT;
+
+            make_vertex(verts, 0, x, y, -1, 0, 0, sSkyboxColors[colorIndex][0],
+                        sSkyboxColors[colorIndex][1], sSkyboxColors[colorIndex][2], 255);
+            make_vertex(verts, 1, x, y - SKYBOX_TILE_HEIGHT, -1, 0, 31 << 5, sSkyboxColors[colorIndex][0],
+                        sSkyboxColors[colorIndex][1], sSkyboxColors[colorIndex][2], 255);
+            make_vertex(verts, 2, x + SKYBOX_TILE_WIDTH, y - SKYBOX_TILE_HEIGHT, -1, 31 << 5, 31 << 5,
+                        sSkyboxColors[colorIndex][0], sSkyboxColors[colorIndex][1],
+                        sSkyboxColors[colorIndex][2], 255);
+            make_vertex(verts, 3, x + SKYBOX_TILE_WIDTH, y, -1, 31 << 5, 0, sSkyboxColors[colorIndex][0],
+                        sSkyboxColors[colorIndex][1], sSkyboxColors[colorIndex][2], 255);
+
+            gLoadBlockTexture(dlist++, 32, 32, G_IM_FMT_RGBA, (*texList)[tileIndex]);
+            gSPVertex(dlist++, VIRTUAL_TO_PHYSICAL(verts), 4, 0);
+            gSPDisplayList(dlist++, dl_draw_quad_verts_0123);
+
+            verts += 4;
+        }
+    }
+    gSPEndDisplayList(dlist);
+
+    sSkyboxGridTile[side] = sSkyBoxInfo[player].upperLeftTile;
+    sSkyboxGridColor[side] = colorIndex;
+    sSkyboxGridTexList[side] = texList;
+}
+
+#endif // SKYBOX_RETAINED_GRID
+
 void *create_skybox_ortho_matrix(s8 player) {
     f32 left = sSkyBoxInfo[player].scaledX;
     f32 right = sSkyBoxInfo[player].scaledX + SCREEN_WIDTH;
@@ -260,6 +330,31 @@ void *create_skybox_ortho_matrix(s8 player) {
  * Creates the skybox's display list, then draws the 3x3 grid of tiles.
  */
 Gfx *init_skybox_display_list(s8 player, s8 background, s8 colorIndex) {
+#ifdef SKYBOX_RETAINED_GRID
+    s32 side = gGlobalTimer & 1;
+    SkyboxTexture *texList = segmented_to_virtual(sSkyboxTextures[background]);
+    void *skybox = alloc_display_list(6 * sizeof(Gfx));
+    Gfx *dlist = skybox;
+
+    if (skybox == NULL) {
+        return NULL;
+    } else {
+        Mtx *ortho = create_skybox_ortho_matrix(player);
+
+        if (sSkyboxGridTile[side] != sSkyBoxInfo[player].upperLeftTile
+            || sSkyboxGridColor[side] != colorIndex || sSkyboxGridTexList[side] != texList) {
+            build_skybox_tile_grid(side, texList, player, colorIndex);
+        }
+
+        gSPDisplayList(dlist++, dl_skybox_begin);
+        gSPMatrix(dlist++, VIRTUAL_TO_PHYSICAL(ortho), G_MTX_PROJECTION | G_MTX_MUL | G_MTX_NOPUSH);
+        gSPDisplayList(dlist++, dl_skybox_tile_tex_settings);
+        gSPDisplayList(dlist++, sSkyboxGridGfx[side]);
+        gSPDisplayList(dlist++, dl_skybox_end);
+        gSPEndDisplayList(dlist);
+    }
+    return skybox;
+#else
     s32 dlCommandCount = 5 + (3 * 3) * 7; // 5 for the start and end, plus 9 skybox tiles
     void *skybox = alloc_display_list(dlCommandCount * sizeof(Gfx) * sqr(SKYBOX_SIZE));
     Gfx *dlist = skybox;
@@ -277,6 +372,7 @@ Gfx *init_skybox_display_list(s8 player, s8 background, s8 colorIndex) {
         gSPEndDisplayList(dlist);
     }
     return skybox;
+#endif
 }
 
 /**
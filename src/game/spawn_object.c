@@ -1,19 +1,156 @@
 #include <PR/ultratypes.h>
 
 #include "audio/external.h"
+#include "engine/behavior_script.h"
 #include "engine/geo_layout.h"
 #include "engine/graph_node.h"
 #include "engine/math_util.h"
 #include "engine/surface_collision.h"
+#include "engine/surface_load.h"
 #include "level_table.h"
+#include "object_collision.h"
 #include "object_constants.h"
 #include "object_fields.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
+#include "rendering_graph_node.h"
 #include "spawn_object.h"
 #include "types.h"
 #include "puppylights.h"
 
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+STATIC_ASSERT(OBJECT_POOL_CAPACITY <= 256, "gObjectListSlots stores pool slots as u8.");
+
+u8 gObjectListSlots[NUM_OBJ_LISTS][OBJECT_POOL_CAPACITY];
+u16 gObjectListSlotCount[NUM_OBJ_LISTS];
+s16 gObjectListWalkList = -1;
+s16 gObjectListWalkPos = 0;
+
+/**
+ * Append an object to the end of its list's slot array, mirroring the list
+ * insertion in try_allocate_object.
+ */
+static void obj_list_compact_insert(struct ObjectNode *destList, struct Object *obj) {
+    s32 listIndex = destList - gObjectLists;
+
+    obj->compactListIndex = listIndex;
+    obj->compactListPos = gObjectListSlotCount[listIndex];
+    gObjectListSlots[listIndex][gObjectListSlotCount[listIndex]++] = obj - gObjectPool;
+}
+
+/**
+ * Remove an object from its list's slot array, shifting the entries behind it
+ * down so insertion order is preserved. If that list is being walked and the
+ * removal happened at or before the cursor, the cursor moves back with it.
+ */
+static void obj_list_compact_remove(struct Object *obj) {
+    s32 listIndex = obj->compactListIndex;
+    s32 pos = obj->compactListPos;
+    s32 count = --gObjectListSlotCount[listIndex];
+    s32 i;
+
+    for (i = pos; i < count; i++) {
+        u8 slot = gObjectListSlots[listIndex][i + 1];
+
+        gObjectListSlots[listIndex][i] = slot;
+        gObjectPool[slot].compactListPos = i;
+    }
+    if (listIndex == gObjectListWalkList && pos <= gObjectListWalkPos) {
+        gObjectListWalkPos--;
+    }
+}
+#endif
+
+#ifdef OBJECT_POOL_BITMAP
+#define OBJECT_POOL_NUM_WORDS ((OBJECT_POOL_CAPACITY + 31) / 32)
+
+// One bit per pool slot, set while the slot is free.
+static u32 sObjectFreeBitmap[OBJECT_POOL_NUM_WORDS];
+static s16 sObjectFreeCount;
+
+/**
+ * Attempt to allocate the lowest-index free slot in the pool and append it to
+ * the end of destList (doubly linked). Keeping allocations packed at the start
+ * of the pool keeps the active objects' cache lines close together. Return the
+ * object, or NULL if the pool is full.
+ */
+struct Object *try_allocate_object(struct ObjectNode *destList, UNUSED struct ObjectNode *freeList) {
+    struct ObjectNode *nextObj = NULL;
+    s32 i;
+
+    for (i = 0; i < OBJECT_POOL_NUM_WORDS; i++) {
+        if (sObjectFreeBitmap[i] != 0) {
+            s32 slot = (i * 32) + __builtin_ctz(sObjectFreeBitmap[i]);
+
+            sObjectFreeBitmap[i] &= ~(1 << (slot & 31));
+            sObjectFreeCount--;
+            nextObj = &gObjectPool[slot].header;
+            break;
+        }
+    }
+
+    if (nextObj == NULL) {
+        return NULL;
+    }
+
+    // Insert at end of destination list
+    nextObj->prev = destList->prev;
+    nextObj->next = destList;
+    destList->prev->next = nextObj;
+    destList->prev = nextObj;
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    obj_list_compact_insert(destList, (struct Object *) nextObj);
+#endif
+
+    geo_remove_child(&nextObj->gfx.node);
+    geo_add_child(&gObjParentGraphNode, &nextObj->gfx.node);
+
+    return (struct Object *) nextObj;
+}
+
+/**
+ * Remove the given object from the object list that it's currently in, and
+ * mark its pool slot as free. Bumping the generation lets anyone still holding
+ * a pointer to this object detect that the slot was recycled.
+ */
+static void deallocate_object(UNUSED struct ObjectNode *freeList, struct ObjectNode *obj) {
+    s32 slot = (struct Object *) obj - gObjectPool;
+
+    // Remove from object list
+    obj->next->prev = obj->prev;
+    obj->prev->next = obj->next;
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    obj_list_compact_remove((struct Object *) obj);
+#endif
+
+    ((struct Object *) obj)->generation++;
+    sObjectFreeBitmap[slot / 32] |= (1 << (slot & 31));
+    sObjectFreeCount++;
+}
+
+/**
+ * Mark every slot in the pool as free.
+ */
+void init_free_object_list(void) {
+    s32 i;
+
+    for (i = 0; i < OBJECT_POOL_NUM_WORDS; i++) {
+        sObjectFreeBitmap[i] = 0xFFFFFFFF;
+    }
+    // Mask off the bits past the end of the pool, if capacity isn't a multiple of 32.
+    if (OBJECT_POOL_CAPACITY & 31) {
+        sObjectFreeBitmap[OBJECT_POOL_NUM_WORDS - 1] = (1 << (OBJECT_POOL_CAPACITY & 31)) - 1;
+    }
+    sObjectFreeCount = OBJECT_POOL_CAPACITY;
+}
+
+/**
+ * Return whether the pool has at least one free slot.
+ */
+s32 obj_pool_has_free_slot(void) {
+    return sObjectFreeCount > 0;
+}
+#else
 /**
  * Attempt to allocate an object from freeList (singly linked) and append it
  * to the end of destList (doubly linked). Return the object, or NULL if
@@ -31,6 +168,9 @@ struct Object *try_allocate_object(struct ObjectNode *destList, struct ObjectNod
         nextObj->next = destList;
         destList->prev->next = nextObj;
         destList->prev = nextObj;
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+        obj_list_compact_insert(destList, (struct Object *) nextObj);
+#endif
     } else {
         return NULL;
     }
@@ -49,6 +189,9 @@ static void deallocate_object(struct ObjectNode *freeList, struct ObjectNode *ob
     // Remove from object list
     obj->next->prev = obj->prev;
     obj->prev->next = obj->next;
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    obj_list_compact_remove((struct Object *) obj);
+#endif
 
     // Insert at beginning of free list
     obj->next = freeList->next;
@@ -76,6 +219,14 @@ void init_free_object_list(void) {
     obj->header.next = NULL;
 }
 
+/**
+ * Return whether the pool has at least one free slot.
+ */
+s32 obj_pool_has_free_slot(void) {
+    return gFreeObjectList.next != NULL;
+}
+#endif
+
 /**
  * Clear each object list, without adding the objects back to the free list.
  */
@@ -85,13 +236,28 @@ void clear_object_lists(struct ObjectNode *objLists) {
     for (i = 0; i < NUM_OBJ_LISTS; i++) {
         objLists[i].next = &objLists[i];
         objLists[i].prev = &objLists[i];
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+        gObjectListSlotCount[i] = 0;
+#endif
     }
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    gObjectListWalkList = -1;
+#endif
 }
 
 /**
  * Free the given object.
  */
 void unload_object(struct Object *obj) {
+#ifdef DYNAMIC_SURFACE_RETENTION
+    unload_object_surfaces(obj);
+#endif
+#ifdef ANIM_MATRIX_CACHE
+    anim_mtx_cache_release(obj);
+#endif
+#ifdef ANIM_BLENDING
+    anim_blend_release(obj);
+#endif
     obj->activeFlags = ACTIVE_FLAG_DEACTIVATED;
     obj->prevObj = NULL;
 
@@ -171,6 +337,18 @@ struct Object *allocate_object(struct ObjectNode *objList) {
 
     obj->platform = NULL;
     obj->collisionData = NULL;
+#ifdef COLLISION_OBJECT_FLOOR_CACHE
+    obj->floorCacheFloor = NULL;
+#endif
+#ifdef DYNAMIC_SURFACE_RETENTION
+    obj->dynColLoaded = FALSE;
+#endif
+#ifdef ANIM_MATRIX_CACHE
+    obj->animMtxCacheIndex = -1;
+#endif
+#ifdef ANIM_BLENDING
+    obj->animBlendIndex = -1;
+#endif
     obj->oIntangibleTimer = -1;
     obj->oDamageOrCoinValue = 0;
     obj->oHealth = 2048;
@@ -194,6 +372,9 @@ struct Object *allocate_object(struct ObjectNode *objList) {
     obj->header.gfx.throwMatrix = NULL;
 #ifdef PUPPYLIGHTS
     obj->oLightID = 0xFFFF;
+#ifdef PUPPYLIGHTS_GRID
+    obj->puppylightGridSrc = NULL;
+#endif
 #endif
 
     return obj;
@@ -220,10 +401,114 @@ struct Object *create_object(const BehaviorScript *bhvScript) {
 
     obj->curBhvCommand = bhvScript;
     obj->behavior = bhvScript;
+#ifdef BHV_LOD_TIERS
+    obj->behaviorLodTier = bhv_lod_find_tier(bhvScript);
+#endif
 
     if (objListIndex == OBJ_LIST_UNIMPORTANT) {
         obj->activeFlags |= ACTIVE_FLAG_UNIMPORTANT;
     }
 
+#ifdef COLLISION_OBJECT_BROADPHASE
+    // The frame's broadphase hash doesn't contain this object, so proximity
+    // queries against its list have to fall back to list scans until rebuild.
+    collision_hash_note_spawn(objListIndex);
+#endif
+
     return obj;
 }
+
+#ifdef DEFERRED_SPAWN_QUEUE
+
+struct DeferredSpawn {
+    const BehaviorScript *behavior;
+    ModelID32 model;
+    Vec3s pos;
+    s16 yaw;    // Already converted with convert_rotation.
+    s16 params; // Raw macro params word.
+    void *respawnInfo;
+    s32 areaIndex;
+};
+
+static struct DeferredSpawn sDeferredSpawns[0x100];
+static u8 sDeferredSpawnWrite = 0;
+static u8 sDeferredSpawnRead = 0;
+
+/**
+ * Perform the spawn described by a queue entry. This mirrors the macro object
+ * spawn in spawn_macro_objects exactly, including the respawn bookkeeping.
+ */
+static void deferred_spawn_do(struct DeferredSpawn *entry) {
+    struct Object *newObj;
+
+    gMacroObjectDefaultParent.header.gfx.areaIndex = entry->areaIndex;
+    gMacroObjectDefaultParent.header.gfx.activeAreaIndex = entry->areaIndex;
+
+    newObj = spawn_object_abs_with_rot(&gMacroObjectDefaultParent, 0, entry->model, entry->behavior,
+                                       entry->pos[0], entry->pos[1], entry->pos[2],
+                                       0x0, entry->yaw, 0x0);
+
+    newObj->oUnusedCoinParams =    entry->params;
+    newObj->oBehParams        = (((entry->params & 0x00FF) << 16)
+                                | (entry->params & 0xFF00));
+    newObj->oBehParams2ndByte =   (entry->params & 0x00FF);
+    newObj->respawnInfoType = RESPAWN_INFO_TYPE_MACRO_OBJECT;
+    newObj->respawnInfo = entry->respawnInfo;
+    newObj->parentObj = newObj;
+}
+
+/**
+ * Queue a macro object spawn to be amortized over the next frames, or perform
+ * it right away when 'immediate' is set (gameplay-critical spawns) or the
+ * queue is full.
+ */
+void deferred_spawn_enqueue(ModelID32 model, const BehaviorScript *behavior, s16 x, s16 y, s16 z,
+                            s16 yaw, s16 params, void *respawnInfo, s32 areaIndex, s32 immediate) {
+    struct DeferredSpawn *entry;
+
+    if (immediate || (u8) (sDeferredSpawnWrite + 1) == sDeferredSpawnRead) {
+        struct DeferredSpawn stackEntry;
+        stackEntry.behavior = behavior;
+        stackEntry.model = model;
+        vec3s_set(stackEntry.pos, x, y, z);
+        stackEntry.yaw = yaw;
+        stackEntry.params = params;
+        stackEntry.respawnInfo = respawnInfo;
+        stackEntry.areaIndex = areaIndex;
+        deferred_spawn_do(&stackEntry);
+        return;
+    }
+
+    entry = &sDeferredSpawns[sDeferredSpawnWrite++];
+    entry->behavior = behavior;
+    entry->model = model;
+    vec3s_set(entry->pos, x, y, z);
+    entry->yaw = yaw;
+    entry->params = params;
+    entry->respawnInfo = respawnInfo;
+    entry->areaIndex = areaIndex;
+}
+
+/**
+ * Spawn up to DEFERRED_SPAWN_BUDGET queued objects. Called once per frame at
+ * the start of the object update pass, so fresh spawns still update the same
+ * frame they appear.
+ */
+void deferred_spawn_process(void) {
+    s32 budget = DEFERRED_SPAWN_BUDGET;
+
+    while (sDeferredSpawnRead != sDeferredSpawnWrite && budget-- > 0) {
+        deferred_spawn_do(&sDeferredSpawns[sDeferredSpawnRead++]);
+    }
+}
+
+/**
+ * Drop all pending spawns. Called when the object system is cleared on area
+ * load so a fast warp can't leak spawns into the next area.
+ */
+void deferred_spawn_clear(void) {
+    sDeferredSpawnRead = 0;
+    sDeferredSpawnWrite = 0;
+}
+
+#endif // DEFERRED_SPAWN_QUEUE
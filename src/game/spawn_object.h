@@ -4,8 +4,16 @@
 #include "types.h"
 
 void init_free_object_list(void);
+s32 obj_pool_has_free_slot(void);
 void clear_object_lists(struct ObjectNode *objLists);
 void unload_object(struct Object *obj);
 struct Object *create_object(const BehaviorScript *bhvScript);
 
+#ifdef DEFERRED_SPAWN_QUEUE
+void deferred_spawn_enqueue(ModelID32 model, const BehaviorScript *behavior, s16 x, s16 y, s16 z,
+                            s16 yaw, s16 params, void *respawnInfo, s32 areaIndex, s32 immediate);
+void deferred_spawn_process(void);
+void deferred_spawn_clear(void);
+#endif
+
 #endif // SPAWN_OBJECT_H
@@ -4,6 +4,7 @@
 #include "behavior_data.h"
 #include "engine/behavior_script.h"
 #include "engine/graph_node.h"
+#include "engine/math_util.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
 #include "sm64.h"
@@ -50,6 +51,77 @@ void create_sound_spawner(s32 soundMagic) {
     obj->oSoundEffectBits = soundMagic;
 }
 
+#ifdef OBJ_SOUND_DEDUP
+/**
+ * Per-frame object sound request table. Requests with the same sound ID whose
+ * sources quantize to the same OBJ_SOUND_DEDUP_BUCKET sized camera-space
+ * region share a slot, and the closest source wins it; the survivors are
+ * forwarded to play_sound once per frame by obj_sound_flush_deduped. The
+ * audio engine's own merging only catches repeat requests from the same
+ * source pointer, so a crowd of 30 identical enemies would otherwise claim
+ * 30 bank nodes for one audible sound.
+ */
+struct ObjSoundRequest {
+    u32 soundBits;
+    f32 *position;
+    f32 distSq;
+    s8 bucketX, bucketY, bucketZ;
+};
+
+static struct ObjSoundRequest sObjSoundRequests[OBJ_SOUND_DEDUP_SLOTS];
+static s32 sObjSoundRequestCount = 0;
+
+static void obj_sound_request_deduped(s32 soundMagic, f32 *pos) {
+    f32 distSq = sqr(pos[0]) + sqr(pos[1]) + sqr(pos[2]);
+    s8 bucketX = (s8)(s32)(pos[0] / OBJ_SOUND_DEDUP_BUCKET);
+    s8 bucketY = (s8)(s32)(pos[1] / OBJ_SOUND_DEDUP_BUCKET);
+    s8 bucketZ = (s8)(s32)(pos[2] / OBJ_SOUND_DEDUP_BUCKET);
+    struct ObjSoundRequest *req;
+    s32 i;
+
+    for (i = 0; i < sObjSoundRequestCount; i++) {
+        req = &sObjSoundRequests[i];
+        if (req->soundBits == (u32) soundMagic
+         && req->bucketX == bucketX
+         && req->bucketY == bucketY
+         && req->bucketZ == bucketZ) {
+            if (distSq < req->distSq) {
+                req->position = pos;
+                req->distSq = distSq;
+            }
+            return;
+        }
+    }
+
+    // Table full: fail open rather than dropping the sound.
+    if (sObjSoundRequestCount == OBJ_SOUND_DEDUP_SLOTS) {
+        play_sound(soundMagic, pos);
+        return;
+    }
+
+    req = &sObjSoundRequests[sObjSoundRequestCount++];
+    req->soundBits = soundMagic;
+    req->position = pos;
+    req->distSq = distSq;
+    req->bucketX = bucketX;
+    req->bucketY = bucketY;
+    req->bucketZ = bucketZ;
+}
+
+/**
+ * Forward this frame's surviving object sound requests to the audio engine.
+ * Called once per frame at the end of update_objects.
+ */
+void obj_sound_flush_deduped(void) {
+    s32 i;
+
+    for (i = 0; i < sObjSoundRequestCount; i++) {
+        play_sound(sObjSoundRequests[i].soundBits, sObjSoundRequests[i].position);
+    }
+    sObjSoundRequestCount = 0;
+}
+#endif
+
 /*
  * The following 2 functions are relevant to the sound state function
  * above. While only cur_obj_play_sound_2 is used, they may have been intended as
@@ -57,13 +129,21 @@ void create_sound_spawner(s32 soundMagic) {
  */
 void cur_obj_play_sound_1(s32 soundMagic) {
     if (gCurrentObject->header.gfx.node.flags & GRAPH_RENDER_ACTIVE) {
+#ifdef OBJ_SOUND_DEDUP
+        obj_sound_request_deduped(soundMagic, gCurrentObject->header.gfx.cameraToObject);
+#else
         play_sound(soundMagic, gCurrentObject->header.gfx.cameraToObject);
+#endif
     }
 }
 
 void cur_obj_play_sound_2(s32 soundMagic) {
     if (gCurrentObject->header.gfx.node.flags & GRAPH_RENDER_ACTIVE) {
+#ifdef OBJ_SOUND_DEDUP
+        obj_sound_request_deduped(soundMagic, gCurrentObject->header.gfx.cameraToObject);
+#else
         play_sound(soundMagic, gCurrentObject->header.gfx.cameraToObject);
+#endif
 #if ENABLE_RUMBLE
         if (soundMagic == SOUND_OBJ_BOWSER_WALK) {
             queue_rumble_data(3, 60);
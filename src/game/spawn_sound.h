@@ -15,6 +15,9 @@ struct SoundState {
     s32 soundMagic;
 };
 
+#ifdef OBJ_SOUND_DEDUP
+void obj_sound_flush_deduped(void);
+#endif
 void cur_obj_play_sound_1(s32 soundMagic);
 void cur_obj_play_sound_2(s32 soundMagic);
 void create_sound_spawner(s32 soundMagic);
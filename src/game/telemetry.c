@@ -0,0 +1,81 @@
+#include <ultra64.h>
+
+#include "config.h"
+#include "telemetry.h"
+#include "game_init.h"
+#include "memory.h"
+#include "object_list_processor.h"
+#include "profiling.h"
+#include "frame_stats.h"
+
+#if defined(USB_TELEMETRY) && defined(UNF)
+
+#include "usb/debug.h"
+
+// Each frame's records are staged here and sent as one raw binary write.
+// Double buffered so the USB thread can still be draining last frame's
+// buffer while this frame's records are appended.
+#define TELEMETRY_BUFFER_SIZE 128
+
+static u8 sTelemetryBuffer[2][TELEMETRY_BUFFER_SIZE];
+static u32 sTelemetryLen = 0;
+static u8 sTelemetrySide = 0;
+
+/**
+ * Appends one tagged record to the current frame's staging buffer. Payloads
+ * are copied byte for byte, so multi-byte fields keep the console's big
+ * endian layout on the wire. Records that don't fit are dropped whole.
+ */
+void telemetry_record(u8 tag, const void *data, u32 size) {
+    u8 *buf = sTelemetryBuffer[sTelemetrySide];
+    const u8 *src = data;
+    u32 i;
+
+    if ((sTelemetryLen + size + 2) > TELEMETRY_BUFFER_SIZE) {
+        return;
+    }
+
+    buf[sTelemetryLen++] = tag;
+    buf[sTelemetryLen++] = size;
+    for (i = 0; i < size; i++) {
+        buf[sTelemetryLen++] = src[i];
+    }
+}
+
+/**
+ * Emits the built-in per-frame records and hands the finished buffer to the
+ * USB thread. Called once per frame after the frame stats are published.
+ */
+void telemetry_frame_update(void) {
+    u32 timer = gGlobalTimer;
+    u32 poolFree = main_pool_available();
+    u16 objCount = gObjectCounter;
+
+    telemetry_record(TELEM_TAG_FRAME, &timer, sizeof(timer));
+
+#if defined(USE_PROFILER) && defined(PROFILER_HISTORY)
+    {
+        u16 profile[PROFILER_HIST_COUNT];
+        u32 frame = (gProfilerHistoryIndex + PROFILER_HISTORY_FRAMES - 1) % PROFILER_HISTORY_FRAMES;
+        u32 i;
+
+        for (i = 0; i < PROFILER_HIST_COUNT; i++) {
+            profile[i] = gProfilerHistory[i][frame];
+        }
+        telemetry_record(TELEM_TAG_PROFILE, profile, sizeof(profile));
+    }
+#endif
+
+    telemetry_record(TELEM_TAG_MEMORY, &poolFree, sizeof(poolFree));
+    telemetry_record(TELEM_TAG_OBJECTS, &objCount, sizeof(objCount));
+
+#ifdef FRAME_STATS_COUNTERS
+    telemetry_record(TELEM_TAG_STATS, gFrameStatsLast, sizeof(gFrameStatsLast));
+#endif
+
+    debug_dumpbinary(sTelemetryBuffer[sTelemetrySide], sTelemetryLen);
+    sTelemetrySide ^= 1;
+    sTelemetryLen = 0;
+}
+
+#endif // USB_TELEMETRY && UNF
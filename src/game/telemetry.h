@@ -0,0 +1,32 @@
+#pragma once
+
+#include <ultra64.h>
+#include "config.h"
+
+#if defined(USB_TELEMETRY) && defined(UNF)
+
+/**
+ * Typed binary telemetry over USB. Instead of formatting text on-console,
+ * each frame appends small tagged records (tag byte, size byte, payload) to a
+ * double-buffered staging area, which is handed to the USB thread as one raw
+ * binary write per frame. tools/telemetryDecoder.py turns a captured stream
+ * back into CSV on the host. New record types only need a tag here, a
+ * telemetry_record() call on-console and a case in the decoder.
+ */
+enum TelemetryTag {
+    TELEM_TAG_FRAME   = 0x01, // u32 global timer, marks the start of a frame
+    TELEM_TAG_PROFILE = 0x02, // u16[6] microseconds: cpu, behavior, graph, audio, rsp, rdp
+    TELEM_TAG_MEMORY  = 0x03, // u32 main pool bytes free
+    TELEM_TAG_OBJECTS = 0x04, // u16 active object count
+    TELEM_TAG_STATS   = 0x05, // u32[FRAME_STAT_COUNT] frame stats registry
+};
+
+void telemetry_record(u8 tag, const void *data, u32 size);
+void telemetry_frame_update(void);
+
+#else
+
+#define telemetry_record(tag, data, size)
+#define telemetry_frame_update()
+
+#endif // USB_TELEMETRY && UNF
@@ -1,3 +1,4 @@
+#include "sm64.h"
 #include "version.h"
 #include "src/game/version_data.h"
 
@@ -6,3 +7,164 @@ char __username__[] = __USERNAME__;
 #endif
 char __compiler__[] = __COMPILER__;
 char __linker__[]   = __LINKER__;
+
+/**
+ * Configuration fingerprint: the state of every performance-relevant config
+ * toggle, baked into the ROM at compile time. Benchmark dumps print it, so
+ * any two reports can be tied to the exact flag set that produced them -
+ * including flags forced on from the command line (make PERF_PRESET=1),
+ * which the checked-in headers alone wouldn't show. One token per flag,
+ * '+' on, '-' off.
+ */
+const char gConfigFingerprint[] =
+#ifdef OBJECTS_REJ
+    "objects_rej+ "
+#else
+    "objects_rej- "
+#endif
+#ifdef UCODE_SWITCH_PRUNING
+    "ucode_switch_pruning+ "
+#else
+    "ucode_switch_pruning- "
+#endif
+#ifdef SILHOUETTE
+    "silhouette+ "
+#else
+    "silhouette- "
+#endif
+#ifdef MASTER_LIST_MATERIAL_SORT
+    "master_list_material_sort+ "
+#else
+    "master_list_material_sort- "
+#endif
+#ifdef LAZY_MTX_CONVERSION
+    "lazy_mtx_conversion+ "
+#else
+    "lazy_mtx_conversion- "
+#endif
+#ifdef BILLBOARD_MTX_CACHE
+    "billboard_mtx_cache+ "
+#else
+    "billboard_mtx_cache- "
+#endif
+#ifdef GEO_FLATTEN_START_NODES
+    "geo_flatten_start_nodes+ "
+#else
+    "geo_flatten_start_nodes- "
+#endif
+#ifdef ANIM_MATRIX_CACHE
+    "anim_matrix_cache+ "
+#else
+    "anim_matrix_cache- "
+#endif
+#ifdef ANIM_COMPRESSION
+    "anim_compression+ "
+#else
+    "anim_compression- "
+#endif
+#ifdef SHADOW_BATCHING
+    "shadow_batching+ "
+#else
+    "shadow_batching- "
+#endif
+#ifdef MARIO_PART_CACHE
+    "mario_part_cache+ "
+#else
+    "mario_part_cache- "
+#endif
+#ifdef STATIC_PROP_INSTANCING
+    "static_prop_instancing+ "
+#else
+    "static_prop_instancing- "
+#endif
+#ifdef MOVTEX_RETAINED_VTX
+    "movtex_retained_vtx+ "
+#else
+    "movtex_retained_vtx- "
+#endif
+#ifdef ENVFX_SOA_PARTICLES
+    "envfx_soa_particles+ "
+#else
+    "envfx_soa_particles- "
+#endif
+#ifdef HUD_RETAINED_DL
+    "hud_retained_dl+ "
+#else
+    "hud_retained_dl- "
+#endif
+#ifdef COLLISION_STATIC_BVH
+    "collision_static_bvh+ "
+#else
+    "collision_static_bvh- "
+#endif
+#ifdef DYNAMIC_SURFACE_RETENTION
+    "dynamic_surface_retention+ "
+#else
+    "dynamic_surface_retention- "
+#endif
+#ifdef VARIABLE_CELL_GRID
+    "variable_cell_grid+ "
+#else
+    "variable_cell_grid- "
+#endif
+#ifdef CAMERA_TRIGGER_GRID
+    "camera_trigger_grid+ "
+#else
+    "camera_trigger_grid- "
+#endif
+#ifdef MAIN_POOL_COALESCING
+    "main_pool_coalescing+ "
+#else
+    "main_pool_coalescing- "
+#endif
+#ifdef OBJECT_POOL_BITMAP
+    "object_pool_bitmap+ "
+#else
+    "object_pool_bitmap- "
+#endif
+#ifdef OBJ_LIST_COMPACT_ARRAYS
+    "obj_list_compact_arrays+ "
+#else
+    "obj_list_compact_arrays- "
+#endif
+#ifdef SPLINE_COEFF_CACHE
+    "spline_coeff_cache+ "
+#else
+    "spline_coeff_cache- "
+#endif
+#ifdef FAST_INVSQRT
+    "fast_invsqrt+ "
+#else
+    "fast_invsqrt- "
+#endif
+#ifdef FAST_BOOT
+    "fast_boot+ "
+#else
+    "fast_boot- "
+#endif
+#ifdef DEFERRED_SAVE_WRITES
+    "deferred_save_writes+ "
+#else
+    "deferred_save_writes- "
+#endif
+#ifdef MENU_SEGMENT_CACHE
+    "menu_segment_cache+ "
+#else
+    "menu_segment_cache- "
+#endif
+#ifdef PERSISTENT_BANK_CACHE
+    "persistent_bank_cache+ "
+#else
+    "persistent_bank_cache- "
+#endif
+#ifdef AUDIO_COMMAND_RING
+    "audio_command_ring+ "
+#else
+    "audio_command_ring- "
+#endif
+#ifdef ASYNC_SEQUENCE_LOADING
+    "async_sequence_loading+ "
+#else
+    "async_sequence_loading- "
+#endif
+;
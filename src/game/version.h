@@ -7,4 +7,7 @@ extern char __username__[];
 extern char __compiler__[];
 extern char __linker__[];
 
+// performance config toggle states baked in at compile time (see version.c)
+extern const char gConfigFingerprint[];
+
 #endif
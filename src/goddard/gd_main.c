@@ -17,6 +17,11 @@ s32 gGdMoveScene = TRUE; // @ 801A8050
 UNUSED static s32 sUnref801A8054 = TRUE;
 f32 D_801A8058 = -600.0f;
 s32 gGdUseVtxNormal = TRUE; // @ 801A805C; instead of face normals
+#ifdef GODDARD_DL_CACHING
+// Set by anything that visibly changes the scene (input, face springs,
+// animations, particles); cleared each frame once the display lists are built.
+s32 gGdSceneChanged = TRUE;
+#endif
 UNUSED static s32 sUnrefScnWidth = 320;
 UNUSED static s32 sUnrefScnHeight = 240;
 
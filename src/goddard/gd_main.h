@@ -3,6 +3,8 @@
 
 #include <PR/ultratypes.h>
 
+#include "config.h"
+
 // In various files of the Goddard subsystem, there are miscellaneous
 // unused rodata strings. These are likely byproducts of a printf macro
 // that was stubbed out as "#define printf", letting printf calls expand
@@ -77,6 +79,9 @@ struct GdControl { // gGdCtrl
 extern s32 gGdMoveScene;
 extern f32 D_801A8058;
 extern s32 gGdUseVtxNormal;
+#ifdef GODDARD_DL_CACHING
+extern s32 gGdSceneChanged;
+#endif
 
 // bss
 extern struct GdControl gGdCtrl;
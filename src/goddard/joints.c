@@ -105,6 +105,16 @@ void grabbable_joint_update_func(struct ObjJoint *self) {
         }
     }
 
+#ifdef GODDARD_DL_CACHING
+    // Any residual spring motion or an active grab means the head pose is
+    // still changing, so cached display lists cannot be reused.
+    if ((self->header.drawFlags & OBJ_PICKED)
+     || self->velocity.x != 0.0f || self->velocity.y != 0.0f || self->velocity.z != 0.0f
+     || offset.x != 0.0f || offset.y != 0.0f || offset.z != 0.0f) {
+        gGdSceneChanged = TRUE;
+    }
+#endif
+
     // update position
     self->mat128[3][0] += self->velocity.x;
     self->mat128[3][1] += self->velocity.y;
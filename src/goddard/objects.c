@@ -1358,6 +1358,11 @@ void move_animator(struct ObjAnimator *animObj) {
         return;
     }
 
+#ifdef GODDARD_DL_CACHING
+    // A running animation changes the scene every frame.
+    gGdSceneChanged = TRUE;
+#endif
+
     unusedVec.x = 4.0f;
     unusedVec.y = 1.0f;
     unusedVec.z = 1.0f;
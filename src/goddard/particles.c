@@ -3,6 +3,7 @@
 #include "debug_utils.h"
 #include "draw_objects.h"
 #include "dynlist_proc.h"
+#include "gd_main.h"
 #include "gd_math.h"
 #include "gd_types.h"
 #include "macros.h"
@@ -333,6 +334,10 @@ void move_particle(struct ObjParticle *ptc) {
     if (!(ptc->flags & 8)) {
         return;
     }
+#ifdef GODDARD_DL_CACHING
+    // A live particle changes the scene every frame.
+    gGdSceneChanged = TRUE;
+#endif
     if (ptc->unk60 == 3) {
         sp40.x = -gViewUpdateCamera->unkE8[2][0] * 50.0f;
         sp40.y = -gViewUpdateCamera->unkE8[2][1] * 50.0f;
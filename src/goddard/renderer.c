@@ -1304,6 +1304,36 @@ s32 gd_sfx_to_play(void) {
     return gd_new_sfx_to_play();
 }
 
+#ifdef GODDARD_DL_CACHING
+static s32 sHeadSettledFrames = 0; // consecutive frames with no scene activity
+
+/**
+ * Returns TRUE when the Mario head scene has been still for long enough that
+ * both double-buffered display lists already hold the current pose, so this
+ * frame can reuse the list built two frames ago instead of rebuilding it.
+ *
+ * The scene counts as still when gGdSceneChanged stayed clear for a whole
+ * frame: no controller activity, no spring motion on the grabbable joints,
+ * no running animators and no live particles. Both halves of the double
+ * buffer must be rebuilt clean before reuse starts, since the reused list
+ * is the one generated for the same buffer parity two frames earlier.
+ */
+static s32 gd_head_dl_is_reusable(s32 id) {
+    s32 changed = gGdSceneChanged;
+
+    gGdSceneChanged = FALSE; // collect this frame's activity for the next one
+    if (changed) {
+        sHeadSettledFrames = 0;
+        return FALSE;
+    }
+    if (sHeadSettledFrames < 2) {
+        sHeadSettledFrames++;
+        return FALSE;
+    }
+    return (id == GD_SCENE_REGULAR_MARIO);
+}
+#endif
+
 /* 24B088 -> 24B418 */
 Gfx *gdm_gettestdl(s32 id) {
     struct GdObj *dobj;
@@ -1337,6 +1367,15 @@ Gfx *gdm_gettestdl(s32 id) {
             break;
         case GD_SCENE_REGULAR_MARIO:
         case GD_SCENE_DIZZY_MARIO:
+#ifdef GODDARD_DL_CACHING
+            if (gd_head_dl_is_reusable(id)) {
+                // The settled pose is already in this parity's display list
+                // (built two frames ago); skip the scene update and net
+                // reconversion entirely and hand the old list back.
+                gddl = sMHeadMainDls[gGdFrameBufNum];
+                break;
+            }
+#endif
             setup_timers();
             update_view_and_dl(sMSceneView);
             if (sHandView != NULL) {
@@ -2413,6 +2452,14 @@ void parse_p1_controller(void) {
 
     currInputs = &sGdContPads[0];
     prevInputs = &sPrevFrameCont[0];
+#ifdef GODDARD_DL_CACHING
+    // Any stick deflection or held button counts as scene activity; the
+    // cursor, the eyes, and the grab logic all key off these.
+    if (currInputs->stick_x != 0 || currInputs->stick_y != 0
+     || currInputs->button != 0 || prevInputs->button != 0) {
+        gGdSceneChanged = TRUE;
+    }
+#endif
     // stick values
     gdctrl->stickXf     = currInputs->stick_x;
     gdctrl->stickYf     = currInputs->stick_y;
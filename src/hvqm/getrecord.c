@@ -74,4 +74,50 @@ get_record( HVQM2Record *headerbuf, void *bodybuf, u16 type, u8 *stream, OSIoMes
   return stream;
 }
 
+/*
+ * u8 *get_record_nowait(HVQM2Record *headerbuf, void *bodybuf,
+ *                       u16 type, u8 *stream, OSIoMesg *mb,
+ *                       OSMesgQueue *mq, s32 *pending)
+ *
+ * Explanation:
+ *   Same as get_record(), except that the function returns as soon as
+ * the DMA for the record body has been started, so the transfer can
+ * overlap the decode of the previous record.  The record headers are
+ * still read synchronously while scanning for the requested type;
+ * those reads are small and cheap compared to the body.
+ *
+ *   "*pending" is set to 1 when a body transfer was started, in which
+ * case the caller must call romcpy_finish() with the same "mq" before
+ * reading "bodybuf" or starting another transfer on that queue.  It is
+ * set to 0 when the record has no body.
+ *
+ * Returned value:
+ *     The address of the next record
+ */
+u8 *
+get_record_nowait( HVQM2Record *headerbuf, void *bodybuf, u16 type, u8 *stream, OSIoMesg *mb, OSMesgQueue *mq, s32 *pending )
+{
+  u16 record_type;
+  u32 record_size;
+  s32 pri;
+
+  pri = (type == HVQM2_AUDIO) ? OS_MESG_PRI_HIGH : OS_MESG_PRI_NORMAL;
+  for ( ; ; ) {
+    romcpy( headerbuf, stream, sizeof(HVQM2Record), pri, mb, mq );
+    stream += sizeof(HVQM2Record);
+    record_type = load16( headerbuf->type );
+    record_size = load32( headerbuf->size );
+    if ( record_type == type ) break;
+    stream += record_size;
+  }
+
+  *pending = 0;
+  if ( record_size > 0 ) {
+    romcpy_nowait( bodybuf, stream, record_size, pri, mb, mq );
+    stream += record_size;
+    *pending = 1;
+  }
+  return stream;
+}
+
 /* end */
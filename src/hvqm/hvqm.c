@@ -55,10 +55,84 @@ static ADPCMstate adpcm_state;	/* Buffer for state information passed to the ADP
 #define load32(from) (*(u32*)&(from))
 #define load16(from) (*(u16*)&(from))
 
+/*
+ *    Slack (in frames) on the repeat/skip pacing windows.  With record
+ * prefetch the inter-frame fetch stall is gone, so the windows can be a
+ * deterministic single frame: repeat when more than one frame early,
+ * skip to a keyframe when more than one frame late.
+ */
+#ifdef HVQM_PREFETCH
+#define HVQM_PACING_SLACK 1
+#else
+#define HVQM_PACING_SLACK 2
+#endif
+
 extern u8 _capcomSegmentRomStart[];
 extern u8 _seinSegmentRomStart[];
 
+#ifdef HVQM_PREFETCH
+/*
+ *    Rotating record slots.  While the record in the current slot is
+ * being decoded, the body DMA for the next record is already running
+ * into the following slot, so the PI read overlaps the decode instead
+ * of stalling between frames.  Only one transfer is ever outstanding
+ * per message queue: the pending body is always waited on before the
+ * next record's headers are scanned.
+ */
+static ALIGNED16 u8 video_slot_headers[NUM_HVQ_RECORD_BUFFERS][sizeof(HVQM2Record)+16];
+static int video_slot = 0;		/* Slot holding the current video record */
+static int video_next_slot = 0;		/* Slot the prefetched record lands in */
+static int video_have_next = 0;		/* A record has been prefetched */
+static int video_dma_pending = 0;	/* Its body DMA is still outstanding */
+
+static ALIGNED16 u8 audio_slot_headers[NUM_ADPCM_RECORD_BUFFERS][sizeof(HVQM2Record)+16];
+static int audio_slot = 0;
+static int audio_have_next = 0;
+static int audio_dma_pending = 0;
+
+#define VIDEO_SLOT_HEADER(slot) ((HVQM2Record *)OS_DCACHE_ROUNDUP_ADDR(video_slot_headers[slot]))
+#define VIDEO_SLOT_BODY(slot)   (&hvqbuf[(slot) * HVQ_DATASIZE_MAX])
+#define AUDIO_SLOT_HEADER(slot) ((HVQM2Record *)OS_DCACHE_ROUNDUP_ADDR(audio_slot_headers[slot]))
+#define AUDIO_SLOT_BODY(slot)   (&adpcmbuf[(slot) * AUDIO_RECORD_SIZE_MAX])
+#endif
+
 static u32 next_audio_record( void *pcmbuf ) {
+#ifdef HVQM_PREFETCH
+  HVQM2Record *record_header;
+  HVQM2Audio *audio_headerP;
+  u32 samples;
+  int cur = audio_slot;
+
+  if ( audio_remain == 0 ) return 0;
+
+  record_header = AUDIO_SLOT_HEADER(cur);
+  if ( audio_have_next ) {
+    if ( audio_dma_pending ) {
+      romcpy_finish( &audioDmaMessageQ );
+      audio_dma_pending = 0;
+    }
+    audio_have_next = 0;
+  } else {
+    audio_streamP = get_record(record_header, AUDIO_SLOT_BODY(cur), HVQM2_AUDIO, audio_streamP, &audioDmaMesgBlock, &audioDmaMessageQ);
+  }
+  --audio_remain;
+
+  /* Queue the next audio record before decoding this one */
+  if ( audio_remain > 0 ) {
+    int next = (cur + 1) % NUM_ADPCM_RECORD_BUFFERS;
+    s32 pending = 0;
+    audio_streamP = get_record_nowait(AUDIO_SLOT_HEADER(next), AUDIO_SLOT_BODY(next), HVQM2_AUDIO, audio_streamP, &audioDmaMesgBlock, &audioDmaMessageQ, &pending);
+    audio_dma_pending = pending;
+    audio_have_next = 1;
+    audio_slot = next;
+  }
+
+  audio_headerP = (HVQM2Audio *)AUDIO_SLOT_BODY(cur);
+  samples = load32(audio_headerP->samples);
+  adpcmDecode(&audio_headerP[1], (u32)load16(record_header->format), samples, pcmbuf, 1, &adpcm_state);
+
+  return samples;
+#else
   ALIGNED16 u8 header_buffer[sizeof(HVQM2Record)+16];
   HVQM2Record *record_header;
   HVQM2Audio *audio_headerP;
@@ -75,6 +149,7 @@ static u32 next_audio_record( void *pcmbuf ) {
   adpcmDecode(&audio_headerP[1], (u32)load16(record_header->format), samples, pcmbuf, 1, &adpcm_state);
 
   return samples;
+#endif
 }
 
 static tkAudioProc rewind( void ) {
@@ -82,6 +157,15 @@ static tkAudioProc rewind( void ) {
   audio_remain = total_audio_records;
   video_remain = total_frames;
   disptime = 0;
+#ifdef HVQM_PREFETCH
+  /*
+   *    No prefetch can be outstanding here: records are only queued
+   * while more remain, so the last one is always consumed before the
+   * stream runs out and is rewound.
+   */
+  audio_have_next = 0;
+  video_have_next = 0;
+#endif
   return &next_audio_record;
 }
 
@@ -139,42 +223,77 @@ void hvqm_main_proc() {
     for ( ; ; ) {
 
         //while ( video_remain > 0 ) {
+#ifndef HVQM_PREFETCH
             u8 header_buffer[sizeof(HVQM2Record)+16];
+#endif
             HVQM2Record *record_header;
+            u8 *video_body;
             u16 frame_format;
             int bufno;
             OSMesg msg;
 
             if ( disptime > 0 && tkGetTime() > 0) {
-                if ( tkGetTime() < (disptime - (usec_per_frame * 2)) ) {
+                if ( tkGetTime() < (disptime - (usec_per_frame * HVQM_PACING_SLACK)) ) {
                    tkPushVideoframe( gFramebuffers[prev_bufno], &cfb_status[prev_bufno], disptime );
                    continue;
                   //if ( video_remain == 0 ) break;
                 }
             }
-            
+
+#ifdef HVQM_PREFETCH
+            record_header = VIDEO_SLOT_HEADER(video_slot);
+            video_body = VIDEO_SLOT_BODY(video_slot);
+
+            if ( video_have_next ) {
+                /* The record was prefetched; just wait out its body DMA */
+                if ( video_dma_pending ) {
+                    romcpy_finish( &videoDmaMessageQ );
+                    video_dma_pending = 0;
+                }
+                video_have_next = 0;
+            } else {
+                video_streamP = get_record(record_header, video_body,
+                            HVQM2_VIDEO, video_streamP,
+                            &videoDmaMesgBlock, &videoDmaMessageQ);
+            }
+#else
             record_header = OS_DCACHE_ROUNDUP_ADDR( header_buffer );
-            
-            video_streamP = get_record(record_header, hvqbuf, 
-                        HVQM2_VIDEO, video_streamP, 
+            video_body = hvqbuf;
+
+            video_streamP = get_record(record_header, video_body,
+                        HVQM2_VIDEO, video_streamP,
                         &videoDmaMesgBlock, &videoDmaMessageQ);
-                        
+#endif
+
             //! SYNC VIDEO code
 
             if ( disptime > 0 && tkGetTime() > 0) {
-                if ( tkGetTime() > (disptime + (usec_per_frame * 2)) ) {
+                if ( tkGetTime() > (disptime + (usec_per_frame * HVQM_PACING_SLACK)) ) {
                   release_all_cfb();
                   do {
                     disptime += usec_per_frame;
                     if ( --video_remain == 0 ) break;
-                    video_streamP = get_record( record_header, hvqbuf, 
-				    HVQM2_VIDEO, video_streamP, 
+                    video_streamP = get_record( record_header, video_body,
+				    HVQM2_VIDEO, video_streamP,
 				    &videoDmaMesgBlock, &videoDmaMessageQ );
                   } while (load16( record_header->format ) != HVQM2_VIDEO_KEYFRAME || tkGetTime() > disptime );
                   if ( video_remain == 0 ) break;
                 }
             }
-            
+
+#ifdef HVQM_PREFETCH
+            /* Start the next record's body DMA so it overlaps this decode */
+            if ( video_remain > 1 ) {
+                s32 pending = 0;
+                video_next_slot = (video_slot + 1) % NUM_HVQ_RECORD_BUFFERS;
+                video_streamP = get_record_nowait( VIDEO_SLOT_HEADER(video_next_slot), VIDEO_SLOT_BODY(video_next_slot),
+                                HVQM2_VIDEO, video_streamP,
+                                &videoDmaMesgBlock, &videoDmaMessageQ, &pending );
+                video_dma_pending = pending;
+                video_have_next = 1;
+            }
+#endif
+
             frame_format = load16(record_header->format);
             if (frame_format == HVQM2_VIDEO_HOLD) {
                 /*
@@ -194,7 +313,7 @@ void hvqm_main_proc() {
                  * Process first half in the CPU
                  */
                 hvqtask.t.flags = 0;
-                status = hvqm2DecodeSP1( hvqbuf, frame_format, 
+                status = hvqm2DecodeSP1( video_body, frame_format,
                            &gFramebuffers[bufno][screen_offset], 
                            &gFramebuffers[prev_bufno][screen_offset], 
                            hvqwork, &hvq_sparg, hvq_spfifo );
@@ -221,6 +340,11 @@ void hvqm_main_proc() {
         prev_bufno = bufno;
         disptime += usec_per_frame;
         --video_remain;
+
+#ifdef HVQM_PREFETCH
+        /* The next iteration decodes out of the prefetched slot */
+        if ( video_have_next ) video_slot = video_next_slot;
+#endif
         
         //if (1) {
             //osAiSetFrequency(gAudioSessionPresets[0].frequency);
@@ -17,6 +17,36 @@
  */
 #define AUDIO_RECORD_SIZE_MAX  5000
 
+/*
+ * Record prefetch: rotate several video/audio record buffers and issue the
+ * body DMA for the next record before the current one is decoded, so the PI
+ * read overlaps the CPU/RSP decode instead of stalling between frames. Also
+ * tightens the repeat/skip pacing windows from two frames to one, since the
+ * fetch stall they padded for is gone. Comment out to fall back to the
+ * original synchronous fetches.
+ */
+#define HVQM_PREFETCH
+
+#ifdef HVQM_PREFETCH
+#define NUM_HVQ_RECORD_BUFFERS   3
+#define NUM_ADPCM_RECORD_BUFFERS 2
+#else
+#define NUM_HVQ_RECORD_BUFFERS   1
+#define NUM_ADPCM_RECORD_BUFFERS 1
+#endif
+
+/*
+ * Audio bridge: instead of reprogramming the AI to the movie's sampling
+ * rate and pushing decoded PCM buffers at it directly, feed them through
+ * the game audio driver (src/audio/pcm_stream.c). Movie audio is then
+ * resampled and mixed into the driver's own AI buffers, so playback
+ * starts without an AI frequency switch and game audio can keep running
+ * underneath the video. Requires the audio thread to stay alive during
+ * playback; the stock integration shuts the game down around the movie,
+ * so this is off by default.
+ */
+// #define HVQM_AUDIO_BRIDGE
+
 #define MAXWIDTH  320
 #define MAXHEIGHT 240
 
@@ -94,11 +124,14 @@ void createHvqmThread(void);
  * in system.c
  */
 void romcpy(void *dest, void *src, u32 len, s32 pri, OSIoMesg *mb, OSMesgQueue *mq);
+void romcpy_nowait(void *dest, void *src, u32 len, s32 pri, OSIoMesg *mb, OSMesgQueue *mq);
+void romcpy_finish(OSMesgQueue *mq);
 
 /*
  * in getrecord.c
  */
 u8 *get_record(HVQM2Record *headerbuf, void *bodybuf, u16 type, u8 *stream, OSIoMesg *mb, OSMesgQueue *mq);
+u8 *get_record_nowait(HVQM2Record *headerbuf, void *bodybuf, u16 type, u8 *stream, OSIoMesg *mb, OSMesgQueue *mq, s32 *pending);
 
 /*
  * in cfbkeep.c
@@ -43,4 +43,37 @@ romcpy(void *dest, void *src, u32 len, s32 pri, OSIoMesg *mb, OSMesgQueue *mq)
   osRecvMesg( mq, (OSMesg *)NULL, OS_MESG_BLOCK );
 }
 
+/***********************************************************************
+ *
+ * void romcpy_nowait(void *dest, void *src, u32 len, s32 pri,
+ *                    OSIoMesg *mb, OSMesgQueue *mq)
+ *
+ * Explanation
+ *     Same as romcpy(), but returns as soon as the DMA has been
+ *  started instead of waiting for it to end.  The caller must call
+ *  romcpy_finish() with the same "mq" before reading "dest" or
+ *  starting another transfer on the same message queue.
+ *
+ ***********************************************************************/
+void
+romcpy_nowait(void *dest, void *src, u32 len, s32 pri, OSIoMesg *mb, OSMesgQueue *mq)
+{
+  osInvalDCache( dest, (s32)len );
+  while ( osPiStartDma( mb, pri, OS_READ, (u32)src, dest, len, mq ) == -1 ) {}
+}
+
+/***********************************************************************
+ *
+ * void romcpy_finish(OSMesgQueue *mq)
+ *
+ * Explanation
+ *     Waits for the end of a transfer started with romcpy_nowait().
+ *
+ ***********************************************************************/
+void
+romcpy_finish(OSMesgQueue *mq)
+{
+  osRecvMesg( mq, (OSMesg *)NULL, OS_MESG_BLOCK );
+}
+
 /* end */
@@ -2,6 +2,7 @@
 #include <HVQM2File.h>
 #include "hvqm.h"
 #include "audio/data.h"
+#include "audio/pcm_stream.h"
 #include "buffers/framebuffers.h"
 
 /***********************************************************************
@@ -10,11 +11,13 @@
 static OSThread  tkThread;
 static u64  tkStack[STACKSIZE/sizeof(u64)];
 
+#ifndef HVQM_AUDIO_BRIDGE
 /***********************************************************************
  * Audio DA counter thread
  ***********************************************************************/
 static OSThread  daCounterThread;
 static u64  daCounterStack[STACKSIZE/sizeof(u64)];
+#endif
 
 /***********************************************************************
  * Timekeeper's command message queue
@@ -43,12 +46,14 @@ typedef struct {
 static OSMesgQueue    viMessageQ;
 static OSMesg         viMessages[VI_MSG_SIZE];
 
+#ifndef HVQM_AUDIO_BRIDGE
 /***********************************************************************
  * AI event (FIFO free) message queue
  ***********************************************************************/
 #define  AI_MSG_SIZE  2
 static OSMesgQueue    aiMessageQ;
 static OSMesg         aiMessages[AI_MSG_SIZE];
+#endif
 
 /***********************************************************************
  * Ring buffer for reserving display of image
@@ -97,6 +102,21 @@ static u32  aiDAsamples;	/* Number of samples AI is DMA transferring to DA */
  ***********************************************************************/
 static s16 pcmModBuf[(PCM_ALIGN-1)*PCM_CHANNELS];
 
+/***********************************************************************
+ * PCM decode buffers
+ *
+ *    Normally the decoded records go straight into the game's AI
+ *    buffers (gAiBuffers).  In bridge mode those stay owned by the
+ *    game audio driver, so records are decoded into dedicated buffers
+ *    here and copied into the bridge ring (audio/pcm_stream.c).
+ ***********************************************************************/
+#ifdef HVQM_AUDIO_BRIDGE
+static s16 tkBridgePcmBufs[NUM_PCMBUFs][AIBUFFER_LEN];
+#define TK_PCM_BUF(n) tkBridgePcmBufs[n]
+#else
+#define TK_PCM_BUF(n) gAiBuffers[n]
+#endif
+
 /***********************************************************************
  * Flag enabling measurement of passage of time
  ***********************************************************************/
@@ -178,6 +198,7 @@ static void tkClockStart(void)
   clock_alive = 1;
 }
 
+#ifndef HVQM_AUDIO_BRIDGE
 /***********************************************************************
  *
  * daCounterProc - Audio DA counter thread procedure
@@ -196,6 +217,7 @@ static void   daCounterProc(void UNUSED*argument)
     aiFIFOsamples = 0;
   }
 }
+#endif /* !HVQM_AUDIO_BRIDGE */
 
 /***********************************************************************
  *
@@ -224,6 +246,7 @@ static void timekeeperProc(void UNUSED*argument) {
     osCreateMesgQueue( &viMessageQ, viMessages, VI_MSG_SIZE );
     osViSetEvent( &viMessageQ, 0, 1 );
 
+#ifndef HVQM_AUDIO_BRIDGE
     /* Acquire AI event*/
     osCreateMesgQueue( &aiMessageQ, aiMessages, AI_MSG_SIZE );
     osSetEventMesg( OS_EVENT_AI, &aiMessageQ, (OSMesg *)1 );
@@ -231,11 +254,12 @@ static void timekeeperProc(void UNUSED*argument) {
   /*
    * Create and start audio DA counter thread
    */
-    osCreateThread(&daCounterThread, DA_COUNTER_THREAD_ID, daCounterProc, 
-		 NULL, daCounterStack + (STACKSIZE/sizeof(u64)), 
+    osCreateThread(&daCounterThread, DA_COUNTER_THREAD_ID, daCounterProc,
+		 NULL, daCounterStack + (STACKSIZE/sizeof(u64)),
 		 (OSPri)DA_COUNTER_PRIORITY);
     osStartThread(&daCounterThread);
-    
+#endif
+
     osRecvMesg(&tkCmdMesgQ, (OSMesg *)&cmd, OS_MESG_BLOCK);
 
     /*
@@ -250,7 +274,13 @@ static void timekeeperProc(void UNUSED*argument) {
     audioproc = (cmd->rewind)();
     
     samples_per_sec = cmd->samples_per_sec;
+#ifdef HVQM_AUDIO_BRIDGE
+    /* The game audio driver keeps the AI at its own frequency; the
+       bridge resamples the movie audio to it at mix time. */
+    pcm_stream_start(samples_per_sec);
+#else
     if (samples_per_sec) osAiSetFrequency(samples_per_sec);
+#endif
 
     pcmBufferCount = 0;
 
@@ -340,6 +370,35 @@ static void timekeeperProc(void UNUSED*argument) {
          *    has begun (video_started == 1).
 	 */
 	if ( video_started ) {
+#ifdef HVQM_AUDIO_BRIDGE
+	  /*
+	   * Bridge mode: hand the PCM to the game audio driver's mixer
+	   * instead of the AI.  The push copies the data, so the decode
+	   * buffer is immediately reusable.
+	   */
+	  while ( audioRingCount > 0 ) {
+	    void *buffer = audioRing[audioRingRead].buf;
+	    u32   length = audioRing[audioRingRead].len;
+	    u32   frames = length >> PCM_BYTES_PER_SAMPLE_SHIFT;
+	    if ( pcm_stream_space() < frames ) break;
+	    pcm_stream_push( buffer, frames );
+	    --pcmBufferCount;
+	    if ( ! audio_started ) {
+	      audio_started = 1;
+	      tkClockStart();
+	    }
+	    if ( ++audioRingRead == AUDIO_RING_BUFFER_SIZE ) audioRingRead = 0;
+	    --audioRingCount;
+	  }
+	  /*
+	   * The mixer consumes on the audio thread; derive the movie
+	   * clock from how much it has eaten instead of the AI DA counter.
+	   */
+	  if ( audio_started ) {
+	    last_time = osGetTime();
+	    samples_played = pcm_stream_consumed();
+	  }
+#else
 	  osSetThreadPri( NULL, (OSPri)(DA_COUNTER_PRIORITY + 1) );
 	  while ( audioRingCount > 0 && aiFIFOsamples == 0 ) {
 	    void *buffer = audioRing[audioRingRead].buf;
@@ -359,6 +418,7 @@ static void timekeeperProc(void UNUSED*argument) {
 	    --audioRingCount;
 	  }
 	  osSetThreadPri( NULL, (OSPri)TIMEKEEPER_PRIORITY );
+#endif
 	}
 	/*
 	 * Prepare the next PCM data
@@ -370,26 +430,26 @@ static void timekeeperProc(void UNUSED*argument) {
 	  s16 *sp, *dp;
 	  int i;
 
-	  samples = audioproc( &gAiBuffers[next_pcmbufno][pcm_mod_samples<<PCM_CHANNELS_SHIFT] );
+	  samples = audioproc( &TK_PCM_BUF(next_pcmbufno)[pcm_mod_samples<<PCM_CHANNELS_SHIFT] );
 
 	  if ( samples > 0 ) {
 	    ++pcmBufferCount;
 
 	    sp = pcmModBuf;
-	    dp = (s16 *)((u8 *)gAiBuffers[next_pcmbufno]);
+	    dp = (s16 *)((u8 *)TK_PCM_BUF(next_pcmbufno));
 	    i = pcm_mod_samples << PCM_CHANNELS_SHIFT;
 	    while ( i-- ) *dp++ = *sp++;
 	    samples += pcm_mod_samples;
 	    samples -= (pcm_mod_samples = samples & (PCM_ALIGN-1));
 	    length = samples << PCM_BYTES_PER_SAMPLE_SHIFT;
-	    buffer = gAiBuffers[next_pcmbufno];
+	    buffer = TK_PCM_BUF(next_pcmbufno);
 	    osWritebackDCache( buffer, length );
 	    audioRing[audioRingWrite].buf = buffer;
 	    audioRing[audioRingWrite].len = length;
 	    if ( ++audioRingWrite == AUDIO_RING_BUFFER_SIZE ) audioRingWrite = 0;
 	    ++audioRingCount;
 
-	    sp = (s16 *)((u8 *)(gAiBuffers[next_pcmbufno]) + length);
+	    sp = (s16 *)((u8 *)(TK_PCM_BUF(next_pcmbufno)) + length);
 	    dp = pcmModBuf;
 	    i = pcm_mod_samples << PCM_CHANNELS_SHIFT;
 	    while ( i-- ) *dp++ = *sp++;
@@ -411,6 +471,10 @@ static void timekeeperProc(void UNUSED*argument) {
 	    video_done = 1;
 	  }
     }
+
+#ifdef HVQM_AUDIO_BRIDGE
+    pcm_stream_stop();
+#endif
 }
 
 /***********************************************************************
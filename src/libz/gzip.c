@@ -32,6 +32,62 @@ static void myfree(voidpf opaque, void *address)
     gzip_mem_next = 0;
 }
 
+/*
+ * Streaming variant of expand_gzip: consumes the input in fixed size chunks,
+ * calling wait_chunk(chunkEnd) before inflating each one. wait_chunk must
+ * block until in[0..chunkEnd) is valid, and can start the transfer of the
+ * following chunk there so the PI runs while this one inflates.
+ *
+ * Returns -ve value for error, or number of output bytes for success
+ */
+int
+expand_gzip_chunked(char *in, char *outbuf, unsigned int inLength, unsigned int outbufLength,
+                    unsigned int chunkSize, void (*wait_chunk)(unsigned int chunkEnd))
+{
+    int err;
+    unsigned int consumed = 0;
+    z_stream d_stream; /* decompression stream */
+
+    d_stream.zalloc = (alloc_func) myalloc;
+    d_stream.zfree = (free_func) myfree;
+    d_stream.opaque = (voidpf)0;
+
+    d_stream.next_in  = in;
+    d_stream.avail_in = 0;
+    d_stream.next_out = outbuf;
+    d_stream.avail_out = outbufLength;
+
+    err = inflateInit2(&d_stream, -MAX_WBITS);
+    if (err != Z_OK) {
+        return err;
+    }
+
+    while (consumed < inLength) {
+        unsigned int avail = inLength - consumed;
+
+        if (avail > chunkSize) {
+            avail = chunkSize;
+        }
+        consumed += avail;
+        wait_chunk(consumed);
+        d_stream.avail_in += avail;
+        err = inflate(&d_stream, (consumed == inLength) ? Z_FINISH : Z_NO_FLUSH);
+        if (err == Z_STREAM_END) {
+            break;
+        }
+        if (err != Z_OK) {
+            return err;
+        }
+    }
+
+    err = inflateEnd(&d_stream);
+    if (err != Z_OK) {
+        return err;
+    }
+
+    return d_stream.total_out;
+}
+
 /*
  * Returns -ve value for error, or number of output bytes for success
  */
@@ -40,7 +40,12 @@ static s16 sPlayMarioGreeting = TRUE;
 static s16 sPlayMarioGameOver = TRUE;
 
 #ifndef DISABLE_DEMO
+#ifdef ENABLE_BENCHMARK_REPLAY
+// Don't make the benchmark sit through the full idle wait before each replay.
+#define PRESS_START_DEMO_TIMER 60
+#else
 #define PRESS_START_DEMO_TIMER 800
+#endif
 
 /**
  * Run the demo timer on the PRESS START screen after a number of frames.
@@ -17,6 +17,25 @@
 
 #define BASE_SCALE 1.0f
 
+// Batches each string's glyphs by texture: glyph quads are captured during
+// parsing and flushed grouped by character, so each distinct glyph texture
+// is loaded once per string instead of once per character. Sprites reorder
+// within the string, which is safe for non-overlapping text.
+#define S2D_GLYPH_BATCHING
+
+// Caches the displaylists of the last few printed strings, replaying them
+// with one command while the string, position and alignment are unchanged
+// (subtitles, menu labels). Strings with button codes, or too long to fit
+// a slot, fall back to direct rendering. Costs about 10KB of BSS per slot.
+#define S2D_STRING_CACHE
+
+#ifdef S2D_STRING_CACHE
+#define S2D_CACHE_SLOTS 4   // strings retained at once (evicted least recently used)
+#define S2D_CACHE_CHARS 96  // longest cacheable string, including control codes
+#define S2D_CACHE_CMDS 320  // Gfx commands per retained copy
+#define S2D_CACHE_MTX 96    // glyph matrices per copy (dropshadow doubles usage)
+#endif
+
 /******************************
  *
  * ONLY CHANGE THE BELOW CONTENTS IF YOU'RE DEVELOPING
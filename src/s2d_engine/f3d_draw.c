@@ -88,5 +88,52 @@ void draw_f3d_glyph(char c, int x, int y, uObjMtx *mt) {
     gDPPipeSync(gdl_head++);
 }
 
+#ifdef S2D_GLYPH_BATCHING
+/**
+ * Draws a string's captured glyphs grouped by character, so each distinct
+ * glyph texture is loaded into TMEM once per string instead of once per
+ * character. Consumed entries are marked with a zero character.
+ */
+void f3d_flush_glyph_batch(struct s2d_glyph_batch_entry *batch, int count) {
+    int i, j;
+
+    for (i = 0; i < count; i++) {
+        int c = batch[i].c;
+        int curR, curG, curB, curA;
+
+        if (c == 0) continue;
+
+        // setup_f3d_texture emits the env color from the globals, so seed
+        // them with this glyph's first instance
+        s2d_red = curR = batch[i].r;
+        s2d_green = curG = batch[i].g;
+        s2d_blue = curB = batch[i].b;
+        s2d_alpha = curA = batch[i].a;
+        setup_f3d_texture(c);
+
+        for (j = i; j < count; j++) {
+            if (batch[j].c != c) continue;
+
+            if (batch[j].r != curR || batch[j].g != curG
+                || batch[j].b != curB || batch[j].a != curA) {
+                curR = batch[j].r;
+                curG = batch[j].g;
+                curB = batch[j].b;
+                curA = batch[j].a;
+                gDPPipeSync(gdl_head++);
+                gDPSetEnvColor(gdl_head++, curR, curG, curB, curA);
+            }
+
+            myScale = batch[j].scale;
+            texrect(batch[j].x, batch[j].y, batch[j].scale);
+
+            batch[j].c = 0;
+        }
+
+        gDPPipeSync(gdl_head++);
+    }
+}
+#endif
+
 #undef s
 #undef t
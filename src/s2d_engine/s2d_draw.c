@@ -3,6 +3,8 @@
 #include "mtx.h"
 #include "debug.h"
 
+#include "s2d_draw.h"
+
 float myScale = 1.0f;
 int myDegrees = 0;
 uObjMtx final_mtx, rot_mtx;
@@ -84,3 +86,43 @@ void draw_s2d_glyph(char c, int x, int y, uObjMtx *mt) {
     if (spr_cond) gSPObjRectangleR(gdl_head++, &s2d_font);
 }
 
+#ifdef S2D_GLYPH_BATCHING
+/**
+ * Draws a string's captured glyphs grouped by character, so each distinct
+ * glyph texture is loaded into TMEM once per string instead of once per
+ * character. Consumed entries are marked with a zero character.
+ */
+void s2d_flush_glyph_batch(struct s2d_glyph_batch_entry *batch, int count, uObjMtx *buf) {
+    int i, j;
+
+    for (i = 0; i < count; i++) {
+        int c = batch[i].c;
+        int curR = -1, curG = -1, curB = -1, curA = -1;
+
+        if (c == 0) continue;
+
+        gDPPipeSync(gdl_head++);
+        if (tex_cond) gSPObjLoadTxtr(gdl_head++, &s2d_tex[c]);
+
+        for (j = i; j < count; j++) {
+            if (batch[j].c != c) continue;
+
+            if (batch[j].r != curR || batch[j].g != curG
+                || batch[j].b != curB || batch[j].a != curA) {
+                curR = batch[j].r;
+                curG = batch[j].g;
+                curB = batch[j].b;
+                curA = batch[j].a;
+                gDPSetEnvColor(gdl_head++, curR, curG, curB, curA);
+            }
+
+            myScale = batch[j].scale;
+            if (mtx_cond) mtx_pipeline(buf++, batch[j].x, batch[j].y);
+            if (spr_cond) gSPObjRectangleR(gdl_head++, &s2d_font);
+
+            batch[j].c = 0;
+        }
+    }
+}
+#endif
+
@@ -20,4 +20,18 @@ extern void mtx_pipeline(uObjMtx *m, int x, int y);
 extern void draw_s2d_glyph(char c, int x, int y, uObjMtx *mt);
 extern void draw_s2d_shadow(char c, int x, int y, uObjMtx *ds);
 
+#ifdef S2D_GLYPH_BATCHING
+// One captured glyph of a string, drawn out of order by the batch flushers
+// so each distinct glyph texture is loaded only once per string.
+struct s2d_glyph_batch_entry {
+    u8 c;
+    u8 r, g, b, a;
+    s16 x, y;
+    f32 scale;
+};
+
+extern void s2d_flush_glyph_batch(struct s2d_glyph_batch_entry *batch, int count, uObjMtx *buf);
+extern void f3d_flush_glyph_batch(struct s2d_glyph_batch_entry *batch, int count);
+#endif
+
 #endif
\ No newline at end of file
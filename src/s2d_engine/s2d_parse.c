@@ -17,6 +17,20 @@ enum S2DPrintModes {
 	MODE_DRAW_NORMALTEXT,
 };
 
+#ifdef S2D_GLYPH_BATCHING
+#define S2D_CLAMP_0(x) (((x) < 0) ? 0 : (x))
+
+static void s2d_flush_batch(struct s2d_glyph_batch_entry *batch, int count, uObjMtx *buf, int use_s2d) {
+	if (batch == NULL || count == 0) return;
+
+	if (use_s2d) {
+		s2d_flush_glyph_batch(batch, count, buf);
+	} else {
+		f3d_flush_glyph_batch(batch, count);
+	}
+}
+#endif
+
 static int s2d_snprint(int x, int y, int align, const char *str, uObjMtx *buf, int len, int mode) {
 	char *p = str;
 	int tmp_len = 0;
@@ -24,6 +38,11 @@ static int s2d_snprint(int x, int y, int align, const char *str, uObjMtx *buf, i
 	int orig_y = y;
 	int line = 0;
 	char button = '\0';
+#ifdef S2D_GLYPH_BATCHING
+	int use_s2d = IS_RUNNING_ON_EMULATOR;
+	struct s2d_glyph_batch_entry *batch = NULL;
+	int glyph_count = 0;
+#endif
 
 	if (*p == '\0') return;
 
@@ -108,25 +127,37 @@ static int s2d_snprint(int x, int y, int align, const char *str, uObjMtx *buf, i
 				}
 				button = p[1];
 				CH_SKIP(p);
-				switch (button) {
-					case 'A':
-						if (!(CONTROLLER_HELD_INPUT & A_BUTTON)) return 1;
-						break;
-					case 'B':
-						if (!(CONTROLLER_HELD_INPUT & B_BUTTON)) return 1;
-						break;
-					case 'Z':
-						if (!(CONTROLLER_HELD_INPUT & Z_TRIG)) return 1;
-						break;
-					case 'L':
-						if (!(CONTROLLER_HELD_INPUT & L_TRIG)) return 1;
-						break;
-					case 'R':
-						if (!(CONTROLLER_HELD_INPUT & R_TRIG)) return 1;
-						break;
-					case 'S':
-						if (!(CONTROLLER_HELD_INPUT & START_BUTTON)) return 1;
-						break;
+				{
+					int released = FALSE;
+
+					switch (button) {
+						case 'A':
+							released = !(CONTROLLER_HELD_INPUT & A_BUTTON);
+							break;
+						case 'B':
+							released = !(CONTROLLER_HELD_INPUT & B_BUTTON);
+							break;
+						case 'Z':
+							released = !(CONTROLLER_HELD_INPUT & Z_TRIG);
+							break;
+						case 'L':
+							released = !(CONTROLLER_HELD_INPUT & L_TRIG);
+							break;
+						case 'R':
+							released = !(CONTROLLER_HELD_INPUT & R_TRIG);
+							break;
+						case 'S':
+							released = !(CONTROLLER_HELD_INPUT & START_BUTTON);
+							break;
+					}
+
+					if (released) {
+#ifdef S2D_GLYPH_BATCHING
+						// draw what came before the button code
+						s2d_flush_batch(batch, glyph_count, buf, use_s2d);
+#endif
+						return 1;
+					}
 				}
 				break;
 			case '\n':
@@ -166,6 +197,51 @@ static int s2d_snprint(int x, int y, int align, const char *str, uObjMtx *buf, i
 				if (current_char != '\0' && current_char != CH_SEPARATOR) {
 					char *tbl = segmented_to_virtual(s2d_kerning_table);
 
+#ifdef S2D_GLYPH_BATCHING
+					if (batch == NULL) {
+						batch = alloc(sizeof(struct s2d_glyph_batch_entry) * len);
+					}
+
+					if (batch != NULL) {
+						// capture the glyph; the flush draws them grouped by texture
+						if (drop_shadow && mode == MODE_DRAW_DROPSHADOW) {
+							// a fully dark color draws no shadow (see draw_s2d_dropshadow)
+							if (s2d_red != 0 && s2d_green != 0 && s2d_blue != 0) {
+								batch[glyph_count].c = current_char;
+								batch[glyph_count].x = x + drop_x;
+								batch[glyph_count].y = y + drop_y;
+								batch[glyph_count].r = S2D_CLAMP_0(s2d_red - 100);
+								batch[glyph_count].g = S2D_CLAMP_0(s2d_green - 100);
+								batch[glyph_count].b = S2D_CLAMP_0(s2d_blue - 100);
+								batch[glyph_count].a = s2d_alpha;
+								batch[glyph_count].scale = myScale;
+								glyph_count++;
+							}
+						} else if (mode == MODE_DRAW_NORMALTEXT) {
+							batch[glyph_count].c = current_char;
+							batch[glyph_count].x = x;
+							batch[glyph_count].y = y;
+							batch[glyph_count].r = s2d_red;
+							batch[glyph_count].g = s2d_green;
+							batch[glyph_count].b = s2d_blue;
+							batch[glyph_count].a = s2d_alpha;
+							batch[glyph_count].scale = myScale;
+							glyph_count++;
+						}
+					} else if (use_s2d) {
+						if (drop_shadow && mode == MODE_DRAW_DROPSHADOW) {
+							draw_s2d_dropshadow(current_char, x + drop_x, y + drop_y, (buf++));
+						} else if (mode == MODE_DRAW_NORMALTEXT) {
+							draw_s2d_glyph(current_char, x, y, (buf++));
+						}
+					} else {
+						if (drop_shadow && mode == MODE_DRAW_DROPSHADOW) {
+							draw_f3d_dropshadow(current_char, x + drop_x, y + drop_y, (buf++));
+						} else if (mode == MODE_DRAW_NORMALTEXT) {
+							draw_f3d_glyph(current_char, x, y, (buf++));
+						}
+					}
+#else
 					if (IS_RUNNING_ON_EMULATOR) {
 						if (drop_shadow && mode == MODE_DRAW_DROPSHADOW) {
 							draw_s2d_dropshadow(current_char, x + drop_x, y + drop_y, (buf++));
@@ -179,6 +255,7 @@ static int s2d_snprint(int x, int y, int align, const char *str, uObjMtx *buf, i
 							draw_f3d_glyph(current_char, x, y, (buf++));
 						}
 					}
+#endif
 
 					(x += (tbl[(int) current_char] * (BASE_SCALE * myScale)));
 				}
@@ -187,6 +264,9 @@ static int s2d_snprint(int x, int y, int align, const char *str, uObjMtx *buf, i
 		p++;
 		tmp_len++;
 	} while (tmp_len < len);
+#ifdef S2D_GLYPH_BATCHING
+	s2d_flush_batch(batch, glyph_count, buf, use_s2d);
+#endif
 	myScale = 1.0f;
 	myDegrees = 0;
 	drop_shadow = FALSE;
@@ -205,6 +285,125 @@ static int s2d_string_has_dropshadow(const char *str) {
 	return result;
 }
 
+#ifdef S2D_STRING_CACHE
+/*
+ * Retained displaylists for recently printed strings. A string whose text,
+ * position and alignment are unchanged since it was last built (subtitles,
+ * menu labels) is replayed with a single command instead of being reparsed
+ * and re-emitted glyph by glyph. Each slot double buffers its commands and
+ * glyph matrices, alternating on rebuild, so the copy the RCP may still be
+ * reading a frame behind is never overwritten.
+ */
+struct s2d_cached_string {
+	char str[S2D_CACHE_CHARS];
+	int x, y, align;
+	u8 ucode; // s2d (emulator) vs f3d (console) commands differ
+	u8 valid;
+	s8 side;
+	u32 last_use;
+	Gfx gfx[2][S2D_CACHE_CMDS];
+	uObjMtx mtx[2][S2D_CACHE_MTX];
+};
+static struct s2d_cached_string s2d_string_cache[S2D_CACHE_SLOTS];
+
+static int s2d_cache_key_matches(struct s2d_cached_string *c, int x, int y, int align, const char *str, int ucode) {
+	const char *a = c->str;
+	const char *b = str;
+
+	if (!c->valid || c->x != x || c->y != y || c->align != align || c->ucode != ucode) {
+		return FALSE;
+	}
+
+	while (*a != '\0' && *a == *b) {
+		a++;
+		b++;
+	}
+
+	return *a == *b;
+}
+
+/*
+ * Prints str through the string cache, replaying the retained displaylist on
+ * a hit and rebuilding the least recently used slot on a miss. Returns FALSE
+ * if the string can't be cached (button codes poll the controller every
+ * frame; oversized strings don't fit a slot) and must be printed directly.
+ */
+static int s2d_print_cached(int x, int y, int align, const char *str, int len) {
+	int i;
+	int has_shadow = s2d_string_has_dropshadow(str);
+	int ucode = (IS_RUNNING_ON_EMULATOR != 0);
+	struct s2d_cached_string *c = NULL;
+	struct s2d_cached_string *evict;
+	Gfx *start;
+	int span;
+	int side;
+	uObjMtx *mtx_buf;
+
+	if (len >= S2D_CACHE_CHARS || (has_shadow ? len * 2 : len) > S2D_CACHE_MTX) {
+		return FALSE;
+	}
+	for (i = 0; i < len; i++) {
+		if (str[i] == CH_BUTTON) return FALSE;
+	}
+
+	for (i = 0; i < S2D_CACHE_SLOTS; i++) {
+		if (s2d_cache_key_matches(&s2d_string_cache[i], x, y, align, str, ucode)) {
+			c = &s2d_string_cache[i];
+			break;
+		}
+	}
+
+	if (c != NULL) {
+		c->last_use = s2d_timer;
+		gSPDisplayList(gdl_head++, c->gfx[c->side]);
+		return TRUE;
+	}
+
+	evict = &s2d_string_cache[0];
+	for (i = 1; i < S2D_CACHE_SLOTS; i++) {
+		c = &s2d_string_cache[i];
+		if (!c->valid || (evict->valid && c->last_use < evict->last_use)) {
+			evict = c;
+		}
+	}
+	c = evict;
+
+	// build into the frame displaylist as usual, then retain the span if it fits
+	side = c->side ^ 1;
+	mtx_buf = c->mtx[side];
+	start = gdl_head;
+
+	if (has_shadow) {
+		s2d_snprint(x, y, align, str, mtx_buf, len, MODE_DRAW_DROPSHADOW);
+		mtx_buf += len;
+	}
+	s2d_snprint(x, y, align, str, mtx_buf, len, MODE_DRAW_NORMALTEXT);
+
+	span = gdl_head - start;
+	if (span > S2D_CACHE_CMDS - 1) {
+		return TRUE; // too long to retain; it was still drawn directly
+	}
+
+	bcopy(start, c->gfx[side], span * sizeof(Gfx));
+	gSPEndDisplayList(&c->gfx[side][span]);
+	gdl_head = start;
+	gSPDisplayList(gdl_head++, c->gfx[side]);
+
+	for (i = 0; i <= len; i++) {
+		c->str[i] = str[i];
+	}
+	c->x = x;
+	c->y = y;
+	c->align = align;
+	c->ucode = ucode;
+	c->side = side;
+	c->valid = TRUE;
+	c->last_use = s2d_timer;
+
+	return TRUE;
+}
+#endif
+
 // deprecated
 void s2d_print(int x, int y, int align, const char *str, uObjMtx *buf) {
 	if (s2d_check_align(align) != 0) return;
@@ -222,6 +421,12 @@ void s2d_print_alloc(int x, int y, int align, const char *str) {
 
 	len = s2d_strlen(str);
 
+#ifdef S2D_STRING_CACHE
+	if (s2d_print_cached(x, y, align, str, len)) {
+		return;
+	}
+#endif
+
 	if (s2d_string_has_dropshadow(str)) {
 		uObjMtx *b = alloc(sizeof(uObjMtx) * len);
 		s2d_snprint(x, y, align, str, b, len, MODE_DRAW_DROPSHADOW);
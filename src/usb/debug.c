@@ -25,9 +25,10 @@ https://github.com/buu342/N64-UNFLoader
                Definitions
     *********************************/
     
-    #define MSG_FAULT 0x10
-    #define MSG_READ  0x11
-    #define MSG_WRITE 0x12
+    #define MSG_FAULT    0x10
+    #define MSG_READ     0x11
+    #define MSG_WRITE    0x12
+    #define MSG_LOGDRAIN 0x13
     
     #define USBERROR_NONE    0
     #define USBERROR_NOTTEXT 1
@@ -110,6 +111,12 @@ https://github.com/buu342/N64-UNFLoader
         #endif
         static void debug_thread_usb(void *arg);
 
+        // Log ring buffer
+        #if USE_LOG_RINGBUFFER
+            static void debug_log_enqueue(const char* str, int len);
+            static void debug_log_drain();
+        #endif
+
         // Other
         #if OVERWRITE_OSPRINT
             static void* debug_osSyncPrintf_implementation(void *unused, const char *str, size_t len);
@@ -167,6 +174,16 @@ https://github.com/buu342/N64-UNFLoader
         static OSThread    usbThread;
         static u64         usbThreadStack[USB_THREAD_STACK/sizeof(u64)];
 
+        // Log ring buffer globals. Head and tail are free running counters
+        // taken modulo the buffer size on access, and are only ever moved
+        // with interrupts disabled
+        #if USE_LOG_RINGBUFFER
+            static char debug_ringbuffer[LOG_RINGBUFFER_SIZE];
+            static vu32 debug_ring_head = 0;
+            static vu32 debug_ring_tail = 0;
+            static usbMesg debug_ring_drainmesg = {MSG_LOGDRAIN, 0, NULL, 0};
+        #endif
+
         // List of error causes
         static regDesc causeDesc[] = {
             {CAUSE_BD,      CAUSE_BD,    "BD"},
@@ -320,6 +337,97 @@ https://github.com/buu342/N64-UNFLoader
         {
             return ((char *) memcpy(buf, str, len) + len);
         }
+
+        #if USE_LOG_RINGBUFFER
+
+            /*==============================
+                debug_log_enqueue
+                Stores a message in the log ring buffer without touching the
+                cart. Messages are kept as a two byte length header followed
+                by the payload; when the buffer is full, the oldest messages
+                are dropped to make room. Interrupts are disabled around the
+                copy so the game, audio and fault threads can all log safely
+                @param The message to store
+                @param The length of the message in bytes
+            ==============================*/
+
+            static void debug_log_enqueue(const char* str, int len)
+            {
+                u32 saved;
+                u32 start;
+                int i;
+
+                if (len <= 0)
+                    return;
+                if (len > LOG_RINGBUFFER_SIZE-2)
+                    len = LOG_RINGBUFFER_SIZE-2;
+
+                saved = __osDisableInt();
+
+                // Drop the oldest messages until the new one fits
+                while ((u32)(len+2) > LOG_RINGBUFFER_SIZE - (debug_ring_head - debug_ring_tail))
+                {
+                    int oldlen = (((u8)debug_ringbuffer[debug_ring_tail % LOG_RINGBUFFER_SIZE]) << 8)
+                               |  ((u8)debug_ringbuffer[(debug_ring_tail+1) % LOG_RINGBUFFER_SIZE]);
+                    debug_ring_tail += oldlen + 2;
+                }
+
+                // Store the header and payload, then publish by moving the head
+                start = debug_ring_head;
+                debug_ringbuffer[start % LOG_RINGBUFFER_SIZE] = (len >> 8) & 0xFF;
+                debug_ringbuffer[(start+1) % LOG_RINGBUFFER_SIZE] = len & 0xFF;
+                for (i=0; i<len; i++)
+                    debug_ringbuffer[(start+2+i) % LOG_RINGBUFFER_SIZE] = str[i];
+                debug_ring_head = start + len + 2;
+
+                __osRestoreInt(saved);
+
+                // Poke the USB thread so it drains the buffer when it gets
+                // scheduled. If the queue is already occupied the thread is
+                // guaranteed to wake up anyway, so the message can be dropped
+                osSendMesg(&usbMessageQ, (OSMesg)&debug_ring_drainmesg, OS_MESG_NOBLOCK);
+            }
+
+
+            /*==============================
+                debug_log_drain
+                Empties the log ring buffer over USB. Only called from the
+                USB thread, which owns debug_buffer and is the only place
+                usb_write is allowed to block
+            ==============================*/
+
+            static void debug_log_drain()
+            {
+                while (1)
+                {
+                    int len, copylen, i;
+                    u32 saved = __osDisableInt();
+
+                    if (debug_ring_head == debug_ring_tail)
+                    {
+                        __osRestoreInt(saved);
+                        return;
+                    }
+
+                    // Copy the oldest message out of the ring before the
+                    // writers can drop it
+                    len = (((u8)debug_ringbuffer[debug_ring_tail % LOG_RINGBUFFER_SIZE]) << 8)
+                        |  ((u8)debug_ringbuffer[(debug_ring_tail+1) % LOG_RINGBUFFER_SIZE]);
+                    copylen = len;
+                    if (copylen > BUFFER_SIZE-1)
+                        copylen = BUFFER_SIZE-1;
+                    for (i=0; i<copylen; i++)
+                        debug_buffer[i] = debug_ringbuffer[(debug_ring_tail+2+i) % LOG_RINGBUFFER_SIZE];
+                    debug_buffer[copylen] = '\0';
+                    debug_ring_tail += len + 2;
+
+                    __osRestoreInt(saved);
+
+                    usb_write(DATATYPE_TEXT, debug_buffer, copylen+1);
+                }
+            }
+
+        #endif
     #endif
      
      
@@ -334,31 +442,47 @@ https://github.com/buu342/N64-UNFLoader
     void debug_printf(const char* message, ...)
     {
         int len = 0;
-        usbMesg msg;
         va_list args;
-        
-        // use the internal libultra printf function to format the string
-        va_start(args, message);
-        #ifndef LIBDRAGON
-            len = _Printf(&printf_handler, debug_buffer, message, args);
-        #else
-            len = vsprintf(debug_buffer, message, args);
-        #endif
-        va_end(args);
-        
-        // Attach the '\0' if necessary
-        if (0 <= len)
-            debug_buffer[len] = '\0';
-        
-        // Send the printf to the usb thread
-        msg.msgtype = MSG_WRITE;
-        msg.datatype = DATATYPE_TEXT;
-        msg.buff = debug_buffer;
-        msg.size = len+1;
-        #ifndef LIBDRAGON
-            osSendMesg(&usbMessageQ, (OSMesg)&msg, OS_MESG_BLOCK);
+
+        #if !defined(LIBDRAGON) && USE_LOG_RINGBUFFER
+            char buffer[BUFFER_SIZE];
+
+            // Format the string into a local buffer and store it in the log
+            // ring. The actual usb_write happens later on the USB thread, so
+            // this never blocks on the cart FIFO
+            va_start(args, message);
+            len = _Printf(&printf_handler, buffer, message, args);
+            va_end(args);
+
+            if (len <= 0)
+                return;
+            debug_log_enqueue(buffer, len);
         #else
-            debug_thread_usb(&msg);
+            usbMesg msg;
+
+            // use the internal libultra printf function to format the string
+            va_start(args, message);
+            #ifndef LIBDRAGON
+                len = _Printf(&printf_handler, debug_buffer, message, args);
+            #else
+                len = vsprintf(debug_buffer, message, args);
+            #endif
+            va_end(args);
+
+            // Attach the '\0' if necessary
+            if (0 <= len)
+                debug_buffer[len] = '\0';
+
+            // Send the printf to the usb thread
+            msg.msgtype = MSG_WRITE;
+            msg.datatype = DATATYPE_TEXT;
+            msg.buff = debug_buffer;
+            msg.size = len+1;
+            #ifndef LIBDRAGON
+                osSendMesg(&usbMessageQ, (OSMesg)&msg, OS_MESG_BLOCK);
+            #else
+                debug_thread_usb(&msg);
+            #endif
         #endif
     }
     
@@ -727,8 +851,14 @@ https://github.com/buu342/N64-UNFLoader
             #ifndef LIBDRAGON
                 // Wait for a USB message to arrive
                 osRecvMesg(&usbMessageQ, (OSMesg *)&threadMsg, OS_MESG_BLOCK);
+
+                // Flush any buffered log messages first, so they stay in
+                // order with whatever triggered this wakeup
+                #if USE_LOG_RINGBUFFER
+                    debug_log_drain();
+                #endif
             #endif
-            
+
             // Ensure there's no data in the USB (which handles MSG_READ)
             while (usb_poll() != 0)
             {
@@ -815,6 +945,11 @@ https://github.com/buu342/N64-UNFLoader
                 case MSG_WRITE:
                     usb_write(threadMsg->datatype, threadMsg->buff, threadMsg->size);
                     break;
+                #if USE_LOG_RINGBUFFER
+                    case MSG_LOGDRAIN:
+                        // The ring was already drained above
+                        break;
+                #endif
             }
 
             // If we're in libdragon, break out of the loop as we don't need it
@@ -838,22 +973,28 @@ https://github.com/buu342/N64-UNFLoader
         
             static void* debug_osSyncPrintf_implementation(void *unused, const char *str, size_t len)
             {
-                void* ret;
-                usbMesg msg;
-                
-                // Clear the debug buffer and copy the formatted string to it
-                memset(debug_buffer, 0, len+1);
-                ret =  ((char *) memcpy(debug_buffer, str, len) + len);
-                
-                // Send the printf to the usb thread
-                msg.msgtype = MSG_WRITE;
-                msg.datatype = DATATYPE_TEXT;
-                msg.buff = debug_buffer;
-                msg.size = len+1;
-                osSendMesg(&usbMessageQ, (OSMesg)&msg, OS_MESG_BLOCK);
-                
-                // Return the end of the buffer
-                return ret;
+                #if USE_LOG_RINGBUFFER
+                    // Store the string in the log ring, same as debug_printf
+                    debug_log_enqueue(str, len);
+                    return (void*)(str + len);
+                #else
+                    void* ret;
+                    usbMesg msg;
+
+                    // Clear the debug buffer and copy the formatted string to it
+                    memset(debug_buffer, 0, len+1);
+                    ret =  ((char *) memcpy(debug_buffer, str, len) + len);
+
+                    // Send the printf to the usb thread
+                    msg.msgtype = MSG_WRITE;
+                    msg.datatype = DATATYPE_TEXT;
+                    msg.buff = debug_buffer;
+                    msg.size = len+1;
+                    osSendMesg(&usbMessageQ, (OSMesg)&msg, OS_MESG_BLOCK);
+
+                    // Return the end of the buffer
+                    return ret;
+                #endif
             }
             
         #endif 
@@ -11,7 +11,9 @@
     #define USE_FAULTTHREAD   1   // Create a fault detection thread (libultra only)
     #define OVERWRITE_OSPRINT 1   // Replaces osSyncPrintf calls with debug_printf (libultra only)
     #define MAX_COMMANDS      25  // The max amount of user defined commands possible
-    
+    #define USE_LOG_RINGBUFFER  1    // Buffer debug_printf messages in RDRAM and let the USB thread drain them, so printing never blocks on the cart (libultra only)
+    #define LOG_RINGBUFFER_SIZE 4096 // Size of the log ring buffer in bytes. Oldest messages are dropped when it fills
+
     // Fault thread definitions (libultra only)
     #define FAULT_THREAD_ID    13
     #define FAULT_THREAD_PRI   125
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+# Finds identical texture payloads across actor groups and level segments.
+#
+# Textures are bound to symbols by checked-in wrappers of the form
+#     ALIGNED8 static const Texture name[] = {
+#     #include "actors/foo/bar.rgba16.inc.c"
+#     };
+# where the pixel data is generated into the build directory from the
+# extracted PNGs. This walks every actor group and level data translation
+# unit, hashes the generated payload behind each wrapper, and reports sets
+# of byte-identical textures together with the RDRAM/ROM waste.
+#
+# Duplicates inside one translation unit are safe to merge automatically:
+# every reference is a file-scope symbol in the same unit, so the later
+# copy can become a #define alias of the earlier one. --apply performs
+# that rewrite in the source tree (run it after a full build so the
+# payload files exist, then rebuild). Duplicates that span segments are
+# only reported, since merging those would change which segment must be
+# loaded for the data to be addressable.
+
+import argparse
+import hashlib
+import os
+import re
+import sys
+
+DEF_RE = re.compile(r"^(ALIGNED8\s+)?(static\s+)?const Texture (\w+)\[\] = \{$")
+INC_RE = re.compile(r"^#include \"([^\"]+)\"$")
+BYTE_RE = re.compile(r"0[xX][0-9a-fA-F]+")
+
+
+class TextureDef:
+    def __init__(self, tu, src_file, line, symbol, payload, static, order):
+        self.tu = tu            # translation unit root (e.g. actors/group1.c)
+        self.src_file = src_file  # wrapper file holding the definition
+        self.line = line        # index of the definition line in src_file
+        self.symbol = symbol
+        self.payload = payload  # generated pixel file, relative to build dir
+        self.static = static
+        self.order = order      # encounter order within the TU
+
+
+def gather_includes(path, root, seen, out):
+    """Collect wrapper files reachable from a TU root, in include order."""
+    if path in seen or not os.path.exists(path):
+        return
+    seen.add(path)
+    out.append(path)
+    base = os.path.dirname(path)
+    with open(path) as f:
+        for line in f:
+            m = INC_RE.match(line.strip())
+            if m is None:
+                continue
+            inc = m.group(1)
+            if not (inc.endswith(".inc.c") or inc.endswith(".h")):
+                continue
+            for cand in (os.path.join(root, inc), os.path.join(base, inc)):
+                if os.path.exists(cand):
+                    gather_includes(cand, root, seen, out)
+                    break
+
+
+def scan_tu(tu, root, build_dir):
+    """Extract texture wrapper definitions from one translation unit."""
+    files = []
+    gather_includes(os.path.join(root, tu), root, set(), files)
+    defs = []
+    for path in files:
+        with open(path) as f:
+            lines = f.read().split("\n")
+        for i in range(len(lines) - 2):
+            m = DEF_RE.match(lines[i].strip())
+            if m is None:
+                continue
+            inc = INC_RE.match(lines[i + 1].strip())
+            if inc is None or lines[i + 2].strip() != "};":
+                continue
+            payload = inc.group(1)
+            if not os.path.exists(os.path.join(build_dir, payload)):
+                continue
+            defs.append(TextureDef(tu, path, i, m.group(3), payload,
+                                   m.group(2) is not None, len(defs)))
+    return defs
+
+
+def payload_key(build_dir, payload, cache):
+    if payload not in cache:
+        with open(os.path.join(build_dir, payload), "rb") as f:
+            data = f.read()
+        size = len(BYTE_RE.findall(data.decode("ascii", "replace")))
+        cache[payload] = (hashlib.sha1(data).hexdigest(), size)
+    return cache[payload]
+
+
+def apply_merges(edits):
+    """edits: {src_file: [(line, symbol, canonical)]}"""
+    for path, items in edits.items():
+        with open(path) as f:
+            lines = f.read().split("\n")
+        for line, symbol, canonical in sorted(items, reverse=True):
+            lines[line:line + 3] = [
+                "#define %s %s // deduplicated, identical payload" % (symbol, canonical)
+            ]
+        with open(path, "w") as f:
+            f.write("\n".join(lines))
+        print("rewrote %s" % path)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="report (and optionally merge) identical texture payloads")
+    parser.add_argument("build_dir", help="build directory of a finished build")
+    parser.add_argument("--apply", action="store_true",
+                        help="alias same-segment duplicates in the source tree")
+    args = parser.parse_args()
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+    tus = sorted(f for f in os.listdir(os.path.join(root, "actors"))
+                 if f.endswith(".c"))
+    tus = [os.path.join("actors", f) for f in tus]
+    levels_dir = os.path.join(root, "levels")
+    for level in sorted(os.listdir(levels_dir)):
+        leveldata = os.path.join("levels", level, "leveldata.c")
+        if os.path.exists(os.path.join(root, leveldata)):
+            tus.append(leveldata)
+
+    cache = {}
+    by_hash = {}
+    for tu in tus:
+        for d in scan_tu(tu, root, args.build_dir):
+            by_hash.setdefault(payload_key(args.build_dir, d.payload, cache),
+                               []).append(d)
+
+    edits = {}
+    waste = mergeable_waste = 0
+    for (_, size), defs in sorted(by_hash.items(), key=lambda kv: -kv[0][1]):
+        if len(defs) < 2:
+            continue
+        waste += size * (len(defs) - 1)
+        same_tu = len(set(d.tu for d in defs)) == 1
+        can_merge = same_tu and all(d.static for d in defs)
+        if can_merge:
+            mergeable_waste += size * (len(defs) - 1)
+            canonical = min(defs, key=lambda d: d.order)
+            for d in defs:
+                if d is not canonical:
+                    edits.setdefault(d.src_file, []).append(
+                        (d.line, d.symbol, canonical.symbol))
+        print("%5d bytes x%d %s" % (size, len(defs),
+              "[mergeable]" if can_merge else "[cross-segment]"))
+        for d in defs:
+            print("        %s (%s)" % (d.symbol, d.tu))
+
+    print("duplicate texture bytes: %d total, %d mergeable in-segment" %
+          (waste, mergeable_waste))
+    if args.apply and edits:
+        apply_merges(edits)
+    elif edits:
+        print("re-run with --apply to alias the mergeable duplicates")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# Content-hash cache for segment compression.
+#
+# The compressors are deterministic, so the compressed artifact is a pure
+# function of the input bytes, the command line and the tool binary. This
+# wraps a compressor invocation ccache-style: on a hit the cached artifact
+# is copied out and the compressor never runs. The cache lives outside the
+# build directory, so clean rebuilds and COMPRESS/VERSION switches reuse
+# earlier work; only segments whose content actually changed recompress.
+#
+# Usage: compress_cache.py --cache-dir DIR -i INPUT -o OUTPUT [--stdout] -- CMD...
+# CMD is the real compressor command. With --stdout the command's standard
+# output is captured into OUTPUT (for gzip-style filters); otherwise CMD is
+# expected to write OUTPUT itself. INPUT/OUTPUT occurrences inside CMD are
+# canonicalized before hashing so the key does not depend on build paths.
+
+import argparse
+import hashlib
+import os
+import shutil
+import subprocess
+import sys
+
+MAX_ENTRIES = 512
+
+
+def cache_key(args):
+    h = hashlib.sha1()
+    for arg in args.cmd:
+        if arg == args.input:
+            arg = "%i"
+        elif arg == args.output:
+            arg = "%o"
+        h.update(arg.encode() + b"\0")
+    tool = shutil.which(args.cmd[0])
+    if tool is not None:
+        with open(tool, "rb") as f:
+            h.update(f.read())
+    with open(args.input, "rb") as f:
+        while True:
+            block = f.read(1 << 20)
+            if not block:
+                break
+            h.update(block)
+    return h.hexdigest()
+
+
+def prune(cache_dir):
+    entries = [os.path.join(cache_dir, e) for e in os.listdir(cache_dir)]
+    if len(entries) <= MAX_ENTRIES:
+        return
+    entries.sort(key=os.path.getmtime)
+    for path in entries[:len(entries) - MAX_ENTRIES]:
+        os.remove(path)
+
+
+def run_compressor(args):
+    if args.use_stdout:
+        with open(args.output, "wb") as f:
+            return subprocess.run(args.cmd, stdout=f).returncode
+    return subprocess.run(args.cmd).returncode
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--cache-dir", default="")
+    parser.add_argument("-i", dest="input", required=True)
+    parser.add_argument("-o", dest="output", required=True)
+    parser.add_argument("--stdout", dest="use_stdout", action="store_true")
+    parser.add_argument("cmd", nargs="+")
+    args = parser.parse_args()
+
+    if not args.cache_dir:
+        return run_compressor(args)
+
+    os.makedirs(args.cache_dir, exist_ok=True)
+    entry = os.path.join(args.cache_dir, cache_key(args))
+    if os.path.exists(entry):
+        shutil.copyfile(entry, args.output)
+        os.utime(entry)  # keep hits fresh for LRU pruning
+        return 0
+
+    ret = run_compressor(args)
+    if ret == 0:
+        shutil.copyfile(args.output, entry)
+        prune(args.cache_dir)
+    return ret
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""
+Compress dialog text in a generated text/*/define_text.inc.c, in place.
+
+Run by the Makefile after textconv when COMPRESS=gzip. Each dialog_text_*
+byte array that shrinks is replaced with a raw deflate stream behind an
+8 byte header:
+
+    4 magic bytes, raw length (u16 BE), deflate length (u16 BE)
+
+The magic starts with 0xFF (the dialog terminator), which real dialog text
+can never start with, so the game can tell compressed entries from raw ones
+at runtime (see dialog_get_text in src/game/ingame_menu.c). Entries that do
+not shrink, or that exceed the game's inflate buffer, are left raw - the
+runtime check handles the mix.
+"""
+import re
+import sys
+import zlib
+
+MAGIC = bytes([0xFF, 0x67, 0x7A, 0x01])
+# Keep in sync with DIALOG_GZIP_BUFFER_SIZE in src/game/ingame_menu.c.
+MAX_RAW = 2048
+
+ENTRY_RE = re.compile(
+    r"(static const u8 dialog_text_\w+\[\]\s*=\s*\{)([^}]*)(\})", re.S)
+BYTE_RE = re.compile(r"0[xX][0-9a-fA-F]+|\d+")
+
+
+def compress_entry(m):
+    raw = bytes(int(tok, 0) for tok in BYTE_RE.findall(m.group(2)))
+    if raw.startswith(MAGIC):
+        sys.exit("compress_dialogs.py: dialog text collides with the "
+                 "compression magic")
+    if len(raw) > MAX_RAW:
+        return m.group(0)
+
+    deflater = zlib.compressobj(9, zlib.DEFLATED, -15)
+    comp = deflater.compress(raw) + deflater.flush()
+    if len(comp) + len(MAGIC) + 4 >= len(raw):
+        return m.group(0)
+
+    out = (MAGIC + len(raw).to_bytes(2, "big") + len(comp).to_bytes(2, "big")
+           + comp)
+    body = ", ".join("0x%02X" % b for b in out)
+    return m.group(1) + " " + body + " " + m.group(3)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: compress_dialogs.py <define_text.inc.c>")
+    path = sys.argv[1]
+    with open(path) as f:
+        src = f.read()
+    with open(path, "w") as f:
+        f.write(ENTRY_RE.sub(compress_entry, src))
+
+
+if __name__ == "__main__":
+    main()
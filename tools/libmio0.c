@@ -16,45 +16,58 @@
 #define GET_BIT(buf, bit) ((buf)[(bit) / 8] & (1 << (7 - ((bit) % 8))))
 
 // types
+
+// hash-chain match finder over 3-byte prefixes (the minimum useful MIO0
+// match). head maps a prefix hash to the most recent position, prev links
+// each position to the previous one with the same hash, newest first.
 typedef struct
 {
-   int *indexes;
-   int allocated;
-   int count;
-   int start;
+   int *head;
+   int *prev;
+   int length;
 } lookback;
 
 // functions
-#define LOOKBACK_COUNT 256
-#define LOOKBACK_INIT_SIZE 128
-static lookback *lookback_init(void)
+#define MATCH_WINDOW 4096
+#define MATCH_HASH_BITS 15
+#define MATCH_HASH_SIZE (1 << MATCH_HASH_BITS)
+#define MATCH_HASH(buf, pos) \
+   ((((buf)[pos] << 7) ^ ((buf)[(pos) + 1] << 4) ^ (buf)[(pos) + 2]) & (MATCH_HASH_SIZE - 1))
+
+// chain positions visited per lookup; 0 = unlimited (exhaustive, best ratio)
+static int g_search_depth = 0;
+
+void mio0_set_fast(int fast)
 {
-   lookback *lb = malloc(LOOKBACK_COUNT * sizeof(*lb));
-   for (int i = 0; i < LOOKBACK_COUNT; i++) {
-      lb[i].allocated = LOOKBACK_INIT_SIZE;
-      lb[i].indexes = malloc(lb[i].allocated * sizeof(*lb[i].indexes));
-      lb[i].count = 0;
-      lb[i].start = 0;
+   g_search_depth = fast ? MIO0_FAST_SEARCH_DEPTH : 0;
+}
+
+static lookback *lookback_init(unsigned int length)
+{
+   lookback *lb = malloc(sizeof(*lb));
+   lb->head = malloc(MATCH_HASH_SIZE * sizeof(*lb->head));
+   lb->prev = malloc(length * sizeof(*lb->prev));
+   lb->length = length;
+   for (int i = 0; i < MATCH_HASH_SIZE; i++) {
+      lb->head[i] = -1;
    }
    return lb;
 }
 
 static void lookback_free(lookback *lb)
 {
-   for (int i = 0; i < LOOKBACK_COUNT; i++) {
-      free(lb[i].indexes);
-   }
+   free(lb->head);
+   free(lb->prev);
    free(lb);
 }
 
-static inline void lookback_push(lookback *lkbk, unsigned char val, int index)
+static inline void lookback_push(lookback *lb, const unsigned char *buf, int index)
 {
-   lookback *lb = &lkbk[val];
-   if (lb->count == lb->allocated) {
-      lb->allocated *= 4;
-      lb->indexes = realloc(lb->indexes, lb->allocated * sizeof(*lb->indexes));
+   if (index + 2 < lb->length) {
+      int hash = MATCH_HASH(buf, index);
+      lb->prev[index] = lb->head[hash];
+      lb->head[hash] = index;
    }
-   lb->indexes[lb->count++] = index;
 }
 
 static void PUT_BIT(unsigned char *buf, int bit, int val)
@@ -70,53 +83,37 @@ static void PUT_BIT(unsigned char *buf, int bit, int val)
 // max_search: max number of bytes to find
 // found_offset: returned offset found (0 if none found)
 // returns max length of matching stream (0 if none found)
-static int find_longest(const unsigned char *buf, int start_offset, int max_search, int *found_offset, lookback *lkbk)
+static int find_longest(const unsigned char *buf, int start_offset, int max_search, int *found_offset, lookback *lb)
 {
    int best_length = 0;
    int best_offset = 0;
-   int cur_length;
-   int search_len;
    int farthest, off, i;
-   int lb_idx;
-   const unsigned char first = buf[start_offset];
-   lookback *lb = &lkbk[first];
+   int depth = g_search_depth ? g_search_depth : 0x7FFFFFFF;
 
-   // buf
-   //  |    off        start                  max
-   //  V     |+i->       |+i->                 |
-   //  |--------------raw-data-----------------|
-   //        |+i->       |      |+i->
-   //                       +cur_length
+   // matches shorter than 3 bytes are never emitted, so only positions
+   // sharing our 3-byte prefix are candidates; a match at distance d is
+   // valid exactly when the source bytes agree (overlapping matches decode
+   // periodically, and the decoder's output equals the source here)
+   if (max_search < 3 || start_offset + 2 >= lb->length) {
+      *found_offset = 0;
+      return 0;
+   }
 
    // check at most the past 4096 values
-   farthest = MAX(start_offset - 4096, 0);
-   // find starting index
-   for (lb_idx = lb->start; lb_idx < lb->count && lb->indexes[lb_idx] < farthest; lb_idx++) {}
-   lb->start = lb_idx;
-   for ( ; lb_idx < lb->count && lb->indexes[lb_idx] < start_offset; lb_idx++) {
-      off = lb->indexes[lb_idx];
-      // check at most requested max or up until start
-      search_len = MIN(max_search, start_offset - off);
-      for (i = 0; i < search_len; i++) {
+   farthest = MAX(start_offset - MATCH_WINDOW, 0);
+   for (off = lb->head[MATCH_HASH(buf, start_offset)];
+        off >= farthest && depth-- > 0; off = lb->prev[off]) {
+      for (i = 0; i < max_search; i++) {
          if (buf[start_offset + i] != buf[off + i]) {
             break;
          }
       }
-      cur_length = i;
-      // if matched up until start, continue matching in already matched parts
-      if (cur_length == search_len) {
-         // check at most requested max less current length
-         search_len = max_search - cur_length;
-         for (i = 0; i < search_len; i++) {
-            if (buf[start_offset + cur_length + i] != buf[off + i]) {
-               break;
-            }
-         }
-         cur_length += i;
-      }
-      if (cur_length > best_length) {
+      if (i > best_length) {
          best_offset = start_offset - off;
-         best_length = cur_length;
+         best_length = i;
+         if (i == max_search) {
+            break;
+         }
       }
    }
 
@@ -209,7 +206,7 @@ int mio0_encode(const unsigned char *in, unsigned int length, unsigned char *out
    lookback *lookbacks;
 
    // initialize lookback buffer
-   lookbacks = lookback_init();
+   lookbacks = lookback_init(length);
 
    // allocate some temporary buffers worst case size
    bit_buf = malloc((length + 7) / 8); // 1-bit/byte
@@ -219,7 +216,7 @@ int mio0_encode(const unsigned char *in, unsigned int length, unsigned char *out
 
    // encode data
    // special case for first byte
-   lookback_push(lookbacks, in[0], 0);
+   lookback_push(lookbacks, in, 0);
    uncomp_buf[uncomp_idx] = in[0];
    uncomp_idx += 1;
    bytes_proc += 1;
@@ -229,7 +226,7 @@ int mio0_encode(const unsigned char *in, unsigned int length, unsigned char *out
       int max_length = MIN(length - bytes_proc, 18);
       int longest_match = find_longest(in, bytes_proc, max_length, &offset, lookbacks);
       // push current byte before checking next longer match
-      lookback_push(lookbacks, in[bytes_proc], bytes_proc);
+      lookback_push(lookbacks, in, bytes_proc);
       if (longest_match > 2) {
          int lookahead_offset;
          // lookahead to next byte to see if longer match
@@ -245,11 +242,11 @@ int mio0_encode(const unsigned char *in, unsigned int length, unsigned char *out
             longest_match = lookahead_match;
             offset = lookahead_offset;
             bit_idx++;
-            lookback_push(lookbacks, in[bytes_proc], bytes_proc);
+            lookback_push(lookbacks, in, bytes_proc);
          }
          // first byte already pushed above
          for (int i = 1; i < longest_match; i++) {
-            lookback_push(lookbacks, in[bytes_proc + i], bytes_proc + i);
+            lookback_push(lookbacks, in, bytes_proc + i);
          }
          // compressed block
          comp_buf[comp_idx] = (((longest_match - 3) & 0x0F) << 4) |
@@ -455,6 +452,7 @@ typedef struct
    char *out_filename;
    unsigned int offset;
    int compress;
+   int fast;
 } arg_config;
 
 static arg_config default_config =
@@ -462,7 +460,8 @@ static arg_config default_config =
    NULL,
    NULL,
    0,
-   1
+   1,
+   0
 };
 
 static void print_usage(void)
@@ -474,6 +473,7 @@ static void print_usage(void)
          "Optional arguments:\n"
          " -c           compress raw data into MIO0 (default: compress)\n"
          " -d           decompress MIO0 into raw data\n"
+         " -f           fast match search (dev builds; slightly worse ratio)\n"
          " -o OFFSET    starting offset in FILE (default: 0)\n"
          "\n"
          "File arguments:\n"
@@ -500,6 +500,9 @@ static void parse_arguments(int argc, char *argv[], arg_config *config)
             case 'd':
                config->compress = 0;
                break;
+            case 'f':
+               config->fast = 1;
+               break;
             case 'o':
                if (++i >= argc) {
                   print_usage();
@@ -545,6 +548,7 @@ int main(int argc, char *argv[])
    }
 
    // operation
+   mio0_set_fast(config.fast);
    if (config.compress) {
       ret_val = mio0_encode_file(config.in_filename, config.out_filename);
    } else {
@@ -5,6 +5,9 @@
 
 #define MIO0_HEADER_LENGTH 16
 
+// match-search chain positions visited per byte in fast mode
+#define MIO0_FAST_SEARCH_DEPTH 64
+
 // typedefs
 
 typedef struct
@@ -16,6 +19,11 @@ typedef struct
 
 // function prototypes
 
+// select match-search effort for mio0_encode
+// fast: nonzero caps the hash-chain walk at MIO0_FAST_SEARCH_DEPTH positions
+//       (much faster, slightly worse ratio); zero searches exhaustively
+void mio0_set_fast(int fast);
+
 // decode MIO0 header
 // returns 1 if valid header, 0 otherwise
 int mio0_decode_header(const unsigned char *buf, mio0_header_t *head);
@@ -93,6 +93,117 @@ try:
             if lines:
                 parse_file(filename, lines)
 
+    # With ANIM_COMPRESSION enabled in the config, animation value streams are
+    # stored delta+RLE compressed and decoded during the animation DMA (see
+    # decode_anim_values in src/boot/memory.c). A compressed entry is
+    # [u32 magic, rawSize, valuesOffset][raw header][raw indices][u8 stream],
+    # with the header's relative pointers describing the *decoded* layout.
+    # Entries that don't compress, or that share an array with another entry
+    # (a compressed entry embeds its own copy), keep the vanilla layout; the
+    # decoder tells them apart by the magic.
+    ANIM_STRUCT_SIZE = 0x18
+    ANIM_COMP_MAGIC = 0x414E434D  # 'ANCM'
+
+    def anim_compression_enabled():
+        try:
+            with open("include/config/config_graphics.h") as f:
+                for line in f:
+                    if line.strip() == "#define ANIM_COMPRESSION":
+                        return True
+        except OSError:
+            pass
+        return False
+
+    def compress_values(raw_values):
+        out = []
+        prev = 0
+        i = 0
+        n = len(raw_values)
+        while i < n:
+            v = raw_values[i]
+            if v == prev:
+                run = 0
+                while i < n and raw_values[i] == prev and run < 255:
+                    run += 1
+                    i += 1
+                out.append(0x81)
+                out.append(run)
+                continue
+            delta = (v - prev) & 0xFFFF
+            sdelta = delta - 0x10000 if delta >= 0x8000 else delta
+            if -126 <= sdelta <= 127:
+                out.append(sdelta & 0xFF)
+            else:
+                out.append(0x80)
+                out.append((delta >> 8) & 0xFF)
+                out.append(delta & 0xFF)
+            prev = v
+            i += 1
+        return out
+
+    def decompress_values(stream, count):
+        # Mirror of decode_anim_values in src/boot/memory.c, as a self-check.
+        out = []
+        value = 0
+        pos = 0
+        while len(out) < count:
+            c = stream[pos]
+            pos += 1
+            if c == 0x80:
+                value = (value + ((stream[pos] << 8) | stream[pos + 1])) & 0xFFFF
+                pos += 2
+                out.append(value)
+            elif c == 0x81:
+                run = stream[pos]
+                pos += 1
+                out.extend([value] * run)
+            else:
+                value = (value + (c - 0x100 if c >= 0x80 else c)) & 0xFFFF
+                out.append(value)
+        return out
+
+    arrays = {}
+    refcount = {}
+    for item in items:
+        type, name, obj = item
+        if type == "array":
+            arrays[name] = obj
+    for item in items:
+        type, name, obj = item
+        if type == "header":
+            v1, v2, v3, v4, v5, values, indices = obj
+            refcount[values] = refcount.get(values, 0) + 1
+            refcount[indices] = refcount.get(indices, 0) + 1
+
+    compressed = {}  # header name -> (comp_bytes, raw_size, values_offset)
+    owned_arrays = set()
+    if anim_compression_enabled():
+        raw_total = 0
+        comp_total = 0
+        for item in items:
+            type, name, obj = item
+            if type != "header":
+                continue
+            v1, v2, v3, v4, v5, values, indices = obj
+            if refcount[values] > 1 or refcount[indices] > 1:
+                continue
+            raw_values = [int(x, 0) & 0xFFFF for x in arrays[values][1]]
+            comp_bytes = compress_values(raw_values)
+            if decompress_values(comp_bytes, len(raw_values)) != raw_values:
+                raise Exception("animation compression self-check failed for " + name)
+            if len(comp_bytes) >= 2 * len(raw_values):
+                continue
+            values_offset = ANIM_STRUCT_SIZE + 2 * len_mapping[indices]
+            compressed[name] = (comp_bytes, values_offset + 2 * len(raw_values), values_offset)
+            owned_arrays.add(values)
+            owned_arrays.add(indices)
+            raw_total += 2 * len(raw_values)
+            comp_total += len(comp_bytes)
+        if compressed:
+            print("anim compression: {}/{} entries, values {} -> {} bytes ({:.0f}%)".format(
+                len(compressed), num_headers, raw_total, comp_total,
+                100.0 * comp_total / raw_total), file=sys.stderr)
+
     structdef = ["u32 numEntries;", "const struct Animation *addrPlaceholder;", "struct OffsetSizePair entries[" + str(num_headers) + "];"]
     structobj = [str(num_headers) + ",", "NULL,","{"]
 
@@ -105,7 +216,10 @@ try:
             if order_mapping[values] < order_mapping[indices]:
                 raise SyntaxError("Error: values array must be written after indices array for " + name)
             values_num_values = len_mapping[values]
-            offset_to_struct = "offsetof(struct MarioAnimsObj, " + name + ")"
+            if name in compressed:
+                offset_to_struct = "offsetof(struct MarioAnimsObj, " + name + "_meta)"
+            else:
+                offset_to_struct = "offsetof(struct MarioAnimsObj, " + name + ")"
             offset_to_end = "offsetof(struct MarioAnimsObj, " + values + ") + sizeof(gMarioAnims." + values + ")"
             structobj.append("{" + offset_to_struct + ", " + offset_to_end + " - " + offset_to_struct + "},")
     structobj.append("},")
@@ -116,6 +230,28 @@ try:
             v1, v2, v3, v4, v5, values, indices = obj
             indices_len = len_mapping[indices] // 6 - 1
             values_num_values = len_mapping[values]
+            if name in compressed:
+                comp_bytes, raw_size, values_offset = compressed[name]
+                structdef.append("u32 " + name + "_meta[3];")
+                structobj.append("{" + "0x{:08X}, {}, {}".format(ANIM_COMP_MAGIC, raw_size, values_offset) + "},")
+                structdef.append("struct Animation " + name + ";")
+                structobj.append("{" + ", ".join([
+                    str(v1),
+                    str(v2),
+                    str(v3),
+                    str(v4),
+                    str(v5),
+                    str(indices_len),
+                    "(const s16 *) " + str(values_offset),
+                    "(const u16 *) " + str(ANIM_STRUCT_SIZE),
+                    str(raw_size)
+                ]) + "},")
+                idx_values = arrays[indices][1]
+                structdef.append("u16 {}[{}];".format(indices, len(idx_values)))
+                structobj.append("{" + ",".join(idx_values) + "},")
+                structdef.append("u8 {}[{}];".format(values, len(comp_bytes)))
+                structobj.append("{" + ",".join(str(b) for b in comp_bytes) + "},")
+                continue
             offset_to_struct = "offsetof(struct MarioAnimsObj, " + name + ")"
             offset_to_end = "offsetof(struct MarioAnimsObj, " + values + ") + sizeof(gMarioAnims." + values + ")"
             structdef.append("struct Animation " + name + ";")
@@ -131,6 +267,8 @@ try:
                 offset_to_end + " - " + offset_to_struct
             ]) + "},")
         else:
+            if name in owned_arrays:
+                continue
             is_indices, arr = obj
             type = "u16" if is_indices else "s16"
             structdef.append("{} {}[{}];".format(type, name, len(arr)))
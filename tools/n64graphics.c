@@ -602,6 +602,7 @@ typedef struct
    int height;
    int bin_truncate;
    int pal_truncate;
+   int downscale;
 } graphics_config;
 
 static const graphics_config default_config =
@@ -619,8 +620,79 @@ static const graphics_config default_config =
    .height = 32,
    .bin_truncate = 1,
    .pal_truncate = 1,
+   .downscale = 0,
 };
 
+//---------------------------------------------------------
+// half-resolution downscale (distance-selected texture variants)
+//---------------------------------------------------------
+
+// 2x2 box filter halving an intermediate RGBA image in place of the original.
+// Odd dimensions round up and clamp the sample coordinates, so 1px strips
+// survive. Updates *width/*height and frees the input image.
+static rgba *rgba_downscale_half(rgba *img, int *width, int *height)
+{
+   int out_w = (*width + 1) / 2;
+   int out_h = (*height + 1) / 2;
+   rgba *out = malloc(out_w * out_h * sizeof(rgba));
+   if (!out) {
+      ERROR("Error allocating %u bytes\n", (unsigned)(out_w * out_h * sizeof(rgba)));
+      return NULL;
+   }
+   for (int y = 0; y < out_h; y++) {
+      for (int x = 0; x < out_w; x++) {
+         int x0 = 2 * x;
+         int y0 = 2 * y;
+         int x1 = MIN(x0 + 1, *width - 1);
+         int y1 = MIN(y0 + 1, *height - 1);
+         const rgba *p00 = &img[y0 * *width + x0];
+         const rgba *p01 = &img[y0 * *width + x1];
+         const rgba *p10 = &img[y1 * *width + x0];
+         const rgba *p11 = &img[y1 * *width + x1];
+         rgba *o = &out[y * out_w + x];
+         o->red   = (p00->red   + p01->red   + p10->red   + p11->red   + 2) / 4;
+         o->green = (p00->green + p01->green + p10->green + p11->green + 2) / 4;
+         o->blue  = (p00->blue  + p01->blue  + p10->blue  + p11->blue  + 2) / 4;
+         o->alpha = (p00->alpha + p01->alpha + p10->alpha + p11->alpha + 2) / 4;
+      }
+   }
+   free(img);
+   *width = out_w;
+   *height = out_h;
+   return out;
+}
+
+// Same box filter for the intermediate IA format.
+static ia *ia_downscale_half(ia *img, int *width, int *height)
+{
+   int out_w = (*width + 1) / 2;
+   int out_h = (*height + 1) / 2;
+   ia *out = malloc(out_w * out_h * sizeof(ia));
+   if (!out) {
+      ERROR("Error allocating %u bytes\n", (unsigned)(out_w * out_h * sizeof(ia)));
+      return NULL;
+   }
+   for (int y = 0; y < out_h; y++) {
+      for (int x = 0; x < out_w; x++) {
+         int x0 = 2 * x;
+         int y0 = 2 * y;
+         int x1 = MIN(x0 + 1, *width - 1);
+         int y1 = MIN(y0 + 1, *height - 1);
+         const ia *p00 = &img[y0 * *width + x0];
+         const ia *p01 = &img[y0 * *width + x1];
+         const ia *p10 = &img[y1 * *width + x0];
+         const ia *p11 = &img[y1 * *width + x1];
+         ia *o = &out[y * out_w + x];
+         o->intensity = (p00->intensity + p01->intensity + p10->intensity + p11->intensity + 2) / 4;
+         o->alpha     = (p00->alpha     + p01->alpha     + p10->alpha     + p11->alpha     + 2) / 4;
+      }
+   }
+   free(img);
+   *width = out_w;
+   *height = out_h;
+   return out;
+}
+
 typedef struct
 {
    const char *name;
@@ -711,6 +783,7 @@ static void print_usage(void)
          " -g IMG_FILE   graphics file to import/export (.png)\n"
          "Optional arguments:\n"
          " -o BIN_OFFSET starting offset in BIN_FILE (prevents truncation during import)\n"
+         " -d            halve resolution on import (2x2 box filter), for distance-selected variants\n"
          " -f FORMAT     texture format: rgba16, rgba32, ia1, ia4, ia8, ia16, i4, i8, ci4, ci8 (default: %s)\n"
          " -s SCHEME     output scheme: raw, u8 (hex), u64 (hex) (default: %s)\n"
          " -w WIDTH      export texture width (default: %d)\n"
@@ -749,6 +822,9 @@ static int parse_arguments(int argc, char *argv[], graphics_config *config)
                   return 0;
                }
                break;
+            case 'd':
+               config->downscale = 1;
+               break;
             case 'e':
                if (++i >= argc) return 0;
                config->bin_filename = argv[i];
@@ -868,6 +944,9 @@ int main(int argc, char *argv[])
       switch (config.format.format) {
          case IMG_FORMAT_RGBA:
             imgr = png2rgba(config.img_filename, &config.width, &config.height);
+            if (config.downscale) {
+               imgr = rgba_downscale_half(imgr, &config.width, &config.height);
+            }
             raw_size = (config.width * config.height * config.format.depth + 7) / 8;
             raw = malloc(raw_size);
             if (!raw) {
@@ -877,6 +956,9 @@ int main(int argc, char *argv[])
             break;
          case IMG_FORMAT_IA:
             imgi = png2ia(config.img_filename, &config.width, &config.height);
+            if (config.downscale) {
+               imgi = ia_downscale_half(imgi, &config.width, &config.height);
+            }
             raw_size = (config.width * config.height * config.format.depth + 7) / 8;
             raw = malloc(raw_size);
             if (!raw) {
@@ -886,6 +968,9 @@ int main(int argc, char *argv[])
             break;
          case IMG_FORMAT_I:
             imgi = png2ia(config.img_filename, &config.width, &config.height);
+            if (config.downscale) {
+               imgi = ia_downscale_half(imgi, &config.width, &config.height);
+            }
             raw_size = (config.width * config.height * config.format.depth + 7) / 8;
             raw = malloc(raw_size);
             if (!raw) {
@@ -927,10 +1012,16 @@ int main(int argc, char *argv[])
             switch (config.pal_format.format) {
                case IMG_FORMAT_RGBA:
                   imgr = png2rgba(config.img_filename, &config.width, &config.height);
+                  if (config.downscale) {
+                     imgr = rgba_downscale_half(imgr, &config.width, &config.height);
+                  }
                   raw16_length = rgba2raw(raw16, imgr, config.width, config.height, config.pal_format.depth);
                   break;
                case IMG_FORMAT_IA:
                   imgi = png2ia(config.img_filename, &config.width, &config.height);
+                  if (config.downscale) {
+                     imgi = ia_downscale_half(imgi, &config.width, &config.height);
+                  }
                   raw16_length = ia2raw(raw16, imgi, config.width, config.height, config.pal_format.depth);
                   break;
                default:
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+# In-place optimizer for exported Gfx display lists (levels/ and actors/).
+#
+# Editor exports tend to fragment vertex loads and repeat state settings;
+# every extra gSPVertex is a separate RSP DMA and every redundant command
+# costs gfx task time. Three conservative rewrites, applied per Gfx array:
+#
+#   * merge contiguous gsSPVertex loads from the SAME vertex array
+#     (sym + off) while the combined count fits the RSP vertex buffer,
+#     rebasing the second group's triangle indices. Loads from different
+#     arrays are never merged - with -fdata-sections the linker does not
+#     guarantee adjacency of separate objects.
+#   * pair neighbouring gsSP1Triangle commands into one gsSP2Triangles.
+#   * drop a state command that exactly repeats the previous occurrence
+#     with only vertex/triangle commands in between, plus back-to-back
+#     gsDPPipeSyncs.
+#
+# Unknown commands act as barriers: state tracking resets and no merge
+# crosses them. Triangles are not reordered: RSP vertices are loaded
+# explicitly, so unlike a modern post-transform cache there is no per
+# triangle miss to optimize - the win is fewer loads and fewer commands.
+#
+# Run over checked-in sources (make dlopt), then diff and rebuild.
+
+import os
+import re
+import sys
+
+MAX_VERTS = 32  # F3DEX2 vertex buffer; pass --max-verts 16 for F3D
+
+GFX_RE = re.compile(r"const Gfx \w+\[\] = \{")
+VTX_RE = re.compile(r"^(\s*)gsSPVertex\((\w+)(?:\s*\+\s*(\d+))?, (\d+), 0\),$")
+TRI1_RE = re.compile(r"^(\s*)gsSP1Triangle\(\s*(\d+),\s*(\d+),\s*(\d+),\s*0x0\),$")
+TRI2_RE = re.compile(
+    r"^(\s*)gsSP2Triangles\(\s*(\d+),\s*(\d+),\s*(\d+),\s*0x0,"
+    r"\s*(\d+),\s*(\d+),\s*(\d+),\s*0x0\),$")
+# state commands safe to elide when repeated verbatim
+STATE_RE = re.compile(
+    r"^\s*(gsDPSetCombineMode|gsDPSetEnvColor|gsDPSetPrimColor|gsDPSetTextureLUT"
+    r"|gsSPTexture|gsDPSetRenderMode|gsDPSetCycleType|gsDPSetTextureFilter)\(")
+PIPESYNC_RE = re.compile(r"^\s*gsDPPipeSync\(\),$")
+
+
+def fmt_tri2(indent, t1, t2):
+    return ("%sgsSP2Triangles(%2d, %2d, %2d, 0x0, %2d, %2d, %2d, 0x0),"
+            % (indent, t1[0], t1[1], t1[2], t2[0], t2[1], t2[2]))
+
+
+def fmt_tri1(indent, t):
+    return "%sgsSP1Triangle(%2d, %2d, %2d, 0x0)," % (indent, t[0], t[1], t[2])
+
+
+def rebase_tris(lines, base):
+    """Shift the vertex indices of parsed triangle lines by base."""
+    out = []
+    for line in lines:
+        m = TRI2_RE.match(line)
+        if m is not None:
+            g = [int(x) for x in m.groups()[1:]]
+            out.append(fmt_tri2(m.group(1), [g[0] + base, g[1] + base, g[2] + base],
+                                [g[3] + base, g[4] + base, g[5] + base]))
+            continue
+        m = TRI1_RE.match(line)
+        g = [int(x) for x in m.groups()[1:]]
+        out.append(fmt_tri1(m.group(1), [g[0] + base, g[1] + base, g[2] + base]))
+    return out
+
+
+def is_tri(line):
+    return TRI1_RE.match(line) is not None or TRI2_RE.match(line) is not None
+
+
+def merge_vertex_loads(lines, max_verts):
+    """Merge gsSPVertex groups that continue the same array contiguously."""
+    out = []
+    i = 0
+    merged = 0
+    while i < len(lines):
+        m = VTX_RE.match(lines[i])
+        if m is None:
+            out.append(lines[i])
+            i += 1
+            continue
+        indent, sym, off, count = m.group(1), m.group(2), int(m.group(3) or 0), int(m.group(4))
+        i += 1
+        tris = []
+        while i < len(lines) and is_tri(lines[i]):
+            tris.append(lines[i])
+            i += 1
+        # absorb follow-up groups while they continue the same array
+        while i < len(lines):
+            m2 = VTX_RE.match(lines[i])
+            if (m2 is None or m2.group(2) != sym
+                    or int(m2.group(3) or 0) != off + count
+                    or count + int(m2.group(4)) > max_verts):
+                break
+            ncount = int(m2.group(4))
+            i += 1
+            group = []
+            while i < len(lines) and is_tri(lines[i]):
+                group.append(lines[i])
+                i += 1
+            tris.extend(rebase_tris(group, count))
+            count += ncount
+            merged += 1
+        ref = sym if off == 0 else "%s + %d" % (sym, off)
+        out.append("%sgsSPVertex(%s, %d, 0)," % (indent, ref, count))
+        out.extend(tris)
+    return out, merged
+
+
+def pair_triangles(lines):
+    """Combine neighbouring gsSP1Triangle commands into gsSP2Triangles."""
+    out = []
+    i = 0
+    paired = 0
+    while i < len(lines):
+        m1 = TRI1_RE.match(lines[i])
+        m2 = TRI1_RE.match(lines[i + 1]) if i + 1 < len(lines) else None
+        if m1 is not None and m2 is not None:
+            out.append(fmt_tri2(m1.group(1),
+                                [int(x) for x in m1.groups()[1:]],
+                                [int(x) for x in m2.groups()[1:]]))
+            i += 2
+            paired += 1
+        else:
+            out.append(lines[i])
+            i += 1
+    return out, paired
+
+
+def strip_redundant_state(lines):
+    """Drop verbatim-repeated state commands and doubled pipe syncs."""
+    out = []
+    last_state = {}
+    stripped = 0
+    for line in lines:
+        m = STATE_RE.match(line)
+        if m is not None:
+            if last_state.get(m.group(1)) == line.strip():
+                stripped += 1
+                continue
+            last_state[m.group(1)] = line.strip()
+            out.append(line)
+        elif PIPESYNC_RE.match(line):
+            if out and PIPESYNC_RE.match(out[-1]):
+                stripped += 1
+                continue
+            out.append(line)
+        elif is_tri(line) or VTX_RE.match(line):
+            out.append(line)
+        else:
+            # unknown command: assume it can change anything
+            last_state.clear()
+            out.append(line)
+    return out, stripped
+
+
+def optimize_file(path, max_verts):
+    with open(path) as f:
+        lines = f.read().split("\n")
+    stats = [0, 0, 0]
+    out = []
+    i = 0
+    while i < len(lines):
+        out.append(lines[i])
+        if GFX_RE.search(lines[i]) is None:
+            i += 1
+            continue
+        i += 1
+        body = []
+        while i < len(lines) and lines[i].strip() != "};":
+            body.append(lines[i])
+            i += 1
+        body, merged = merge_vertex_loads(body, max_verts)
+        body, paired = pair_triangles(body)
+        body, stripped = strip_redundant_state(body)
+        stats[0] += merged
+        stats[1] += paired
+        stats[2] += stripped
+        out.extend(body)
+    if sum(stats):
+        with open(path, "w") as f:
+            f.write("\n".join(out))
+        print("%s: %d vertex loads merged, %d triangles paired, %d state commands stripped"
+              % (path, stats[0], stats[1], stats[2]))
+    return stats
+
+
+def main():
+    args = sys.argv[1:]
+    max_verts = MAX_VERTS
+    if args and args[0] == "--max-verts":
+        max_verts = int(args[1])
+        args = args[2:]
+    if not args:
+        print("usage: optimize_displaylists.py [--max-verts N] DIR...")
+        return 1
+    totals = [0, 0, 0]
+    for root_dir in args:
+        for root, _, files in os.walk(root_dir):
+            for name in files:
+                if name.endswith("model.inc.c"):
+                    stats = optimize_file(os.path.join(root, name), max_verts)
+                    totals = [a + b for a, b in zip(totals, stats)]
+    print("total: %d vertex loads merged, %d triangles paired, %d state commands stripped"
+          % tuple(totals))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+# Computes exact per-level segment footprints from a finished build and emits
+# tight pool plans, replacing the conservative hand-tuned spacing guesses.
+#
+# For every levels/*/script.c it collects the LOAD_RAW/LOAD_YAY0/FIXED_LOAD
+# commands, sizes each segment from the linker map (ROM ranges) and, for
+# compressed segments, from the decompressed-size footer that tools/filesizer
+# appends to the blob in ROM. Two numbers come out per level:
+#   resident - bytes left in the main pool once every load has finished
+#   peak     - worst in-flight total, counting the transient right-side
+#              staging buffer that holds compressed data during decompression
+# "peak" is what the pool actually has to cover; use it as the plan.
+#
+# Usage: pool_plan.py <sm64.map> <rom.z64> [--header <out.h>]
+# e.g.:  python3 tools/pool_plan.py build/us_n64/sm64.us.map build/us_n64/hackersm64.z64
+#
+# --header writes SEGMENT_POOL_PLAN_<level> defines (plus the overall
+# SEGMENT_POOL_PLAN_MAX) for feeding gSegmentPoolPlan, the runtime check in
+# src/engine/level_script.c that logs when actual loads exceed the plan.
+
+import sys, os, re, struct
+
+LOAD_RE = re.compile(r"\b(LOAD_RAW_WITH_CODE|LOAD_RAW|LOAD_YAY0_TEXTURE|LOAD_YAY0|FIXED_LOAD)\s*\(")
+SYM_RE = re.compile(r"(_\w+)SegmentRomStart")
+
+def align16(x):
+	return (x + 15) & ~15
+
+def parse_map(path):
+	syms = {}
+	with open(path) as f:
+		for line in f:
+			tokens = line.split()
+			if len(tokens) >= 2 and tokens[0].startswith("0x") and tokens[1].startswith("_"):
+				syms[tokens[1]] = int(tokens[0], 16)
+	return syms
+
+def parse_script(path):
+	# (symbol base, compressed?) per load command, deduplicated in script order
+	loads = []
+	with open(path) as f:
+		for line in f:
+			cmd = LOAD_RE.search(line)
+			sym = SYM_RE.search(line)
+			if cmd and sym and sym.group(1) not in [l[0] for l in loads]:
+				loads.append((sym.group(1), "YAY0" in cmd.group(1)))
+	return loads
+
+def plan_level(loads, syms, rom):
+	resident = peak = 0
+	missing = []
+	for base, compressed in loads:
+		start = syms.get(base + "SegmentRomStart")
+		end = syms.get(base + "SegmentRomEnd")
+		if start is None or end is None or end <= start:
+			missing.append(base)
+			continue
+		rom_size = align16(end - start)
+		size = rom_size
+		if compressed:
+			# filesizer stores the decompressed size in the last 4 bytes
+			footer = struct.unpack(">L", rom[end - 4:end])[0]
+			if 0 < footer < 0x800000:
+				size = align16(footer)
+			# compressed blob is staged alongside everything loaded so far
+			peak = max(peak, resident + size + rom_size)
+		resident += size
+		peak = max(peak, resident)
+	return resident, peak, missing
+
+def main():
+	args = [a for a in sys.argv[1:] if not a.startswith("--")]
+	header = None
+	if "--header" in sys.argv:
+		header = sys.argv[sys.argv.index("--header") + 1]
+		args.remove(header)
+	if len(args) != 2:
+		sys.exit(__doc__ or "Usage: pool_plan.py <sm64.map> <rom.z64> [--header <out.h>]")
+
+	syms = parse_map(args[0])
+	with open(args[1], "rb") as f:
+		rom = f.read()
+
+	plans = []
+	for level in sorted(os.listdir("levels")):
+		script = os.path.join("levels", level, "script.c")
+		if not os.path.isfile(script):
+			continue
+		loads = parse_script(script)
+		if not loads:
+			continue
+		resident, peak, missing = plan_level(loads, syms, rom)
+		plans.append((level, resident, peak))
+		for base in missing:
+			print("warning: %s: no ROM range for %s" % (level, base), file=sys.stderr)
+
+	plans.sort(key=lambda p: -p[2])
+	print("%-24s %10s %10s" % ("level", "resident", "peak"))
+	for level, resident, peak in plans:
+		print("%-24s 0x%08X 0x%08X" % (level, resident, peak))
+	print("%-24s %10s 0x%08X" % ("(max)", "", plans[0][2]))
+
+	if header:
+		with open(header, "w") as f:
+			f.write("// Generated by tools/pool_plan.py - do not edit.\n")
+			f.write("#ifndef LEVEL_POOL_PLANS_H\n#define LEVEL_POOL_PLANS_H\n\n")
+			f.write("#define SEGMENT_POOL_PLAN_MAX 0x%X\n\n" % plans[0][2])
+			for level, resident, peak in sorted(plans):
+				f.write("#define SEGMENT_POOL_PLAN_%s 0x%X\n" % (level.upper(), peak))
+			f.write("\n#endif // LEVEL_POOL_PLANS_H\n")
+
+if __name__ == "__main__":
+	main()
@@ -8,12 +8,9 @@
 int main(int argc, const char **argv, const char **envp);
 void encode();
 void search(unsigned int a1, int a2, int *a3, unsigned int *a4);
-int mischarsearch(unsigned char *a1, int a2, unsigned char *a3, int a4);
-void initskip(unsigned char *a1, int a2);
 void writeshort(short a1);
 void writeint4(int a1);
 
-unsigned short skip[256]; // idb
 int cp; // weak
 int ndp; // weak
 FILE *fp; // idb
@@ -27,20 +24,41 @@ unsigned char *bz;
 int dp; // idb
 unsigned int *cmd;
 
+// hash-chain match finder over 3-byte prefixes (the minimum useful Yay0
+// match); replaces the per-position Boyer-Moore scan of the whole window
+#define MATCH_WINDOW 4096
+#define MATCH_MAX 273
+#define MATCH_HASH_SIZE 0x8000
+#define MATCH_HASH(pos) \
+    (((bz[pos] << 7) ^ (bz[(pos) + 1] << 4) ^ bz[(pos) + 2]) & (MATCH_HASH_SIZE - 1))
+// chain positions visited per lookup in fast mode (0 = exhaustive)
+#define FAST_SEARCH_DEPTH 64
+int fast_mode = 0;
+int *match_head;
+int *match_prev;
+int match_inserted; // positions hashed so far
+
 int main(int argc, const char **argv, const char **envp)
 {
     char src[999];
 	char dest[999];
 
 
-	if (argc < 3)
+	int argi = 1;
+	if (argc > 1 && strcmp(argv[argi], "-f") == 0)
+	{
+		// fast match search for dev builds; slightly worse ratio
+		fast_mode = 1;
+		argi++;
+	}
+	if (argc < argi + 2)
 	{
-		fprintf(stderr, "slienc [infile] [outfile]\n");
+		fprintf(stderr, "slienc [-f] [infile] [outfile]\n");
 		return 1;
 	}
 	
-	strcpy(src, argv[1]);
-    strcpy(dest, argv[2]);
+	strcpy(src, argv[argi]);
+    strcpy(dest, argv[argi + 1]);
 	
 	if ((fp = fopen(src, "rb")) == NULL)
 	{
@@ -115,6 +133,11 @@ void encode()
 	cmd = calloc(0x4000u, 1u);
 	pol = malloc(2 * npp);
 	def = malloc(4 * ndp);
+	match_head = malloc(MATCH_HASH_SIZE * sizeof(*match_head));
+	match_prev = malloc(insize * sizeof(*match_prev));
+	match_inserted = 0;
+	for (int i = 0; i < MATCH_HASH_SIZE; i++)
+		match_head[i] = -1;
 	v0 = 0;
 	v6 = 1024;
 	v1 = 2147483648;
@@ -204,104 +227,63 @@ void encode()
 
 void search(unsigned int a1, int a2, int *a3, unsigned int *a4)
 {
-	unsigned int v4; // ebx
-	unsigned int v5; // esi
-	unsigned int *v6; // edi
-	unsigned int v7; // [esp+Ch] [ebp-10h]
-	int v8; // [esp+14h] [ebp-8h]
-	unsigned int v9; // [esp+18h] [ebp-4h]
+	int best_len = 0;
+	int best_pos = 0;
+	int maxlen = a2 - a1;
+	int farthest, pos, i;
+	int depth = fast_mode ? FAST_SEARCH_DEPTH : 0x7fffffff;
 
-	v4 = 3;
-	v5 = 0;
-	if ( a1 > 0x1000 )
-		v5 = a1 - 4096;
-	v9 = 273;
-	if ( a2 - a1 <= 0x111 )
-		v9 = a2 - a1;
-	if ( v9 > 2 )
+	// hash every position up to (not including) the search point; the
+	// encoder probes a1 and a1 + 1, so this keeps the chains current
+	while (match_inserted < (int)a1)
 	{
-		while ( a1 > v5 )
+		if (match_inserted + 2 < a2)
 		{
-			v7 = mischarsearch(&bz[a1], v4, &bz[v5], v4 + a1 - v5);
-			if ( v7 >= a1 - v5 )
+			int hash = MATCH_HASH(match_inserted);
+			match_prev[match_inserted] = match_head[hash];
+			match_head[hash] = match_inserted;
+		}
+		match_inserted++;
+	}
+
+	if (maxlen > MATCH_MAX)
+		maxlen = MATCH_MAX;
+	if (maxlen < 3 || a1 + 2 >= (unsigned int)a2)
+	{
+		*a3 = 0;
+		*a4 = 0;
+		return;
+	}
+
+	farthest = a1 > MATCH_WINDOW ? (int)a1 - MATCH_WINDOW : 0;
+	for (pos = match_head[MATCH_HASH(a1)]; pos >= farthest && depth-- > 0; pos = match_prev[pos])
+	{
+		// comparing source bytes is exact even for overlapping matches:
+		// the decoder's output equals the source up to this point
+		for (i = 0; i < maxlen; i++)
+		{
+			if (bz[pos + i] != bz[a1 + i])
 				break;
-			for ( ; v9 > v4; ++v4 )
-			{
-				if ( bz[v4 + v5 + v7] != bz[v4 + a1] )
-					break;
-			}
-			if ( v9 == v4 )
-			{
-				*a3 = v7 + v5;
-				goto LABEL_17;
-			}
-			v8 = v5 + v7;
-			++v4;
-			v5 += v7 + 1;
 		}
-		*a3 = v8;
-		if ( v4 > 3 )
+		if (i > best_len)
 		{
-			--v4;
-LABEL_17:
-			*a4 = v4;
-			return;
+			best_len = i;
+			best_pos = pos;
+			if (i == maxlen)
+				break;
 		}
-		v6 = a4;
 	}
-	else
+
+	if (best_len < 3)
 	{
+		*a3 = 0;
 		*a4 = 0;
-		v6 = a3;
 	}
-	*v6 = 0;
-}
-
-int mischarsearch(unsigned char *pattern, int patternlen, unsigned char *data, int datalen)
-{
-  int result; // eax
-  int i; // ebx
-  int v6; // eax
-  int j; // ecx
-
-  result = datalen;
-  if ( patternlen <= datalen )
-  {
-    initskip(pattern, patternlen);
-    for ( i = patternlen - 1; ; i += v6 )
-    {
-      if ( pattern[patternlen - 1] == data[i] )
-      {
-        --i;
-        j = patternlen - 2;
-        if ( patternlen - 2 < 0 )
-          return i + 1;
-        while ( pattern[j] == data[i] )
-        {
-          --i;
-          if ( --j < 0 )
-            return i + 1;
-        }
-        v6 = patternlen - j;
-        if ( skip[data[i]] > patternlen - j )
-          v6 = skip[data[i]];
-      }
-      else
-      {
-        v6 = skip[data[i]];
-      }
-    }
-  }
-  return result;
-}
-
-void initskip(unsigned char *pattern, int len)
-{
-	for (int i = 0; i < 256; i++)
-		skip[i] = len;
-	
-	for (int i = 0; i < len; i++)
-		skip[pattern[i]] = len - i - 1;
+	else
+	{
+		*a3 = best_pos;
+		*a4 = best_len;
+	}
 }
 
 void writeshort(short val)
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+# Decodes a binary telemetry capture (see src/game/telemetry.c) into CSV.
+# The capture is a byte stream of tagged records: tag (u8), size (u8), then
+# size bytes of big endian payload. A TELEM_TAG_FRAME record starts a new
+# frame; all other records until the next one belong to that frame.
+#
+# Usage: telemetryDecoder.py capture.bin > telemetry.csv
+import sys
+import struct
+
+TAG_FRAME   = 0x01
+TAG_PROFILE = 0x02
+TAG_MEMORY  = 0x03
+TAG_OBJECTS = 0x04
+TAG_STATS   = 0x05
+
+PROFILE_FIELDS = ["cpu_us", "behavior_us", "graph_us", "audio_us", "rsp_us", "rdp_us"]
+# Must match enum FrameStat in src/game/frame_stats.h
+STAT_FIELDS = ["floor_calls", "ceil_calls", "wall_calls", "surfs_tested",
+               "cells_visited", "pool_bytes", "dl_words",
+               "dl_zex_nodes", "dl_rej_nodes", "ucode_switches"]
+
+COLUMNS = ["frame", "pool_free", "objects"] + PROFILE_FIELDS + STAT_FIELDS
+
+
+def emit(frame):
+    print(",".join(str(frame.get(col, "")) for col in COLUMNS))
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("Usage: telemetryDecoder.py capture.bin", file=sys.stderr)
+        sys.exit(1)
+
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+
+    print(",".join(COLUMNS))
+
+    frame = None
+    pos = 0
+    while pos + 2 <= len(data):
+        tag = data[pos]
+        size = data[pos + 1]
+        payload = data[pos + 2:pos + 2 + size]
+        pos += 2 + size
+        if len(payload) < size:
+            break  # truncated capture
+
+        if tag == TAG_FRAME and size == 4:
+            if frame is not None:
+                emit(frame)
+            frame = {"frame": struct.unpack(">L", payload)[0]}
+        elif frame is None:
+            continue  # wait for the first frame marker
+        elif tag == TAG_PROFILE and size == 2 * len(PROFILE_FIELDS):
+            values = struct.unpack(">%dH" % len(PROFILE_FIELDS), payload)
+            frame.update(zip(PROFILE_FIELDS, values))
+        elif tag == TAG_MEMORY and size == 4:
+            frame["pool_free"] = struct.unpack(">L", payload)[0]
+        elif tag == TAG_OBJECTS and size == 2:
+            frame["objects"] = struct.unpack(">H", payload)[0]
+        elif tag == TAG_STATS and size == 4 * len(STAT_FIELDS):
+            values = struct.unpack(">%dL" % len(STAT_FIELDS), payload)
+            frame.update(zip(STAT_FIELDS, values))
+        # unknown tags are skipped via their size byte
+
+    if frame is not None:
+        emit(frame)
+
+
+main()
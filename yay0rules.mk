@@ -1,7 +1,7 @@
 # Compress binary file
 $(BUILD_DIR)/%.szp: $(BUILD_DIR)/%.bin
 	$(call print,Compressing:,$<,$@)
-	$(V)$(YAY0TOOL) $< $@
+	$(V)$(CACHED_COMPRESS) -i $< -o $@ -- $(YAY0TOOL) $(YAY0FLAGS) $< $@
 
 # convert binary szp to object file
 $(BUILD_DIR)/%.szp.o: $(BUILD_DIR)/%.szp